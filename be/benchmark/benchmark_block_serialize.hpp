@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "agent/be_exec_version_manager.h"
+#include "gen_cpp/data.pb.h"
+#include "gen_cpp/segment_v2.pb.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// A block shaped like an exchange of lineitem: two bigint keys, a low cardinality string and a
+// string comment, 4064 rows (the default batch size).
+static Block bench_exchange_block() {
+    static constexpr size_t ROWS = 4064;
+    static const std::vector<std::string> flags {"A", "F", "N", "O", "R"};
+    std::mt19937_64 rng(0);
+    auto order_key = ColumnInt64::create();
+    auto part_key = ColumnInt64::create();
+    auto flag = ColumnString::create();
+    auto comment = ColumnString::create();
+    for (size_t i = 0; i < ROWS; ++i) {
+        order_key->insert_value(static_cast<Int64>(i * 4));
+        part_key->insert_value(static_cast<Int64>(rng() % 200000));
+        const auto& f = flags[rng() % flags.size()];
+        flag->insert_data(f.data(), f.size());
+        std::string c = "carefully final deposits " + std::to_string(rng() % 100000);
+        comment->insert_data(c.data(), c.size());
+    }
+    auto bigint = std::make_shared<DataTypeInt64>();
+    auto string = std::make_shared<DataTypeString>();
+    return Block({{std::move(order_key), bigint, "l_orderkey"},
+                  {std::move(part_key), bigint, "l_partkey"},
+                  {std::move(flag), string, "l_returnflag"},
+                  {std::move(comment), string, "l_comment"}});
+}
+
+static void BM_BlockSerialize(benchmark::State& state) {
+    const auto compression = static_cast<segment_v2::CompressionTypePB>(state.range(0));
+    const auto block = bench_exchange_block();
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    for (auto _ : state) {
+        PBlock pblock;
+        static_cast<void>(block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                          &uncompressed_bytes, &compressed_bytes, compression));
+        benchmark::DoNotOptimize(pblock);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+    state.counters["compressed_bytes"] = static_cast<double>(compressed_bytes);
+}
+
+static void BM_BlockDeserialize(benchmark::State& state) {
+    const auto compression = static_cast<segment_v2::CompressionTypePB>(state.range(0));
+    const auto block = bench_exchange_block();
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    PBlock pblock;
+    static_cast<void>(block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                      &uncompressed_bytes, &compressed_bytes, compression));
+    for (auto _ : state) {
+        Block result;
+        static_cast<void>(result.deserialize(pblock));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * uncompressed_bytes);
+}
+
+// every codec an exchange or a spill may be configured with
+#define BENCH_COMPRESSION_ARGS                                                                   \
+    Arg(segment_v2::NO_COMPRESSION)                                                              \
+            ->Arg(segment_v2::SNAPPY)                                                            \
+            ->Arg(segment_v2::LZ4)                                                               \
+            ->Arg(segment_v2::LZ4F)                                                              \
+            ->Arg(segment_v2::LZ4HC)                                                             \
+            ->Arg(segment_v2::ZLIB)                                                              \
+            ->Arg(segment_v2::ZSTD)
+
+BENCHMARK(BM_BlockSerialize)->BENCH_COMPRESSION_ARGS->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BlockDeserialize)->BENCH_COMPRESSION_ARGS->Unit(benchmark::kMicrosecond);
+
+#undef BENCH_COMPRESSION_ARGS
+
+} // namespace doris::vectorized
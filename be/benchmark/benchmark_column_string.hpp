@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/columns/column_string.h"
+
+namespace doris::vectorized {
+
+static ColumnString::MutablePtr bench_string_column(size_t rows, size_t avg_len) {
+    std::mt19937_64 rng(0);
+    auto column = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i) {
+        std::string s = std::to_string(rng());
+        s.resize(avg_len / 2 + rng() % (avg_len + 1), 'x');
+        column->insert_data(s.data(), s.size());
+    }
+    return column;
+}
+
+// WHERE over a string column, selectivity in percent.
+static void BM_ColumnStringFilter(benchmark::State& state) {
+    static constexpr size_t ROWS = 4064;
+    const auto selectivity = state.range(0);
+    auto column = bench_string_column(ROWS, 16);
+    IColumn::Filter filter(ROWS);
+    std::mt19937_64 rng(1);
+    for (auto& f : filter) {
+        f = static_cast<int64_t>(rng() % 100) < selectivity;
+    }
+    for (auto _ : state) {
+        auto result = column->filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+// Reorder a string column by a random permutation, as the sort and merge operators do.
+static void BM_ColumnStringPermute(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto column = bench_string_column(rows, 16);
+    IColumn::Permutation perm(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        perm[i] = i;
+    }
+    std::shuffle(perm.begin(), perm.end(), std::mt19937_64(1));
+    for (auto _ : state) {
+        auto result = column->permute(perm, 0);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+// ORDER BY a string column.
+static void BM_ColumnStringSort(benchmark::State& state) {
+    const auto rows = static_cast<size_t>(state.range(0));
+    const auto limit = static_cast<size_t>(state.range(1));
+    auto column = bench_string_column(rows, 16);
+    IColumn::Permutation perm;
+    for (auto _ : state) {
+        column->get_permutation(false, limit, 1, perm);
+        benchmark::DoNotOptimize(perm.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rows);
+}
+
+BENCHMARK(BM_ColumnStringFilter)->Arg(1)->Arg(50)->Arg(99);
+BENCHMARK(BM_ColumnStringPermute)->Arg(4064)->Arg(1 << 20)->Unit(benchmark::kMicrosecond);
+// full sort and top 100
+BENCHMARK(BM_ColumnStringSort)
+        ->ArgsProduct({{4064, 1 << 20}, {0, 100}})
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris::vectorized
@@ -0,0 +1,141 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "vec/columns/column_vector.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/common/hash_table/string_hash_map.h"
+
+namespace doris {
+
+// Emplace a batch of keys the way hash aggregation does: hash whole batch first, then emplace
+// row by row, optionally prefetching the bucket of the row HASH_MAP_PREFETCH_DIST ahead.
+template <typename HashMap, typename Key>
+static void emplace_batches(benchmark::State& state, const std::vector<Key>& keys) {
+    static constexpr size_t BATCH_SIZE = 4064;
+    const bool with_prefetch = state.range(1) != 0;
+    std::vector<size_t> hash_values(BATCH_SIZE);
+    for (auto _ : state) {
+        state.PauseTiming();
+        HashMap hash_map;
+        state.ResumeTiming();
+        for (size_t start = 0; start < keys.size(); start += BATCH_SIZE) {
+            const size_t rows = std::min(BATCH_SIZE, keys.size() - start);
+            const Key* batch = keys.data() + start;
+            for (size_t i = 0; i < rows; i++) {
+                hash_values[i] = hash_map.hash(batch[i]);
+            }
+            for (size_t i = 0; i < rows; i++) {
+                if (with_prefetch && i + HASH_MAP_PREFETCH_DIST < rows) {
+                    hash_map.template prefetch<false>(batch[i + HASH_MAP_PREFETCH_DIST],
+                                                      hash_values[i + HASH_MAP_PREFETCH_DIST]);
+                }
+                typename HashMap::LookupResult it;
+                hash_map.lazy_emplace(batch[i], it, hash_values[i],
+                                      [&](const auto& ctor, auto& key, auto&) {
+                                          ctor(key, nullptr);
+                                      });
+            }
+        }
+        benchmark::DoNotOptimize(hash_map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// GROUP BY a high cardinality bigint column, e.g. l_orderkey.
+static void BM_HashAggEmplaceUInt64(benchmark::State& state) {
+    std::vector<UInt64> keys(state.range(0));
+    std::mt19937_64 rng(0);
+    for (auto& key : keys) {
+        key = rng() % keys.size();
+    }
+    emplace_batches<PHHashMap<UInt64, char*, HashCRC32<UInt64>>>(state, keys);
+}
+
+// GROUP BY several fixed length columns packed into one key.
+static void BM_HashAggEmplaceUInt128(benchmark::State& state) {
+    std::vector<UInt128> keys(state.range(0));
+    std::mt19937_64 rng(0);
+    for (auto& key : keys) {
+        key = UInt128(rng() % keys.size()) << 64 | (rng() % 16);
+    }
+    emplace_batches<PHHashMap<UInt128, char*, HashCRC32<UInt128>>>(state, keys);
+}
+
+// GROUP BY a high cardinality string column, keys spread over every StringHashMap sub map.
+static void BM_HashAggEmplaceString(benchmark::State& state) {
+    std::vector<std::string> values(state.range(0));
+    std::mt19937_64 rng(0);
+    for (auto& value : values) {
+        value = std::to_string(rng() % values.size()) + std::string(rng() % 24, 'k');
+    }
+    std::vector<StringRef> keys(values.begin(), values.end());
+    emplace_batches<StringHashMap<char*>>(state, keys);
+}
+
+// Turn GROUP BY two int columns into hash keys, with the packed fixed key method the planner
+// picks for them and with the serialized method used for wide or variable length keys.
+template <typename Method>
+static void BM_HashAggInitKeys(benchmark::State& state) {
+    static constexpr size_t ROWS = 4064;
+    std::mt19937_64 rng(0);
+    auto a = vectorized::ColumnInt32::create();
+    auto b = vectorized::ColumnInt32::create();
+    for (size_t i = 0; i < ROWS; ++i) {
+        a->insert_value(static_cast<vectorized::Int32>(rng() % 1000));
+        b->insert_value(static_cast<vectorized::Int32>(rng() % 1000));
+    }
+    vectorized::ColumnRawPtrs key_columns {a.get(), b.get()};
+    std::unique_ptr<Method> method;
+    if constexpr (std::is_constructible_v<Method, vectorized::Sizes>) {
+        method = std::make_unique<Method>(
+                vectorized::Sizes {sizeof(vectorized::Int32), sizeof(vectorized::Int32)});
+    } else {
+        method = std::make_unique<Method>();
+    }
+    for (auto _ : state) {
+        method->init_serialized_keys(key_columns, ROWS);
+        benchmark::DoNotOptimize(method->keys);
+        method->reset();
+    }
+    state.SetItemsProcessed(state.iterations() * ROWS);
+}
+
+BENCHMARK_TEMPLATE(BM_HashAggInitKeys,
+                   vectorized::MethodKeysFixed<PHHashMap<UInt64, char*, HashCRC32<UInt64>>>);
+BENCHMARK_TEMPLATE(BM_HashAggInitKeys, vectorized::MethodSerialized<PHHashMap<StringRef, char*>>);
+BENCHMARK(BM_HashAggEmplaceUInt64)
+        ->Unit(benchmark::kMillisecond)
+        ->ArgsProduct({{1 << 16, 1 << 23}, {0, 1}});
+BENCHMARK(BM_HashAggEmplaceUInt128)
+        ->Unit(benchmark::kMillisecond)
+        ->ArgsProduct({{1 << 16, 1 << 23}, {0, 1}});
+BENCHMARK(BM_HashAggEmplaceString)
+        ->Unit(benchmark::kMillisecond)
+        ->ArgsProduct({{1 << 16, 1 << 23}, {0, 1}});
+
+} // namespace doris
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/common/hash_table/join_hash_table.h"
+
+namespace doris {
+
+// Inner join of lineitem (probe side) with orders (build side) by order key: the build side has
+// 1.5M unique keys per TPC-H scale factor, probed by random order keys.
+static void BM_JoinHashTableProbe(benchmark::State& state) {
+    using HashTable = JoinHashTable<int64_t, HashCRC32<int64_t>>;
+    static constexpr int BATCH_SIZE = 4064;
+    const auto build_rows = static_cast<size_t>(state.range(0));
+    const bool radix_build = state.range(1) != 0;
+    const bool huge_page = state.range(2) != 0;
+    const bool old_huge_page = config::enable_huge_page_for_large_allocation;
+    const int64_t old_huge_page_threshold = config::huge_page_allocation_threshold;
+    config::enable_huge_page_for_large_allocation = huge_page;
+    config::huge_page_allocation_threshold = 4L << 20;
+
+    // row 0 of the build side is mocked
+    std::vector<int64_t> build_keys(build_rows + 1);
+    for (size_t i = 1; i <= build_rows; i++) {
+        build_keys[i] = static_cast<int64_t>(i);
+    }
+    std::mt19937_64 rng(0);
+    std::shuffle(build_keys.begin() + 1, build_keys.end(), rng);
+    std::vector<int64_t> probe_keys(BATCH_SIZE);
+    std::uniform_int_distribution<int64_t> dist(1, static_cast<int64_t>(build_rows));
+
+    HashTable table;
+    table.prepare_build<TJoinOp::INNER_JOIN>(build_keys.size(), BATCH_SIZE, false, radix_build);
+    std::vector<uint32_t> bucket_nums(build_keys.size());
+    for (size_t i = 0; i < build_keys.size(); i++) {
+        bucket_nums[i] = table.hash(build_keys[i]) & (table.get_bucket_size() - 1);
+    }
+    table.build(build_keys.data(), bucket_nums.data(), build_keys.size(), false);
+
+    std::vector<uint32_t> build_idx_map(BATCH_SIZE);
+    std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+    int64_t matched_rows = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto& key : probe_keys) {
+            key = dist(rng);
+        }
+        state.ResumeTiming();
+        for (int i = 0; i < BATCH_SIZE; i++) {
+            build_idx_map[i] = table.hash(probe_keys[i]) & (table.get_bucket_size() - 1);
+        }
+        table.pre_build_idxs(build_idx_map);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        while (probe_idx < BATCH_SIZE || build_idx != 0) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    table.find_batch<TJoinOp::INNER_JOIN>(
+                            probe_keys.data(), build_idx_map.data(), probe_idx, build_idx,
+                            BATCH_SIZE, probe_idxs.data(), probe_visited, build_idxs.data(),
+                            nullptr, false, false, false);
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+            matched_rows += matched_cnt;
+        }
+        benchmark::DoNotOptimize(build_idxs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_SIZE);
+    state.counters["matched_rows"] = static_cast<double>(matched_rows);
+    config::enable_huge_page_for_large_allocation = old_huge_page;
+    config::huge_page_allocation_threshold = old_huge_page_threshold;
+}
+// build rows of TPC-H orders at scale factor 1 and 10, with chained and radix build, without and
+// with huge pages for the buckets
+BENCHMARK(BM_JoinHashTableProbe)
+        ->ArgsProduct({{1500000, 15000000}, {0, 1}, {0, 1}})
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/serde/data_type_serde.h"
+#include "vec/exec/format/json/new_json_reader.h"
+
+namespace doris::vectorized {
+
+static std::vector<std::string> bench_json_numbers() {
+    std::vector<std::string> tokens;
+    for (int i = 0; i < 4096; ++i) {
+        tokens.push_back(std::to_string(i * 7919 - 1000000));
+    }
+    return tokens;
+}
+
+// How json load parsed every number before: through the serde text deserializer.
+static void BM_JsonNumberSerDe(benchmark::State& state) {
+    auto tokens = bench_json_numbers();
+    auto serde = std::make_shared<DataTypeInt64>()->get_serde();
+    DataTypeSerDe::FormatOptions options;
+    for (auto _ : state) {
+        auto column = ColumnInt64::create();
+        for (auto& token : tokens) {
+            Slice slice {token.data(), token.size()};
+            static_cast<void>(serde->deserialize_one_cell_from_json(*column, slice, options));
+        }
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * tokens.size());
+}
+
+static void BM_JsonNumberDirect(benchmark::State& state) {
+    auto tokens = bench_json_numbers();
+    for (auto _ : state) {
+        auto column = ColumnInt64::create();
+        for (auto& token : tokens) {
+            NewJsonReader::try_write_number_to_column(token, TYPE_BIGINT, column.get());
+        }
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * tokens.size());
+}
+
+BENCHMARK(BM_JsonNumberSerDe);
+BENCHMARK(BM_JsonNumberDirect);
+
+} // namespace doris::vectorized
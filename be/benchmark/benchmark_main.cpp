@@ -17,36 +17,16 @@
 
 #include <benchmark/benchmark.h>
 
-#include <string>
-
-#include "vec/columns/column_string.h"
-#include "vec/core/block.h"
-#include "vec/data_types/data_type.h"
-#include "vec/data_types/data_type_string.h"
-
-namespace doris::vectorized { // change if need
-
-static void Example1(benchmark::State& state) {
-    // init. dont time it.
-    state.PauseTiming();
-    Block block;
-    DataTypePtr str_type = std::make_shared<DataTypeString>();
-    std::vector<std::string> vals {100, "content"};
-    state.ResumeTiming();
-
-    // do test
-    for (auto _ : state) {
-        auto str_col = ColumnString::create();
-        for (auto& v : vals) {
-            str_col->insert_data(v.data(), v.size());
-        }
-        block.insert({std::move(str_col), str_type, "col"});
-        benchmark::DoNotOptimize(block); // mark the watched target
-    }
-}
-// could BENCHMARK many functions to compare them together.
-BENCHMARK(Example1);
-
-} // namespace doris::vectorized
-
+#include "benchmark_block_serialize.hpp"
+#include "benchmark_column_string.hpp"
+#include "benchmark_hash_map_emplace.hpp"
+#include "benchmark_join_hash_table.hpp"
+#include "benchmark_json_number.hpp"
+#include "benchmark_page_encoding.hpp"
+#include "benchmark_string_utf8.hpp"
+#include "benchmark_task_queue.hpp"
+
+// Every suite uses fixed seeds for its synthetic data, so results of two builds are comparable.
+// Track regressions with the JSON reporter, e.g.
+//   benchmark_test --benchmark_format=json --benchmark_out=result.json --benchmark_repetitions=5
 BENCHMARK_MAIN();
@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gen_cpp/segment_v2.pb.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/slice.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::segment_v2 {
+
+static constexpr size_t PAGE_VALUES = 65536;
+
+// Sorted keys with small gaps, which is what bitshuffle is good at.
+template <typename T>
+static std::vector<T> bench_page_values() {
+    std::vector<T> values(PAGE_VALUES);
+    std::mt19937_64 rng(0);
+    T value = 0;
+    for (auto& v : values) {
+        value += static_cast<T>(rng() % 16);
+        v = value;
+    }
+    return values;
+}
+
+template <typename T>
+static OwnedSlice bench_build_page(const EncodingInfo* encoding, const std::vector<T>& values) {
+    PageBuilderOptions options;
+    options.data_page_size = PAGE_VALUES * sizeof(T) * 2;
+    PageBuilder* builder_ptr = nullptr;
+    static_cast<void>(encoding->create_page_builder(options, &builder_ptr));
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = values.size();
+    static_cast<void>(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count));
+    OwnedSlice page;
+    static_cast<void>(builder->finish(&page));
+    return page;
+}
+
+template <FieldType Type, typename T>
+static void BM_PageEncode(benchmark::State& state) {
+    const EncodingInfo* encoding = nullptr;
+    static_cast<void>(EncodingInfo::get(get_scalar_type_info<Type>(),
+                                        static_cast<EncodingTypePB>(state.range(0)), &encoding));
+    const auto values = bench_page_values<T>();
+    size_t page_size = 0;
+    for (auto _ : state) {
+        auto page = bench_build_page(encoding, values);
+        page_size = page.slice().size;
+        benchmark::DoNotOptimize(page.slice().data);
+    }
+    state.SetItemsProcessed(state.iterations() * PAGE_VALUES);
+    state.counters["page_bytes"] = static_cast<double>(page_size);
+}
+
+// Includes the pre decoding step that the page reader runs before the page enters the cache.
+template <FieldType Type, typename T>
+static void BM_PageDecode(benchmark::State& state) {
+    const EncodingInfo* encoding = nullptr;
+    static_cast<void>(EncodingInfo::get(get_scalar_type_info<Type>(),
+                                        static_cast<EncodingTypePB>(state.range(0)), &encoding));
+    const auto values = bench_page_values<T>();
+    const auto page = bench_build_page(encoding, values);
+    PageDecoderOptions options;
+    for (auto _ : state) {
+        Slice page_slice = page.slice();
+        std::unique_ptr<DataPage> decoded_page;
+        if (auto* pre_decoder = encoding->get_data_page_pre_decoder()) {
+            static_cast<void>(pre_decoder->decode(&decoded_page, &page_slice, 0, false,
+                                                  PageTypePB::DATA_PAGE));
+        }
+        PageDecoder* decoder_ptr = nullptr;
+        static_cast<void>(encoding->create_page_decoder(page_slice, options, &decoder_ptr));
+        std::unique_ptr<PageDecoder> decoder(decoder_ptr);
+        static_cast<void>(decoder->init());
+        vectorized::MutableColumnPtr column = vectorized::ColumnVector<T>::create();
+        size_t n = PAGE_VALUES;
+        static_cast<void>(decoder->next_batch(&n, column));
+        benchmark::DoNotOptimize(column);
+    }
+    state.SetItemsProcessed(state.iterations() * PAGE_VALUES);
+}
+
+BENCHMARK_TEMPLATE(BM_PageEncode, FieldType::OLAP_FIELD_TYPE_INT, int32_t)
+        ->Arg(PLAIN_ENCODING)
+        ->Arg(BIT_SHUFFLE)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PageEncode, FieldType::OLAP_FIELD_TYPE_BIGINT, int64_t)
+        ->Arg(PLAIN_ENCODING)
+        ->Arg(BIT_SHUFFLE)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PageDecode, FieldType::OLAP_FIELD_TYPE_INT, int32_t)
+        ->Arg(PLAIN_ENCODING)
+        ->Arg(BIT_SHUFFLE)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_PageDecode, FieldType::OLAP_FIELD_TYPE_BIGINT, int64_t)
+        ->Arg(PLAIN_ENCODING)
+        ->Arg(BIT_SHUFFLE)
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris::segment_v2
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include "util/simd/vstring_function.h"
+
+namespace doris::vectorized {
+
+static std::vector<std::string> bench_utf8_strings(bool ascii) {
+    static const std::vector<std::string> words_ascii {"doris", "vectorized", "engine", "etl"};
+    static const std::vector<std::string> words_utf8 {"多维", "分析", "données", "запрос"};
+    const auto& words = ascii ? words_ascii : words_utf8;
+    std::vector<std::string> strings;
+    for (int i = 0; i < 4096; ++i) {
+        std::string s;
+        for (int j = 0; j < 4 + i % 16; ++j) {
+            s += words[(i + j) % words.size()];
+            s += ' ';
+        }
+        strings.push_back(std::move(s));
+    }
+    return strings;
+}
+
+// How substring and locate found a char position before: record the offset of every char.
+static void BM_Utf8CharIndex(benchmark::State& state) {
+    auto strings = bench_utf8_strings(state.range(0));
+    for (auto _ : state) {
+        size_t total = 0;
+        for (const auto& s : strings) {
+            std::vector<size_t> index;
+            simd::VStringFunctions::get_char_len(s.data(), s.size(), index);
+            total += index.size() > 10 ? index[10] : s.size();
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void BM_Utf8SkipChars(benchmark::State& state) {
+    auto strings = bench_utf8_strings(state.range(0));
+    for (auto _ : state) {
+        size_t total = 0;
+        for (const auto& s : strings) {
+            total += simd::VStringFunctions::skip_chars(s.data(), s.size(), 10);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void BM_Utf8CharLength(benchmark::State& state) {
+    auto strings = bench_utf8_strings(state.range(0));
+    for (auto _ : state) {
+        size_t total = 0;
+        for (const auto& s : strings) {
+            total += simd::VStringFunctions::get_char_len(s.data(), s.size());
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+BENCHMARK(BM_Utf8CharIndex)->Arg(0)->Arg(1);
+BENCHMARK(BM_Utf8SkipChars)->Arg(0)->Arg(1);
+BENCHMARK(BM_Utf8CharLength)->Arg(0)->Arg(1);
+
+} // namespace doris::vectorized
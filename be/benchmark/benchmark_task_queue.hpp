@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "pipeline/pipeline_task.h"
+#include "pipeline/task_queue.h"
+
+namespace doris::pipeline {
+
+// The task queues only touch the scheduling fields (runtime and queue level) of a task, so
+// the benchmark uses zero filled storage instead of building real pipeline tasks. They are
+// never freed.
+static PipelineTask* bench_dummy_task(size_t idx) {
+    static constexpr size_t TASK_NUM = 1024;
+    static std::vector<PipelineTask*> tasks = [] {
+        std::vector<PipelineTask*> res;
+        for (size_t i = 0; i < TASK_NUM; ++i) {
+            res.push_back(static_cast<PipelineTask*>(std::calloc(1, sizeof(PipelineTask))));
+        }
+        return res;
+    }();
+    return tasks[idx % TASK_NUM];
+}
+
+// Every thread pushes tasks to its own queue and takes them back, stealing from other
+// queues with a probability of 1/4, as the TaskScheduler workers do.
+template <typename Queue>
+static void BM_TaskQueuePushTake(benchmark::State& state) {
+    static constexpr int QUEUE_NUM = 16;
+    static constexpr int TASK_NUM_PER_THREAD = 64;
+    static std::vector<Queue> queues(QUEUE_NUM);
+    int core_id = state.thread_index() % QUEUE_NUM;
+
+    std::vector<PipelineTask*> my_tasks;
+    for (int i = 0; i < TASK_NUM_PER_THREAD; ++i) {
+        my_tasks.push_back(bench_dummy_task(core_id * TASK_NUM_PER_THREAD + i));
+    }
+
+    int64_t taken = 0;
+    for (auto _ : state) {
+        for (auto* task : my_tasks) {
+            static_cast<void>(queues[core_id].push(task));
+        }
+        for (int i = 0; i < TASK_NUM_PER_THREAD; ++i) {
+            int victim = (i & 3) == 0 ? (core_id + 1) % QUEUE_NUM : core_id;
+            auto* task = queues[victim].try_take(victim != core_id);
+            if (!task) {
+                task = queues[core_id].try_take(false);
+            }
+            taken += task != nullptr;
+            benchmark::DoNotOptimize(task);
+        }
+    }
+    // drain the tasks left by stealing, so that the queues are empty for the next run
+    while (queues[core_id].try_take(false)) {
+    }
+    state.SetItemsProcessed(taken);
+}
+
+BENCHMARK_TEMPLATE(BM_TaskQueuePushTake, PriorityTaskQueue)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_TaskQueuePushTake, LockFreePriorityTaskQueue)
+        ->ThreadRange(1, 16)
+        ->UseRealTime();
+
+} // namespace doris::pipeline
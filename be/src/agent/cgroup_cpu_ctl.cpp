@@ -134,6 +134,11 @@ Status CgroupCpuCtl::init_cgroup_v2_query_path_public_file(std::string home_path
     }
     RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_doris_cgroup_cpu_path_subtree_ctl_file, "+cpu",
                                                     "set cpu controller", false));
+    // cpuset controller is only needed by dedicated cores, so it is not fatal if the
+    // controller is not delegated to doris.
+    WARN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_doris_cgroup_cpu_path_subtree_ctl_file,
+                                                  "+cpuset", "set cpuset controller", false),
+                  "enable cpuset controller for doris home path failed");
 
     // 2 enable cpu controller for query path's child
     _cgroup_v2_query_path_subtree_ctl_file = query_path + "/cgroup.subtree_control";
@@ -142,6 +147,9 @@ Status CgroupCpuCtl::init_cgroup_v2_query_path_public_file(std::string home_path
     }
     RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_path_subtree_ctl_file, "+cpu",
                                                     "set cpu controller", false));
+    WARN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(_cgroup_v2_query_path_subtree_ctl_file,
+                                                  "+cpuset", "set cpuset controller", false),
+                  "enable cpuset controller for query path failed");
 
     // 3 write cgroup.procs
     _doris_cg_v2_procs_file = query_path + "/cgroup.procs";
@@ -199,6 +207,23 @@ void CgroupCpuCtl::update_cpu_soft_limit(int cpu_shares) {
     }
 }
 
+void CgroupCpuCtl::update_cpuset(const std::string& cpus, const std::string& mems) {
+    if (!_init_succ) {
+        return;
+    }
+    std::lock_guard<std::shared_mutex> w_lock(_lock_mutex);
+    if (_cpuset_cpus != cpus || _cpuset_mems != mems) {
+        Status ret = modify_cg_cpuset_no_lock(cpus, mems);
+        if (ret.ok()) {
+            _cpuset_cpus = cpus;
+            _cpuset_mems = mems;
+        } else {
+            LOG(WARNING) << "update cpuset of workload group " << _wg_id << " to cpus=[" << cpus
+                         << "] mems=[" << mems << "] failed, " << ret;
+        }
+    }
+}
+
 Status CgroupCpuCtl::write_cg_sys_file(std::string file_path, std::string value, std::string msg,
                                        bool is_append) {
     int fd = open(file_path.c_str(), is_append ? O_RDWR | O_APPEND : O_RDWR);
@@ -346,6 +371,12 @@ Status CgroupV1CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v1_cpu_tg_task_file);
 }
 
+Status CgroupV1CpuCtl::modify_cg_cpuset_no_lock(const std::string& cpus,
+                                                 const std::string& mems) {
+    // cpuset is a separate hierarchy in cgroup v1, doris only manages the cpu one
+    return Status::NotSupported("dedicated cores of workload group need cgroup v2");
+}
+
 Status CgroupV2CpuCtl::init() {
     if (!_is_cgroup_query_path_valid) {
         return Status::InternalError<false>(" cgroup query path is empty");
@@ -415,6 +446,20 @@ Status CgroupV2CpuCtl::modify_cg_cpu_soft_limit_no_lock(int cpu_weight) {
                                            false);
 }
 
+Status CgroupV2CpuCtl::modify_cg_cpuset_no_lock(const std::string& cpus,
+                                                 const std::string& mems) {
+    std::string cpus_file = _cgroup_v2_query_wg_path + "/cpuset.cpus";
+    std::string mems_file = _cgroup_v2_query_wg_path + "/cpuset.mems";
+    if (access(cpus_file.c_str(), F_OK) != 0 || access(mems_file.c_str(), F_OK) != 0) {
+        return Status::InternalError<false>("not find cgroup v2 wg cpuset files, path={}",
+                                            _cgroup_v2_query_wg_path);
+    }
+    RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(mems_file, mems,
+                                                    "modify cpuset.mems to [" + mems + "]", false));
+    return CgroupCpuCtl::write_cg_sys_file(cpus_file, cpus, "modify cpuset.cpus to [" + cpus + "]",
+                                           false);
+}
+
 Status CgroupV2CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v2_query_wg_thread_file);
 }
@@ -45,6 +45,10 @@ public:
 
     void update_cpu_soft_limit(int cpu_shares);
 
+    // Restrict the workload group's threads to the given cpus and memory nodes, in cpuset
+    // list format (e.g. "0-3,8"). Empty strings mean inheriting the parent's cpuset.
+    void update_cpuset(const std::string& cpus, const std::string& mems);
+
     // for log
     void get_cgroup_cpu_info(uint64_t* cpu_shares, int* cpu_hard_limit);
 
@@ -63,6 +67,8 @@ protected:
 
     virtual Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) = 0;
 
+    virtual Status modify_cg_cpuset_no_lock(const std::string& cpus, const std::string& mems) = 0;
+
     Status add_thread_to_cgroup(std::string task_file);
 
     static Status write_cg_sys_file(std::string file_path, std::string value, std::string msg,
@@ -91,6 +97,8 @@ protected:
     bool _init_succ = false;
     uint64_t _wg_id = -1; // workload group id
     uint64_t _cpu_shares = 0;
+    std::string _cpuset_cpus;
+    std::string _cpuset_mems;
 };
 
 /*
@@ -125,6 +133,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::string& cpus, const std::string& mems) override;
     Status add_thread_to_cgroup() override;
 
 private:
@@ -166,6 +175,10 @@ private:
     10 workload group cgroup type file:
         /sys/fs/cgroup/{doris_home}/query/{workload_group_id}/cgroup.type
 
+    11 workload group cpuset files:
+        /sys/fs/cgroup/{doris_home}/query/{workload_group_id}/cpuset.cpus
+        /sys/fs/cgroup/{doris_home}/query/{workload_group_id}/cpuset.mems
+
 */
 class CgroupV2CpuCtl : public CgroupCpuCtl {
 public:
@@ -173,6 +186,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::string& cpus, const std::string& mems) override;
     Status add_thread_to_cgroup() override;
 
 private:
@@ -60,6 +60,7 @@
 #include "io/fs/path.h"
 #include "io/fs/remote_file_system.h"
 #include "io/fs/s3_file_system.h"
+#include "olap/cumulative_compaction_leveled_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
@@ -86,6 +87,7 @@
 #include "service/backend_options.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/hash_util.hpp"
 #include "util/jni-util.h"
 #include "util/mem_info.h"
 #include "util/random.h"
@@ -515,6 +517,58 @@ bvar::Adder<uint64_t> report_disk_total("report", "disk_total");
 bvar::Adder<uint64_t> report_disk_failed("report", "disk_failed");
 bvar::Adder<uint64_t> report_tablet_total("report", "tablet_total");
 bvar::Adder<uint64_t> report_tablet_failed("report", "tablet_failed");
+bvar::Adder<uint64_t> report_tablet_skipped("report", "tablet_skipped");
+
+// digest of the last successful tablet report and how many reports were skipped since then
+std::atomic<uint64_t> s_last_tablet_report_digest = 0;
+std::atomic<int32_t> s_skipped_tablet_reports = 0;
+
+// Digest of the content FE acts on in a tablet report. The report version and compaction
+// score are excluded since they change every round even if the tablets do not change.
+uint64_t tablet_report_digest(const TReportRequest& request, const ClusterInfo* cluster_info) {
+    size_t seed = 0;
+    // a new master FE must get a full report
+    HashUtil::hash_combine(seed, cluster_info->master_fe_addr.hostname);
+    HashUtil::hash_combine(seed, cluster_info->master_fe_addr.port);
+    for (const auto& [tablet_id, tablet] : request.tablets) {
+        for (const auto& info : tablet.tablet_infos) {
+            HashUtil::hash_combine(seed, info.tablet_id);
+            HashUtil::hash_combine(seed, info.schema_hash);
+            HashUtil::hash_combine(seed, info.version);
+            HashUtil::hash_combine(seed, info.row_count);
+            HashUtil::hash_combine(seed, info.data_size);
+            HashUtil::hash_combine(seed, info.remote_data_size);
+            HashUtil::hash_combine(seed, info.total_version_count);
+            HashUtil::hash_combine(seed, info.visible_version_count);
+            HashUtil::hash_combine(seed, info.used);
+            HashUtil::hash_combine(seed, info.version_miss);
+            HashUtil::hash_combine(seed, info.path_hash);
+            HashUtil::hash_combine(seed, info.replica_id);
+            HashUtil::hash_combine(seed, info.partition_id);
+            HashUtil::hash_combine(seed, static_cast<int>(info.storage_medium));
+            HashUtil::hash_combine(seed, info.is_in_memory);
+            HashUtil::hash_combine(seed, info.cooldown_term);
+            HashUtil::hash_combine(seed, info.cooldown_meta_id.hi);
+            HashUtil::hash_combine(seed, info.cooldown_meta_id.lo);
+            for (auto txn_id : info.transaction_ids) {
+                HashUtil::hash_combine(seed, txn_id);
+            }
+        }
+    }
+    for (const auto& [partition_id, version] : request.partitions_version) {
+        HashUtil::hash_combine(seed, partition_id);
+        HashUtil::hash_combine(seed, version);
+    }
+    for (const auto& policy : request.storage_policy) {
+        HashUtil::hash_combine(seed, policy.id);
+        HashUtil::hash_combine(seed, policy.version);
+    }
+    for (const auto& resource : request.resource) {
+        HashUtil::hash_combine(seed, resource.id);
+        HashUtil::hash_combine(seed, resource.version);
+    }
+    return seed;
+}
 
 } // namespace
 
@@ -819,10 +873,11 @@ void update_tablet_meta_callback(StorageEngine& engine, const TAgentTaskRequest&
         }
         if (tablet_meta_info.__isset.compaction_policy) {
             if (tablet_meta_info.compaction_policy != CUMULATIVE_SIZE_BASED_POLICY &&
-                tablet_meta_info.compaction_policy != CUMULATIVE_TIME_SERIES_POLICY) {
+                tablet_meta_info.compaction_policy != CUMULATIVE_TIME_SERIES_POLICY &&
+                tablet_meta_info.compaction_policy != CUMULATIVE_LEVELED_POLICY) {
                 status = Status::InvalidArgument(
-                        "invalid compaction policy, only support for size_based or "
-                        "time_series");
+                        "invalid compaction policy, only support for size_based, time_series or "
+                        "leveled");
                 continue;
             }
             tablet->tablet_meta()->set_compaction_policy(tablet_meta_info.compaction_policy);
@@ -1135,11 +1190,28 @@ void report_tablet_callback(StorageEngine& engine, const ClusterInfo* cluster_in
     }
     request.__isset.resource = true;
 
+    // FE processes the whole report every round even if nothing changed, skip the report if
+    // it is the same as the last successful one, and still send one every
+    // `report_tablet_max_skip_times` + 1 rounds to reconcile with FE.
+    uint64_t digest = tablet_report_digest(request, cluster_info);
+    if (digest == s_last_tablet_report_digest &&
+        s_skipped_tablet_reports < config::report_tablet_max_skip_times) {
+        s_skipped_tablet_reports++;
+        report_tablet_skipped << 1;
+        VLOG_NOTICE << "skip tablet report since tablets are not changed, report version "
+                    << report_version;
+        return;
+    }
+
     bool succ = handle_report(request, cluster_info, "tablet");
     report_tablet_total << 1;
     if (!succ) [[unlikely]] {
         report_tablet_failed << 1;
+        s_last_tablet_report_digest = 0;
+    } else {
+        s_last_tablet_report_digest = digest;
     }
+    s_skipped_tablet_reports = 0;
 }
 
 void report_tablet_callback(CloudStorageEngine& engine, const ClusterInfo* cluster_info) {
@@ -83,5 +83,7 @@ void WorkloadGroupListener::handle_topic_info(const std::vector<TopicInfo>& topi
                   << list_size;
     }
     _exec_env->workload_group_mgr()->delete_workload_group_by_ids(current_wg_ids);
+
+    _exec_env->workload_group_mgr()->rebalance_dedicated_cores();
 }
 } // namespace doris
\ No newline at end of file
@@ -17,6 +17,9 @@
 
 #include "cloud/cloud_internal_service.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_mgr.h"
 #include "io/cache/block_file_cache.h"
@@ -71,6 +74,9 @@ void CloudInternalServiceImpl::get_file_cache_meta_by_tablet_id(
         LOG_WARNING("try to access tablet file cache meta, but file cache not enabled");
         return;
     }
+    // <hits, meta> of the blocks of all requested tablets, the hottest blocks are put at the
+    // front of the response so that the requester downloads them first
+    std::vector<std::pair<uint32_t, FileCacheBlockMeta>> hot_blocks;
     for (const auto& tablet_id : request->tablet_ids()) {
         auto res = _engine.tablet_mgr().get_tablet(tablet_id);
         if (!res.has_value()) {
@@ -89,20 +95,32 @@ void CloudInternalServiceImpl::get_file_cache_meta_by_tablet_id(
 
                 auto segments_meta = cache->get_hot_blocks_meta(cache_key);
                 for (const auto& tuple : segments_meta) {
-                    FileCacheBlockMeta* meta = response->add_file_cache_block_metas();
-                    meta->set_tablet_id(tablet_id);
-                    meta->set_rowset_id(rowset_id);
-                    meta->set_segment_id(segment_id);
-                    meta->set_file_name(file_name);
-                    meta->set_file_size(rowset->rowset_meta()->segment_file_size(segment_id));
-                    meta->set_offset(std::get<0>(tuple));
-                    meta->set_size(std::get<1>(tuple));
-                    meta->set_cache_type(cache_type_to_pb(std::get<2>(tuple)));
-                    meta->set_expiration_time(std::get<3>(tuple));
+                    FileCacheBlockMeta meta;
+                    meta.set_tablet_id(tablet_id);
+                    meta.set_rowset_id(rowset_id);
+                    meta.set_segment_id(segment_id);
+                    meta.set_file_name(file_name);
+                    meta.set_file_size(rowset->rowset_meta()->segment_file_size(segment_id));
+                    meta.set_offset(std::get<0>(tuple));
+                    meta.set_size(std::get<1>(tuple));
+                    meta.set_cache_type(cache_type_to_pb(std::get<2>(tuple)));
+                    meta.set_expiration_time(std::get<3>(tuple));
+                    hot_blocks.emplace_back(std::get<4>(tuple), std::move(meta));
                 }
             }
         });
     }
+    // index blocks are needed by every query of the segment, they go first on equal heat
+    std::stable_sort(hot_blocks.begin(), hot_blocks.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.first != rhs.first) {
+            return lhs.first > rhs.first;
+        }
+        return lhs.second.cache_type() == FileCacheType::INDEX &&
+               rhs.second.cache_type() != FileCacheType::INDEX;
+    });
+    for (auto& [_, meta] : hot_blocks) {
+        *response->add_file_cache_block_metas() = std::move(meta);
+    }
 }
 
 } // namespace doris
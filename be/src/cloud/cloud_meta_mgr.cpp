@@ -34,6 +34,7 @@
 #include <shared_mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "cloud/cloud_storage_engine.h"
@@ -582,7 +583,10 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, bool warmup_delta_
             }
             std::vector<RowsetSharedPtr> rowsets;
             rowsets.reserve(resp.rowset_meta().size());
-            for (const auto& cloud_rs_meta_pb : resp.rowset_meta()) {
+            // Rowsets of the same schema version without dict columns carry the same schema,
+            // only convert and parse it once for each schema version.
+            std::unordered_map<int32_t, RowsetMetaSharedPtr> schema_version_to_rs_meta;
+            for (auto& cloud_rs_meta_pb : *resp.mutable_rowset_meta()) {
                 VLOG_DEBUG << "get rowset meta, tablet_id=" << cloud_rs_meta_pb.tablet_id()
                            << ", version=[" << cloud_rs_meta_pb.start_version() << '-'
                            << cloud_rs_meta_pb.end_version() << ']';
@@ -592,10 +596,29 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, bool warmup_delta_
                     existed_rowset->rowset_id().to_string() == cloud_rs_meta_pb.rowset_id_v2()) {
                     continue; // Same rowset, skip it
                 }
-                RowsetMetaPB meta_pb = cloud_rowset_meta_to_doris(
-                        cloud_rs_meta_pb, resp.has_schema_dict() ? &resp.schema_dict() : nullptr);
+                RowsetMetaSharedPtr schema_rs_meta;
+                bool shareable_schema = cloud_rs_meta_pb.has_tablet_schema() &&
+                                        cloud_rs_meta_pb.has_schema_version() &&
+                                        !cloud_rs_meta_pb.has_schema_dict_key_list();
+                if (shareable_schema) {
+                    auto it = schema_version_to_rs_meta.find(cloud_rs_meta_pb.schema_version());
+                    if (it != schema_version_to_rs_meta.end()) {
+                        schema_rs_meta = it->second;
+                        cloud_rs_meta_pb.clear_tablet_schema();
+                    }
+                }
+                const SchemaCloudDictionary* schema_dict =
+                        resp.has_schema_dict() && schema_rs_meta == nullptr ? &resp.schema_dict()
+                                                                            : nullptr;
+                RowsetMetaPB meta_pb =
+                        cloud_rowset_meta_to_doris(std::move(cloud_rs_meta_pb), schema_dict);
                 auto rs_meta = std::make_shared<RowsetMeta>();
                 rs_meta->init_from_pb(meta_pb);
+                if (schema_rs_meta != nullptr) {
+                    rs_meta->share_tablet_schema(*schema_rs_meta);
+                } else if (shareable_schema) {
+                    schema_version_to_rs_meta.emplace(meta_pb.schema_version(), rs_meta);
+                }
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 Status s = RowsetFactory::create_rowset(nullptr, "", rs_meta, &rowset);
@@ -308,6 +308,14 @@ Status CloudStorageEngine::start_bg_threads(std::shared_ptr<WorkloadGroup> wg_sp
         LOG(INFO) << "check file cache ttl block valid thread started";
     }
 
+    if (config::file_cache_hotspot_promote_interval_seconds > 0) {
+        RETURN_IF_ERROR(Thread::create(
+                "StorageEngine", "promote_hot_tablets_file_cache_thread",
+                [this]() { this->_promote_hot_tablets_file_cache(); },
+                &_bg_threads.emplace_back()));
+        LOG(INFO) << "promote hot tablets file cache thread started";
+    }
+
     LOG(INFO) << "lease compaction thread started";
 
     return Status::OK();
@@ -336,6 +344,39 @@ void CloudStorageEngine::_check_file_cache_ttl_block_valid() {
     }
 }
 
+void CloudStorageEngine::_promote_hot_tablets_file_cache() {
+    while (!_stop_background_threads_latch.wait_for(
+            std::chrono::seconds(config::file_cache_hotspot_promote_interval_seconds))) {
+        std::vector<int64_t> hot_tablet_ids;
+        _tablet_hotspot->get_top_n_hot_tablets(
+                static_cast<size_t>(config::file_cache_hotspot_promote_top_n_tablets),
+                &hot_tablet_ids);
+        std::unordered_set<int64_t> hot_tablets(hot_tablet_ids.begin(), hot_tablet_ids.end());
+        // Promoted blocks outlive two rounds, so the blocks of a tablet which stays hot never
+        // expire, and they are demoted to the NORMAL queue soon after the tablet becomes cold.
+        int64_t expiration_time =
+                UnixSeconds() + 2 * config::file_cache_hotspot_promote_interval_seconds;
+        auto weak_tablets = tablet_mgr().get_weak_tablets();
+        for (const auto& tablet_wk : weak_tablets) {
+            auto tablet = tablet_wk.lock();
+            if (!tablet || !hot_tablets.contains(tablet->tablet_id())) continue;
+            // the blocks of a tablet with ttl are already in the TTL queue
+            if (tablet->tablet_meta()->ttl_seconds() != 0) continue;
+            tablet->hot_file_cache_expiration_time = expiration_time;
+            auto rowsets = tablet->get_snapshot_rowset();
+            for (const auto& rowset : rowsets) {
+                for (uint32_t seg_id = 0; seg_id < rowset->num_segments(); seg_id++) {
+                    auto hash = Segment::file_cache_key(rowset->rowset_id().to_string(), seg_id);
+                    auto* file_cache = io::FileCacheFactory::instance()->get_by_path(hash);
+                    file_cache->modify_expiration_time(hash,
+                                                       static_cast<uint64_t>(expiration_time));
+                }
+            }
+        }
+        VLOG_DEBUG << "promote file cache of " << hot_tablets.size() << " hot tablets";
+    }
+}
+
 void CloudStorageEngine::sync_storage_vault() {
     cloud::StorageVaultInfos vault_infos;
     bool enable_storage_vault = false;
@@ -460,7 +501,7 @@ void CloudStorageEngine::_compaction_tasks_producer_callback() {
 
     int64_t interval = config::generate_compaction_tasks_interval_ms;
     do {
-        if (!config::disable_auto_compaction) {
+        if (!config::disable_auto_compaction && !config::is_cloud_query_only_node()) {
             Status st = _adjust_compaction_thread_num();
             if (!st.ok()) {
                 break;
@@ -73,6 +73,7 @@ public:
         return *_calc_tablet_delete_bitmap_task_thread_pool;
     }
     void _check_file_cache_ttl_block_valid();
+    void _promote_hot_tablets_file_cache();
 
     std::optional<StorageResource> get_storage_resource(const std::string& vault_id) {
         VLOG_DEBUG << "Getting storage resource for vault_id: " << vault_id;
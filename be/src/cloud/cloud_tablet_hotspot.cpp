@@ -17,7 +17,9 @@
 
 #include "cloud/cloud_tablet_hotspot.h"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <mutex>
 
 #include "cloud/config.h"
@@ -155,6 +157,26 @@ void TabletHotspot::get_top_n_hot_partition(std::vector<THotTableMessage>* hot_t
     _last_week_hot_partitions = std::move(week_hot_partitions);
 }
 
+void TabletHotspot::get_top_n_hot_tablets(size_t n, std::vector<int64_t>* tablet_ids) {
+    // <qpd, tablet_id>
+    std::vector<std::pair<uint64_t, int64_t>> hot_tablets;
+    std::for_each(_tablets_hotspot.begin(), _tablets_hotspot.end(), [&](HotspotMap& map) {
+        std::lock_guard lock(map.mtx);
+        for (auto& [tablet_id, counter] : map.map) {
+            if (uint64_t qpd = counter->qpd(); qpd != 0) {
+                hot_tablets.emplace_back(qpd, tablet_id);
+            }
+        }
+    });
+    n = std::min(n, hot_tablets.size());
+    std::partial_sort(hot_tablets.begin(), hot_tablets.begin() + n, hot_tablets.end(),
+                      std::greater<>());
+    tablet_ids->reserve(tablet_ids->size() + n);
+    for (size_t i = 0; i < n; ++i) {
+        tablet_ids->push_back(hot_tablets[i].second);
+    }
+}
+
 void HotspotCounter::make_dot_point() {
     uint64_t value = cur_counter.load();
     cur_counter = 0;
@@ -53,6 +53,7 @@ DEFINE_mInt32(check_auto_compaction_interval_seconds, "5");
 DEFINE_mInt32(max_base_compaction_task_num_per_disk, "2");
 DEFINE_mBool(prioritize_query_perf_in_compaction, "false");
 DEFINE_mInt32(compaction_max_rowset_count, "10000");
+DEFINE_mString(cloud_compaction_role, "mixed");
 
 DEFINE_mInt32(refresh_s3_info_interval_s, "60");
 DEFINE_mInt32(vacuum_stale_rowsets_interval_s, "300");
@@ -81,5 +82,11 @@ DEFINE_mBool(enable_cloud_tablet_report, "true");
 DEFINE_mInt32(delete_bitmap_rpc_retry_times, "25");
 
 DEFINE_mInt64(meta_service_rpc_reconnect_interval_ms, "5000");
+
+DEFINE_mInt32(scan_sync_tablets_concurrency, "10");
+
+DEFINE_mInt64(file_cache_hotspot_promote_interval_seconds, "0");
+
+DEFINE_mInt32(file_cache_hotspot_promote_top_n_tablets, "1000");
 #include "common/compile_check_end.h"
 } // namespace doris::config
@@ -84,6 +84,21 @@ DECLARE_mInt32(check_auto_compaction_interval_seconds);
 DECLARE_mInt32(max_base_compaction_task_num_per_disk);
 DECLARE_mBool(prioritize_query_perf_in_compaction);
 DECLARE_mInt32(compaction_max_rowset_count);
+// The compaction role of this BE:
+// - "mixed": schedule compaction for the tablets it serves, the default.
+// - "query": never schedule compaction, compacted rowsets are picked up from the meta service when
+//   tablets sync and warmed into the file cache, leaving CPU and cache bandwidth to queries.
+// - "compaction": a dedicated compaction worker, its outputs are not kept in the local file cache
+//   since no query reads them from this node.
+DECLARE_mString(cloud_compaction_role);
+
+static inline bool is_cloud_query_only_node() {
+    return is_cloud_mode() && cloud_compaction_role == "query";
+}
+
+static inline bool is_cloud_compaction_worker() {
+    return is_cloud_mode() && cloud_compaction_role == "compaction";
+}
 
 // CloudStorageEngine config
 DECLARE_mInt32(refresh_s3_info_interval_s);
@@ -115,5 +130,13 @@ DECLARE_mInt32(delete_bitmap_rpc_retry_times);
 
 DECLARE_mInt64(meta_service_rpc_reconnect_interval_ms);
 
+// The max number of tablets a scan operator loads and syncs rowsets for at the same time
+DECLARE_mInt32(scan_sync_tablets_concurrency);
+
+// Interval to keep the file cache blocks of the hottest tablets in the TTL queue, zero to disable
+DECLARE_mInt64(file_cache_hotspot_promote_interval_seconds);
+// The number of hottest tablets whose file cache blocks are promoted
+DECLARE_mInt32(file_cache_hotspot_promote_top_n_tablets);
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
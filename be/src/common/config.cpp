@@ -120,6 +120,8 @@ DEFINE_Double(soft_mem_limit_frac, "0.9");
 // Cache capacity reduce mem limit as a fraction of soft mem limit.
 DEFINE_mDouble(cache_capacity_reduce_mem_limit_frac, "0.6");
 
+DEFINE_mDouble(cache_capacity_adjust_max_step, "0.1");
+
 // Schema change memory limit as a fraction of soft memory limit.
 DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 
@@ -137,6 +139,13 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+DEFINE_mBool(enable_huge_page_for_large_allocation, "false");
+DEFINE_mInt64(huge_page_allocation_threshold, "67108864");
+
+DEFINE_mInt64(arena_chunk_pool_max_bytes, "268435456");
+DEFINE_mInt64(column_buffer_pool_max_bytes, "536870912");
+DEFINE_mInt64(column_buffer_thread_cache_bytes, "2097152");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -154,6 +163,11 @@ DEFINE_Int64(max_sys_mem_available_low_water_mark_bytes, "-1");
 
 DEFINE_Int64(memtable_limiter_reserved_memory_bytes, "838860800");
 
+DEFINE_mInt32(memtable_limiter_cold_memtable_idle_ms, "3000");
+
+DEFINE_mInt32(load_flush_queue_backpressure_tasks_per_thread, "0");
+DEFINE_mInt32(load_flush_queue_backpressure_max_delay_ms, "200");
+
 // The size of the memory that gc wants to release each time, as a percentage of the mem limit.
 DEFINE_mString(process_minor_gc_size, "5%");
 DEFINE_mString(process_full_gc_size, "10%");
@@ -184,6 +198,8 @@ DEFINE_mBool(crash_in_memory_tracker_inaccurate, "false");
 // use the tracker saved in Allocator.
 DEFINE_mBool(enable_memory_orphan_check, "true");
 
+DEFINE_mBool(enable_operator_memory_attribution, "true");
+
 // The maximum time a thread waits for full GC. Currently only query will wait for full gc.
 DEFINE_mInt32(thread_wait_gc_max_milliseconds, "1000");
 
@@ -245,6 +261,7 @@ DEFINE_mInt32(report_task_interval_seconds, "10");
 DEFINE_mInt32(report_disk_state_interval_seconds, "60");
 // the interval time(seconds) for agent report olap table to FE
 DEFINE_mInt32(report_tablet_interval_seconds, "60");
+DEFINE_mInt32(report_tablet_max_skip_times, "4");
 // the max download speed(KB/s)
 DEFINE_mInt32(max_download_speed_kbps, "50000");
 // download low speed limit(KB/s)
@@ -253,6 +270,8 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+// the max number of file batches downloaded concurrently by a clone task
+DEFINE_mInt32(clone_download_batch_parallelism, "4");
 
 DEFINE_String(sys_log_dir, "");
 DEFINE_String(user_function_dir, "${DORIS_HOME}/lib/udf");
@@ -300,6 +319,7 @@ DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
 // default thrift client connect timeout(in seconds)
 DEFINE_mInt32(thrift_connect_timeout_seconds, "3");
 DEFINE_mInt32(fetch_rpc_timeout_seconds, "30");
+DEFINE_mBool(enable_batch_fetch_rowids_by_segment, "true");
 
 // default thrift client retry interval (in milliseconds)
 DEFINE_mInt64(thrift_client_retry_interval_ms, "1000");
@@ -314,12 +334,20 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mBool(enable_scan_task_priority_scheduling, "true");
+DEFINE_mInt32(scan_task_priority_max_wait_ms, "5000");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_mDouble(exchange_max_compression_ratio, "0.9");
+DEFINE_mInt32(exchange_compression_probe_interval, "16");
+DEFINE_mInt64(exchange_coalesce_block_bytes, "0");
+DEFINE_mInt32(exchange_coalesce_max_wait_ms, "100");
+DEFINE_mInt32(exchange_max_response_delay_ms, "0");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_mInt32(schema_change_convert_rowsets_threads, "4");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
@@ -369,6 +397,8 @@ DEFINE_Int32(storage_page_cache_shard_size, "256");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
+DEFINE_Int32(compressed_data_page_cache_percentage, "0");
+DEFINE_mInt32(page_cache_concurrent_miss_wait_ms, "500");
 // whether to disable page cache feature in storage
 DEFINE_mBool(disable_storage_page_cache, "false");
 // whether to disable row cache feature in storage
@@ -397,12 +427,14 @@ DEFINE_mBool(disable_auto_compaction, "false");
 DEFINE_mBool(enable_vertical_compaction, "true");
 // whether enable ordered data compaction
 DEFINE_mBool(enable_ordered_data_compaction, "true");
+DEFINE_mBool(enable_vertical_compaction_disjoint_passthrough, "true");
 // In vertical compaction, column number for every group
 DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 // In vertical compaction, max memory usage for row_source_buffer
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+DEFINE_mInt32(vertical_compaction_prefetch_blocks, "2");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -419,6 +451,8 @@ DEFINE_Bool(enable_base_compaction_idle_sched, "true");
 DEFINE_mInt64(base_compaction_min_rowset_num, "5");
 DEFINE_mInt64(base_compaction_max_compaction_score, "20");
 DEFINE_mDouble(base_compaction_min_data_ratio, "0.3");
+DEFINE_mDouble(base_compaction_min_mow_delete_ratio, "0.5");
+DEFINE_mBool(enable_mow_compaction_skip_deleted_rows, "true");
 DEFINE_mInt64(base_compaction_dup_key_max_file_size_mbytes, "1024");
 
 DEFINE_Bool(enable_skip_tablet_compaction, "true");
@@ -447,6 +481,9 @@ DEFINE_mInt64(compaction_promotion_version_count, "1000");
 // this size, size_based policy may not do to cumulative compaction. The unit is m byte.
 DEFINE_mInt64(compaction_min_size_mbytes, "64");
 
+DEFINE_mInt64(compaction_leveled_base_size_mbytes, "8");
+DEFINE_mInt64(compaction_leveled_size_ratio, "8");
+
 // cumulative compaction policy: min and max delta file's number
 DEFINE_mInt64(cumulative_compaction_min_deltas, "5");
 DEFINE_mInt64(cumulative_compaction_max_deltas, "1000");
@@ -458,6 +495,9 @@ DEFINE_mInt32(multi_get_max_threads, "10");
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DEFINE_mInt64(total_permits_for_compaction_score, "1000000");
 
+DEFINE_mInt64(compaction_io_limit_mbytes_per_sec, "0");
+DEFINE_mInt32(compaction_io_limit_idle_query_num, "0");
+
 // sleep interval in ms after generated compaction tasks
 DEFINE_mInt32(generate_compaction_tasks_interval_ms, "100");
 
@@ -530,6 +570,7 @@ DEFINE_String(ssl_private_key_path, "");
 DEFINE_Bool(enable_all_http_auth, "false");
 // Number of webserver workers
 DEFINE_Int32(webserver_num_workers, "128");
+DEFINE_Bool(enable_webserver_reuse_port, "false");
 
 DEFINE_Bool(enable_single_replica_load, "true");
 // Number of download workers for single replica load
@@ -554,6 +595,10 @@ DEFINE_Int32(brpc_arrow_flight_work_pool_max_queue_size, "-1");
 //https://brpc.apache.org/docs/server/basics/#disable-built-in-services-completely
 DEFINE_Bool(enable_brpc_builtin_services, "true");
 
+// brpc falls back to TCP for a peer which does not support RDMA
+DEFINE_Bool(enable_brpc_rdma, "false");
+DEFINE_mInt32(brpc_data_connection_num, "1");
+
 // Enable brpc connection check
 DEFINE_Bool(enable_brpc_connection_check, "false");
 
@@ -809,6 +854,7 @@ DEFINE_Int32(aws_log_level, "0");
 
 // the buffer size when read data from remote storage like s3
 DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
+DEFINE_mInt32(remote_storage_read_buffer_max_mb, "64");
 
 // The minimum length when TCMalloc Hook consumes/releases MemTracker, consume size
 // smaller than this value will continue to accumulate. specified as number of bytes.
@@ -970,6 +1016,7 @@ DEFINE_mInt64(nodechannel_pending_queue_max_bytes, "67108864");
 
 // The batch size for sending data by brpc streaming client
 DEFINE_mInt64(brpc_streaming_client_batch_bytes, "262144");
+DEFINE_mInt64(stream_sink_file_writer_buffer_bytes, "65536");
 
 // Max waiting time to wait the "plan fragment start" rpc.
 // If timeout, the fragment will be cancelled.
@@ -993,6 +1040,9 @@ DEFINE_Bool(enable_segcompaction, "true");
 // Max number of segments allowed in a single segcompaction task.
 DEFINE_mInt32(segcompaction_batch_size, "10");
 
+// Upper bound of the adaptive segcompaction batch size.
+DEFINE_mInt32(segcompaction_max_batch_size, "40");
+
 // Max row count allowed in a single source segment, bigger segments will be skipped.
 DEFINE_Int32(segcompaction_candidate_max_rows, "1048576");
 
@@ -1017,6 +1067,9 @@ DEFINE_Bool(enable_fuzzy_mode, "false");
 DEFINE_Bool(enable_debug_points, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+DEFINE_Bool(enable_cpu_sampling, "false");
+DEFINE_Int32(cpu_sampling_frequency, "19");
+DEFINE_mInt64(cpu_sampling_retention_seconds, "3600");
 DEFINE_Bool(enable_workload_group_for_scan, "false");
 DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 
@@ -1045,6 +1098,7 @@ DEFINE_String(file_cache_path, "[{\"path\":\"${DORIS_HOME}/file_cache\"}]");
 DEFINE_Int64(file_cache_each_block_size, "1048576"); // 1MB
 
 DEFINE_Bool(clear_file_cache, "false");
+DEFINE_Int32(file_cache_shards_per_path, "1");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
 DEFINE_mInt32(file_cache_enter_disk_resource_limit_mode_percent, "88");
 DEFINE_mInt32(file_cache_exit_disk_resource_limit_mode_percent, "80");
@@ -1094,6 +1148,14 @@ DEFINE_Int32(num_broadcast_buffer, "32");
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
 
+DEFINE_mBool(enable_fused_expr_evaluation, "false");
+DEFINE_mInt32(fused_expr_program_cache_capacity, "4096");
+DEFINE_mBool(enable_common_subexpr_elimination, "true");
+DEFINE_mBool(enable_adaptive_conjunct_order, "true");
+DEFINE_mDouble(conjunct_compaction_selectivity, "0.1");
+DEFINE_mBool(enable_multi_pattern_like, "true");
+DEFINE_mInt32(multi_pattern_like_min_patterns, "2");
+
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
 
@@ -1103,6 +1165,9 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt32(s3_write_buffer_grow_parts, "16");
+DEFINE_mInt64(s3_write_buffer_max_size, "67108864");
+DEFINE_mInt32(s3_file_writer_max_inflight_parts, "4");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1127,13 +1192,22 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "1000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "3600");
+DEFINE_String(hdfs_client_short_circuit_domain_socket_path, "");
+DEFINE_Int32(hdfs_client_hedged_read_thread_num, "0");
+DEFINE_Int32(hdfs_client_hedged_read_threshold_ms, "500");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+DEFINE_String(persistent_meta_cache_path, "");
+DEFINE_Int64(persistent_meta_cache_capacity, "1073741824");
+DEFINE_mInt64(file_scan_range_split_bytes, "268435456");
+DEFINE_mBool(enable_native_hudi_base_file_reader, "true");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
 
 // max_write_buffer_number for rocksdb
 DEFINE_Int32(rocksdb_max_write_buffer_number, "5");
+DEFINE_Int32(rocksdb_meta_block_cache_size_mb, "0");
+DEFINE_Bool(rocksdb_enable_pipelined_write, "true");
 
 DEFINE_mBool(allow_zero_date, "false");
 DEFINE_Bool(allow_invalid_decimalv2_literal, "false");
@@ -1157,6 +1231,8 @@ DEFINE_mInt64(lookup_connection_cache_capacity, "2048");
 
 // level of compression when using LZ4_HC, whose defalut value is LZ4HC_CLEVEL_DEFAULT
 DEFINE_mInt64(LZ4_HC_compression_level, "9");
+// level of compression when using ZSTD, whose defalut value is ZSTD_CLEVEL_DEFAULT
+DEFINE_mInt32(ZSTD_compression_level, "3");
 
 DEFINE_mBool(enable_merge_on_write_correctness_check, "true");
 // USED FOR DEBUGING
@@ -1192,6 +1268,7 @@ DEFINE_Int32(group_commit_replay_wal_retry_num, "10");
 DEFINE_Int32(group_commit_replay_wal_retry_interval_seconds, "5");
 DEFINE_Int32(group_commit_replay_wal_retry_interval_max_seconds, "1800");
 DEFINE_Int32(group_commit_relay_wal_threads, "10");
+DEFINE_mInt32(group_commit_replay_wal_parallelism_per_table, "2");
 // This config can be set to limit thread number in group commit request fragment thread pool.
 DEFINE_Int32(group_commit_insert_threads, "10");
 DEFINE_Int32(group_commit_memory_rows_for_max_filter_ratio, "10000");
@@ -1202,6 +1279,7 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mInt32(group_commit_idle_commit_ms, "0");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1213,6 +1291,7 @@ DEFINE_Bool(enable_flush_file_cache_async, "true");
 
 // cgroup
 DEFINE_String(doris_cgroup_cpu_path, "");
+DEFINE_mString(workload_group_dedicated_cores, "");
 
 DEFINE_mBool(enable_be_proc_monitor, "false");
 DEFINE_mInt32(be_proc_monitor_interval_ms, "10000");
@@ -1270,12 +1349,27 @@ DEFINE_Validator(spill_io_thread_pool_thread_num, [](const int config) -> bool {
     return true;
 });
 DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
+DEFINE_mString(spill_compression_type, "lz4");
+DEFINE_mInt64(spill_read_ahead_bytes, "4194304");
+DEFINE_mBool(enable_spill_to_remote_storage, "false");
+DEFINE_mInt64(spill_remote_storage_limit, "1099511627776");
+DEFINE_mInt64(spill_hash_join_partition_max_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_max_repartition_depth, "3");
 
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+DEFINE_mBool(enable_s3_hedged_read, "false");
+DEFINE_mDouble(s3_hedged_read_latency_percentile, "0.95");
+DEFINE_mInt32(s3_hedged_read_min_delay_ms, "20");
+DEFINE_mInt32(s3_hedged_read_budget_percent, "5");
+DEFINE_mInt64(s3_hedged_read_max_bytes, "8388608");
+DEFINE_Int64(num_s3_hedged_read_thread_pool_min_thread, "16");
+DEFINE_Int64(num_s3_hedged_read_thread_pool_max_thread, "512");
+DEFINE_mInt64(s3_compaction_read_bytes_per_second, "0");
+DEFINE_mInt64(s3_warm_up_read_bytes_per_second, "0");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
 DEFINE_mInt64(s3_get_bucket_tokens, "1000000000000000000");
@@ -1324,6 +1418,7 @@ DEFINE_Validator(s3_client_http_scheme, [](const std::string& config) -> bool {
 });
 
 DEFINE_mBool(ignore_schema_change_check, "false");
+DEFINE_mBool(enable_schema_change_widen_column_on_read, "false");
 
 DEFINE_mInt64(string_overflow_size, "4294967295"); // std::numic_limits<uint32_t>::max()
 
@@ -1331,6 +1426,14 @@ DEFINE_mInt64(string_overflow_size, "4294967295"); // std::numic_limits<uint32_t
 DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_min_thread, "16");
 // The max thread num for BufferedReaderPrefetchThreadPool
 DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread, "64");
+// The min thread num for SegmentPageReadAheadThreadPool
+DEFINE_Int64(num_segment_page_read_ahead_thread_pool_min_thread, "8");
+// The max thread num for SegmentPageReadAheadThreadPool
+DEFINE_Int64(num_segment_page_read_ahead_thread_pool_max_thread, "32");
+// The min thread num for SegmentWriterThreadPool
+DEFINE_Int64(num_segment_writer_thread_pool_min_thread, "8");
+// The max thread num for SegmentWriterThreadPool
+DEFINE_Int64(num_segment_writer_thread_pool_max_thread, "32");
 // The min thread num for S3FileUploadThreadPool
 DEFINE_Int64(num_s3_file_upload_thread_pool_min_thread, "16");
 // The max thread num for S3FileUploadThreadPool
@@ -1358,6 +1461,7 @@ DEFINE_Int64(s3_file_system_local_upload_buffer_size, "5242880");
 DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
+DEFINE_Int32(load_tablet_meta_threads_per_data_dir, "4");
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
@@ -1406,6 +1510,65 @@ DEFINE_Bool(force_regenerate_rowsetid_on_start_error, "false");
 DEFINE_mBool(enable_sleep_between_delete_cumu_compaction, "false");
 
 DEFINE_mInt32(compaction_num_per_round, "1");
+DEFINE_mDouble(compaction_read_heat_weight, "0");
+DEFINE_mInt32(compaction_read_heat_half_life_sec, "3600");
+
+DEFINE_Bool(enable_pipeline_task_numa_aware, "false");
+DEFINE_mInt32(pipeline_task_numa_remote_steal_idle_ms, "10");
+
+DEFINE_Bool(enable_pipeline_lock_free_task_queue, "false");
+
+DEFINE_mInt32(pipeline_sink_yield_slice_rows, "65536");
+
+DEFINE_mBool(enable_local_exchange_skew_adaptive, "false");
+DEFINE_mInt32(local_exchange_skew_sample_blocks, "16");
+DEFINE_mDouble(local_exchange_skew_ratio_threshold, "4");
+
+DEFINE_mBool(enable_hash_join_hot_key_split, "false");
+DEFINE_mInt32(hash_join_hot_key_sample_blocks, "16");
+DEFINE_mDouble(hash_join_hot_key_ratio_threshold, "1");
+
+DEFINE_mBool(enable_hash_join_radix_build, "false");
+DEFINE_mInt64(hash_join_radix_build_min_rows, "4194304");
+
+DEFINE_mBool(enable_analytic_streaming_evaluation, "false");
+
+DEFINE_mBool(enable_streaming_agg_cardinality_estimate, "false");
+DEFINE_mInt64(streaming_agg_cardinality_estimate_interval_rows, "65536");
+DEFINE_mDouble(streaming_agg_partial_pass_through_min_reduction, "1.05");
+
+DEFINE_mBool(enable_agg_columnar_state, "false");
+
+DEFINE_mBool(enable_agg_sorted_key_runs, "true");
+
+DEFINE_mInt32(segment_page_read_ahead_num, "0");
+
+DEFINE_mBool(enable_vertical_segment_writer_parallel_encode, "false");
+
+DEFINE_mBool(enable_memtable_radix_sort, "true");
+
+DEFINE_mBool(enable_memtable_hash_group_by_key, "true");
+
+DEFINE_mBool(enable_memtable_sorted_input_detection, "true");
+
+DEFINE_String(lru_cache_tinylfu_admission_cache_names, "");
+
+DEFINE_mBool(enable_local_file_io_uring, "false");
+DEFINE_mInt64(local_file_io_uring_chunk_size, "262144");
+DEFINE_Int32(local_file_io_uring_queue_depth, "32");
+
+DEFINE_Int64(file_cache_hot_tier_size, "0");
+DEFINE_mInt32(file_cache_hot_tier_promote_hits, "2");
+DEFINE_mBool(file_cache_hot_tier_index_only, "true");
+
+DEFINE_mInt64(file_cache_remote_read_coalesce_max_gap, "1048576");
+
+DEFINE_mBool(enable_sort_by_normalized_key, "true");
+
+DEFINE_mBool(enable_variant_subcolumn_bloom_filter, "false");
+
+DEFINE_mString(file_cache_peer_backends, "");
+DEFINE_mInt32(file_cache_peer_fetch_timeout_ms, "1000");
 
 // clang-format off
 #ifdef BE_TEST
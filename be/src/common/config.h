@@ -155,6 +155,10 @@ DECLARE_Double(soft_mem_limit_frac);
 // Cache capacity reduce mem limit as a fraction of soft mem limit.
 DECLARE_mDouble(cache_capacity_reduce_mem_limit_frac);
 
+// Max change of a cache's capacity weight in one capacity refresh, so that caches
+// shrink and grow gradually instead of dropping at once. <= 0 disables smoothing.
+DECLARE_mDouble(cache_capacity_adjust_max_step);
+
 // Schema change memory limit as a fraction of soft memory limit.
 DECLARE_Double(schema_change_mem_limit_frac);
 
@@ -172,6 +176,18 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Back allocations of at least huge_page_allocation_threshold bytes, e.g. large hash tables,
+// with transparent huge pages via madvise(MADV_HUGEPAGE) to reduce TLB misses.
+DECLARE_mBool(enable_huge_page_for_large_allocation);
+DECLARE_mInt64(huge_page_allocation_threshold);
+
+// Max bytes of freed arena chunks cached for reuse by other arenas, 0 to disable the cache.
+DECLARE_mInt64(arena_chunk_pool_max_bytes);
+// Max bytes of freed column buffers cached for reuse by all queries, 0 to disable the pool,
+// and the bytes cached by each thread before buffers go to the shared pool.
+DECLARE_mInt64(column_buffer_pool_max_bytes);
+DECLARE_mInt64(column_buffer_thread_cache_bytes);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -191,6 +207,18 @@ DECLARE_Int64(max_sys_mem_available_low_water_mark_bytes);
 // reserve a small amount of memory so we do not trigger MinorGC
 DECLARE_Int64(memtable_limiter_reserved_memory_bytes);
 
+// When the memtable memory limiter has to flush, memtables that received no write for this
+// many milliseconds are flushed before the larger but still growing ones, so that hot tablets
+// keep filling their memtables. 0 means always flush the largest memtables first.
+DECLARE_mInt32(memtable_limiter_cold_memtable_idle_ms);
+
+// When the flush pool has more than this many queued memtables per flush thread, add block
+// requests of normal priority loads are delayed before being applied, so that senders slow
+// down before the memory limit is reached. 0 means disabled.
+DECLARE_mInt32(load_flush_queue_backpressure_tasks_per_thread);
+// The max delay of one add block request caused by flush queue backpressure.
+DECLARE_mInt32(load_flush_queue_backpressure_max_delay_ms);
+
 // The size of the memory that gc wants to release each time, as a percentage of the mem limit.
 DECLARE_mString(process_minor_gc_size);
 DECLARE_mString(process_full_gc_size);
@@ -231,6 +259,10 @@ DECLARE_mBool(crash_in_memory_tracker_inaccurate);
 // use the tracker saved in Allocator.
 DECLARE_mBool(enable_memory_orphan_check);
 
+// If true, the memory allocated by a pipeline task thread is attributed to the running operator,
+// shown as Attributed* counters in the operator profile and by /api/query_memory.
+DECLARE_mBool(enable_operator_memory_attribution);
+
 // The maximum time a thread waits for a full GC. Currently only query will wait for full gc.
 DECLARE_mInt32(thread_wait_gc_max_milliseconds);
 
@@ -292,6 +324,9 @@ DECLARE_mInt32(report_task_interval_seconds);
 DECLARE_mInt32(report_disk_state_interval_seconds);
 // the interval time(seconds) for agent report olap table to FE
 DECLARE_mInt32(report_tablet_interval_seconds);
+// the max times to skip the tablet report in a row when tablets are not changed since the
+// last successful report, 0 means always report
+DECLARE_mInt32(report_tablet_max_skip_times);
 // the max download speed(KB/s)
 DECLARE_mInt32(max_download_speed_kbps);
 // download low speed limit(KB/s)
@@ -300,6 +335,8 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// the max number of file batches downloaded concurrently by a clone task
+DECLARE_mInt32(clone_download_batch_parallelism);
 
 // deprecated, use env var LOG_DIR in be.conf
 DECLARE_String(sys_log_dir);
@@ -345,6 +382,9 @@ DECLARE_Int32(doris_scanner_thread_pool_queue_size);
 // default thrift client connect timeout(in seconds)
 DECLARE_mInt32(thrift_connect_timeout_seconds);
 DECLARE_mInt32(fetch_rpc_timeout_seconds);
+// Whether column store rows of a multiget request are grouped by segment and read in row id
+// order, so that every data page of a fetched column is read and decoded at most once.
+DECLARE_mBool(enable_batch_fetch_rowids_by_segment);
 // default thrift client retry interval (in milliseconds)
 DECLARE_mInt64(thrift_client_retry_interval_ms);
 // max message size of thrift request
@@ -358,12 +398,37 @@ DECLARE_mInt32(doris_scanner_row_num);
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Whether the scan thread pools run the scan tasks of the scans which have run shorter first,
+// and the ones of the queries closer to their deadline among the scans of the same level,
+// instead of FIFO.
+DECLARE_mBool(enable_scan_task_priority_scheduling);
+// A scan task waiting longer than this in a priority scheduled scan thread pool runs first,
+// regardless of its priority.
+DECLARE_mInt32(scan_task_priority_max_wait_ms);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// An exchange sender stops compressing blocks whose compressed size is larger than this ratio of
+// the serialized size, and compresses one block again every
+// exchange_compression_probe_interval blocks to notice when the data turns compressible.
+// Set the interval to 0 to always compress.
+DECLARE_mDouble(exchange_max_compression_ratio);
+DECLARE_mInt32(exchange_compression_probe_interval);
+// When > 0, a remote exchange channel keeps merging rows after it reached batch_size until the
+// pending block has this many bytes or its first row waited exchange_coalesce_max_wait_ms,
+// so that many small hash partitions become fewer and larger transmit_block calls.
+DECLARE_mInt64(exchange_coalesce_block_bytes);
+DECLARE_mInt32(exchange_coalesce_max_wait_ms);
+// A receiver whose queue is full delays the transmit_block response until its queue drains.
+// A delayed response is sent anyway after this many ms, so that the sender does not time out,
+// 0 means no limit.
+DECLARE_mInt32(exchange_max_response_delay_ms);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// Num threads to convert the rowsets of one tablet in schema change, the threads share
+// memory_limitation_per_thread_for_schema_change_bytes
+DECLARE_mInt32(schema_change_convert_rowsets_threads);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
@@ -415,6 +480,13 @@ DECLARE_Int32(storage_page_cache_shard_size);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
+// Percentage of the data page cache that holds compressed data pages, the rest holds
+// decompressed ones. 0 disables the compressed tier.
+DECLARE_Int32(compressed_data_page_cache_percentage);
+// When concurrent scans miss the page cache on the same page, only the first one reads and
+// decompresses it, the others wait up to this many milliseconds for it to be cached instead of
+// loading the same page again. 0 means disabled.
+DECLARE_mInt32(page_cache_concurrent_miss_wait_ms);
 // whether to disable page cache feature in storage
 // TODO delete it. Divided into Data page, Index page, pk index page
 DECLARE_Bool(disable_storage_page_cache);
@@ -447,12 +519,18 @@ DECLARE_mBool(disable_auto_compaction);
 DECLARE_mBool(enable_vertical_compaction);
 // whether enable ordered data compaction
 DECLARE_mBool(enable_ordered_data_compaction);
+// In vertical compaction of duplicate key tables, read the key group in input order instead of
+// merging through a heap when input rowsets are non-overlapping and ascending disjoint
+DECLARE_mBool(enable_vertical_compaction_disjoint_passthrough);
 // In vertical compaction, column number for every group
 DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 // In vertical compaction, max memory usage for row_source_buffer
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, number of blocks a column group is merged ahead of the writer on a
+// separate thread. 0 means merge and write on the compaction thread.
+DECLARE_mInt32(vertical_compaction_prefetch_blocks);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -469,6 +547,12 @@ DECLARE_Bool(enable_base_compaction_idle_sched);
 DECLARE_mInt64(base_compaction_min_rowset_num);
 DECLARE_mInt64(base_compaction_max_compaction_score);
 DECLARE_mDouble(base_compaction_min_data_ratio);
+// For merge-on-write tables, base compaction is also due once this ratio of the input rows is
+// deleted by the delete bitmap. 0 disables the check.
+DECLARE_mDouble(base_compaction_min_mow_delete_ratio);
+// For merge-on-write tables, skip the rows deleted by the delete bitmap when compaction reads
+// input rowsets instead of rewriting them into the output.
+DECLARE_mBool(enable_mow_compaction_skip_deleted_rows);
 DECLARE_mInt64(base_compaction_dup_key_max_file_size_mbytes);
 
 DECLARE_Bool(enable_skip_tablet_compaction);
@@ -496,6 +580,12 @@ DECLARE_mInt64(compaction_promotion_version_count);
 // this size, size_based policy may not do to cumulative compaction. The unit is m byte.
 DECLARE_mInt64(compaction_min_size_mbytes);
 
+// Leveled cumulative compaction policy: disk size of level 0 rowsets, the unit is m byte, and the
+// size ratio between two levels. A run of rowsets on one level is compacted into the next level
+// once its compaction score reaches the ratio.
+DECLARE_mInt64(compaction_leveled_base_size_mbytes);
+DECLARE_mInt64(compaction_leveled_size_ratio);
+
 // cumulative compaction policy: min and max delta file's number
 DECLARE_mInt64(cumulative_compaction_min_deltas);
 DECLARE_mInt64(cumulative_compaction_max_deltas);
@@ -507,6 +597,12 @@ DECLARE_mInt32(multi_get_max_threads);
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DECLARE_mInt64(total_permits_for_compaction_score);
 
+// Max bytes per second read and written by compaction on each data dir, 0 means no limit.
+DECLARE_mInt64(compaction_io_limit_mbytes_per_sec);
+// Compaction I/O is not throttled while the number of running queries is not greater than
+// this value, so compaction runs at full speed when the BE is idle. -1 means always throttle.
+DECLARE_mInt32(compaction_io_limit_idle_query_num);
+
 // sleep interval in ms after generated compaction tasks
 DECLARE_mInt32(generate_compaction_tasks_interval_ms);
 // sleep interval in second after update replica infos
@@ -572,6 +668,9 @@ DECLARE_String(ssl_private_key_path);
 DECLARE_Bool(enable_all_http_auth);
 // Number of webserver workers
 DECLARE_Int32(webserver_num_workers);
+// Whether every webserver worker listens on its own SO_REUSEPORT socket, so the kernel spreads
+// new connections over the workers instead of all of them waking up on one shared socket.
+DECLARE_Bool(enable_webserver_reuse_port);
 
 DECLARE_Bool(enable_single_replica_load);
 // Number of download workers for single replica load
@@ -852,6 +951,8 @@ DECLARE_Int32(aws_log_level);
 
 // the buffer size when read data from remote storage like s3
 DECLARE_mInt32(remote_storage_read_buffer_mb);
+// the max size the prefetch window of a sequential remote reader can grow to
+DECLARE_mInt32(remote_storage_read_buffer_max_mb);
 
 // The minimum length when TCMalloc Hook consumes/releases MemTracker, consume size
 // smaller than this value will continue to accumulate. specified as number of bytes.
@@ -1012,10 +1113,20 @@ DECLARE_mInt64(nodechannel_pending_queue_max_bytes);
 
 // The batch size for sending data by brpc streaming client
 DECLARE_mInt64(brpc_streaming_client_batch_bytes);
+// Appends to a memtable-on-sink segment smaller than this are buffered and sent
+// in one frame, so tiny tablets do not flood the load stream. 0 disables buffering.
+DECLARE_mInt64(stream_sink_file_writer_buffer_bytes);
 DECLARE_mInt64(block_cache_wait_timeout_ms);
 
 DECLARE_Bool(enable_brpc_builtin_services);
 
+// Use RDMA for the baidu_std brpc connections between backends, e.g. exchange.
+// Only works when be is built with BUILD_BRPC_RDMA=ON.
+DECLARE_Bool(enable_brpc_rdma);
+// Number of brpc connections per backend used by bulk data rpcs (exchange, load),
+// separate from the connection of control rpcs. <= 1 shares the single connection.
+DECLARE_mInt32(brpc_data_connection_num);
+
 DECLARE_Bool(enable_brpc_connection_check);
 
 DECLARE_mInt64(brpc_connection_check_timeout_ms);
@@ -1042,6 +1153,11 @@ DECLARE_Bool(enable_segcompaction);
 // Max number of segments allowed in a single segcompaction task.
 DECLARE_mInt32(segcompaction_batch_size);
 
+// Upper bound of the adaptive segcompaction batch size. When segments are flushed faster
+// than segcompaction consumes them, a task takes up to this many segments at once so the
+// backlog is drained instead of leaving many small segments behind.
+DECLARE_mInt32(segcompaction_max_batch_size);
+
 // Max row count allowed in a single source segment, bigger segments will be skipped.
 DECLARE_Int32(segcompaction_candidate_max_rows);
 
@@ -1066,6 +1182,13 @@ DECLARE_Bool(enable_fuzzy_mode);
 DECLARE_Bool(enable_debug_points);
 
 DECLARE_Int32(pipeline_executor_size);
+// If true, every pipeline executor thread is sampled on its own CPU clock, and the samples are
+// attributed to the running query and operator, see /api/query_cpu_samples.
+DECLARE_Bool(enable_cpu_sampling);
+// Samples per second of CPU time of each pipeline executor thread.
+DECLARE_Int32(cpu_sampling_frequency);
+// How long the aggregated CPU samples are kept.
+DECLARE_mInt64(cpu_sampling_retention_seconds);
 
 // block file cache
 DECLARE_Bool(enable_file_cache);
@@ -1085,6 +1208,11 @@ DECLARE_Bool(enable_file_cache);
 DECLARE_String(file_cache_path);
 DECLARE_Int64(file_cache_each_block_size);
 DECLARE_Bool(clear_file_cache);
+// Number of independent BlockFileCache shards every file cache path is split into, each shard
+// has its own lock and queues and 1/N of the path's capacity, keys are distributed by hash.
+// Shards are kept in "shard_<i>" sub directories when it is larger than 1, changing it leaves
+// the cached data of the previous layout unused, clear the cache directory when changing it.
+DECLARE_Int32(file_cache_shards_per_path);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
 DECLARE_Int32(file_cache_exit_disk_resource_limit_mode_percent);
@@ -1141,6 +1269,24 @@ DECLARE_Int32(num_broadcast_buffer);
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
 
+// Evaluate fixed-width arithmetic and comparison expression trees as one fused program
+// instead of materializing a column for every node.
+DECLARE_mBool(enable_fused_expr_evaluation);
+// Max number of expression fingerprints kept in the fused program cache.
+DECLARE_mInt32(fused_expr_program_cache_capacity);
+// Evaluate equal function call subtrees of an operator's conjuncts or projections once per
+// block and reuse the result column. Takes effect for operators opened after the change.
+DECLARE_mBool(enable_common_subexpr_elimination);
+// Order conjuncts by their observed cost per row and selectivity instead of the plan order.
+DECLARE_mBool(enable_adaptive_conjunct_order);
+// When the fraction of rows still selected after a conjunct drops to this value, the remaining
+// conjuncts are evaluated on a block compacted to the selected rows. 0 disables compaction.
+DECLARE_mDouble(conjunct_compaction_selectivity);
+// Match OR-ed LIKE / REGEXP predicates over the same input with one hyperscan database when
+// there are at least multi_pattern_like_min_patterns of them.
+DECLARE_mBool(enable_multi_pattern_like);
+DECLARE_mInt32(multi_pattern_like_min_patterns);
+
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
 
@@ -1150,6 +1296,13 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The part size of a multipart upload doubles every s3_write_buffer_grow_parts parts until
+// s3_write_buffer_max_size, 0 keeps every part s3_write_buffer_size
+DECLARE_mInt32(s3_write_buffer_grow_parts);
+DECLARE_mInt64(s3_write_buffer_max_size);
+// The max number of parts of one S3FileWriter being uploaded at the same time, the writer waits
+// in append when it is reached. 0 means no limit.
+DECLARE_mInt32(s3_file_writer_max_inflight_parts);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1176,14 +1329,42 @@ DECLARE_Bool(enable_set_in_bitmap_value);
 // max number of hdfs file handle in cache
 DECLARE_Int64(max_hdfs_file_handle_cache_num);
 DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
+// Default client settings of the hdfs reader, the hdfs properties of a catalog or table valued
+// function override them.
+// Path of the DataNode domain socket, when set the hdfs client reads the replicas on this host
+// directly from local disks(short-circuit local read).
+DECLARE_String(hdfs_client_short_circuit_domain_socket_path);
+// Number of threads used to send hedged reads to another DataNode when the read of an hdfs
+// block is slow, 0 means disabled.
+DECLARE_Int32(hdfs_client_hedged_read_thread_num);
+// Time to wait for the first DataNode before starting a hedged read of an hdfs block
+DECLARE_Int32(hdfs_client_hedged_read_threshold_ms);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// Directory of the on disk meta cache, which keeps segment footers and parquet footers of
+// remote files across restarts. Empty means disabled.
+DECLARE_String(persistent_meta_cache_path);
+// Capacity in bytes of the on disk meta cache
+DECLARE_Int64(persistent_meta_cache_capacity);
+// The parquet/orc scan ranges larger than twice of this size are split into byte ranges of at
+// least this size in BE, so that the row groups of a huge file are read by several scanners.
+// 0 means disabled.
+DECLARE_mInt64(file_scan_range_split_bytes);
+// Read the hudi splits which have no delta logs from their base files with the native
+// parquet/orc readers instead of the JNI scanner.
+DECLARE_mBool(enable_native_hudi_base_file_reader);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
 // max_write_buffer_number for rocksdb
 DECLARE_Int32(rocksdb_max_write_buffer_number);
+// Size of the block cache shared by the meta column families of all data dirs, 0 means every
+// meta db uses the default block cache of rocksdb.
+DECLARE_Int32(rocksdb_meta_block_cache_size_mb);
+// Whether to write the WAL and the memtables of meta dbs in a pipeline, which shortens the
+// write group commit of concurrent meta writes, for example of publishes.
+DECLARE_Bool(rocksdb_enable_pipelined_write);
 
 // Convert date 0000-00-00 to 0000-01-01. It's recommended to set to false.
 DECLARE_mBool(allow_zero_date);
@@ -1217,6 +1398,10 @@ DECLARE_mInt64(lookup_connection_cache_capacity);
 
 // level of compression when using LZ4_HC, whose defalut value is LZ4HC_CLEVEL_DEFAULT
 DECLARE_mInt64(LZ4_HC_compression_level);
+// level of compression when using ZSTD, whose defalut value is ZSTD_CLEVEL_DEFAULT.
+// Higher levels give smaller pages at a higher compression cost, decompression speed is
+// almost independent of the level. Out of range values are clamped to the supported range.
+DECLARE_mInt32(ZSTD_compression_level);
 // Threshold of a column as sparse column
 // Notice: TEST ONLY
 DECLARE_mDouble(variant_ratio_of_defaults_as_sparse_column);
@@ -1267,6 +1452,8 @@ DECLARE_Int32(group_commit_replay_wal_retry_num);
 DECLARE_Int32(group_commit_replay_wal_retry_interval_seconds);
 DECLARE_Int32(group_commit_replay_wal_retry_interval_max_seconds);
 DECLARE_mInt32(group_commit_relay_wal_threads);
+// Number of wals of one table replayed concurrently, each wal is replayed by its own load.
+DECLARE_mInt32(group_commit_replay_wal_parallelism_per_table);
 // This config can be set to limit thread number in group commit request fragment thread pool.
 DECLARE_mInt32(group_commit_insert_threads);
 DECLARE_mInt32(group_commit_memory_rows_for_max_filter_ratio);
@@ -1277,6 +1464,9 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Commit a group commit queue once no block is added to it for this many milliseconds,
+// instead of waiting for the whole group_commit_interval_ms. 0 means disabled.
+DECLARE_mInt32(group_commit_idle_commit_ms);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1293,6 +1483,9 @@ DECLARE_mBool(exit_on_exception);
 
 // cgroup
 DECLARE_String(doris_cgroup_cpu_path);
+// Cores only used by the given workload groups, e.g. "wg1:8,wg2:4", the other groups
+// share the rest cores. Needs cgroup v2 with cpuset controller.
+DECLARE_mString(workload_group_dedicated_cores);
 DECLARE_mBool(enable_be_proc_monitor);
 DECLARE_mInt32(be_proc_monitor_interval_ms);
 DECLARE_Int32(workload_group_metrics_interval_ms);
@@ -1350,6 +1543,19 @@ DECLARE_mInt32(spill_gc_interval_ms);
 DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
+// Compression codec of spilled blocks, one of "lz4", "zstd" and "none".
+DECLARE_mString(spill_compression_type);
+// Read consecutive spilled blocks in chunks of up to this many bytes.
+DECLARE_mInt64(spill_read_ahead_bytes);
+// In cloud mode, spill to the storage vault when no local spill storage is available.
+DECLARE_mBool(enable_spill_to_remote_storage);
+// Max bytes of spilled data kept in the remote storage by this backend.
+DECLARE_mInt64(spill_remote_storage_limit);
+// A spilled hash join partition whose build side exceeds this many spilled bytes is split again
+// with a different hash before it is loaded into memory.
+DECLARE_mInt64(spill_hash_join_partition_max_bytes);
+// Max times a spilled hash join partition may be split again.
+DECLARE_mInt32(spill_hash_join_max_repartition_depth);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1372,6 +1578,25 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// Send a second GET for the same range when the first one of a read has not returned after the
+// s3_hedged_read_latency_percentile latency of its bucket, and use whichever answers first.
+DECLARE_mBool(enable_s3_hedged_read);
+// The latency percentile of the recent GETs of a bucket after which a read is hedged
+DECLARE_mDouble(s3_hedged_read_latency_percentile);
+// The hedge delay is never shorter than it
+DECLARE_mInt32(s3_hedged_read_min_delay_ms);
+// At most this percent of the GETs are hedged GETs
+DECLARE_mInt32(s3_hedged_read_budget_percent);
+// Reads larger than it are never hedged, their latency is dominated by the transfer
+DECLARE_mInt64(s3_hedged_read_max_bytes);
+// The min thread num for S3HedgedReadThreadPool
+DECLARE_Int64(num_s3_hedged_read_thread_pool_min_thread);
+// The max thread num for S3HedgedReadThreadPool
+DECLARE_Int64(num_s3_hedged_read_thread_pool_max_thread);
+// Max bytes per second read from object storage by compactions and schema changes, and by the
+// file cache warm up, so that background reads cannot starve the queries. Zero for no limit.
+DECLARE_mInt64(s3_compaction_read_bytes_per_second);
+DECLARE_mInt64(s3_warm_up_read_bytes_per_second);
 
 // write as inverted index tmp directory
 DECLARE_String(tmp_file_dir);
@@ -1406,6 +1631,9 @@ DECLARE_mInt32(thrift_client_open_num_tries);
 DECLARE_String(s3_client_http_scheme);
 
 DECLARE_mBool(ignore_schema_change_check);
+// Link the segments instead of rewriting them in schema change if value columns are only
+// widened (e.g. INT -> BIGINT), the values are widened when the segments are read.
+DECLARE_mBool(enable_schema_change_widen_column_on_read);
 
 /** Only use in fuzzy test **/
 DECLARE_mInt64(string_overflow_size);
@@ -1414,6 +1642,14 @@ DECLARE_mInt64(string_overflow_size);
 DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_min_thread);
 // The max thread num for BufferedReaderPrefetchThreadPool
 DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread);
+// The min thread num for SegmentPageReadAheadThreadPool
+DECLARE_Int64(num_segment_page_read_ahead_thread_pool_min_thread);
+// The max thread num for SegmentPageReadAheadThreadPool
+DECLARE_Int64(num_segment_page_read_ahead_thread_pool_max_thread);
+// The min thread num for SegmentWriterThreadPool
+DECLARE_Int64(num_segment_writer_thread_pool_min_thread);
+// The max thread num for SegmentWriterThreadPool
+DECLARE_Int64(num_segment_writer_thread_pool_max_thread);
 // The min thread num for S3FileUploadThreadPool
 DECLARE_Int64(num_s3_file_upload_thread_pool_min_thread);
 // The max thread num for S3FileUploadThreadPool
@@ -1443,6 +1679,8 @@ DECLARE_Bool(enable_jvm_monitor);
 
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
+// Num threads to load tablet metas in one data dir, value <= 1 means loading them serially
+DECLARE_Int32(load_tablet_meta_threads_per_data_dir);
 
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
@@ -1493,6 +1731,142 @@ DECLARE_Bool(enable_table_size_correctness_check);
 DECLARE_mBool(enable_sleep_between_delete_cumu_compaction);
 
 DECLARE_mInt32(compaction_num_per_round);
+// When positive, tablets are ranked for compaction by
+// score * (1 + weight * log2(1 + read heat)) instead of by score alone. Read heat is the number of
+// segments queries opened on the tablet, decayed with compaction_read_heat_half_life_sec, so
+// tablets with high read amplification that are queried often are compacted first.
+DECLARE_mDouble(compaction_read_heat_weight);
+DECLARE_mInt32(compaction_read_heat_half_life_sec);
+
+// Whether the pipeline task scheduler is aware of NUMA topology. If enabled, workers are bound
+// to their NUMA node and steal tasks from the local node first.
+DECLARE_Bool(enable_pipeline_task_numa_aware);
+// An idle pipeline worker steals tasks from remote NUMA nodes only after it fails to get a task
+// from its local node for this long.
+DECLARE_mInt32(pipeline_task_numa_remote_steal_idle_ms);
+
+// Whether the pipeline task scheduler uses lock free per core run queues instead of the
+// mutex protected ones.
+DECLARE_Bool(enable_pipeline_lock_free_task_queue);
+
+// Sinks which support yielding (sort, aggregation) consume an input block larger than this
+// slice by slice, so that the pipeline task can yield in the middle of the block once its
+// time slice is used up.
+DECLARE_mInt32(pipeline_sink_yield_slice_rows);
+
+// Whether a hash shuffled local exchange before an operator which only prefers hash distribution
+// (e.g. non-finalized aggregation) switches to round-robin distribution when the data is skewed.
+DECLARE_mBool(enable_local_exchange_skew_adaptive);
+// Number of blocks sampled by the skew adaptive local exchanger before it decides the distribution.
+DECLARE_mInt32(local_exchange_skew_sample_blocks);
+// The skew adaptive local exchanger switches to round-robin distribution if the largest partition
+// has more rows than this ratio of the average in the sampled blocks.
+DECLARE_mDouble(local_exchange_skew_ratio_threshold);
+
+// Whether a shuffled hash join (inner / right outer / right semi / right anti) whose both sides
+// are hash shuffled by local exchange detects hot join keys on the build side, spreads the build
+// rows of them over all instances and sends the probe rows of them to all instances.
+DECLARE_mBool(enable_hash_join_hot_key_split);
+// Number of build side blocks sampled to find the hot join keys.
+DECLARE_mInt32(hash_join_hot_key_sample_blocks);
+// A join key is hot if it has more rows than this ratio of the average rows of a partition in the
+// sampled build side blocks.
+DECLARE_mDouble(hash_join_hot_key_ratio_threshold);
+
+// Whether the hash table of a hash join with many build rows sorts the rows by bucket (radix
+// partitioned), so that probing reads each chain sequentially instead of one cache miss per row.
+DECLARE_mBool(enable_hash_join_radix_build);
+// Minimum build rows of a hash join to use radix build, smaller hash tables fit in cache anyway.
+DECLARE_mInt64(hash_join_radix_build_min_rows);
+
+// Whether the analytic operator evaluates a window with a bounded ROWS frame end
+// (N PRECEDING / CURRENT ROW / N FOLLOWING) as soon as the frame of a row is received, instead
+// of buffering the whole partition first.
+DECLARE_mBool(enable_analytic_streaming_evaluation);
+
+// Whether the streaming aggregation estimates the cardinality of its keys with a HLL sketch
+// to choose among pre-aggregation, partial pass-through and full pass-through.
+DECLARE_mBool(enable_streaming_agg_cardinality_estimate);
+// Number of input rows between two decisions of the streaming aggregation mode.
+DECLARE_mInt64(streaming_agg_cardinality_estimate_interval_rows);
+// Below the reduction required by the hash table size but above this one, the streaming
+// aggregation keeps aggregating the keys already in the hash table and passes the others through.
+DECLARE_mDouble(streaming_agg_partial_pass_through_min_reduction);
+
+// Whether a hash aggregation whose states are all small and fixed width (sum/count/min/max of
+// numbers) stores the states of each aggregate function in their own dense column.
+DECLARE_mBool(enable_agg_columnar_state);
+
+// Whether the hash aggregation detects input blocks ordered by the group keys (e.g. scanned in
+// the sort key order of a duplicate key table), then only the first row of every run of equal
+// keys probes the hash table and the other rows reuse its aggregate states.
+DECLARE_mBool(enable_agg_sorted_key_runs);
+
+// Number of data pages of each projected column that SegmentIterator reads ahead of the
+// current page. The pages are read and decompressed on SegmentPageReadAheadThreadPool into the
+// storage page cache, only pages holding rows left after index filtering are read ahead.
+// 0 disables read ahead.
+DECLARE_mInt32(segment_page_read_ahead_num);
+
+// Whether VerticalSegmentWriter converts, encodes and builds the per column indexes of value
+// columns concurrently on SegmentWriterThreadPool when flushing a segment.
+DECLARE_mBool(enable_vertical_segment_writer_parallel_encode);
+
+// Whether MemTable sorts rows by the leading fixed width key columns (integers, boolean, datev2
+// and datetimev2, up to 8 bytes in total) with a radix sort on their normalized keys before
+// the per column comparator sort of the remaining key columns.
+DECLARE_mBool(enable_memtable_radix_sort);
+
+// Whether aggregate and unique key MemTable groups new rows by key with a hash table before
+// sorting, so that only one row of every distinct key is sorted.
+DECLARE_mBool(enable_memtable_hash_group_by_key);
+
+// Whether MemTable checks if new rows already arrive in strictly increasing key order, e.g. when
+// loading data sorted by an external job, and skips sorting and merging them in that case.
+DECLARE_mBool(enable_memtable_sorted_input_detection);
+
+// Comma separated cache names (see CachePolicy::type_string, e.g.
+// "DataPageCache,SegmentCache,InvertedIndexSearcherCache") that use TinyLFU admission: once
+// full, such a cache only admits a new entry if it was accessed more often recently than the
+// entry it would evict, so large one-off scans do not flush frequently hit entries.
+DECLARE_String(lru_cache_tinylfu_admission_cache_names);
+
+// Whether LocalFileReader splits reads larger than local_file_io_uring_chunk_size into chunks
+// submitted together to an io_uring of the reading thread, keeping several reads in flight.
+// Falls back to pread when io_uring is not available.
+DECLARE_mBool(enable_local_file_io_uring);
+DECLARE_mInt64(local_file_io_uring_chunk_size);
+// Number of entries of the io_uring created by every reading thread, it bounds the reads in
+// flight of one read request.
+DECLARE_Int32(local_file_io_uring_queue_depth);
+
+// Bytes of every file cache path kept in memory in front of the disk cache, blocks that are hit
+// file_cache_hot_tier_promote_hits times are copied into it and served without a disk read.
+// 0 means disabled.
+DECLARE_Int64(file_cache_hot_tier_size);
+// Number of disk hits of a block before it is promoted into the memory hot tier.
+DECLARE_mInt32(file_cache_hot_tier_promote_hits);
+// Only promote blocks of INDEX type (index pages, segment footers) into the memory hot tier.
+DECLARE_mBool(file_cache_hot_tier_index_only);
+
+// The missing file cache blocks of one read whose gap is not larger than it are fetched from the
+// remote storage with a single GET, the cached data in the gap is fetched again.
+DECLARE_mInt64(file_cache_remote_read_coalesce_max_gap);
+
+// Whether sort_block sorts a block by its leading fixed width sort columns (integers, dates,
+// decimals up to 8 bytes in total, nullable or not, in any direction) with a radix sort on
+// normalized keys before the per column comparator sort of the remaining sort columns.
+DECLARE_mBool(enable_sort_by_normalized_key);
+
+// Whether to write bloom filter indexes for extracted integer and string subcolumns of variant
+// columns, even if the variant column itself is not in bloom_filter_columns.
+DECLARE_mBool(enable_variant_subcolumn_bloom_filter);
+
+// Comma separated "host:http_port" of the BEs whose file caches are shared. A block missing in
+// the local file cache is fetched from the cache of the peer owning its file by consistent
+// hashing before it is read from the remote storage. Empty to disable.
+DECLARE_mString(file_cache_peer_backends);
+DECLARE_mInt32(file_cache_peer_fetch_timeout_ms);
 
 #ifdef BE_TEST
 // test s3
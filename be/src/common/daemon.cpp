@@ -46,6 +46,7 @@
 #include "runtime/be_proc_monitor.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
+#include "runtime/memory/cache_manager.h"
 #include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/memory_reclamation.h"
@@ -53,6 +54,7 @@
 #include "runtime/runtime_query_statistics_mgr.h"
 #include "runtime/workload_group/workload_group_manager.h"
 #include "util/algorithm_util.h"
+#include "util/cpu_sampler.h"
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
@@ -248,8 +250,10 @@ void refresh_cache_capacity() {
         double new_cache_capacity_adjust_weighted =
                 AlgoUtil::descent_by_step(10, cache_capacity_reduce_mem_limit,
                                           doris::MemInfo::soft_mem_limit(), process_memory_usage);
+        // the per cache capacity moves gradually, keep refreshing until it settles.
         if (new_cache_capacity_adjust_weighted !=
-            doris::GlobalMemoryArbitrator::last_cache_capacity_adjust_weighted) {
+                    doris::GlobalMemoryArbitrator::last_cache_capacity_adjust_weighted ||
+            CacheManager::instance()->need_refresh_capacity(new_cache_capacity_adjust_weighted)) {
             doris::GlobalMemoryArbitrator::last_cache_capacity_adjust_weighted =
                     new_cache_capacity_adjust_weighted;
             doris::GlobalMemoryArbitrator::notify_cache_adjust_capacity();
@@ -597,6 +601,12 @@ void Daemon::calculate_workload_group_metrics_thread() {
     }
 }
 
+void Daemon::cpu_sampling_thread() {
+    while (!_stop_background_threads_latch.wait_for(std::chrono::seconds(1))) {
+        CpuSampler::instance()->drain();
+    }
+}
+
 void Daemon::start() {
     Status st;
     st = Thread::create(
@@ -651,6 +661,13 @@ void Daemon::start() {
             [this]() { this->calculate_workload_group_metrics_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+
+    if (config::enable_cpu_sampling) {
+        st = Thread::create(
+                "Daemon", "cpu_sampling_thread", [this]() { this->cpu_sampling_thread(); },
+                &_threads.emplace_back());
+        CHECK(st.ok()) << st;
+    }
 }
 
 void Daemon::stop() {
@@ -48,6 +48,7 @@ private:
     void report_runtime_query_statistics_thread();
     void be_proc_monitor_thread();
     void calculate_workload_group_metrics_thread();
+    void cpu_sampling_thread();
 
     CountDownLatch _stop_background_threads_latch;
     std::vector<scoped_refptr<Thread>> _threads;
@@ -326,6 +326,70 @@ struct IteratorItem {
     SegmentSharedPtr segment;
 };
 
+// Tablet, rowset and segments of one rowset, looked up once for all rows of a request.
+struct RowsetItem {
+    BaseTabletSPtr tablet;
+    BetaRowsetSharedPtr rowset;
+    SegmentCacheHandle segment_cache;
+};
+
+// Column store rows of one segment, collected to be read in row id order.
+struct SegmentRowsItem {
+    int64_t tablet_id;
+    RowsetId rowset_id;
+    SegmentSharedPtr segment;
+    // (ordinal id, index in request.row_locs)
+    std::vector<std::pair<segment_v2::rowid_t, size_t>> rows;
+};
+
+// Reads all rows of every segment in `segment_rows` column by column, in ascending row id
+// order, and appends the row locations to `response` in the same order as the block rows.
+static Status read_by_segment(const PMultiGetRequest& request, const TabletSchema& schema,
+                              const TupleDescriptor& desc,
+                              std::vector<SegmentRowsItem>& segment_rows,
+                              vectorized::Block& result_block, OlapReaderStatistics& stats,
+                              PMultiGetResponse* response) {
+    std::vector<segment_v2::rowid_t> row_ids;
+    for (auto& item : segment_rows) {
+        std::sort(item.rows.begin(), item.rows.end());
+        // read_by_rowids requires strictly ascending row ids, duplicated entries are
+        // materialized from the same row afterwards.
+        row_ids.clear();
+        for (const auto& [row_id, _] : item.rows) {
+            if (row_ids.empty() || row_ids.back() != row_id) {
+                row_ids.push_back(row_id);
+            }
+        }
+        bool has_duplicate = row_ids.size() != item.rows.size();
+        for (int x = 0; x < desc.slots().size(); ++x) {
+            vectorized::MutableColumnPtr column =
+                    result_block.get_by_position(x).column->assume_mutable();
+            std::unique_ptr<ColumnIterator> iterator;
+            if (!has_duplicate) {
+                RETURN_IF_ERROR(item.segment->seek_and_read_by_rowids(
+                        schema, desc.slots()[x], row_ids.data(), row_ids.size(), column, stats,
+                        iterator));
+                continue;
+            }
+            vectorized::MutableColumnPtr unique_column = column->clone_empty();
+            RETURN_IF_ERROR(item.segment->seek_and_read_by_rowids(
+                    schema, desc.slots()[x], row_ids.data(), row_ids.size(), unique_column, stats,
+                    iterator));
+            size_t pos = 0;
+            for (size_t i = 0; i < item.rows.size(); ++i) {
+                if (i > 0 && item.rows[i].first != item.rows[i - 1].first) {
+                    ++pos;
+                }
+                column->insert_from(*unique_column, pos);
+            }
+        }
+        for (const auto& [_, idx] : item.rows) {
+            *response->add_row_locs() = request.row_locs(idx);
+        }
+    }
+    return Status::OK();
+}
+
 Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                           PMultiGetResponse* response) {
     // read from storage engine row id by row id
@@ -352,47 +416,75 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
     }
 
     std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
+    const bool batch_by_segment =
+            !request.fetch_row_store() && config::enable_batch_fetch_rowids_by_segment;
+    std::vector<SegmentRowsItem> segment_rows;
+    std::unordered_map<IteratorKey, size_t, HashOfIteratorKey> segment_rows_index;
+    // rows of a request usually come from a few rowsets, which are looked up only once
+    std::unordered_map<IteratorKey, RowsetItem, HashOfIteratorKey> rowset_map;
     // read row by row
     for (size_t i = 0; i < request.row_locs_size(); ++i) {
         const auto& row_loc = request.row_locs(i);
         MonotonicStopWatch watch;
         watch.start();
-        BaseTabletSPtr tablet = scope_timer_run(
-                [&]() {
-                    auto res = ExecEnv::get_tablet(row_loc.tablet_id());
-                    return !res.has_value() ? nullptr
-                                            : std::dynamic_pointer_cast<BaseTablet>(res.value());
-                },
-                &acquire_tablet_ms);
         RowsetId rowset_id;
         rowset_id.init(row_loc.rowset_id());
-        if (!tablet) {
-            continue;
+        IteratorKey rowset_key {.tablet_id = row_loc.tablet_id(),
+                                .rowset_id = rowset_id,
+                                .segment_id = 0,
+                                .slot_id = -1};
+        auto [rowset_it, rowset_inserted] = rowset_map.try_emplace(rowset_key);
+        RowsetItem& rowset_item = rowset_it->second;
+        if (rowset_inserted) {
+            rowset_item.tablet = scope_timer_run(
+                    [&]() {
+                        auto res = ExecEnv::get_tablet(row_loc.tablet_id());
+                        return !res.has_value()
+                                       ? nullptr
+                                       : std::dynamic_pointer_cast<BaseTablet>(res.value());
+                    },
+                    &acquire_tablet_ms);
+            if (rowset_item.tablet) {
+                // We ensured it's rowset is not released when init Tablet reader param,
+                // rowset->update_delayed_expired_timestamp();
+                rowset_item.rowset = std::static_pointer_cast<BetaRowset>(scope_timer_run(
+                        [&]() {
+                            return ExecEnv::GetInstance()->storage_engine().get_quering_rowset(
+                                    rowset_id);
+                        },
+                        &acquire_rowsets_ms));
+                if (!rowset_item.rowset) {
+                    LOG(INFO) << "no such rowset " << rowset_id;
+                }
+            }
+            if (rowset_item.rowset) {
+                // TODO: supoort session variable enable_page_cache and disable_file_cache if
+                // necessary.
+                RETURN_IF_ERROR(scope_timer_run(
+                        [&]() {
+                            return SegmentLoader::instance()->load_segments(
+                                    rowset_item.rowset, &rowset_item.segment_cache, true);
+                        },
+                        &acquire_segments_ms));
+            }
         }
-        // We ensured it's rowset is not released when init Tablet reader param, rowset->update_delayed_expired_timestamp();
-        BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(scope_timer_run(
-                [&]() {
-                    return ExecEnv::GetInstance()->storage_engine().get_quering_rowset(rowset_id);
-                },
-                &acquire_rowsets_ms));
+        const BaseTabletSPtr& tablet = rowset_item.tablet;
+        const BetaRowsetSharedPtr& rowset = rowset_item.rowset;
         if (!rowset) {
-            LOG(INFO) << "no such rowset " << rowset_id;
             continue;
         }
+        SegmentCacheHandle& segment_cache = rowset_item.segment_cache;
         size_t row_size = 0;
+        // in batch mode the row location is appended once the row is actually read
+        bool add_row_loc = !batch_by_segment;
         Defer _defer([&]() {
             LOG_EVERY_N(INFO, 100)
                     << "multiget_data single_row, cost(us):" << watch.elapsed_time() / 1000
                     << ", row_size:" << row_size;
-            *response->add_row_locs() = row_loc;
+            if (add_row_loc) {
+                *response->add_row_locs() = row_loc;
+            }
         });
-        // TODO: supoort session variable enable_page_cache and disable_file_cache if necessary.
-        SegmentCacheHandle segment_cache;
-        RETURN_IF_ERROR(scope_timer_run(
-                [&]() {
-                    return SegmentLoader::instance()->load_segments(rowset, &segment_cache, true);
-                },
-                &acquire_segments_ms));
         // find segment
         auto it = std::find_if(segment_cache.get_segments().cbegin(),
                                segment_cache.get_segments().cend(),
@@ -423,6 +515,23 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
         if (result_block.is_empty_column()) {
             result_block = vectorized::Block(desc.slots(), request.row_locs().size());
         }
+        if (batch_by_segment) {
+            IteratorKey segment_key {.tablet_id = tablet->tablet_id(),
+                                     .rowset_id = rowset_id,
+                                     .segment_id = row_loc.segment_id(),
+                                     .slot_id = -1};
+            auto [index_it, inserted] =
+                    segment_rows_index.try_emplace(segment_key, segment_rows.size());
+            if (inserted) {
+                segment_rows.push_back({.tablet_id = tablet->tablet_id(),
+                                        .rowset_id = rowset_id,
+                                        .segment = segment,
+                                        .rows = {}});
+            }
+            segment_rows[index_it->second].rows.emplace_back(
+                    static_cast<segment_v2::rowid_t>(row_loc.ordinal_id()), i);
+            continue;
+        }
         VLOG_DEBUG << "Read row location "
                    << fmt::format("{}, {}, {}, {}", row_location.tablet_id,
                                   row_location.row_location.rowset_id.to_string(),
@@ -447,6 +556,14 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                                             iterator_item.iterator));
         }
     }
+    if (!segment_rows.empty()) {
+        RETURN_IF_ERROR(scope_timer_run(
+                [&]() {
+                    return read_by_segment(request, full_read_schema, desc, segment_rows,
+                                           result_block, stats, response);
+                },
+                &lookup_row_data_ms));
+    }
     // serialize block if not empty
     if (!result_block.is_empty_column()) {
         VLOG_DEBUG << "dump block:" << result_block.dump_data(0, 10)
@@ -223,23 +223,21 @@ public:
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
+        std::vector<uint32_t> hash_vals;
         if (!_distributed_slot_locs.empty()) {
-            //TODO: refactor by saving the hash values. then we can calculate in columnwise.
-            compute_function = [this](vectorized::Block* block, uint32_t row,
-                                      const VOlapTablePartition& partition) -> uint32_t {
-                uint32_t hash_val = 0;
-                for (unsigned short _distributed_slot_loc : _distributed_slot_locs) {
-                    auto* slot_desc = _slots[_distributed_slot_loc];
-                    auto& column = block->get_by_position(_distributed_slot_loc).column;
-                    auto val = column->get_data_at(row);
-                    if (val.data != nullptr) {
-                        hash_val = RawValue::zlib_crc32(val.data, val.size, slot_desc->type().type,
-                                                        hash_val);
-                    } else {
-                        hash_val = HashUtil::zlib_crc_hash_null(hash_val);
-                    }
-                }
-                return hash_val % partition.num_buckets;
+            // hash the distribution columns column by column, it gives the same values as
+            // RawValue::zlib_crc32 on every row but without a virtual call per row and column
+            auto rows = static_cast<uint32_t>(block->rows());
+            hash_vals.resize(rows, 0);
+            for (unsigned short _distributed_slot_loc : _distributed_slot_locs) {
+                auto* slot_desc = _slots[_distributed_slot_loc];
+                auto column = block->get_by_position(_distributed_slot_loc)
+                                      .column->convert_to_full_column_if_const();
+                column->update_crcs_with_value(hash_vals.data(), slot_desc->type().type, rows);
+            }
+            compute_function = [&hash_vals](vectorized::Block* block, uint32_t row,
+                                            const VOlapTablePartition& partition) -> uint32_t {
+                return hash_vals[row] % partition.num_buckets;
             };
         } else { // random distribution
             compute_function = [](vectorized::Block* block, uint32_t row,
@@ -43,6 +43,7 @@
 namespace doris {
 
 constexpr static std::string_view HEADER_JSON = "application/json";
+constexpr static std::string_view HEADER_OCTET_STREAM = "application/octet-stream";
 constexpr static std::string_view OP = "op";
 constexpr static std::string_view SYNC = "sync";
 constexpr static std::string_view PATH = "path";
@@ -55,10 +56,50 @@ constexpr static std::string_view RELEASE = "release";
 constexpr static std::string_view BASE_PATH = "base_path";
 constexpr static std::string_view RELEASED_ELEMENTS = "released_elements";
 constexpr static std::string_view VALUE = "value";
+constexpr static std::string_view READ = "read";
+constexpr static std::string_view OFFSET = "offset";
+constexpr static std::string_view SIZE = "size";
+
+namespace {
+
+// Read the bytes [offset, offset + size) of the file from the local file cache, used by the
+// peers of this BE, see FileCachePeers. It never reads the remote storage, the requester does
+// if the range is not fully cached here.
+Status read_cached_data(const std::string& file_name, size_t offset, size_t size,
+                        std::string* data) {
+    io::UInt128Wrapper hash = io::BlockFileCache::hash(file_name);
+    io::BlockFileCache* cache = io::FileCacheFactory::instance()->get_by_path(hash);
+    auto blocks = cache->get_blocks_by_key(hash);
+    data->resize(size);
+    size_t cur_offset = offset;
+    size_t end_offset = offset + size; // exclusive
+    auto iter = blocks.upper_bound(offset);
+    if (iter != blocks.begin()) {
+        --iter;
+    }
+    for (; cur_offset < end_offset && iter != blocks.end(); ++iter) {
+        const auto& block = iter->second;
+        if (block->range().left > cur_offset || block->range().right < cur_offset) {
+            break;
+        }
+        size_t read_size = std::min(end_offset, block->range().right + 1) - cur_offset;
+        RETURN_IF_ERROR(block->read(Slice(data->data() + (cur_offset - offset), read_size),
+                                    cur_offset - block->range().left));
+        cur_offset += read_size;
+    }
+    if (cur_offset != end_offset) {
+        return Status::NotFound("range [{}, {}) of {} is not cached", offset, end_offset,
+                                file_name);
+    }
+    return Status::OK();
+}
+
+} // namespace
 
 Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metrics) {
-    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.data());
     std::string operation = req->param(OP.data());
+    req->add_output_header(HttpHeaders::CONTENT_TYPE,
+                           operation == READ ? HEADER_OCTET_STREAM.data() : HEADER_JSON.data());
     Status st = Status::OK();
     if (operation == RELEASE) {
         size_t released = 0;
@@ -110,6 +151,21 @@ Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metri
             json[HASH.data()] = ret.to_string();
             *json_metrics = json.ToString();
         }
+    } else if (operation == READ) {
+        const std::string& file_name = req->param(VALUE.data());
+        size_t offset = 0;
+        size_t size = 0;
+        try {
+            offset = std::stoull(req->param(OFFSET.data()));
+            size = std::stoull(req->param(SIZE.data()));
+        } catch (...) {
+            return Status::InvalidArgument("invalid {} or {}", OFFSET.data(), SIZE.data());
+        }
+        if (file_name.empty() || size == 0) {
+            return Status::InvalidArgument("missing parameter: {} and {} are required",
+                                           VALUE.data(), SIZE.data());
+        }
+        RETURN_IF_ERROR(read_cached_data(file_name, offset, size, json_metrics));
     } else if (operation == LIST_CACHE) {
         const std::string& segment_path = req->param(VALUE.data());
         if (segment_path.empty()) {
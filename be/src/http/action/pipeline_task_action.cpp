@@ -20,6 +20,7 @@
 #include <sstream>
 #include <string>
 
+#include "common/config.h"
 #include "http/http_channel.h"
 #include "http/http_headers.h"
 #include "http/http_request.h"
@@ -27,6 +28,7 @@
 #include "pipeline/pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
+#include "util/cpu_sampler.h"
 
 namespace doris {
 
@@ -56,8 +58,8 @@ void LongPipelineTaskAction::handle(HttpRequest* req) {
                             ExecEnv::GetInstance()->fragment_mgr()->dump_pipeline_tasks(duration));
 }
 
-void QueryPipelineTaskAction::handle(HttpRequest* req) {
-    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
+// Parse {query_id} of the request, replies the error and returns false if it is invalid.
+static bool parse_query_id(HttpRequest* req, TUniqueId* query_id) {
     int64_t high = 0;
     int64_t low = 0;
     try {
@@ -66,7 +68,7 @@ void QueryPipelineTaskAction::handle(HttpRequest* req) {
             HttpChannel::send_reply(
                     req, HttpStatus::INTERNAL_SERVER_ERROR,
                     "Invalid query id! Query id should be {hi}-{lo} which is a hexadecimal. \n");
-            return;
+            return false;
         }
         from_hex(&high, query_id_str.substr(0, 16));
         from_hex(&low, query_id_str.substr(17));
@@ -77,13 +79,70 @@ void QueryPipelineTaskAction::handle(HttpRequest* req) {
         LOG(WARNING) << fmt::to_string(debug_string_buffer);
         HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR,
                                 fmt::to_string(debug_string_buffer));
-        return;
+        return false;
     }
+    query_id->hi = high;
+    query_id->lo = low;
+    return true;
+}
+
+void QueryPipelineTaskAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
     TUniqueId query_id;
-    query_id.hi = high;
-    query_id.lo = low;
+    if (!parse_query_id(req, &query_id)) {
+        return;
+    }
     HttpChannel::send_reply(req, HttpStatus::OK,
                             ExecEnv::GetInstance()->fragment_mgr()->dump_pipeline_tasks(query_id));
 }
 
+void QueryMemoryAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
+    if (req->param("query_id").empty()) {
+        HttpChannel::send_reply(req, HttpStatus::OK,
+                                ExecEnv::GetInstance()->fragment_mgr()->dump_query_memory());
+        return;
+    }
+    TUniqueId query_id;
+    if (!parse_query_id(req, &query_id)) {
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK,
+                            ExecEnv::GetInstance()->fragment_mgr()->dump_query_memory(query_id));
+}
+
+void QueryCpuSamplesAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain; version=0.0.4");
+    if (!config::enable_cpu_sampling) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND,
+                                "cpu sampling is disabled, set enable_cpu_sampling=true\n");
+        return;
+    }
+    int64_t seconds = config::cpu_sampling_retention_seconds;
+    if (!req->param("seconds").empty()) {
+        try {
+            seconds = std::stoll(req->param("seconds"));
+        } catch (const std::exception& e) {
+            fmt::memory_buffer debug_string_buffer;
+            fmt::format_to(debug_string_buffer, "invalid argument.seconds: {}, meet error: {}",
+                           req->param("seconds"), e.what());
+            LOG(WARNING) << fmt::to_string(debug_string_buffer);
+            HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR,
+                                    fmt::to_string(debug_string_buffer));
+            return;
+        }
+    }
+    if (req->param("query_id").empty()) {
+        HttpChannel::send_reply(req, HttpStatus::OK,
+                                CpuSampler::instance()->dump_collapsed_stacks(nullptr, seconds));
+        return;
+    }
+    TUniqueId query_id;
+    if (!parse_query_id(req, &query_id)) {
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK,
+                            CpuSampler::instance()->dump_collapsed_stacks(&query_id, seconds));
+}
+
 } // end namespace doris
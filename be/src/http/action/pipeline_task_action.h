@@ -51,4 +51,26 @@ public:
     void handle(HttpRequest* req) override;
 };
 
+// Dump the memory attributed to the pipeline operators of all running queries,
+// or of the query given by {query_id}.
+class QueryMemoryAction : public HttpHandlerWithAuth {
+public:
+    QueryMemoryAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~QueryMemoryAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+// Dump the sampled CPU of pipeline threads as collapsed stacks
+// (query;operator;function count) for the last {seconds}, optionally of {query_id} only.
+class QueryCpuSamplesAction : public HttpHandlerWithAuth {
+public:
+    QueryCpuSamplesAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~QueryCpuSamplesAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
 } // end namespace doris
@@ -36,6 +36,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "cloud/config.h"
 #include "common/config.h"
@@ -366,6 +367,18 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
 
     int64_t start_read_data_time = MonotonicNanos();
+    if (ctx->format != TFileFormatType::FORMAT_JSON) {
+        // Line based formats do not care where a buffer ends, so hand the evbuffer
+        // segments to the sink, which packs them into its own chunks. Copying every piece
+        // into a fresh 128KB buffer wastes most of it for the small pieces a socket read
+        // usually yields, and the pipe only accounts the bytes actually in the buffers.
+        Status st = _append_evbuffer_segments(evbuf, ctx.get());
+        if (!st.ok()) {
+            LOG(WARNING) << "append body content failed. errmsg=" << st << ", " << ctx->brief();
+            ctx->status = st;
+            return;
+        }
+    }
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
         Status st = ByteBuffer::allocate(128 * 1024, &bb);
@@ -395,6 +408,24 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
                        1000000;
 }
 
+Status StreamLoadAction::_append_evbuffer_segments(evbuffer* evbuf, StreamLoadContext* ctx) {
+    int num_segments = evbuffer_peek(evbuf, -1, nullptr, nullptr, 0);
+    if (num_segments <= 0) {
+        return Status::OK();
+    }
+    std::vector<evbuffer_iovec> segments(num_segments);
+    num_segments = evbuffer_peek(evbuf, -1, nullptr, segments.data(), num_segments);
+    size_t appended_bytes = 0;
+    for (int i = 0; i < num_segments; ++i) {
+        RETURN_IF_ERROR(ctx->body_sink->append(static_cast<const char*>(segments[i].iov_base),
+                                               segments[i].iov_len));
+        appended_bytes += segments[i].iov_len;
+    }
+    evbuffer_drain(evbuf, appended_bytes);
+    ctx->receive_bytes += appended_bytes;
+    return Status::OK();
+}
+
 void StreamLoadAction::free_handler_ctx(std::shared_ptr<void> param) {
     std::shared_ptr<StreamLoadContext> ctx = std::static_pointer_cast<StreamLoadContext>(param);
     if (ctx == nullptr) {
@@ -23,6 +23,8 @@
 #include "http/http_handler.h"
 #include "util/metrics.h"
 
+struct evbuffer;
+
 namespace doris {
 
 class ExecEnv;
@@ -51,6 +53,7 @@ private:
     Status _process_put(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
     void _save_stream_load_record(std::shared_ptr<StreamLoadContext> ctx, const std::string& str);
     Status _handle_group_commit(HttpRequest* http_req, std::shared_ptr<StreamLoadContext> ctx);
+    Status _append_evbuffer_segments(evbuffer* evbuf, StreamLoadContext* ctx);
 
 private:
     ExecEnv* _exec_env;
@@ -35,6 +35,7 @@
 #include <memory>
 #include <sstream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "http/http_channel.h"
 #include "http/http_handler.h"
@@ -81,6 +82,29 @@ static int on_connection(struct evhttp_request* req, void* param) {
     return 0;
 }
 
+// Opens a listening socket with SO_REUSEPORT, which may be bound to the same address many times.
+static int listen_reuse_port(const butil::EndPoint& point) {
+    struct sockaddr_storage addr;
+    socklen_t addr_len = 0;
+    if (butil::endpoint2sockaddr(point, &addr, &addr_len) != 0) {
+        return -1;
+    }
+    int fd = socket(addr.ss_family, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    int on = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) != 0 ||
+        setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0 ||
+        bind(fd, (struct sockaddr*)&addr, addr_len) != 0 || listen(fd, SOMAXCONN) != 0) {
+        int saved_errno = errno;
+        close(fd);
+        errno = saved_errno;
+        return -1;
+    }
+    return fd;
+}
+
 EvHttpServer::EvHttpServer(int port, int num_workers)
         : _port(port), _num_workers(num_workers), _real_port(0) {
     _host = BackendOptions::get_service_bind_address();
@@ -130,7 +154,7 @@ void EvHttpServer::start() {
                                          [](evhttp* http) { evhttp_free(http); });
             CHECK(http != nullptr) << "Couldn't create an evhttp.";
 
-            auto res = evhttp_accept_socket(http.get(), _server_fd);
+            auto res = evhttp_accept_socket(http.get(), _server_fds[i % _server_fds.size()]);
             CHECK(res >= 0) << "evhttp accept socket failed, res=" << res;
 
             evhttp_set_newreqcb(http.get(), on_connection, this);
@@ -151,7 +175,10 @@ void EvHttpServer::stop() {
         _event_bases.clear();
     }
     _workers->shutdown();
-    close(_server_fd);
+    for (int fd : _server_fds) {
+        close(fd);
+    }
+    _server_fds.clear();
     _started = false;
 }
 
@@ -163,29 +190,36 @@ Status EvHttpServer::_bind() {
     if (res < 0) {
         return Status::InternalError("convert address failed, host={}, port={}", _host, _port);
     }
-    _server_fd = butil::tcp_listen(point);
-    if (_server_fd < 0) {
-        char buf[64];
-        std::stringstream ss;
-        ss << "tcp listen failed, errno=" << errno
-           << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
-        return Status::InternalError(ss.str());
-    }
-    if (_port == 0) {
-        struct sockaddr_in addr;
-        socklen_t socklen = sizeof(addr);
-        const int rc = getsockname(_server_fd, (struct sockaddr*)&addr, &socklen);
-        if (rc == 0) {
-            _real_port = ntohs(addr.sin_port);
+    const bool reuse_port = config::enable_webserver_reuse_port && _num_workers > 1;
+    const int num_fds = reuse_port ? _num_workers : 1;
+    for (int i = 0; i < num_fds; ++i) {
+        int fd = reuse_port ? listen_reuse_port(point) : butil::tcp_listen(point);
+        if (fd < 0) {
+            char buf[64];
+            std::stringstream ss;
+            ss << "tcp listen failed, errno=" << errno
+               << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
+            return Status::InternalError(ss.str());
+        }
+        _server_fds.push_back(fd);
+        if (i == 0 && _port == 0) {
+            struct sockaddr_in addr;
+            socklen_t socklen = sizeof(addr);
+            const int rc = getsockname(fd, (struct sockaddr*)&addr, &socklen);
+            if (rc == 0) {
+                _real_port = ntohs(addr.sin_port);
+                // the other sockets share the port chosen by os
+                point.port = _real_port;
+            }
+        }
+        res = butil::make_non_blocking(fd);
+        if (res < 0) {
+            char buf[64];
+            std::stringstream ss;
+            ss << "make socket to non_blocking failed, errno=" << errno
+               << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
+            return Status::InternalError(ss.str());
         }
-    }
-    res = butil::make_non_blocking(_server_fd);
-    if (res < 0) {
-        char buf[64];
-        std::stringstream ss;
-        ss << "make socket to non_blocking failed, errno=" << errno
-           << ", errmsg=" << strerror_r(errno, buf, sizeof(buf));
-        return Status::InternalError(ss.str());
     }
     return Status::OK();
 }
@@ -72,7 +72,8 @@ private:
     // used for unittest, set port to 0, os will choose a free port;
     int _real_port;
 
-    int _server_fd = -1;
+    // one listening socket shared by all workers, or one socket per worker with SO_REUSEPORT
+    std::vector<int> _server_fds;
     std::unique_ptr<ThreadPool> _workers;
     std::mutex _event_bases_lock; // protect _event_bases
     std::vector<std::shared_ptr<event_base>> _event_bases;
@@ -46,7 +46,8 @@ public:
     static void send_reply(HttpRequest* request, HttpStatus status, const std::string& content);
 
     static void send_file(HttpRequest* request, int fd, size_t off, size_t size,
-                          bufferevent_rate_limit_group* rate_limit_group = nullptr);
+                          bufferevent_rate_limit_group* rate_limit_group = nullptr,
+                          HttpStatus status = HttpStatus::OK);
 
     static void send_files(HttpRequest* request, const std::string& root_dir,
                            std::vector<std::string> local_files,
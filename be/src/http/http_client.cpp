@@ -475,6 +475,44 @@ Status HttpClient::download(const std::string& local_path) {
     return status;
 }
 
+Status HttpClient::download_resumable(const std::string& local_path) {
+    set_method(GET);
+    set_speed_limit();
+
+    auto fp_closer = [](FILE* fp) { fclose(fp); };
+    std::unique_ptr<FILE, decltype(fp_closer)> fp(fopen(local_path.c_str(), "a"), fp_closer);
+    if (fp == nullptr) {
+        LOG(WARNING) << "open file failed, file=" << local_path;
+        return Status::InternalError("open file failed");
+    }
+    fseeko(fp.get(), 0, SEEK_END);
+    off_t offset = ftello(fp.get());
+    if (offset > 0) {
+        curl_easy_setopt(_curl, CURLOPT_RESUME_FROM_LARGE, static_cast<curl_off_t>(offset));
+    }
+    Status status;
+    auto callback = [&status, &fp, &local_path](const void* data, size_t length) {
+        auto res = fwrite(data, length, 1, fp.get());
+        if (res != 1) {
+            LOG(WARNING) << "fail to write data to file, file=" << local_path
+                         << ", error=" << ferror(fp.get());
+            status = Status::InternalError("fail to write data when download");
+            return false;
+        }
+        return true;
+    };
+
+    if (auto s = execute(callback); !s.ok()) {
+        status = s;
+    }
+    if (!status.ok() && offset > 0 && get_http_status() == 200) {
+        // the server ignored the range request, start from scratch in the next attempt
+        LOG(INFO) << "server does not support resuming download, file=" << local_path;
+        remove(local_path.c_str());
+    }
+    return status;
+}
+
 Status HttpClient::download_multi_files(const std::string& local_dir,
                                         const std::unordered_set<std::string>& expected_files) {
     set_speed_limit();
@@ -521,7 +559,8 @@ Status HttpClient::execute_with_retry(int retry_times, int sleep_time,
         status = callback(&client);
         if (status.ok()) {
             auto http_status = client.get_http_status();
-            if (http_status == 200) {
+            // 206 is the reply of a resumed download
+            if (http_status == 200 || http_status == 206) {
                 return status;
             } else {
                 std::string url = mask_token(client._get_url());
@@ -144,6 +144,9 @@ public:
     // helper function to download a file, you can call this function to download
     // a file to local_path
     Status download(const std::string& local_path);
+    // like download(), but appends to the partial file left by a previous failed
+    // attempt and keeps it on failure, so that a retry resumes instead of restarting
+    Status download_resumable(const std::string& local_path);
     Status download_multi_files(const std::string& local_dir,
                                 const std::unordered_set<std::string>& expected_files);
 
@@ -22,8 +22,10 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <charconv>
 #include <ostream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -169,13 +171,23 @@ void do_file_response(const std::string& file_path, HttpRequest* req,
     int64_t file_size = st.st_size;
 
     // TODO(lingbin): process "IF_MODIFIED_SINCE" header
-    // TODO(lingbin): process "RANGE" header
+    // Only the "bytes=<offset>-" form is supported, which is what a client resuming a
+    // partial download sends. Other ranges are ignored and the whole file is returned.
+    int64_t range_offset = 0;
     const std::string& range_header = req->header(HttpHeaders::RANGE);
-    if (!range_header.empty()) {
-        // analyse range header
+    if (range_header.starts_with("bytes=") && range_header.ends_with("-")) {
+        std::string_view offset_str(range_header.data() + 6, range_header.size() - 7);
+        int64_t offset = 0;
+        auto [ptr, ec] =
+                std::from_chars(offset_str.data(), offset_str.data() + offset_str.size(), offset);
+        if (ec == std::errc() && ptr == offset_str.data() + offset_str.size() && offset > 0 &&
+            offset < file_size) {
+            range_offset = offset;
+        }
     }
 
     req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
+    req->add_output_header(HttpHeaders::ACCEPT_RANGES, "bytes");
 
     if (is_acquire_md5) {
         Md5Digest md5;
@@ -195,6 +207,14 @@ void do_file_response(const std::string& file_path, HttpRequest* req,
         return;
     }
 
+    if (range_offset > 0) {
+        req->add_output_header(
+                HttpHeaders::CONTENT_RANGE,
+                fmt::format("bytes {}-{}/{}", range_offset, file_size - 1, file_size).c_str());
+        HttpChannel::send_file(req, fd, range_offset, file_size - range_offset, rate_limit_group,
+                               HttpStatus::PARTIAL_CONTENT);
+        return;
+    }
     HttpChannel::send_file(req, fd, 0, file_size, rate_limit_group);
 }
 
@@ -217,7 +217,7 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
         _storage = std::make_unique<MemFileCacheStorage>();
         _cache_base_path = "memory";
     } else {
-        _storage = std::make_unique<FSFileCacheStorage>();
+        _storage = std::make_unique<FSFileCacheStorage>(cache_settings.hot_tier_size);
     }
 
     LOG(INFO) << "file cache path= " << _cache_base_path << " " << cache_settings.to_string();
@@ -346,6 +346,7 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
     }
 
     cell.update_atime();
+    ++cell.hits;
     cell.is_deleted = false;
 }
 
@@ -1852,28 +1853,34 @@ void BlockFileCache::modify_expiration_time(const UInt128Wrapper& hash,
     }
 }
 
-std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t>>
+std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t, uint32_t>>
 BlockFileCache::get_hot_blocks_meta(const UInt128Wrapper& hash) const {
     int64_t cur_time = std::chrono::duration_cast<std::chrono::seconds>(
                                std::chrono::steady_clock::now().time_since_epoch())
                                .count();
-    SCOPED_CACHE_LOCK(_mutex);
-    std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t>> blocks_meta;
-    if (auto iter = _files.find(hash); iter != _files.end()) {
-        for (auto& pair : _files.find(hash)->second) {
-            const FileBlockCell* cell = &pair.second;
-            if (cell->file_block->cache_type() != FileCacheType::DISPOSABLE) {
-                if (cell->file_block->cache_type() == FileCacheType::TTL ||
-                    (cell->atime != 0 &&
-                     cur_time - cell->atime <
-                             get_queue(cell->file_block->cache_type()).get_hot_data_interval())) {
-                    blocks_meta.emplace_back(pair.first, cell->size(),
-                                             cell->file_block->cache_type(),
-                                             cell->file_block->expiration_time());
+    std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t, uint32_t>> blocks_meta;
+    {
+        SCOPED_CACHE_LOCK(_mutex);
+        if (auto iter = _files.find(hash); iter != _files.end()) {
+            for (auto& pair : iter->second) {
+                const FileBlockCell* cell = &pair.second;
+                if (cell->file_block->cache_type() != FileCacheType::DISPOSABLE) {
+                    if (cell->file_block->cache_type() == FileCacheType::TTL ||
+                        (cell->atime != 0 &&
+                         cur_time - cell->atime <
+                                 get_queue(cell->file_block->cache_type())
+                                         .get_hot_data_interval())) {
+                        blocks_meta.emplace_back(pair.first, cell->size(),
+                                                 cell->file_block->cache_type(),
+                                                 cell->file_block->expiration_time(), cell->hits);
+                    }
                 }
             }
         }
     }
+    std::stable_sort(blocks_meta.begin(), blocks_meta.end(), [](const auto& lhs, const auto& rhs) {
+        return std::get<4>(lhs) > std::get<4>(rhs);
+    });
     return blocks_meta;
 }
 
@@ -112,6 +112,8 @@ public:
 
     [[nodiscard]] const std::string& get_base_path() const { return _cache_base_path; }
 
+    [[nodiscard]] FileCacheStorageType get_storage_type() const { return _storage->get_type(); }
+
     /**
          * Given an `offset` and `size` representing [offset, offset + size) bytes interval,
          * return list of cached non-overlapping non-empty
@@ -165,9 +167,9 @@ public:
     void reset_range(const UInt128Wrapper&, size_t offset, size_t old_size, size_t new_size,
                      std::lock_guard<std::mutex>& cache_lock);
 
-    // get the hotest blocks message by key
-    // The tuple is composed of <offset, size, cache_type, expiration_time>
-    [[nodiscard]] std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t>>
+    // get the hotest blocks message by key, the hottest block comes first
+    // The tuple is composed of <offset, size, cache_type, expiration_time, hits>
+    [[nodiscard]] std::vector<std::tuple<size_t, size_t, FileCacheType, uint64_t, uint32_t>>
     get_hot_blocks_meta(const UInt128Wrapper& hash) const;
 
     [[nodiscard]] bool get_async_open_success() const { return _async_open_done; }
@@ -336,6 +338,8 @@ private:
         std::optional<LRUQueue::Iterator> queue_iterator;
 
         mutable int64_t atime {0};
+        // number of times the block is read through the cache, the heat of the block
+        mutable uint32_t hits {0};
         mutable bool is_deleted {false};
         void update_atime() const {
             atime = std::chrono::duration_cast<std::chrono::seconds>(
@@ -354,7 +358,8 @@ private:
         FileBlockCell(FileBlockCell&& other) noexcept
                 : file_block(std::move(other.file_block)),
                   queue_iterator(other.queue_iterator),
-                  atime(other.atime) {}
+                  atime(other.atime),
+                  hits(other.hits) {}
 
         FileBlockCell& operator=(const FileBlockCell&) = delete;
         FileBlockCell(const FileBlockCell&) = delete;
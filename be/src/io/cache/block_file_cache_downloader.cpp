@@ -220,6 +220,8 @@ void FileCacheBlockDownloader::download_segment_file(const DownloadFileMeta& met
     size_t task_num = (download_size + one_single_task_size - 1) / one_single_task_size;
 
     std::unique_ptr<char[]> buffer(new char[one_single_task_size]);
+    IOContext io_ctx = meta.ctx;
+    io_ctx.is_warmup = true;
 
     for (size_t i = 0; i < task_num; i++) {
         size_t offset = meta.offset + i * one_single_task_size;
@@ -229,7 +231,7 @@ void FileCacheBlockDownloader::download_segment_file(const DownloadFileMeta& met
         // TODO(plat1ko):
         //  1. Directly append buffer data to file cache
         //  2. Provide `FileReader::async_read()` interface
-        auto st = file_reader->read_at(offset, {buffer.get(), size}, &bytes_read, &meta.ctx);
+        auto st = file_reader->read_at(offset, {buffer.get(), size}, &bytes_read, &io_ctx);
         if (!st.ok()) {
             LOG(WARNING) << "failed to download file: " << st;
             if (meta.download_done) {
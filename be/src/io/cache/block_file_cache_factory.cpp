@@ -20,8 +20,10 @@
 
 #include "io/cache/block_file_cache_factory.h"
 
+#include <fmt/format.h>
 #include <glog/logging.h>
 
+#include <filesystem>
 #include <string>
 #include <vector>
 #if defined(__APPLE__)
@@ -60,6 +62,13 @@ size_t FileCacheFactory::try_release() {
 }
 
 size_t FileCacheFactory::try_release(const std::string& base_path) {
+    if (auto iter = _path_to_shards.find(base_path); iter != _path_to_shards.end()) {
+        size_t elements = 0;
+        for (auto* cache : iter->second) {
+            elements += cache->try_release();
+        }
+        return elements;
+    }
     auto iter = _path_to_cache.find(base_path);
     if (iter != _path_to_cache.end()) {
         return iter->second->try_release();
@@ -67,6 +76,27 @@ size_t FileCacheFactory::try_release(const std::string& base_path) {
     return 0;
 }
 
+// Every shard gets an equal part of the sizes of the path, the element limits are divided
+// the same way.
+static FileCacheSettings get_shard_settings(const FileCacheSettings& settings, size_t shards) {
+    FileCacheSettings shard_settings = settings;
+    shard_settings.capacity = settings.capacity / shards;
+    shard_settings.disposable_queue_size = settings.disposable_queue_size / shards;
+    shard_settings.disposable_queue_elements =
+            std::max<size_t>(settings.disposable_queue_elements / shards, 1);
+    shard_settings.index_queue_size = settings.index_queue_size / shards;
+    shard_settings.index_queue_elements =
+            std::max<size_t>(settings.index_queue_elements / shards, 1);
+    shard_settings.query_queue_size = settings.query_queue_size / shards;
+    shard_settings.query_queue_elements =
+            std::max<size_t>(settings.query_queue_elements / shards, 1);
+    shard_settings.ttl_queue_size = settings.ttl_queue_size / shards;
+    shard_settings.ttl_queue_elements = std::max<size_t>(settings.ttl_queue_elements / shards, 1);
+    shard_settings.max_query_cache_size = settings.max_query_cache_size / shards;
+    shard_settings.hot_tier_size = settings.hot_tier_size / shards;
+    return shard_settings;
+}
+
 Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
                                            FileCacheSettings file_cache_settings) {
     if (file_cache_settings.storage == "memory") {
@@ -109,15 +139,45 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
                   << " total_size: " << file_cache_settings.capacity
                   << " disk_total_size: " << disk_capacity;
     }
-    auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
-    {
+    size_t shards = file_cache_settings.storage == "memory"
+                            ? 1
+                            : static_cast<size_t>(std::max(1, config::file_cache_shards_per_path));
+    if (shards == 1) {
+        auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
+        RETURN_IF_ERROR(cache->initialize());
         std::lock_guard lock(_mtx);
         _path_to_cache[cache_base_path] = cache.get();
         _caches.push_back(std::move(cache));
         _capacity += file_cache_settings.capacity;
+        return Status::OK();
     }
 
+    // Keys are spread over all caches by hash in get_by_path(hash), so every shard only locks
+    // and evicts its own part of the path.
+    FileCacheSettings shard_settings = get_shard_settings(file_cache_settings, shards);
+    std::vector<std::unique_ptr<BlockFileCache>> shard_caches;
+    for (size_t i = 0; i < shards; ++i) {
+        auto shard_path = (std::filesystem::path(cache_base_path) / fmt::format("shard_{}", i))
+                                  .native();
+        const auto& fs = global_local_filesystem();
+        bool exists = false;
+        RETURN_IF_ERROR(fs->exists(shard_path, &exists));
+        if (!exists) {
+            RETURN_IF_ERROR(fs->create_directory(shard_path));
+        }
+        auto cache = std::make_unique<BlockFileCache>(shard_path, shard_settings);
+        RETURN_IF_ERROR(cache->initialize());
+        shard_caches.push_back(std::move(cache));
+    }
+    LOG(INFO) << "[FileCache] path: " << cache_base_path << " is split into " << shards
+              << " shards of size " << shard_settings.capacity;
+    std::lock_guard lock(_mtx);
+    for (auto& cache : shard_caches) {
+        _path_to_cache[cache->get_base_path()] = cache.get();
+        _path_to_shards[cache_base_path].push_back(cache.get());
+        _capacity += shard_settings.capacity;
+        _caches.push_back(std::move(cache));
+    }
     return Status::OK();
 }
 
@@ -141,6 +201,9 @@ BlockFileCache* FileCacheFactory::get_by_path(const UInt128Wrapper& key) {
 }
 
 BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path) {
+    if (auto iter = _path_to_shards.find(cache_base_path); iter != _path_to_shards.end()) {
+        return iter->second.front();
+    }
     auto iter = _path_to_cache.find(cache_base_path);
     if (iter == _path_to_cache.end()) {
         return nullptr;
@@ -149,6 +212,14 @@ BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path
     }
 }
 
+BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path,
+                                              const UInt128Wrapper& key) {
+    if (auto iter = _path_to_shards.find(cache_base_path); iter != _path_to_shards.end()) {
+        return iter->second[KeyHash()(key) % iter->second.size()];
+    }
+    return get_by_path(cache_base_path);
+}
+
 std::vector<BlockFileCache::QueryFileCacheContextHolderPtr>
 FileCacheFactory::get_query_context_holders(const TUniqueId& query_id) {
     std::vector<BlockFileCache::QueryFileCacheContextHolderPtr> holders;
@@ -168,20 +239,50 @@ std::string FileCacheFactory::clear_file_caches(bool sync) {
 
 std::vector<std::string> FileCacheFactory::get_base_paths() {
     std::vector<std::string> paths;
-    for (const auto& pair : _path_to_cache) {
+    for (const auto& pair : _path_to_shards) {
         paths.push_back(pair.first);
     }
+    for (const auto& pair : _path_to_cache) {
+        if (!_is_shard(pair.second)) {
+            paths.push_back(pair.first);
+        }
+    }
     return paths;
 }
 
+bool FileCacheFactory::_is_shard(const BlockFileCache* cache) const {
+    for (const auto& [_, shards] : _path_to_shards) {
+        if (std::find(shards.begin(), shards.end(), cache) != shards.end()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 std::string FileCacheFactory::reset_capacity(const std::string& path, int64_t new_capacity) {
+    // the capacity of a sharded path is divided among its shards
+    auto reset_shards = [new_capacity](const std::vector<BlockFileCache*>& shards) {
+        std::stringstream ss;
+        for (auto* cache : shards) {
+            ss << cache->reset_capacity(new_capacity / static_cast<int64_t>(shards.size()));
+        }
+        return ss.str();
+    };
     if (path.empty()) {
         std::stringstream ss;
+        for (auto& [_, shards] : _path_to_shards) {
+            ss << reset_shards(shards);
+        }
         for (auto& [_, cache] : _path_to_cache) {
-            ss << cache->reset_capacity(new_capacity);
+            if (!_is_shard(cache)) {
+                ss << cache->reset_capacity(new_capacity);
+            }
         }
         return ss.str();
     } else {
+        if (auto iter = _path_to_shards.find(path); iter != _path_to_shards.end()) {
+            return reset_shards(iter->second);
+        }
         if (auto iter = _path_to_cache.find(path); iter != _path_to_cache.end()) {
             return iter->second->reset_capacity(new_capacity);
         }
@@ -24,6 +24,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -65,7 +66,11 @@ public:
     std::vector<std::string> get_cache_file_by_path(const UInt128Wrapper& hash);
 
     BlockFileCache* get_by_path(const UInt128Wrapper& hash);
+    // For a path split into shards, returns its first shard.
     BlockFileCache* get_by_path(const std::string& cache_base_path);
+    // Returns the cache of `cache_base_path` holding `hash`, it is the shard of the key when the
+    // path is split into shards.
+    BlockFileCache* get_by_path(const std::string& cache_base_path, const UInt128Wrapper& hash);
     std::vector<BlockFileCache::QueryFileCacheContextHolderPtr> get_query_context_holders(
             const TUniqueId& query_id);
 
@@ -95,9 +100,13 @@ public:
     FileCacheFactory(const FileCacheFactory&) = delete;
 
 private:
+    bool _is_shard(const BlockFileCache* cache) const;
+
     std::mutex _mtx;
     std::vector<std::unique_ptr<BlockFileCache>> _caches;
     std::unordered_map<std::string, BlockFileCache*> _path_to_cache;
+    // configured cache path -> its shards, only for paths split into several shards
+    std::unordered_map<std::string, std::vector<BlockFileCache*>> _path_to_shards;
     size_t _capacity = 0;
     std::atomic_size_t _next_index {0}; // use for round-robin
 };
@@ -17,6 +17,7 @@
 
 #include "io/cache/block_file_cache_profile.h"
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <string>
@@ -33,6 +34,37 @@ std::shared_ptr<AtomicStatistics> FileCacheProfile::report() {
     return stats;
 }
 
+void report_io_tier(RuntimeProfile* profile, const std::string& tier,
+                    const IOTierStatistics& stats, IntCounter* reads_metric,
+                    IntCounter* bytes_metric, IntCounter* latency_metric) {
+    if (stats.num_reads == 0) {
+        return;
+    }
+    static const char* tiers_profile = "IOTiers";
+    static const std::array<const char*, IOTierStatistics::NUM_LATENCY_BUCKETS> bucket_names = {
+            "ReadsUnder10us", "ReadsUnder100us", "ReadsUnder1ms",
+            "ReadsUnder10ms", "ReadsUnder100ms", "ReadsOver100ms"};
+    ADD_TIMER_WITH_LEVEL(profile, tiers_profile, 1);
+    COUNTER_UPDATE(ADD_CHILD_COUNTER_WITH_LEVEL(profile, tier + "Reads", TUnit::UNIT,
+                                                tiers_profile, 1),
+                   stats.num_reads);
+    COUNTER_UPDATE(ADD_CHILD_COUNTER_WITH_LEVEL(profile, tier + "BytesRead", TUnit::BYTES,
+                                                tiers_profile, 1),
+                   stats.bytes_read);
+    COUNTER_UPDATE(ADD_CHILD_TIMER_WITH_LEVEL(profile, tier + "ReadTime", tiers_profile, 1),
+                   stats.latency_ns);
+    for (size_t i = 0; i < bucket_names.size(); ++i) {
+        if (stats.latency_buckets[i] != 0) {
+            COUNTER_UPDATE(ADD_CHILD_COUNTER_WITH_LEVEL(profile, tier + bucket_names[i],
+                                                        TUnit::UNIT, tiers_profile, 2),
+                           stats.latency_buckets[i]);
+        }
+    }
+    reads_metric->increment(stats.num_reads);
+    bytes_metric->increment(stats.bytes_read);
+    latency_metric->increment(stats.latency_ns / 1000);
+}
+
 void FileCacheProfile::update(FileCacheStatistics* stats) {
     if (_profile == nullptr) {
         std::lock_guard<std::mutex> lock(_mtx);
@@ -72,7 +72,14 @@ struct FileCacheProfile {
     std::shared_ptr<AtomicStatistics> report();
 };
 
+// Reports the reads served by one tier of the read path into `profile`, under "IOTiers" and
+// named by `tier`, and accumulates them into the metrics of the tier.
+void report_io_tier(RuntimeProfile* profile, const std::string& tier,
+                    const IOTierStatistics& stats, IntCounter* reads_metric,
+                    IntCounter* bytes_metric, IntCounter* latency_metric);
+
 struct FileCacheProfileReporter {
+    RuntimeProfile* profile = nullptr;
     RuntimeProfile::Counter* num_local_io_total = nullptr;
     RuntimeProfile::Counter* num_remote_io_total = nullptr;
     RuntimeProfile::Counter* num_inverted_index_remote_io_total = nullptr;
@@ -83,13 +90,15 @@ struct FileCacheProfileReporter {
     RuntimeProfile::Counter* write_cache_io_timer = nullptr;
     RuntimeProfile::Counter* bytes_write_into_cache = nullptr;
     RuntimeProfile::Counter* num_skip_cache_io_total = nullptr;
+    RuntimeProfile::Counter* num_remote_read_requests = nullptr;
+    RuntimeProfile::Counter* num_coalesced_remote_read_requests = nullptr;
     RuntimeProfile::Counter* read_cache_file_directly_timer = nullptr;
     RuntimeProfile::Counter* cache_get_or_set_timer = nullptr;
     RuntimeProfile::Counter* lock_wait_timer = nullptr;
     RuntimeProfile::Counter* get_timer = nullptr;
     RuntimeProfile::Counter* set_timer = nullptr;
 
-    FileCacheProfileReporter(RuntimeProfile* profile) {
+    FileCacheProfileReporter(RuntimeProfile* profile) : profile(profile) {
         static const char* cache_profile = "FileCache";
         ADD_TIMER_WITH_LEVEL(profile, cache_profile, 1);
         num_local_io_total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumLocalIOTotal", TUnit::UNIT,
@@ -106,6 +115,10 @@ struct FileCacheProfileReporter {
                                                               TUnit::BYTES, cache_profile, 1);
         num_skip_cache_io_total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumSkipCacheIOTotal",
                                                                TUnit::UNIT, cache_profile, 1);
+        num_remote_read_requests = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumRemoteReadRequests",
+                                                                TUnit::UNIT, cache_profile, 1);
+        num_coalesced_remote_read_requests = ADD_CHILD_COUNTER_WITH_LEVEL(
+                profile, "NumCoalescedRemoteReadRequests", TUnit::UNIT, cache_profile, 1);
         bytes_scanned_from_cache = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromCache",
                                                                 TUnit::BYTES, cache_profile, 1);
         bytes_scanned_from_remote = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromRemote",
@@ -129,6 +142,9 @@ struct FileCacheProfileReporter {
         COUNTER_UPDATE(write_cache_io_timer, statistics->write_cache_io_timer);
         COUNTER_UPDATE(bytes_write_into_cache, statistics->bytes_write_into_cache);
         COUNTER_UPDATE(num_skip_cache_io_total, statistics->num_skip_cache_io_total);
+        COUNTER_UPDATE(num_remote_read_requests, statistics->num_remote_read_requests);
+        COUNTER_UPDATE(num_coalesced_remote_read_requests,
+                       statistics->num_coalesced_remote_read_requests);
         COUNTER_UPDATE(bytes_scanned_from_cache, statistics->bytes_read_from_local);
         COUNTER_UPDATE(bytes_scanned_from_remote, statistics->bytes_read_from_remote);
         COUNTER_UPDATE(read_cache_file_directly_timer, statistics->read_cache_file_directly_timer);
@@ -136,6 +152,17 @@ struct FileCacheProfileReporter {
         COUNTER_UPDATE(lock_wait_timer, statistics->lock_wait_timer);
         COUNTER_UPDATE(get_timer, statistics->get_timer);
         COUNTER_UPDATE(set_timer, statistics->set_timer);
+        auto* metrics = DorisMetrics::instance();
+        report_io_tier(profile, "FileCacheMemory", statistics->file_cache_memory_io,
+                       metrics->io_file_cache_memory_reads_total,
+                       metrics->io_file_cache_memory_bytes_total,
+                       metrics->io_file_cache_memory_latency_us_total);
+        report_io_tier(profile, "FileCacheDisk", statistics->file_cache_disk_io,
+                       metrics->io_file_cache_disk_reads_total,
+                       metrics->io_file_cache_disk_bytes_total,
+                       metrics->io_file_cache_disk_latency_us_total);
+        report_io_tier(profile, "Remote", statistics->remote_io, metrics->io_remote_reads_total,
+                       metrics->io_remote_bytes_total, metrics->io_remote_latency_us_total);
     }
 };
 
@@ -33,6 +33,7 @@
 #include "io/cache/block_file_cache_factory.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/cache/file_block.h"
+#include "io/cache/file_cache_peers.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
@@ -45,6 +46,8 @@ namespace doris::io {
 bvar::Adder<uint64_t> s3_read_counter("cached_remote_reader_s3_read");
 bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
+bvar::Adder<uint64_t> g_peer_read_counter("cached_remote_reader_peer_read");
+bvar::Adder<uint64_t> g_peer_read_failed_counter("cached_remote_reader_peer_read_failed");
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
@@ -65,7 +68,8 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
             _cache = FileCacheFactory::instance()->get_by_path(_cache_hash);
         } else {
             // from query session variable: file_cache_base_path
-            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path);
+            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path,
+                                                               _cache_hash);
             if (_cache == nullptr) {
                 LOG(WARNING) << "Can't get cache from base path: " << opts.cache_base_path
                              << ", using random instead.";
@@ -75,6 +79,25 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
     }
 }
 
+bool CachedRemoteFileReader::_read_from_peer(size_t offset, size_t size, char* buffer) {
+    if (!_is_doris_table || config::file_cache_peer_backends.empty()) {
+        return false;
+    }
+    auto peers = FileCachePeers::current();
+    const std::string& peer = peers->owner(_cache_hash);
+    if (peer.empty()) {
+        return false;
+    }
+    Status st = FileCachePeers::fetch(peer, path().filename().native(), offset, size, buffer);
+    if (!st.ok()) {
+        g_peer_read_failed_counter << 1;
+        VLOG_DEBUG << "failed to read " << path().native() << " from peer " << peer << ": " << st;
+        return false;
+    }
+    g_peer_read_counter << 1;
+    return true;
+}
+
 void CachedRemoteFileReader::_insert_file_reader(FileBlockSPtr file_block) {
     if (config::enable_read_cache_file_directly) {
         std::lock_guard lock(_mtx);
@@ -124,8 +147,11 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         return Status::OK();
     }
     ReadStatistics stats;
+    MonotonicStopWatch read_watch;
+    read_watch.start();
     auto defer_func = [&](int*) {
         if (io_ctx->file_cache_stats) {
+            stats.total_read_timer = read_watch.elapsed_time();
             // update stats in io_ctx, for query profile
             _update_stats(stats, io_ctx->file_cache_stats, io_ctx->is_inverted_index);
             // update stats increment in this reading procedure for file cache metrics
@@ -208,20 +234,44 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             break;
         }
     }
-    size_t empty_start = 0;
-    size_t empty_end = 0;
-    if (!empty_blocks.empty()) {
-        empty_start = empty_blocks.front()->range().left;
-        empty_end = empty_blocks.back()->range().right;
+    // The missing blocks are fetched with one GET per group of blocks whose gaps are not larger
+    // than file_cache_remote_read_coalesce_max_gap, the data of the blocks in a gap is fetched
+    // again rather than paying for another request.
+    struct RemoteRange {
+        size_t left;
+        size_t right;
+    };
+    std::vector<RemoteRange> remote_ranges;
+    for (auto& block : empty_blocks) {
+        const auto& range = block->range();
+        if (remote_ranges.empty() ||
+            range.left - remote_ranges.back().right - 1 >
+                    static_cast<size_t>(config::file_cache_remote_read_coalesce_max_gap)) {
+            remote_ranges.push_back({.left = range.left, .right = range.right});
+        } else {
+            remote_ranges.back().right = range.right;
+        }
+    }
+    stats.remote_read_requests += remote_ranges.size();
+    stats.coalesced_remote_read_requests += empty_blocks.size() - remote_ranges.size();
+    size_t right_offset = offset + bytes_req - 1;
+    auto block_iter = empty_blocks.begin();
+    for (const auto& remote_range : remote_ranges) {
+        size_t empty_start = remote_range.left;
+        size_t empty_end = remote_range.right;
         size_t size = empty_end - empty_start + 1;
         std::unique_ptr<char[]> buffer(new char[size]);
         {
-            s3_read_counter << 1;
             SCOPED_RAW_TIMER(&stats.remote_read_timer);
-            RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size),
-                                                         &size, io_ctx));
+            if (!_read_from_peer(empty_start, size, buffer.get())) {
+                s3_read_counter << 1;
+                RETURN_IF_ERROR(_remote_file_reader->read_at(
+                        empty_start, Slice(buffer.get(), size), &size, io_ctx));
+            }
         }
-        for (auto& block : empty_blocks) {
+        for (; block_iter != empty_blocks.end() && (*block_iter)->range().right <= empty_end;
+             ++block_iter) {
+            auto& block = *block_iter;
             if (block->state() == FileBlock::State::SKIP_CACHE) {
                 continue;
             }
@@ -240,7 +290,6 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             stats.bytes_write_into_file_cache += block_size;
         }
         // copy from memory directly
-        size_t right_offset = offset + bytes_req - 1;
         if (empty_start <= right_offset && empty_end >= offset) {
             size_t copy_left_offset = offset < empty_start ? empty_start : offset;
             size_t copy_right_offset = right_offset < empty_end ? right_offset : empty_end;
@@ -250,6 +299,15 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             memcpy(dst, src, copy_size);
         }
     }
+    // the ranges are sorted, so are the blocks of the holder
+    auto fetched_range = remote_ranges.begin();
+    auto is_fetched = [&](size_t left, size_t right) {
+        while (fetched_range != remote_ranges.end() && fetched_range->right < left) {
+            ++fetched_range;
+        }
+        return fetched_range != remote_ranges.end() && fetched_range->left <= left &&
+               right <= fetched_range->right;
+    };
 
     size_t current_offset = offset;
     size_t end_offset = offset + bytes_req - 1;
@@ -265,7 +323,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         }
         size_t read_size =
                 end_offset > right ? right - current_offset + 1 : end_offset - current_offset + 1;
-        if (empty_start <= left && right <= empty_end) {
+        if (is_fetched(left, right)) {
             *bytes_read += read_size;
             current_offset = right + 1;
             continue;
@@ -305,6 +363,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
                              << st.msg() << ", block state=" << block_state;
                 size_t bytes_read {0};
                 stats.hit_cache = false;
+                stats.remote_read_requests++;
                 s3_read_counter << 1;
                 SCOPED_RAW_TIMER(&stats.remote_read_timer);
                 RETURN_IF_ERROR(_remote_file_reader->read_at(
@@ -329,6 +388,10 @@ void CachedRemoteFileReader::_update_stats(const ReadStatistics& read_stats,
     if (read_stats.hit_cache) {
         statis->num_local_io_total++;
         statis->bytes_read_from_local += read_stats.bytes_read;
+        auto& tier_io = _cache->get_storage_type() == FileCacheStorageType::MEMORY
+                                ? statis->file_cache_memory_io
+                                : statis->file_cache_disk_io;
+        tier_io.add(read_stats.total_read_timer, read_stats.bytes_read);
     } else {
         if (is_inverted_index) {
             statis->num_inverted_index_remote_io_total++;
@@ -339,6 +402,8 @@ void CachedRemoteFileReader::_update_stats(const ReadStatistics& read_stats,
     statis->remote_io_timer += read_stats.remote_read_timer;
     statis->local_io_timer += read_stats.local_read_timer;
     statis->num_skip_cache_io_total += read_stats.skip_cache;
+    statis->num_remote_read_requests += read_stats.remote_read_requests;
+    statis->num_coalesced_remote_read_requests += read_stats.coalesced_remote_read_requests;
     statis->bytes_write_into_cache += read_stats.bytes_write_into_file_cache;
     statis->write_cache_io_timer += read_stats.local_write_timer;
 
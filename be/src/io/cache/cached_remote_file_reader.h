@@ -60,6 +60,8 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+    // Read the range from the cache of the peer owning the file, see FileCachePeers
+    bool _read_from_peer(size_t offset, size_t size, char* buffer);
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
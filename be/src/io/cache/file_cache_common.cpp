@@ -36,7 +36,8 @@ std::string FileCacheSettings::to_string() const {
        << ", index_queue_elements: " << index_queue_elements
        << ", ttl_queue_size: " << ttl_queue_size << ", ttl_queue_elements: " << ttl_queue_elements
        << ", query_queue_size: " << query_queue_size
-       << ", query_queue_elements: " << query_queue_elements << ", storage: " << storage;
+       << ", query_queue_elements: " << query_queue_elements
+       << ", hot_tier_size: " << hot_tier_size << ", storage: " << storage;
     return ss.str();
 }
 
@@ -69,6 +70,10 @@ FileCacheSettings get_file_cache_settings(size_t capacity, size_t max_query_cach
     settings.query_queue_elements =
             std::max(settings.query_queue_size / settings.max_file_block_size,
                      REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+    if (storage != "memory" && config::file_cache_hot_tier_size > 0) {
+        settings.hot_tier_size =
+                std::min(settings.capacity, static_cast<size_t>(config::file_cache_hot_tier_size));
+    }
     settings.storage = storage;
     return settings;
 }
@@ -55,6 +55,9 @@ struct ReadStatistics {
     bool skip_cache = false;
     int64_t bytes_read = 0;
     int64_t bytes_write_into_file_cache = 0;
+    // GETs sent to the remote storage, and the GETs saved by fetching adjacent blocks together
+    int64_t remote_read_requests = 0;
+    int64_t coalesced_remote_read_requests = 0;
     int64_t remote_read_timer = 0;
     int64_t local_read_timer = 0;
     int64_t local_write_timer = 0;
@@ -63,6 +66,8 @@ struct ReadStatistics {
     int64_t lock_wait_timer = 0;
     int64_t get_timer = 0;
     int64_t set_timer = 0;
+    // the whole read, accounted to the file cache tier when it hits the cache
+    int64_t total_read_timer = 0;
 };
 
 class BlockFileCache;
@@ -113,6 +118,8 @@ struct FileCacheSettings {
     size_t ttl_queue_elements {0};
     size_t max_file_block_size {0};
     size_t max_query_cache_size {0};
+    // bytes of the in memory hot tier in front of the disk storage, 0 means disabled
+    size_t hot_tier_size {0};
     std::string storage;
 
     // to string
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_cache_hot_tier.h"
+
+#include <bvar/bvar.h>
+
+#include <cstring>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+bvar::Adder<uint64_t> g_file_cache_hot_tier_hit_num("file_cache_hot_tier_hit_num");
+bvar::Adder<uint64_t> g_file_cache_hot_tier_miss_num("file_cache_hot_tier_miss_num");
+bvar::Adder<int64_t> g_file_cache_hot_tier_size("file_cache_hot_tier_size");
+
+FileCacheHotTier::FileCacheHotTier(size_t capacity) : _capacity(capacity) {}
+
+FileCacheHotTier::~FileCacheHotTier() {
+    g_file_cache_hot_tier_size << -static_cast<int64_t>(_size);
+}
+
+bool FileCacheHotTier::read(const AccessKeyAndOffset& key, size_t value_offset, Slice buffer,
+                            bool* promote) {
+    *promote = false;
+    std::shared_ptr<char[]> data;
+    {
+        std::lock_guard lock(_mtx);
+        if (auto iter = _hot_blocks.find(key); iter != _hot_blocks.end()) {
+            auto& block = *iter->second;
+            if (value_offset + buffer.size <= block.size) {
+                _hot_list.splice(_hot_list.begin(), _hot_list, iter->second);
+                data = block.data;
+            }
+        } else if (auto ghost = _ghost_blocks.find(key); ghost != _ghost_blocks.end()) {
+            if (++ghost->second->second >= config::file_cache_hot_tier_promote_hits) {
+                _ghost_list.erase(ghost->second);
+                _ghost_blocks.erase(ghost);
+                *promote = true;
+            } else {
+                _ghost_list.splice(_ghost_list.begin(), _ghost_list, ghost->second);
+            }
+        } else if (config::file_cache_hot_tier_promote_hits <= 1) {
+            *promote = true;
+        } else {
+            if (_ghost_list.size() >= MAX_GHOST_BLOCKS) {
+                _ghost_blocks.erase(_ghost_list.back().first);
+                _ghost_list.pop_back();
+            }
+            _ghost_list.emplace_front(key, 1);
+            _ghost_blocks.emplace(key, _ghost_list.begin());
+        }
+    }
+    if (data == nullptr) {
+        g_file_cache_hot_tier_miss_num << 1;
+        return false;
+    }
+    // the block is immutable, copy it without holding the lock
+    memcpy(buffer.data, data.get() + value_offset, buffer.size);
+    g_file_cache_hot_tier_hit_num << 1;
+    return true;
+}
+
+void FileCacheHotTier::insert(const AccessKeyAndOffset& key, std::shared_ptr<char[]> data,
+                              size_t size) {
+    if (size > _capacity) {
+        return;
+    }
+    std::lock_guard lock(_mtx);
+    if (_hot_blocks.contains(key)) {
+        return;
+    }
+    while (_size + size > _capacity) {
+        auto& victim = _hot_list.back();
+        _size -= victim.size;
+        g_file_cache_hot_tier_size << -static_cast<int64_t>(victim.size);
+        _hot_blocks.erase(victim.key);
+        _hot_list.pop_back();
+    }
+    _hot_list.push_front(HotBlock {.key = key, .data = std::move(data), .size = size});
+    _hot_blocks.emplace(key, _hot_list.begin());
+    _size += size;
+    g_file_cache_hot_tier_size << static_cast<int64_t>(size);
+}
+
+void FileCacheHotTier::remove(const AccessKeyAndOffset& key) {
+    std::lock_guard lock(_mtx);
+    if (auto iter = _hot_blocks.find(key); iter != _hot_blocks.end()) {
+        _size -= iter->second->size;
+        g_file_cache_hot_tier_size << -static_cast<int64_t>(iter->second->size);
+        _hot_list.erase(iter->second);
+        _hot_blocks.erase(iter);
+    }
+    if (auto ghost = _ghost_blocks.find(key); ghost != _ghost_blocks.end()) {
+        _ghost_list.erase(ghost->second);
+        _ghost_blocks.erase(ghost);
+    }
+}
+
+void FileCacheHotTier::clear() {
+    std::lock_guard lock(_mtx);
+    g_file_cache_hot_tier_size << -static_cast<int64_t>(_size);
+    _size = 0;
+    _hot_blocks.clear();
+    _hot_list.clear();
+    _ghost_blocks.clear();
+    _ghost_list.clear();
+}
+
+size_t FileCacheHotTier::size() const {
+    std::lock_guard lock(_mtx);
+    return _size;
+}
+
+bool FileCacheHotTier::contains(const AccessKeyAndOffset& key) const {
+    std::lock_guard lock(_mtx);
+    return _hot_blocks.contains(key);
+}
+
+} // namespace doris::io
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "io/cache/file_cache_common.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// A bounded in memory copy of the hottest downloaded blocks of a disk file cache. A block is
+// only promoted after it has been read file_cache_hot_tier_promote_hits times from disk, the
+// read counts of blocks not promoted yet are kept in a bounded ghost list.
+// The contents of a downloaded block never change, so the tier only has to drop a block when
+// the block is removed from the disk cache.
+class FileCacheHotTier {
+public:
+    explicit FileCacheHotTier(size_t capacity);
+    ~FileCacheHotTier();
+
+    // Copy buffer.size bytes at value_offset of the block into buffer and return true if the
+    // block is in the tier. Otherwise count a disk read of the block and set *promote when it
+    // should be copied into the tier now.
+    bool read(const AccessKeyAndOffset& key, size_t value_offset, Slice buffer, bool* promote);
+
+    void insert(const AccessKeyAndOffset& key, std::shared_ptr<char[]> data, size_t size);
+
+    void remove(const AccessKeyAndOffset& key);
+
+    void clear();
+
+    size_t capacity() const { return _capacity; }
+
+    // use for test
+    size_t size() const;
+    bool contains(const AccessKeyAndOffset& key) const;
+
+private:
+    struct HotBlock {
+        AccessKeyAndOffset key;
+        std::shared_ptr<char[]> data;
+        size_t size;
+    };
+
+    static constexpr size_t MAX_GHOST_BLOCKS = 65536;
+
+    const size_t _capacity;
+    size_t _size = 0;
+    std::list<HotBlock> _hot_list;
+    std::unordered_map<AccessKeyAndOffset, std::list<HotBlock>::iterator, KeyAndOffsetHash>
+            _hot_blocks;
+    // read count of the blocks not promoted yet, in LRU order
+    std::list<std::pair<AccessKeyAndOffset, int32_t>> _ghost_list;
+    std::unordered_map<AccessKeyAndOffset, decltype(_ghost_list.begin()), KeyAndOffsetHash>
+            _ghost_blocks;
+    mutable std::mutex _mtx;
+};
+
+} // namespace doris::io
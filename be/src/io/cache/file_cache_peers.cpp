@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "io/cache/file_cache_peers.h"
+
+#include <fmt/format.h>
+
+#include <boost/algorithm/string/trim.hpp>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "common/config.h"
+#include "http/http_client.h"
+#include "io/cache/block_file_cache.h"
+#include "service/backend_options.h"
+#include "util/string_util.h"
+
+namespace doris::io {
+
+FileCachePeers::FileCachePeers(const std::string& peers) {
+    const std::string self =
+            fmt::format("{}:{}", BackendOptions::get_localhost(), config::webserver_port);
+    std::vector<std::string> peer_list = split(peers, ",");
+    for (auto& peer : peer_list) {
+        boost::algorithm::trim(peer);
+        if (peer.empty()) continue;
+        for (int i = 0; i < VIRTUAL_NODES_PER_PEER; ++i) {
+            auto pos = BlockFileCache::hash(fmt::format("{}#{}", peer, i)).value_;
+            // this BE owns a part of the ring too, but it never fetches from itself
+            _ring.emplace(static_cast<uint64_t>(pos), peer == self ? "" : peer);
+        }
+    }
+}
+
+const std::string& FileCachePeers::owner(const UInt128Wrapper& hash) const {
+    static const std::string NO_PEER;
+    if (_ring.empty()) {
+        return NO_PEER;
+    }
+    auto iter = _ring.lower_bound(static_cast<uint64_t>(hash.value_));
+    return iter == _ring.end() ? _ring.begin()->second : iter->second;
+}
+
+std::shared_ptr<const FileCachePeers> FileCachePeers::current() {
+    static std::mutex mutex;
+    static std::string peers;
+    static std::shared_ptr<const FileCachePeers> ring = std::make_shared<FileCachePeers>("");
+    std::lock_guard lock(mutex);
+    if (peers != config::file_cache_peer_backends) {
+        peers = config::file_cache_peer_backends;
+        ring = std::make_shared<FileCachePeers>(peers);
+    }
+    return ring;
+}
+
+Status FileCachePeers::fetch(const std::string& peer, const std::string& file_name, size_t offset,
+                             size_t size, char* buffer) {
+    HttpClient client;
+    RETURN_IF_ERROR(client.init(fmt::format(
+            "http://{}/api/file_cache?op=read&value={}&offset={}&size={}", peer, file_name,
+            offset, size)));
+    client.set_timeout_ms(config::file_cache_peer_fetch_timeout_ms);
+    std::string data;
+    RETURN_IF_ERROR(client.execute(&data));
+    if (data.size() != size) {
+        return Status::InternalError("peer {} returned {} bytes of {}, expected {}", peer,
+                                     data.size(), file_name, size);
+    }
+    memcpy(buffer, data.data(), size);
+    return Status::OK();
+}
+
+} // namespace doris::io
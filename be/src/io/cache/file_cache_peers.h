@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "common/status.h"
+#include "io/cache/file_cache_common.h"
+
+namespace doris::io {
+
+// A consistent hash ring of the peer BEs configured by file_cache_peer_backends. Every cached
+// file is owned by one peer, a block missing in the local cache is fetched from the cache of
+// the owner before it is read from the remote storage. Adding or removing a peer only moves
+// the files owned by it, so the caches of the other peers stay useful after scaling.
+class FileCachePeers {
+public:
+    // peers: comma separated "host:http_port" of the peer BEs, may include this BE itself
+    explicit FileCachePeers(const std::string& peers);
+
+    // Get "host:http_port" of the peer owning the file, empty if there is no peer
+    const std::string& owner(const UInt128Wrapper& hash) const;
+
+    bool empty() const { return _ring.empty(); }
+
+    // Get the ring of the current file_cache_peer_backends, it is rebuilt after the config
+    // is modified
+    static std::shared_ptr<const FileCachePeers> current();
+
+    // Read `size` bytes at `offset` of the file from the cache of `peer`, fails if the peer
+    // does not cache the whole range
+    static Status fetch(const std::string& peer, const std::string& file_name, size_t offset,
+                        size_t size, char* buffer);
+
+private:
+    static constexpr int VIRTUAL_NODES_PER_PEER = 64;
+
+    // position on the ring -> peer
+    std::map<uint64_t, std::string> _ring;
+};
+
+} // namespace doris::io
@@ -98,6 +98,12 @@ size_t FDCache::file_reader_cache_size() {
     return _file_reader_list.size();
 }
 
+FSFileCacheStorage::FSFileCacheStorage(size_t hot_tier_size) {
+    if (hot_tier_size > 0) {
+        _hot_tier = std::make_unique<FileCacheHotTier>(hot_tier_size);
+    }
+}
+
 Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
     _cache_base_path = _mgr->_cache_base_path;
     RETURN_IF_ERROR(upgrade_cache_dir_if_necessary());
@@ -154,6 +160,13 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
 
 Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
     AccessKeyAndOffset fd_key = std::make_pair(key.hash, key.offset);
+    bool promote = false;
+    if (_hot_tier != nullptr &&
+        (key.meta.type == FileCacheType::INDEX || !config::file_cache_hot_tier_index_only)) {
+        if (_hot_tier->read(fd_key, value_offset, buffer, &promote)) {
+            return Status::OK();
+        }
+    }
     FileReaderSPtr file_reader = FDCache::instance()->get_file_reader(fd_key);
     if (!file_reader) {
         std::string file =
@@ -183,6 +196,9 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
 
         FDCache::instance()->insert_file_reader(fd_key, file_reader);
     }
+    if (promote) {
+        return promote_to_hot_tier(fd_key, file_reader, value_offset, buffer);
+    }
     size_t bytes_read = 0;
     auto s = file_reader->read_at(value_offset, buffer, &bytes_read);
     if (!s.ok()) {
@@ -194,10 +210,37 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
     return Status::OK();
 }
 
+Status FSFileCacheStorage::promote_to_hot_tier(const AccessKeyAndOffset& key,
+                                               const FileReaderSPtr& file_reader,
+                                               size_t value_offset, Slice buffer) {
+    size_t block_size = file_reader->size();
+    if (block_size > _hot_tier->capacity() || value_offset + buffer.size > block_size) {
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(file_reader->read_at(value_offset, buffer, &bytes_read));
+        DCHECK(bytes_read == buffer.get_size());
+        return Status::OK();
+    }
+    std::shared_ptr<char[]> data(new char[block_size]);
+    size_t bytes_read = 0;
+    auto s = file_reader->read_at(0, Slice(data.get(), block_size), &bytes_read);
+    if (!s.ok()) {
+        LOG(WARNING) << "read file failed, file=" << file_reader->path()
+                     << ", error=" << s.to_string();
+        return s;
+    }
+    DCHECK(bytes_read == block_size);
+    memcpy(buffer.data, data.get() + value_offset, buffer.size);
+    _hot_tier->insert(key, std::move(data), block_size);
+    return Status::OK();
+}
+
 Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
     FDCache::instance()->remove_file_reader(std::make_pair(key.hash, key.offset));
+    if (_hot_tier != nullptr) {
+        _hot_tier->remove(std::make_pair(key.hash, key.offset));
+    }
     RETURN_IF_ERROR(fs->delete_file(file));
     // return OK not means the file is deleted, it may be not exist
     // So for TTL, we make sure the old format will be removed well
@@ -657,6 +700,9 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
 }
 
 Status FSFileCacheStorage::clear(std::string& msg) {
+    if (_hot_tier != nullptr) {
+        _hot_tier->clear();
+    }
     std::stringstream ss;
     auto st = global_local_filesystem()->delete_directory(_cache_base_path);
     if (!st.ok()) {
@@ -22,6 +22,7 @@
 #include <thread>
 
 #include "io/cache/file_cache_common.h"
+#include "io/cache/file_cache_hot_tier.h"
 #include "io/cache/file_cache_storage.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
@@ -59,6 +60,9 @@ public:
     static constexpr int KEY_PREFIX_LENGTH = 3;
 
     FSFileCacheStorage() = default;
+    // the downloaded blocks are also kept in a memory tier of hot_tier_size bytes when it is
+    // larger than 0
+    explicit FSFileCacheStorage(size_t hot_tier_size);
     ~FSFileCacheStorage() override;
     Status init(BlockFileCache* _mgr) override;
     Status append(const FileCacheKey& key, const Slice& value) override;
@@ -86,6 +90,9 @@ public:
 
     FileCacheStorageType get_type() override { return DISK; }
 
+    // use for test
+    FileCacheHotTier* hot_tier() const { return _hot_tier.get(); }
+
 private:
     Status upgrade_cache_dir_if_necessary() const;
 
@@ -105,12 +112,17 @@ private:
     [[nodiscard]] std::vector<std::string> get_path_in_local_cache_all_candidates(
             const std::string& dir, size_t offset);
 
+    // read the whole block into the hot tier and copy the wanted range into buffer
+    Status promote_to_hot_tier(const AccessKeyAndOffset& key, const FileReaderSPtr& file_reader,
+                               size_t value_offset, Slice buffer);
+
     std::string _cache_base_path;
     std::thread _cache_background_load_thread;
     const std::shared_ptr<LocalFileSystem>& fs = global_local_filesystem();
     // TODO(Lchangliang): use a more efficient data structure
     std::mutex _mtx;
     std::unordered_map<FileWriterMapKey, FileWriterPtr, FileWriterMapKeyHash> _key_to_writer;
+    std::unique_ptr<FileCacheHotTier> _hot_tier;
 };
 
 } // namespace doris::io
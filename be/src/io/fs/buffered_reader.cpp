@@ -29,6 +29,7 @@
 #include "common/config.h"
 #include "common/status.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/runtime_profile.h"
@@ -409,6 +410,11 @@ void PrefetchBuffer::reset_offset(size_t offset) {
         }
         _buffer_status = BufferStatus::RESET;
         _offset = offset;
+        _released = false;
+        _stalled = false;
+        if (_buf == nullptr && offset < _file_range.end_offset) {
+            _buf.reset(new char[_size]);
+        }
         _prefetched.notify_all();
     }
     if (UNLIKELY(offset >= _file_range.end_offset)) {
@@ -440,6 +446,13 @@ void PrefetchBuffer::prefetch_buffer() {
             _prefetched.notify_all();
             return;
         }
+        // in case buffer is released before this task runs
+        if (UNLIKELY(_buf == nullptr)) {
+            _len = 0;
+            _buffer_status = BufferStatus::PREFETCHED;
+            _prefetched.notify_all();
+            return;
+        }
         _buffer_status = BufferStatus::PENDING;
         _prefetched.notify_all();
     }
@@ -551,7 +564,7 @@ Status PrefetchBuffer::read_buffer(size_t off, const char* out, size_t buf_len,
         // Reader can read out of [start_offset, end_offset) by synchronous method.
         return _reader->read_at(off, Slice {out, buf_len}, bytes_read, _io_ctx);
     }
-    if (_exceed) {
+    if (_exceed || _released) {
         reset_offset((off / _size) * _size);
         return read_buffer(off, out, buf_len, bytes_read);
     }
@@ -561,6 +574,9 @@ Status PrefetchBuffer::read_buffer(size_t off, const char* out, size_t buf_len,
     constexpr auto read_time_baseline = std::chrono::seconds(s_max_pre_buffer_size / 1024 / 1024);
     {
         std::unique_lock lck {_lock};
+        if (_buffer_status != BufferStatus::PREFETCHED) {
+            _stalled = true;
+        }
         // buffer must be prefetched or it's closed
         if (!_prefetched.wait_for(
                     lck, std::chrono::milliseconds(config::buffered_reader_read_timeout_ms),
@@ -603,9 +619,6 @@ Status PrefetchBuffer::read_buffer(size_t off, const char* out, size_t buf_len,
         _statis.request_io += 1;
         _statis.request_bytes += read_len;
     }
-    if (off + *bytes_read == _offset + _len) {
-        reset_offset(_offset + _whole_buffer_size);
-    }
     return Status::OK();
 }
 
@@ -622,6 +635,22 @@ void PrefetchBuffer::close() {
     _prefetched.notify_all();
 }
 
+void PrefetchBuffer::release() {
+    std::unique_lock lck {_lock};
+    if (!_prefetched.wait_for(lck,
+                              std::chrono::milliseconds(config::buffered_reader_read_timeout_ms),
+                              [this]() { return _buffer_status != BufferStatus::PENDING; })) {
+        _prefetch_status = Status::TimedOut("time out when release prefetch buffer");
+        return;
+    }
+    if (_buffer_status == BufferStatus::CLOSED) {
+        return;
+    }
+    _buf.reset();
+    _len = 0;
+    _released = true;
+}
+
 void PrefetchBuffer::_collect_profile_before_close() {
     if (_sync_profile != nullptr) {
         _sync_profile(*this);
@@ -637,9 +666,12 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
         buffer_size = config::remote_storage_read_buffer_mb * 1024 * 1024;
     }
     _size = _reader->size();
-    _whole_pre_buffer_size = buffer_size;
     _file_range.end_offset = std::min(_file_range.end_offset, _size);
-    int buffer_num = buffer_size > s_max_pre_buffer_size ? buffer_size / s_max_pre_buffer_size : 1;
+    _window = buffer_size > s_max_pre_buffer_size ? buffer_size / s_max_pre_buffer_size : 1;
+    int64_t max_buffer_size = std::max<int64_t>(
+            buffer_size, config::remote_storage_read_buffer_max_mb * 1024L * 1024L);
+    int buffer_num = std::max<int64_t>(_window, max_buffer_size / s_max_pre_buffer_size);
+    _whole_pre_buffer_size = buffer_num * s_max_pre_buffer_size;
     std::function<void(PrefetchBuffer&)> sync_buffer = nullptr;
     if (profile != nullptr) {
         const char* prefetch_buffered_reader = "PrefetchBufferedReader";
@@ -654,6 +686,10 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
                 ADD_CHILD_COUNTER(profile, "RequestIO", TUnit::UNIT, prefetch_buffered_reader);
         auto request_bytes =
                 ADD_CHILD_COUNTER(profile, "RequestBytes", TUnit::BYTES, prefetch_buffered_reader);
+        _window_grow_counter =
+                ADD_CHILD_COUNTER(profile, "WindowGrowNum", TUnit::UNIT, prefetch_buffered_reader);
+        _window_shrink_counter = ADD_CHILD_COUNTER(profile, "WindowShrinkNum", TUnit::UNIT,
+                                                   prefetch_buffered_reader);
         sync_buffer = [=](PrefetchBuffer& buf) {
             COUNTER_UPDATE(copy_time, buf._statis.copy_time);
             COUNTER_UPDATE(read_time, buf._statis.read_time);
@@ -667,8 +703,7 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
     // to make sure the buffer reader will start to read at right position.
     for (int i = 0; i < buffer_num; i++) {
         _pre_buffers.emplace_back(std::make_shared<PrefetchBuffer>(
-                _file_range, s_max_pre_buffer_size, _whole_pre_buffer_size, _reader.get(), _io_ctx,
-                sync_buffer));
+                _file_range, s_max_pre_buffer_size, _reader.get(), _io_ctx, sync_buffer));
     }
 }
 
@@ -682,6 +717,8 @@ Status PrefetchBufferedReader::read_at_impl(size_t offset, Slice result, size_t*
     if (!_initialized) {
         reset_all_buffer(offset);
         _initialized = true;
+    } else if (offset < _last_read_end || offset > _last_read_end + s_max_pre_buffer_size) {
+        _seeked = true;
     }
     if (UNLIKELY(result.get_size() == 0 || offset >= size())) {
         *bytes_read = 0;
@@ -691,17 +728,52 @@ Status PrefetchBufferedReader::read_at_impl(size_t offset, Slice result, size_t*
     int actual_bytes_read = 0;
     while (actual_bytes_read < nbytes && offset < size()) {
         size_t read_num = 0;
-        auto buffer_pos = get_buffer_pos(offset);
-        RETURN_IF_ERROR(
-                _pre_buffers[buffer_pos]->read_buffer(offset, result.get_data() + actual_bytes_read,
-                                                      nbytes - actual_bytes_read, &read_num));
+        auto& buffer = _pre_buffers[get_buffer_pos(offset)];
+        RETURN_IF_ERROR(buffer->read_buffer(offset, result.get_data() + actual_bytes_read,
+                                            nbytes - actual_bytes_read, &read_num));
         actual_bytes_read += read_num;
         offset += read_num;
+        if (read_num > 0 && buffer->drained(offset)) {
+            _adjust_window(buffer->_stalled);
+            _prefetch_window(offset);
+        }
     }
+    _last_read_end = offset;
     *bytes_read = actual_bytes_read;
     return Status::OK();
 }
 
+void PrefetchBufferedReader::_adjust_window(bool stalled) {
+    int64_t max_window = _pre_buffers.size();
+    if (_seeked || GlobalMemoryArbitrator::is_exceed_soft_mem_limit()) {
+        if (_window > 1) {
+            _window = std::max<int64_t>(1, _window / 2);
+            ++_window_shrink_num;
+        }
+    } else if (stalled && _window < max_window) {
+        ++_window;
+        ++_window_grow_num;
+    }
+    _seeked = false;
+}
+
+void PrefetchBufferedReader::_prefetch_window(size_t position) {
+    size_t start = get_buffer_offset(position);
+    for (int64_t i = 0; i < _pre_buffers.size(); i++) {
+        size_t cur_offset = start + i * s_max_pre_buffer_size;
+        auto& buffer = _pre_buffers[get_buffer_pos(cur_offset)];
+        if (i >= _window) {
+            // free the memory of the buffers out of the window
+            if (!buffer->_released) {
+                buffer->release();
+            }
+        } else if (buffer->_offset != cur_offset || buffer->_released) {
+            // reset would do all the prefetch work
+            buffer->reset_offset(cur_offset);
+        }
+    }
+}
+
 Status PrefetchBufferedReader::close() {
     return _close_internal();
 }
@@ -718,6 +790,10 @@ Status PrefetchBufferedReader::_close_internal() {
 }
 
 void PrefetchBufferedReader::_collect_profile_before_close() {
+    if (_window_grow_counter != nullptr) {
+        COUNTER_UPDATE(_window_grow_counter, _window_grow_num);
+        COUNTER_UPDATE(_window_shrink_counter, _window_shrink_num);
+    }
     std::for_each(_pre_buffers.begin(), _pre_buffers.end(),
                   [](std::shared_ptr<PrefetchBuffer>& buffer) {
                       buffer->collect_profile_before_close();
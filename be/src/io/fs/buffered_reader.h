@@ -413,15 +413,12 @@ class PrefetchBufferedReader;
 struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public ProfileCollector {
     enum class BufferStatus { RESET, PENDING, PREFETCHED, CLOSED };
 
-    PrefetchBuffer(const PrefetchRange file_range, size_t buffer_size, size_t whole_buffer_size,
-                   io::FileReader* reader, const IOContext* io_ctx,
-                   std::function<void(PrefetchBuffer&)> sync_profile)
+    PrefetchBuffer(const PrefetchRange file_range, size_t buffer_size, io::FileReader* reader,
+                   const IOContext* io_ctx, std::function<void(PrefetchBuffer&)> sync_profile)
             : _file_range(file_range),
               _size(buffer_size),
-              _whole_buffer_size(whole_buffer_size),
               _reader(reader),
               _io_ctx(io_ctx),
-              _buf(new char[buffer_size]),
               _sync_profile(std::move(sync_profile)) {}
 
     PrefetchBuffer(PrefetchBuffer&& other)
@@ -429,7 +426,6 @@ struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public Pro
               _file_range(other._file_range),
               _random_access_ranges(other._random_access_ranges),
               _size(other._size),
-              _whole_buffer_size(other._whole_buffer_size),
               _reader(other._reader),
               _io_ctx(other._io_ctx),
               _buf(std::move(other._buf)),
@@ -445,10 +441,14 @@ struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public Pro
     const std::vector<PrefetchRange>* _random_access_ranges = nullptr;
     size_t _size {0};
     size_t _len {0};
-    size_t _whole_buffer_size;
     io::FileReader* _reader = nullptr;
     const IOContext* _io_ctx = nullptr;
+    // allocated when the buffer starts prefetching and freed when it is released
     std::unique_ptr<char[]> _buf;
+    // the buffer holds no data, it has not been prefetched yet or is out of the prefetch window
+    bool _released = true;
+    // the reader had to wait for the prefetched data of the current offset
+    bool _stalled = false;
     BufferStatus _buffer_status {BufferStatus::RESET};
     std::mutex _lock;
     std::condition_variable _prefetched;
@@ -478,6 +478,11 @@ struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public Pro
     Status read_buffer(size_t off, const char* buf, size_t buf_len, size_t* bytes_read);
     // @brief: shut down the buffer until the prior prefetching task is done
     void close();
+    // @brief: free the memory of a buffer which is not in the prefetch window any more, it would
+    // be prefetched again if the reader reads it later
+    void release();
+    // @brief: whether the reader has consumed all the prefetched data when it reaches off
+    bool inline drained(size_t off) const { return _len > 0 && off == _offset + _len; }
     // @brief: to detect whether this buffer contains off
     // @param[off] detect offset
     bool inline contains(size_t off) const { return _offset <= off && off < _offset + _size; }
@@ -505,9 +510,14 @@ constexpr int64_t s_max_pre_buffer_size = 4 * 1024 * 1024; // 4MB
  * random_access_ranges are the column ranges in format, like orc and parquet.
  *
  * When random_access_ranges is empty:
- * The data is prefetched sequentially until the underlying buffers(4 * 4M as default) are full.
- * When a buffer is read out, it will fetch data backward in daemon, so the underlying reader should be
- * thread-safe, and the access mode of data needs to be sequential.
+ * The data is prefetched sequentially until the buffers in the prefetch window(4 * 4M as default)
+ * are full. When a buffer is read out, the buffer at the end of the window will fetch data
+ * backward in daemon, so the underlying reader should be thread-safe, and the access mode of data
+ * needs to be sequential.
+ *
+ * The prefetch window is adaptive. It grows by one buffer when the reader has to wait for a buffer
+ * to be prefetched, up to remote_storage_read_buffer_max_mb, and is halved when the reader seeks
+ * or the process exceeds the soft memory limit. Buffers out of the window are freed.
  *
  * When random_access_ranges is not empty:
  * The data is prefetched order by the random_access_ranges. If some adjacent ranges is small, the underlying reader
@@ -550,13 +560,18 @@ private:
         return (position / s_max_pre_buffer_size) * s_max_pre_buffer_size;
     }
     void reset_all_buffer(size_t position) {
-        for (int64_t i = 0; i < _pre_buffers.size(); i++) {
+        for (int64_t i = 0; i < _window; i++) {
             int64_t cur_pos = position + i * s_max_pre_buffer_size;
             int cur_buf_pos = get_buffer_pos(cur_pos);
             // reset would do all the prefetch work
             _pre_buffers[cur_buf_pos]->reset_offset(get_buffer_offset(cur_pos));
         }
     }
+    // Resize the prefetch window after a buffer is read out, stalled means the reader had to
+    // wait for the buffer to be prefetched
+    void _adjust_window(bool stalled);
+    // Make sure the buffers of the window starting at position are prefetching
+    void _prefetch_window(size_t position);
 
     io::FileReaderSPtr _reader;
     PrefetchRange _file_range;
@@ -564,6 +579,14 @@ private:
     const IOContext* _io_ctx = nullptr;
     std::vector<std::shared_ptr<PrefetchBuffer>> _pre_buffers;
     int64_t _whole_pre_buffer_size;
+    // number of buffers prefetching ahead of the reader, in [1, _pre_buffers.size()]
+    int64_t _window;
+    size_t _last_read_end = 0;
+    bool _seeked = false;
+    int64_t _window_grow_num = 0;
+    int64_t _window_shrink_num = 0;
+    RuntimeProfile::Counter* _window_grow_counter = nullptr;
+    RuntimeProfile::Counter* _window_shrink_counter = nullptr;
     bool _initialized = false;
     bool _closed = false;
     size_t _size;
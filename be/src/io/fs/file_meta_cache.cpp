@@ -17,10 +17,29 @@
 
 #include "io/fs/file_meta_cache.h"
 
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "common/logging.h"
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
 
 namespace doris {
 
+void FileMetaCache::init() {
+    if (config::persistent_meta_cache_path.empty()) {
+        return;
+    }
+    auto cache = std::make_unique<PersistentMetaCache>(config::persistent_meta_cache_path,
+                                                       config::persistent_meta_cache_capacity);
+    Status st = cache->init();
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to open persistent meta cache "
+                     << config::persistent_meta_cache_path << ": " << st;
+        return;
+    }
+    _persistent_cache = std::move(cache);
+}
+
 Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
                                          int64_t mtime, size_t* meta_size,
                                          ObjLRUCache::CacheHandle* handle) {
@@ -32,7 +51,38 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
         *meta_size = 0;
     } else {
         vectorized::FileMetaData* meta = nullptr;
-        RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
+        std::string persistent_key;
+        std::string raw_metadata;
+        if (_persistent_cache != nullptr) {
+            persistent_key = fmt::format("parquet:{}:{}:{}", file_reader->path().native(),
+                                         file_reader->size(), mtime);
+            if (_persistent_cache->lookup(persistent_key, &raw_metadata)) {
+                uint32_t metadata_size = raw_metadata.size();
+                Status st = vectorized::parse_thrift_footer_buffer(
+                        (const uint8_t*)raw_metadata.data(), &metadata_size, &meta);
+                if (st.ok()) {
+                    *meta_size = 0;
+                    _cache.insert({cache_key}, meta, handle);
+                    return Status::OK();
+                }
+                delete meta;
+                meta = nullptr;
+                _persistent_cache->remove(persistent_key);
+            }
+        }
+        Status st = vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx,
+                                                    _persistent_cache ? &raw_metadata : nullptr);
+        if (!st.ok()) {
+            delete meta;
+            return st;
+        }
+        if (_persistent_cache != nullptr) {
+            st = _persistent_cache->insert(persistent_key, raw_metadata);
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to persist parquet footer of "
+                             << file_reader->path().native() << ": " << st;
+            }
+        }
         _cache.insert({cache_key}, meta, handle);
     }
 
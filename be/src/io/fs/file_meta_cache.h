@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <memory>
+
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/fs/persistent_meta_cache.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
@@ -29,11 +32,18 @@ class FileMetaCache {
 public:
     FileMetaCache(int64_t capacity) : _cache(capacity) {}
 
+    // Open the on disk cache at config::persistent_meta_cache_path if it is set. The cache is
+    // optional, so it is only disabled with a warning if it can not be opened.
+    void init();
+
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
 
     ObjLRUCache& cache() { return _cache; }
 
+    // Return nullptr if the on disk cache is disabled
+    PersistentMetaCache* persistent_cache() { return _persistent_cache.get(); }
+
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
@@ -44,6 +54,7 @@ public:
 
 private:
     ObjLRUCache _cache;
+    std::unique_ptr<PersistentMetaCache> _persistent_cache;
 };
 
 } // namespace doris
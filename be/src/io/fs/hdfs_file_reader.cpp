@@ -43,6 +43,9 @@ bvar::LatencyRecorder hdfs_bytes_per_read("hdfs_file_reader", "bytes_per_read");
 bvar::PerSecond<bvar::Adder<uint64_t>> hdfs_read_througthput("hdfs_file_reader",
                                                              "hdfs_read_throughput",
                                                              &hdfs_bytes_read_total);
+bvar::Adder<uint64_t> hdfs_local_bytes_read_total("hdfs_file_reader", "local_bytes_read");
+bvar::Adder<uint64_t> hdfs_short_circuit_bytes_read_total("hdfs_file_reader",
+                                                          "short_circuit_bytes_read");
 
 namespace {
 
@@ -87,6 +90,8 @@ HdfsFileReader::HdfsFileReader(Path path, std::string fs_name, FileHandleCache::
                 ADD_CHILD_COUNTER(_profile, "TotalBytesRead", TUnit::BYTES, hdfs_profile_name);
         _hdfs_profile.total_local_bytes_read =
                 ADD_CHILD_COUNTER(_profile, "TotalLocalBytesRead", TUnit::BYTES, hdfs_profile_name);
+        _hdfs_profile.total_remote_bytes_read = ADD_CHILD_COUNTER(_profile, "TotalRemoteBytesRead",
+                                                                  TUnit::BYTES, hdfs_profile_name);
         _hdfs_profile.total_short_circuit_bytes_read = ADD_CHILD_COUNTER(
                 _profile, "TotalShortCircuitBytesRead", TUnit::BYTES, hdfs_profile_name);
         _hdfs_profile.total_total_zero_copy_bytes_read = ADD_CHILD_COUNTER(
@@ -241,6 +246,10 @@ void HdfsFileReader::_collect_profile_before_close() {
         }
         COUNTER_UPDATE(_hdfs_profile.total_bytes_read, hdfs_statistics->totalBytesRead);
         COUNTER_UPDATE(_hdfs_profile.total_local_bytes_read, hdfs_statistics->totalLocalBytesRead);
+        COUNTER_UPDATE(_hdfs_profile.total_remote_bytes_read,
+                       hdfs_statistics->totalBytesRead - hdfs_statistics->totalLocalBytesRead);
+        hdfs_local_bytes_read_total << hdfs_statistics->totalLocalBytesRead;
+        hdfs_short_circuit_bytes_read_total << hdfs_statistics->totalShortCircuitBytesRead;
         COUNTER_UPDATE(_hdfs_profile.total_short_circuit_bytes_read,
                        hdfs_statistics->totalShortCircuitBytesRead);
         COUNTER_UPDATE(_hdfs_profile.total_total_zero_copy_bytes_read,
@@ -68,6 +68,7 @@ private:
     struct HDFSProfile {
         RuntimeProfile::Counter* total_bytes_read = nullptr;
         RuntimeProfile::Counter* total_local_bytes_read = nullptr;
+        RuntimeProfile::Counter* total_remote_bytes_read = nullptr;
         RuntimeProfile::Counter* total_short_circuit_bytes_read = nullptr;
         RuntimeProfile::Counter* total_total_zero_copy_bytes_read = nullptr;
 
@@ -0,0 +1,246 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/io_uring.h"
+
+#include <bvar/bvar.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/config.h"
+#include "io/fs/err_utils.h"
+#include "util/stopwatch.hpp"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#define DORIS_HAS_IO_URING 1
+#endif
+
+namespace doris::io {
+
+bvar::LatencyRecorder g_io_uring_read_latency("local_file_io_uring_read_latency");
+bvar::IntRecorder g_io_uring_queue_depth("local_file_io_uring_queue_depth");
+
+#ifdef DORIS_HAS_IO_URING
+
+IoUring::~IoUring() {
+    if (_sqes != nullptr) {
+        munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ring != nullptr && _cq_ring != _sq_ring) {
+        munmap(_cq_ring, _cq_ring_size);
+    }
+    if (_sq_ring != nullptr) {
+        munmap(_sq_ring, _sq_ring_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+IoUring* IoUring::thread_local_ring() {
+    static thread_local std::unique_ptr<IoUring> ring;
+    static thread_local bool initialized = false;
+    if (!initialized) {
+        initialized = true;
+        std::unique_ptr<IoUring> new_ring(new IoUring());
+        auto st = new_ring->_init(static_cast<uint32_t>(
+                std::max(1, config::local_file_io_uring_queue_depth)));
+        if (st.ok()) {
+            ring = std::move(new_ring);
+        } else {
+            LOG_EVERY_N(WARNING, 100) << "failed to set up io_uring, fall back to pread: " << st;
+        }
+    }
+    return ring.get();
+}
+
+Status IoUring::_init(uint32_t entries) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+        return localfs_error(errno, "io_uring_setup");
+    }
+    _ring_fd = fd;
+    _entries = params.sq_entries;
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    _cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_ring_size = _cq_ring_size = std::max(_sq_ring_size, _cq_ring_size);
+    }
+    _sq_ring = mmap(nullptr, _sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    _ring_fd, IORING_OFF_SQ_RING);
+    if (_sq_ring == MAP_FAILED) {
+        _sq_ring = nullptr;
+        return localfs_error(errno, "mmap io_uring submission queue");
+    }
+    if (single_mmap) {
+        _cq_ring = _sq_ring;
+    } else {
+        _cq_ring = mmap(nullptr, _cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                        _ring_fd, IORING_OFF_CQ_RING);
+        if (_cq_ring == MAP_FAILED) {
+            _cq_ring = nullptr;
+            return localfs_error(errno, "mmap io_uring completion queue");
+        }
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    _sqes = mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 _ring_fd, IORING_OFF_SQES);
+    if (_sqes == MAP_FAILED) {
+        _sqes = nullptr;
+        return localfs_error(errno, "mmap io_uring submission entries");
+    }
+
+    auto* sq = static_cast<char*>(_sq_ring);
+    _sq_head = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    _sq_mask = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ring);
+    _cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    _cq_mask = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    _cqes = cq + params.cq_off.cqes;
+    return Status::OK();
+}
+
+Status IoUring::_enter(uint32_t min_complete) {
+    while (true) {
+        // the kernel advances the submission head once it consumed the entries
+        uint32_t to_submit = *_sq_tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE);
+        long ret = syscall(__NR_io_uring_enter, _ring_fd, to_submit, min_complete,
+                           IORING_ENTER_GETEVENTS, nullptr, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return localfs_error(errno, "io_uring_enter");
+        }
+        if (static_cast<uint32_t>(ret) >= to_submit) {
+            return Status::OK();
+        }
+    }
+}
+
+Status IoUring::read_ranges(int fd, IoUringReadRange* ranges, size_t count) {
+    MonotonicStopWatch watch;
+    watch.start();
+    std::vector<size_t> bytes_read(count, 0);
+    std::vector<size_t> resubmit;
+    size_t next = 0;
+    size_t in_flight = 0;
+    size_t completed = 0;
+    Status status;
+    auto* sqes = static_cast<io_uring_sqe*>(_sqes);
+    auto* cqes = static_cast<io_uring_cqe*>(_cqes);
+    while (completed < count) {
+        // stop submitting after an error, but wait for the reads in flight since they write
+        // into the caller's buffers
+        while (status.ok() && in_flight < _entries && (!resubmit.empty() || next < count)) {
+            size_t i = next;
+            if (!resubmit.empty()) {
+                i = resubmit.back();
+                resubmit.pop_back();
+            } else {
+                ++next;
+            }
+            uint32_t tail = *_sq_tail;
+            uint32_t index = tail & _sq_mask;
+            io_uring_sqe* sqe = &sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = fd;
+            sqe->addr = reinterpret_cast<uint64_t>(ranges[i].buf + bytes_read[i]);
+            sqe->len = static_cast<uint32_t>(ranges[i].len - bytes_read[i]);
+            sqe->off = ranges[i].offset + bytes_read[i];
+            sqe->user_data = i;
+            _sq_array[index] = index;
+            __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+            ++in_flight;
+        }
+        if (in_flight == 0) {
+            break;
+        }
+        g_io_uring_queue_depth << in_flight;
+        RETURN_IF_ERROR(_enter(1));
+
+        uint32_t head = *_cq_head;
+        uint32_t tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; ++head) {
+            const io_uring_cqe& cqe = cqes[head & _cq_mask];
+            auto i = static_cast<size_t>(cqe.user_data);
+            --in_flight;
+            if (cqe.res < 0) {
+                if (-cqe.res == EINTR || -cqe.res == EAGAIN) {
+                    resubmit.push_back(i);
+                } else if (status.ok()) {
+                    status = localfs_error(-cqe.res, "io_uring read");
+                }
+            } else if (cqe.res == 0) {
+                if (status.ok()) {
+                    status = Status::InternalError("io_uring read: unexpected EOF");
+                }
+            } else {
+                bytes_read[i] += cqe.res;
+                if (bytes_read[i] < ranges[i].len) {
+                    resubmit.push_back(i);
+                } else {
+                    ++completed;
+                }
+            }
+        }
+        __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+    }
+    g_io_uring_read_latency << watch.elapsed_time() / 1000;
+    return status;
+}
+
+#else
+
+IoUring::~IoUring() = default;
+
+IoUring* IoUring::thread_local_ring() {
+    return nullptr;
+}
+
+Status IoUring::_init(uint32_t entries) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status IoUring::_enter(uint32_t min_complete) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status IoUring::read_ranges(int fd, IoUringReadRange* ranges, size_t count) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+#endif
+
+} // namespace doris::io
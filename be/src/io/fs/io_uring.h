@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common/status.h"
+
+namespace doris::io {
+
+struct IoUringReadRange {
+    size_t offset;
+    char* buf;
+    size_t len;
+};
+
+// A minimal io_uring instance driven by the raw system calls, liburing is not a dependency.
+// It submits all reads of one request together so that a single caller keeps several reads in
+// flight on the device. It is not thread safe, callers use the ring of their own thread.
+class IoUring {
+public:
+    ~IoUring();
+
+    // Returns the io_uring of the calling thread, created on first use, or nullptr if io_uring
+    // is not supported by the kernel or failed to be set up.
+    static IoUring* thread_local_ring();
+
+    // Reads every range of `fd` completely, at most queue depth reads are in flight at a time.
+    // Short reads are resubmitted, reading past the end of file is an error.
+    Status read_ranges(int fd, IoUringReadRange* ranges, size_t count);
+
+private:
+    IoUring() = default;
+
+    Status _init(uint32_t entries);
+    // Submits all queued entries and waits for at least `min_complete` completions.
+    Status _enter(uint32_t min_complete);
+
+    int _ring_fd = -1;
+    uint32_t _entries = 0;
+
+    void* _sq_ring = nullptr;
+    size_t _sq_ring_size = 0;
+    void* _cq_ring = nullptr;
+    size_t _cq_ring_size = 0;
+    void* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t* _sq_head = nullptr;
+    uint32_t* _sq_tail = nullptr;
+    uint32_t _sq_mask = 0;
+    uint32_t* _sq_array = nullptr;
+    uint32_t* _cq_head = nullptr;
+    uint32_t* _cq_tail = nullptr;
+    uint32_t _cq_mask = 0;
+    void* _cqes = nullptr;
+};
+
+} // namespace doris::io
@@ -30,10 +30,13 @@
 #include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/io_uring.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/options.h"
@@ -144,6 +147,28 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
 
+    if (config::enable_local_file_io_uring && bytes_req > config::local_file_io_uring_chunk_size &&
+        config::local_file_io_uring_chunk_size > 0) {
+        if (IoUring* ring = IoUring::thread_local_ring(); ring != nullptr) {
+            // split a large read into chunks read concurrently
+            std::vector<IoUringReadRange> ranges;
+            auto chunk_size = static_cast<size_t>(config::local_file_io_uring_chunk_size);
+            for (size_t pos = 0; pos < bytes_req; pos += chunk_size) {
+                ranges.push_back({.offset = offset + pos,
+                                  .buf = to + pos,
+                                  .len = std::min(chunk_size, bytes_req - pos)});
+            }
+            auto st = ring->read_ranges(_fd, ranges.data(), ranges.size());
+            if (st.ok()) {
+                *bytes_read = bytes_req;
+                DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
+                return Status::OK();
+            }
+            LOG_EVERY_N(WARNING, 100) << "io_uring read of " << _path.native()
+                                      << " failed, retry with pread: " << st;
+        }
+    }
+
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
                                                 "LocalFileReader::pread", _fd, to);
@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/persistent_meta_cache.h"
+
+#include <bvar/bvar.h>
+#include <crc32c/crc32c.h>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+#include "common/logging.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "util/coding.h"
+#include "util/hash_util.hpp"
+
+namespace doris {
+
+bvar::Adder<uint64_t> g_persistent_meta_cache_hit_num("persistent_meta_cache_hit_num");
+bvar::Adder<uint64_t> g_persistent_meta_cache_miss_num("persistent_meta_cache_miss_num");
+bvar::Adder<uint64_t> g_persistent_meta_cache_corrupted_num(
+        "persistent_meta_cache_corrupted_num");
+bvar::Adder<int64_t> g_persistent_meta_cache_size("persistent_meta_cache_size");
+
+static constexpr uint8_t ENTRY_MAGIC[4] = {'D', 'P', 'M', 'C'};
+static constexpr size_t ENTRY_FIXED_SIZE = sizeof(ENTRY_MAGIC) + 4 + 4 + 4;
+static constexpr std::string_view TMP_SUFFIX = ".tmp";
+
+PersistentMetaCache::PersistentMetaCache(std::string root_path, int64_t capacity)
+        : _root_path(std::move(root_path)), _capacity(capacity) {}
+
+PersistentMetaCache::~PersistentMetaCache() {
+    _stop = true;
+    wait_for_loading();
+    g_persistent_meta_cache_size << -_size;
+}
+
+Status PersistentMetaCache::init() {
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(_root_path));
+    _load_thread = std::thread([this] { _load_entries(); });
+    return Status::OK();
+}
+
+void PersistentMetaCache::wait_for_loading() {
+    if (_load_thread.joinable()) {
+        _load_thread.join();
+    }
+}
+
+std::string PersistentMetaCache::_entry_path(uint64_t hash) const {
+    return fmt::format("{}/{:02x}/{:016x}", _root_path, hash & 0xff, hash);
+}
+
+void PersistentMetaCache::_load_entries() {
+    std::error_code ec;
+    std::filesystem::recursive_directory_iterator it {_root_path, ec};
+    if (ec) {
+        LOG(WARNING) << "failed to list persistent meta cache " << _root_path << ": "
+                     << ec.message();
+        return;
+    }
+    size_t num = 0;
+    for (; it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        if (ec || _stop) {
+            break;
+        }
+        if (!it->is_regular_file(ec)) {
+            continue;
+        }
+        const auto& path = it->path();
+        if (path.filename().native().find(TMP_SUFFIX) != std::string::npos) {
+            // left by a crash during insert
+            std::filesystem::remove(path, ec);
+            continue;
+        }
+        uint64_t hash = 0;
+        try {
+            hash = std::stoull(path.filename().native(), nullptr, 16);
+        } catch (...) {
+            continue;
+        }
+        auto file_size = it->file_size(ec);
+        if (ec) {
+            continue;
+        }
+        std::unique_lock lock(_mtx);
+        if (!_entries.contains(hash)) {
+            lock.unlock();
+            _add_entry(hash, file_size);
+            ++num;
+        }
+    }
+    LOG(INFO) << "loaded " << num << " entries of persistent meta cache " << _root_path
+              << ", size: " << size();
+}
+
+bool PersistentMetaCache::lookup(const std::string& key, std::string* value) {
+    uint64_t hash = HashUtil::xxHash64WithSeed(key.data(), key.size(), 0);
+    auto path = _entry_path(hash);
+    io::FileReaderSPtr reader;
+    if (!io::global_local_filesystem()->open_file(path, &reader).ok()) {
+        g_persistent_meta_cache_miss_num << 1;
+        return false;
+    }
+    size_t file_size = reader->size();
+    std::string buf;
+    buf.resize(file_size);
+    size_t bytes_read = 0;
+    bool intact = false;
+    if (file_size >= ENTRY_FIXED_SIZE && reader->read_at(0, buf, &bytes_read).ok() &&
+        bytes_read == file_size &&
+        memcmp(buf.data(), ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 &&
+        decode_fixed32_le((const uint8_t*)buf.data() + file_size - 4) ==
+                crc32c::Value(buf.data(), file_size - 4)) {
+        size_t key_size = decode_fixed32_le((const uint8_t*)buf.data() + sizeof(ENTRY_MAGIC));
+        size_t key_end = sizeof(ENTRY_MAGIC) + 4 + key_size;
+        if (key_end + 8 <= file_size) {
+            size_t value_size = decode_fixed32_le((const uint8_t*)buf.data() + key_end);
+            intact = key_end + 4 + value_size + 4 == file_size;
+            std::string_view entry_key(buf.data() + sizeof(ENTRY_MAGIC) + 4, key_size);
+            if (intact && entry_key != key) {
+                // another key with the same hash, not corrupted but not what we want
+                g_persistent_meta_cache_miss_num << 1;
+                return false;
+            }
+            if (intact) {
+                value->assign(buf.data() + key_end + 4, value_size);
+            }
+        }
+    }
+    reader.reset();
+    if (!intact) {
+        LOG(WARNING) << "remove corrupted persistent meta cache entry " << path;
+        g_persistent_meta_cache_corrupted_num << 1;
+        g_persistent_meta_cache_miss_num << 1;
+        remove(key);
+        return false;
+    }
+    g_persistent_meta_cache_hit_num << 1;
+    return true;
+}
+
+Status PersistentMetaCache::insert(const std::string& key, std::string_view value) {
+    int64_t entry_size = ENTRY_FIXED_SIZE + key.size() + value.size();
+    if (entry_size > _capacity / 10) {
+        return Status::OK();
+    }
+    uint64_t hash = HashUtil::xxHash64WithSeed(key.data(), key.size(), 0);
+    auto path = _entry_path(hash);
+
+    std::string buf;
+    buf.reserve(entry_size);
+    buf.append((const char*)ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    put_fixed32_le(&buf, key.size());
+    buf.append(key);
+    put_fixed32_le(&buf, value.size());
+    buf.append(value);
+    put_fixed32_le(&buf, crc32c::Value(buf.data(), buf.size()));
+
+    auto* fs = io::global_local_filesystem().get();
+    RETURN_IF_ERROR(fs->create_directory(std::filesystem::path(path).parent_path()));
+    // write to a temporary file first, so that a reader never sees a partial entry
+    auto tmp_path = fmt::format("{}{}.{}", path, TMP_SUFFIX,
+                                std::hash<std::thread::id>()(std::this_thread::get_id()));
+    io::FileWriterPtr writer;
+    RETURN_IF_ERROR(fs->create_file(tmp_path, &writer));
+    Status st = writer->append(buf);
+    if (st.ok()) {
+        st = writer->close();
+    }
+    if (st.ok()) {
+        st = fs->rename(tmp_path, path);
+    }
+    if (!st.ok()) {
+        static_cast<void>(fs->delete_file(tmp_path));
+        return st;
+    }
+    _add_entry(hash, entry_size);
+    return Status::OK();
+}
+
+void PersistentMetaCache::remove(const std::string& key) {
+    uint64_t hash = HashUtil::xxHash64WithSeed(key.data(), key.size(), 0);
+    static_cast<void>(io::global_local_filesystem()->delete_file(_entry_path(hash)));
+    _remove_entry(hash);
+}
+
+void PersistentMetaCache::_add_entry(uint64_t hash, int64_t size) {
+    std::vector<uint64_t> victims;
+    {
+        std::lock_guard lock(_mtx);
+        if (auto iter = _entries.find(hash); iter != _entries.end()) {
+            // overwritten, account the new size
+            _size -= iter->second->size;
+            g_persistent_meta_cache_size << -iter->second->size;
+            _entry_list.erase(iter->second);
+            _entries.erase(iter);
+        }
+        _entries[hash] = _entry_list.insert(_entry_list.end(), {hash, size});
+        _size += size;
+        g_persistent_meta_cache_size << size;
+        while (_size > _capacity && _entry_list.size() > 1) {
+            auto& victim = _entry_list.front();
+            victims.push_back(victim.hash);
+            _size -= victim.size;
+            g_persistent_meta_cache_size << -victim.size;
+            _entries.erase(victim.hash);
+            _entry_list.pop_front();
+        }
+    }
+    for (auto victim : victims) {
+        static_cast<void>(io::global_local_filesystem()->delete_file(_entry_path(victim)));
+    }
+}
+
+void PersistentMetaCache::_remove_entry(uint64_t hash) {
+    std::lock_guard lock(_mtx);
+    if (auto iter = _entries.find(hash); iter != _entries.end()) {
+        _size -= iter->second->size;
+        g_persistent_meta_cache_size << -iter->second->size;
+        _entry_list.erase(iter->second);
+        _entries.erase(iter);
+    }
+}
+
+int64_t PersistentMetaCache::size() const {
+    std::lock_guard lock(_mtx);
+    return _size;
+}
+
+size_t PersistentMetaCache::entry_num() const {
+    std::lock_guard lock(_mtx);
+    return _entries.size();
+}
+
+} // namespace doris
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+#include "common/status.h"
+
+namespace doris {
+
+// An on disk cache of small, immutable file metadata (serialized segment footers, parquet
+// FileMetaData ...) which survives BE restarts, so that the first queries after a restart do
+// not have to fetch the metadata of every file from remote storage again.
+//
+// Every entry is stored in its own file <root>/<xx>/<hash of key>:
+//   Entry := Magic(4), KeyLength(4), Key, ValueLength(4), Value, Checksum(4)
+// The checksum is the crc32c of everything before it. Entries are never read at startup, a
+// background thread only lists them to rebuild the size accounting, the contents are read and
+// validated on the first lookup. The cache is bounded by capacity and evicts the oldest
+// entries first.
+class PersistentMetaCache {
+public:
+    PersistentMetaCache(std::string root_path, int64_t capacity);
+    ~PersistentMetaCache();
+
+    PersistentMetaCache(const PersistentMetaCache&) = delete;
+    const PersistentMetaCache& operator=(const PersistentMetaCache&) = delete;
+
+    // Create the root directory and start scanning the existing entries in the background.
+    Status init();
+
+    // Return true and fill value if an intact entry of key exists. A corrupted entry is removed.
+    bool lookup(const std::string& key, std::string* value);
+
+    // Persist value for key. Entries larger than a tenth of the capacity are not cached.
+    Status insert(const std::string& key, std::string_view value);
+
+    void remove(const std::string& key);
+
+    const std::string& root_path() const { return _root_path; }
+    int64_t capacity() const { return _capacity; }
+
+    // use for test
+    int64_t size() const;
+    size_t entry_num() const;
+    void wait_for_loading();
+
+private:
+    struct Entry {
+        uint64_t hash;
+        int64_t size;
+    };
+
+    std::string _entry_path(uint64_t hash) const;
+    void _load_entries();
+    // Register an entry written or found on disk and evict old entries if over capacity
+    void _add_entry(uint64_t hash, int64_t size);
+    void _remove_entry(uint64_t hash);
+
+    const std::string _root_path;
+    const int64_t _capacity;
+    std::thread _load_thread;
+    std::atomic_bool _stop = false;
+
+    mutable std::mutex _mtx;
+    int64_t _size = 0;
+    // entries in insertion order, the oldest one at the front
+    std::list<Entry> _entry_list;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> _entries;
+};
+
+} // namespace doris
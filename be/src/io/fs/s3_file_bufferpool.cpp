@@ -66,7 +66,7 @@ struct Memory : boost::noncopyable, Allocator {
 
 struct FileBuffer::PartData {
     Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
+    explicit PartData(size_t size) : _memory(size) {}
     ~PartData() = default;
     [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
     [[nodiscard]] size_t size() const { return _memory._size; }
@@ -77,13 +77,14 @@ Slice FileBuffer::get_slice() const {
 }
 
 FileBuffer::FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder,
-                       size_t offset, OperationState state)
+                       size_t offset, OperationState state, size_t capacity)
         : _type(type),
           _alloc_holder(std::move(alloc_holder)),
           _offset(offset),
           _size(0),
           _state(std::move(state)),
-          _inner_data(std::make_unique<FileBuffer::PartData>()),
+          _inner_data(std::make_unique<FileBuffer::PartData>(
+                  capacity > 0 ? capacity : config::s3_write_buffer_size)),
           _capacity(_inner_data->size()) {}
 
 FileBuffer::~FileBuffer() {
@@ -246,7 +247,7 @@ Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
     if (_type == BufferType::UPLOAD) {
         RETURN_IF_CATCH_EXCEPTION(*buf = std::make_shared<UploadFileBuffer>(
                                           std::move(_upload_cb), std::move(state), _offset,
-                                          std::move(_alloc_holder_cb)));
+                                          std::move(_alloc_holder_cb), _capacity));
         return Status::OK();
     }
     if (_type == BufferType::DOWNLOAD) {
@@ -254,7 +255,7 @@ Status FileBufferBuilder::build(std::shared_ptr<FileBuffer>* buf) {
                                           std::move(_download),
                                           std::move(_write_to_local_file_cache),
                                           std::move(_write_to_use_buffer), std::move(state),
-                                          _offset, std::move(_alloc_holder_cb)));
+                                          _offset, std::move(_alloc_holder_cb), _capacity));
         return Status::OK();
     }
     // should never come here
@@ -29,18 +29,27 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "cpp/s3_rate_limiter.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -57,6 +66,204 @@ bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_get_request_qps("s3_file_reader", "s3_get_request",
                                                           &s3_file_reader_read_counter);
 
+bvar::Adder<uint64_t> s3_file_reader_hedged_read("s3_file_reader", "hedged_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_win("s3_file_reader", "hedged_read_win");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_over_budget("s3_file_reader",
+                                                            "hedged_read_over_budget");
+
+namespace {
+
+// The latency in microseconds of the recent successful GETs of every bucket
+bvar::LatencyRecorder& bucket_read_latency(const std::string& bucket) {
+    static std::shared_mutex mtx;
+    static std::unordered_map<std::string, std::unique_ptr<bvar::LatencyRecorder>> latencies;
+    {
+        std::shared_lock rlock(mtx);
+        if (auto iter = latencies.find(bucket); iter != latencies.end()) {
+            return *iter->second;
+        }
+    }
+    std::lock_guard wlock(mtx);
+    auto& latency = latencies[bucket];
+    if (latency == nullptr) {
+        latency = std::make_unique<bvar::LatencyRecorder>("s3_file_reader_read_latency", bucket);
+    }
+    return *latency;
+}
+
+// GETs and hedged GETs sent since the start, to keep the extra requests in the budget
+std::atomic<int64_t> g_s3_get_num {0};
+std::atomic<int64_t> g_s3_hedged_get_num {0};
+
+bool try_acquire_hedge_budget() {
+    int64_t hedged = g_s3_hedged_get_num.load(std::memory_order_relaxed);
+    if (hedged * 100 >= g_s3_get_num.load(std::memory_order_relaxed) *
+                                config::s3_hedged_read_budget_percent) {
+        s3_file_reader_hedged_read_over_budget << 1;
+        return false;
+    }
+    g_s3_hedged_get_num.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+// The result of the first successful GET of a hedged read, the GETs own their buffers because
+// the slower one may still be writing after the read returns.
+struct HedgedGetState {
+    std::mutex mtx;
+    std::condition_variable cv;
+    int launched = 0;
+    int finished = 0;
+    bool done = false;
+    bool hedge_won = false;
+    ObjectStorageResponse resp;
+    std::unique_ptr<char[]> buffer;
+    size_t bytes_read = 0;
+};
+
+// Send the GET in the hedged read pool, and the same GET again when the first one has not
+// returned after the hedge delay of the bucket. Return false if the read is not hedged at all.
+bool hedged_get_object(const std::shared_ptr<ObjStorageClient>& client,
+                       const std::string& bucket, const std::string& key, char* to,
+                       size_t offset, size_t bytes_req, size_t* bytes_read,
+                       ObjectStorageResponse* resp) {
+    auto* pool = ExecEnv::GetInstance()->s3_hedged_read_thread_pool();
+    auto& latency = bucket_read_latency(bucket);
+    // not enough GETs in the window to know the tail latency of the bucket
+    if (pool == nullptr || bytes_req > static_cast<size_t>(config::s3_hedged_read_max_bytes) ||
+        latency.qps() < 1) {
+        return false;
+    }
+    auto delay_us = std::max<int64_t>(
+            latency.latency_percentile(config::s3_hedged_read_latency_percentile),
+            config::s3_hedged_read_min_delay_ms * 1000L);
+
+    auto state = std::make_shared<HedgedGetState>();
+    auto query_thread_context = thread_context()->query_thread_context();
+    auto send_get = [&](bool is_hedge) {
+        {
+            std::lock_guard lock(state->mtx);
+            ++state->launched;
+        }
+        auto st = pool->submit_func([=]() {
+            SCOPED_ATTACH_TASK(query_thread_context);
+            std::unique_ptr<char[]> buffer(new char[bytes_req]);
+            size_t size = 0;
+            auto get_resp = client->get_object({.bucket = bucket, .key = key}, buffer.get(),
+                                               offset, bytes_req, &size);
+            std::lock_guard lock(state->mtx);
+            ++state->finished;
+            if (state->done) {
+                return;
+            }
+            // an error only ends the read when no GET is left to succeed
+            if (get_resp.status.code == ErrorCode::OK || state->finished == state->launched) {
+                state->done = true;
+                state->hedge_won = is_hedge;
+                state->resp = std::move(get_resp);
+                state->buffer = std::move(buffer);
+                state->bytes_read = size;
+                state->cv.notify_all();
+            }
+        });
+        if (!st.ok()) {
+            std::lock_guard lock(state->mtx);
+            --state->launched;
+        }
+        return st.ok();
+    };
+    if (!send_get(false)) {
+        return false;
+    }
+    std::unique_lock lock(state->mtx);
+    if (!state->cv.wait_for(lock, std::chrono::microseconds(delay_us),
+                            [&]() { return state->done; })) {
+        lock.unlock();
+        if (try_acquire_hedge_budget() && send_get(true)) {
+            s3_file_reader_hedged_read << 1;
+        }
+        lock.lock();
+        state->cv.wait(lock, [&]() { return state->done; });
+    }
+    if (state->hedge_won) {
+        s3_file_reader_hedged_read_win << 1;
+    }
+    *resp = std::move(state->resp);
+    *bytes_read = state->bytes_read;
+    if (resp->status.code == ErrorCode::OK) {
+        memcpy(to, state->buffer.get(), state->bytes_read);
+    }
+    return true;
+}
+
+// Background reads of object storage are throttled by their own token buckets of bytes per
+// class, below the request limit of S3RateLimitType::GET shared by all reads. Query reads are
+// throttled by the remote read limits of their workload groups instead.
+enum class S3ReadClass { QUERY = 0, COMPACTION = 1, WARM_UP = 2 };
+
+S3ReadClass s3_read_class(const IOContext* io_ctx) {
+    if (io_ctx == nullptr) {
+        return S3ReadClass::QUERY;
+    }
+    if (io_ctx->is_warmup) {
+        return S3ReadClass::WARM_UP;
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_ALTER_TABLE:
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        return S3ReadClass::COMPACTION;
+    default:
+        return S3ReadClass::QUERY;
+    }
+}
+
+bvar::Adder<int64_t> s3_compaction_read_rate_limit_ns("s3_file_reader",
+                                                      "compaction_read_rate_limit_ns");
+bvar::Adder<int64_t> s3_warm_up_read_rate_limit_ns("s3_file_reader", "warm_up_read_rate_limit_ns");
+
+void limit_s3_read_bytes(S3ReadClass read_class, size_t bytes) {
+    // indexed by S3ReadClass - 1, unlimited until the first throttled read
+    static std::array<std::unique_ptr<S3RateLimiterHolder>, 2> limiters {
+            std::make_unique<S3RateLimiterHolder>(S3RateLimitType::UNKNOWN, 0, 0, 0,
+                                                  [](int64_t ns) {
+                                                      if (ns > 0) {
+                                                          s3_compaction_read_rate_limit_ns << ns;
+                                                      }
+                                                  }),
+            std::make_unique<S3RateLimiterHolder>(S3RateLimitType::UNKNOWN, 0, 0, 0,
+                                                  [](int64_t ns) {
+                                                      if (ns > 0) {
+                                                          s3_warm_up_read_rate_limit_ns << ns;
+                                                      }
+                                                  })};
+    static std::array<std::atomic<int64_t>, 2> limiter_speeds {};
+    int64_t bytes_per_second = 0;
+    switch (read_class) {
+    case S3ReadClass::COMPACTION:
+        bytes_per_second = config::s3_compaction_read_bytes_per_second;
+        break;
+    case S3ReadClass::WARM_UP:
+        bytes_per_second = config::s3_warm_up_read_bytes_per_second;
+        break;
+    default:
+        return;
+    }
+    if (bytes_per_second <= 0) {
+        return;
+    }
+    size_t idx = static_cast<size_t>(read_class) - 1;
+    if (limiter_speeds[idx].exchange(bytes_per_second) != bytes_per_second) {
+        // allow a burst of one second of the new speed
+        limiters[idx]->reset(bytes_per_second, bytes_per_second, 0);
+    }
+    limiters[idx]->add(bytes);
+}
+
+} // namespace
+
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key, int64_t file_size,
                                             RuntimeProfile* profile) {
@@ -103,7 +310,7 @@ Status S3FileReader::close() {
 }
 
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::InternalError(
@@ -129,14 +336,26 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
 
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    limit_s3_read_bytes(s3_read_class(io_ctx), bytes_req);
 
     int total_sleep_time = 0;
     while (retry_count <= max_retries) {
         s3_file_reader_read_counter << 1;
-        // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
-        // clang-format on
+        g_s3_get_num.fetch_add(1, std::memory_order_relaxed);
+        MonotonicStopWatch watch;
+        watch.start();
+        ObjectStorageResponse resp;
+        if (!config::enable_s3_hedged_read ||
+            !hedged_get_object(client, _bucket, _key, to, offset, bytes_req, bytes_read, &resp)) {
+            // clang-format off
+            resp = client->get_object( { .bucket = _bucket, .key = _key, },
+                    to, offset, bytes_req, bytes_read);
+            // clang-format on
+        }
+        if (config::enable_s3_hedged_read && resp.status.code == ErrorCode::OK &&
+            bytes_req <= static_cast<size_t>(config::s3_hedged_read_max_bytes)) {
+            bucket_read_latency(_bucket) << watch.elapsed_time() / 1000;
+        }
         _s3_stats.total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
@@ -161,6 +380,9 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
                                          *bytes_read, bytes_req);
         }
         _s3_stats.total_bytes_read += bytes_req;
+        if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr) {
+            io_ctx->file_cache_stats->remote_io.add(watch.elapsed_time(), bytes_req);
+        }
         s3_bytes_read_total << bytes_req;
         s3_bytes_per_read << bytes_req;
         DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
@@ -50,6 +50,7 @@ bvar::Adder<uint64_t> s3_file_being_written("s3_file_writer_file_being_written")
 bvar::Adder<uint64_t> s3_file_writer_async_close_queuing("s3_file_writer_async_close_queuing");
 bvar::Adder<uint64_t> s3_file_writer_async_close_processing(
         "s3_file_writer_async_close_processing");
+bvar::Adder<uint64_t> s3_file_writer_upload_window_full("s3_file_writer_upload_window_full");
 
 S3FileWriter::S3FileWriter(std::shared_ptr<ObjClientHolder> client, std::string bucket,
                            std::string key, const FileWriterOptions* opts)
@@ -167,6 +168,11 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
         ret = true;
         _st = std::move(s);
     }
+    {
+        std::lock_guard lock(_inflight_mtx);
+        --_inflight_parts;
+    }
+    _inflight_cv.notify_all();
     // After the signal, there is a scenario where the previous invocation of _wait_until_finish
     // returns to the caller, and subsequently, the S3 file writer is destructed.
     // This means that accessing _failed afterwards would result in a heap use after free vulnerability.
@@ -174,9 +180,46 @@ bool S3FileWriter::_complete_part_task_callback(Status s) {
     return ret;
 }
 
+size_t S3FileWriter::_part_size() const {
+    auto part_size = static_cast<size_t>(config::s3_write_buffer_size);
+    if (config::s3_write_buffer_grow_parts <= 0) {
+        return part_size;
+    }
+    // double the part every s3_write_buffer_grow_parts parts, so that a large file is uploaded
+    // with fewer and larger parts, the size is kept a multiple of s3_write_buffer_size
+    auto max_part_size = static_cast<size_t>(config::s3_write_buffer_max_size);
+    for (int grows = (_cur_part_num - 1) / config::s3_write_buffer_grow_parts;
+         grows > 0 && part_size * 2 <= max_part_size; --grows) {
+        part_size *= 2;
+    }
+    return part_size;
+}
+
+Status S3FileWriter::_submit_pending_buf() {
+    {
+        std::unique_lock lock(_inflight_mtx);
+        int64_t max_inflight_parts = config::s3_file_writer_max_inflight_parts;
+        if (max_inflight_parts > 0 && _inflight_parts >= max_inflight_parts) {
+            // hold the appender until one of the parts is uploaded, so that a fast writer
+            // doesn't occupy the whole upload pool and the memory of the s3 buffers
+            s3_file_writer_upload_window_full << 1;
+            _inflight_cv.wait(lock, [&]() {
+                return _inflight_parts < config::s3_file_writer_max_inflight_parts || _failed;
+            });
+        }
+        ++_inflight_parts;
+    }
+    _countdown_event.add_count();
+    RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
+    _pending_buf = nullptr;
+    return Status::OK();
+}
+
 Status S3FileWriter::_build_upload_buffer() {
+    size_t part_size = _part_size();
     auto builder = FileBufferBuilder();
     builder.set_type(BufferType::UPLOAD)
+            .set_capacity(part_size)
             .set_upload_callback([part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                 _upload_one_part(part_num, buf);
             })
@@ -191,8 +234,9 @@ Status S3FileWriter::_build_upload_buffer() {
         // try to do writing into file cache, so we make the lambda capture the variable
         // we need by value to extend their lifetime
         builder.set_allocate_file_blocks_holder(
-                [builder = *_cache_builder, offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                    return builder.allocate_cache_holder(offset, config::s3_write_buffer_size);
+                [builder = *_cache_builder, offset = _bytes_appended,
+                 part_size]() -> FileBlocksHolderPtr {
+                    return builder.allocate_cache_holder(offset, part_size);
                 });
     }
     RETURN_IF_ERROR(builder.build(&_pending_buf));
@@ -221,9 +265,7 @@ Status S3FileWriter::_close_impl() {
     }
 
     if (_pending_buf != nullptr) { // there is remaining data in buffer need to be uploaded
-        _countdown_event.add_count();
-        RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
-        _pending_buf = nullptr;
+        RETURN_IF_ERROR(_submit_pending_buf());
     } else if (_bytes_appended != 0) { // Non-empty file and has nothing to be uploaded
         // NOTE: When the data size is a multiple of config::s3_write_buffer_size,
         //       _cur_part_num may exceed the actual number of parts that need to be uploaded.
@@ -243,7 +285,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -254,6 +295,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
             if (!_pending_buf) {
                 RETURN_IF_ERROR(_build_upload_buffer());
             }
+            size_t buffer_size = _pending_buf->get_capacaticy();
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
             data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
@@ -275,9 +317,7 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                     RETURN_IF_ERROR(_create_multi_upload_request());
                 }
                 _cur_part_num++;
-                _countdown_event.add_count();
-                RETURN_IF_ERROR(FileBuffer::submit(std::move(_pending_buf)));
-                _pending_buf = nullptr;
+                RETURN_IF_ERROR(_submit_pending_buf());
             }
             _bytes_appended += data_size_to_append;
         }
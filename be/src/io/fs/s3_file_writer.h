@@ -19,8 +19,10 @@
 
 #include <bthread/countdown_event.h>
 
+#include <condition_variable>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "common/status.h"
@@ -86,6 +88,10 @@ private:
     void _upload_one_part(int64_t part_num, UploadFileBuffer& buf);
     bool _complete_part_task_callback(Status s);
     Status _build_upload_buffer();
+    // size of the part _cur_part_num, it grows with the number of the parts
+    size_t _part_size() const;
+    // submit _pending_buf, wait first when the upload window of the writer is full
+    Status _submit_pending_buf();
 
     ObjectStoragePathOptions _obj_storage_path_opts;
 
@@ -97,6 +103,12 @@ private:
     // **Attention** call add_count() before submitting buf to async thread pool
     bthread::CountdownEvent _countdown_event {0};
 
+    // number of the buffers submitted but not finished, bounded by
+    // config::s3_file_writer_max_inflight_parts
+    std::mutex _inflight_mtx;
+    std::condition_variable _inflight_cv;
+    int64_t _inflight_parts = 0;
+
     std::atomic_bool _failed = false;
 
     Status _st;
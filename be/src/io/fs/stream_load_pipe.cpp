@@ -113,7 +113,10 @@ Status StreamLoadPipe::read_one_message(std::unique_ptr<uint8_t[]>* data, size_t
 Status StreamLoadPipe::append_and_flush(const char* data, size_t size, size_t proto_byte_size) {
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->stream_load_pipe_tracker());
     ByteBufferPtr buf;
-    RETURN_IF_ERROR(ByteBuffer::allocate(BitUtil::RoundUpToPowerOfTwo(size + 1), &buf));
+    // the buffer is flushed right away and never grows, so do not round its size up: the
+    // queue only accounts the bytes put into it, a rounded up kafka json message could hold
+    // about twice the memory that max_buffered_bytes allows
+    RETURN_IF_ERROR(ByteBuffer::allocate(size + 1, &buf));
     buf->put_bytes(data, size);
     buf->flip();
     return _append(buf, proto_byte_size);
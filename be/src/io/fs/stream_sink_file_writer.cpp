@@ -19,6 +19,9 @@
 
 #include <gen_cpp/internal_service.pb.h>
 
+#include <algorithm>
+
+#include "common/config.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/beta_rowset_writer.h"
 #include "util/debug_points.h"
@@ -51,10 +54,33 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
                << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
                << ", data_length: " << bytes_req << "file_type" << _file_type;
 
-    std::span<const Slice> slices {data, data_cnt};
+    size_t buffer_limit = std::max<int64_t>(config::stream_sink_file_writer_buffer_bytes, 0);
+    if (_buffer.size() + bytes_req < buffer_limit) {
+        for (int i = 0; i < data_cnt; i++) {
+            _buffer.append(data[i].get_data(), data[i].get_size());
+        }
+        _bytes_appended += bytes_req;
+        return Status::OK();
+    }
+
+    uint64_t offset = _bytes_appended - _buffer.size();
+    std::vector<Slice> slices;
+    slices.reserve(data_cnt + 1);
+    if (!_buffer.empty()) {
+        slices.emplace_back(_buffer);
+    }
+    slices.insert(slices.end(), data, data + data_cnt);
+    RETURN_IF_ERROR(_send_data(slices, offset, _buffer.size() + bytes_req, false));
+    _buffer.clear();
+    _bytes_appended += bytes_req;
+    return Status::OK();
+}
+
+Status StreamSinkFileWriter::_send_data(std::span<const Slice> slices, uint64_t offset,
+                                        size_t bytes, bool eos) {
+    const char* what = eos ? "segment eos" : "segment data";
     size_t fault_injection_skipped_streams = 0;
     bool ok = false;
-    Status st;
     for (auto& stream : _streams) {
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_one_replica", {
             if (fault_injection_skipped_streams < 1) {
@@ -70,30 +96,32 @@ Status StreamSinkFileWriter::appendv(const Slice* data, size_t data_cnt) {
         });
         DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
                         { continue; });
-        st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id, _bytes_appended,
-                                 slices, false, _file_type);
+        auto st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id, offset,
+                                      slices, eos, _file_type);
         ok = ok || st.ok();
         if (!st.ok()) {
-            LOG(WARNING) << "failed to send segment data to backend " << stream->dst_id()
+            LOG(WARNING) << "failed to send " << what << " to backend " << stream->dst_id()
                          << ", load_id: " << print_id(_load_id) << ", index_id: " << _index_id
                          << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
-                         << ", data_length: " << bytes_req << ", reason: " << st;
+                         << ", data_length: " << bytes << ", reason: " << st;
         }
     }
+    if (eos) {
+        DBUG_EXECUTE_IF("StreamSinkFileWriter.finalize.finalize_failed", { ok = false; });
+    }
     if (!ok) {
         std::stringstream ss;
         for (auto& stream : _streams) {
             ss << " " << stream->dst_id();
         }
-        LOG(WARNING) << "failed to send segment data to any replicas, load_id: "
+        LOG(WARNING) << "failed to send " << what << " to any replicas, load_id: "
                      << print_id(_load_id) << ", index_id: " << _index_id
                      << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
-                     << ", data_length: " << bytes_req << ", backends:" << ss.str();
+                     << ", data_length: " << bytes << ", backends:" << ss.str();
         return Status::InternalError(
-                "failed to send segment data to any replicas, tablet_id={}, segment_id={}",
-                _tablet_id, _segment_id);
+                "failed to send {} to any replicas, tablet_id={}, segment_id={}", what, _tablet_id,
+                _segment_id);
     }
-    _bytes_appended += bytes_req;
     return Status::OK();
 }
 
@@ -123,47 +151,13 @@ Status StreamSinkFileWriter::_finalize() {
     VLOG_DEBUG << "writer finalize, load_id: " << print_id(_load_id) << ", index_id: " << _index_id
                << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id;
     // TODO(zhengyu): update get_inverted_index_file_size into stat
-    size_t fault_injection_skipped_streams = 0;
-    bool ok = false;
-    for (auto& stream : _streams) {
-        DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_one_replica", {
-            if (fault_injection_skipped_streams < 1) {
-                fault_injection_skipped_streams++;
-                continue;
-            }
-        });
-        DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_two_replica", {
-            if (fault_injection_skipped_streams < 2) {
-                fault_injection_skipped_streams++;
-                continue;
-            }
-        });
-        DBUG_EXECUTE_IF("StreamSinkFileWriter.appendv.write_segment_failed_all_replica",
-                        { continue; });
-        auto st = stream->append_data(_partition_id, _index_id, _tablet_id, _segment_id,
-                                      _bytes_appended, {}, true, _file_type);
-        ok = ok || st.ok();
-        if (!st.ok()) {
-            LOG(WARNING) << "failed to send segment eos to backend " << stream->dst_id()
-                         << ", load_id: " << print_id(_load_id) << ", index_id: " << _index_id
-                         << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
-                         << ", reason: " << st;
-        }
-    }
-    DBUG_EXECUTE_IF("StreamSinkFileWriter.finalize.finalize_failed", { ok = false; });
-    if (!ok) {
-        std::stringstream ss;
-        for (auto& stream : _streams) {
-            ss << " " << stream->dst_id();
-        }
-        LOG(WARNING) << "failed to send segment eos to any replicas, load_id: "
-                     << print_id(_load_id) << ", index_id: " << _index_id
-                     << ", tablet_id: " << _tablet_id << ", segment_id: " << _segment_id
-                     << ", backends:" << ss.str();
-        return Status::InternalError(
-                "failed to send segment eos to any replicas, tablet_id={}, segment_id={}",
-                _tablet_id, _segment_id);
+    // The buffered tail rides along with eos, the receiver appends it before closing the file.
+    std::vector<Slice> slices;
+    if (!_buffer.empty()) {
+        slices.emplace_back(_buffer);
     }
+    RETURN_IF_ERROR(_send_data(slices, _bytes_appended - _buffer.size(), _buffer.size(), true));
+    _buffer.clear();
     return Status::OK();
 }
 
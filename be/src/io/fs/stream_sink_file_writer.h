@@ -21,6 +21,8 @@
 #include <gen_cpp/olap_common.pb.h>
 
 #include <queue>
+#include <span>
+#include <string>
 
 #include "io/fs/file_writer.h"
 #include "util/uid_util.h"
@@ -60,6 +62,9 @@ public:
 
 private:
     Status _finalize();
+    // Send `slices` starting at `offset` to all replicas, succeeds if any replica accepted it.
+    Status _send_data(std::span<const Slice> slices, uint64_t offset, size_t bytes, bool eos);
+
     std::vector<std::shared_ptr<LoadStreamStub>> _streams;
 
     PUniqueId _load_id;
@@ -68,6 +73,8 @@ private:
     int64_t _tablet_id;
     int32_t _segment_id;
     size_t _bytes_appended = 0;
+    // Small appends not sent yet, they start at `_bytes_appended - _buffer.size()`.
+    std::string _buffer;
     State _state {State::OPENED};
     FileType _file_type {FileType::SEGMENT_FILE};
 };
@@ -179,6 +179,19 @@ Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_
         hdfsBuilderSetKeyTabFile(builder->get(), nullptr);
 #endif
     }
+    // set the default read options before other conf, so that they can be overridden
+    if (!config::hdfs_client_short_circuit_domain_socket_path.empty()) {
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(builder->get(), "dfs.domain.socket.path",
+                              config::hdfs_client_short_circuit_domain_socket_path.c_str());
+    }
+    if (config::hdfs_client_hedged_read_thread_num > 0) {
+        // the hdfs client hedges the preads of every block separately
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.hedged.read.threadpool.size",
+                              std::to_string(config::hdfs_client_hedged_read_thread_num).c_str());
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.hedged.read.threshold.millis",
+                              std::to_string(config::hdfs_client_hedged_read_threshold_ms).c_str());
+    }
     // set other conf
     if (hdfsParams.__isset.hdfs_conf) {
         for (const THdfsConf& conf : hdfsParams.hdfs_conf) {
@@ -19,6 +19,9 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <array>
+#include <cstdint>
+
 namespace doris {
 
 enum class ReaderType : uint8_t {
@@ -35,6 +38,42 @@ enum class ReaderType : uint8_t {
 
 namespace io {
 
+// Reads served by one tier of the read path (page cache, file cache, remote storage),
+// with their latencies counted in decade buckets: <10us, <100us, <1ms, <10ms, <100ms, more.
+struct IOTierStatistics {
+    static constexpr size_t NUM_LATENCY_BUCKETS = 6;
+
+    int64_t num_reads = 0;
+    int64_t bytes_read = 0;
+    int64_t latency_ns = 0;
+    std::array<int64_t, NUM_LATENCY_BUCKETS> latency_buckets {};
+
+    static size_t latency_bucket(int64_t latency_ns) {
+        size_t bucket = 0;
+        for (int64_t bound = 10000; bucket + 1 < NUM_LATENCY_BUCKETS && latency_ns >= bound;
+             bound *= 10) {
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    void add(int64_t latency, int64_t bytes) {
+        num_reads++;
+        bytes_read += bytes;
+        latency_ns += latency;
+        latency_buckets[latency_bucket(latency)]++;
+    }
+
+    void merge(const IOTierStatistics& other) {
+        num_reads += other.num_reads;
+        bytes_read += other.bytes_read;
+        latency_ns += other.latency_ns;
+        for (size_t i = 0; i < NUM_LATENCY_BUCKETS; ++i) {
+            latency_buckets[i] += other.latency_buckets[i];
+        }
+    }
+};
+
 struct FileCacheStatistics {
     int64_t num_local_io_total = 0;
     int64_t num_remote_io_total = 0;
@@ -46,11 +85,17 @@ struct FileCacheStatistics {
     int64_t write_cache_io_timer = 0;
     int64_t bytes_write_into_cache = 0;
     int64_t num_skip_cache_io_total = 0;
+    int64_t num_remote_read_requests = 0;
+    int64_t num_coalesced_remote_read_requests = 0;
     int64_t read_cache_file_directly_timer = 0;
     int64_t cache_get_or_set_timer = 0;
     int64_t lock_wait_timer = 0;
     int64_t get_timer = 0;
     int64_t set_timer = 0;
+    // the reads served by the file cache on memory or on disk and by the remote storage
+    IOTierStatistics file_cache_memory_io;
+    IOTierStatistics file_cache_disk_io;
+    IOTierStatistics remote_io;
 };
 
 struct IOContext {
@@ -67,6 +112,8 @@ struct IOContext {
     const TUniqueId* query_id = nullptr;             // Ref
     FileCacheStatistics* file_cache_stats = nullptr; // Ref
     bool is_inverted_index = false;
+    // read by the file cache warm up
+    bool is_warmup = false;
 };
 
 } // namespace io
@@ -199,7 +199,36 @@ Status BaseCompaction::pick_rowsets_to_compact() {
         return Status::OK();
     }
 
-    // 3. the interval since last base compaction reaches the threshold
+    // 3. for merge-on-write tables, many input rows are deleted by the delete bitmap, compacting
+    // drops them and keeps point lookups and delete bitmap calculation away from them
+    if (_tablet->enable_unique_key_merge_on_write() &&
+        config::base_compaction_min_mow_delete_ratio > 0) {
+        int64_t input_rows = 0;
+        uint64_t deleted_rows = 0;
+        const int64_t max_version = _input_rowsets.back()->end_version();
+        const auto& delete_bitmap = _tablet->tablet_meta()->delete_bitmap();
+        for (const auto& rs : _input_rowsets) {
+            input_rows += rs->num_rows();
+            for (uint32_t seg_id = 0; seg_id < rs->num_segments(); ++seg_id) {
+                deleted_rows += delete_bitmap
+                                        .get_agg({rs->rowset_id(), seg_id,
+                                                  cast_set<uint64_t>(max_version)})
+                                        ->cardinality();
+            }
+        }
+        double delete_ratio = input_rows == 0 ? 0
+                                              : cast_set<double>(deleted_rows) /
+                                                        cast_set<double>(input_rows);
+        if (delete_ratio >= config::base_compaction_min_mow_delete_ratio) {
+            VLOG_NOTICE << "satisfy the base compaction policy. tablet=" << _tablet->tablet_id()
+                        << ", deleted_rows=" << deleted_rows << ", input_rows=" << input_rows
+                        << ", policy_min_mow_delete_ratio="
+                        << config::base_compaction_min_mow_delete_ratio;
+            return Status::OK();
+        }
+    }
+
+    // 4. the interval since last base compaction reaches the threshold
     int64_t base_creation_time = _input_rowsets[0]->creation_time();
     int64_t interval_threshold = 86400;
     int64_t interval_since_last_base_compaction = time(nullptr) - base_creation_time;
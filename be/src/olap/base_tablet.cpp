@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 #include <rapidjson/prettywriter.h>
 
+#include <cmath>
 #include <cstdint>
 #include <iterator>
 
@@ -44,6 +45,7 @@
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -133,6 +135,30 @@ BaseTablet::BaseTablet(TabletMetaSharedPtr tablet_meta) : _tablet_meta(std::move
     g_total_tablet_num << 1;
 }
 
+namespace {
+
+double decay_read_heat(double heat, int64_t elapsed_ms) {
+    int64_t half_life_ms =
+            std::max<int64_t>(config::compaction_read_heat_half_life_sec, 1) * 1000;
+    return heat * std::exp2(-static_cast<double>(elapsed_ms) / static_cast<double>(half_life_ms));
+}
+
+} // namespace
+
+void BaseTablet::update_query_read_heat(int64_t num_segments) {
+    int64_t now_ms = MonotonicMillis();
+    std::lock_guard<std::mutex> l(_read_heat_lock);
+    _read_heat = decay_read_heat(_read_heat, now_ms - _read_heat_update_ms) +
+                 static_cast<double>(num_segments);
+    _read_heat_update_ms = now_ms;
+}
+
+double BaseTablet::query_read_heat() const {
+    int64_t now_ms = MonotonicMillis();
+    std::lock_guard<std::mutex> l(_read_heat_lock);
+    return decay_read_heat(_read_heat, now_ms - _read_heat_update_ms);
+}
+
 BaseTablet::~BaseTablet() {
     DorisMetrics::instance()->metric_registry()->deregister_entity(_metric_entity);
     g_total_tablet_num << -1;
@@ -445,6 +471,25 @@ Status BaseTablet::lookup_row_data(const Slice& encoded_key, const RowLocation&
     return Status::OK();
 }
 
+Status BaseTablet::lookup_rows_data(RowsetSharedPtr input_rowset, uint32_t segment_id,
+                                    const std::vector<segment_v2::rowid_t>& row_ids,
+                                    OlapReaderStatistics& stats,
+                                    vectorized::MutableColumnPtr& values) {
+    DCHECK(std::is_sorted(row_ids.begin(), row_ids.end()));
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    const TabletSchemaSPtr tablet_schema = rowset->tablet_schema();
+    SegmentCacheHandle segment_cache_handle;
+    std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+    const auto& column = *DORIS_TRY(tablet_schema->column(BeConsts::ROW_STORE_COL));
+    RETURN_IF_ERROR(_get_segment_column_iterator(rowset, segment_id, column, &segment_cache_handle,
+                                                 &column_iterator, &stats));
+    values = vectorized::ColumnString::create();
+    RETURN_IF_ERROR(column_iterator->read_by_rowids(row_ids.data(), row_ids.size(), values));
+    DCHECK_EQ(values->size(), row_ids.size());
+    return Status::OK();
+}
+
 Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest_schema,
                                   bool with_seq_col,
                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
@@ -452,7 +497,8 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
                                   std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
                                   RowsetSharedPtr* rowset, bool with_rowid,
                                   std::string* encoded_seq_value, OlapReaderStatistics* stats,
-                                  DeleteBitmapPtr delete_bitmap) {
+                                  DeleteBitmapPtr delete_bitmap,
+                                  segment_v2::PrimaryKeyIteratorCache* pk_iterators) {
     SCOPED_BVAR_LATENCY(g_tablet_lookup_rowkey_latency);
     size_t seq_col_length = 0;
     // use the latest tablet schema to decide if the tablet has sequence column currently
@@ -497,8 +543,9 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
         DCHECK_EQ(segments.size(), num_segments);
 
         for (auto id : picked_segments) {
-            Status s = segments[id]->lookup_row_key(encoded_key, schema, with_seq_col, with_rowid,
-                                                    &loc, stats, encoded_seq_value);
+            Status s = segments[id]->lookup_row_key(
+                    encoded_key, schema, with_seq_col, with_rowid, &loc, stats, encoded_seq_value,
+                    pk_iterators != nullptr ? &(*pk_iterators)[segments[id].get()] : nullptr);
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -626,6 +673,9 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // The keys of the segment are looked up in ascending order, keeping the primary key index
+    // iterator of every probed segment lets consecutive keys reuse its decoded data page.
+    segment_v2::PrimaryKeyIteratorCache pk_iterators;
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
@@ -684,15 +734,11 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
 
             RowsetSharedPtr rowset_find;
             Status st = Status::OK();
-            if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
-                                    cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find);
-            } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
-                                    cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
-                                    &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap);
-            }
+            // a null tablet_delete_bitmap makes lookup_row_key use the tablet's delete bitmap
+            st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                                cast_set<uint32_t>(dummy_version.first - 1), segment_caches,
+                                &rowset_find, true, nullptr, nullptr, tablet_delete_bitmap,
+                                &pk_iterators);
             bool expected_st = st.ok() || st.is<KEY_NOT_FOUND>() || st.is<KEY_ALREADY_EXISTS>();
             // It's a defensive DCHECK, we need to exclude some common errors to avoid core-dump
             // while stress test
@@ -147,6 +147,12 @@ public:
                            OlapReaderStatistics& stats, std::string& values,
                            bool write_to_cache = false);
 
+    // Lookup the row store values of `row_ids` in one segment, `row_ids` must be sorted and
+    // unique. Rows on the same row store page are read by a single page read.
+    Status lookup_rows_data(RowsetSharedPtr rowset, uint32_t segment_id,
+                            const std::vector<segment_v2::rowid_t>& row_ids,
+                            OlapReaderStatistics& stats, vectorized::MutableColumnPtr& values);
+
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
@@ -157,7 +163,8 @@ public:
                           RowsetSharedPtr* rowset = nullptr, bool with_rowid = true,
                           std::string* encoded_seq_value = nullptr,
                           OlapReaderStatistics* stats = nullptr,
-                          DeleteBitmapPtr tablet_delete_bitmap = nullptr);
+                          DeleteBitmapPtr tablet_delete_bitmap = nullptr,
+                          segment_v2::PrimaryKeyIteratorCache* pk_iterators = nullptr);
 
     // calc delete bitmap when flush memtable, use a fake version to calc
     // For example, cur max version is 5, and we use version 6 to calc but
@@ -354,11 +361,24 @@ public:
     std::atomic<int64_t> read_block_count = 0;
     std::atomic<int64_t> write_count = 0;
     std::atomic<int64_t> compaction_count = 0;
+    // Set when the tablet is among the hottest tablets of the cloud BE, the file cache blocks
+    // read before this time are kept in the TTL queue instead of the NORMAL queue
+    std::atomic<int64_t> hot_file_cache_expiration_time = 0;
+
+    // Record that a query opened `num_segments` segments of this tablet.
+    void update_query_read_heat(int64_t num_segments);
+    // Segments opened by queries, decayed by config::compaction_read_heat_half_life_sec.
+    double query_read_heat() const;
 
     CompactionStage compaction_stage = CompactionStage::NOT_SCHEDULED;
     std::mutex sample_info_lock;
     std::vector<CompactionSampleInfo> sample_infos;
     Status last_compaction_status = Status::OK();
+
+private:
+    mutable std::mutex _read_heat_lock;
+    double _read_heat = 0;
+    int64_t _read_heat_update_ms = 0;
 };
 
 } /* namespace doris */
@@ -37,6 +37,7 @@
 
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
@@ -113,6 +114,18 @@ bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
     return true;
 }
 
+// Index compaction merges the postings of the source indexes and remaps their doc ids through
+// the rowid conversion, so it works for every index that stores one document per row: string
+// columns, and arrays of strings whose elements all go into the document of their row.
+// Numeric columns are indexed by BKD trees and still have to be rebuilt.
+bool can_merge_index_postings(const TabletColumn& column) {
+    if (field_is_slice_type(column.type())) {
+        return true;
+    }
+    return column.type() == FieldType::OLAP_FIELD_TYPE_ARRAY && column.get_subtype_count() == 1 &&
+           field_is_slice_type(column.get_sub_column(0).type());
+}
+
 } // namespace
 
 Compaction::Compaction(BaseTabletSPtr tablet, const std::string& label)
@@ -837,8 +850,8 @@ void Compaction::construct_index_compaction_columns(RowsetWriterContext& ctx) {
             continue;
         }
         auto col_unique_id = col_unique_ids[0];
-        // Avoid doing inverted index compaction on non-slice type columns
-        if (!field_is_slice_type(_cur_tablet_schema->column_by_uid(col_unique_id).type())) {
+        // Avoid doing inverted index compaction on columns whose index is not made of postings
+        if (!can_merge_index_postings(_cur_tablet_schema->column_by_uid(col_unique_id))) {
             continue;
         }
 
@@ -1055,9 +1068,14 @@ void Compaction::agg_and_remove_old_version_delete_bitmap(
             continue;
         }
         for (uint32_t seg_id = 0; seg_id < rowset->num_segments(); ++seg_id) {
-            rowset->rowset_id().to_string();
             DeleteBitmap::BitmapKey start {rowset->rowset_id(), seg_id, 0};
             DeleteBitmap::BitmapKey end {rowset->rowset_id(), seg_id, pre_max_version};
+            // The segment has at most one bitmap up to pre_max_version, e.g. it has been merged
+            // by a previous compaction and no row is deleted since then, agg and rewrite it
+            // would produce the same bitmap, so only the segments with new deltas are uploaded.
+            if (_tablet->tablet_meta()->delete_bitmap().get_count_with_range(start, end) <= 1) {
+                continue;
+            }
             auto d = _tablet->tablet_meta()->delete_bitmap().get_agg(
                     {rowset->rowset_id(), seg_id, pre_max_version});
             to_remove_vec.emplace_back(std::make_tuple(_tablet->tablet_id(), start, end));
@@ -1123,7 +1141,7 @@ Status CompactionMixin::modify_rowsets() {
         if (missed_rows) {
             missed_rows_size = missed_rows->size();
             std::size_t merged_missed_rows_size = _stats.merged_rows;
-            if (!_tablet->tablet_meta()->tablet_schema()->cluster_key_uids().empty()) {
+            if (Merger::skip_deleted_rows_by_bitmap(*_tablet, compaction_type())) {
                 merged_missed_rows_size += _stats.filtered_rows;
             }
 
@@ -1474,9 +1492,12 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     // We presume that the data involved in cumulative compaction is sufficiently 'hot'
     // and should always be retained in the cache.
     // TODO(gavin): Ensure that the retention of hot data is implemented with precision.
-    ctx.write_file_cache = (compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
-                           (config::enable_file_cache_keep_base_compaction_output &&
-                            compaction_type() == ReaderType::READER_BASE_COMPACTION);
+    // A dedicated compaction worker serves no query, the query nodes warm the output
+    // themselves when they sync the new rowset.
+    ctx.write_file_cache = !config::is_cloud_compaction_worker() &&
+                           ((compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION) ||
+                            (config::enable_file_cache_keep_base_compaction_output &&
+                             compaction_type() == ReaderType::READER_BASE_COMPACTION));
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(_engine.meta_mgr().prepare_rowset(*_output_rs_writer->rowset_meta().get()));
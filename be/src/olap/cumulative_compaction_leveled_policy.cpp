@@ -0,0 +1,263 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/cumulative_compaction_leveled_policy.h"
+
+#include <gen_cpp/olap_file.pb.h>
+
+#include <algorithm>
+#include <string>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "olap/olap_common.h"
+#include "olap/tablet.h"
+#include "olap/tablet_meta.h"
+
+namespace doris {
+
+namespace {
+
+// Key range covered by all segments of a rowset, false if the rowset has no key bounds.
+bool rowset_key_range(const RowsetMeta& rs_meta, std::string* min_key, std::string* max_key) {
+    const auto& key_bounds = rs_meta.get_segments_key_bounds();
+    if (key_bounds.empty()) {
+        return false;
+    }
+    *min_key = key_bounds.begin()->min_key();
+    *max_key = key_bounds.begin()->max_key();
+    for (const auto& bounds : key_bounds) {
+        *min_key = std::min(*min_key, bounds.min_key());
+        *max_key = std::max(*max_key, bounds.max_key());
+    }
+    return true;
+}
+
+} // namespace
+
+LeveledCumulativeCompactionPolicy::LeveledCumulativeCompactionPolicy(int64_t base_level_size,
+                                                                     int64_t size_ratio)
+        : _base_level_size(std::max<int64_t>(base_level_size, 1)),
+          _size_ratio(std::max<int64_t>(size_ratio, 2)) {}
+
+int LeveledCumulativeCompactionPolicy::_level(int64_t size) const {
+    int level = 0;
+    // stop before the bound overflows, such rowsets are far beyond the promotion size anyway
+    for (int64_t bound = _base_level_size; size >= bound && bound <= INT64_MAX / _size_ratio;
+         bound *= _size_ratio) {
+        ++level;
+    }
+    return level;
+}
+
+std::vector<LeveledCumulativeCompactionPolicy::LevelRun>
+LeveledCumulativeCompactionPolicy::_split_runs(
+        const std::vector<RowsetMetaSharedPtr>& rs_metas) const {
+    std::vector<LevelRun> runs;
+    std::string prev_min_key;
+    std::string prev_max_key;
+    bool prev_has_range = false;
+    for (size_t i = 0; i < rs_metas.size(); ++i) {
+        const auto& rs_meta = rs_metas[i];
+        int level = _level(rs_meta->total_disk_size());
+        if (runs.empty() || runs.back().level != level) {
+            runs.push_back({i, i, level, 0, 0});
+            prev_has_range = false;
+        }
+        auto& run = runs.back();
+        run.end = i + 1;
+        run.score += rs_meta->get_compaction_score();
+
+        std::string min_key;
+        std::string max_key;
+        bool has_range = rowset_key_range(*rs_meta, &min_key, &max_key);
+        if (rs_meta->is_segments_overlapping() ||
+            (has_range && prev_has_range && min_key <= prev_max_key && prev_min_key <= max_key)) {
+            ++run.overlaps;
+        }
+        if (has_range) {
+            prev_min_key = std::move(min_key);
+            prev_max_key = std::move(max_key);
+            prev_has_range = true;
+        }
+    }
+    return runs;
+}
+
+const LeveledCumulativeCompactionPolicy::LevelRun* LeveledCumulativeCompactionPolicy::_pick_run(
+        const std::vector<LevelRun>& runs, int64_t max_compaction_score,
+        int64_t total_score) const {
+    const LevelRun* picked = nullptr;
+    for (const auto& run : runs) {
+        if (run.score < _size_ratio) {
+            continue;
+        }
+        if (picked == nullptr || run.overlaps > picked->overlaps ||
+            (run.overlaps == picked->overlaps && run.level < picked->level)) {
+            picked = &run;
+        }
+    }
+    if (picked != nullptr || total_score < max_compaction_score) {
+        return picked;
+    }
+    // No run is full but there are too many segments already, e.g. every level holds
+    // size_ratio - 1 rowsets. Compact the run that reduces the score most.
+    for (const auto& run : runs) {
+        if (run.score > 1 && (picked == nullptr || run.score > picked->score)) {
+            picked = &run;
+        }
+    }
+    return picked;
+}
+
+void LeveledCumulativeCompactionPolicy::calculate_cumulative_point(
+        Tablet* tablet, const std::vector<RowsetMetaSharedPtr>& all_rowsets,
+        int64_t current_cumulative_point, int64_t* cumulative_point) {
+    _size_based.calculate_cumulative_point(tablet, all_rowsets, current_cumulative_point,
+                                           cumulative_point);
+}
+
+void LeveledCumulativeCompactionPolicy::update_cumulative_point(
+        Tablet* tablet, const std::vector<RowsetSharedPtr>& input_rowsets,
+        RowsetSharedPtr output_rowset, Version& last_delete_version) {
+    _size_based.update_cumulative_point(tablet, input_rowsets, std::move(output_rowset),
+                                        last_delete_version);
+}
+
+uint32_t LeveledCumulativeCompactionPolicy::calc_cumulative_compaction_score(Tablet* tablet) {
+    bool base_rowset_exist = false;
+    const int64_t point = tablet->cumulative_layer_point();
+
+    std::vector<RowsetMetaSharedPtr> rowset_to_compact;
+    int64_t total_score = 0;
+    bool has_delete = false;
+
+    RowsetMetaSharedPtr first_meta;
+    int64_t first_version = INT64_MAX;
+    // NOTE: tablet._meta_lock is hold
+    auto& rs_metas = tablet->tablet_meta()->all_rs_metas();
+    for (auto& rs_meta : rs_metas) {
+        if (rs_meta->start_version() < first_version) {
+            first_version = rs_meta->start_version();
+            first_meta = rs_meta;
+        }
+        if (rs_meta->start_version() == 0) {
+            base_rowset_exist = true;
+        }
+        if (rs_meta->end_version() < point || !rs_meta->is_local()) {
+            continue;
+        }
+        total_score += rs_meta->get_compaction_score();
+        has_delete |= rs_meta->has_delete_predicate();
+        rowset_to_compact.push_back(rs_meta);
+    }
+
+    if (first_meta == nullptr) {
+        return 0;
+    }
+
+    // keep the promotion size of the tablet up to date for update_cumulative_point
+    int64_t promotion_size = 0;
+    _size_based._calc_promotion_size(tablet, first_meta, &promotion_size);
+
+    if (!base_rowset_exist && tablet->tablet_state() == TABLET_RUNNING) {
+        LOG(WARNING) << "tablet state is running but have no base version";
+        return 0;
+    }
+
+    // delete versions are handled like size_based: everything before them is compacted directly
+    if (has_delete) {
+        return static_cast<uint32_t>(total_score);
+    }
+
+    std::sort(rowset_to_compact.begin(), rowset_to_compact.end(), RowsetMeta::comparator);
+    auto runs = _split_runs(rowset_to_compact);
+    const LevelRun* run =
+            _pick_run(runs, config::cumulative_compaction_max_deltas, total_score);
+    return run == nullptr ? 0 : static_cast<uint32_t>(run->score);
+}
+
+int LeveledCumulativeCompactionPolicy::pick_input_rowsets(
+        Tablet* tablet, const std::vector<RowsetSharedPtr>& candidate_rowsets,
+        const int64_t max_compaction_score, const int64_t min_compaction_score,
+        std::vector<RowsetSharedPtr>* input_rowsets, Version* last_delete_version,
+        size_t* compaction_score, bool allow_delete) {
+    auto max_version = tablet->max_version().first;
+    int transient_size = 0;
+    *compaction_score = 0;
+    std::vector<RowsetSharedPtr> rowsets;
+    for (auto& rowset : candidate_rowsets) {
+        // check whether this rowset is delete version
+        if (!allow_delete && rowset->rowset_meta()->has_delete_predicate()) {
+            *last_delete_version = rowset->version();
+            if (!rowsets.empty()) {
+                // compact the versions before the delete version before handing them over to
+                // base compaction
+                break;
+            }
+            transient_size = 0;
+            continue;
+        }
+        if (tablet->tablet_state() == TABLET_NOTREADY) {
+            // If tablet under alter, keep latest 10 version so that base tablet max version
+            // not merged in new tablet, and then we can copy data from base tablet
+            if (rowset->version().second < max_version - 10) {
+                continue;
+            }
+        }
+        transient_size += 1;
+        rowsets.push_back(rowset);
+    }
+
+    size_t begin = 0;
+    size_t end = rowsets.size();
+    if (last_delete_version->first == -1) {
+        std::vector<RowsetMetaSharedPtr> rs_metas;
+        rs_metas.reserve(rowsets.size());
+        int64_t total_score = 0;
+        for (auto& rowset : rowsets) {
+            rs_metas.push_back(rowset->rowset_meta());
+            total_score += rowset->rowset_meta()->get_compaction_score();
+        }
+        auto runs = _split_runs(rs_metas);
+        const LevelRun* run = _pick_run(runs, max_compaction_score, total_score);
+        if (run == nullptr) {
+            return transient_size;
+        }
+        begin = run->begin;
+        end = run->end;
+    }
+
+    for (size_t i = begin; i < end && *compaction_score < max_compaction_score; ++i) {
+        *compaction_score += rowsets[i]->rowset_meta()->get_compaction_score();
+        input_rowsets->push_back(rowsets[i]);
+    }
+
+    // there is nothing to merge in a single rowset without overlapping segments
+    if (input_rowsets->size() == 1 &&
+        !input_rowsets->front()->rowset_meta()->is_segments_overlapping()) {
+        input_rowsets->clear();
+        *compaction_score = 0;
+    }
+
+    VLOG_CRITICAL << "cumulative compaction leveled policy, compaction_score = "
+                  << *compaction_score << ", tablet = " << tablet->tablet_id()
+                  << ", input_rowset size " << input_rowsets->size();
+    return transient_size;
+}
+
+} // namespace doris
@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "olap/cumulative_compaction_policy.h"
+
+namespace doris {
+
+inline constexpr std::string_view CUMULATIVE_LEVELED_POLICY = "leveled";
+
+/// Leveled cumulative compaction policy implementation, intended for tables with a steady stream of
+/// small loads such as merge-on-write upserts.
+/// The rowsets after the cumulative point are put on levels by disk size: level 0 holds rowsets
+/// smaller than base_level_size and each next level is size_ratio times bigger. A run of
+/// consecutive rowsets on the same level is compacted into one rowset of the next level once its
+/// compaction score reaches size_ratio, so every row is rewritten about once per level, and the
+/// number of rowsets that loads have to check stays bounded by size_ratio per level.
+/// When several runs are ready, the one whose rowsets overlap most in key range is compacted first,
+/// since overlapping rowsets are what point lookups and delete bitmap calculation pay for.
+/// The cumulative point is maintained the same way as SizeBasedCumulativeCompactionPolicy.
+class LeveledCumulativeCompactionPolicy final : public CumulativeCompactionPolicy {
+public:
+    LeveledCumulativeCompactionPolicy(
+            int64_t base_level_size = config::compaction_leveled_base_size_mbytes * 1024 * 1024,
+            int64_t size_ratio = config::compaction_leveled_size_ratio);
+    ~LeveledCumulativeCompactionPolicy() override = default;
+
+    /// Score of the run that would be picked, 0 if no run is ready.
+    uint32_t calc_cumulative_compaction_score(Tablet* tablet) override;
+
+    void calculate_cumulative_point(Tablet* tablet,
+                                    const std::vector<RowsetMetaSharedPtr>& all_rowsets,
+                                    int64_t current_cumulative_point,
+                                    int64_t* cumulative_point) override;
+
+    /// Pick the ready run with the most key range overlap, the lower level on ties. If no run is
+    /// ready but the candidates already exceed max_compaction_score, the run with the highest
+    /// score is compacted so that the tablet cannot get stuck.
+    int pick_input_rowsets(Tablet* tablet, const std::vector<RowsetSharedPtr>& candidate_rowsets,
+                           const int64_t max_compaction_score, const int64_t min_compaction_score,
+                           std::vector<RowsetSharedPtr>* input_rowsets,
+                           Version* last_delete_version, size_t* compaction_score,
+                           bool allow_delete = false) override;
+
+    void update_cumulative_point(Tablet* tablet, const std::vector<RowsetSharedPtr>& input_rowsets,
+                                 RowsetSharedPtr output_rowset,
+                                 Version& last_delete_version) override;
+
+    int64_t get_compaction_level(Tablet* tablet, const std::vector<RowsetSharedPtr>& input_rowsets,
+                                 RowsetSharedPtr output_rowset) override {
+        return 0;
+    }
+
+    std::string_view name() override { return CUMULATIVE_LEVELED_POLICY; }
+
+private:
+    /// consecutive rowsets [begin, end) on the same level
+    struct LevelRun {
+        size_t begin = 0;
+        size_t end = 0;
+        int level = 0;
+        int64_t score = 0;
+        /// number of rowsets whose key range overlaps the previous rowset of the run, plus the
+        /// rowsets whose own segments overlap
+        int64_t overlaps = 0;
+    };
+
+    int _level(int64_t size) const;
+
+    /// split version sorted rowsets into runs
+    std::vector<LevelRun> _split_runs(const std::vector<RowsetMetaSharedPtr>& rs_metas) const;
+
+    /// the run to compact, nullptr if none
+    const LevelRun* _pick_run(const std::vector<LevelRun>& runs, int64_t max_compaction_score,
+                              int64_t total_score) const;
+
+    int64_t _base_level_size;
+    int64_t _size_ratio;
+    /// owns the promotion size and cumulative point logic
+    SizeBasedCumulativeCompactionPolicy _size_based;
+};
+
+} // namespace doris
@@ -24,6 +24,7 @@
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "olap/cumulative_compaction_leveled_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
@@ -403,6 +404,8 @@ CumulativeCompactionPolicyFactory::create_cumulative_compaction_policy(
         return std::make_shared<TimeSeriesCumulativeCompactionPolicy>();
     } else if (compaction_policy == CUMULATIVE_SIZE_BASED_POLICY) {
         return std::make_shared<SizeBasedCumulativeCompactionPolicy>();
+    } else if (compaction_policy == CUMULATIVE_LEVELED_POLICY) {
+        return std::make_shared<LeveledCumulativeCompactionPolicy>();
     }
     return std::make_shared<SizeBasedCumulativeCompactionPolicy>();
 }
@@ -162,6 +162,8 @@ public:
     std::string_view name() override { return CUMULATIVE_SIZE_BASED_POLICY; }
 
 private:
+    friend class LeveledCumulativeCompactionPolicy;
+
     /// calculate promotion size using current base rowset meta size and promotion configs
     void _calc_promotion_size(Tablet* tablet, RowsetMetaSharedPtr base_rowset_meta,
                               int64_t* promotion_size);
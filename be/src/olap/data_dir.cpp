@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -61,9 +62,13 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -113,6 +118,7 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_trash_used_capacity, MetricUnit::BYTES)
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_state, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_compaction_score, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(disks_compaction_num, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(disks_compaction_io_throttle_ns, MetricUnit::NANOSECONDS);
 
 DataDir::DataDir(StorageEngine& engine, const std::string& path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium)
@@ -135,6 +141,14 @@ DataDir::DataDir(StorageEngine& engine, const std::string& path, int64_t capacit
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_state);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_score);
     INT_GAUGE_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_num);
+    INT_COUNTER_METRIC_REGISTER(_data_dir_metric_entity, disks_compaction_io_throttle_ns);
+    // unlimited until the first throttled compaction resets it from config
+    _compaction_io_limiter = std::make_unique<S3RateLimiterHolder>(
+            S3RateLimitType::UNKNOWN, 0, 0, 0, [this](int64_t sleep_ns) {
+                if (sleep_ns > 0) {
+                    disks_compaction_io_throttle_ns->increment(sleep_ns);
+                }
+            });
 }
 
 DataDir::~DataDir() {
@@ -342,6 +356,57 @@ Status DataDir::_check_incompatible_old_format_tablet() {
 }
 
 // TODO(ygl): deal with rowsets and tablets when load failed
+Status DataDir::_load_tablet_metas(
+        const std::function<bool(int64_t, int32_t, std::string_view)>& load_tablet_func) {
+    int num_threads = config::load_tablet_meta_threads_per_data_dir;
+    if (num_threads <= 1) {
+        return TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    }
+
+    // Deserializing tablet metas dominates the load time, so the metas are read from rocksdb
+    // in one thread and handed over to a thread pool in batches. Batching bounds the memory
+    // held by copied meta values.
+    std::unique_ptr<ThreadPool> pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet_meta")
+                            .set_min_threads(num_threads)
+                            .set_max_threads(num_threads)
+                            .build(&pool));
+    struct TabletMetaEntry {
+        int64_t tablet_id;
+        int32_t schema_hash;
+        std::string value;
+    };
+    constexpr size_t BATCH_SIZE = 4096;
+    std::vector<TabletMetaEntry> batch;
+    Status submit_status;
+    auto flush_batch = [&]() {
+        size_t step = (batch.size() + num_threads - 1) / num_threads;
+        for (size_t begin = 0; begin < batch.size() && submit_status.ok(); begin += step) {
+            size_t end = std::min(batch.size(), begin + step);
+            submit_status = pool->submit_func([&batch, &load_tablet_func, begin, end]() {
+                for (size_t i = begin; i < end; ++i) {
+                    load_tablet_func(batch[i].tablet_id, batch[i].schema_hash, batch[i].value);
+                }
+            });
+        }
+        pool->wait();
+        batch.clear();
+    };
+    auto collect_func = [&](int64_t tablet_id, int32_t schema_hash,
+                            std::string_view value) -> bool {
+        batch.push_back({tablet_id, schema_hash, std::string(value)});
+        if (batch.size() >= BATCH_SIZE) {
+            flush_batch();
+        }
+        return submit_status.ok();
+    };
+    Status status = TabletMetaManager::traverse_headers(_meta, collect_func);
+    flush_batch();
+    pool->shutdown();
+    RETURN_IF_ERROR(submit_status);
+    return status;
+}
+
 Status DataDir::load() {
     LOG(INFO) << "start to load tablets from " << _path;
 
@@ -414,13 +479,16 @@ Status DataDir::load() {
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    int64_t load_tablet_start_ms = MonotonicMillis();
+    std::mutex tablet_ids_mtx;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
+    auto load_tablet_func = [this, &tablet_ids_mtx, &tablet_ids, &failed_tablet_ids](
                                     int64_t tablet_id, int32_t schema_hash,
                                     std::string_view value) -> bool {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard lock(tablet_ids_mtx);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -445,7 +513,7 @@ Status DataDir::load() {
         }
         return true;
     };
-    Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    Status load_tablet_status = _load_tablet_metas(load_tablet_func);
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
                      << ", loaded tablet: " << tablet_ids.size()
@@ -462,7 +530,8 @@ Status DataDir::load() {
     } else {
         LOG(INFO) << "load tablet from meta finished"
                   << ", loaded tablet: " << tablet_ids.size()
-                  << ", error tablet: " << failed_tablet_ids.size() << ", path: " << _path;
+                  << ", error tablet: " << failed_tablet_ids.size() << ", path: " << _path
+                  << ", cost: " << MonotonicMillis() - load_tablet_start_ms << "ms";
     }
 
     for (int64_t tablet_id : tablet_ids) {
@@ -905,6 +974,25 @@ void DataDir::disks_compaction_num_increment(int64_t delta) {
     disks_compaction_num->increment(delta);
 }
 
+int64_t DataDir::throttle_compaction_io(size_t bytes) {
+    const int64_t limit_mbytes = config::compaction_io_limit_mbytes_per_sec;
+    if (limit_mbytes <= 0) {
+        return 0;
+    }
+    const int32_t idle_query_num = config::compaction_io_limit_idle_query_num;
+    auto* fragment_mgr = ExecEnv::GetInstance()->fragment_mgr();
+    if (idle_query_num >= 0 && fragment_mgr != nullptr &&
+        fragment_mgr->running_query_num() <= idle_query_num) {
+        return 0;
+    }
+    if (_compaction_io_limit_mbytes.exchange(limit_mbytes) != limit_mbytes) {
+        // allow a burst of one second worth of I/O
+        const auto limit_bytes = static_cast<size_t>(limit_mbytes) * 1024 * 1024;
+        _compaction_io_limiter->reset(limit_bytes, limit_bytes, 0);
+    }
+    return _compaction_io_limiter->add(bytes);
+}
+
 Status DataDir::move_to_trash(const std::string& tablet_path) {
     if (config::trash_file_expire_time_sec <= 0) {
         LOG(INFO) << "delete tablet dir " << tablet_path
@@ -23,14 +23,17 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "common/status.h"
+#include "cpp/s3_rate_limiter.h"
 #include "olap/olap_common.h"
 #include "util/metrics.h"
 
@@ -134,6 +137,10 @@ public:
 
     void disks_compaction_num_increment(int64_t delta);
 
+    // Account `bytes` of compaction I/O on this data dir and sleep if it exceeds
+    // config::compaction_io_limit_mbytes_per_sec. Returns the sleep time in nanoseconds.
+    int64_t throttle_compaction_io(size_t bytes);
+
     double get_usage(int64_t incoming_data_size) const {
         return _disk_capacity_bytes == 0
                        ? 0
@@ -158,6 +165,11 @@ private:
     // process will log fatal.
     Status _check_incompatible_old_format_tablet();
 
+    // Call `load_tablet_func` for every tablet meta of this data dir, in parallel when
+    // `load_tablet_meta_threads_per_data_dir` > 1. `load_tablet_func` must be thread safe.
+    Status _load_tablet_metas(
+            const std::function<bool(int64_t, int32_t, std::string_view)>& load_tablet_func);
+
     int _path_gc_step {0};
 
     void _perform_tablet_gc(const std::string& tablet_schema_hash_path, int16_t shard_name);
@@ -190,6 +202,10 @@ private:
     mutable std::mutex _mutex;
     std::set<TabletInfo> _tablet_set;
 
+    // token bucket shared by all compaction tasks on this data dir
+    std::unique_ptr<S3RateLimiterHolder> _compaction_io_limiter;
+    std::atomic<int64_t> _compaction_io_limit_mbytes {0};
+
     OlapMeta* _meta = nullptr;
 
     std::shared_ptr<MetricEntity> _data_dir_metric_entity;
@@ -201,6 +217,7 @@ private:
     IntGauge* disks_state = nullptr;
     IntGauge* disks_compaction_score = nullptr;
     IntGauge* disks_compaction_num = nullptr;
+    IntCounter* disks_compaction_io_throttle_ns = nullptr;
 };
 
 } // namespace doris
@@ -74,6 +74,16 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t num) {
+    size_t i = 0;
+    for (; i < num && _type != HLL_DATA_SPARSE && _type != HLL_DATA_FULL; ++i) {
+        update(hash_values[i]);
+    }
+    for (; i < num; ++i) {
+        _update_registers(hash_values[i]);
+    }
+}
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -205,6 +205,10 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Same as calling update() for every hash value, but once the explicit set is converted
+    // to registers, the rest values are put into registers without checking the type.
+    void update_batch(const uint64_t* hash_values, size_t num);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
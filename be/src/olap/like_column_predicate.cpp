@@ -17,6 +17,8 @@
 
 #include "olap/like_column_predicate.h"
 
+#include <string.h>
+
 #include "runtime/define_primitive_type.h"
 #include "udf/udf.h"
 #include "vec/columns/columns_number.h"
@@ -36,6 +38,13 @@ LikeColumnPredicate<T>::LikeColumnPredicate(bool opposite, uint32_t column_id,
     _state = reinterpret_cast<StateType*>(
             fn_ctx->get_function_state(doris::FunctionContext::THREAD_LOCAL));
     static_cast<void>(_state->search_state.clone(_like_state));
+    for (size_t i = 0; i < pattern.size; ++i) {
+        char c = pattern.data[i];
+        if (c == '%' || c == '_' || c == '\\') {
+            break;
+        }
+        _literal_prefix.push_back(c);
+    }
 }
 
 template <PrimitiveType T>
@@ -50,6 +59,40 @@ void LikeColumnPredicate<T>::evaluate_and_vec(const vectorized::IColumn& column,
     _evaluate_vec<true>(column, size, flags);
 }
 
+template <PrimitiveType T>
+bool LikeColumnPredicate<T>::evaluate_and(const StringRef* dict_words, const size_t count) const {
+    for (size_t i = 0; i != count; ++i) {
+        StringRef word = dict_words[i];
+        if constexpr (T == TYPE_CHAR) {
+            word.size = strnlen(word.data, word.size);
+        }
+        unsigned char flag = 0;
+        static_cast<void>((_state->scalar_function)(
+                const_cast<vectorized::LikeSearchState*>(&_like_state), word, pattern, &flag));
+        if (_opposite ^ flag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <PrimitiveType T>
+const std::vector<vectorized::UInt8>& LikeColumnPredicate<T>::_dict_code_flags(
+        const vectorized::ColumnDictionary<vectorized::Int32>& column) const {
+    auto& code_flags = _segment_id_to_dict_code_flags[column.get_rowset_segment_id()];
+    if (code_flags.size() != column.dict_size()) {
+        code_flags.resize(column.dict_size());
+        for (size_t code = 0; code < code_flags.size(); ++code) {
+            StringRef word = column.get_shrink_value(static_cast<vectorized::Int32>(code));
+            unsigned char flag = 0;
+            static_cast<void>((_state->scalar_function)(
+                    const_cast<vectorized::LikeSearchState*>(&_like_state), word, pattern, &flag));
+            code_flags[code] = _opposite ^ flag;
+        }
+    }
+    return code_flags;
+}
+
 template <PrimitiveType T>
 uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& column, uint16_t* sel,
                                                  uint16_t size) const {
@@ -62,16 +105,12 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr = vectorized::check_and_get_column<
                     vectorized::ColumnDictionary<vectorized::Int32>>(nested_col);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& code_flags = _dict_code_flags(*nested_col_ptr);
             if (!nullable_col->has_null()) {
                 for (uint16_t i = 0; i != size; i++) {
                     uint16_t idx = sel[i];
                     sel[new_size] = idx;
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    static_cast<void>((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += code_flags[data_array[idx]];
                 }
             } else {
                 for (uint16_t i = 0; i != size; i++) {
@@ -81,13 +120,7 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
                         new_size += _opposite;
                         continue;
                     }
-
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    static_cast<void>((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += code_flags[data_array[idx]];
                 }
             }
         } else {
@@ -127,15 +160,11 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr = vectorized::check_and_get_column<
                     vectorized::ColumnDictionary<vectorized::Int32>>(column);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& code_flags = _dict_code_flags(*nested_col_ptr);
             for (uint16_t i = 0; i != size; i++) {
                 uint16_t idx = sel[i];
                 sel[new_size] = idx;
-                StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                unsigned char flag = 0;
-                static_cast<void>((_state->scalar_function)(
-                        const_cast<vectorized::LikeSearchState*>(&_like_state),
-                        StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                new_size += _opposite ^ flag;
+                new_size += code_flags[data_array[idx]];
             }
         } else {
             const vectorized::PredicateColumnType<T>* str_col =
@@ -19,16 +19,21 @@
 #include <glog/logging.h>
 #include <stdint.h>
 
+#include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <functional>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "olap/column_predicate.h"
 #include "olap/rowset/segment_v2/bloom_filter.h"
+#include "olap/wrapper_field.h"
+#include "util/slice.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_dictionary.h"
 #include "vec/columns/column_nullable.h"
@@ -87,6 +92,22 @@ public:
     }
     bool can_do_bloom_filter(bool ngram) const override { return ngram; }
 
+    // Every value matching the pattern starts with its literal prefix, so a zone map whose
+    // range holds no string with that prefix can not match.
+    bool evaluate_and(const std::pair<WrapperField*, WrapperField*>& statistic) const override {
+        if (_opposite || _literal_prefix.empty() || statistic.first->is_null()) {
+            return true;
+        }
+        const auto* min_value = reinterpret_cast<const Slice*>(statistic.first->cell_ptr());
+        const auto* max_value = reinterpret_cast<const Slice*>(statistic.second->cell_ptr());
+        StringRef prefix(_literal_prefix.data(), _literal_prefix.size());
+        StringRef min_head(min_value->data, std::min(min_value->size, prefix.size));
+        StringRef max_ref(max_value->data, max_value->size);
+        return min_head <= prefix && max_ref >= prefix;
+    }
+
+    bool evaluate_and(const StringRef* dict_words, const size_t count) const override;
+
 private:
     uint16_t _evaluate_inner(const vectorized::IColumn& column, uint16_t* sel,
                              uint16_t size) const override;
@@ -102,6 +123,7 @@ private:
                 auto* nested_col_ptr = vectorized::check_and_get_column<
                         vectorized::ColumnDictionary<vectorized::Int32>>(nested_col);
                 auto& data_array = nested_col_ptr->get_data();
+                const auto& code_flags = _dict_code_flags(*nested_col_ptr);
                 for (uint16_t i = 0; i < size; i++) {
                     if (null_map_data[i]) {
                         if constexpr (is_and) {
@@ -112,19 +134,10 @@ private:
                         continue;
                     }
 
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[i]);
                     if constexpr (is_and) {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] &= _opposite ^ flag;
+                        flags[i] &= code_flags[data_array[i]];
                     } else {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] = _opposite ^ flag;
+                        flags[i] = code_flags[data_array[i]];
                     }
                 }
             } else {
@@ -136,20 +149,12 @@ private:
                 auto* nested_col_ptr = vectorized::check_and_get_column<
                         vectorized::ColumnDictionary<vectorized::Int32>>(column);
                 auto& data_array = nested_col_ptr->get_data();
+                const auto& code_flags = _dict_code_flags(*nested_col_ptr);
                 for (uint16_t i = 0; i < size; i++) {
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[i]);
                     if constexpr (is_and) {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] &= _opposite ^ flag;
+                        flags[i] &= code_flags[data_array[i]];
                     } else {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] = _opposite ^ flag;
+                        flags[i] = code_flags[data_array[i]];
                     }
                 }
             } else {
@@ -159,6 +164,11 @@ private:
         }
     }
 
+    // Runs the matcher once per word of the segment dictionary, rows of a dict encoded column
+    // are then filtered by their code instead of matching the string of every row.
+    const std::vector<vectorized::UInt8>& _dict_code_flags(
+            const vectorized::ColumnDictionary<vectorized::Int32>& column) const;
+
     std::string _debug_string() const override {
         std::string info = "LikeColumnPredicate";
         return info;
@@ -175,7 +185,12 @@ private:
     // Hyperscan API. So here _like_state is separate for each instance of
     // LikeColumnPredicate.
     vectorized::LikeSearchState _like_state;
+    // _opposite ^ match of each dictionary word, indexed by dict code
+    mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
+            _segment_id_to_dict_code_flags;
     std::unique_ptr<segment_v2::BloomFilter> _page_ng_bf; // for ngram-bf index
+    // chars of the pattern before its first wildcard or escape, used for zone map pruning
+    std::string _literal_prefix;
 };
 
 } // namespace doris
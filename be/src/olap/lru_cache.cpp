@@ -4,6 +4,7 @@
 
 #include "olap/lru_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <new>
@@ -28,6 +29,7 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS)
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_miss_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_stampede_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_admission_reject_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
@@ -165,6 +167,60 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
+void FrequencySketch::ensure_capacity(size_t num_keys) {
+    size_t num_words = 64;
+    while (num_words < num_keys) {
+        num_words <<= 1;
+    }
+    _table.assign(num_words, 0);
+    _sample_size = 10 * num_words;
+    _size = 0;
+}
+
+std::pair<size_t, uint32_t> FrequencySketch::_counter_of(uint32_t hash, uint32_t depth) const {
+    static constexpr uint64_t SEEDS[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                         0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (hash + SEEDS[depth]) * SEEDS[(depth + 1) % 4];
+    h ^= h >> 32;
+    // each hash function owns 4 of the 16 counters of a word
+    return {static_cast<size_t>(h) & (_table.size() - 1),
+            (depth << 2) | static_cast<uint32_t>(h >> 62)};
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    DCHECK(!_table.empty());
+    bool added = false;
+    for (uint32_t depth = 0; depth < 4; ++depth) {
+        auto [word, counter] = _counter_of(hash, depth);
+        const uint32_t shift = counter << 2;
+        if (((_table[word] >> shift) & 0xfULL) != 0xfULL) {
+            _table[word] += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_size == _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::frequency(uint32_t hash) const {
+    DCHECK(!_table.empty());
+    uint32_t frequency = 0xf;
+    for (uint32_t depth = 0; depth < 4; ++depth) {
+        auto [word, counter] = _counter_of(hash, depth);
+        frequency = std::min(frequency,
+                             static_cast<uint32_t>((_table[word] >> (counter << 2)) & 0xfULL));
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _size /= 2;
+}
+
 LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
@@ -212,6 +268,11 @@ uint64_t LRUCache::get_stampede_count() {
     return _stampede_count;
 }
 
+uint64_t LRUCache::get_admission_reject_count() {
+    std::lock_guard l(_mutex);
+    return _admission_reject_count;
+}
+
 uint64_t LRUCache::get_miss_count() {
     std::lock_guard l(_mutex);
     return _miss_count;
@@ -289,6 +350,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
     std::lock_guard l(_mutex);
     ++_lookup_count;
+    if (_is_tinylfu) {
+        _frequency_sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
@@ -457,6 +521,37 @@ bool LRUCache::_lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key
     return false;
 }
 
+// TinyLFU admission: once the shard is full, a new entry is only cached if its key has been
+// accessed more often recently than the normal priority entry it would evict first. A scan
+// touching each key once then cannot flush entries that are hit repeatedly.
+bool LRUCache::_tinylfu_admit(const CacheKey& key, uint32_t hash, size_t total_size,
+                              CachePriority priority) {
+    if (_table.element_count() >= _frequency_sketch.capacity()) {
+        _frequency_sketch.ensure_capacity(2 * static_cast<size_t>(_table.element_count()));
+    }
+    _frequency_sketch.increment(hash);
+    if (priority == CachePriority::DURABLE ||
+        (_usage + total_size <= _capacity && !_check_element_count_limit())) {
+        return true;
+    }
+    // replacing an entry must not leave the old value in cache
+    if (_table.lookup(key, hash) != nullptr) {
+        return true;
+    }
+    LRUHandle* victim = nullptr;
+    if (_cache_value_check_timestamp) {
+        if (!_sorted_normal_entries_with_timestamp.empty()) {
+            victim = _sorted_normal_entries_with_timestamp.begin()->second;
+        }
+    } else if (_lru_normal.next != &_lru_normal) {
+        victim = _lru_normal.next;
+    }
+    if (victim == nullptr) {
+        return true;
+    }
+    return _frequency_sketch.frequency(hash) > _frequency_sketch.frequency(victim->hash);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -484,6 +579,11 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             return reinterpret_cast<Cache::Handle*>(e);
         }
 
+        if (_is_tinylfu && !_tinylfu_admit(key, hash, e->total_size, priority)) {
+            ++_admission_reject_count;
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
         if (_cache_value_check_timestamp) {
@@ -635,6 +735,14 @@ void LRUCache::set_cache_value_check_timestamp(bool cache_value_check_timestamp)
     _cache_value_check_timestamp = cache_value_check_timestamp;
 }
 
+void LRUCache::set_tinylfu_admission(bool tinylfu_admission) {
+    std::lock_guard l(_mutex);
+    _is_tinylfu = tinylfu_admission;
+    if (_is_tinylfu && _frequency_sketch.capacity() == 0) {
+        _frequency_sketch.ensure_capacity(_table.element_count());
+    }
+}
+
 inline uint32_t ShardedLRUCache::_hash_slice(const CacheKey& s) {
     return s.hash(s.data(), s.size(), 0);
 }
@@ -672,6 +780,7 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
     INT_COUNTER_METRIC_REGISTER(_entity, cache_lookup_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_stampede_count);
+    INT_COUNTER_METRIC_REGISTER(_entity, cache_admission_reject_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_miss_count);
     DOUBLE_GAUGE_METRIC_REGISTER(_entity, cache_hit_ratio);
 
@@ -725,6 +834,28 @@ size_t ShardedLRUCache::get_capacity() {
     return _capacity;
 }
 
+uint64_t ShardedLRUCache::get_lookup_count() {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
+void ShardedLRUCache::set_tinylfu_admission(bool tinylfu_admission) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_tinylfu_admission(tinylfu_admission);
+    }
+}
+
 Cache::Handle* ShardedLRUCache::insert(const CacheKey& key, void* value, size_t charge,
                                        CachePriority priority) {
     const uint32_t hash = _hash_slice(key);
@@ -798,6 +929,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_element_count = 0;
     size_t total_miss_count = 0;
     size_t total_stampede_count = 0;
+    size_t total_admission_reject_count = 0;
 
     for (int i = 0; i < _num_shards; i++) {
         capacity += _shards[i]->get_capacity();
@@ -807,6 +939,7 @@ void ShardedLRUCache::update_cache_metrics() const {
         total_element_count += _shards[i]->get_element_count();
         total_miss_count += _shards[i]->get_miss_count();
         total_stampede_count += _shards[i]->get_stampede_count();
+        total_admission_reject_count += _shards[i]->get_admission_reject_count();
     }
 
     cache_capacity->set_value(capacity);
@@ -816,6 +949,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     cache_hit_count->set_value(total_hit_count);
     cache_miss_count->set_value(total_miss_count);
     cache_stampede_count->set_value(total_stampede_count);
+    cache_admission_reject_count->set_value(total_admission_reject_count);
     cache_usage_ratio->set_value(
             capacity == 0 ? 0 : (static_cast<double>(total_usage) / static_cast<double>(capacity)));
     cache_hit_ratio->set_value(total_lookup_count == 0 ? 0
@@ -19,6 +19,7 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
@@ -214,6 +215,11 @@ public:
 
     virtual size_t get_element_count() = 0;
 
+    // Cumulative lookup and hit counts, used to estimate the value of the cache
+    // when its capacity is adjusted under memory pressure.
+    virtual uint64_t get_lookup_count() { return 0; }
+    virtual uint64_t get_hit_count() { return 0; }
+
 private:
     DISALLOW_COPY_AND_ASSIGN(Cache);
 };
@@ -305,6 +311,28 @@ private:
 // because the begin element's timestamp is the oldest.
 using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 
+// Count-Min sketch with 4-bit counters, estimates how often a key hash has been accessed
+// recently. All counters are halved every sample_size increments so old history ages out.
+class FrequencySketch {
+public:
+    // Size the sketch for about num_keys distinct keys, the history is cleared.
+    void ensure_capacity(size_t num_keys);
+    size_t capacity() const { return _table.size(); }
+
+    void increment(uint32_t hash);
+    uint32_t frequency(uint32_t hash) const;
+
+private:
+    // the word and the counter in it for one of the 4 hash functions
+    std::pair<size_t, uint32_t> _counter_of(uint32_t hash, uint32_t depth) const;
+    void _reset();
+
+    // 16 counters per word
+    std::vector<uint64_t> _table;
+    size_t _sample_size = 0;
+    size_t _size = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -336,11 +364,13 @@ public:
 
     void set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor);
     void set_cache_value_check_timestamp(bool cache_value_check_timestamp);
+    void set_tinylfu_admission(bool tinylfu_admission);
 
     uint64_t get_lookup_count();
     uint64_t get_hit_count();
     uint64_t get_miss_count();
     uint64_t get_stampede_count();
+    uint64_t get_admission_reject_count();
 
     size_t get_usage();
     size_t get_capacity();
@@ -355,6 +385,8 @@ private:
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    bool _tinylfu_admit(const CacheKey& key, uint32_t hash, size_t total_size,
+                        CachePriority priority);
 
 private:
     LRUCacheType _type;
@@ -392,6 +424,11 @@ private:
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    // TinyLFU admission, see _tinylfu_admit()
+    bool _is_tinylfu = false;
+    FrequencySketch _frequency_sketch;
+    uint64_t _admission_reject_count = 0;
 };
 
 class ShardedLRUCache : public Cache {
@@ -410,6 +447,10 @@ public:
     size_t get_element_count() override;
     PrunedInfo set_capacity(size_t capacity) override;
     size_t get_capacity() override;
+    uint64_t get_lookup_count() override;
+    uint64_t get_hit_count() override;
+
+    void set_tinylfu_admission(bool tinylfu_admission);
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
@@ -448,6 +489,7 @@ private:
     IntCounter* cache_hit_count = nullptr;
     IntCounter* cache_miss_count = nullptr;
     IntCounter* cache_stampede_count = nullptr;
+    IntCounter* cache_admission_reject_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
     // bvars
     std::unique_ptr<bvar::Adder<uint64_t>> _hit_count_bvar;
@@ -19,10 +19,12 @@
 
 #include <fmt/format.h>
 #include <gen_cpp/olap_file.pb.h>
+#include <parallel_hashmap/phmap.h>
 #include <pdqsort.h>
 
 #include <algorithm>
 #include <limits>
+#include <type_traits>
 #include <string>
 #include <vector>
 
@@ -40,6 +42,8 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
 
 namespace doris {
 
@@ -295,28 +299,277 @@ Status MemTable::_put_into_output(vectorized::Block& in_block) {
                                           row_pos_vec.data() + in_block.rows());
 }
 
-size_t MemTable::_sort() {
-    SCOPED_RAW_TIMER(&_stat.sort_ns);
-    _stat.sort_times++;
-    size_t same_keys_num = 0;
-    // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks.size());
+void radix_sort_by_normalized_key(std::vector<std::pair<uint64_t, RowInBlock*>>& rows,
+                                  size_t key_bytes) {
+    std::vector<std::pair<uint64_t, RowInBlock*>> buffer(rows.size());
+    for (size_t pass = 0; pass < key_bytes; ++pass) {
+        const size_t shift = pass * 8;
+        size_t counts[256] = {0};
+        for (const auto& row : rows) {
+            counts[(row.first >> shift) & 0xFF]++;
+        }
+        if (counts[(rows[0].first >> shift) & 0xFF] == rows.size()) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t& count : counts) {
+            size_t c = count;
+            count = offset;
+            offset += c;
+        }
+        for (const auto& row : rows) {
+            buffer[counts[(row.first >> shift) & 0xFF]++] = row;
+        }
+        rows.swap(buffer);
+    }
+}
+
+// Byte comparable encoding of a fixed width key column value, nullptr if the column type can
+// not be normalized.
+using NormalizeKeyFunc = uint64_t (*)(const char* data, size_t row);
+
+template <typename T>
+uint64_t normalize_key(const char* data, size_t row) {
+    T value;
+    memcpy(&value, data + row * sizeof(T), sizeof(T));
+    auto key = static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(value));
+    if constexpr (std::is_signed_v<T>) {
+        // flip the sign bit so that negative values sort before positive ones
+        key ^= uint64_t(1) << (sizeof(T) * 8 - 1);
+    }
+    return key;
+}
+
+static NormalizeKeyFunc get_normalize_key_func(FieldType type, size_t* width) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_BOOL:
+        *width = sizeof(uint8_t);
+        return normalize_key<uint8_t>;
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+        *width = sizeof(int8_t);
+        return normalize_key<int8_t>;
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        *width = sizeof(int16_t);
+        return normalize_key<int16_t>;
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        *width = sizeof(int32_t);
+        return normalize_key<int32_t>;
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        *width = sizeof(int64_t);
+        return normalize_key<int64_t>;
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+        *width = sizeof(uint32_t);
+        return normalize_key<uint32_t>;
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+        *width = sizeof(uint64_t);
+        return normalize_key<uint64_t>;
+    default:
+        return nullptr;
+    }
+}
+
+size_t MemTable::_radix_sort_by_prefix_keys(std::vector<RowInBlock*>& row_in_blocks,
+                                           size_t begin, Tie& tie) {
+    struct PrefixKeyColumn {
+        const char* data;
+        const uint8_t* null_map;
+        NormalizeKeyFunc normalize;
+        size_t bits;
+    };
+    std::vector<PrefixKeyColumn> key_columns;
+    size_t total_bits = 0;
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+        size_t width = 0;
+        auto normalize = get_normalize_key_func(_tablet_schema->column(i).type(), &width);
+        if (normalize == nullptr) {
+            break;
+        }
+        const auto* column = _input_mutable_block.get_column_by_position(i).get();
+        const uint8_t* null_map = nullptr;
+        if (column->is_nullable()) {
+            const auto* nullable = assert_cast<const vectorized::ColumnNullable*>(column);
+            null_map = nullable->get_null_map_data().data();
+            column = nullable->get_nested_column_ptr().get();
+        }
+        if (!column->is_fixed_and_contiguous() || column->size_of_value_if_fixed() != width) {
+            break;
+        }
+        // nullable columns take an extra byte for the null flag, nulls sort first
+        size_t bits = width * 8 + (null_map != nullptr ? 8 : 0);
+        if (total_bits + bits > 64) {
+            break;
+        }
+        key_columns.push_back({column->get_raw_data().data, null_map, normalize, bits});
+        total_bits += bits;
+    }
+    if (key_columns.empty()) {
+        return 0;
+    }
+
+    std::vector<std::pair<uint64_t, RowInBlock*>> rows;
+    rows.reserve(row_in_blocks.size() - begin);
+    for (size_t i = begin; i < row_in_blocks.size(); i++) {
+        RowInBlock* row = row_in_blocks[i];
+        uint64_t key = 0;
+        for (const auto& column : key_columns) {
+            uint64_t value = 0;
+            if (column.null_map == nullptr) {
+                value = column.normalize(column.data, row->_row_pos);
+            } else if (!column.null_map[row->_row_pos]) {
+                value = (uint64_t(1) << (column.bits - 8)) |
+                        column.normalize(column.data, row->_row_pos);
+            }
+            // shifting by 64 is undefined, the first column may take all the bits
+            key = column.bits == 64 ? value : (key << column.bits) | value;
+        }
+        rows.emplace_back(key, row);
+    }
+    radix_sort_by_normalized_key(rows, (total_bits + 7) / 8);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        size_t pos = begin + i;
+        row_in_blocks[pos] = rows[i].second;
+        tie[static_cast<int>(pos)] = i > 0 && rows[i - 1].first == rows[i].first;
+    }
+    return key_columns.size();
+}
+
+void MemTable::_sort_by_key_columns(std::vector<RowInBlock*>& row_in_blocks, size_t begin,
+                                    Tie& tie) {
+    size_t sorted_key_columns = 0;
+    if (config::enable_memtable_radix_sort && row_in_blocks.size() > begin) {
+        sorted_key_columns = _radix_sort_by_prefix_keys(row_in_blocks, begin, tie);
+    }
+    for (size_t i = sorted_key_columns; i < _tablet_schema->num_key_columns(); i++) {
         auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
         };
-        _sort_one_column(_row_in_blocks, tie, cmp);
+        _sort_one_column(row_in_blocks, tie, cmp);
+    }
+}
+
+bool MemTable::_sort_by_key_groups(size_t* same_keys_num) {
+    // Rows holding the same key are chained into one group, only the first row of every group
+    // is sorted. Grouping is abandoned when the sampled rows are mostly distinct, since sorting
+    // them directly is cheaper then.
+    constexpr size_t SAMPLE_ROWS = 4096;
+    constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    struct KeyGroup {
+        uint32_t head;
+        uint32_t tail;
+        uint32_t size;
+        // next group with the same hash
+        uint32_t next_group;
+    };
+    const size_t num_new_rows = _row_in_blocks.size() - _last_sorted_pos;
+    if (num_new_rows < 2 || num_new_rows >= NONE) {
+        return false;
+    }
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    auto row_at = [&](uint32_t i) { return _row_in_blocks[_last_sorted_pos + i]; };
+
+    std::vector<KeyGroup> groups;
+    std::vector<uint32_t> next_row(num_new_rows, NONE);
+    phmap::flat_hash_map<uint64_t, uint32_t> hash_to_group;
+    for (uint32_t i = 0; i < num_new_rows; i++) {
+        if (i == SAMPLE_ROWS && groups.size() * 2 > SAMPLE_ROWS) {
+            return false;
+        }
+        RowInBlock* row = row_at(i);
+        uint64_t hash = 0;
+        for (size_t cid = 0; cid < _tablet_schema->num_key_columns(); cid++) {
+            _input_mutable_block.get_column_by_position(cid)->update_xxHash_with_value(
+                    row->_row_pos, row->_row_pos + 1, hash, nullptr);
+        }
+        auto [it, inserted] =
+                hash_to_group.try_emplace(hash, static_cast<uint32_t>(groups.size()));
+        uint32_t group_id = it->second;
+        if (!inserted) {
+            while (group_id != NONE &&
+                   (*_vec_row_comparator)(row_at(groups[group_id].head), row) != 0) {
+                group_id = groups[group_id].next_group;
+            }
+        }
+        if (inserted || group_id == NONE) {
+            groups.push_back({.head = i, .tail = i, .size = 1, .next_group = NONE});
+            if (!inserted) {
+                // link the new group after the first group of the same hash
+                groups.back().next_group = groups[it->second].next_group;
+                groups[it->second].next_group = static_cast<uint32_t>(groups.size() - 1);
+            }
+            continue;
+        }
+        next_row[groups[group_id].tail] = i;
+        groups[group_id].tail = i;
+        groups[group_id].size++;
+    }
+
+    std::vector<RowInBlock*> heads;
+    heads.reserve(groups.size());
+    phmap::flat_hash_map<const RowInBlock*, uint32_t> head_to_group;
+    head_to_group.reserve(groups.size());
+    for (uint32_t group_id = 0; group_id < groups.size(); group_id++) {
+        heads.push_back(row_at(groups[group_id].head));
+        head_to_group.emplace(heads.back(), group_id);
+    }
+    // the heads are distinct, no tie is left after sorting by all key columns
+    Tie tie = Tie(0, heads.size());
+    _sort_by_key_columns(heads, 0, tie);
+
+    // rows of a group keep their insert order, the same as sorting equal keys by _row_pos
+    std::vector<RowInBlock*> sorted_rows;
+    sorted_rows.reserve(num_new_rows);
+    for (const RowInBlock* head : heads) {
+        const auto& group = groups[head_to_group[head]];
+        for (uint32_t i = group.head; i != NONE; i = next_row[i]) {
+            sorted_rows.push_back(row_at(i));
+        }
+        if (group.size > 1) {
+            *same_keys_num += group.size;
+        }
+    }
+    std::copy(sorted_rows.begin(), sorted_rows.end(),
+              std::next(_row_in_blocks.begin(), _last_sorted_pos));
+    return true;
+}
+
+bool MemTable::_new_rows_in_key_order() {
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    // random input breaks the order within the first few rows, so this pass is cheap if it fails
+    for (size_t i = std::max<size_t>(_last_sorted_pos, 1); i < _row_in_blocks.size(); i++) {
+        if ((*_vec_row_comparator)(_row_in_blocks[i - 1], _row_in_blocks[i]) >= 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t MemTable::_sort() {
+    SCOPED_RAW_TIMER(&_stat.sort_ns);
+    _stat.sort_times++;
+    size_t same_keys_num = 0;
+    if (config::enable_memtable_sorted_input_detection && _new_rows_in_key_order()) {
+        // keys are distinct and already in order, the insert order is the sorted order
+        _last_sorted_pos = _row_in_blocks.size();
+        return same_keys_num;
     }
     bool is_dup = (_keys_type == KeysType::DUP_KEYS);
-    // sort extra round by _row_pos to make the sort stable
-    auto iter = tie.iter();
-    while (iter.next()) {
-        pdqsort(std::next(_row_in_blocks.begin(), iter.left()),
-                std::next(_row_in_blocks.begin(), iter.right()),
-                [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
-                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
-                });
-        same_keys_num += iter.right() - iter.left();
+    // sort new rows
+    if (is_dup || !config::enable_memtable_hash_group_by_key ||
+        !_sort_by_key_groups(&same_keys_num)) {
+        Tie tie = Tie(_last_sorted_pos, _row_in_blocks.size());
+        _sort_by_key_columns(_row_in_blocks, _last_sorted_pos, tie);
+        // sort extra round by _row_pos to make the sort stable
+        auto iter = tie.iter();
+        while (iter.next()) {
+            pdqsort(std::next(_row_in_blocks.begin(), iter.left()),
+                    std::next(_row_in_blocks.begin(), iter.right()),
+                    [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
+                        return is_dup ? lhs->_row_pos > rhs->_row_pos
+                                      : lhs->_row_pos < rhs->_row_pos;
+                    });
+            same_keys_num += iter.right() - iter.left();
+        }
     }
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
@@ -132,6 +132,11 @@ private:
     std::vector<uint8_t> _bits;
 };
 
+// Sorts `rows` by the low `key_bytes` bytes of their normalized key with a stable LSD radix
+// sort, one byte per pass. Passes whose byte is the same for all rows are skipped.
+void radix_sort_by_normalized_key(std::vector<std::pair<uint64_t, RowInBlock*>>& rows,
+                                  size_t key_bytes);
+
 class RowInBlockComparator {
 public:
     RowInBlockComparator(std::shared_ptr<TabletSchema> tablet_schema)
@@ -250,6 +255,21 @@ private:
 
     //return number of same keys
     size_t _sort();
+    // Sorts row_in_blocks[begin, end) by all key columns, rows with equal keys are left
+    // marked in `tie`.
+    void _sort_by_key_columns(std::vector<RowInBlock*>& row_in_blocks, size_t begin, Tie& tie);
+    // Sorts row_in_blocks[begin, end) by the leading fixed width key columns encoded into a byte
+    // comparable uint64 key, marking rows with equal keys in `tie`. Returns the number of key
+    // columns covered by the normalized key, 0 if the leading key column can not be normalized.
+    size_t _radix_sort_by_prefix_keys(std::vector<RowInBlock*>& row_in_blocks, size_t begin,
+                                      Tie& tie);
+    // Groups the new rows of an aggregate or unique key memtable by key with a hash table and
+    // sorts only one row of every group. Returns false without touching the rows if the keys are
+    // mostly distinct, otherwise adds the rows with duplicated keys to `same_keys_num`.
+    bool _sort_by_key_groups(size_t* same_keys_num);
+    // Returns true if the new rows follow the sorted rows in strictly increasing key order,
+    // which is common when the upstream data is already sorted, so no sort or merge is needed.
+    bool _new_rows_in_key_order();
     Status _sort_by_cluster_keys();
     void _sort_one_column(std::vector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(const RowInBlock*, const RowInBlock*)> cmp);
@@ -238,6 +238,21 @@ void MemTableFlushExecutor::init(int num_disk) {
                               .build(&_high_prio_flush_pool));
 }
 
+int64_t MemTableFlushExecutor::flush_backpressure_delay_ms() const {
+    int32_t tasks_per_thread = config::load_flush_queue_backpressure_tasks_per_thread;
+    if (tasks_per_thread <= 0 || _flush_pool == nullptr) {
+        return 0;
+    }
+    int64_t threshold = int64_t(tasks_per_thread) * std::max(1, _flush_pool->max_threads());
+    int64_t queued = _flush_pool->get_queue_size();
+    if (queued <= threshold) {
+        return 0;
+    }
+    // grow linearly with the backlog, reach the max delay when the backlog doubles the threshold
+    int64_t max_delay_ms = std::max(0, config::load_flush_queue_backpressure_max_delay_ms);
+    return std::min(max_delay_ms, (queued - threshold) * max_delay_ms / threshold);
+}
+
 // NOTE: we use SERIAL mode here to ensure all mem-tables from one tablet are flushed in order.
 Status MemTableFlushExecutor::create_flush_token(std::shared_ptr<FlushToken>& flush_token,
                                                  std::shared_ptr<RowsetWriter> rowset_writer,
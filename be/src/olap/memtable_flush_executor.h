@@ -139,6 +139,10 @@ public:
                               std::shared_ptr<RowsetWriter> rowset_writer, bool is_high_priority,
                               std::shared_ptr<WorkloadGroup> wg_sptr);
 
+    // Returns how long an add block request of a normal priority load should wait
+    // because the flush pool is backlogged, 0 if it should not wait.
+    int64_t flush_backpressure_delay_ms() const;
+
 private:
     std::unique_ptr<ThreadPool> _flush_pool;
     std::unique_ptr<ThreadPool> _high_prio_flush_pool;
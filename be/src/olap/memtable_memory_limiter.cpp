@@ -19,12 +19,15 @@
 
 #include <bvar/bvar.h>
 
+#include <tuple>
+
 #include "common/config.h"
 #include "olap/memtable.h"
 #include "olap/memtable_writer.h"
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
+#include "util/time.h"
 
 namespace doris {
 DEFINE_GAUGE_METRIC_PROTOTYPE_5ARG(memtable_memory_limiter_mem_consumption, MetricUnit::BYTES, "",
@@ -159,23 +162,36 @@ void MemTableMemoryLimiter::_flush_active_memtables(int64_t need_flush) {
         return;
     }
 
-    using WriterMem = std::pair<std::weak_ptr<MemTableWriter>, int64_t>;
-    auto cmp = [](WriterMem left, WriterMem right) { return left.second < right.second; };
+    // cold memtables first, then the largest ones
+    struct WriterMem {
+        std::weak_ptr<MemTableWriter> writer;
+        int64_t mem;
+        bool cold;
+    };
+    auto cmp = [](const WriterMem& left, const WriterMem& right) {
+        return std::tie(left.cold, left.mem) < std::tie(right.cold, right.mem);
+    };
     std::priority_queue<WriterMem, std::vector<WriterMem>, decltype(cmp)> heap(cmp);
 
+    const int64_t cold_idle_ms = config::memtable_limiter_cold_memtable_idle_ms;
+    const int64_t now_ms = MonotonicMillis();
+    int64_t num_cold = 0;
     for (auto writer : _active_writers) {
         auto w = writer.lock();
         if (w == nullptr) {
             continue;
         }
-        heap.emplace(w, w->active_memtable_mem_consumption());
+        bool cold = cold_idle_ms > 0 && now_ms - w->last_write_time_ms() >= cold_idle_ms;
+        num_cold += cold;
+        heap.push({w, w->active_memtable_mem_consumption(), cold});
     }
 
     int64_t mem_flushed = 0;
     int64_t num_flushed = 0;
 
     while (mem_flushed < need_flush && !heap.empty()) {
-        auto [writer, sort_mem] = heap.top();
+        auto writer = heap.top().writer;
+        auto sort_mem = heap.top().mem;
         heap.pop();
         auto w = writer.lock();
         if (w == nullptr) {
@@ -199,7 +215,8 @@ void MemTableMemoryLimiter::_flush_active_memtables(int64_t need_flush) {
         num_flushed += (mem > 0);
     }
     LOG(INFO) << "flushed " << num_flushed << " out of " << _active_writers.size()
-              << " active writers, flushed size: " << PrettyPrinter::print_bytes(mem_flushed);
+              << " active writers (" << num_cold << " cold), flushed size: "
+              << PrettyPrinter::print_bytes(mem_flushed);
 }
 
 void MemTableMemoryLimiter::refresh_mem_tracker() {
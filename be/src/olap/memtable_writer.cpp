@@ -105,6 +105,7 @@ Status MemTableWriter::write(const vectorized::Block* block,
     }
 
     _total_received_rows += row_idxs.size();
+    _last_write_time_ms = MonotonicMillis();
     RETURN_IF_ERROR(_mem_table->insert(block, row_idxs));
 
     if (UNLIKELY(_mem_table->need_agg() && config::enable_shrink_memory)) {
@@ -39,6 +39,7 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
 #include "util/spinlock.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -102,6 +103,9 @@ public:
 
     int64_t total_received_rows() const { return _total_received_rows; }
 
+    // monotonic time of the last write, used to find the memtables that stopped growing
+    int64_t last_write_time_ms() const { return _last_write_time_ms; }
+
     const FlushStatistic& get_flush_token_stats();
 
     uint64_t flush_running_count() const;
@@ -138,6 +142,7 @@ private:
 
     // total rows num written by MemTableWriter
     std::atomic<int64_t> _total_received_rows = 0;
+    std::atomic<int64_t> _last_write_time_ms = MonotonicMillis();
     int64_t _wait_flush_time_ns = 0;
     int64_t _close_wait_time_ns = 0;
     int64_t _segment_num = 0;
@@ -23,6 +23,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -34,6 +36,7 @@
 #include <vector>
 
 #include "common/config.h"
+#include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "olap/base_tablet.h"
@@ -51,13 +54,39 @@
 #include "olap/tablet_meta.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/thread_context.h"
 #include "util/slice.h"
+#include "util/thread.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
 #include "vec/olap/vertical_merge_iterator.h"
 
 namespace doris {
+namespace {
+
+void throttle_compaction_io(const BaseTablet& tablet, const vectorized::Block& block) {
+    if (config::compaction_io_limit_mbytes_per_sec <= 0) {
+        return;
+    }
+    // cloud tablets have no local data dir to account the I/O on
+    if (const auto* local_tablet = dynamic_cast<const Tablet*>(&tablet)) {
+        local_tablet->data_dir()->throttle_compaction_io(block.bytes());
+    }
+}
+
+} // namespace
+
+bool Merger::skip_deleted_rows_by_bitmap(const BaseTablet& tablet, ReaderType reader_type) {
+    if (!tablet.tablet_schema()->cluster_key_uids().empty()) {
+        // cluster key tables must not see deleted rows at all
+        return true;
+    }
+    // schema change reads rowsets of the base tablet, whose delete bitmap lives elsewhere
+    return config::enable_mow_compaction_skip_deleted_rows &&
+           tablet.enable_unique_key_merge_on_write() &&
+           reader_type != ReaderType::READER_ALTER_TABLE;
+}
 
 Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                               const TabletSchema& cur_tablet_schema,
@@ -90,7 +119,7 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         merge_tablet_schema->merge_dropped_columns(*del_pred_rs->tablet_schema());
     }
     reader_params.tablet_schema = merge_tablet_schema;
-    if (!tablet->tablet_schema()->cluster_key_uids().empty()) {
+    if (skip_deleted_rows_by_bitmap(*tablet, reader_type)) {
         reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
     }
 
@@ -123,6 +152,7 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         RETURN_NOT_OK_STATUS_WITH_WARN(dst_rowset_writer->add_block(&block),
                                        "failed to write block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
+        throttle_compaction_io(*tablet, block);
 
         if (reader_params.record_rowids && block.rows() > 0) {
             std::vector<uint32_t> segment_num_rows;
@@ -229,6 +259,124 @@ void Merger::vertical_split_columns(const TabletSchema& tablet_schema,
     }
 }
 
+namespace {
+
+// Runs the merge reader of one column group on its own thread, a few blocks ahead of the
+// writer, so that decoding and merging the input overlaps with encoding the output.
+// Only the prefetch thread touches the reader (and through it the RowSourcesBuffer) until
+// stop() returns.
+class GroupBlockPrefetcher {
+public:
+    GroupBlockPrefetcher(vectorized::VerticalBlockReader* reader, const TabletSchema& tablet_schema,
+                         const std::vector<uint32_t>& column_group, bool record_rowids,
+                         size_t max_blocks)
+            : _reader(reader),
+              _tablet_schema(tablet_schema),
+              _column_group(column_group),
+              _record_rowids(record_rowids),
+              _max_blocks(max_blocks) {}
+
+    ~GroupBlockPrefetcher() { stop(); }
+
+    Status start(int64_t tablet_id) {
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        return Thread::create(
+                "Compaction", "prefetch_" + std::to_string(tablet_id),
+                [this, mem_tracker]() {
+                    SCOPED_ATTACH_TASK(mem_tracker);
+                    _run();
+                },
+                &_thread);
+    }
+
+    // Same contract as VerticalBlockReader::next_block_with_aggregation. The row locations of
+    // the block are returned in `row_locations` when rowids are recorded.
+    Status next(vectorized::Block* block, std::vector<RowLocation>* row_locations, bool* eof) {
+        std::unique_lock<std::mutex> l(_lock);
+        _cv.wait(l, [this] { return !_blocks.empty() || _finished; });
+        if (_blocks.empty()) {
+            block->clear_column_data();
+            *eof = true;
+            return _status;
+        }
+        auto& prefetched = _blocks.front();
+        block->swap(prefetched.block);
+        row_locations->swap(prefetched.row_locations);
+        *eof = prefetched.eof;
+        _blocks.pop_front();
+        _cv.notify_all();
+        return Status::OK();
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            _cancelled = true;
+        }
+        _cv.notify_all();
+        if (_thread) {
+            _thread->join();
+            _thread.reset();
+        }
+    }
+
+private:
+    struct PrefetchedBlock {
+        vectorized::Block block;
+        std::vector<RowLocation> row_locations;
+        bool eof = false;
+    };
+
+    void _run() {
+        bool eof = false;
+        while (!eof) {
+            {
+                std::unique_lock<std::mutex> l(_lock);
+                _cv.wait(l, [this] { return _cancelled || _blocks.size() < _max_blocks; });
+                if (_cancelled) {
+                    break;
+                }
+            }
+            PrefetchedBlock prefetched {_tablet_schema.create_block(_column_group), {}, false};
+            Status st = [&]() -> Status {
+                RETURN_IF_CATCH_EXCEPTION(
+                        { return _reader->next_block_with_aggregation(&prefetched.block, &eof); });
+                return Status::OK();
+            }();
+            if (st.ok() && _record_rowids) {
+                prefetched.row_locations = _reader->current_block_row_locations();
+            }
+            std::lock_guard<std::mutex> l(_lock);
+            if (!st.ok()) {
+                _status = std::move(st);
+                break;
+            }
+            prefetched.eof = eof;
+            _blocks.push_back(std::move(prefetched));
+            _cv.notify_all();
+        }
+        std::lock_guard<std::mutex> l(_lock);
+        _finished = true;
+        _cv.notify_all();
+    }
+
+    vectorized::VerticalBlockReader* _reader;
+    const TabletSchema& _tablet_schema;
+    const std::vector<uint32_t>& _column_group;
+    const bool _record_rowids;
+    const size_t _max_blocks;
+
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<PrefetchedBlock> _blocks;
+    bool _finished = false;
+    bool _cancelled = false;
+    Status _status;
+    scoped_refptr<Thread> _thread;
+};
+
+} // namespace
+
 Status Merger::vertical_compact_one_group(
         BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
         bool is_key, const std::vector<uint32_t>& column_group,
@@ -264,10 +412,9 @@ Status Merger::vertical_compact_one_group(
     }
 
     reader_params.tablet_schema = merge_tablet_schema;
-    bool has_cluster_key = false;
-    if (!tablet->tablet_schema()->cluster_key_uids().empty()) {
+    bool has_cluster_key = !tablet->tablet_schema()->cluster_key_uids().empty();
+    if (skip_deleted_rows_by_bitmap(*tablet, reader_type)) {
         reader_params.delete_bitmap = &tablet->tablet_meta()->delete_bitmap();
-        has_cluster_key = true;
     }
 
     if (is_key && stats_output && stats_output->rowid_conversion) {
@@ -284,6 +431,14 @@ Status Merger::vertical_compact_one_group(
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
+    std::unique_ptr<GroupBlockPrefetcher> prefetcher;
+    std::vector<RowLocation> row_locations;
+    if (config::vertical_compaction_prefetch_blocks > 0) {
+        prefetcher = std::make_unique<GroupBlockPrefetcher>(
+                &reader, tablet_schema, reader_params.return_columns, reader_params.record_rowids,
+                config::vertical_compaction_prefetch_blocks);
+        RETURN_IF_ERROR(prefetcher->start(tablet->tablet_id()));
+    }
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         auto tablet_state = tablet->tablet_state();
         if (tablet_state != TABLET_RUNNING && tablet_state != TABLET_NOTREADY) {
@@ -292,24 +447,32 @@ Status Merger::vertical_compact_one_group(
                                                  tablet->tablet_id());
         }
         // Read one block from block reader
-        RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
-                                       "failed to read next block when merging rowsets of tablet " +
-                                               std::to_string(tablet->tablet_id()));
+        RETURN_NOT_OK_STATUS_WITH_WARN(
+                prefetcher ? prefetcher->next(&block, &row_locations, &eof)
+                           : reader.next_block_with_aggregation(&block, &eof),
+                "failed to read next block when merging rowsets of tablet " +
+                        std::to_string(tablet->tablet_id()));
         RETURN_NOT_OK_STATUS_WITH_WARN(
                 dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment,
                                                has_cluster_key),
                 "failed to write block when merging rowsets of tablet " +
                         std::to_string(tablet->tablet_id()));
+        throttle_compaction_io(*tablet, block);
 
         if (is_key && reader_params.record_rowids && block.rows() > 0) {
             std::vector<uint32_t> segment_num_rows;
             RETURN_IF_ERROR(dst_rowset_writer->get_segment_num_rows(&segment_num_rows));
-            stats_output->rowid_conversion->add(reader.current_block_row_locations(),
-                                                segment_num_rows);
+            stats_output->rowid_conversion->add(
+                    prefetcher ? row_locations : reader.current_block_row_locations(),
+                    segment_num_rows);
         }
         output_rows += block.rows();
         block.clear_column_data();
     }
+    if (prefetcher) {
+        // the reader and the row source buffer are owned by this thread again after stop()
+        prefetcher->stop();
+    }
     if (ExecEnv::GetInstance()->storage_engine().stopped()) {
         return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
                                              tablet->tablet_id());
@@ -64,6 +64,11 @@ public:
             RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, int64_t merge_way_num,
             Statistics* stats_output);
 
+    // Whether the input rows already deleted by the delete bitmap are skipped while merging.
+    // Such rows are dropped from the segment row bitmap before any page is decoded, and counted
+    // as filtered rows instead of being rewritten and marked deleted again in the output.
+    static bool skip_deleted_rows_by_bitmap(const BaseTablet& tablet, ReaderType reader_type);
+
     // for vertical compaction
     static void vertical_split_columns(const TabletSchema& tablet_schema,
                                        std::vector<std::vector<uint32_t>>* column_groups,
@@ -343,6 +343,7 @@ struct OlapReaderStatistics {
     int64_t rows_stats_filtered = 0;
     int64_t rows_stats_rp_filtered = 0;
     int64_t rows_bf_filtered = 0;
+    int64_t pages_bf_filtered = 0;
     int64_t rows_dict_filtered = 0;
     // Including the number of rows filtered out according to the Delete information in the Tablet,
     // and the number of rows filtered for marked deleted rows under the unique key model.
@@ -362,6 +363,8 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    int64_t compressed_cached_pages_num = 0;
+    int64_t read_ahead_pages_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -386,6 +389,8 @@ struct OlapReaderStatistics {
     int64_t total_segment_number = 0;
 
     io::FileCacheStatistics file_cache_stats;
+    // the pages served by the StoragePageCache
+    io::IOTierStatistics page_cache_io;
     int64_t load_segments_timer = 0;
 
     int64_t collect_iterator_merge_next_timer = 0;
@@ -22,7 +22,9 @@
 #include <fmt/ranges.h>
 #include <rocksdb/env.h>
 #include <rocksdb/iterator.h>
+#include <rocksdb/cache.h>
 #include <rocksdb/status.h>
+#include <rocksdb/table.h>
 #include <rocksdb/write_batch.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -82,6 +84,7 @@ Status OlapMeta::init() {
     options.create_missing_column_families = true;
     options.info_log = std::make_shared<RocksdbLogger>();
     options.info_log_level = rocksdb::WARN_LEVEL;
+    options.enable_pipelined_write = config::rocksdb_enable_pipelined_write;
 
     std::string db_path = _root_path + META_POSTFIX;
     std::vector<ColumnFamilyDescriptor> column_families;
@@ -93,6 +96,14 @@ Status OlapMeta::init() {
     ColumnFamilyOptions meta_column_family;
     meta_column_family.max_write_buffer_number = config::rocksdb_max_write_buffer_number;
     meta_column_family.prefix_extractor.reset(NewFixedPrefixTransform(PREFIX_LENGTH));
+    if (config::rocksdb_meta_block_cache_size_mb > 0) {
+        // shared by all data dirs, hot tablet metas of a busy disk may use the whole cache
+        static std::shared_ptr<rocksdb::Cache> s_meta_block_cache = rocksdb::NewLRUCache(
+                static_cast<size_t>(config::rocksdb_meta_block_cache_size_mb) << 20);
+        rocksdb::BlockBasedTableOptions table_options;
+        table_options.block_cache = s_meta_block_cache;
+        meta_column_family.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+    }
     column_families.emplace_back(META_COLUMN_FAMILY, meta_column_family);
 
     rocksdb::DB* db;
@@ -118,9 +129,43 @@ Status OlapMeta::init() {
     if (!s.ok() || _db == nullptr) {
         return Status::Error<META_OPEN_DB_ERROR>("rocks db open failed, reason: {}", s.ToString());
     }
+    _register_metrics();
     return Status::OK();
 }
 
+void OlapMeta::_register_metrics() {
+    auto metric_prefix = fmt::format("meta_{}", _root_path);
+    _block_cache_usage = std::make_unique<bvar::PassiveStatus<int64_t>>(
+            metric_prefix, "block_cache_usage",
+            [](void* arg) {
+                return static_cast<OlapMeta*>(arg)->_get_meta_int_property(
+                        rocksdb::DB::Properties::kBlockCacheUsage);
+            },
+            this);
+    _pending_compaction_bytes = std::make_unique<bvar::PassiveStatus<int64_t>>(
+            metric_prefix, "pending_compaction_bytes",
+            [](void* arg) {
+                return static_cast<OlapMeta*>(arg)->_get_meta_int_property(
+                        rocksdb::DB::Properties::kEstimatePendingCompactionBytes);
+            },
+            this);
+    _running_compactions = std::make_unique<bvar::PassiveStatus<int64_t>>(
+            metric_prefix, "running_compactions",
+            [](void* arg) {
+                return static_cast<OlapMeta*>(arg)->_get_meta_int_property(
+                        rocksdb::DB::Properties::kNumRunningCompactions);
+            },
+            this);
+}
+
+int64_t OlapMeta::_get_meta_int_property(const std::string& property) {
+    uint64_t value = 0;
+    if (!_db->GetIntProperty(_handles[META_COLUMN_FAMILY_INDEX].get(), property, &value)) {
+        return 0;
+    }
+    return static_cast<int64_t>(value);
+}
+
 Status OlapMeta::get(const int column_family_index, const std::string& key, std::string* value) {
     auto& handle = _handles[column_family_index];
     int64_t duration_ns = 0;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bvar/bvar.h>
 #include <rocksdb/iterator.h>
 
 #include <functional>
@@ -74,10 +75,17 @@ public:
     }
 
 private:
+    void _register_metrics();
+    int64_t _get_meta_int_property(const std::string& property);
+
     std::string _root_path;
     // keep order of _db && _handles, we need destroy _handles before _db
     std::unique_ptr<rocksdb::DB, std::function<void(rocksdb::DB*)>> _db;
     std::vector<std::unique_ptr<rocksdb::ColumnFamilyHandle>> _handles;
+    // read properties of _db, so they are destroyed before _db
+    std::unique_ptr<bvar::PassiveStatus<int64_t>> _block_cache_usage;
+    std::unique_ptr<bvar::PassiveStatus<int64_t>> _pending_compaction_bytes;
+    std::unique_ptr<bvar::PassiveStatus<int64_t>> _running_compactions;
 };
 
 } // namespace doris
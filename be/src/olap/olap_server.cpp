@@ -57,6 +57,7 @@
 #include "olap/base_tablet.h"
 #include "olap/cold_data_compaction.h"
 #include "olap/compaction_permit_limiter.h"
+#include "olap/cumulative_compaction_leveled_policy.h"
 #include "olap/cumulative_compaction_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/data_dir.h"
@@ -1007,6 +1008,9 @@ void StorageEngine::_update_cumulative_compaction_policy() {
         _cumulative_compaction_policies[CUMULATIVE_TIME_SERIES_POLICY] =
                 CumulativeCompactionPolicyFactory::create_cumulative_compaction_policy(
                         CUMULATIVE_TIME_SERIES_POLICY);
+        _cumulative_compaction_policies[CUMULATIVE_LEVELED_POLICY] =
+                CumulativeCompactionPolicyFactory::create_cumulative_compaction_policy(
+                        CUMULATIVE_LEVELED_POLICY);
     }
 }
 
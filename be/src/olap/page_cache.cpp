@@ -53,26 +53,39 @@ template class PageBase<Allocator<false>>;
 StoragePageCache* StoragePageCache::create_global_cache(size_t capacity,
                                                         int32_t index_cache_percentage,
                                                         int64_t pk_index_cache_capacity,
-                                                        uint32_t num_shards) {
+                                                        uint32_t num_shards,
+                                                        int32_t compressed_cache_percentage) {
     return new StoragePageCache(capacity, index_cache_percentage, pk_index_cache_capacity,
-                                num_shards);
+                                num_shards, compressed_cache_percentage);
 }
 
 StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                                   int64_t pk_index_cache_capacity, uint32_t num_shards)
+                                   int64_t pk_index_cache_capacity, uint32_t num_shards,
+                                   int32_t compressed_cache_percentage)
         : _index_cache_percentage(index_cache_percentage) {
+    CHECK(compressed_cache_percentage >= 0 && compressed_cache_percentage < 100)
+            << "invalid compressed data page cache percentage";
+    size_t data_capacity = 0;
     if (index_cache_percentage == 0) {
-        _data_page_cache = std::make_unique<DataPageCache>(capacity, num_shards);
+        data_capacity = capacity;
     } else if (index_cache_percentage == 100) {
         _index_page_cache = std::make_unique<IndexPageCache>(capacity, num_shards);
     } else if (index_cache_percentage > 0 && index_cache_percentage < 100) {
-        _data_page_cache = std::make_unique<DataPageCache>(
-                capacity * (100 - index_cache_percentage) / 100, num_shards);
+        data_capacity = capacity * (100 - index_cache_percentage) / 100;
         _index_page_cache = std::make_unique<IndexPageCache>(
                 capacity * index_cache_percentage / 100, num_shards);
     } else {
         CHECK(false) << "invalid index page cache percentage";
     }
+    if (index_cache_percentage != 100) {
+        size_t compressed_capacity = data_capacity * compressed_cache_percentage / 100;
+        _data_page_cache =
+                std::make_unique<DataPageCache>(data_capacity - compressed_capacity, num_shards);
+        if (compressed_capacity > 0) {
+            _compressed_data_page_cache =
+                    std::make_unique<CompressedDataPageCache>(compressed_capacity, num_shards);
+        }
+    }
 
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
 }
@@ -88,6 +101,24 @@ bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
     return true;
 }
 
+bool StoragePageCache::lookup_compressed(const CacheKey& key, PageCacheHandle* handle) {
+    DCHECK(_compressed_data_page_cache != nullptr);
+    auto* lru_handle = _compressed_data_page_cache->lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_data_page_cache.get(), lru_handle);
+    return true;
+}
+
+void StoragePageCache::insert_compressed(const CacheKey& key, DataPage* data,
+                                         PageCacheHandle* handle) {
+    DCHECK(_compressed_data_page_cache != nullptr);
+    auto* lru_handle = _compressed_data_page_cache->insert(key.encode(), data, data->capacity(),
+                                                           0, CachePriority::NORMAL);
+    *handle = PageCacheHandle(_compressed_data_page_cache.get(), lru_handle);
+}
+
 void StoragePageCache::insert(const CacheKey& key, DataPage* data, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type, bool in_memory) {
     CachePriority priority = CachePriority::NORMAL;
@@ -101,6 +101,18 @@ public:
         }
     };
 
+    // Holds data pages as they are stored in the file (compressed, without checksum), they are
+    // decompressed on hit. Same budget fits several times more pages than DataPageCache.
+    // LRU-K like DataPageCache, so pages touched by a single scan do not evict hot ones.
+    class CompressedDataPageCache : public LRUCachePolicy {
+    public:
+        CompressedDataPageCache(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::COMPRESSED_DATA_PAGE_CACHE, capacity,
+                                 LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
+                                 num_shards, DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY, true, true) {
+        }
+    };
+
     class IndexPageCache : public LRUCachePolicy {
     public:
         IndexPageCache(size_t capacity, uint32_t num_shards)
@@ -122,14 +134,17 @@ public:
     // Create global instance of this class
     static StoragePageCache* create_global_cache(size_t capacity, int32_t index_cache_percentage,
                                                  int64_t pk_index_cache_capacity,
-                                                 uint32_t num_shards = kDefaultNumShards);
+                                                 uint32_t num_shards = kDefaultNumShards,
+                                                 int32_t compressed_cache_percentage = 0);
 
     // Return global instance.
     // Client should call create_global_cache before.
     static StoragePageCache* instance() { return ExecEnv::GetInstance()->get_storage_page_cache(); }
 
+    // compressed_cache_percentage of the data page budget is given to the compressed tier
     StoragePageCache(size_t capacity, int32_t index_cache_percentage,
-                     int64_t pk_index_cache_capacity, uint32_t num_shards);
+                     int64_t pk_index_cache_capacity, uint32_t num_shards,
+                     int32_t compressed_cache_percentage = 0);
 
     // Lookup the given page in the cache.
     //
@@ -154,6 +169,14 @@ public:
         return _get_page_cache(page_type)->mem_tracker();
     }
 
+    bool has_compressed_page_cache() const { return _compressed_data_page_cache != nullptr; }
+
+    // Lookup the compressed data page tier, see lookup().
+    bool lookup_compressed(const CacheKey& key, PageCacheHandle* handle);
+
+    // Insert a compressed data page, see insert().
+    void insert_compressed(const CacheKey& key, DataPage* data, PageCacheHandle* handle);
+
 private:
     StoragePageCache();
 
@@ -164,6 +187,7 @@ private:
     // page cache to make it for flexible. we need this cache When construct
     // delete bitmap in unique key with mow
     std::unique_ptr<PKIndexPageCache> _pk_index_page_cache;
+    std::unique_ptr<CompressedDataPageCache> _compressed_data_page_cache;
 
     LRUCachePolicy* _get_page_cache(segment_v2::PageTypePB page_type) {
         switch (page_type) {
@@ -34,7 +34,7 @@ using namespace vectorized;
 
 Status ParallelScannerBuilder::build_scanners(std::list<VScannerSPtr>& scanners) {
     RETURN_IF_ERROR(_load());
-    if (_is_dup_mow_key) {
+    if (_is_dup_mow_key || _is_merge_free()) {
         return _build_scanners_by_rowid(scanners);
     } else {
         // TODO: support to split by key range
@@ -159,6 +159,22 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
     return Status::OK();
 }
 
+bool ParallelScannerBuilder::_is_merge_free() const {
+    for (const auto& [tablet_id, read_source] : _all_read_sources) {
+        int non_empty_rowsets = 0;
+        for (const auto& rs_split : read_source.rs_splits) {
+            const auto& rowset = rs_split.rs_reader->rowset();
+            if (rowset->num_rows() == 0) {
+                continue;
+            }
+            if (++non_empty_rowsets > 1 || rowset->rowset_meta()->is_segments_overlapping()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /**
  * Load rowsets of each tablet with specified version, segments of each rowset.
  */
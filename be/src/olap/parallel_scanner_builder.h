@@ -67,6 +67,11 @@ private:
 
     Status _build_scanners_by_rowid(std::list<VScannerSPtr>& scanners);
 
+    /// Rows of one key are only spread over several rowsets or overlapping segments, so
+    /// the row ranges of tablets holding a single non-overlapping rowset, e.g. fully compacted
+    /// ones, can be read by several scanners of a merge on read table without merging them.
+    bool _is_merge_free() const;
+
     std::shared_ptr<vectorized::NewOlapScanner> _build_scanner(
             BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
             TabletReader::ReadSource&& read_source);
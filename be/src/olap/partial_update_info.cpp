@@ -19,6 +19,8 @@
 
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
+
 #include "common/consts.h"
 #include "common/logging.h"
 #include "olap/base_tablet.h"
@@ -311,8 +313,19 @@ Status FixedReadPlan::read_columns_by_plan(
         for (const auto& [segment_id, mappings] : segment_row_mappings) {
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
+            // column iterators read rowids in ascending order page by page, that is the
+            // case unless the segment is sorted by cluster keys
+            const std::vector<RidAndPos>* sorted_mappings = &mappings;
+            std::vector<RidAndPos> sorted_copy;
+            auto rid_less = [](const RidAndPos& l, const RidAndPos& r) { return l.rid < r.rid; };
+            if (!std::is_sorted(mappings.begin(), mappings.end(), rid_less)) {
+                sorted_copy = mappings;
+                std::sort(sorted_copy.begin(), sorted_copy.end(), rid_less);
+                sorted_mappings = &sorted_copy;
+            }
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            rids.reserve(sorted_mappings->size());
+            for (auto [rid, pos] : *sorted_mappings) {
                 if (cur_delete_signs && cur_delete_signs[pos]) {
                     continue;
                 }
@@ -369,6 +382,19 @@ Status FixedReadPlan::fill_missing_columns(
             old_value_block, default_value_block));
     auto mutable_default_value_columns = default_value_block.mutate_columns();
 
+    // rows taking their values from old rows are gathered and appended column by column
+    std::vector<uint32_t> old_rows_to_insert;
+    auto insert_old_rows = [&]() {
+        if (old_rows_to_insert.empty()) {
+            return;
+        }
+        for (auto i = 0; i < missing_cids.size(); ++i) {
+            mutable_full_columns[missing_cids[i]]->insert_indices_from(
+                    *old_value_block.get_by_position(i).column, old_rows_to_insert.data(),
+                    old_rows_to_insert.data() + old_rows_to_insert.size());
+        }
+        old_rows_to_insert.clear();
+    };
     // fill all missing value from mutable_old_columns, need to consider default value and null value
     for (auto idx = 0; idx < use_default_or_null_flag.size(); idx++) {
         // `use_default_or_null_flag[idx] == false` doesn't mean that we should read values from the old row
@@ -381,6 +407,8 @@ Status FixedReadPlan::fill_missing_columns(
         auto pos_in_old_block = read_index[segment_pos];
         if (use_default_or_null_flag[idx] ||
             (old_delete_signs != nullptr && old_delete_signs[pos_in_old_block] != 0)) {
+            // keep the row order, old rows before this one go first
+            insert_old_rows();
             for (auto i = 0; i < missing_cids.size(); ++i) {
                 // if the column has default value, fill it with default value
                 // otherwise, if the column is nullable, fill it with null value
@@ -412,11 +440,9 @@ Status FixedReadPlan::fill_missing_columns(
             }
             continue;
         }
-        for (auto i = 0; i < missing_cids.size(); ++i) {
-            mutable_full_columns[missing_cids[i]]->insert_from(
-                    *old_value_block.get_by_position(i).column, pos_in_old_block);
-        }
+        old_rows_to_insert.push_back(pos_in_old_block);
     }
+    insert_old_rows();
     full_block.set_columns(std::move(mutable_full_columns));
     return Status::OK();
 }
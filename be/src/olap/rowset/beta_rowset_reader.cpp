@@ -34,6 +34,7 @@
 #include "olap/block_column_predicate.h"
 #include "olap/column_predicate.h"
 #include "olap/delete_handler.h"
+#include "olap/key_coder.h"
 #include "olap/olap_define.h"
 #include "olap/row_cursor.h"
 #include "olap/rowset/rowset_meta.h"
@@ -44,6 +45,8 @@
 #include "olap/schema_cache.h"
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
+#include "olap/wrapper_field.h"
+#include "util/key_util.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/olap/vgeneric_iterators.h"
@@ -51,6 +54,48 @@
 namespace doris {
 using namespace ErrorCode;
 
+namespace {
+
+// Key bounds keep the full encoded keys, these types are encoded with a fixed width and can be
+// decoded back exactly.
+bool is_decodable_key_type(FieldType type) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_BOOL:
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_DATE:
+    case FieldType::OLAP_FIELD_TYPE_DATETIME:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL32:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL64:
+    case FieldType::OLAP_FIELD_TYPE_DECIMAL128I:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Decodes the first key column of an encoded key, returns false if it is null.
+bool decode_first_key_column(const std::string& encoded_key, const KeyCoder* coder,
+                             WrapperField* field) {
+    if (encoded_key.empty() || static_cast<uint8_t>(encoded_key[0]) != KEY_NORMAL_MARKER) {
+        return false;
+    }
+    Slice slice(encoded_key.data() + 1, encoded_key.size() - 1);
+    if (!coder->decode_ascending(&slice, 0, static_cast<uint8_t*>(field->mutable_cell_ptr()))
+                 .ok()) {
+        return false;
+    }
+    field->set_not_null();
+    return true;
+}
+
+} // namespace
+
 BetaRowsetReader::BetaRowsetReader(BetaRowsetSharedPtr rowset)
         : _read_context(nullptr), _rowset(std::move(rowset)), _stats(&_owned_stats) {
     _rowset->acquire();
@@ -214,6 +259,12 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
     if (_read_options.io_ctx.expiration_time <= UnixSeconds()) {
         _read_options.io_ctx.expiration_time = 0;
     }
+    if (_read_options.io_ctx.expiration_time == 0 &&
+        read_context->hot_file_cache_expiration_time > UnixSeconds()) {
+        // keep the blocks of a hot tablet in the TTL queue, they are moved back to the NORMAL
+        // queue once the tablet is not hot anymore and the expiration time passes
+        _read_options.io_ctx.expiration_time = read_context->hot_file_cache_expiration_time;
+    }
 
     bool enable_segment_cache = true;
     auto* state = read_context->runtime_state;
@@ -242,8 +293,16 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
                                                                           segment_rows));
     }
 
+    std::vector<bool> pruned_segments;
+    _prune_segments_by_key_bounds(&pruned_segments);
+
     for (int64_t i = seg_start; i < seg_end; i++) {
         SCOPED_RAW_TIMER(&_stats->rowset_reader_create_iterators_timer_ns);
+        if (!pruned_segments.empty() && pruned_segments[i]) {
+            _stats->total_segment_number++;
+            _stats->filtered_segment_number++;
+            continue;
+        }
         std::unique_ptr<RowwiseIterator> iter;
 
         /// For iterators, we don't need to initialize them all at once when creating them.
@@ -271,6 +330,45 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
     return Status::OK();
 }
 
+void BetaRowsetReader::_prune_segments_by_key_bounds(std::vector<bool>* pruned) const {
+    if (_read_context->reader_type != ReaderType::READER_QUERY ||
+        _read_context->tablet_schema->num_key_columns() == 0) {
+        return;
+    }
+    auto pred_it = _read_options.col_id_to_predicates.find(0);
+    if (pred_it == _read_options.col_id_to_predicates.end()) {
+        return;
+    }
+    const auto& key_bounds = _rowset->rowset_meta()->get_segments_key_bounds();
+    if (key_bounds.size() != _rowset->num_segments()) {
+        return;
+    }
+    // the first key column must be stored in the same way as it is read
+    const TabletColumn& column = _read_context->tablet_schema->column(0);
+    const TabletColumn& rowset_column = _rowset->tablet_schema()->column(0);
+    if (!is_decodable_key_type(column.type()) || rowset_column.type() != column.type() ||
+        rowset_column.unique_id() != column.unique_id()) {
+        return;
+    }
+    auto min_field = WrapperField::create(column);
+    auto max_field = WrapperField::create(column);
+    if (!min_field.has_value() || !max_field.has_value()) {
+        return;
+    }
+    std::unique_ptr<WrapperField> min_value(min_field.value());
+    std::unique_ptr<WrapperField> max_value(max_field.value());
+    const KeyCoder* coder = get_key_coder(column.type());
+
+    pruned->assign(key_bounds.size(), false);
+    for (int i = 0; i < key_bounds.size(); i++) {
+        if (decode_first_key_column(key_bounds[i].min_key(), coder, min_value.get()) &&
+            decode_first_key_column(key_bounds[i].max_key(), coder, max_value.get()) &&
+            !pred_it->second->evaluate_and({min_value.get(), max_value.get()})) {
+            (*pruned)[i] = true;
+        }
+    }
+}
+
 Status BetaRowsetReader::init(RowsetReaderContext* read_context, const RowSetSplits& rs_splits) {
     _read_context = read_context;
     _read_context->rowset_id = _rowset->rowset_id();
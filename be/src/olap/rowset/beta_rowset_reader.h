@@ -90,6 +90,10 @@ private:
     [[nodiscard]] Status _init_iterator_once();
     [[nodiscard]] Status _init_iterator();
     bool _should_push_down_value_predicates() const;
+    // Marks the segments whose first key column range, decoded from the segment key bounds in
+    // rowset meta, can not satisfy the predicates on that column, so they are skipped without
+    // being opened. `pruned` is left empty if the key bounds can not be used.
+    void _prune_segments_by_key_bounds(std::vector<bool>* pruned) const;
     bool _is_merge_iterator() const {
         return _read_context->need_ordered_result &&
                _rowset->rowset_meta()->is_segments_overlapping() && _get_segment_num() > 1;
@@ -23,6 +23,7 @@
 #include <fmt/format.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <ctime> // time
 #include <filesystem>
 #include <memory>
@@ -395,8 +396,9 @@ Status BetaRowsetWriter::_find_longest_consecutive_small_segment(
     size_t task_bytes = 0;
     uint32_t task_rows = 0;
     int32_t segid;
-    for (segid = _segcompacted_point;
-         segid < last_segment && segments->size() < config::segcompaction_batch_size; segid++) {
+    const auto batch_size = _segcompaction_batch_size();
+    for (segid = _segcompacted_point; segid < last_segment && segments->size() < batch_size;
+         segid++) {
         segment_v2::SegmentSharedPtr segment;
         RETURN_IF_ERROR(_load_noncompacted_segment(segment, segid));
         const auto segment_rows = segment->num_rows();
@@ -457,6 +459,20 @@ Status BetaRowsetWriter::_find_longest_consecutive_small_segment(
     return Status::OK();
 }
 
+/**
+ * Segcompaction runs one task at a time for a rowset, so when the load flushes
+ * segments faster than they are compacted the backlog keeps growing. Let the
+ * batch grow with the backlog (up to config::segcompaction_max_batch_size) so
+ * that each task catches up; task_max_rows/bytes still bound the task size.
+ */
+int32_t BetaRowsetWriter::_segcompaction_batch_size() const {
+    const int32_t base = config::segcompaction_batch_size;
+    const int32_t max_size = std::max(base, config::segcompaction_max_batch_size);
+    // skip last (maybe active) segment
+    const int32_t backlog = _num_segment - 1 - _segcompacted_point;
+    return std::clamp(backlog, base, max_size);
+}
+
 Status BetaRowsetWriter::_rename_compacted_segments(int64_t begin, int64_t end) {
     int ret;
     auto src_seg_path = BetaRowset::local_segment_path_segcompacted(_context.tablet_path,
@@ -170,6 +170,26 @@ void RowsetMeta::set_tablet_schema(const TabletSchemaPB& tablet_schema) {
     _schema = pair.second;
 }
 
+void RowsetMeta::share_tablet_schema(const RowsetMeta& other) {
+    if (other._handle == nullptr) {
+        if (other._schema) {
+            set_tablet_schema(other._schema);
+        }
+        return;
+    }
+    auto* handle = TabletSchemaCache::instance()->acquire(other._handle);
+    if (handle == nullptr) {
+        // The entry has been erased from the cache, insert it again
+        set_tablet_schema(other._schema);
+        return;
+    }
+    if (_handle) {
+        TabletSchemaCache::instance()->release(_handle);
+    }
+    _handle = handle;
+    _schema = other._schema;
+}
+
 bool RowsetMeta::_deserialize_from_pb(std::string_view value) {
     if (!_rowset_meta_pb.ParseFromArray(value.data(), value.size())) {
         _rowset_meta_pb.Clear();
@@ -336,6 +336,9 @@ public:
 
     void set_tablet_schema(const TabletSchemaSPtr& tablet_schema);
     void set_tablet_schema(const TabletSchemaPB& tablet_schema);
+    // Share the tablet schema of `other` without serializing it again, the two rowsets
+    // must have exactly the same schema.
+    void share_tablet_schema(const RowsetMeta& other);
 
     const TabletSchemaSPtr& tablet_schema() const { return _schema; }
 
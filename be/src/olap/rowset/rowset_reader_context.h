@@ -83,6 +83,7 @@ struct RowsetReaderContext {
     // slots that cast may be eliminated in storage layer
     std::map<std::string, TypeDescriptor> target_cast_type_for_variants;
     int64_t ttl_seconds = 0;
+    int64_t hot_file_cache_expiration_time = 0;
 };
 
 } // namespace doris
@@ -0,0 +1,443 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/bit_util.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+enum { ALP_PAGE_HEADER_SIZE = 4 };
+static constexpr size_t ALP_BLOCK_SIZE = 1024;
+static constexpr size_t ALP_SAMPLE_SIZE = 32;
+
+template <typename T>
+struct AlpConstants {};
+
+template <>
+struct AlpConstants<double> {
+    static constexpr int MAX_EXPONENT = 18;
+    static constexpr double EXP10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                       1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                       1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC10[] = {1e-0,  1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                        1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                        1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpConstants<float> {
+    static constexpr int MAX_EXPONENT = 10;
+    static constexpr float EXP10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                      1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+    static constexpr float FRAC10[] = {1e-0f, 1e-1f, 1e-2f, 1e-3f, 1e-4f, 1e-5f,
+                                       1e-6f, 1e-7f, 1e-8f, 1e-9f, 1e-10f};
+};
+
+// Encoding and decoding of one value of an ALP block with `exponent` e and `factor` f:
+// encoded = round(value * 10^e * 10^-f) and value = encoded * 10^f / 10^e. Dividing by the exact
+// power of ten gives the correctly rounded decimal, i.e. the double a parsed decimal literal has.
+template <typename T>
+struct AlpCoding {
+    using Constants = AlpConstants<T>;
+    // encoded values must fit in int64 with some margin
+    static constexpr T ENCODING_LIMIT = static_cast<T>(int64_t(1) << 62);
+
+    static T decode(int64_t encoded, int exponent, int factor) {
+        return static_cast<T>(encoded) * Constants::EXP10[factor] / Constants::EXP10[exponent];
+    }
+
+    // Returns false if the value does not round trip, e.g. it has too many digits, is NaN,
+    // infinity or negative zero.
+    static bool encode(T value, int exponent, int factor, int64_t* encoded) {
+        T scaled = value * Constants::EXP10[exponent] * Constants::FRAC10[factor];
+        if (!(std::abs(scaled) < ENCODING_LIMIT)) {
+            return false;
+        }
+        *encoded = std::llround(scaled);
+        T decoded = decode(*encoded, exponent, factor);
+        return memcmp(&decoded, &value, sizeof(T)) == 0;
+    }
+};
+
+// AlpPageBuilder encodes floats and doubles with ALP (adaptive lossless floating point). Most
+// real world floating point values are decimals with few digits: for each block it picks, on a
+// sample, the exponent and factor with which most values turn into small integers that decode
+// back exactly, then stores those integers with frame of reference and bit packing. Values that
+// do not round trip are stored raw as exceptions.
+//
+// The page format is as follows:
+//
+//    <num_elements> [32-bit]
+//    blocks of up to ALP_BLOCK_SIZE values, each as
+//        <exponent> [8-bit] <factor> [8-bit] <num_exceptions> [16-bit]
+//        <min_encoded> [64-bit] <bit_width> [8-bit]
+//        <encoded values minus min_encoded> [bit_width bits each, byte aligned]
+//        <exception positions> [16-bit each] <exception values> [raw each]
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilderHelper<AlpPageBuilder<Type>> {
+public:
+    using Self = AlpPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = AlpCoding<CppType>;
+    static_assert(std::is_floating_point_v<CppType>);
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _remain_element_capacity == 0; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min(_remain_element_capacity, *count);
+        const auto* values = reinterpret_cast<const CppType*>(vals);
+        RETURN_IF_CATCH_EXCEPTION(_values.insert(_values.end(), values, values + to_add));
+        _remain_element_capacity -= to_add;
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        _finished = true;
+        RETURN_IF_CATCH_EXCEPTION({
+            _buffer.resize(ALP_PAGE_HEADER_SIZE);
+            encode_fixed32_le(_buffer.data(), static_cast<uint32_t>(_values.size()));
+            for (size_t start = 0; start < _values.size(); start += ALP_BLOCK_SIZE) {
+                _encode_block(&_values[start], std::min(ALP_BLOCK_SIZE, _values.size() - start));
+            }
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _remain_element_capacity = _options.data_page_size / sizeof(CppType);
+            _values.clear();
+            _values.reserve(_remain_element_capacity);
+            _buffer.clear();
+            _finished = false;
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _buffer.size(); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    explicit AlpPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    static int _bit_width(uint64_t range) { return range == 0 ? 0 : 64 - __builtin_clzll(range); }
+
+    // Picks the exponent and factor with the smallest estimated size on a sample of the block.
+    static std::pair<int, int> _choose_exponent_and_factor(const CppType* values, size_t n) {
+        const size_t step = std::max<size_t>(n / ALP_SAMPLE_SIZE, 1);
+        std::pair<int, int> best {0, 0};
+        size_t best_size = std::numeric_limits<size_t>::max();
+        for (int exponent = Coding::Constants::MAX_EXPONENT; exponent >= 0; --exponent) {
+            for (int factor = exponent; factor >= 0; --factor) {
+                size_t num_exceptions = 0;
+                size_t num_samples = 0;
+                int64_t min = std::numeric_limits<int64_t>::max();
+                int64_t max = std::numeric_limits<int64_t>::min();
+                for (size_t i = 0; i < n; i += step, ++num_samples) {
+                    int64_t encoded;
+                    if (Coding::encode(values[i], exponent, factor, &encoded)) {
+                        min = std::min(min, encoded);
+                        max = std::max(max, encoded);
+                    } else {
+                        ++num_exceptions;
+                    }
+                }
+                const int bit_width =
+                        min > max ? 0
+                                  : _bit_width(static_cast<uint64_t>(max) -
+                                               static_cast<uint64_t>(min));
+                const size_t size = num_samples * bit_width +
+                                    num_exceptions * (sizeof(CppType) + sizeof(uint16_t)) * 8;
+                if (size < best_size) {
+                    best_size = size;
+                    best = {exponent, factor};
+                }
+            }
+        }
+        return best;
+    }
+
+    void _encode_block(const CppType* values, size_t n) {
+        auto [exponent, factor] = _choose_exponent_and_factor(values, n);
+        int64_t encoded[ALP_BLOCK_SIZE];
+        _exception_positions.clear();
+        for (size_t i = 0; i < n; ++i) {
+            if (!Coding::encode(values[i], exponent, factor, &encoded[i])) {
+                _exception_positions.push_back(static_cast<uint16_t>(i));
+            }
+        }
+        // exceptions take the place of an encoded value so they do not widen the range
+        if (!_exception_positions.empty()) {
+            int64_t placeholder = 0;
+            for (size_t i = 0, j = 0; i < n; ++i) {
+                if (j < _exception_positions.size() && _exception_positions[j] == i) {
+                    ++j;
+                } else {
+                    placeholder = encoded[i];
+                    break;
+                }
+            }
+            for (auto position : _exception_positions) {
+                encoded[position] = placeholder;
+            }
+        }
+        int64_t min = *std::min_element(encoded, encoded + n);
+        uint64_t max_offset = 0;
+        for (size_t i = 0; i < n; ++i) {
+            max_offset = std::max(max_offset,
+                                  static_cast<uint64_t>(encoded[i]) - static_cast<uint64_t>(min));
+        }
+        const int bit_width = _bit_width(max_offset);
+
+        _buffer.push_back(static_cast<char>(exponent));
+        _buffer.push_back(static_cast<char>(factor));
+        const auto num_exceptions = static_cast<uint16_t>(_exception_positions.size());
+        _buffer.append(&num_exceptions, sizeof(num_exceptions));
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(min));
+        _buffer.push_back(static_cast<char>(bit_width));
+        if (bit_width > 0) {
+            BitWriter writer(&_packed);
+            for (size_t i = 0; i < n; ++i) {
+                writer.PutValue(static_cast<uint64_t>(encoded[i]) - static_cast<uint64_t>(min),
+                                bit_width);
+            }
+            writer.Flush();
+            _buffer.append(_packed.data(), writer.bytes_written());
+        }
+        _buffer.append(_exception_positions.data(), num_exceptions * sizeof(uint16_t));
+        for (auto position : _exception_positions) {
+            _buffer.append(&values[position], sizeof(CppType));
+        }
+    }
+
+    PageBuilderOptions _options;
+    size_t _remain_element_capacity = 0;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    std::vector<uint16_t> _exception_positions;
+    faststring _buffer;
+    faststring _packed;
+};
+
+// Decodes the whole page on init: the encoded integers are unpacked 32 at a time and turned back
+// into floats by a loop the compiler vectorizes, then the exceptions are patched.
+template <FieldType Type>
+class AlpPageDecoder : public PageDecoder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+    using Coding = AlpCoding<CppType>;
+
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        RETURN_IF_ERROR(_decode());
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (PREDICT_FALSE(_values.empty())) {
+            DCHECK_EQ(0, pos);
+            return Status::Error<ErrorCode::INVALID_ARGUMENT, false>("invalid pos");
+        }
+        DCHECK_LE(pos, _values.size());
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _values.size())) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, _values.size() - _cur_index);
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_values[_cur_index]),
+                                      max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0)) {
+            return Status::OK();
+        }
+        size_t read_count = 0;
+        _buffer.resize(*n);
+        for (size_t i = 0; i < *n; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _values.size())) {
+                break;
+            }
+            _buffer[read_count++] = _values[ord];
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    Status _decode() {
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for alp page header: {}", _data.size);
+        }
+        const auto* pos = reinterpret_cast<const uint8_t*>(_data.data);
+        const auto* end = pos + _data.size;
+        const uint32_t num_elements = decode_fixed32_le(pos);
+        pos += ALP_PAGE_HEADER_SIZE;
+        RETURN_IF_CATCH_EXCEPTION(_values.resize(num_elements));
+
+        static constexpr int64_t BLOCK_HEADER_SIZE = 13;
+        uint64_t encoded[ALP_BLOCK_SIZE];
+        for (size_t start = 0; start < num_elements; start += ALP_BLOCK_SIZE) {
+            const size_t n = std::min<size_t>(ALP_BLOCK_SIZE, num_elements - start);
+            if (end - pos < BLOCK_HEADER_SIZE) {
+                return Status::Corruption("alp page is truncated");
+            }
+            const int exponent = pos[0];
+            const int factor = pos[1];
+            uint16_t num_exceptions;
+            memcpy(&num_exceptions, pos + 2, sizeof(num_exceptions));
+            const uint64_t min = decode_fixed64_le(pos + 4);
+            const int bit_width = pos[12];
+            pos += BLOCK_HEADER_SIZE;
+            if (exponent > Coding::Constants::MAX_EXPONENT || factor > exponent ||
+                bit_width > BitPacking::MAX_BITWIDTH || num_exceptions > n) {
+                return Status::Corruption(
+                        "invalid alp block, exponent: {}, factor: {}, bit width: {}, "
+                        "exceptions: {}",
+                        exponent, factor, bit_width, num_exceptions);
+            }
+            const auto num_bytes = BitUtil::Ceil(static_cast<int64_t>(bit_width * n), 8);
+            const auto exceptions_bytes =
+                    static_cast<int64_t>(num_exceptions * (sizeof(uint16_t) + sizeof(CppType)));
+            if (end - pos < num_bytes + exceptions_bytes) {
+                return Status::Corruption("alp page is truncated");
+            }
+            if (bit_width == 0) {
+                std::fill(encoded, encoded + n, 0);
+            } else {
+                BitPacking::UnpackValues(bit_width, pos, num_bytes, n, encoded);
+                pos += num_bytes;
+            }
+            CppType* values = &_values[start];
+            for (size_t i = 0; i < n; ++i) {
+                values[i] = Coding::decode(static_cast<int64_t>(encoded[i] + min), exponent,
+                                           factor);
+            }
+            const uint8_t* exception_values = pos + num_exceptions * sizeof(uint16_t);
+            for (size_t i = 0; i < num_exceptions; ++i) {
+                uint16_t position;
+                memcpy(&position, pos + i * sizeof(uint16_t), sizeof(position));
+                if (position >= n) {
+                    return Status::Corruption("invalid alp exception position {}", position);
+                }
+                memcpy(&values[position], exception_values + i * sizeof(CppType),
+                       sizeof(CppType));
+            }
+            pos += exceptions_bytes;
+        }
+        if (pos != end) {
+            return Status::Corruption("unexpected alp page size");
+        }
+        return Status::OK();
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    size_t _cur_index = 0;
+    std::vector<CppType> _values;
+    std::vector<CppType> _buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
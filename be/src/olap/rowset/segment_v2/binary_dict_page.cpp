@@ -99,8 +99,13 @@ Status BinaryDictPageBuilder::add(const uint8_t* vals, size_t* count) {
 
             if (src->empty() && _has_empty) {
                 value_code = _empty_code;
+            } else if (_has_last && *src == _last_item) {
+                value_code = _last_code;
             } else if (auto iter = _dictionary.find(*src); iter != _dictionary.end()) {
                 value_code = iter->second;
+                _last_item = iter->first;
+                _last_code = value_code;
+                _has_last = true;
             } else {
                 Slice dict_item(src->data, src->size);
                 if (src->size > 0) {
@@ -120,6 +125,9 @@ Status BinaryDictPageBuilder::add(const uint8_t* vals, size_t* count) {
                     break;
                 }
                 _dictionary.emplace(dict_item, value_code);
+                _last_item = dict_item;
+                _last_code = value_code;
+                _has_last = true;
                 if (src->empty()) {
                     _has_empty = true;
                     _empty_code = value_code;
@@ -108,6 +108,12 @@ private:
 
     bool _has_empty = false;
     uint32_t _empty_code = 0;
+
+    // the last looked up dict item, values of low cardinality columns often come in runs
+    // after memtable sorting, comparing with it is cheaper than hashing and probing
+    Slice _last_item;
+    uint32_t _last_code = 0;
+    bool _has_last = false;
 };
 
 class BinaryDictPageDecoder : public PageDecoder {
@@ -19,6 +19,7 @@
 
 #include <assert.h>
 #include <gen_cpp/segment_v2.pb.h>
+#include <roaring/roaring.hh>
 
 #include <algorithm>
 #include <memory>
@@ -56,6 +57,7 @@
 #include "olap/tablet_schema.h"
 #include "olap/types.h" // for TypeInfo
 #include "olap/wrapper_field.h"
+#include "runtime/exec_env.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
 #include "util/binary_cast.hpp"
@@ -372,6 +374,47 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
 
+Status ColumnReader::read_ahead_page(const ColumnIteratorOptions& iter_opts,
+                                     const PagePointer& pp) const {
+    auto* pool = ExecEnv::GetInstance()->segment_page_read_ahead_thread_pool();
+    if (pool == nullptr) {
+        return Status::OK();
+    }
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(_meta_compression, &codec));
+    io::IOContext io_ctx = iter_opts.io_ctx;
+    // the query may be finished before the page is read, do not refer to its objects
+    io_ctx.query_id = nullptr;
+    io_ctx.file_cache_stats = nullptr;
+    return pool->submit_func([file_reader = _file_reader, pp, codec, io_ctx,
+                              verify_checksum = _opts.verify_checksum,
+                              kept_in_memory = _opts.kept_in_memory,
+                              encoding_info = _encoding_info]() {
+        OlapReaderStatistics stats;
+        PageReadOptions opts {
+                .verify_checksum = verify_checksum,
+                .use_page_cache = true,
+                .kept_in_memory = kept_in_memory,
+                .type = DATA_PAGE,
+                .file_reader = file_reader.get(),
+                .page_pointer = pp,
+                .codec = codec,
+                .stats = &stats,
+                .encoding_info = encoding_info,
+                .io_ctx = io_ctx,
+        };
+        PageHandle handle;
+        Slice page_body;
+        PageFooterPB footer;
+        Status st = PageIO::read_and_decompress_page(opts, &handle, &page_body, &footer);
+        if (!st.ok()) {
+            // the page will be read again by the iterator, which reports the error
+            LOG(WARNING) << "failed to read ahead page " << pp << " of "
+                         << file_reader->path().native() << ": " << st;
+        }
+    });
+}
+
 Status ColumnReader::get_row_ranges_by_zone_map(
         const AndBlockColumnPredicate* col_predicates,
         const std::vector<const ColumnPredicate*>* delete_predicates, RowRanges* row_ranges,
@@ -595,6 +638,8 @@ Status ColumnReader::get_row_ranges_by_bloom_filter(const AndBlockColumnPredicat
         if (col_predicates->evaluate_and(bf.get())) {
             bf_row_ranges.add(RowRange(_ordinal_index->get_first_ordinal(pid),
                                        _ordinal_index->get_last_ordinal(pid) + 1));
+        } else if (iter_opts.stats != nullptr) {
+            iter_opts.stats->pages_bf_filtered++;
         }
     }
     RowRanges::ranges_intersection(*row_ranges, bf_row_ranges, row_ranges);
@@ -1395,6 +1440,7 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     RETURN_IF_ERROR(ParsedPage::create(std::move(handle), page_body, footer.data_page_footer(),
                                        _reader->encoding_info(), iter.page(), iter.page_index(),
                                        &_page));
+    _read_ahead_pages(iter);
 
     // dictionary page is read when the first data page that uses it is read,
     // this is to optimize the memory usage: when there is no query on one column, we could
@@ -1415,6 +1461,36 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     return Status::OK();
 }
 
+void FileColumnIterator::_read_ahead_pages(const OrdinalPageIndexIterator& iter) {
+    const int32_t num_pages = config::segment_page_read_ahead_num;
+    // read ahead hands the pages over through the page cache
+    if (_read_ahead_rows == nullptr || num_pages <= 0 || !_opts.use_page_cache) {
+        return;
+    }
+    OrdinalPageIndexIterator ahead = iter;
+    for (ahead.next(); ahead.valid() && ahead.page_index() <= iter.page_index() + num_pages;
+         ahead.next()) {
+        if (ahead.page_index() <= _read_ahead_page_index) {
+            continue;
+        }
+        _read_ahead_page_index = ahead.page_index();
+        // skip pages whose rows are all filtered out
+        uint64_t rows_before = ahead.first_ordinal() == 0
+                                       ? 0
+                                       : _read_ahead_rows->rank(
+                                                 static_cast<uint32_t>(ahead.first_ordinal() - 1));
+        if (_read_ahead_rows->rank(static_cast<uint32_t>(ahead.last_ordinal())) == rows_before) {
+            continue;
+        }
+        Status st = _reader->read_ahead_page(_opts, ahead.page());
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to submit read ahead page: " << st;
+            return;
+        }
+        _opts.stats->read_ahead_pages_num++;
+    }
+}
+
 Status FileColumnIterator::_read_dict_data() {
     CHECK_EQ(_reader->encoding_info()->encoding(), DICT_ENCODING);
     // read dictionary page
@@ -1753,4 +1829,149 @@ Status DefaultNestedColumnIterator::read_by_rowids(const rowid_t* rowids, const
     return Status::OK();
 }
 
+bool WideningColumnIterator::can_widen(FieldType file_type, FieldType read_type) {
+    auto int_rank = [](FieldType type) {
+        switch (type) {
+        case FieldType::OLAP_FIELD_TYPE_TINYINT:
+            return 1;
+        case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+            return 2;
+        case FieldType::OLAP_FIELD_TYPE_INT:
+            return 3;
+        case FieldType::OLAP_FIELD_TYPE_BIGINT:
+            return 4;
+        case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+            return 5;
+        default:
+            return 0;
+        }
+    };
+    if (int_rank(file_type) > 0 && int_rank(read_type) > 0) {
+        return int_rank(file_type) < int_rank(read_type);
+    }
+    return file_type == FieldType::OLAP_FIELD_TYPE_FLOAT &&
+           read_type == FieldType::OLAP_FIELD_TYPE_DOUBLE;
+}
+
+vectorized::MutableColumnPtr WideningColumnIterator::_create_file_column() const {
+    vectorized::MutableColumnPtr column;
+    switch (_file_type) {
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+        column = vectorized::ColumnInt8::create();
+        break;
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        column = vectorized::ColumnInt16::create();
+        break;
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        column = vectorized::ColumnInt32::create();
+        break;
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        column = vectorized::ColumnInt64::create();
+        break;
+    default:
+        DCHECK_EQ(int(_file_type), int(FieldType::OLAP_FIELD_TYPE_FLOAT));
+        column = vectorized::ColumnFloat32::create();
+        break;
+    }
+    if (_is_file_nullable) {
+        return vectorized::ColumnNullable::create(std::move(column),
+                                                  vectorized::ColumnUInt8::create());
+    }
+    return column;
+}
+
+namespace {
+template <typename FileT, typename ReadT>
+void widen_values(const vectorized::IColumn& src, vectorized::IColumn* dst) {
+    const auto& src_data = assert_cast<const vectorized::ColumnVector<FileT>&>(src).get_data();
+    std::vector<ReadT> values(src_data.size());
+    for (size_t i = 0; i < src_data.size(); ++i) {
+        values[i] = static_cast<ReadT>(src_data[i]);
+    }
+    // dst may be a predicate column, which only accepts raw values
+    dst->insert_many_fix_len_data(reinterpret_cast<const char*>(values.data()), values.size());
+}
+
+template <typename ReadT>
+Status widen_values_to(FieldType file_type, const vectorized::IColumn& src,
+                       vectorized::IColumn* dst) {
+    switch (file_type) {
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+        widen_values<vectorized::Int8, ReadT>(src, dst);
+        return Status::OK();
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        widen_values<vectorized::Int16, ReadT>(src, dst);
+        return Status::OK();
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        widen_values<vectorized::Int32, ReadT>(src, dst);
+        return Status::OK();
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        widen_values<vectorized::Int64, ReadT>(src, dst);
+        return Status::OK();
+    case FieldType::OLAP_FIELD_TYPE_FLOAT:
+        widen_values<vectorized::Float32, ReadT>(src, dst);
+        return Status::OK();
+    default:
+        return Status::InternalError("can not widen column of type {}", int(file_type));
+    }
+}
+} // namespace
+
+Status WideningColumnIterator::_widen(const vectorized::IColumn& src,
+                                      vectorized::MutableColumnPtr& dst) const {
+    const vectorized::IColumn* src_values = &src;
+    vectorized::IColumn* dst_values = dst.get();
+    if (dst->is_nullable()) {
+        auto& dst_nullable = assert_cast<vectorized::ColumnNullable&>(*dst);
+        dst_values = &dst_nullable.get_nested_column();
+        auto& null_map = dst_nullable.get_null_map_data();
+        if (src.is_nullable()) {
+            const auto& src_nullable = assert_cast<const vectorized::ColumnNullable&>(src);
+            src_values = &src_nullable.get_nested_column();
+            const auto& src_null_map = src_nullable.get_null_map_data();
+            null_map.insert(src_null_map.begin(), src_null_map.end());
+        } else {
+            null_map.resize_fill(null_map.size() + src.size(), 0);
+        }
+    } else if (src.is_nullable()) {
+        return Status::InternalError("can not read nullable column into not nullable column");
+    }
+
+    switch (_read_type) {
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+        return widen_values_to<vectorized::Int16>(_file_type, *src_values, dst_values);
+    case FieldType::OLAP_FIELD_TYPE_INT:
+        return widen_values_to<vectorized::Int32>(_file_type, *src_values, dst_values);
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+        return widen_values_to<vectorized::Int64>(_file_type, *src_values, dst_values);
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+        return widen_values_to<vectorized::Int128>(_file_type, *src_values, dst_values);
+    case FieldType::OLAP_FIELD_TYPE_DOUBLE:
+        return widen_values_to<vectorized::Float64>(_file_type, *src_values, dst_values);
+    default:
+        return Status::InternalError("can not widen column to type {}", int(_read_type));
+    }
+}
+
+Status WideningColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr& dst,
+                                          bool* has_null) {
+    auto src = _create_file_column();
+    RETURN_IF_ERROR(_iter->next_batch(n, src, has_null));
+    return _widen(*src, dst);
+}
+
+Status WideningColumnIterator::next_batch_of_zone_map(size_t* n,
+                                                      vectorized::MutableColumnPtr& dst) {
+    auto src = _create_file_column();
+    RETURN_IF_ERROR(_iter->next_batch_of_zone_map(n, src));
+    return _widen(*src, dst);
+}
+
+Status WideningColumnIterator::read_by_rowids(const rowid_t* rowids, const size_t count,
+                                              vectorized::MutableColumnPtr& dst) {
+    auto src = _create_file_column();
+    RETURN_IF_ERROR(_iter->read_by_rowids(rowids, count, src));
+    return _widen(*src, dst);
+}
+
 } // namespace doris::segment_v2
@@ -50,6 +50,10 @@
 #include "vec/data_types/data_type.h"
 #include "vec/json/path_in_data.h"
 
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
 namespace doris {
 
 class BlockCompressionCodec;
@@ -157,6 +161,10 @@ public:
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
                      BlockCompressionCodec* codec) const;
 
+    // read and decompress a data page into the storage page cache on the read ahead pool,
+    // a later read_page of the same page is then served from the cache
+    Status read_ahead_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp) const;
+
     bool is_nullable() const { return _meta_is_nullable; }
 
     const EncodingInfo* encoding_info() const { return _encoding_info; }
@@ -349,6 +357,9 @@ public:
 
     virtual bool is_all_dict_encoding() const { return false; }
 
+    // rows that will be read from this column, pages holding none of them are not read ahead
+    virtual void set_read_ahead_rows(const roaring::Roaring* rows) {}
+
 protected:
     ColumnIteratorOptions _opts;
 };
@@ -396,10 +407,13 @@ public:
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
+    void set_read_ahead_rows(const roaring::Roaring* rows) override { _read_ahead_rows = rows; }
+
 private:
     void _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    void _read_ahead_pages(const OrdinalPageIndexIterator& iter);
     Status _read_dict_data();
 
     ColumnReader* _reader = nullptr;
@@ -428,6 +442,11 @@ private:
     bool _is_all_dict_encoding = false;
 
     std::unique_ptr<StringRef[]> _dict_word_info;
+
+    // rows left after index filtering, owned by SegmentIterator, null if read ahead is disabled
+    const roaring::Roaring* _read_ahead_rows = nullptr;
+    // largest page index that has been considered for read ahead
+    int32_t _read_ahead_page_index = -1;
 };
 
 class EmptyFileColumnIterator final : public ColumnIterator {
@@ -782,5 +801,50 @@ private:
     ordinal_t _current_rowid = 0;
 };
 
+// This iterator is used to read a column whose type in segment is narrower than the one in
+// tablet schema, e.g. INT -> BIGINT, the values are widened while reading. The indexes of the
+// segment are built on the file type, so they are never used by this iterator to prune rows.
+class WideningColumnIterator : public ColumnIterator {
+public:
+    WideningColumnIterator(std::unique_ptr<ColumnIterator> iter, FieldType file_type,
+                           FieldType read_type, bool is_file_nullable)
+            : _iter(std::move(iter)),
+              _file_type(file_type),
+              _read_type(read_type),
+              _is_file_nullable(is_file_nullable) {}
+
+    // Whether every value of `file_type` can be represented by `read_type` exactly.
+    static bool can_widen(FieldType file_type, FieldType read_type);
+
+    Status init(const ColumnIteratorOptions& opts) override { return _iter->init(opts); }
+
+    Status seek_to_first() override { return _iter->seek_to_first(); }
+
+    Status seek_to_ordinal(ordinal_t ord_idx) override { return _iter->seek_to_ordinal(ord_idx); }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override;
+
+    Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) override;
+
+    Status read_by_rowids(const rowid_t* rowids, const size_t count,
+                          vectorized::MutableColumnPtr& dst) override;
+
+    ordinal_t get_current_ordinal() const override { return _iter->get_current_ordinal(); }
+
+    void set_read_ahead_rows(const roaring::Roaring* rows) override {
+        _iter->set_read_ahead_rows(rows);
+    }
+
+private:
+    vectorized::MutableColumnPtr _create_file_column() const;
+
+    Status _widen(const vectorized::IColumn& src, vectorized::MutableColumnPtr& dst) const;
+
+    std::unique_ptr<ColumnIterator> _iter;
+    FieldType _file_type;
+    FieldType _read_type;
+    bool _is_file_nullable;
+};
+
 } // namespace segment_v2
 } // namespace doris
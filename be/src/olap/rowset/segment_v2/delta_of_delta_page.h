@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/bit_packing.inline.h"
+#include "util/bit_stream_utils.inline.h"
+#include "util/bit_util.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+enum { DELTA_OF_DELTA_PAGE_HEADER_SIZE = 4 };
+static constexpr size_t DELTA_OF_DELTA_BLOCK_SIZE = 128;
+
+// DeltaOfDeltaPageBuilder encodes integers, and dates or datetimes stored as integers, by the
+// differences of consecutive deltas. They are zero or tiny for regularly sampled timestamps and
+// monotonic counters, so such a page takes a few bits per value.
+//
+// The page format is as follows:
+//
+//    <num_elements> [32-bit]
+//    <first_value> [64-bit], if num_elements > 0
+//    <first_delta> [64-bit], if num_elements > 1
+//    blocks of up to DELTA_OF_DELTA_BLOCK_SIZE delta of deltas, each as
+//        <min_delta_of_delta> [64-bit]
+//        <bit_width> [8-bit]
+//        <delta of deltas minus min_delta_of_delta> [bit_width bits each, byte aligned]
+//
+// The arithmetic wraps around in 64 bits, so any sequence of values round trips.
+template <FieldType Type>
+class DeltaOfDeltaPageBuilder : public PageBuilderHelper<DeltaOfDeltaPageBuilder<Type>> {
+public:
+    using Self = DeltaOfDeltaPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_integral_v<CppType> && sizeof(CppType) <= sizeof(uint64_t));
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override { return _remain_element_capacity == 0; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min(_remain_element_capacity, *count);
+        const auto* values = reinterpret_cast<const CppType*>(vals);
+        RETURN_IF_CATCH_EXCEPTION(_values.insert(_values.end(), values, values + to_add));
+        _remain_element_capacity -= to_add;
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        _finished = true;
+        RETURN_IF_CATCH_EXCEPTION({
+            _encode();
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _remain_element_capacity = _options.data_page_size / sizeof(CppType);
+            _values.clear();
+            _values.reserve(_remain_element_capacity);
+            _buffer.clear();
+            _finished = false;
+        });
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _buffer.size(); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+private:
+    explicit DeltaOfDeltaPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    void _encode() {
+        const size_t num_elements = _values.size();
+        _buffer.resize(DELTA_OF_DELTA_PAGE_HEADER_SIZE);
+        encode_fixed32_le(_buffer.data(), static_cast<uint32_t>(num_elements));
+        if (num_elements == 0) {
+            return;
+        }
+        put_fixed64_le(&_buffer, static_cast<uint64_t>(_values[0]));
+        if (num_elements == 1) {
+            return;
+        }
+        uint64_t prev_delta = static_cast<uint64_t>(_values[1]) - static_cast<uint64_t>(_values[0]);
+        put_fixed64_le(&_buffer, prev_delta);
+
+        uint64_t block[DELTA_OF_DELTA_BLOCK_SIZE];
+        for (size_t start = 2; start < num_elements; start += DELTA_OF_DELTA_BLOCK_SIZE) {
+            const size_t n = std::min(DELTA_OF_DELTA_BLOCK_SIZE, num_elements - start);
+            int64_t min_delta_of_delta = std::numeric_limits<int64_t>::max();
+            for (size_t i = 0; i < n; ++i) {
+                uint64_t delta = static_cast<uint64_t>(_values[start + i]) -
+                                 static_cast<uint64_t>(_values[start + i - 1]);
+                block[i] = delta - prev_delta;
+                prev_delta = delta;
+                min_delta_of_delta =
+                        std::min(min_delta_of_delta, static_cast<int64_t>(block[i]));
+            }
+            uint64_t bits = 0;
+            for (size_t i = 0; i < n; ++i) {
+                block[i] -= static_cast<uint64_t>(min_delta_of_delta);
+                bits |= block[i];
+            }
+            const int bit_width = bits == 0 ? 0 : 64 - __builtin_clzll(bits);
+            put_fixed64_le(&_buffer, static_cast<uint64_t>(min_delta_of_delta));
+            _buffer.push_back(static_cast<char>(bit_width));
+            if (bit_width > 0) {
+                BitWriter writer(&_packed);
+                for (size_t i = 0; i < n; ++i) {
+                    writer.PutValue(block[i], bit_width);
+                }
+                writer.Flush();
+                _buffer.append(_packed.data(), writer.bytes_written());
+            }
+        }
+    }
+
+    PageBuilderOptions _options;
+    size_t _remain_element_capacity = 0;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buffer;
+    faststring _packed;
+};
+
+// Decodes the whole page on init, unpacking 32 values at a time and rebuilding the values with
+// two prefix sums, so reads are plain copies afterwards.
+template <FieldType Type>
+class DeltaOfDeltaPageDecoder : public PageDecoder {
+public:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    DeltaOfDeltaPageDecoder(Slice data, const PageDecoderOptions& options)
+            : _data(data), _options(options) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        RETURN_IF_ERROR(_decode());
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        if (PREDICT_FALSE(_values.empty())) {
+            DCHECK_EQ(0, pos);
+            return Status::Error<ErrorCode::INVALID_ARGUMENT, false>("invalid pos");
+        }
+        DCHECK_LE(pos, _values.size());
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        CppType target;
+        memcpy(&target, value, sizeof(CppType));
+        auto it = std::lower_bound(_values.begin(), _values.end(), target);
+        if (it == _values.end()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("all value small than the value");
+        }
+        *exact_match = *it == target;
+        _cur_index = it - _values.begin();
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _values.size())) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, _values.size() - _cur_index);
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_values[_cur_index]),
+                                      max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0)) {
+            return Status::OK();
+        }
+        size_t read_count = 0;
+        _buffer.resize(*n);
+        for (size_t i = 0; i < *n; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _values.size())) {
+                break;
+            }
+            _buffer[read_count++] = _values[ord];
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    Status _decode() {
+        if (_data.size < DELTA_OF_DELTA_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for delta of delta page header: {}",
+                                      _data.size);
+        }
+        const auto* pos = reinterpret_cast<const uint8_t*>(_data.data);
+        const auto* end = pos + _data.size;
+        const uint32_t num_elements = decode_fixed32_le(pos);
+        pos += DELTA_OF_DELTA_PAGE_HEADER_SIZE;
+        RETURN_IF_CATCH_EXCEPTION(_values.resize(num_elements));
+        if (num_elements == 0) {
+            return pos == end ? Status::OK()
+                              : Status::Corruption("unexpected delta of delta page size");
+        }
+        const size_t first_size = num_elements == 1 ? 8 : 16;
+        if (static_cast<size_t>(end - pos) < first_size) {
+            return Status::Corruption("delta of delta page is truncated");
+        }
+        uint64_t value = decode_fixed64_le(pos);
+        _values[0] = static_cast<CppType>(value);
+        if (num_elements == 1) {
+            return pos + 8 == end ? Status::OK()
+                                  : Status::Corruption("unexpected delta of delta page size");
+        }
+        uint64_t delta = decode_fixed64_le(pos + 8);
+        pos += 16;
+        value += delta;
+        _values[1] = static_cast<CppType>(value);
+
+        uint64_t block[DELTA_OF_DELTA_BLOCK_SIZE];
+        for (size_t start = 2; start < num_elements; start += DELTA_OF_DELTA_BLOCK_SIZE) {
+            const size_t n = std::min<size_t>(DELTA_OF_DELTA_BLOCK_SIZE, num_elements - start);
+            if (end - pos < 9) {
+                return Status::Corruption("delta of delta page is truncated");
+            }
+            const uint64_t min_delta_of_delta = decode_fixed64_le(pos);
+            const int bit_width = pos[8];
+            pos += 9;
+            if (bit_width > BitPacking::MAX_BITWIDTH) {
+                return Status::Corruption("invalid bit width {} in delta of delta page",
+                                          bit_width);
+            }
+            const auto num_bytes = BitUtil::Ceil(static_cast<int64_t>(bit_width * n), 8);
+            if (end - pos < num_bytes) {
+                return Status::Corruption("delta of delta page is truncated");
+            }
+            if (bit_width == 0) {
+                std::fill(block, block + n, 0);
+            } else {
+                BitPacking::UnpackValues(bit_width, pos, num_bytes, n, block);
+                pos += num_bytes;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                block[i] += min_delta_of_delta;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                delta += block[i];
+                value += delta;
+                _values[start + i] = static_cast<CppType>(value);
+            }
+        }
+        if (pos != end) {
+            return Status::Corruption("unexpected delta of delta page size");
+        }
+        return Status::OK();
+    }
+
+    Slice _data;
+    PageDecoderOptions _options;
+    bool _parsed = false;
+    size_t _cur_index = 0;
+    std::vector<CppType> _values;
+    std::vector<CppType> _buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
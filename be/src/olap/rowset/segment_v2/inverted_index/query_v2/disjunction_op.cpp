@@ -26,14 +26,10 @@
 namespace doris::segment_v2::idx_query_v2 {
 
 DisjunctionOp::~DisjunctionOp() {
-    while (!_pq.empty()) {
-        auto* w = _pq.top();
-        if (w != nullptr) {
-            delete w;
-            w = nullptr;
-        }
-        _pq.pop();
+    for (auto* w : _heap) {
+        delete w;
     }
+    _heap.clear();
 }
 
 Status DisjunctionOp::init() {
@@ -46,39 +42,59 @@ Status DisjunctionOp::init() {
         w->_iter = &child;
         w->_cost = visit_node(*w->_iter, Cost {});
         this->_cost += w->_cost;
-        _pq.push(w);
+        // all wrappers start at doc -1, so any order is a valid heap
+        _heap.push_back(w);
     }
 
     return Status::OK();
 }
 
 int32_t DisjunctionOp::doc_id() const {
-    return visit_node(*_pq.top()->_iter, DocId {});
+    return visit_node(*_heap.front()->_iter, DocId {});
 }
 
 int32_t DisjunctionOp::next_doc() const {
-    auto* top = _pq.top();
+    auto* top = _heap.front();
     int32_t doc = top->_doc;
     do {
-        _pq.pop();
         top->_doc = visit_node(*top->_iter, NextDoc {});
-        _pq.push(top);
-        top = _pq.top();
+        _update_top();
+        top = _heap.front();
     } while (top->_doc == doc);
     return top->_doc;
 }
 
 int32_t DisjunctionOp::advance(int32_t target) const {
-    auto* top = _pq.top();
+    auto* top = _heap.front();
     do {
-        _pq.pop();
         top->_doc = visit_node(*top->_iter, Advance {}, target);
-        _pq.push(top);
-        top = _pq.top();
+        _update_top();
+        top = _heap.front();
     } while (top->_doc < target);
     return top->_doc;
 }
 
+void DisjunctionOp::_update_top() const {
+    auto* node = _heap.front();
+    size_t size = _heap.size();
+    size_t i = 0;
+    while (true) {
+        size_t child = 2 * i + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && _heap[child + 1]->_doc < _heap[child]->_doc) {
+            child++;
+        }
+        if (_heap[child]->_doc >= node->_doc) {
+            break;
+        }
+        _heap[i] = _heap[child];
+        i = child;
+    }
+    _heap[i] = node;
+}
+
 int64_t DisjunctionOp::cost() const {
     return _cost;
 }
@@ -17,7 +17,7 @@
 
 #pragma once
 
-#include <queue>
+#include <vector>
 
 #include "olap/rowset/segment_v2/inverted_index/query_v2/operator.h"
 
@@ -46,12 +46,13 @@ private:
         const Node* _iter = nullptr;
     };
 
-    struct CompareDisiWrapper {
-        bool operator()(DisiWrapper* lhs, DisiWrapper* rhs) const { return lhs->_doc > rhs->_doc; }
-    };
+    // Restores the min heap on doc after the doc of the top wrapper moved forward. Every step
+    // of next_doc and advance only moves the top, so sifting it down is enough, which costs
+    // about half of a pop followed by a push.
+    void _update_top() const;
 
     int64_t _cost = 0;
-    mutable std::priority_queue<DisiWrapper*, std::vector<DisiWrapper*>, CompareDisiWrapper> _pq;
+    mutable std::vector<DisiWrapper*> _heap;
 };
 
 using DisjunctionOpPtr = std::shared_ptr<DisjunctionOp>;
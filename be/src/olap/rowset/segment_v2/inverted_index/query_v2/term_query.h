@@ -31,7 +31,7 @@ public:
 
     void execute(const std::shared_ptr<roaring::Roaring>& result) {}
 
-    int32_t doc_id() const { return _iter.nextDoc(); }
+    int32_t doc_id() const { return _iter.docID(); }
     int32_t next_doc() const { return _iter.nextDoc(); }
     int32_t advance(int32_t target) const { return _iter.advance(target); }
     int64_t cost() const { return _iter.docFreq(); }
@@ -115,10 +115,11 @@ Cache::Handle* InvertedIndexSearcherCache::_insert(const InvertedIndexSearcherCa
 }
 
 bool InvertedIndexQueryCache::lookup(const CacheKey& key, InvertedIndexQueryCacheHandle* handle) {
-    if (key.encode().empty()) {
+    std::string encoded_key = key.encode();
+    if (encoded_key.empty()) {
         return false;
     }
-    auto* lru_handle = LRUCachePolicy::lookup(key.encode());
+    auto* lru_handle = LRUCachePolicy::lookup(encoded_key);
     if (lru_handle == nullptr) {
         return false;
     }
@@ -128,16 +129,21 @@ bool InvertedIndexQueryCache::lookup(const CacheKey& key, InvertedIndexQueryCach
 
 void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
                                      InvertedIndexQueryCacheHandle* handle) {
-    std::unique_ptr<InvertedIndexQueryCache::CacheValue> cache_value_ptr =
-            std::make_unique<InvertedIndexQueryCache::CacheValue>();
-    cache_value_ptr->bitmap = bitmap;
-    if (key.encode().empty()) {
+    std::string encoded_key = key.encode();
+    if (encoded_key.empty()) {
         return;
     }
+    // Store the bitmap in its most compact form, so that more results fit in the cache
+    // and the charge matches the memory really held.
+    bitmap->runOptimize();
+    bitmap->shrinkToFit();
+    size_t bitmap_size = bitmap->getSizeInBytes();
 
-    auto* lru_handle = LRUCachePolicy::insert(key.encode(), (void*)cache_value_ptr.release(),
-                                              bitmap->getSizeInBytes(), bitmap->getSizeInBytes(),
-                                              CachePriority::NORMAL);
+    std::unique_ptr<InvertedIndexQueryCache::CacheValue> cache_value_ptr =
+            std::make_unique<InvertedIndexQueryCache::CacheValue>();
+    cache_value_ptr->bitmap = std::move(bitmap);
+    auto* lru_handle = LRUCachePolicy::insert(encoded_key, (void*)cache_value_ptr.release(),
+                                              bitmap_size, bitmap_size, CachePriority::NORMAL);
     *handle = InvertedIndexQueryCacheHandle(this, lru_handle);
 }
 
@@ -143,7 +143,6 @@ Status InvertedIndexReader::read_null_bitmap(const io::IOContext* io_ctx,
             buf.resize(null_bitmap_size);
             null_bitmap_in->readBytes(reinterpret_cast<uint8_t*>(buf.data()), null_bitmap_size);
             *null_bitmap = roaring::Roaring::read(reinterpret_cast<char*>(buf.data()), false);
-            null_bitmap->runOptimize();
             cache->insert(cache_key, null_bitmap, cache_handle);
             FINALIZE_INPUT(null_bitmap_in);
         } else {
@@ -356,7 +355,6 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
             term_match_bitmap = std::make_shared<roaring::Roaring>();
             RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state, query_type, query_info,
                                                *searcher_ptr, term_match_bitmap));
-            term_match_bitmap->runOptimize();
             cache->insert(cache_key, term_match_bitmap, &cache_handler);
             bit_map = term_match_bitmap;
         }
@@ -497,7 +495,6 @@ Status StringTypeInvertedIndexReader::query(const io::IOContext* io_ctx,
         }
 
         // add to cache
-        result->runOptimize();
         cache->insert(cache_key, result, &cache_handler);
 
         bit_map = result;
@@ -710,7 +707,6 @@ Status BkdIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatistics*
         }
 
         RETURN_IF_ERROR(invoke_bkd_query(query_value, query_type, r, bit_map));
-        bit_map->runOptimize();
         cache->insert(cache_key, bit_map, &cache_handler);
 
         VLOG_DEBUG << "BKD index search column: " << column_name
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
+#include <string.h>
 
 #include "gutil/hash/city.h"
 #include "gutil/strings/substitute.h"
@@ -42,11 +43,8 @@ Status NGramBloomFilter::init(const char* buf, uint32_t size, HashStrategyPB str
         return Status::InvalidArgument(strings::Substitute("invalid strategy:$0", strategy));
     }
     words = (_size + sizeof(UnderType) - 1) / sizeof(UnderType);
-    filter.reserve(words);
-    const UnderType* from = reinterpret_cast<const UnderType*>(buf);
-    for (size_t i = 0; i < words; ++i) {
-        filter[i] = from[i];
-    }
+    filter.resize(words);
+    memcpy(filter.data(), buf, words * sizeof(UnderType));
 
     return Status::OK();
 }
@@ -63,12 +61,27 @@ void NGramBloomFilter::add_bytes(const char* data, uint32_t len) {
 
 bool NGramBloomFilter::contains(const BloomFilter& bf_) const {
     const NGramBloomFilter& bf = static_cast<const NGramBloomFilter&>(bf_);
-    for (size_t i = 0; i < words; ++i) {
-        if ((filter[i] & bf.filter[i]) != bf.filter[i]) {
+    // The query filter holds the bits of every gram of the pattern, so all grams are probed
+    // in one pass. Accumulate the missing bits without an early exit so that the loop is
+    // vectorized, bail out once per block of words.
+    const UnderType* __restrict page = filter.data();
+    const UnderType* __restrict query = bf.filter.data();
+    constexpr size_t BLOCK_WORDS = 16;
+    size_t i = 0;
+    for (; i + BLOCK_WORDS <= words; i += BLOCK_WORDS) {
+        UnderType missing = 0;
+        for (size_t j = i; j < i + BLOCK_WORDS; ++j) {
+            missing |= query[j] & ~page[j];
+        }
+        if (missing != 0) {
             return false;
         }
     }
-    return true;
+    UnderType missing = 0;
+    for (; i < words; ++i) {
+        missing |= query[i] & ~page[i];
+    }
+    return missing == 0;
 }
 
 } // namespace segment_v2
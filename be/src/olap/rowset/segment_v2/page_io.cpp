@@ -17,16 +17,23 @@
 
 #include "olap/rowset/segment_v2/page_io.h"
 
+#include <bvar/bvar.h>
 #include <gen_cpp/segment_v2.pb.h>
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/file_reader.h"
@@ -38,6 +45,7 @@
 #include "util/block_compression.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 
@@ -46,6 +54,51 @@ namespace segment_v2 {
 
 using strings::Substitute;
 
+namespace {
+
+bvar::Adder<int64_t> g_page_cache_concurrent_miss_wait("page_cache_concurrent_miss_wait");
+
+// Concurrent scans of a hot segment often miss the page cache on the same page at the same
+// time. Only the first of them loads the page, the others wait for it to be cached.
+class PageLoadingKeys {
+public:
+    // Returns true if the caller is the only one loading the page and must call finish() later,
+    // false after another loader finished or the wait timed out.
+    bool start_or_wait(const std::string& key, int32_t wait_ms) {
+        auto& shard = _shards[std::hash<std::string> {}(key) % NUM_SHARDS];
+        std::unique_lock l(shard.lock);
+        if (shard.keys.insert(key).second) {
+            return true;
+        }
+        g_page_cache_concurrent_miss_wait << 1;
+        shard.cond.wait_for(l, std::chrono::milliseconds(wait_ms),
+                            [&] { return !shard.keys.contains(key); });
+        return false;
+    }
+
+    void finish(const std::string& key) {
+        auto& shard = _shards[std::hash<std::string> {}(key) % NUM_SHARDS];
+        {
+            std::lock_guard l(shard.lock);
+            shard.keys.erase(key);
+        }
+        shard.cond.notify_all();
+    }
+
+private:
+    static constexpr size_t NUM_SHARDS = 32;
+    struct Shard {
+        std::mutex lock;
+        std::condition_variable cond;
+        std::unordered_set<std::string> keys;
+    };
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+PageLoadingKeys g_page_loading_keys;
+
+} // namespace
+
 Status PageIO::compress_page_body(BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, OwnedSlice* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -120,10 +173,30 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
     PageCacheHandle cache_handle;
     StoragePageCache::CacheKey cache_key(opts.file_reader->path().native(),
                                          opts.file_reader->size(), opts.page_pointer.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+    MonotonicStopWatch lookup_watch;
+    lookup_watch.start();
+    bool cached =
+            opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type);
+    std::string loading_key;
+    int32_t miss_wait_ms = config::page_cache_concurrent_miss_wait_ms;
+    if (!cached && opts.use_page_cache && cache && miss_wait_ms > 0) {
+        loading_key = cache_key.encode();
+        if (!g_page_loading_keys.start_or_wait(loading_key, miss_wait_ms)) {
+            // another reader loaded the page meanwhile, load it here only if it is not cached
+            loading_key.clear();
+            cached = cache->lookup(cache_key, &cache_handle, opts.type);
+        }
+    }
+    Defer finish_loading([&] {
+        if (!loading_key.empty()) {
+            g_page_loading_keys.finish(loading_key);
+        }
+    });
+    if (cached) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
+        opts.stats->page_cache_io.add(lookup_watch.elapsed_time(), handle->data().size);
         // parse body and footer
         Slice page_slice = handle->data();
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -143,31 +216,42 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                                   opts.file_reader->path().native());
     }
 
+    const bool use_compressed_cache = opts.use_page_cache && cache &&
+                                      opts.type == DATA_PAGE && cache->has_compressed_page_cache();
     // hold compressed page at first, reset to decompressed page later
-    std::unique_ptr<DataPage> page =
-            std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
-    Slice page_slice(page->data(), page_size);
-    {
-        SCOPED_RAW_TIMER(&opts.stats->io_ns);
-        size_t bytes_read = 0;
-        RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
-                                                  &opts.io_ctx));
-        DCHECK_EQ(bytes_read, page_size);
-        opts.stats->compressed_bytes_read += page_size;
-    }
+    std::unique_ptr<DataPage> page;
+    Slice page_slice;
+    // keeps the compressed page alive while it is being decompressed
+    PageCacheHandle compressed_handle;
+    if (use_compressed_cache && cache->lookup_compressed(cache_key, &compressed_handle)) {
+        // cached without checksum, which was verified when the page was read from file
+        page_slice = compressed_handle.data();
+        opts.stats->compressed_cached_pages_num++;
+    } else {
+        page = std::make_unique<DataPage>(page_size, opts.use_page_cache, opts.type);
+        page_slice = Slice(page->data(), page_size);
+        {
+            SCOPED_RAW_TIMER(&opts.stats->io_ns);
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice,
+                                                      &bytes_read, &opts.io_ctx));
+            DCHECK_EQ(bytes_read, page_size);
+            opts.stats->compressed_bytes_read += page_size;
+        }
 
-    if (opts.verify_checksum) {
-        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
-        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
-        if (expect != actual) {
-            return Status::Corruption(
-                    "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual, expect,
-                    opts.file_reader->path().native());
+        if (opts.verify_checksum) {
+            uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+            uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+            if (expect != actual) {
+                return Status::Corruption(
+                        "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual,
+                        expect, opts.file_reader->path().native());
+            }
         }
-    }
 
-    // remove checksum suffix
-    page_slice.size -= 4;
+        // remove checksum suffix
+        page_slice.size -= 4;
+    }
     // parse and set footer
     uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
     if (!footer->ParseFromArray(page_slice.data + page_slice.size - 4 - footer_size, footer_size)) {
@@ -182,6 +266,11 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file={}",
                     opts.file_reader->path().native());
         }
+        if (use_compressed_cache && page != nullptr) {
+            // the compressed page is handed over to the compressed tier
+            page->reset_size(page_slice.size);
+            cache->insert_compressed(cache_key, page.release(), &compressed_handle);
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         std::unique_ptr<DataPage> decompressed_page = std::make_unique<DataPage>(
                 footer->uncompressed_size() + footer_size + 4, opts.use_page_cache, opts.type);
@@ -204,6 +293,8 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         page_slice = Slice(page->data(), footer->uncompressed_size() + footer_size + 4);
         opts.stats->uncompressed_bytes_read += page_slice.size;
     } else {
+        // only compressed pages are put into the compressed tier
+        DCHECK(page != nullptr);
         opts.stats->uncompressed_bytes_read += body_size;
     }
 
@@ -32,6 +32,7 @@
 #include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_factory.h"
 #include "io/cache/cached_remote_file_reader.h"
+#include "io/fs/file_meta_cache.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "io/io_common.h"
@@ -250,7 +251,8 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
                              ? _column_readers[col.unique_id()].get()
                              : nullptr;
         }
-        if (!reader || !reader->has_zone_map()) {
+        // zone map of a widened column is in the file type, can not be compared with conditions
+        if (!reader || !reader->has_zone_map() || _is_widened_column(col, reader)) {
             continue;
         }
         if (read_options.col_id_to_predicates.contains(column_id) &&
@@ -271,15 +273,19 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             auto runtime_predicate = query_ctx->get_runtime_predicate(id).get_predicate(
                     read_options.topn_filter_target_node_id);
 
-            int32_t uid =
-                    read_options.tablet_schema->column(runtime_predicate->column_id()).unique_id();
+            const TabletColumn& col =
+                    read_options.tablet_schema->column(runtime_predicate->column_id());
+            // extracted columns of variant are looked up by path, e.g. for ORDER BY v['ts']
+            ColumnReader* reader = col.is_extracted_column() || !col.is_variant_type()
+                                           ? _get_column_reader(col)
+                                           : nullptr;
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            if (reader != nullptr && reader->has_zone_map() && !_is_widened_column(col, reader) &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -404,6 +410,26 @@ Status Segment::_parse_footer(SegmentFooterPB* footer) {
                                   file_cache_key_str(_file_reader->path().native()));
     }
 
+    // Segment files are immutable, so their footers can be served by the on disk meta cache
+    // to avoid reading them from remote storage again after a restart.
+    PersistentMetaCache* persistent_cache = nullptr;
+    std::string persistent_key;
+    if (auto* meta_cache = ExecEnv::GetInstance()->file_meta_cache();
+        meta_cache != nullptr &&
+        _file_reader->get_data_dir_path() == io::FileReader::VIRTUAL_REMOTE_DATA_DIR) {
+        persistent_cache = meta_cache->persistent_cache();
+    }
+    if (persistent_cache != nullptr) {
+        persistent_key = fmt::format("segment:{}:{}", _file_reader->path().native(), file_size);
+        std::string footer_buf;
+        if (persistent_cache->lookup(persistent_key, &footer_buf)) {
+            if (footer->ParseFromString(footer_buf)) {
+                return Status::OK();
+            }
+            persistent_cache->remove(persistent_key);
+        }
+    }
+
     uint8_t fixed_buf[12];
     size_t bytes_read = 0;
     // TODO(plat1ko): Support session variable `enable_file_cache`
@@ -472,6 +498,13 @@ Status Segment::_parse_footer(SegmentFooterPB* footer) {
                 _file_reader->path().native(), file_size,
                 file_cache_key_str(_file_reader->path().native()));
     }
+    if (persistent_cache != nullptr) {
+        Status st = persistent_cache->insert(persistent_key, footer_buf);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to persist footer of segment " << _file_reader->path().native()
+                         << ": " << st;
+        }
+    }
     return Status::OK();
 }
 
@@ -890,9 +923,19 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(tablet_column.unique_id())->new_iterator(&it));
+    auto* reader = _column_readers.at(tablet_column.unique_id()).get();
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
 
+    // the type of a value column may be widened by linked schema change, see
+    // SchemaChangeJob::parse_request
+    if (_is_widened_column(tablet_column, reader)) {
+        *iter = std::make_unique<WideningColumnIterator>(std::move(*iter), reader->get_meta_type(),
+                                                         tablet_column.type(),
+                                                         reader->is_nullable());
+        return Status::OK();
+    }
+
     if (config::enable_column_type_check && !tablet_column.is_agg_state_type() &&
         tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
@@ -914,6 +957,12 @@ Status Segment::new_column_iterator(int32_t unique_id, const StorageReadOptions*
     return Status::OK();
 }
 
+bool Segment::_is_widened_column(const TabletColumn& col, ColumnReader* reader) const {
+    return !col.is_key() && (col.is_nullable() || !reader->is_nullable()) &&
+           col.type() != reader->get_meta_type() &&
+           WideningColumnIterator::can_widen(reader->get_meta_type(), col.type());
+}
+
 ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
@@ -971,7 +1020,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
 
 Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
-                               OlapReaderStatistics* stats, std::string* encoded_seq_value) {
+                               OlapReaderStatistics* stats, std::string* encoded_seq_value,
+                               std::unique_ptr<IndexedColumnIterator>* index_iterator_hint) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
@@ -990,8 +1040,12 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_index_iterator;
+    auto& index_iterator =
+            index_iterator_hint != nullptr ? *index_iterator_hint : local_index_iterator;
+    if (index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    }
     auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
@@ -1124,6 +1178,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                        uint32_t row_id, vectorized::MutableColumnPtr& result,
                                        OlapReaderStatistics& stats,
                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    return seek_and_read_by_rowids(schema, slot, &row_id, 1, result, stats, iterator_hint);
+}
+
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const uint32_t* row_ids, size_t count,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
     StorageReadOptions storage_read_opt;
     storage_read_opt.stats = &stats;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
@@ -1134,7 +1196,6 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY,
                                      .file_cache_stats = &stats.file_cache_stats},
     };
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
     if (!slot->column_paths().empty()) {
         vectorized::PathInDataPtr path = std::make_shared<vectorized::PathInData>(
                 schema.column_by_uid(slot->col_unique_id()).name_lower_case(),
@@ -1152,13 +1213,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, count, file_storage_column));
         // iterator_hint.reset(nullptr);
         // Get it's inner field, for JSONB case
-        vectorized::Field field = remove_nullable(storage_type)->get_default();
-        file_storage_column->get(0, field);
-        result->insert(field);
+        for (size_t i = 0; i < count; ++i) {
+            vectorized::Field field = remove_nullable(storage_type)->get_default();
+            file_storage_column->get(i, field);
+            result->insert(field);
+        }
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -1174,7 +1236,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, count, result));
     }
     return Status::OK();
 }
@@ -65,10 +65,15 @@ namespace segment_v2 {
 
 class BitmapIndexIterator;
 class Segment;
+class IndexedColumnIterator;
 class InvertedIndexIterator;
 class InvertedIndexFileReader;
 
 using SegmentSharedPtr = std::shared_ptr<Segment>;
+// Primary key index iterators by segment, kept across lookup_row_key calls so that keys looked
+// up in ascending order reuse the index data page already decoded by the iterator.
+using PrimaryKeyIteratorCache =
+        std::unordered_map<const Segment*, std::unique_ptr<IndexedColumnIterator>>;
 // A Segment is used to represent a segment in memory format. When segment is
 // generated, it won't be modified, so this struct aimed to help read operation.
 // It will prepare all ColumnReader to create ColumnIterator as needed.
@@ -133,9 +138,11 @@ public:
         return _pk_index_reader.get();
     }
 
+    // `index_iterator` optionally keeps the primary key index iterator for the next lookup.
     Status lookup_row_key(const Slice& key, const TabletSchema* latest_schema, bool with_seq_col,
                           bool with_rowid, RowLocation* row_location, OlapReaderStatistics* stats,
-                          std::string* encoded_seq_value = nullptr);
+                          std::string* encoded_seq_value = nullptr,
+                          std::unique_ptr<IndexedColumnIterator>* index_iterator = nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
@@ -143,6 +150,14 @@ public:
                                   vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
+    // Same as seek_and_read_by_rowid, but reads `count` rows in one pass. `row_ids` must be
+    // sorted in ascending order so that every data page is decoded at most once.
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const uint32_t* row_ids, size_t count,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
+
     Status load_index(OlapReaderStatistics* stats);
 
     Status load_pk_index_and_bf(OlapReaderStatistics* stats);
@@ -229,6 +244,9 @@ private:
     Status _load_pk_bloom_filter(OlapReaderStatistics* stats);
     ColumnReader* _get_column_reader(const TabletColumn& col);
 
+    // Whether `col` is a value column stored in this segment with a narrower type.
+    bool _is_widened_column(const TabletColumn& col, ColumnReader* reader) const;
+
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
                                            std::unique_ptr<ColumnIterator>* iter,
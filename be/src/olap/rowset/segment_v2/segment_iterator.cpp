@@ -401,6 +401,15 @@ Status SegmentIterator::_lazy_init() {
         _range_iter.reset(new BackwardBitmapRangeIterator(_row_bitmap));
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
+        // pages are read in ordinal order, so the next pages holding surviving rows can be
+        // read ahead while the current ones are decoded
+        if (config::segment_page_read_ahead_num > 0) {
+            for (auto& iter : _column_iterators) {
+                if (iter != nullptr) {
+                    iter->set_read_ahead_rows(&_row_bitmap);
+                }
+            }
+        }
     }
     return Status::OK();
 }
@@ -1669,6 +1678,10 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (!_opts.topn_filter_source_node_ids.empty()) {
+        RETURN_IF_ERROR(_update_topn_pruned_rows());
+        RETURN_IF_ERROR(_remove_topn_pruned_rows(nrows_read_limit, nrows_read));
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
 
@@ -1747,6 +1760,70 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     return Status::OK();
 }
 
+Status SegmentIterator::_update_topn_pruned_rows() {
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    uint64_t version = 0;
+    for (int id : _opts.topn_filter_source_node_ids) {
+        version += query_ctx->get_runtime_predicate(id).version();
+    }
+    if (version == _topn_predicates_version) {
+        return Status::OK();
+    }
+    _topn_predicates_version = version;
+
+    RowRanges row_ranges = RowRanges::create_single(num_rows());
+    for (int id : _opts.topn_filter_source_node_ids) {
+        std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
+                query_ctx->get_runtime_predicate(id).get_predicate(
+                        _opts.topn_filter_target_node_id);
+        ColumnId cid = runtime_predicate->column_id();
+        if (_column_iterators[cid] == nullptr ||
+            !_segment->can_apply_predicate_safely(cid, runtime_predicate.get(), *_schema,
+                                                  _opts.io_ctx.reader_type)) {
+            continue;
+        }
+        AndBlockColumnPredicate and_predicate;
+        and_predicate.add_column_predicate(
+                SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
+        RowRanges column_rp_row_ranges = RowRanges::create_single(num_rows());
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(&and_predicate, nullptr,
+                                                                           &column_rp_row_ranges));
+        RowRanges::ranges_intersection(row_ranges, column_rp_row_ranges, &row_ranges);
+    }
+    _topn_pruned_rows = roaring::Roaring();
+    _topn_pruned_rows.addRange(0, num_rows());
+    _topn_pruned_rows -= RowRanges::ranges_to_roaring(row_ranges);
+    return Status::OK();
+}
+
+Status SegmentIterator::_remove_topn_pruned_rows(uint32_t nrows_read_limit,
+                                                 uint32_t& nrows_read) {
+    while (nrows_read > 0 && !_topn_pruned_rows.isEmpty()) {
+        // rowids of a batch are ascending, most batches hit no pruned page at all
+        rowid_t first = _block_rowids[0];
+        rowid_t last = _block_rowids[nrows_read - 1];
+        uint64_t pruned_in_batch = _topn_pruned_rows.rank(last) -
+                                   (first == 0 ? 0 : _topn_pruned_rows.rank(first - 1));
+        if (pruned_in_batch == 0) {
+            return Status::OK();
+        }
+        uint32_t kept = 0;
+        for (uint32_t i = 0; i < nrows_read; ++i) {
+            if (!_topn_pruned_rows.contains(_block_rowids[i])) {
+                _block_rowids[kept++] = _block_rowids[i];
+            }
+        }
+        _opts.stats->rows_stats_rp_filtered += nrows_read - kept;
+        nrows_read = kept;
+        if (nrows_read > 0) {
+            return Status::OK();
+        }
+        // an empty batch means the end of the segment, read on
+        nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    }
+    return Status::OK();
+}
+
 void SegmentIterator::_replace_version_col(size_t num_rows) {
     // Only the rowset with single version need to replace the version column.
     // Doris can't determine the version before publish_version finished, so
@@ -228,6 +228,12 @@ private:
                                        vectorized::MutableColumns& column_block, size_t nrows);
     [[nodiscard]] Status _read_columns_by_index(uint32_t nrows_read_limit, uint32_t& nrows_read,
                                                 bool set_block_rowid);
+    // Recomputes `_topn_pruned_rows` from the page zone maps once the topn runtime predicates
+    // tightened since the last call.
+    [[nodiscard]] Status _update_topn_pruned_rows();
+    // Drops the rows of `_block_rowids` on pages pruned by the topn runtime predicates, reading
+    // further batches while all rows of a batch are pruned.
+    [[nodiscard]] Status _remove_topn_pruned_rows(uint32_t nrows_read_limit, uint32_t& nrows_read);
     void _replace_version_col(size_t num_rows);
     Status _init_current_block(vectorized::Block* block,
                                std::vector<vectorized::MutableColumnPtr>& non_pred_vector,
@@ -401,6 +407,11 @@ private:
     roaring::Roaring _row_bitmap;
     // an iterator for `_row_bitmap` that can be used to extract row range to scan
     std::unique_ptr<BitmapRangeIterator> _range_iter;
+    // rows of the pages whose zone map can not pass the current topn runtime predicates, they
+    // are skipped before any column is read
+    roaring::Roaring _topn_pruned_rows;
+    // sum of the versions of the topn runtime predicates `_topn_pruned_rows` was computed with
+    uint64_t _topn_predicates_version = 0;
     // the next rowid to read
     rowid_t _cur_rowid;
     // members related to lazy materialization read
@@ -187,7 +187,8 @@ Status SegmentWriter::_create_column_writer(uint32_t cid, const TabletColumn& co
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
     opts.need_zone_map = column.is_key() || schema->keys_type() != KeysType::AGG_KEYS;
-    opts.need_bloom_filter = column.is_bf_column();
+    opts.need_bloom_filter = column.is_bf_column() ||
+                             vectorized::schema_util::need_extracted_column_bloom_filter(column);
     auto* tablet_index = schema->get_ngram_bf_index(column.unique_id());
     if (tablet_index) {
         opts.need_bloom_filter = true;
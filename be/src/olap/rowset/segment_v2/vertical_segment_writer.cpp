@@ -57,12 +57,14 @@
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
@@ -181,7 +183,8 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
     opts.need_zone_map = column.is_key() || tablet_schema->keys_type() != KeysType::AGG_KEYS;
-    opts.need_bloom_filter = column.is_bf_column();
+    opts.need_bloom_filter = column.is_bf_column() ||
+                             vectorized::schema_util::need_extracted_column_bloom_filter(column);
     auto* tablet_index = tablet_schema->get_ngram_bf_index(column.unique_id());
     if (tablet_index) {
         opts.need_bloom_filter = true;
@@ -1173,39 +1176,65 @@ Status VerticalSegmentWriter::write_batch() {
     std::map<uint32_t, vectorized::IOlapColumnDataAccessor*> cid_to_column;
     for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
         RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
-        for (auto& data : _batched_blocks) {
-            RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
-                    data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+    }
 
-            // convert column data from engine format to storage layer format
-            auto [status, column] = _olap_data_convertor->convert_column_data(cid);
-            if (!status.ok()) {
-                return status;
+    // Value columns are converted, encoded and finished independently of each other, they are
+    // handed to the segment writer pool when parallel encoding is enabled. Key, sequence and
+    // cluster key columns stay on this thread since the key index is built from them.
+    std::unique_ptr<ThreadPoolToken> token;
+    std::vector<Status> column_status(_tablet_schema->num_columns());
+    auto* pool = ExecEnv::GetInstance()->segment_writer_thread_pool();
+    if (config::enable_vertical_segment_writer_parallel_encode && pool != nullptr &&
+        _tablet_schema->num_columns() > 1) {
+        token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    }
+    auto query_thread_context = thread_context()->query_thread_context();
+    for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+        if (token != nullptr && _can_encode_column_in_parallel(cid)) {
+            auto st = token->submit_func([this, cid, &column_status, query_thread_context]() {
+                SCOPED_ATTACH_TASK(query_thread_context);
+                column_status[cid] = _append_and_finish_column(cid, nullptr);
+            });
+            if (st.ok()) {
+                continue;
             }
+            LOG(WARNING) << "failed to submit column " << cid
+                         << " to segment writer pool, encode it in place: " << st;
+        }
+        auto encode_column = [&](vectorized::IOlapColumnDataAccessor* converted) {
             if (cid < _tablet_schema->num_key_columns()) {
-                key_columns.push_back(column);
+                key_columns.push_back(converted);
             }
             if (_tablet_schema->has_sequence_col() && cid == _tablet_schema->sequence_col_idx()) {
-                seq_column = column;
+                seq_column = converted;
             }
             auto column_unique_id = _tablet_schema->column(cid).unique_id();
             if (_is_mow_with_cluster_key() &&
                 std::find(_tablet_schema->cluster_key_uids().begin(),
                           _tablet_schema->cluster_key_uids().end(),
                           column_unique_id) != _tablet_schema->cluster_key_uids().end()) {
-                cid_to_column[column_unique_id] = column;
+                cid_to_column[column_unique_id] = converted;
             }
-            RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
-                                                         data.num_rows));
-            _olap_data_convertor->clear_source_content();
+        };
+        column_status[cid] = _append_and_finish_column(cid, encode_column);
+        if (!column_status[cid].ok()) {
+            break;
         }
-        if (_data_dir != nullptr &&
-            _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
-            return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
-                                                            _data_dir->path_hash());
+        if (token == nullptr) {
+            RETURN_IF_ERROR(_column_writers[cid]->write_data());
+        }
+    }
+    if (token != nullptr) {
+        token->wait();
+    }
+    for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+        RETURN_IF_ERROR(column_status[cid]);
+    }
+    if (token != nullptr) {
+        // column data is written in column order once all columns are encoded
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            RETURN_IF_ERROR(_column_writers[cid]->write_data());
         }
-        RETURN_IF_ERROR(_column_writers[cid]->finish());
-        RETURN_IF_ERROR(_column_writers[cid]->write_data());
     }
 
     for (auto& data : _batched_blocks) {
@@ -1232,6 +1261,50 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+bool VerticalSegmentWriter::_can_encode_column_in_parallel(uint32_t cid) {
+    const auto& column = _tablet_schema->column(cid);
+    if (cid < _tablet_schema->num_key_columns() ||
+        (_tablet_schema->has_sequence_col() && cid == _tablet_schema->sequence_col_idx())) {
+        return false;
+    }
+    if (_is_mow_with_cluster_key() &&
+        std::find(_tablet_schema->cluster_key_uids().begin(),
+                  _tablet_schema->cluster_key_uids().end(),
+                  column.unique_id()) != _tablet_schema->cluster_key_uids().end()) {
+        return false;
+    }
+    // inverted index writers share the segment's index file writer, variant columns are
+    // extended with sub columns afterwards
+    return _tablet_schema->inverted_index(column) == nullptr && !column.is_variant_type();
+}
+
+Status VerticalSegmentWriter::_append_and_finish_column(
+        uint32_t cid,
+        const std::function<void(vectorized::IOlapColumnDataAccessor*)>& on_converted) {
+    for (auto& data : _batched_blocks) {
+        RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+
+        // convert column data from engine format to storage layer format
+        auto [status, column] = _olap_data_convertor->convert_column_data(cid);
+        if (!status.ok()) {
+            return status;
+        }
+        if (on_converted) {
+            on_converted(column);
+        }
+        RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
+                                                     data.num_rows));
+        _olap_data_convertor->clear_source_content(cid);
+    }
+    if (_data_dir != nullptr &&
+        _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
+        return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
+                                                        _data_dir->path_hash());
+    }
+    return _column_writers[cid]->finish();
+}
+
 Status VerticalSegmentWriter::_generate_key_index(
         RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
         vectorized::IOlapColumnDataAccessor* seq_column,
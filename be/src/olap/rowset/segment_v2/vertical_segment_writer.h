@@ -138,6 +138,13 @@ private:
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
     Status _create_column_writer(uint32_t cid, const TabletColumn& column,
                                  const TabletSchemaSPtr& schema);
+    // A value column can be encoded on the segment writer pool, concurrently with other columns.
+    bool _can_encode_column_in_parallel(uint32_t cid);
+    // Converts and appends the batched rows of column `cid`, then finishes its writer.
+    // `on_converted` is called with the converted data of every batched block.
+    Status _append_and_finish_column(
+            uint32_t cid,
+            const std::function<void(vectorized::IOlapColumnDataAccessor*)>& on_converted);
     uint64_t _estimated_remaining_size();
     Status _write_ordinal_index();
     Status _write_zone_map();
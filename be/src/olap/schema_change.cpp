@@ -17,11 +17,13 @@
 
 #include "olap/schema_change.h"
 
+#include <gen_cpp/Exprs_types.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <glog/logging.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <map>
 #include <memory>
@@ -33,6 +35,7 @@
 #include "agent/be_exec_version_manager.h"
 #include "cloud/cloud_schema_change_job.h"
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/consts.h"
 #include "common/logging.h"
 #include "common/signal_handler.h"
@@ -73,8 +76,10 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -1202,65 +1207,148 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         return process_alter_exit();
     }
 
-    // b. Generate historical data converter
-    auto sc_procedure = _get_sc_procedure(
-            changer, sc_sorting, sc_directly,
-            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
+    // b. Convert historical data. Rowsets have disjoint versions, so they are converted into
+    // their own rowsets in parallel, and registered to the new tablet in version order after.
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    size_t parallelism = std::min<size_t>(
+            std::max(config::schema_change_convert_rowsets_threads, 1), rs_readers.size());
+    // the memory limit is shared by all the converting threads
+    int64_t mem_limit =
+            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change() /
+            std::max<int64_t>(static_cast<int64_t>(parallelism), 1);
 
     DBUG_EXECUTE_IF("SchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
-    // c.Convert historical data
-    bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
-        // set status for monitor
-        // As long as there is a new_table as running, ref table is set as running
-        // NOTE If the first sub_table fails first, it will continue to go as normal here
-        // When tablet create new rowset writer, it may change rowset type, in this case
-        // linked schema change will not be used.
-        RowsetWriterContext context;
-        context.version = rs_reader->version();
-        context.rowset_state = VISIBLE;
-        context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
-        context.tablet_schema = _new_tablet_schema;
-        context.newest_write_timestamp = rs_reader->newest_write_timestamp();
-
-        if (!rs_reader->rowset()->is_local()) {
-            context.storage_resource =
-                    *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
+    struct ConvertResult {
+        Status status;
+        RowsetSharedPtr rowset;
+        PendingRowsetGuard pending_rs_guard;
+    };
+    std::vector<ConvertResult> results(rs_readers.size());
+    std::atomic<bool> has_failure = false;
+    std::atomic<size_t> num_converted = 0;
+    auto convert_rowset = [&](size_t idx) {
+        const auto& rs_reader = rs_readers[idx];
+        auto& result = results[idx];
+        if (has_failure) {
+            result.status = Status::Cancelled("schema change is cancelled by other rowsets");
+            return;
+        }
+        result.status = [&]() -> Status {
+            // When tablet create new rowset writer, it may change rowset type, in this case
+            // linked schema change will not be used.
+            RowsetWriterContext context;
+            context.version = rs_reader->version();
+            context.rowset_state = VISIBLE;
+            context.segments_overlap = rs_reader->rowset()->rowset_meta()->segments_overlap();
+            context.tablet_schema = _new_tablet_schema;
+            context.newest_write_timestamp = rs_reader->newest_write_timestamp();
+
+            if (!rs_reader->rowset()->is_local()) {
+                context.storage_resource =
+                        *DORIS_TRY(rs_reader->rowset()->rowset_meta()->remote_storage_resource());
+            }
+
+            context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
+            // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key
+            // index
+            bool vertical = false;
+            if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
+                // see VBaseSchemaChangeWithSorting::_external_sorting
+                vertical = true;
+            }
+            auto writer_result = _new_tablet->create_rowset_writer(context, vertical);
+            if (!writer_result.has_value()) {
+                return Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                         writer_result.error().to_string());
+            }
+            auto rowset_writer = std::move(writer_result).value();
+            result.pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
+
+            // the converter keeps row counters and sorting state, so each rowset has its own
+            auto sc_procedure = _get_sc_procedure(changer, sc_sorting, sc_directly, mem_limit);
+            if (auto st = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet,
+                                                _base_tablet, _base_tablet_schema,
+                                                _new_tablet_schema);
+                !st) {
+                LOG(WARNING) << "failed to process the version."
+                             << " version=" << rs_reader->version().first << "-"
+                             << rs_reader->version().second << ", " << st.to_string();
+                return st;
+            }
+            if (auto st = rowset_writer->build(result.rowset); !st.ok()) {
+                LOG(WARNING) << "failed to build rowset, exit alter process";
+                return st;
+            }
+            return Status::OK();
+        }();
+        if (!result.status.ok()) {
+            has_failure = true;
+            return;
         }
+        LOG(INFO) << "converted rowset for new_tablet=" << _new_tablet->tablet_id()
+                  << ", version=" << rs_reader->version().first << "-"
+                  << rs_reader->version().second << ", progress=" << ++num_converted << "/"
+                  << rs_readers.size();
+    };
 
-        context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
-        // TODO if support VerticalSegmentWriter, also need to handle cluster key primary key index
-        bool vertical = false;
-        if (sc_sorting && !_new_tablet->tablet_schema()->cluster_key_uids().empty()) {
-            // see VBaseSchemaChangeWithSorting::_external_sorting
-            vertical = true;
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            convert_rowset(i);
         }
-        auto result = _new_tablet->create_rowset_writer(context, vertical);
-        if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
+    } else {
+        std::unique_ptr<ThreadPool> pool;
+        res = ThreadPoolBuilder("SchemaChangeConvert")
+                      .set_min_threads(static_cast<int>(parallelism))
+                      .set_max_threads(static_cast<int>(parallelism))
+                      .build(&pool);
+        if (!res) {
             return process_alter_exit();
         }
-        auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
-
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
-            LOG(WARNING) << "failed to process the version."
-                         << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            res = pool->submit_func([&, mem_tracker, i]() {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                convert_rowset(i);
+            });
+            if (!res) {
+                has_failure = true;
+                break;
+            }
+        }
+        pool->wait();
+        pool->shutdown();
+        if (!res) {
+            for (auto& result : results) {
+                if (result.rowset) {
+                    _local_storage_engine.add_unused_rowset(result.rowset);
+                }
+            }
             return process_alter_exit();
         }
+    }
+
+    // c. Register the new rowsets in version order
+    bool have_failure_rowset = false;
+    size_t i = 0;
+    for (; i < rs_readers.size(); ++i) {
+        const auto& rs_reader = rs_readers[i];
+        auto& result = results[i];
+        if (!result.status.ok()) {
+            // report the first real failure instead of the cancellation caused by it
+            res = result.status;
+            for (size_t j = i; j < rs_readers.size(); ++j) {
+                if (!results[j].status.ok() && !results[j].status.is<ErrorCode::CANCELLED>()) {
+                    res = results[j].status;
+                    break;
+                }
+            }
+            break;
+        }
         // Add the new version of the data to the header
         // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
         std::lock_guard lock(_new_tablet->get_push_lock());
-        RowsetSharedPtr new_rowset;
-        if (!(res = rowset_writer->build(new_rowset)).ok()) {
-            LOG(WARNING) << "failed to build rowset, exit alter process";
-            return process_alter_exit();
-        }
+        const RowsetSharedPtr& new_rowset = result.rowset;
         res = _new_tablet->add_rowset(new_rowset);
         if (res.is<PUSH_VERSION_ALREADY_EXIST>()) {
             LOG(WARNING) << "version already exist, version revert occurred. "
@@ -1275,7 +1363,8 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
                          << ", version=" << rs_reader->version().first << "-"
                          << rs_reader->version().second;
             _local_storage_engine.add_unused_rowset(new_rowset);
-            return process_alter_exit();
+            ++i;
+            break;
         } else {
             VLOG_NOTICE << "register new version. tablet=" << _new_tablet->tablet_id()
                         << ", version=" << rs_reader->version().first << "-"
@@ -1289,6 +1378,12 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
                    << " version=" << rs_reader->version().first << "-"
                    << rs_reader->version().second;
     }
+    // the rowsets after the failed one are never registered
+    for (; i < rs_readers.size(); ++i) {
+        if (results[i].rowset) {
+            _local_storage_engine.add_unused_rowset(results[i].rowset);
+        }
+    }
 
     // XXX:The SchemaChange state should not be canceled at this time, because the new Delta has to be converted to the old and new Schema version
     return process_alter_exit();
@@ -1296,6 +1391,48 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
 
 static const std::string WHERE_SIGN_LOWER = to_lower("__DORIS_WHERE_SIGN__");
 
+// Whether the new column `i` is a value column only widened from its origin column, e.g.
+// INT -> BIGINT. Such a column can be read from the original segments by
+// WideningColumnIterator, so the segments are linked instead of rewritten.
+static bool can_widen_column_on_read(const SchemaChangeParams& sc_params,
+                                     const TabletSchema& base_tablet_schema,
+                                     const TabletSchema& new_tablet_schema, size_t i,
+                                     const ColumnMapping& column_mapping) {
+    if (!config::enable_schema_change_widen_column_on_read ||
+        i < new_tablet_schema.num_key_columns() ||
+        static_cast<int32_t>(i) == new_tablet_schema.sequence_col_idx()) {
+        return false;
+    }
+    // only a plain cast of the origin column
+    const auto& expr = column_mapping.expr;
+    if (expr->nodes.size() != 2 || expr->nodes[0].node_type != TExprNodeType::CAST_EXPR ||
+        expr->nodes[1].node_type != TExprNodeType::SLOT_REF) {
+        return false;
+    }
+    const TabletColumn& new_column = new_tablet_schema.column(i);
+    auto mv_param = sc_params.materialized_params_map.find(to_lower(new_column.name()));
+    if (mv_param == sc_params.materialized_params_map.end()) {
+        return false;
+    }
+    int32_t ref_idx = base_tablet_schema.field_index(mv_param->second.origin_column_name);
+    if (ref_idx < 0) {
+        return false;
+    }
+    const TabletColumn& ref_column = base_tablet_schema.column(ref_idx);
+    // segments find columns by unique id, and the indexes in segments are built on the old
+    // type and not usable after widening
+    return ref_column.unique_id() == new_column.unique_id() &&
+           (new_column.is_nullable() || !ref_column.is_nullable()) &&
+           segment_v2::WideningColumnIterator::can_widen(ref_column.type(), new_column.type()) &&
+           !new_column.has_bitmap_index() && !new_column.is_bf_column() &&
+           new_tablet_schema.inverted_index(new_column) == nullptr &&
+           !new_tablet_schema.has_ngram_bf_index(new_column.unique_id()) &&
+           !new_tablet_schema.has_row_store_for_all_columns() &&
+           std::find(new_tablet_schema.row_columns_uids().begin(),
+                     new_tablet_schema.row_columns_uids().end(),
+                     new_column.unique_id()) == new_tablet_schema.row_columns_uids().end();
+}
+
 // @static
 // Analyze the mapping of the column and the mapping of the filter key
 Status SchemaChangeJob::parse_request(const SchemaChangeParams& sc_params,
@@ -1443,6 +1580,13 @@ Status SchemaChangeJob::parse_request(const SchemaChangeParams& sc_params,
     for (size_t i = 0; i < new_tablet_schema->num_columns(); ++i) {
         ColumnMapping* column_mapping = changer->get_mutable_column_mapping(i);
         if (column_mapping->expr != nullptr) {
+            if (can_widen_column_on_read(sc_params, *base_tablet_schema, *new_tablet_schema, i,
+                                         *column_mapping)) {
+                LOG(INFO) << "column " << new_tablet_schema->column(i).name()
+                          << " is widened on read, base_tablet_schema_version="
+                          << base_tablet_schema->schema_version();
+                continue;
+            }
             *sc_directly = true;
             return Status::OK();
         } else if (column_mapping->ref_column_idx >= 0) {
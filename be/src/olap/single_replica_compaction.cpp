@@ -442,11 +442,12 @@ Status SingleReplicaCompaction::_download_files(DataDir* data_dir,
                   << mask_token(remote_file_url) << " to: " << local_file_path
                   << ". size(B): " << file_size << ", timeout(s): " << estimate_timeout;
 
+        // a failed attempt keeps the downloaded part, the retry resumes from there
         auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path,
                             file_size](HttpClient* client) {
-            RETURN_IF_ERROR(client->init(remote_file_url));
+            RETURN_IF_ERROR(client->init(remote_file_url + "&acquire_md5=true"));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            RETURN_IF_ERROR(client->download_resumable(local_file_path));
 
             DBUG_EXECUTE_IF("single_compaction_failed_download_file",
                             { return Status::InternalError("failed to download file"); });
@@ -457,8 +458,24 @@ Status SingleReplicaCompaction::_download_files(DataDir* data_dir,
                              << ", remote_path=" << mask_token(remote_file_url)
                              << ", file_size=" << file_size
                              << ", local_file_size=" << local_file_size;
+                RETURN_IF_ERROR(io::global_local_filesystem()->delete_file(local_file_path));
                 return Status::InternalError("downloaded file size is not equal");
             }
+            std::string remote_file_md5;
+            RETURN_IF_ERROR(client->get_content_md5(&remote_file_md5));
+            if (!remote_file_md5.empty()) { // keep compatibility
+                std::string local_file_md5;
+                RETURN_IF_ERROR(io::global_local_filesystem()->md5sum(local_file_path,
+                                                                      &local_file_md5));
+                if (local_file_md5 != remote_file_md5) {
+                    LOG(WARNING) << "download file md5 error"
+                                 << ", remote_path=" << mask_token(remote_file_url)
+                                 << ", remote_file_md5=" << remote_file_md5
+                                 << ", local_file_md5=" << local_file_md5;
+                    RETURN_IF_ERROR(io::global_local_filesystem()->delete_file(local_file_path));
+                    return Status::InternalError("downloaded file md5 is not equal");
+                }
+            }
             return io::global_local_filesystem()->permission(local_file_path,
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
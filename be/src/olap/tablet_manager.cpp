@@ -28,6 +28,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
 #include <list>
 #include <mutex>
 #include <ostream>
@@ -229,6 +230,7 @@ Status TabletManager::_add_tablet_to_map_unlocked(TTabletId tablet_id,
     tablet->register_tablet_into_dir();
     tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
     tablet_map[tablet_id] = tablet;
+    _reset_tablet_map_snapshot(_get_tablets_shard(tablet_id));
     _add_tablet_to_partition(tablet);
     g_tablet_meta_schema_columns_count << tablet->tablet_meta()->tablet_columns_num();
     COUNTER_UPDATE(ADD_CHILD_TIMER(profile, "RegisterTabletInfo", "AddTablet"),
@@ -555,6 +557,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
         _remove_tablet_from_partition(to_drop_tablet);
         tablet_map_t& tablet_map = _get_tablet_map(tablet_id);
         tablet_map.erase(tablet_id);
+        _reset_tablet_map_snapshot(_get_tablets_shard(tablet_id));
     }
 
     to_drop_tablet->clear_cache();
@@ -594,8 +597,10 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
-    return _get_tablet_unlocked(tablet_id, include_deleted, err);
+    auto snapshot = _get_tablet_map_snapshot(_get_tablets_shard(tablet_id));
+    auto iter = snapshot->find(tablet_id);
+    return _check_tablet(iter == snapshot->end() ? nullptr : iter->second, tablet_id,
+                         include_deleted, err);
 }
 
 std::vector<TabletSharedPtr> TabletManager::get_all_tablet(std::function<bool(Tablet*)>&& filter) {
@@ -607,27 +612,24 @@ std::vector<TabletSharedPtr> TabletManager::get_all_tablet(std::function<bool(Ta
 
 void TabletManager::for_each_tablet(std::function<void(const TabletSharedPtr&)>&& handler,
                                     std::function<bool(Tablet*)>&& filter) {
-    std::vector<TabletSharedPtr> tablets;
     for (const auto& tablets_shard : _tablets_shards) {
-        tablets.clear();
-        {
-            std::shared_lock rdlock(tablets_shard.lock);
-            for (const auto& [id, tablet] : tablets_shard.tablet_map) {
-                if (filter(tablet.get())) {
-                    tablets.emplace_back(tablet);
-                }
+        // the snapshot keeps the tablets alive, so no copy is needed while handling them
+        auto snapshot = _get_tablet_map_snapshot(tablets_shard);
+        for (const auto& [id, tablet] : *snapshot) {
+            if (filter(tablet.get())) {
+                handler(tablet);
             }
         }
-        for (const auto& tablet : tablets) {
-            handler(tablet);
-        }
     }
 }
 
 TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool include_deleted,
                                                     string* err) {
-    TabletSharedPtr tablet;
-    tablet = _get_tablet_unlocked(tablet_id);
+    return _check_tablet(_get_tablet_unlocked(tablet_id), tablet_id, include_deleted, err);
+}
+
+TabletSharedPtr TabletManager::_check_tablet(TabletSharedPtr tablet, TTabletId tablet_id,
+                                             bool include_deleted, string* err) {
     if (tablet == nullptr && include_deleted) {
         std::shared_lock rdlock(_shutdown_tablets_lock);
         for (auto& deleted_tablet : _shutdown_tablets) {
@@ -660,8 +662,7 @@ TabletSharedPtr TabletManager::_get_tablet_unlocked(TTabletId tablet_id, bool in
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, TabletUid tablet_uid,
                                           bool include_deleted, string* err) {
-    std::shared_lock rdlock(_get_tablets_shard_lock(tablet_id));
-    TabletSharedPtr tablet = _get_tablet_unlocked(tablet_id, include_deleted, err);
+    TabletSharedPtr tablet = get_tablet(tablet_id, include_deleted, err);
     if (tablet != nullptr && tablet->tablet_uid() == tablet_uid) {
         return tablet;
     }
@@ -728,8 +729,18 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
 struct TabletScore {
     TabletSharedPtr tablet_ptr;
     int score;
+    // the order tablets are picked in, see config::compaction_read_heat_weight
+    double rank;
 };
 
+static double compaction_rank(const TabletSharedPtr& tablet, uint32_t score) {
+    double weight = config::compaction_read_heat_weight;
+    if (weight <= 0) {
+        return score;
+    }
+    return score * (1.0 + weight * std::log2(1.0 + tablet->query_read_heat()));
+}
+
 std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         CompactionType compaction_type, DataDir* data_dir,
         const std::unordered_set<TabletSharedPtr>& tablet_submitted_compaction, uint32_t* score,
@@ -739,11 +750,14 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    double highest_rank = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
     TabletSharedPtr best_single_compact_tablet;
-    auto cmp = [](TabletScore left, TabletScore right) { return left.score > right.score; };
+    auto cmp = [](const TabletScore& left, const TabletScore& right) {
+        return left.rank > right.rank;
+    };
     std::priority_queue<TabletScore, std::vector<TabletScore>, decltype(cmp)> top_tablets(cmp);
 
     auto handler = [&](const TabletSharedPtr& tablet_ptr) {
@@ -812,12 +826,14 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
             }
         }
 
+        double current_rank = compaction_rank(tablet_ptr, current_compaction_score);
         if (config::compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
             ts.score = current_compaction_score;
             ts.tablet_ptr = tablet_ptr;
+            ts.rank = current_rank;
             if ((top_tablets.size() >= config::compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 current_rank > top_tablets.top().rank) ||
                 top_tablets.size() < config::compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -832,10 +848,11 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (current_rank > highest_rank && !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
+                    highest_rank = current_rank;
                     highest_score = current_compaction_score;
                     best_tablet = tablet_ptr;
                 }
@@ -1602,6 +1619,27 @@ TabletManager::tablets_shard& TabletManager::_get_tablets_shard(TTabletId tablet
     return _tablets_shards[tabletId & _tablets_shards_mask];
 }
 
+MultiVersion<TabletManager::tablet_map_t>::Version TabletManager::_get_tablet_map_snapshot(
+        const tablets_shard& shard) {
+    auto snapshot = shard.tablet_map_snapshot.get();
+    if (snapshot != nullptr) {
+        return snapshot;
+    }
+    // Rebuild and publish under the read lock, so that no writer can modify tablet_map and
+    // reset the snapshot before the rebuilt one is published.
+    std::shared_lock rdlock(shard.lock);
+    snapshot = shard.tablet_map_snapshot.get();
+    if (snapshot == nullptr) {
+        shard.tablet_map_snapshot.set(std::make_unique<const tablet_map_t>(shard.tablet_map));
+        snapshot = shard.tablet_map_snapshot.get();
+    }
+    return snapshot;
+}
+
+void TabletManager::_reset_tablet_map_snapshot(tablets_shard& shard) {
+    shard.tablet_map_snapshot.set(nullptr);
+}
+
 void TabletManager::get_tablets_distribution_on_different_disks(
         std::map<int64_t, std::map<DataDir*, int64_t>>& tablets_num_on_disk,
         std::map<int64_t, std::map<DataDir*, std::vector<TabletSize>>>& tablets_info_on_disk) {
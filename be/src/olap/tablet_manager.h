@@ -36,6 +36,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/multi_version.h"
 #include "common/status.h"
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
@@ -198,6 +199,8 @@ private:
                         bool is_drop_table_or_partition, bool had_held_shard_lock);
 
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id);
+    TabletSharedPtr _check_tablet(TabletSharedPtr tablet, TTabletId tablet_id,
+                                  bool include_deleted, std::string* err);
     TabletSharedPtr _get_tablet_unlocked(TTabletId tablet_id, bool include_deleted,
                                          std::string* err);
 
@@ -237,6 +240,10 @@ private:
         }
         mutable std::shared_mutex lock;
         tablet_map_t tablet_map;
+        // Immutable copy of tablet_map for lookups without taking `lock`. Writers reset it
+        // under the write lock, and the next reader rebuilds it, so bulk loads at startup
+        // do not copy the map on every insert.
+        mutable MultiVersion<tablet_map_t> tablet_map_snapshot;
         std::mutex lock_for_transition;
         // tablet do clone, path gc, move to trash, disk migrate will record in tablets_under_transition
         // tablet <reason, thread_id, lock_times>
@@ -274,6 +281,10 @@ private:
 
     tablets_shard& _get_tablets_shard(TTabletId tabletId);
 
+    MultiVersion<tablet_map_t>::Version _get_tablet_map_snapshot(const tablets_shard& shard);
+    // Must be called with the shard's write lock after tablet_map is modified.
+    void _reset_tablet_map_snapshot(tablets_shard& shard);
+
     std::mutex _two_tablet_mtx;
 };
 
@@ -1261,6 +1261,19 @@ uint64_t DeleteBitmap::get_delete_bitmap_count() {
     return count;
 }
 
+uint64_t DeleteBitmap::get_count_with_range(const BitmapKey& start, const BitmapKey& end) const {
+    DCHECK(start <= end);
+    std::shared_lock l(lock);
+    uint64_t count = 0;
+    for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end(); ++it) {
+        if (it->first > end) {
+            break;
+        }
+        count++;
+    }
+    return count;
+}
+
 // We cannot just copy the underlying memory to construct a string
 // due to equivalent objects may have different padding bytes.
 // Reading padding bytes is undefined behavior, neither copy nor
@@ -546,6 +546,11 @@ public:
 
     uint64_t get_delete_bitmap_count();
 
+    /**
+     * Gets the number of bitmaps in range [start, end]
+     */
+    uint64_t get_count_with_range(const BitmapKey& start, const BitmapKey& end) const;
+
     class AggCachePolicy : public LRUCachePolicy {
     public:
         AggCachePolicy(size_t capacity)
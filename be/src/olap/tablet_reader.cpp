@@ -263,6 +263,7 @@ Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     _reader_context.output_columns = &read_params.output_columns;
     _reader_context.push_down_agg_type_opt = read_params.push_down_agg_type_opt;
     _reader_context.ttl_seconds = _tablet->ttl_seconds();
+    _reader_context.hot_file_cache_expiration_time = _tablet->hot_file_cache_expiration_time;
 
     return Status::OK();
 }
@@ -68,6 +68,15 @@ void TabletSchemaCache::release(Cache::Handle* lru_handle) {
     LRUCachePolicy::release(lru_handle);
 }
 
+Cache::Handle* TabletSchemaCache::acquire(Cache::Handle* handle) {
+    DCHECK(handle != nullptr);
+    auto* lru_handle = lookup(reinterpret_cast<LRUHandle*>(handle)->key());
+    if (lru_handle) {
+        g_tablet_schema_cache_hit_count << 1;
+    }
+    return lru_handle;
+}
+
 TabletSchemaCache::CacheValue::~CacheValue() {
     g_tablet_schema_cache_count << -1;
     g_tablet_schema_cache_columns_count << -tablet_schema->num_columns();
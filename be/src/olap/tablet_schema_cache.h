@@ -44,6 +44,10 @@ public:
 
     void release(Cache::Handle*);
 
+    // Take another reference on the entry of `handle`, the cached key is reused so the schema
+    // is neither serialized nor hashed again. Return nullptr if the entry is no longer cached.
+    Cache::Handle* acquire(Cache::Handle* handle);
+
 private:
     class CacheValue : public LRUCacheValueBase {
     public:
@@ -28,6 +28,7 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -66,6 +67,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -679,8 +681,9 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
-    std::vector<std::pair<std::string, size_t>> batch_files;
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
     for (size_t i = 0; i < total_files;) {
+        std::vector<std::pair<std::string, size_t>> batch_files;
         size_t batch_file_size = 0;
         for (size_t j = i; j < total_files; j++) {
             // Split batchs by file number and file size,
@@ -692,19 +695,66 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_files.push_back(file_info_list[j]);
             batch_file_size += file_info_list[j].second;
         }
-
-        // check disk capacity
-        if (data_dir->reach_capacity_limit(batch_file_size)) {
-            return Status::Error<EXCEEDED_LIMIT>(
-                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                    batch_file_size);
-        }
-
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
         total_file_size += batch_file_size;
         i += batch_files.size();
-        batch_files.clear();
+        batches.push_back(std::move(batch_files));
+    }
+
+    // check disk capacity for all files up front, batches are downloaded concurrently
+    if (data_dir->reach_capacity_limit(total_file_size)) {
+        return Status::Error<EXCEEDED_LIMIT>("reach the capacity limit of path {}, file_size={}",
+                                             data_dir->path(), total_file_size);
+    }
+
+    // The last batch holds the .hdr file only, it is downloaded after all data files are
+    // complete, so the other batches can be downloaded concurrently.
+    size_t data_batches = batches.empty() ? 0 : batches.size() - 1;
+    int parallelism = std::min<int>(config::clone_download_batch_parallelism, data_batches);
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < data_batches; ++i) {
+            RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batches[i]));
+        }
+    } else {
+        std::unique_ptr<ThreadPool> pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownload")
+                                .set_min_threads(parallelism)
+                                .set_max_threads(parallelism)
+                                .build(&pool));
+        std::mutex status_lock;
+        Status download_status;
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        for (size_t i = 0; i < data_batches; ++i) {
+            Status st = pool->submit_func([&, mem_tracker, i]() {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                {
+                    std::lock_guard lock(status_lock);
+                    if (!download_status.ok()) {
+                        return;
+                    }
+                }
+                Status batch_status =
+                        download_files_v2(address, token, remote_dir, local_dir, batches[i]);
+                if (!batch_status.ok()) {
+                    std::lock_guard lock(status_lock);
+                    if (download_status.ok()) {
+                        download_status = std::move(batch_status);
+                    }
+                }
+            });
+            if (!st.ok()) {
+                std::lock_guard lock(status_lock);
+                if (download_status.ok()) {
+                    download_status = std::move(st);
+                }
+                break;
+            }
+        }
+        pool->wait();
+        pool->shutdown();
+        RETURN_IF_ERROR(download_status);
+    }
+    if (!batches.empty()) {
+        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batches.back()));
     }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -17,8 +17,14 @@
 
 #include "olap/wal/wal_table.h"
 
+#include <bvar/bvar.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
 #include "gutil/strings/split.h"
 #include "http/action/http_stream.h"
 #include "http/action/stream_load.h"
@@ -37,6 +43,10 @@
 namespace doris {
 
 bvar::Adder<uint64_t> wal_fail("group_commit_wal_fail");
+bvar::Adder<uint64_t> wal_replay_success("group_commit_wal_replay_success");
+bvar::Adder<uint64_t> wal_replay_bytes("group_commit_wal_replay_bytes");
+bvar::PerSecond<bvar::Adder<uint64_t>> wal_replay_bytes_per_second(
+        "group_commit_wal_replay_bytes_per_second", &wal_replay_bytes);
 
 WalTable::WalTable(ExecEnv* exec_env, int64_t db_id, int64_t table_id)
         : _exec_env(exec_env), _db_id(db_id), _table_id(table_id) {
@@ -83,31 +93,72 @@ void WalTable::_pick_relay_wals() {
     }
 }
 
+Status WalTable::_relay_one_wal(const std::shared_ptr<WalInfo>& wal_info, bool* need_retry) {
+    *need_retry = false;
+    wal_info->add_retry_num();
+    std::error_code ec;
+    auto wal_bytes = std::filesystem::file_size(wal_info->get_wal_path(), ec);
+    auto st = _replay_wal_internal(wal_info->get_wal_path());
+    auto msg = st.msg();
+    if (st.ok() || st.is<ErrorCode::PUBLISH_TIMEOUT>() || st.is<ErrorCode::NOT_FOUND>() ||
+        st.is<ErrorCode::DATA_QUALITY_ERROR>() ||
+        (msg.find("has already been used") != msg.npos &&
+         (msg.find("COMMITTED") != msg.npos || msg.find("VISIBLE") != msg.npos))) {
+        LOG(INFO) << "succeed to replay wal=" << wal_info->get_wal_path()
+                  << ", st=" << st.to_string();
+        doris::wal_replay_success << 1;
+        if (!ec) {
+            doris::wal_replay_bytes << wal_bytes;
+        }
+        // delete wal
+        WARN_IF_ERROR(_exec_env->wal_mgr()->delete_wal(_table_id, wal_info->get_wal_id()),
+                      "failed to delete wal=" + wal_info->get_wal_path());
+        if (config::group_commit_wait_replay_wal_finish) {
+            RETURN_IF_ERROR(_exec_env->wal_mgr()->notify_relay_wal(wal_info->get_wal_id()));
+        }
+    } else {
+        doris::wal_fail << 1;
+        LOG(WARNING) << "failed to replay wal=" << wal_info->get_wal_path()
+                     << ", st=" << st.to_string();
+        *need_retry = true;
+    }
+    return Status::OK();
+}
+
 Status WalTable::_relay_wal_one_by_one() {
+    // every wal is replayed by its own load with its own label, so the wals of a table
+    // can be replayed concurrently
+    std::vector<std::shared_ptr<WalInfo>> replaying_wals(_replaying_queue.begin(),
+                                                         _replaying_queue.end());
     std::vector<std::shared_ptr<WalInfo>> need_retry_wals;
-    for (auto wal_info : _replaying_queue) {
-        wal_info->add_retry_num();
-        auto st = _replay_wal_internal(wal_info->get_wal_path());
-        auto msg = st.msg();
-        if (st.ok() || st.is<ErrorCode::PUBLISH_TIMEOUT>() || st.is<ErrorCode::NOT_FOUND>() ||
-            st.is<ErrorCode::DATA_QUALITY_ERROR>() ||
-            (msg.find("has already been used") != msg.npos &&
-             (msg.find("COMMITTED") != msg.npos || msg.find("VISIBLE") != msg.npos))) {
-            LOG(INFO) << "succeed to replay wal=" << wal_info->get_wal_path()
-                      << ", st=" << st.to_string();
-            // delete wal
-            WARN_IF_ERROR(_exec_env->wal_mgr()->delete_wal(_table_id, wal_info->get_wal_id()),
-                          "failed to delete wal=" + wal_info->get_wal_path());
-            if (config::group_commit_wait_replay_wal_finish) {
-                RETURN_IF_ERROR(_exec_env->wal_mgr()->notify_relay_wal(wal_info->get_wal_id()));
+    Status status;
+    std::mutex lock;
+    std::atomic<size_t> next_wal {0};
+    auto replay_func = [&]() {
+        for (size_t i = next_wal++; i < replaying_wals.size(); i = next_wal++) {
+            bool need_retry = false;
+            auto st = _relay_one_wal(replaying_wals[i], &need_retry);
+            std::lock_guard l(lock);
+            if (need_retry) {
+                need_retry_wals.push_back(replaying_wals[i]);
+            }
+            if (!st.ok() && status.ok()) {
+                status = st;
             }
-        } else {
-            doris::wal_fail << 1;
-            LOG(WARNING) << "failed to replay wal=" << wal_info->get_wal_path()
-                         << ", st=" << st.to_string();
-            need_retry_wals.push_back(wal_info);
         }
+    };
+    auto parallelism = std::min<size_t>(
+            std::max(config::group_commit_replay_wal_parallelism_per_table, 1),
+            replaying_wals.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < parallelism; ++i) {
+        threads.emplace_back(replay_func);
+    }
+    replay_func();
+    for (auto& thread : threads) {
+        thread.join();
     }
+    RETURN_IF_ERROR(status);
     {
         std::lock_guard<std::mutex> lock(_replay_wal_lock);
         _replaying_queue.clear();
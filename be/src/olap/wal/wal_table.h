@@ -44,6 +44,7 @@ private:
     void _pick_relay_wals();
     bool _need_replay(std::shared_ptr<WalInfo>);
     Status _relay_wal_one_by_one();
+    Status _relay_one_wal(const std::shared_ptr<WalInfo>& wal_info, bool* need_retry);
 
     Status _replay_wal_internal(const std::string& wal);
     Status _try_abort_txn(int64_t db_id, std::string& label);
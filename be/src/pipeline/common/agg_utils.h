@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <variant>
 #include <vector>
 
 #include "vec/common/arena.h"
+#include "vec/common/hash_table/direct_mapped_hash_map.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
 #include "vec/common/hash_table/ph_hash_map.h"
@@ -32,6 +34,11 @@ template <typename T>
 using AggData = PHHashMap<T, vectorized::AggregateDataPtr, HashCRC32<T>>;
 template <typename T>
 using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
+// One byte keys index their cells directly instead of probing a hash table.
+template <typename T>
+using AggDataDirectMapped = DirectMappedHashMap<T, vectorized::AggregateDataPtr, HashCRC32<T>>;
+template <typename T>
+using AggDataDirectMappedNullable = vectorized::DataWithNullKey<AggDataDirectMapped<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
@@ -53,7 +60,7 @@ using AggregatedDataWithNullableShortStringKey =
 
 using AggregatedMethodVariants = std::variant<
         std::monostate, vectorized::MethodSerialized<AggregatedDataWithStringKey>,
-        vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>,
+        vectorized::MethodOneNumber<vectorized::UInt8, AggDataDirectMapped<vectorized::UInt8>>,
         vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggData<vectorized::UInt32>>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggData<vectorized::UInt64>>,
@@ -62,8 +69,8 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodOneNumber<vectorized::UInt256, AggData<vectorized::UInt256>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggregatedDataWithUInt32KeyPhase2>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggregatedDataWithUInt64KeyPhase2>,
-        vectorized::MethodSingleNullableColumn<
-                vectorized::MethodOneNumber<vectorized::UInt8, AggDataNullable<vectorized::UInt8>>>,
+        vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
+                vectorized::UInt8, AggDataDirectMappedNullable<vectorized::UInt8>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
                 vectorized::UInt16, AggDataNullable<vectorized::UInt16>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
@@ -100,7 +107,7 @@ struct AggregatedDataVariants
             method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
             break;
         case HashKeyType::int8_key:
-            emplace_single<vectorized::UInt8, AggData<vectorized::UInt8>>(nullable);
+            emplace_single<vectorized::UInt8, AggDataDirectMapped<vectorized::UInt8>>(nullable);
             break;
         case HashKeyType::int16_key:
             emplace_single<vectorized::UInt16, AggData<vectorized::UInt16>>(nullable);
@@ -159,10 +166,39 @@ struct AggregatedDataVariants
 using AggregatedDataVariantsUPtr = std::unique_ptr<AggregatedDataVariants>;
 using ArenaUPtr = std::unique_ptr<vectorized::Arena>;
 
+// Stores the keys and the aggregate states of the groups of a hash aggregation.
+//
+// In columnar layout (num_columnar_states > 0) the states of each aggregate function are stored
+// densely in their own column of a sub container, `size_of_aggregate_states` apart, so the state
+// of the j-th aggregate function of a group is at `get_aggregate_data() + j *
+// columnar_state_offset(size_of_aggregate_states)` and a batch add of one function only touches
+// its own column. The first slot is reserved for the null key, which needs the same layout.
 struct AggregateDataContainer {
 public:
-    AggregateDataContainer(size_t size_of_key, size_t size_of_aggregate_states)
-            : _size_of_key(size_of_key), _size_of_aggregate_states(size_of_aggregate_states) {}
+    AggregateDataContainer(size_t size_of_key, size_t size_of_aggregate_states,
+                           size_t num_columnar_states = 0)
+            : _size_of_key(size_of_key),
+              _size_of_aggregate_states(size_of_aggregate_states),
+              _num_columnar_states(num_columnar_states) {
+        if (_num_columnar_states > 0) {
+            _expand();
+            _begin_index = 1;
+            ++_total_count;
+            ++_index_in_sub_container;
+            _current_agg_data += _size_of_aggregate_states;
+            _current_keys += _size_of_key;
+        }
+    }
+
+    static constexpr size_t columnar_state_offset(size_t size_of_aggregate_states) {
+        return size_of_aggregate_states * SUB_CONTAINER_CAPACITY;
+    }
+
+    // The states of the null key in columnar layout, skipped by the iterators.
+    vectorized::AggregateDataPtr null_key_data() {
+        DCHECK_GT(_num_columnar_states, 0);
+        return _value_containers[0];
+    }
 
     int64_t memory_usage() const { return _arena_pool.size(); }
 
@@ -240,11 +276,11 @@ public:
         using IteratorBase<ConstIterator, true>::IteratorBase;
     };
 
-    ConstIterator begin() const { return {this, 0}; }
+    ConstIterator begin() const { return {this, _begin_index}; }
 
     ConstIterator cbegin() const { return begin(); }
 
-    Iterator begin() { return {this, 0}; }
+    Iterator begin() { return {this, _begin_index}; }
 
     ConstIterator end() const { return {this, _total_count}; }
     ConstIterator cend() const { return end(); }
@@ -269,7 +305,8 @@ private:
             _key_containers.emplace_back(_current_keys);
 
             _current_agg_data = (vectorized::AggregateDataPtr)_arena_pool.alloc(
-                    _size_of_aggregate_states * SUB_CONTAINER_CAPACITY);
+                    _size_of_aggregate_states * SUB_CONTAINER_CAPACITY *
+                    std::max<size_t>(_num_columnar_states, 1));
             _value_containers.emplace_back(_current_agg_data);
         } catch (...) {
             if (_current_keys) {
@@ -292,8 +329,10 @@ private:
     char* _current_keys = nullptr;
     size_t _size_of_key {};
     size_t _size_of_aggregate_states {};
+    size_t _num_columnar_states {};
     uint32_t _index_in_sub_container {};
     uint32_t _total_count {};
+    uint32_t _begin_index {};
     bool _inited = false;
 };
 } // namespace doris
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <glog/logging.h>
+#include <stdint.h>
+
 #include <variant>
 #include <vector>
 
@@ -24,16 +27,37 @@
 
 namespace doris {
 
-struct RowRefWithFlag {
-    bool visited;
+// Mapped value of the set hash tables, the build row of the key. Whether the row was matched by
+// the probe children is kept in SetRowBitmap, one bit per build row, outside of the table.
+struct SetRowRef {
     uint32_t row_num = 0;
-    RowRefWithFlag() = default;
-    RowRefWithFlag(size_t row_num_count, bool is_visited = false)
-            : visited(is_visited), row_num(row_num_count) {}
+    SetRowRef() = default;
+    SetRowRef(size_t row_num_count) : row_num(static_cast<uint32_t>(row_num_count)) {}
+};
+
+// One bit per build row of a set operator.
+class SetRowBitmap {
+public:
+    void reset(size_t rows, bool value) {
+        _words.assign((rows + 63) / 64, value ? ~uint64_t(0) : 0);
+    }
+    bool test(uint32_t row) const { return (_words[row / 64] >> (row % 64)) & 1; }
+    void set(uint32_t row) { _words[row / 64] |= uint64_t(1) << (row % 64); }
+    // keeps only the rows also set in `other`, then clears `other`
+    void intersect_and_clear(SetRowBitmap& other) {
+        DCHECK_EQ(_words.size(), other._words.size());
+        for (size_t i = 0; i < _words.size(); ++i) {
+            _words[i] &= other._words[i];
+            other._words[i] = 0;
+        }
+    }
+
+private:
+    std::vector<uint64_t> _words;
 };
 
 template <typename T>
-using SetData = PHHashMap<T, RowRefWithFlag, HashCRC32<T>>;
+using SetData = PHHashMap<T, SetRowRef, HashCRC32<T>>;
 
 template <typename T>
 using SetFixedKeyHashTableContext = vectorized::MethodKeysFixed<SetData<T>>;
@@ -46,8 +70,8 @@ using SetPrimaryTypeHashTableContextNullable = vectorized::MethodSingleNullableC
         vectorized::MethodOneNumber<T, vectorized::DataWithNullKey<SetData<T>>>>;
 
 using SetSerializedHashTableContext =
-        vectorized::MethodSerialized<PHHashMap<StringRef, RowRefWithFlag>>;
-using SetMethodOneString = vectorized::MethodStringNoCache<PHHashMap<StringRef, RowRefWithFlag>>;
+        vectorized::MethodSerialized<PHHashMap<StringRef, SetRowRef>>;
+using SetMethodOneString = vectorized::MethodStringNoCache<PHHashMap<StringRef, SetRowRef>>;
 
 using SetHashTableVariants =
         std::variant<std::monostate, SetSerializedHashTableContext, SetMethodOneString,
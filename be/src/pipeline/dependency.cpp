@@ -270,6 +270,26 @@ bool AggSharedState::do_limit_filter(vectorized::Block* block, size_t num_rows,
     return false;
 }
 
+std::unique_ptr<AggregateDataContainer> AggSharedState::create_aggregate_data_container(
+        size_t size_of_key) const {
+    if (columnar_state_stride > 0) {
+        return std::make_unique<AggregateDataContainer>(size_of_key, columnar_state_stride,
+                                                        offsets_of_aggregate_states.size());
+    }
+    /// some aggregate functions (like AVG for decimal) have align issues.
+    return std::make_unique<AggregateDataContainer>(
+            size_of_key, ((total_size_of_aggregate_states + align_aggregate_states - 1) /
+                          align_aggregate_states) *
+                                 align_aggregate_states);
+}
+
+vectorized::AggregateDataPtr AggSharedState::alloc_null_key_data() {
+    if (columnar_state_stride > 0) {
+        return aggregate_data_container->null_key_data();
+    }
+    return agg_arena_pool->aligned_alloc(total_size_of_aggregate_states, align_aggregate_states);
+}
+
 Status AggSharedState::reset_hash_table() {
     return std::visit(
             vectorized::Overload {
@@ -295,11 +315,8 @@ Status AggSharedState::reset_hash_table() {
                             RETURN_IF_ERROR(st);
                         }
 
-                        aggregate_data_container.reset(new AggregateDataContainer(
-                                sizeof(typename HashTableType::key_type),
-                                ((total_size_of_aggregate_states + align_aggregate_states - 1) /
-                                 align_aggregate_states) *
-                                        align_aggregate_states));
+                        aggregate_data_container = create_aggregate_data_container(
+                                sizeof(typename HashTableType::key_type));
                         agg_method.hash_table.reset(new HashTableType());
                         agg_arena_pool.reset(new vectorized::Arena);
                         return Status::OK();
@@ -298,6 +298,11 @@ public:
 
     Status reset_hash_table();
 
+    std::unique_ptr<AggregateDataContainer> create_aggregate_data_container(
+            size_t size_of_key) const;
+    // Allocates the aggregate states of the null key of the hash table.
+    vectorized::AggregateDataPtr alloc_null_key_data();
+
     bool do_limit_filter(vectorized::Block* block, size_t num_rows,
                          const std::vector<int>* key_locs = nullptr);
     void build_limit_heap(size_t hash_table_size);
@@ -320,6 +325,9 @@ public:
     size_t align_aggregate_states = 1;
     /// The offset to the n-th aggregate function in a row of aggregate functions.
     vectorized::Sizes offsets_of_aggregate_states;
+    /// Non-zero if the states of each aggregate function are stored in their own column, this
+    /// far apart between groups. See AggregateDataContainer.
+    size_t columnar_state_stride = 0;
     std::vector<size_t> make_nullable_keys;
 
     bool agg_data_created_without_key = false;
@@ -580,6 +588,17 @@ public:
     std::vector<int64_t> origin_cols;
     std::vector<int64_t> input_block_first_row_positions;
     std::vector<std::vector<vectorized::MutableColumnPtr>> agg_input_columns;
+    // Row position of the first row of agg_input_columns, the rows before it are no longer
+    // needed by any window frame and have been released.
+    int64_t agg_input_first_row_position = 0;
+
+    // The frame of the window is bounded (ROWS ... AND N PRECEDING/CURRENT ROW/N FOLLOWING),
+    // so a row can be evaluated as soon as its frame end is received, without waiting for
+    // the end of its partition.
+    bool streaming_evaluation = false;
+    // Only in streaming evaluation: the end of the current partition has not been received
+    // yet, partition_by_end is the end of the rows received so far.
+    bool partition_end_provisional = false;
 
     // TODO: maybe global?
     std::vector<int64_t> partition_by_column_idxs;
@@ -653,6 +672,10 @@ public:
     vectorized::Block build_block; // build to source
     //record element size in hashtable
     int64_t valid_element_in_hash_tbl = 0;
+    // build rows matched by the probe child being processed, for except by any probe child
+    SetRowBitmap visited_rows;
+    // intersect only: build rows matched by every probe child processed so far
+    SetRowBitmap alive_rows;
     //first: idx mapped to column types
     //second: column_id, could point to origin column or cast column
     std::unordered_map<int, int> build_col_idx;
@@ -21,6 +21,7 @@
 #include <string>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/primitive_type.h"
@@ -71,6 +72,8 @@ Status AggSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
     _hash_table_limit_compute_timer = ADD_TIMER(Base::profile(), "DoLimitComputeTime");
     _hash_table_emplace_timer = ADD_TIMER(Base::profile(), "HashTableEmplaceTime");
     _hash_table_input_counter = ADD_COUNTER(Base::profile(), "HashTableInputCount", TUnit::UNIT);
+    _sorted_key_run_rows_counter =
+            ADD_COUNTER(Base::profile(), "SortedKeyRunRowsCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -83,6 +86,7 @@ Status AggSinkLocalState::open(RuntimeState* state) {
     Base::_shared_state->align_aggregate_states = p._align_aggregate_states;
     Base::_shared_state->total_size_of_aggregate_states = p._total_size_of_aggregate_states;
     Base::_shared_state->offsets_of_aggregate_states = p._offsets_of_aggregate_states;
+    Base::_shared_state->columnar_state_stride = p._columnar_state_stride;
     Base::_shared_state->make_nullable_keys = p._make_nullable_keys;
     Base::_shared_state->probe_expr_ctxs.resize(p._probe_expr_ctxs.size());
 
@@ -116,14 +120,10 @@ Status AggSinkLocalState::open(RuntimeState* state) {
                                                      std::decay_t<decltype(agg_method)>;
                                              using KeyType = typename HashTableType::Key;
 
-                                             /// some aggregate functions (like AVG for decimal) have align issues.
                                              Base::_shared_state->aggregate_data_container =
-                                                     std::make_unique<AggregateDataContainer>(
-                                                             sizeof(KeyType),
-                                                             ((p._total_size_of_aggregate_states +
-                                                               p._align_aggregate_states - 1) /
-                                                              p._align_aggregate_states) *
-                                                                     p._align_aggregate_states);
+                                                     Base::_shared_state
+                                                             ->create_aggregate_data_container(
+                                                                     sizeof(KeyType));
                                          }},
                    _agg_data->method_variant);
         if (p._is_merge) {
@@ -508,6 +508,38 @@ size_t AggSinkLocalState::_get_hash_table_size() const {
             _agg_data->method_variant);
 }
 
+bool AggSinkLocalState::_find_sorted_key_runs(const vectorized::ColumnRawPtrs& key_columns,
+                                              size_t num_rows) {
+    // a block is handled as ordered if at least half of the sampled rows continue a run.
+    static constexpr size_t SAMPLE_ROWS = 256;
+    if (!config::enable_agg_sorted_key_runs || num_rows < 2) {
+        return false;
+    }
+    _same_key_as_prev.resize(num_rows);
+    _same_key_as_prev[0] = 0;
+    auto same_key_as_prev = [&](size_t row) -> uint8_t {
+        for (const auto* column : key_columns) {
+            if (column->compare_at(row, row - 1, *column, 1) != 0) {
+                return 0;
+            }
+        }
+        return 1;
+    };
+    const size_t sample_rows = std::min(num_rows, SAMPLE_ROWS);
+    size_t run_rows = 0;
+    for (size_t i = 1; i < sample_rows; ++i) {
+        _same_key_as_prev[i] = same_key_as_prev(i);
+        run_rows += _same_key_as_prev[i];
+    }
+    if (run_rows * 2 < sample_rows) {
+        return false;
+    }
+    for (size_t i = sample_rows; i < num_rows; ++i) {
+        _same_key_as_prev[i] = same_key_as_prev(i);
+    }
+    return true;
+}
+
 void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* places,
                                                  vectorized::ColumnRawPtrs& key_columns,
                                                  size_t num_rows) {
@@ -536,21 +568,34 @@ void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* p
                            };
 
                            auto creator_for_null_key = [&](auto& mapped) {
-                               mapped = _agg_arena_pool->aligned_alloc(
-                                       Base::_parent->template cast<AggSinkOperatorX>()
-                                               ._total_size_of_aggregate_states,
-                                       Base::_parent->template cast<AggSinkOperatorX>()
-                                               ._align_aggregate_states);
+                               mapped = Base::_shared_state->alloc_null_key_data();
                                auto st = _create_agg_status(mapped);
                                if (!st) {
                                    throw Exception(st.code(), st.to_string());
                                }
                            };
 
+                           const bool sorted_key_runs =
+                                   _find_sorted_key_runs(key_columns, num_rows);
+
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
+                           if (sorted_key_runs) {
+                               size_t run_rows = 0;
+                               for (size_t i = 0; i < num_rows; ++i) {
+                                   if (_same_key_as_prev[i]) {
+                                       places[i] = places[i - 1];
+                                       ++run_rows;
+                                   } else {
+                                       places[i] = *agg_method.lazy_emplace(state, i, creator,
+                                                                            creator_for_null_key);
+                                   }
+                               }
+                               COUNTER_UPDATE(_sorted_key_run_rows_counter, run_rows);
+                           } else {
+                               for (size_t i = 0; i < num_rows; ++i) {
+                                   places[i] = *agg_method.lazy_emplace(state, i, creator,
+                                                                        creator_for_null_key);
+                               }
                            }
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
@@ -636,11 +681,7 @@ bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateData
                             };
 
                             auto creator_for_null_key = [this, refresh_top_limit](auto& mapped) {
-                                mapped = _agg_arena_pool->aligned_alloc(
-                                        Base::_parent->template cast<AggSinkOperatorX>()
-                                                ._total_size_of_aggregate_states,
-                                        Base::_parent->template cast<AggSinkOperatorX>()
-                                                ._align_aggregate_states);
+                                mapped = Base::_shared_state->alloc_null_key_data();
                                 auto st = _create_agg_status(mapped);
                                 if (!st) {
                                     throw Exception(st.code(), st.to_string());
@@ -811,6 +852,9 @@ Status AggSinkOperatorX::open(RuntimeState* state) {
                     alignment_of_next_state * alignment_of_next_state;
         }
     }
+    if (config::enable_agg_columnar_state && !_probe_expr_ctxs.empty()) {
+        _init_columnar_state_layout();
+    }
     // check output type
     if (_needs_finalize) {
         RETURN_IF_ERROR(vectorized::AggFnEvaluator::check_agg_fn_output(
@@ -826,14 +870,44 @@ Status AggSinkOperatorX::open(RuntimeState* state) {
     return Status::OK();
 }
 
+void AggSinkOperatorX::_init_columnar_state_layout() {
+    // Only fixed width states like the ones of sum/count/min/max of numbers are laid out by
+    // column, padding them to the widest one would waste too much memory otherwise.
+    static constexpr size_t MAX_COLUMNAR_STATE_SIZE = 16;
+    size_t stride = _align_aggregate_states;
+    for (auto* evaluator : _aggregate_evaluators) {
+        stride = std::max(stride, evaluator->function()->size_of_data());
+    }
+    if (stride > MAX_COLUMNAR_STATE_SIZE) {
+        return;
+    }
+    stride = (stride + _align_aggregate_states - 1) / _align_aggregate_states *
+             _align_aggregate_states;
+    for (size_t i = 0; i < _aggregate_evaluators.size(); ++i) {
+        _offsets_of_aggregate_states[i] = i * AggregateDataContainer::columnar_state_offset(stride);
+    }
+    _columnar_state_stride = stride;
+}
+
 Status AggSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_block, bool eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
-    COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
-    local_state._shared_state->input_num_rows += in_block->rows();
+    if (!local_state.resuming_block()) {
+        COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
+        local_state._shared_state->input_num_rows += in_block->rows();
+    }
     if (in_block->rows() > 0) {
-        RETURN_IF_ERROR(local_state._executor->execute(&local_state, in_block));
+        bool finished = false;
+        RETURN_IF_ERROR(local_state.process_block_yieldable(
+                state, in_block,
+                [&](vectorized::Block* block) {
+                    return local_state._executor->execute(&local_state, block);
+                },
+                &finished));
         local_state._executor->update_memusage(&local_state);
+        if (!finished) {
+            return Status::OK();
+        }
         COUNTER_SET(local_state._hash_table_size_counter,
                     (int64_t)local_state._get_hash_table_size());
     }
@@ -87,6 +87,10 @@ protected:
     bool _emplace_into_hash_table_limit(vectorized::AggregateDataPtr* places,
                                         vectorized::Block* block, const std::vector<int>& key_locs,
                                         vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
+    // Marks the rows whose keys equal the keys of the previous row in `_same_key_as_prev`.
+    // Returns false without marking if a sample of the block shows that it is not ordered by
+    // the keys, then every row probes the hash table.
+    bool _find_sorted_key_runs(const vectorized::ColumnRawPtrs& key_columns, size_t num_rows);
     size_t _get_hash_table_size() const;
 
     template <bool limit, bool for_spill = false>
@@ -100,6 +104,7 @@ protected:
     RuntimeProfile::Counter* _hash_table_emplace_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_limit_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_input_counter = nullptr;
+    RuntimeProfile::Counter* _sorted_key_run_rows_counter = nullptr;
     RuntimeProfile::Counter* _build_timer = nullptr;
     RuntimeProfile::Counter* _expr_timer = nullptr;
     RuntimeProfile::Counter* _merge_timer = nullptr;
@@ -111,6 +116,7 @@ protected:
     bool _should_limit_output = false;
 
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
+    std::vector<uint8_t> _same_key_as_prev;
     std::vector<char> _deserialize_buffer;
 
     vectorized::Block _preagg_block = vectorized::Block();
@@ -149,6 +155,11 @@ public:
                        : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
     }
     bool require_data_distribution() const override { return _is_colocate; }
+    // Only the update phase (whose serialized states are merged by a later phase) tolerates
+    // it, a merge phase must see all states of a key to deduplicate multi-distinct inputs.
+    bool tolerate_non_hash_distribution() const override {
+        return !_needs_finalize && !_is_merge && !_is_colocate && !_followed_by_shuffled_operator;
+    }
     size_t get_revocable_mem_size(RuntimeState* state) const;
 
     AggregatedDataVariants* get_agg_data(RuntimeState* state) {
@@ -165,6 +176,8 @@ public:
 protected:
     using LocalState = AggSinkLocalState;
     friend class AggSinkLocalState;
+    void _init_columnar_state_layout();
+
     std::vector<vectorized::AggFnEvaluator*> _aggregate_evaluators;
     bool _can_short_circuit = false;
 
@@ -184,6 +197,9 @@ protected:
     vectorized::Sizes _offsets_of_aggregate_states;
     /// The total size of the row from the aggregate functions.
     size_t _total_size_of_aggregate_states = 0;
+    /// Non-zero if the states of each aggregate function are stored in their own column, this
+    /// far apart between groups. See AggregateDataContainer.
+    size_t _columnar_state_stride = 0;
 
     // group by k1,k2
     vectorized::VExprContextSPtrs _probe_expr_ctxs;
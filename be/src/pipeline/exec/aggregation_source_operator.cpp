@@ -589,9 +589,7 @@ void AggLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* place
                            };
 
                            auto creator_for_null_key = [&](auto& mapped) {
-                               mapped = _shared_state->agg_arena_pool->aligned_alloc(
-                                       _shared_state->total_size_of_aggregate_states,
-                                       _shared_state->align_aggregate_states);
+                               mapped = _shared_state->alloc_null_key_data();
                                auto st = _create_agg_status(mapped);
                                if (!st) {
                                    throw Exception(st.code(), st.to_string());
@@ -18,8 +18,10 @@
 
 #include "analytic_sink_operator.h"
 
+#include <set>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 
@@ -42,6 +44,7 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
     auto& p = _parent->cast<AnalyticSinkOperatorX>();
+    _shared_state->streaming_evaluation = p._streaming_evaluation;
     _shared_state->partition_by_column_idxs.resize(p._partition_by_eq_expr_ctxs.size());
     _shared_state->ordey_by_column_idxs.resize(p._order_by_eq_expr_ctxs.size());
 
@@ -74,6 +77,10 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
 
 bool AnalyticSinkLocalState::_whether_need_next_partition(BlockRowPos& found_partition_end) {
     auto& shared_state = *_shared_state;
+    if (shared_state.streaming_evaluation) {
+        // the source decides whether the rows received so far can be evaluated.
+        return false;
+    }
     if (shared_state.input_eos ||
         (shared_state.current_row_position <
          shared_state.partition_by_end.pos)) { //now still have partition data
@@ -231,9 +238,27 @@ Status AnalyticSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state)
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(analytic_node.order_by_exprs,
                                                          _order_by_eq_expr_ctxs));
     _agg_functions_size = agg_size;
+    _streaming_evaluation = _can_evaluate_streaming(analytic_node);
     return Status::OK();
 }
 
+bool AnalyticSinkOperatorX::_can_evaluate_streaming(const TAnalyticNode& analytic_node) {
+    if (!config::enable_analytic_streaming_evaluation || !analytic_node.__isset.window ||
+        analytic_node.window.type != TAnalyticWindowType::ROWS ||
+        !analytic_node.window.__isset.window_end) {
+        return false;
+    }
+    // these functions need the size of the whole partition.
+    static const std::set<std::string> partition_size_functions {"ntile", "percent_rank",
+                                                                 "cume_dist"};
+    for (const auto& fn : analytic_node.analytic_functions) {
+        if (partition_size_functions.contains(fn.nodes[0].fn.name.function_name)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status AnalyticSinkOperatorX::open(RuntimeState* state) {
     RETURN_IF_ERROR(DataSinkOperatorX<AnalyticSinkLocalState>::open(state));
     for (const auto& ctx : _agg_expr_ctxs) {
@@ -96,6 +96,7 @@ public:
 private:
     Status _insert_range_column(vectorized::Block* block, const vectorized::VExprContextSPtr& expr,
                                 vectorized::IColumn* dst_column, size_t length);
+    static bool _can_evaluate_streaming(const TAnalyticNode& analytic_node);
 
     friend class AnalyticSinkLocalState;
 
@@ -104,6 +105,7 @@ private:
     vectorized::VExprContextSPtrs _order_by_eq_expr_ctxs;
 
     size_t _agg_functions_size = 0;
+    bool _streaming_evaluation = false;
 
     const TTupleId _buffered_tuple_id;
 
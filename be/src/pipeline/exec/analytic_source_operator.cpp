@@ -17,6 +17,7 @@
 
 #include "analytic_source_operator.h"
 
+#include <set>
 #include <string>
 
 #include "pipeline/exec/operator.h"
@@ -117,6 +118,9 @@ BlockRowPos AnalyticLocalState::_compare_row_to_find_end(int64_t idx, BlockRowPo
 
 BlockRowPos AnalyticLocalState::_get_partition_by_end() {
     auto& shared_state = *_shared_state;
+    if (shared_state.partition_end_provisional) {
+        _update_provisional_partition_end();
+    }
     if (shared_state.current_row_position <
         shared_state.partition_by_end.pos) { //still have data, return partition_by_end directly
         return shared_state.partition_by_end;
@@ -139,8 +143,42 @@ BlockRowPos AnalyticLocalState::_get_partition_by_end() {
     return cal_end;
 }
 
+// The current partition was started before its end was received, more rows of it may have
+// arrived since, so find its end again from its start.
+void AnalyticLocalState::_update_provisional_partition_end() {
+    auto& shared_state = *_shared_state;
+    BlockRowPos cal_end = shared_state.all_block_end;
+    const auto partition_exprs_size =
+            _parent->cast<AnalyticSourceOperatorX>()._partition_exprs_size;
+    for (size_t i = 0; i < partition_exprs_size; ++i) {
+        cal_end = _compare_row_to_find_end(shared_state.partition_by_column_idxs[i],
+                                           _partition_by_start, cal_end);
+    }
+    cal_end.pos = shared_state.input_block_first_row_positions[cal_end.block_num] + cal_end.row_num;
+    shared_state.partition_by_end = cal_end;
+    shared_state.partition_end_provisional =
+            !shared_state.input_eos && cal_end.pos == shared_state.all_block_end.pos;
+}
+
+int64_t AnalyticLocalState::_evaluable_rows_end() const {
+    if (!_shared_state->partition_end_provisional) {
+        return _shared_state->partition_by_end.pos;
+    }
+    return _shared_state->partition_by_end.pos - std::max<int64_t>(_rows_end_offset, 0);
+}
+
 bool AnalyticLocalState::_whether_need_next_partition(BlockRowPos& found_partition_end) {
     auto& shared_state = *_shared_state;
+    if (shared_state.streaming_evaluation && !shared_state.input_eos) {
+        if (shared_state.partition_end_provisional) {
+            return shared_state.current_row_position >= _evaluable_rows_end();
+        }
+        if (shared_state.current_row_position < shared_state.partition_by_end.pos) {
+            return false;
+        }
+        // the next partition is started once it has a row, even if its end is not received.
+        return found_partition_end.pos <= shared_state.current_row_position;
+    }
     if (shared_state.input_eos ||
         (shared_state.current_row_position <
          shared_state.partition_by_end.pos)) { //now still have partition data
@@ -165,6 +203,7 @@ Status AnalyticLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     SCOPED_TIMER(_init_timer);
     _blocks_memory_usage =
             profile()->AddHighWaterMarkCounter("MemoryUsageBlocks", TUnit::BYTES, "", 1);
+    _released_rows_counter = ADD_COUNTER(profile(), "ReleasedAggInputRows", TUnit::UNIT);
     _evaluation_timer = ADD_TIMER(profile(), "GetPartitionBoundTime");
     _execute_timer = ADD_TIMER(profile(), "ExecuteTime");
     _get_next_timer = ADD_TIMER(profile(), "GetNextTime");
@@ -181,8 +220,12 @@ Status AnalyticLocalState::open(RuntimeState* state) {
     _agg_functions_size = p._agg_functions.size();
 
     _agg_functions.resize(p._agg_functions.size());
+    static const std::set<std::string> row_reference_functions {"first_value", "last_value",
+                                                                "lead", "lag"};
     for (size_t i = 0; i < _agg_functions.size(); i++) {
         _agg_functions[i] = p._agg_functions[i]->clone(state, state->obj_pool());
+        _agg_states_reference_rows |=
+                row_reference_functions.contains(_agg_functions[i]->function()->get_name());
     }
 
     _fn_place_ptr = _agg_arena_pool->aligned_alloc(p._total_size_of_aggregate_states,
@@ -237,12 +280,60 @@ Status AnalyticLocalState::open(RuntimeState* state) {
 
             _executor.get_next = std::bind<Status>(&AnalyticLocalState::_get_next_for_rows, this,
                                                    std::placeholders::_1);
+            if (p._window.__isset.window_start ||
+                p._window.window_end.type != TAnalyticWindowBoundaryType::CURRENT_ROW) {
+                _init_sliding_extremes();
+            }
         }
     }
     _create_agg_status();
     return Status::OK();
 }
 
+void AnalyticLocalState::_init_sliding_extremes() {
+    _sliding_extremes.resize(_agg_functions_size);
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        const auto& function = _agg_functions[i]->function();
+        const auto name = function->get_name();
+        if ((name == "min" || name == "max") && function->get_argument_types().size() == 1) {
+            _sliding_extremes[i] = std::make_unique<SlidingExtreme>();
+            _sliding_extremes[i]->is_min = name == "min";
+        }
+    }
+}
+
+int64_t AnalyticLocalState::_sliding_extreme_row(SlidingExtreme& extreme,
+                                                 const vectorized::IColumn& column,
+                                                 int64_t frame_start, int64_t frame_end) {
+    const int64_t first_row = _shared_state->agg_input_first_row_position;
+    if (extreme.partition_start != _partition_by_start.pos) {
+        extreme.partition_start = _partition_by_start.pos;
+        extreme.next_position = _partition_by_start.pos;
+        extreme.positions.clear();
+    }
+    auto& positions = extreme.positions;
+    while (!positions.empty() && positions.front() < frame_start) {
+        positions.pop_front();
+    }
+    for (int64_t pos = std::max(extreme.next_position, frame_start); pos < frame_end; ++pos) {
+        const auto row = static_cast<size_t>(pos - first_row);
+        if (column.is_null_at(row)) {
+            continue;
+        }
+        while (!positions.empty()) {
+            const int res = column.compare_at(static_cast<size_t>(positions.back() - first_row),
+                                              row, column, 1);
+            if (extreme.is_min ? res < 0 : res > 0) {
+                break;
+            }
+            positions.pop_back();
+        }
+        positions.push_back(pos);
+    }
+    extreme.next_position = std::max(extreme.next_position, frame_end);
+    return positions.empty() ? -1 : positions.front();
+}
+
 void AnalyticLocalState::_reset_agg_status() {
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i]->reset(
@@ -283,16 +374,36 @@ void AnalyticLocalState::_destroy_agg_status() {
 void AnalyticLocalState::_execute_for_win_func(int64_t partition_start, int64_t partition_end,
                                                int64_t frame_start, int64_t frame_end) {
     SCOPED_TIMER(_execute_timer);
+    // positions in agg input columns, the rows before the first one have been released.
+    const int64_t first_row = _shared_state->agg_input_first_row_position;
+    const int64_t sliding_frame_start = std::max(frame_start, partition_start);
+    const int64_t sliding_frame_end = std::min(frame_end, partition_end);
+    partition_start = std::max<int64_t>(partition_start - first_row, 0);
+    partition_end -= first_row;
+    frame_start -= first_row;
+    frame_end -= first_row;
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         std::vector<const vectorized::IColumn*> agg_columns;
         for (int j = 0; j < _shared_state->agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_shared_state->agg_input_columns[i][j].get());
         }
-        _agg_functions[i]->function()->add_range_single_place(
-                partition_start, partition_end, frame_start, frame_end,
-                _fn_place_ptr +
-                        _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i],
-                agg_columns.data(), _agg_arena_pool.get());
+        auto* place = _fn_place_ptr +
+                      _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i];
+        if (!_sliding_extremes.empty() && _sliding_extremes[i]) {
+            // the states are reset for every row, only the extreme row of the frame is added.
+            const int64_t extreme_pos = _sliding_extreme_row(
+                    *_sliding_extremes[i], *agg_columns[0], sliding_frame_start, sliding_frame_end);
+            if (extreme_pos >= 0) {
+                _agg_functions[i]->function()->add_range_single_place(
+                        partition_start, partition_end, extreme_pos - first_row,
+                        extreme_pos - first_row + 1, place, agg_columns.data(),
+                        _agg_arena_pool.get());
+            }
+        } else {
+            _agg_functions[i]->function()->add_range_single_place(
+                    partition_start, partition_end, frame_start, frame_end, place,
+                    agg_columns.data(), _agg_arena_pool.get());
+        }
 
         // If the end is not greater than the start, the current window should be empty.
         _current_window_empty =
@@ -345,9 +456,45 @@ void AnalyticLocalState::_insert_result_info(int64_t current_block_rows) {
     }
 }
 
+bool AnalyticLocalState::_can_release_rows_in_partition() const {
+    const auto& window = _parent->cast<AnalyticSourceOperatorX>()._window;
+    if (window.__isset.window_start) {
+        // the states are reset for every row, frames start at current row + start offset.
+        return true;
+    }
+    // [unbounded preceding, current row] adds the current row to the states incrementally.
+    return window.window_end.type == TAnalyticWindowBoundaryType::CURRENT_ROW &&
+           !_agg_states_reference_rows;
+}
+
+void AnalyticLocalState::_release_agg_input_rows(int64_t needed_start) {
+    auto& shared_state = *_shared_state;
+    const int64_t released_rows = needed_start - shared_state.agg_input_first_row_position;
+    const int64_t kept_rows = shared_state.input_total_rows - needed_start;
+    // copying the kept rows is amortized by releasing at least as many rows.
+    if (released_rows < std::max<int64_t>(_state->batch_size(), kept_rows)) {
+        return;
+    }
+    for (auto& columns : shared_state.agg_input_columns) {
+        for (auto& column : columns) {
+            auto kept_column = column->clone_empty();
+            kept_column->insert_range_from(*column, released_rows, kept_rows);
+            column = std::move(kept_column);
+        }
+    }
+    shared_state.agg_input_first_row_position = needed_start;
+    COUNTER_UPDATE(_released_rows_counter, released_rows);
+}
+
 Status AnalyticLocalState::_get_next_for_rows(size_t current_block_rows) {
     SCOPED_TIMER(_get_next_timer);
-    while (_shared_state->current_row_position < _shared_state->partition_by_end.pos &&
+    if (_can_release_rows_in_partition()) {
+        _release_agg_input_rows(std::max(_partition_by_start.pos,
+                                         _shared_state->current_row_position +
+                                                 std::min<int64_t>(_rows_start_offset, 0)));
+    }
+    const int64_t rows_end = _evaluable_rows_end();
+    while (_shared_state->current_row_position < rows_end &&
            _window_end_position < current_block_rows) {
         int64_t range_start, range_end;
         if (!_parent->cast<AnalyticSourceOperatorX>()._window.__isset.window_start &&
@@ -438,8 +585,13 @@ bool AnalyticLocalState::init_next_partition(BlockRowPos found_partition_end) {
          (_shared_state->partition_by_end.pos != found_partition_end.pos))) {
         _partition_by_start = _shared_state->partition_by_end;
         _shared_state->partition_by_end = found_partition_end;
+        _shared_state->partition_end_provisional =
+                _shared_state->streaming_evaluation && !_shared_state->input_eos &&
+                found_partition_end.pos == _shared_state->all_block_end.pos;
         _shared_state->current_row_position = _partition_by_start.pos;
         _reset_agg_status();
+        // no frame of the new partition reaches the rows before it.
+        _release_agg_input_rows(_partition_by_start.pos);
         return true;
     }
     return false;
@@ -19,6 +19,8 @@
 
 #include <stdint.h>
 
+#include <deque>
+
 #include "common/status.h"
 #include "operator.h"
 
@@ -55,6 +57,14 @@ private:
     void _insert_result_info(int64_t current_block_rows);
 
     void _update_order_by_range();
+    // Streaming evaluation: rows of the current partition before this position can be
+    // evaluated, their frames have been received completely.
+    int64_t _evaluable_rows_end() const;
+    void _update_provisional_partition_end();
+    // Release the rows of agg input columns before `needed_start`.
+    void _release_agg_input_rows(int64_t needed_start);
+    // The rows before the frame of the current row can be released within a partition.
+    bool _can_release_rows_in_partition() const;
     bool _refresh_need_more_input() {
         auto need_more_input = _whether_need_next_partition(_shared_state->found_partition_end);
         if (need_more_input) {
@@ -71,6 +81,21 @@ private:
                                          bool need_check_first = false);
     bool _whether_need_next_partition(BlockRowPos& found_partition_end);
 
+    // MIN/MAX over sliding ROWS frames keep the positions of the rows which could still be the
+    // extreme of a later frame in a monotonic deque, only the extreme row of a frame is added.
+    struct SlidingExtreme {
+        bool is_min = false;
+        int64_t partition_start = -1;
+        // rows before this position of the partition have been pushed.
+        int64_t next_position = 0;
+        std::deque<int64_t> positions;
+    };
+    void _init_sliding_extremes();
+    // Returns the position of the extreme row in [frame_start, frame_end), or -1 if all rows
+    // in the frame are null. The frames of a partition must be evaluated in order.
+    int64_t _sliding_extreme_row(SlidingExtreme& extreme, const vectorized::IColumn& column,
+                                 int64_t frame_start, int64_t frame_end);
+
     void _reset_agg_status();
     void _create_agg_status();
     void _destroy_agg_status();
@@ -88,6 +113,11 @@ private:
     size_t _agg_functions_size;
     bool _agg_functions_created;
     bool _current_window_empty = false;
+    // Some window functions (first_value, last_value, lead, lag) keep a reference to an input
+    // row in their states.
+    bool _agg_states_reference_rows = false;
+    // Only set when the states are reset for every row, nullptr for the other functions.
+    std::vector<std::unique_ptr<SlidingExtreme>> _sliding_extremes;
 
     BlockRowPos _order_by_start;
     BlockRowPos _order_by_end;
@@ -100,6 +130,7 @@ private:
     RuntimeProfile::Counter* _get_next_timer = nullptr;
     RuntimeProfile::Counter* _get_result_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _blocks_memory_usage = nullptr;
+    RuntimeProfile::Counter* _released_rows_counter = nullptr;
 
     using vectorized_get_next = std::function<Status(size_t rows)>;
 
@@ -20,6 +20,7 @@
 #include <brpc/controller.h>
 #include <butil/errno.h>
 #include <butil/iobuf_inl.h>
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
@@ -42,6 +43,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "service/backend_options.h"
+#include "util/brpc_client_cache.h"
 #include "util/proto_util.h"
 #include "util/time.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -49,6 +51,34 @@
 namespace doris {
 #include "common/compile_check_begin.h"
 
+namespace {
+// bytes sent by exchange sinks per transport, the brpc stubs use RDMA if enable_brpc_rdma is
+// set and be is built with BUILD_BRPC_RDMA, large blocks go through http attachments over TCP
+bvar::Adder<int64_t> g_exchange_send_tcp_bytes("exchange_sink", "send_tcp_bytes");
+bvar::PerSecond<bvar::Adder<int64_t>> g_exchange_send_tcp_bytes_per_second(
+        "exchange_sink", "send_tcp_bytes_per_second", &g_exchange_send_tcp_bytes, 60);
+bvar::Adder<int64_t> g_exchange_send_rdma_bytes("exchange_sink", "send_rdma_bytes");
+bvar::PerSecond<bvar::Adder<int64_t>> g_exchange_send_rdma_bytes_per_second(
+        "exchange_sink", "send_rdma_bytes_per_second", &g_exchange_send_rdma_bytes, 60);
+bvar::Adder<int64_t> g_exchange_send_http_bytes("exchange_sink", "send_http_bytes");
+bvar::PerSecond<bvar::Adder<int64_t>> g_exchange_send_http_bytes_per_second(
+        "exchange_sink", "send_http_bytes_per_second", &g_exchange_send_http_bytes, 60);
+
+void update_exchange_send_bytes(const PTransmitDataParams& request, bool by_http) {
+    if (!request.has_block()) {
+        return;
+    }
+    auto bytes = static_cast<int64_t>(request.block().ByteSizeLong());
+    if (by_http) {
+        g_exchange_send_http_bytes << bytes;
+    } else if (brpc_use_rdma()) {
+        g_exchange_send_rdma_bytes << bytes;
+    } else {
+        g_exchange_send_tcp_bytes << bytes;
+    }
+}
+} // namespace
+
 namespace vectorized {
 BroadcastPBlockHolder::~BroadcastPBlockHolder() {
     // lock the parent queue, if the queue could lock success, then return the block
@@ -303,7 +333,9 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
                             create_unique(brpc_request, send_callback);
-            if (enable_http_send_block(*brpc_request)) {
+            bool by_http = enable_http_send_block(*brpc_request);
+            update_exchange_send_bytes(*brpc_request, by_http);
+            if (by_http) {
                 RETURN_IF_ERROR(transmit_block_httpv2(_context->exec_env(),
                                                       std::move(send_remote_block_closure),
                                                       request.channel->_brpc_dest_addr));
@@ -392,7 +424,9 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
                             create_unique(brpc_request, send_callback);
-            if (enable_http_send_block(*brpc_request)) {
+            bool by_http = enable_http_send_block(*brpc_request);
+            update_exchange_send_bytes(*brpc_request, by_http);
+            if (by_http) {
                 RETURN_IF_ERROR(transmit_block_httpv2(_context->exec_env(),
                                                       std::move(send_remote_block_closure),
                                                       request.channel->_brpc_dest_addr));
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "exprs/runtime_filter_slots.h"
 #include "join_build_sink_operator.h"
 #include "operator.h"
@@ -199,8 +200,10 @@ struct ProcessHashTableBuild {
         }
 
         SCOPED_TIMER(_parent->_build_table_insert_timer);
-        hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
-                                                                      *has_null_key);
+        hash_table_ctx.hash_table->template prepare_build<JoinOpType>(
+                _rows, _batch_size, *has_null_key,
+                config::enable_hash_join_radix_build &&
+                        static_cast<int64_t>(_rows) >= config::hash_join_radix_build_min_rows);
 
         // In order to make the null keys equal when using single null eq, all null keys need to be set to default value.
         if (_build_raw_ptrs.size() == 1 && null_map) {
@@ -52,6 +52,14 @@ public:
                            const DescriptorTbl& descs);
     ~JoinBuildSinkOperatorX() override = default;
 
+    // Each build row is kept by exactly one instance, so the result is the same as long as
+    // unmatched probe rows are not output.
+    [[nodiscard]] bool can_split_hot_keys() const override {
+        return this->is_shuffled_operator() && !_is_mark_join &&
+               (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::RIGHT_OUTER_JOIN ||
+                _join_op == TJoinOp::RIGHT_SEMI_JOIN || _join_op == TJoinOp::RIGHT_ANTI_JOIN);
+    }
+
 protected:
     void _init_join_op();
     template <typename DependencyType, typename Derived>
@@ -71,6 +71,15 @@ public:
 
     [[nodiscard]] bool is_source() const override { return false; }
 
+    // Probe rows of hot keys are sent to all instances, so unmatched probe rows must not be
+    // output, and the output is not hash distributed by join keys any more.
+    [[nodiscard]] bool can_split_hot_keys() const override {
+        return this->is_shuffled_operator() && !this->followed_by_shuffled_operator() &&
+               !_is_mark_join &&
+               (_join_op == TJoinOp::INNER_JOIN || _join_op == TJoinOp::RIGHT_OUTER_JOIN ||
+                _join_op == TJoinOp::RIGHT_SEMI_JOIN || _join_op == TJoinOp::RIGHT_ANTI_JOIN);
+    }
+
     void set_build_side_child(OperatorPtr& build_side_child) {
         _build_side_child = build_side_child;
     }
@@ -18,12 +18,15 @@
 #include "nested_loop_join_probe_operator.h"
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include "common/cast_set.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/core/block.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -47,6 +50,8 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     _update_visited_flags_timer = ADD_TIMER(profile(), "UpdateVisitedFlagsTime");
     _join_conjuncts_evaluation_timer = ADD_TIMER(profile(), "JoinConjunctsEvaluationTime");
     _filtered_by_join_conjuncts_timer = ADD_TIMER(profile(), "FilteredByJoinConjunctsTime");
+    _build_rows_filtered_counter =
+            ADD_COUNTER(profile(), "BuildRowsFilteredBeforeJoin", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -333,12 +338,138 @@ void NestedLoopJoinProbeLocalState::_append_left_data_with_null(vectorized::Bloc
     block.set_columns(std::move(dst_columns));
 }
 
+namespace {
+
+using BuildFilterOp = NestedLoopJoinProbeOperatorX::BuildFilterCondition::Op;
+
+template <BuildFilterOp op, typename T>
+void filter_by_probe_value(T probe_value, const T* __restrict build_data, size_t rows,
+                           uint8_t* __restrict filter) {
+    for (size_t i = 0; i < rows; ++i) {
+        if constexpr (op == BuildFilterOp::EQ) {
+            filter[i] &= probe_value == build_data[i];
+        } else if constexpr (op == BuildFilterOp::LT) {
+            filter[i] &= probe_value < build_data[i];
+        } else if constexpr (op == BuildFilterOp::LE) {
+            filter[i] &= probe_value <= build_data[i];
+        } else if constexpr (op == BuildFilterOp::GT) {
+            filter[i] &= probe_value > build_data[i];
+        } else {
+            filter[i] &= probe_value >= build_data[i];
+        }
+    }
+}
+
+// Returns false if the columns are not integer columns of the same type.
+template <typename T>
+bool filter_build_column(const vectorized::IColumn& probe_column, size_t probe_row,
+                         const vectorized::IColumn& build_column, BuildFilterOp op,
+                         uint8_t* __restrict filter) {
+    const auto* probe_data = vectorized::check_and_get_column<vectorized::ColumnVector<T>>(
+            vectorized::remove_nullable(probe_column.get_ptr()).get());
+    const vectorized::IColumn* build_nested = &build_column;
+    const uint8_t* build_null_map = nullptr;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                build_column)) {
+        build_nested = &nullable->get_nested_column();
+        build_null_map = nullable->get_null_map_data().data();
+    }
+    const auto* build_data =
+            vectorized::check_and_get_column<vectorized::ColumnVector<T>>(build_nested);
+    if (probe_data == nullptr || build_data == nullptr) {
+        return false;
+    }
+    size_t rows = build_column.size();
+    if (probe_column.is_null_at(probe_row)) {
+        // comparing with null is never true
+        memset(filter, 0, rows);
+        return true;
+    }
+    T value = probe_data->get_data()[probe_row];
+    const T* data = build_data->get_data().data();
+    switch (op) {
+    case BuildFilterOp::EQ:
+        filter_by_probe_value<BuildFilterOp::EQ>(value, data, rows, filter);
+        break;
+    case BuildFilterOp::LT:
+        filter_by_probe_value<BuildFilterOp::LT>(value, data, rows, filter);
+        break;
+    case BuildFilterOp::LE:
+        filter_by_probe_value<BuildFilterOp::LE>(value, data, rows, filter);
+        break;
+    case BuildFilterOp::GT:
+        filter_by_probe_value<BuildFilterOp::GT>(value, data, rows, filter);
+        break;
+    case BuildFilterOp::GE:
+        filter_by_probe_value<BuildFilterOp::GE>(value, data, rows, filter);
+        break;
+    }
+    if (build_null_map != nullptr) {
+        for (size_t i = 0; i < rows; ++i) {
+            filter[i] &= !build_null_map[i];
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool NestedLoopJoinProbeLocalState::_filter_build_rows(const vectorized::Block& build_block) {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const size_t rows = build_block.rows();
+    _build_rows_filter.assign(rows, 1);
+    bool filtered = false;
+    for (const auto& condition : p._build_filter_conditions) {
+        const auto& probe_column = *_child_block->get_by_position(condition.probe_column).column;
+        const auto& build_column = *build_block.get_by_position(condition.build_column).column;
+        uint8_t* filter = _build_rows_filter.data();
+        filtered |= filter_build_column<vectorized::Int8>(probe_column, _left_block_pos,
+                                                          build_column, condition.op, filter) ||
+                    filter_build_column<vectorized::Int16>(probe_column, _left_block_pos,
+                                                           build_column, condition.op, filter) ||
+                    filter_build_column<vectorized::Int32>(probe_column, _left_block_pos,
+                                                           build_column, condition.op, filter) ||
+                    filter_build_column<vectorized::Int64>(probe_column, _left_block_pos,
+                                                           build_column, condition.op, filter) ||
+                    filter_build_column<vectorized::UInt32>(probe_column, _left_block_pos,
+                                                            build_column, condition.op, filter) ||
+                    filter_build_column<vectorized::UInt64>(probe_column, _left_block_pos,
+                                                            build_column, condition.op, filter);
+    }
+    if (!filtered) {
+        return false;
+    }
+    _selected_build_rows.clear();
+    for (uint32_t i = 0; i < rows; ++i) {
+        if (_build_rows_filter[i]) {
+            _selected_build_rows.push_back(i);
+        }
+    }
+    COUNTER_UPDATE(_build_rows_filtered_counter, rows - _selected_build_rows.size());
+    return true;
+}
+
 void NestedLoopJoinProbeLocalState::_process_left_child_block(
-        vectorized::Block& block, const vectorized::Block& now_process_build_block) const {
+        vectorized::Block& block, const vectorized::Block& now_process_build_block) {
     SCOPED_TIMER(_output_temp_blocks_timer);
     auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const bool filtered =
+            !p._build_filter_conditions.empty() && _filter_build_rows(now_process_build_block);
+    if (filtered && _selected_build_rows.empty()) {
+        return;
+    }
     auto dst_columns = block.mutate_columns();
-    const size_t max_added_rows = now_process_build_block.rows();
+    const size_t max_added_rows =
+            filtered ? _selected_build_rows.size() : now_process_build_block.rows();
+    // copies the joined rows of a build column
+    auto insert_build_rows = [&](vectorized::IColumn& dst, const vectorized::IColumn& src) {
+        if (filtered) {
+            dst.insert_indices_from(src, _selected_build_rows.data(),
+                                    _selected_build_rows.data() + _selected_build_rows.size());
+        } else {
+            dst.insert_range_from(src, 0, max_added_rows);
+        }
+    };
     for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column = _child_block->get_by_position(i);
         if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
@@ -365,18 +496,17 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
             auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
             DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
                    p._join_op == TJoinOp::FULL_OUTER_JOIN);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_nested_column_ptr()
-                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
+            insert_build_rows(*assert_cast<vectorized::ColumnNullable*>(
+                                       dst_columns[p._num_probe_side_columns + i].get())
+                                       ->get_nested_column_ptr(),
+                              *src_column.column);
             assert_cast<vectorized::ColumnNullable*>(
                     dst_columns[p._num_probe_side_columns + i].get())
                     ->get_null_map_column()
                     .get_data()
                     .resize_fill(origin_sz + max_added_rows, 0);
         } else {
-            dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
-                                                                          0, max_added_rows);
+            insert_build_rows(*dst_columns[p._num_probe_side_columns + i], *src_column.column);
         }
     }
     block.set_columns(std::move(dst_columns));
@@ -416,9 +546,61 @@ Status NestedLoopJoinProbeOperatorX::open(RuntimeState* state) {
     }
     _num_probe_side_columns = _child->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    // Filtering build rows before materialization changes the layout of the join block that
+    // the build side visited flags and mark join rely on, null aware anti join needs the
+    // null results of the conjuncts.
+    if (!_is_mark_join && _join_op != TJoinOp::RIGHT_OUTER_JOIN &&
+        _join_op != TJoinOp::RIGHT_SEMI_JOIN && _join_op != TJoinOp::RIGHT_ANTI_JOIN &&
+        _join_op != TJoinOp::FULL_OUTER_JOIN && _join_op != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) {
+        for (const auto& conjunct : _join_conjuncts) {
+            _init_build_filter_conditions(conjunct->root());
+        }
+    }
     return vectorized::VExpr::open(_join_conjuncts, state);
 }
 
+void NestedLoopJoinProbeOperatorX::_init_build_filter_conditions(
+        const vectorized::VExprSPtr& expr) {
+    using Op = BuildFilterCondition::Op;
+    if (expr->node_type() == TExprNodeType::COMPOUND_PRED &&
+        expr->fn().name.function_name == "and") {
+        for (const auto& child : expr->children()) {
+            _init_build_filter_conditions(child);
+        }
+        return;
+    }
+    if (expr->node_type() != TExprNodeType::BINARY_PRED || expr->get_num_children() != 2 ||
+        !expr->children()[0]->is_slot_ref() || !expr->children()[1]->is_slot_ref()) {
+        return;
+    }
+    static const std::unordered_map<std::string, std::pair<Op, Op>> ops = {
+            // op of `probe <op> build`, and of the same comparison written `build <op> probe`
+            {"eq", {Op::EQ, Op::EQ}},
+            {"lt", {Op::LT, Op::GT}},
+            {"le", {Op::LE, Op::GE}},
+            {"gt", {Op::GT, Op::LT}},
+            {"ge", {Op::GE, Op::LE}}};
+    auto it = ops.find(expr->fn().name.function_name);
+    if (it == ops.end()) {
+        return;
+    }
+    auto lhs = static_cast<const vectorized::VSlotRef*>(expr->children()[0].get())->column_id();
+    auto rhs = static_cast<const vectorized::VSlotRef*>(expr->children()[1].get())->column_id();
+    if (lhs < 0 || rhs < 0) {
+        return;
+    }
+    auto is_probe = [&](int column_id) {
+        return static_cast<size_t>(column_id) < _num_probe_side_columns;
+    };
+    if (is_probe(lhs) && !is_probe(rhs)) {
+        _build_filter_conditions.push_back(
+                {static_cast<size_t>(lhs), rhs - _num_probe_side_columns, it->second.first});
+    } else if (!is_probe(lhs) && is_probe(rhs)) {
+        _build_filter_conditions.push_back(
+                {static_cast<size_t>(rhs), lhs - _num_probe_side_columns, it->second.second});
+    }
+}
+
 bool NestedLoopJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state =
             state->get_local_state(operator_id())->cast<NestedLoopJoinProbeLocalState>();
@@ -59,7 +59,11 @@ private:
     void _reset_with_next_probe_row();
     void _append_left_data_with_null(vectorized::Block& block) const;
     void _process_left_child_block(vectorized::Block& block,
-                                   const vectorized::Block& now_process_build_block) const;
+                                   const vectorized::Block& now_process_build_block);
+    // Evaluates the build filter conditions of the operator for the current probe row on
+    // `build_block`, the passing rows are left in `_selected_build_rows`. Returns false if no
+    // condition could be evaluated, all rows of the block are joined then.
+    bool _filter_build_rows(const vectorized::Block& build_block);
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -148,7 +152,13 @@ private:
                         block, column_to_keep, build_block_idx, processed_blocks_num, materialize,
                         filter);
             }
-        } else if (block->rows() > 0) {
+        } else if (block->rows() == 0) {
+            // all build rows of the probe rows were filtered before materialization
+            std::stack<uint16_t> empty1;
+            _probe_offset_stack.swap(empty1);
+            std::stack<uint16_t> empty2;
+            _build_offset_stack.swap(empty2);
+        } else {
             if constexpr (SetBuildSideFlag) {
                 for (size_t i = 0; i < processed_blocks_num; i++) {
                     auto& build_side_flag =
@@ -190,17 +200,31 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // scratch of _filter_build_rows
+    vectorized::IColumn::Filter _build_rows_filter;
+    std::vector<uint32_t> _selected_build_rows;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
     RuntimeProfile::Counter* _update_visited_flags_timer = nullptr;
     RuntimeProfile::Counter* _join_conjuncts_evaluation_timer = nullptr;
     RuntimeProfile::Counter* _filtered_by_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _build_rows_filtered_counter = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
         : public JoinProbeOperatorX<NestedLoopJoinProbeLocalState> {
 public:
+    // A join conjunct `probe_slot <op> build_slot` on integer columns. It is evaluated on the
+    // build block column against the value of one probe row before the rows are copied into
+    // the join block, e.g. for `a.ts BETWEEN b.start AND b.end`.
+    struct BuildFilterCondition {
+        enum class Op { EQ, LT, LE, GT, GE };
+        size_t probe_column;
+        size_t build_column;
+        Op op;
+    };
+
     NestedLoopJoinProbeOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                                  const DescriptorTbl& descs);
     Status init(const TPlanNode& tnode, RuntimeState* state) override;
@@ -232,7 +256,11 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+    void _init_build_filter_conditions(const vectorized::VExprSPtr& expr);
+
     bool _is_output_left_side_only;
+    // empty if the join type needs every joined build row to set visited flags
+    std::vector<BuildFilterCondition> _build_filter_conditions;
     vectorized::VExprContextSPtrs _join_conjuncts;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
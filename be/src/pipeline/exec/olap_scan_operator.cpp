@@ -107,6 +107,8 @@ Status OlapScanLocalState::_init_profile() {
     _stats_rp_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsZoneMapRuntimePredicateFiltered", TUnit::UNIT);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
+    _bf_filtered_pages_counter =
+            ADD_COUNTER(_segment_profile, "PagesBloomFilterFiltered", TUnit::UNIT);
     _dict_filtered_counter = ADD_COUNTER(_segment_profile, "RowsDictFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
     _conditions_filtered_counter =
@@ -119,6 +121,10 @@ Status OlapScanLocalState::_init_profile() {
 
     _total_pages_num_counter = ADD_COUNTER(_segment_profile, "TotalPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_segment_profile, "CachedPagesNum", TUnit::UNIT);
+    _compressed_cached_pages_num_counter =
+            ADD_COUNTER(_segment_profile, "CompressedCachedPagesNum", TUnit::UNIT);
+    _read_ahead_pages_num_counter =
+            ADD_COUNTER(_segment_profile, "ReadAheadPagesNum", TUnit::UNIT);
 
     _bitmap_index_filter_counter =
             ADD_COUNTER(_segment_profile, "RowsBitmapIndexFiltered", TUnit::UNIT);
@@ -315,33 +321,41 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
     std::vector<TabletWithVersion> tablets;
     tablets.reserve(_scan_ranges.size());
     for (auto&& scan_range : _scan_ranges) {
-        // TODO(plat1ko): Get cloud tablet in parallel
-        auto tablet = DORIS_TRY(ExecEnv::get_tablet(scan_range->tablet_id));
         int64_t version = 0;
         std::from_chars(scan_range->version.data(),
                         scan_range->version.data() + scan_range->version.size(), version);
-        tablets.emplace_back(std::move(tablet), version);
+        tablets.push_back({nullptr, version});
     }
 
     if (config::is_cloud_mode()) {
         int64_t duration_ns = 0;
         {
             SCOPED_RAW_TIMER(&duration_ns);
+            // A tablet that is not cached yet is loaded from the meta service by get_tablet, so
+            // the tablets are loaded in parallel too instead of one RPC after another.
             std::vector<std::function<Status()>> tasks;
             tasks.reserve(_scan_ranges.size());
-            for (auto&& [tablet, version] : tablets) {
-                tasks.emplace_back([tablet, version]() {
+            for (size_t i = 0; i < _scan_ranges.size(); ++i) {
+                tasks.emplace_back([this, &tablet_with_version = tablets[i], i]() -> Status {
+                    auto& [tablet, version] = tablet_with_version;
+                    tablet = DORIS_TRY(ExecEnv::get_tablet(_scan_ranges[i]->tablet_id));
                     return std::dynamic_pointer_cast<CloudTablet>(tablet)->sync_rowsets(version);
                 });
             }
-            RETURN_IF_ERROR(cloud::bthread_fork_join(tasks, 10));
+            RETURN_IF_ERROR(
+                    cloud::bthread_fork_join(tasks, config::scan_sync_tablets_concurrency));
         }
         _sync_rowset_timer->update(duration_ns);
+    } else {
+        for (size_t i = 0; i < _scan_ranges.size(); ++i) {
+            tablets[i].tablet = DORIS_TRY(ExecEnv::get_tablet(_scan_ranges[i]->tablet_id));
+        }
     }
 
+    // A merge on read table is split too when its tablets need no merge, see
+    // ParallelScannerBuilder::build_scanners.
     if (enable_parallel_scan && !p._should_run_serial && !has_cpu_limit &&
-        p._push_down_agg_type == TPushAggOp::NONE &&
-        (_storage_no_merge() || p._olap_scan_node.is_preaggregation)) {
+        p._push_down_agg_type == TPushAggOp::NONE) {
         std::vector<OlapScanRange*> key_ranges;
         for (auto& range : _cond_ranges) {
             if (range->begin_scan_range.size() == 1 &&
@@ -351,8 +365,10 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
             key_ranges.emplace_back(range.get());
         }
 
-        ParallelScannerBuilder scanner_builder(this, tablets, _scanner_profile, key_ranges, state(),
-                                               p._limit, true, p._olap_scan_node.is_preaggregation);
+        ParallelScannerBuilder scanner_builder(
+                this, tablets, _scanner_profile, key_ranges, state(), p._limit,
+                _storage_no_merge() || p._olap_scan_node.is_preaggregation,
+                p._olap_scan_node.is_preaggregation);
 
         int max_scanners_count = state()->parallel_scan_max_scanners_count();
 
@@ -368,12 +384,19 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
         scanner_builder.set_max_scanners_count(max_scanners_count);
         scanner_builder.set_min_rows_per_scanner(min_rows_per_scanner);
 
-        RETURN_IF_ERROR(scanner_builder.build_scanners(*scanners));
-        for (auto& scanner : *scanners) {
-            auto* olap_scanner = assert_cast<vectorized::NewOlapScanner*>(scanner.get());
-            RETURN_IF_ERROR(olap_scanner->prepare(state(), _conjuncts));
+        Status st = scanner_builder.build_scanners(*scanners);
+        if (st.ok()) {
+            for (auto& scanner : *scanners) {
+                auto* olap_scanner = assert_cast<vectorized::NewOlapScanner*>(scanner.get());
+                RETURN_IF_ERROR(olap_scanner->prepare(state(), _conjuncts));
+            }
+            return Status::OK();
         }
-        return Status::OK();
+        if (!st.is<ErrorCode::NOT_IMPLEMENTED_ERROR>()) {
+            return st;
+        }
+        // rows of the same key have to be merged, fall back to split by key ranges
+        scanners->clear();
     }
 
     int scanners_per_tablet = std::max(1, 64 / (int)_scan_ranges.size());
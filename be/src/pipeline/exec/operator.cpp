@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -75,6 +76,9 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_task.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_sampler.h"
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
@@ -263,6 +267,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
 
     std::vector<int> result_column_ids;
     for (const auto& projections : local_state->_intermediate_projections) {
+        vectorized::VExprContext::reset_common_expr_cache(projections);
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
@@ -296,6 +301,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     if (rows != 0) {
         auto& mutable_columns = mutable_block.mutable_columns();
         DCHECK_EQ(mutable_columns.size(), local_state->_projections.size()) << debug_string();
+        vectorized::VExprContext::reset_common_expr_cache(local_state->_projections);
         for (int i = 0; i < mutable_columns.size(); ++i) {
             auto result_column_id = -1;
             RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
@@ -306,6 +312,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         DCHECK(mutable_block.rows() == rows);
         output_block->set_columns(std::move(mutable_columns));
     }
+    local_state->update_common_expr_counter();
 
     return Status::OK();
 }
@@ -325,7 +332,10 @@ Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::
 
     Status status;
     auto* local_state = state->get_local_state(operator_id());
+    SCOPED_ATTRIBUTE_OPERATOR_MEMORY(local_state->attributed_mem_counter());
+    SCOPED_ATTRIBUTE_OPERATOR_CPU(operator_id());
     Defer defer([&]() {
+        local_state->update_attributed_mem_counters();
         if (status.ok()) {
             if (auto rows = block->rows()) {
                 COUNTER_UPDATE(local_state->_rows_returned_counter, rows);
@@ -346,6 +356,39 @@ Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::
     return status;
 }
 
+void PipelineXLocalStateBase::_setup_common_expr_caches() {
+    auto setup = [&](const vectorized::VExprContextSPtrs& ctxs) {
+        if (auto cache = vectorized::VExprContext::setup_common_expr_cache(ctxs)) {
+            _common_expr_caches.push_back(std::move(cache));
+        }
+    };
+    setup(_conjuncts);
+    setup(_projections);
+    for (const auto& projections : _intermediate_projections) {
+        setup(projections);
+    }
+}
+
+void PipelineXLocalStateBase::update_common_expr_counter() {
+    if (_common_expr_caches.empty()) {
+        return;
+    }
+    int64_t reused = 0;
+    for (const auto& cache : _common_expr_caches) {
+        reused += cache->reused_count();
+    }
+    COUNTER_SET(_common_expr_reused_counter, reused);
+}
+
+void PipelineXLocalStateBase::update_attributed_mem_counters() {
+    if (_attributed_mem_peak_counter == nullptr) {
+        return;
+    }
+    COUNTER_SET(_attributed_mem_peak_counter, _attributed_mem_counter.peak_value());
+    COUNTER_SET(_attributed_alloc_count_counter, _attributed_mem_counter.alloc_count());
+    COUNTER_SET(_attributed_alloc_bytes_counter, _attributed_mem_counter.alloc_bytes());
+}
+
 void PipelineXLocalStateBase::reached_limit(vectorized::Block* block, bool* eos) {
     if (_parent->_limit != -1 and _num_rows_returned + block->rows() >= _parent->_limit) {
         block->set_num_rows(_parent->_limit - _num_rows_returned);
@@ -439,6 +482,45 @@ PipelineXSinkLocalStateBase::PipelineXSinkLocalStateBase(DataSinkOperatorXBase*
     _query_statistics = std::make_shared<QueryStatistics>();
 }
 
+void PipelineXSinkLocalStateBase::update_attributed_mem_counters() {
+    if (_attributed_mem_peak_counter == nullptr) {
+        return;
+    }
+    COUNTER_SET(_attributed_mem_peak_counter, _attributed_mem_counter.peak_value());
+    COUNTER_SET(_attributed_alloc_count_counter, _attributed_mem_counter.alloc_count());
+    COUNTER_SET(_attributed_alloc_bytes_counter, _attributed_mem_counter.alloc_bytes());
+}
+
+Status PipelineXSinkLocalStateBase::process_block_yieldable(
+        RuntimeState* state, vectorized::Block* block,
+        const std::function<Status(vectorized::Block*)>& func, bool* finished) {
+    const size_t rows = block->rows();
+    const auto slice_rows =
+            static_cast<size_t>(std::max(config::pipeline_sink_yield_slice_rows, 1));
+    auto* task = state->get_task();
+    if (task == nullptr || (_yield_block_offset == 0 && rows <= slice_rows)) {
+        *finished = true;
+        return func(block);
+    }
+
+    while (_yield_block_offset < rows) {
+        const size_t length = std::min(slice_rows, rows - _yield_block_offset);
+        vectorized::MutableBlock mutable_slice(block->clone_empty());
+        RETURN_IF_ERROR(mutable_slice.add_rows(block, _yield_block_offset, length));
+        vectorized::Block slice = mutable_slice.to_block();
+        RETURN_IF_ERROR(func(&slice));
+        _yield_block_offset += length;
+        if (_yield_block_offset < rows && task->should_yield()) {
+            task->yield_sink();
+            *finished = false;
+            return Status::OK();
+        }
+    }
+    _yield_block_offset = 0;
+    *finished = true;
+    return Status::OK();
+}
+
 PipelineXLocalStateBase::PipelineXLocalStateBase(RuntimeState* state, OperatorXBase* parent)
         : _num_rows_returned(0), _rows_returned_counter(nullptr), _parent(parent), _state(state) {
     _query_statistics = std::make_shared<QueryStatistics>();
@@ -475,12 +557,20 @@ Status PipelineXLocalState<SharedStateArg>::init(RuntimeState* state, LocalState
     _blocks_returned_counter =
             ADD_COUNTER_WITH_LEVEL(_runtime_profile, "BlocksProduced", TUnit::UNIT, 1);
     _projection_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "ProjectionTime", 1);
+    _common_expr_reused_counter =
+            ADD_COUNTER_WITH_LEVEL(_runtime_profile, "CommonExprReused", TUnit::UNIT, 1);
     _init_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "InitTime", 1);
     _open_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "OpenTime", 1);
     _close_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "CloseTime", 1);
     _exec_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "ExecTime", 1);
     _memory_used_counter =
             _runtime_profile->AddHighWaterMarkCounter("MemoryUsage", TUnit::BYTES, "", 1);
+    _attributed_mem_peak_counter =
+            ADD_COUNTER_WITH_LEVEL(_runtime_profile, "AttributedMemoryPeak", TUnit::BYTES, 1);
+    _attributed_alloc_count_counter =
+            ADD_COUNTER_WITH_LEVEL(_runtime_profile, "AttributedAllocCount", TUnit::UNIT, 1);
+    _attributed_alloc_bytes_counter =
+            ADD_COUNTER_WITH_LEVEL(_runtime_profile, "AttributedAllocBytes", TUnit::BYTES, 1);
     return Status::OK();
 }
 
@@ -502,6 +592,9 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
                     state, _intermediate_projections[i][j]));
         }
     }
+    if (config::enable_common_subexpr_elimination) {
+        _setup_common_expr_caches();
+    }
     return Status::OK();
 }
 
@@ -552,6 +645,12 @@ Status PipelineXSinkLocalState<SharedState>::init(RuntimeState* state, LocalSink
     _exec_timer = ADD_TIMER_WITH_LEVEL(_profile, "ExecTime", 1);
     info.parent_profile->add_child(_profile, true, nullptr);
     _memory_used_counter = _profile->AddHighWaterMarkCounter("MemoryUsage", TUnit::BYTES, "", 1);
+    _attributed_mem_peak_counter =
+            ADD_COUNTER_WITH_LEVEL(_profile, "AttributedMemoryPeak", TUnit::BYTES, 1);
+    _attributed_alloc_count_counter =
+            ADD_COUNTER_WITH_LEVEL(_profile, "AttributedAllocCount", TUnit::UNIT, 1);
+    _attributed_alloc_bytes_counter =
+            ADD_COUNTER_WITH_LEVEL(_profile, "AttributedAllocBytes", TUnit::BYTES, 1);
     return Status::OK();
 }
 
@@ -32,10 +32,12 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/local_exchange/local_exchanger.h"
+#include "runtime/memory/mem_counter.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
+#include "vec/exprs/common_expr_cache.h"
 #include "vec/runtime/vdata_stream_recvr.h"
 
 namespace doris {
@@ -113,6 +115,10 @@ public:
     virtual size_t revocable_mem_size(RuntimeState* state) const { return 0; }
 
     virtual Status revoke_memory(RuntimeState* state) { return Status::OK(); }
+
+    // Bytes the next sink() is expected to allocate. The pipeline task reserves them before
+    // pulling the next block and revokes memory instead if the reservation is denied.
+    virtual size_t get_reserve_mem_size(RuntimeState* state) const { return 0; }
     [[nodiscard]] virtual bool require_data_distribution() const { return false; }
     OperatorPtr child() { return _child; }
     [[nodiscard]] bool followed_by_shuffled_operator() const {
@@ -122,6 +128,13 @@ public:
         _followed_by_shuffled_operator = followed_by_shuffled_operator;
     }
     [[nodiscard]] virtual bool is_shuffled_operator() const { return false; }
+    // Hash distribution required by this operator is only a preference (e.g. a non-finalized
+    // aggregation whose partial results are merged later), so the local exchange before it may
+    // fall back to non-hash distribution at runtime if the data is skewed.
+    [[nodiscard]] virtual bool tolerate_non_hash_distribution() const { return false; }
+    // Rows of hot join keys may be spread over all instances on the build side of a shuffled
+    // hash join if the probe rows of them are sent to all instances (see `JoinHotKeyState`).
+    [[nodiscard]] virtual bool can_split_hot_keys() const { return false; }
     [[nodiscard]] virtual DataDistribution required_data_distribution() const;
     [[nodiscard]] virtual bool require_shuffled_data_distribution() const;
 
@@ -169,6 +182,11 @@ public:
 
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
     RuntimeProfile::Counter* memory_used_counter() { return _memory_used_counter; }
+    // Memory consumed by the task thread while running this operator, published to the
+    // Attributed* profile counters by update_attributed_mem_counters().
+    OperatorMemCounter* attributed_mem_counter() { return &_attributed_mem_counter; }
+    void update_attributed_mem_counters();
+    void update_common_expr_counter();
     OperatorXBase* parent() { return _parent; }
     RuntimeState* state() { return _state; }
     vectorized::VExprContextSPtrs& conjuncts() { return _conjuncts; }
@@ -205,7 +223,12 @@ protected:
     RuntimeProfile::Counter* _wait_for_dependency_timer = nullptr;
     // Account for current memory and peak memory used by this node
     RuntimeProfile::HighWaterMarkCounter* _memory_used_counter = nullptr;
+    OperatorMemCounter _attributed_mem_counter;
+    RuntimeProfile::Counter* _attributed_mem_peak_counter = nullptr;
+    RuntimeProfile::Counter* _attributed_alloc_count_counter = nullptr;
+    RuntimeProfile::Counter* _attributed_alloc_bytes_counter = nullptr;
     RuntimeProfile::Counter* _projection_timer = nullptr;
+    RuntimeProfile::Counter* _common_expr_reused_counter = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
     RuntimeProfile::Counter* _init_timer = nullptr;
     RuntimeProfile::Counter* _open_timer = nullptr;
@@ -217,6 +240,10 @@ protected:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // Caches of the expr lists above that share equal subtrees, see CommonExprCache.
+    std::vector<vectorized::CommonExprCacheSPtr> _common_expr_caches;
+
+    void _setup_common_expr_caches();
 
     bool _closed = false;
     vectorized::Block _origin_block;
@@ -348,6 +375,10 @@ public:
     RuntimeProfile::Counter* rows_input_counter() { return _rows_input_counter; }
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
     RuntimeProfile::Counter* memory_used_counter() { return _memory_used_counter; }
+    // Memory consumed by the task thread while running this operator, published to the
+    // Attributed* profile counters by update_attributed_mem_counters().
+    OperatorMemCounter* attributed_mem_counter() { return &_attributed_mem_counter; }
+    void update_attributed_mem_counters();
     virtual std::vector<Dependency*> dependencies() const { return {nullptr}; }
 
     // override in exchange sink , AsyncWriterSink
@@ -355,10 +386,24 @@ public:
 
     std::shared_ptr<QueryStatistics> get_query_statistics_ptr() { return _query_statistics; }
 
+    // Yield point for sinks which may take a long time to consume one large block.
+    // `block` is processed by `func` slice by slice (`pipeline_sink_yield_slice_rows` rows each),
+    // and if the time slice of the task is used up between two slices, the task yields: the
+    // offset of the next slice is kept and the task calls `sink` again with the same block when
+    // it is rescheduled. `*finished` is set to true once the whole block has been consumed.
+    // `resuming_block()` tells whether this call resumes a block processed partly before.
+    Status process_block_yieldable(RuntimeState* state, vectorized::Block* block,
+                                   const std::function<Status(vectorized::Block*)>& func,
+                                   bool* finished);
+
+    bool resuming_block() const { return _yield_block_offset > 0; }
+
 protected:
     DataSinkOperatorXBase* _parent = nullptr;
     RuntimeState* _state = nullptr;
     RuntimeProfile* _profile = nullptr;
+    // rows of the current input block consumed before the last yield
+    size_t _yield_block_offset = 0;
     // Set to true after close() has been called. subclasses should check and set this in
     // close().
     bool _closed = false;
@@ -378,6 +423,10 @@ protected:
     RuntimeProfile::Counter* _wait_for_finish_dependency_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _memory_used_counter = nullptr;
+    OperatorMemCounter _attributed_mem_counter;
+    RuntimeProfile::Counter* _attributed_mem_peak_counter = nullptr;
+    RuntimeProfile::Counter* _attributed_alloc_count_counter = nullptr;
+    RuntimeProfile::Counter* _attributed_alloc_bytes_counter = nullptr;
 
     std::shared_ptr<QueryStatistics> _query_statistics = nullptr;
 };
@@ -586,6 +635,9 @@ public:
     RuntimeProfile::Counter* _spill_wait_in_queue_timer = nullptr;
     RuntimeProfile::Counter* _spill_write_wait_io_timer = nullptr;
     RuntimeProfile::Counter* _spill_read_wait_io_timer = nullptr;
+
+    // Memory the last sink() grew the in-memory state by, used as the reservation of the next.
+    size_t _reserve_mem_size = 0;
 };
 
 class OperatorXBase : public OperatorBase {
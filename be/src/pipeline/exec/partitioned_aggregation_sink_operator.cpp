@@ -161,7 +161,10 @@ Status PartitionedAggSinkOperatorX::sink(doris::RuntimeState* state, vectorized:
     DBUG_EXECUTE_IF("fault_inject::partitioned_agg_sink::sink", {
         return Status::Error<INTERNAL_ERROR>("fault_inject partitioned_agg_sink sink failed");
     });
+    const size_t mem_before = _agg_sink_operator->get_revocable_mem_size(runtime_state);
     RETURN_IF_ERROR(_agg_sink_operator->sink(runtime_state, in_block, false));
+    const size_t mem_after = _agg_sink_operator->get_revocable_mem_size(runtime_state);
+    local_state._reserve_mem_size = mem_after > mem_before ? mem_after - mem_before : 0;
     if (eos) {
         if (local_state._shared_state->is_spilled) {
             if (revocable_mem_size(state) > 0) {
@@ -199,6 +202,10 @@ size_t PartitionedAggSinkOperatorX::revocable_mem_size(RuntimeState* state) cons
     return size;
 }
 
+size_t PartitionedAggSinkOperatorX::get_reserve_mem_size(RuntimeState* state) const {
+    return get_local_state(state)._reserve_mem_size;
+}
+
 Status PartitionedAggSinkLocalState::setup_in_memory_agg_op(RuntimeState* state) {
     _runtime_state = RuntimeState::create_unique(
             state->fragment_instance_id(), state->query_id(), state->fragment_id(),
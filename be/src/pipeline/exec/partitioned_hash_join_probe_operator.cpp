@@ -24,6 +24,19 @@
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
+namespace {
+// Rows of one spilled partition share the same spill channel id, so they are split again by the
+// hash value mixed with the repartition depth, every depth spreads the rows differently.
+uint32_t repartition_channel_id(uint32_t hash, uint32_t level, uint32_t fanout) {
+    uint32_t h = hash ^ (0x9E3779B9U * level);
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+    return h % fanout;
+}
+} // namespace
 
 PartitionedHashJoinProbeLocalState::PartitionedHashJoinProbeLocalState(RuntimeState* state,
                                                                        OperatorXBase* parent)
@@ -39,6 +52,7 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
 
     _partitioned_blocks.resize(p._partition_count);
     _probe_spilling_streams.resize(p._partition_count);
+    _partition_levels.resize(p._partition_count, 0);
 
     _spill_and_partition_label = ADD_LABEL_COUNTER(profile(), "Partition");
     _partition_timer = ADD_CHILD_TIMER(profile(), "PartitionTime", "Partition");
@@ -57,6 +71,11 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
     _recovery_probe_blocks =
             ADD_CHILD_COUNTER(profile(), "RecoveryProbeBlocks", TUnit::UNIT, "Spill");
     _recovery_probe_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "RecoveryProbeTime", "Spill", 1);
+    _repartition_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "RepartitionTime", "Spill", 1);
+    _repartition_count =
+            ADD_CHILD_COUNTER(profile(), "RepartitionPartitions", TUnit::UNIT, "Spill");
+    _max_repartition_depth =
+            ADD_CHILD_COUNTER(profile(), "MaxRepartitionDepth", TUnit::UNIT, "Spill");
 
     _spill_serialize_block_timer =
             ADD_CHILD_TIMER_WITH_LEVEL(Base::profile(), "SpillSerializeBlockTime", "Spill", 1);
@@ -143,8 +162,13 @@ void PartitionedHashJoinProbeLocalState::update_probe_profile(RuntimeProfile* ch
 
 Status PartitionedHashJoinProbeLocalState::open(RuntimeState* state) {
     RETURN_IF_ERROR(PipelineXSpillLocalState::open(state));
-    return _parent->cast<PartitionedHashJoinProbeOperatorX>()._partitioner->clone(state,
-                                                                                  _partitioner);
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    RETURN_IF_ERROR(p._partitioner->clone(state, _partitioner));
+    RETURN_IF_ERROR(p._partitioner->clone(state, _probe_repartitioner));
+    RETURN_IF_ERROR(p._build_partitioner->clone(state, _build_repartitioner));
+    static_cast<SpillPartitionerType*>(_probe_repartitioner.get())->set_keep_hash_values(true);
+    static_cast<SpillPartitionerType*>(_build_repartitioner.get())->set_keep_hash_values(true);
+    return Status::OK();
 }
 Status PartitionedHashJoinProbeLocalState::close(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
@@ -393,6 +417,199 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
     return spill_io_pool->submit(std::move(spill_runnable));
 }
 
+bool PartitionedHashJoinProbeLocalState::need_to_repartition(uint32_t partition_index) const {
+    if (_partition_levels[partition_index] >=
+        cast_set<uint32_t>(std::max(config::spill_hash_join_max_repartition_depth, 0))) {
+        return false;
+    }
+    const auto& spilled_stream = _shared_state->spilled_streams[partition_index];
+    const auto& mutable_block = _shared_state->partitioned_build_blocks[partition_index];
+    if (!spilled_stream || !mutable_block) {
+        return false;
+    }
+    const auto build_bytes = spilled_stream->get_written_bytes() +
+                             cast_set<int64_t>(mutable_block->allocated_bytes());
+    return build_bytes > config::spill_hash_join_partition_max_bytes;
+}
+
+Status PartitionedHashJoinProbeLocalState::repartition_spilled_partition(RuntimeState* state,
+                                                                         uint32_t partition_index) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    const auto level = _partition_levels[partition_index] + 1;
+    const auto first_partition = partition_count();
+    const auto new_partition_count = first_partition + p._partition_count;
+    VLOG_DEBUG << "query: " << print_id(state->query_id()) << ", node: " << p.node_id()
+               << ", task id: " << state->task_id() << ", partition: " << partition_index
+               << " repartition into " << first_partition << " - " << new_partition_count
+               << ", level: " << level;
+
+    _partition_levels.resize(new_partition_count, level);
+    _shared_state->spilled_streams.resize(new_partition_count);
+    _shared_state->partitioned_build_blocks.resize(new_partition_count);
+    _probe_spilling_streams.resize(new_partition_count);
+    _partitioned_blocks.resize(new_partition_count);
+    COUNTER_UPDATE(_repartition_count, 1);
+    if (level > _max_repartition_depth->value()) {
+        COUNTER_SET(_max_repartition_depth, int64_t(level));
+    }
+
+    std::vector<vectorized::Block> build_blocks;
+    auto& build_block = _shared_state->partitioned_build_blocks[partition_index];
+    if (build_block && build_block->rows() > 0) {
+        build_blocks.emplace_back(build_block->to_block());
+    }
+    build_block.reset();
+    auto build_stream = std::move(_shared_state->spilled_streams[partition_index]);
+
+    std::vector<vectorized::Block> probe_blocks = std::move(_probe_blocks[partition_index]);
+    _probe_blocks.erase(partition_index);
+    auto& probe_block = _partitioned_blocks[partition_index];
+    if (probe_block && probe_block->rows() > 0) {
+        probe_blocks.emplace_back(probe_block->to_block());
+    }
+    probe_block.reset();
+    auto probe_stream = std::move(_probe_spilling_streams[partition_index]);
+
+    std::weak_ptr<PartitionedHashJoinSharedState> shared_state_holder =
+            _shared_state->shared_from_this();
+    auto query_id = state->query_id();
+    MonotonicStopWatch submit_timer;
+    submit_timer.start();
+
+    auto repartition_func = [this, query_id, state, shared_state_holder, submit_timer,
+                             first_partition, build_stream = std::move(build_stream),
+                             probe_stream = std::move(probe_stream),
+                             build_blocks = std::move(build_blocks),
+                             probe_blocks = std::move(probe_blocks)]() mutable {
+        auto shared_state_sptr = shared_state_holder.lock();
+        if (!shared_state_sptr || state->is_cancelled()) {
+            LOG(INFO) << "query: " << print_id(query_id)
+                      << " execution_context released, maybe query was cancelled.";
+            return Status::OK();
+        }
+
+        _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
+        SCOPED_TIMER(_repartition_timer);
+        DBUG_EXECUTE_IF("fault_inject::partitioned_hash_join_probe::repartition", {
+            return Status::Error<INTERNAL_ERROR>(
+                    "fault_inject partitioned_hash_join_probe repartition failed");
+        });
+        RETURN_IF_ERROR(
+                _repartition_blocks(state, build_stream, build_blocks, first_partition, true));
+        RETURN_IF_ERROR(
+                _repartition_blocks(state, probe_stream, probe_blocks, first_partition, false));
+
+        ++_partition_cursor;
+        return finish_spilling(_partition_cursor);
+    };
+
+    auto exception_catch_func = [repartition_func = std::move(repartition_func), this]() mutable {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return repartition_func(); }); }();
+
+        if (!status.ok()) {
+            _spill_status_ok = false;
+            _spill_status = std::move(status);
+        }
+        _dependency->set_ready();
+    };
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _dependency->block();
+    return spill_io_pool->submit(std::make_shared<SpillRunnable>(
+            state, _shared_state->shared_from_this(), std::move(exception_catch_func)));
+}
+
+Status PartitionedHashJoinProbeLocalState::_repartition_blocks(
+        RuntimeState* state, vectorized::SpillStreamSPtr& source_stream,
+        std::vector<vectorized::Block>& blocks, uint32_t first_partition, bool is_build) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    auto* partitioner = static_cast<SpillPartitionerType*>(is_build ? _build_repartitioner.get()
+                                                                    : _probe_repartitioner.get());
+    auto& spilling_streams = is_build ? _shared_state->spilled_streams : _probe_spilling_streams;
+    const auto fanout = p._partition_count;
+    const auto level = _partition_levels[first_partition];
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> sub_blocks(fanout);
+
+    auto flush_sub_block = [&](uint32_t i, bool eos) -> Status {
+        auto& sub_block = sub_blocks[i];
+        if (!sub_block || sub_block->rows() == 0 ||
+            (!eos && sub_block->rows() < cast_set<size_t>(state->batch_size()))) {
+            return Status::OK();
+        }
+        auto& spilling_stream = spilling_streams[first_partition + i];
+        if (!spilling_stream) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, spilling_stream, print_id(state->query_id()),
+                    is_build ? "hash_build" : "hash_probe", _parent->node_id(),
+                    std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                    _runtime_profile.get()));
+            RETURN_IF_ERROR(spilling_stream->prepare_spill());
+            spilling_stream->set_write_counters(
+                    _spill_serialize_block_timer, _spill_block_count, _spill_data_size,
+                    _spill_write_disk_timer, _spill_write_wait_io_timer);
+            if (is_build) {
+                // recovery skips the spilled build stream of a partition without build block
+                _shared_state->partitioned_build_blocks[first_partition + i] =
+                        vectorized::MutableBlock::create_unique();
+            }
+        }
+        auto block = sub_block->to_block();
+        sub_block.reset();
+        COUNTER_UPDATE(is_build ? _spill_build_rows : _spill_probe_rows, block.rows());
+        COUNTER_UPDATE(is_build ? _spill_build_blocks : _spill_probe_blocks, 1);
+        return spilling_stream->spill_block(state, block, false);
+    };
+
+    auto split_block = [&](vectorized::Block& block) -> Status {
+        const auto rows = block.rows();
+        if (rows == 0) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(partitioner->do_partitioning(state, &block));
+        const auto& hash_values = partitioner->hash_values();
+        std::vector<std::vector<uint32_t>> partition_indexes(fanout);
+        for (uint32_t i = 0; i != rows; ++i) {
+            partition_indexes[repartition_channel_id(hash_values[i], level, fanout)].emplace_back(
+                    i);
+        }
+        for (uint32_t i = 0; i != fanout; ++i) {
+            const auto& indexes = partition_indexes[i];
+            if (indexes.empty()) {
+                continue;
+            }
+            if (!sub_blocks[i]) {
+                sub_blocks[i] = vectorized::MutableBlock::create_unique(block.clone_empty());
+            }
+            RETURN_IF_ERROR(sub_blocks[i]->add_rows(&block, indexes.data(),
+                                                    indexes.data() + indexes.size()));
+            RETURN_IF_ERROR(flush_sub_block(i, false));
+        }
+        return Status::OK();
+    };
+
+    for (auto& block : blocks) {
+        RETURN_IF_ERROR(split_block(block));
+    }
+    blocks.clear();
+
+    if (source_stream) {
+        bool eos = false;
+        while (!eos && !state->is_cancelled()) {
+            vectorized::Block block;
+            RETURN_IF_ERROR(source_stream->read_next_block_sync(&block, &eos));
+            COUNTER_UPDATE(is_build ? _recovery_build_rows : _recovery_probe_rows, block.rows());
+            RETURN_IF_ERROR(split_block(block));
+        }
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(source_stream);
+        source_stream.reset();
+    }
+
+    for (uint32_t i = 0; i != fanout; ++i) {
+        RETURN_IF_ERROR(flush_sub_block(i, true));
+    }
+    return Status::OK();
+}
+
 std::string PartitionedHashJoinProbeLocalState::debug_string(int indentation_level) const {
     auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
     bool need_more_input_data;
@@ -522,6 +739,12 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
     _partitioner = std::make_unique<SpillPartitionerType>(_partition_count);
     RETURN_IF_ERROR(_partitioner->init(_probe_exprs));
 
+    for (auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
+        _build_exprs.emplace_back(conjunct.right);
+    }
+    _build_partitioner = std::make_unique<SpillPartitionerType>(_partition_count);
+    RETURN_IF_ERROR(_build_partitioner->init(_build_exprs));
+
     return Status::OK();
 }
 
@@ -536,6 +759,8 @@ Status PartitionedHashJoinProbeOperatorX::open(RuntimeState* state) {
     _child = std::move(child);
     RETURN_IF_ERROR(_partitioner->prepare(state, _child->row_desc()));
     RETURN_IF_ERROR(_partitioner->open(state));
+    RETURN_IF_ERROR(_build_partitioner->prepare(state, _build_side_child->row_desc()));
+    RETURN_IF_ERROR(_build_partitioner->open(state));
     return Status::OK();
 }
 
@@ -675,6 +900,9 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
     auto& probe_blocks = local_state._probe_blocks[partition_index];
     if (local_state._need_to_setup_internal_operators) {
         *eos = false;
+        if (local_state.need_to_repartition(partition_index)) {
+            return local_state.repartition_spilled_partition(state, partition_index);
+        }
         bool has_data = false;
         RETURN_IF_ERROR(local_state.recovery_build_blocks_from_disk(
                 state, local_state._partition_cursor, has_data));
@@ -724,7 +952,7 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                    << ", task: " << state->task_id()
                    << ", partition: " << local_state._partition_cursor;
         local_state._partition_cursor++;
-        if (local_state._partition_cursor == _partition_count) {
+        if (local_state._partition_cursor == local_state.partition_count()) {
             *eos = true;
         } else {
             RETURN_IF_ERROR(local_state.finish_spilling(local_state._partition_cursor));
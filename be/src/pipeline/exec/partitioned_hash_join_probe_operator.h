@@ -19,6 +19,7 @@
 
 #include <cstdint>
 
+#include "common/cast_set.h"
 #include "common/status.h"
 #include "operator.h"
 #include "pipeline/exec/hashjoin_build_sink.h"
@@ -55,6 +56,14 @@ public:
 
     Status finish_spilling(uint32_t partition_index);
 
+    // Whether the build side of the partition is too large to be loaded into memory at once.
+    bool need_to_repartition(uint32_t partition_index) const;
+    // Split the build and probe data of the partition into new partitions with a hash seeded by
+    // the repartition depth, then move on to the next partition.
+    Status repartition_spilled_partition(RuntimeState* state, uint32_t partition_index);
+
+    uint32_t partition_count() const { return cast_set<uint32_t>(_partition_levels.size()); }
+
     void update_build_profile(RuntimeProfile* child_profile);
     void update_probe_profile(RuntimeProfile* child_profile);
 
@@ -66,8 +75,14 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    Status _repartition_blocks(RuntimeState* state, vectorized::SpillStreamSPtr& source_stream,
+                               std::vector<vectorized::Block>& blocks, uint32_t first_partition,
+                               bool is_build);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
+    // repartition depth of every partition, partitions split again are appended to the end
+    std::vector<uint32_t> _partition_levels;
 
     std::unique_ptr<vectorized::Block> _child_block;
     bool _child_eos {false};
@@ -84,6 +99,8 @@ private:
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
 
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _build_repartitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _probe_repartitioner;
     std::unique_ptr<RuntimeState> _runtime_state;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
 
@@ -104,6 +121,9 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_count = nullptr;
+    RuntimeProfile::Counter* _max_repartition_depth = nullptr;
 
     RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
     RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
@@ -211,6 +231,9 @@ private:
 
     const uint32_t _partition_count;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    // partitions build blocks again when a spilled partition is too large
+    std::vector<TExpr> _build_exprs;
+    std::unique_ptr<vectorized::PartitionerBase> _build_partitioner;
 };
 
 } // namespace pipeline
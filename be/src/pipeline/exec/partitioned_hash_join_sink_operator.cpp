@@ -515,6 +515,8 @@ Status PartitionedHashJoinSinkOperatorX::sink(RuntimeState* state, vectorized::B
     }
 
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
+    // the build side keeps the input blocks, so the next block costs about as much as this one
+    local_state._reserve_mem_size = in_block->allocated_bytes();
     if (need_to_spill) {
         RETURN_IF_ERROR(local_state._partition_block(state, in_block, 0, rows));
 
@@ -550,6 +552,10 @@ size_t PartitionedHashJoinSinkOperatorX::revocable_mem_size(RuntimeState* state)
     return local_state.revocable_mem_size(state);
 }
 
+size_t PartitionedHashJoinSinkOperatorX::get_reserve_mem_size(RuntimeState* state) const {
+    return get_local_state(state)._reserve_mem_size;
+}
+
 Status PartitionedHashJoinSinkOperatorX::revoke_memory(RuntimeState* state) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
@@ -101,6 +101,8 @@ public:
 
     size_t revocable_mem_size(RuntimeState* state) const override;
 
+    size_t get_reserve_mem_size(RuntimeState* state) const override;
+
     Status revoke_memory(RuntimeState* state) override;
 
     DataDistribution required_data_distribution() const override {
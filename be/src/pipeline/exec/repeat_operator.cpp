@@ -21,6 +21,7 @@
 
 #include "common/logging.h"
 #include "pipeline/exec/operator.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -101,58 +102,57 @@ Status RepeatLocalState::get_repeated_block(vectorized::Block* child_block, int
     size_t child_column_size = child_block->columns();
     size_t column_size = p._output_slots.size();
     DCHECK_LT(child_column_size, column_size);
-    auto m_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(output_block,
-                                                                              p._output_slots);
-    auto& columns = m_block.mutable_columns();
+    const auto rows = child_block->rows();
     /* Fill all slots according to child, for example:select tc1,tc2,sum(tc3) from t1 group by grouping sets((tc1),(tc2));
      * insert into t1 values(1,2,1),(1,3,1),(2,1,1),(3,1,1);
      * slot_id_set_list=[[0],[1]],repeat_id_idx=0,
      * child_block 1,2,1 | 1,3,1 | 2,1,1 | 3,1,1
      * output_block 1,null,1,1 | 1,null,1,1 | 2,nul,1,1 | 3,null,1,1
+     * The columns kept by a grouping set share the columns of the child block instead of being
+     * copied for every grouping set, the null columns are built once for every child block.
      */
+    _null_columns.resize(child_column_size);
+    const std::set<SlotId>& repeat_ids = p._slot_id_set_list[repeat_id_idx];
+    vectorized::ColumnsWithTypeAndName output_columns;
+    output_columns.reserve(column_size);
     size_t cur_col = 0;
-    for (size_t i = 0; i < child_column_size; i++) {
-        const vectorized::ColumnWithTypeAndName& src_column = child_block->get_by_position(i);
-
-        std::set<SlotId>& repeat_ids = p._slot_id_set_list[repeat_id_idx];
-        bool is_repeat_slot =
-                p._all_slot_ids.find(p._output_slots[cur_col]->id()) != p._all_slot_ids.end();
-        bool is_set_null_slot = repeat_ids.find(p._output_slots[cur_col]->id()) == repeat_ids.end();
-        const auto row_size = src_column.column->size();
-
-        if (is_repeat_slot) {
-            DCHECK(p._output_slots[cur_col]->is_nullable());
-            auto* nullable_column =
-                    reinterpret_cast<vectorized::ColumnNullable*>(columns[cur_col].get());
-            auto& null_map = nullable_column->get_null_map_data();
-            auto* column_ptr = columns[cur_col].get();
+    for (; cur_col < child_column_size; cur_col++) {
+        const vectorized::ColumnWithTypeAndName& src_column = child_block->get_by_position(cur_col);
+        const SlotDescriptor* slot = p._output_slots[cur_col];
+        vectorized::ColumnPtr column = src_column.column;
 
+        if (p._all_slot_ids.contains(slot->id())) {
+            DCHECK(slot->is_nullable());
             // set slot null not in repeat_ids
-            if (is_set_null_slot) {
-                nullable_column->resize(row_size);
-                memset(nullable_column->get_null_map_data().data(), 1,
-                       sizeof(vectorized::UInt8) * row_size);
-            } else {
-                if (!src_column.type->is_nullable()) {
-                    for (size_t j = 0; j < row_size; ++j) {
-                        null_map.push_back(0);
-                    }
-                    column_ptr = &nullable_column->get_nested_column();
+            if (!repeat_ids.contains(slot->id())) {
+                if (!_null_columns[cur_col]) {
+                    auto null_column = slot->get_empty_mutable_column();
+                    null_column->insert_many_defaults(rows);
+                    _null_columns[cur_col] = std::move(null_column);
                 }
-                column_ptr->insert_range_from(*src_column.column, 0, row_size);
+                column = _null_columns[cur_col];
+            } else if (!src_column.type->is_nullable()) {
+                column = vectorized::make_nullable(src_column.column);
             }
-        } else {
-            columns[cur_col]->insert_range_from(*src_column.column, 0, row_size);
         }
-        cur_col++;
+        output_columns.emplace_back(std::move(column), slot->get_data_type_ptr(),
+                                    slot->col_name());
     }
 
-    const auto rows = child_block->rows();
     // Fill grouping ID to block
-    RETURN_IF_ERROR(add_grouping_id_column(rows, cur_col, columns, repeat_id_idx));
-
+    vectorized::MutableColumns grouping_columns(column_size);
+    for (size_t i = child_column_size; i < column_size; ++i) {
+        grouping_columns[i] = p._output_slots[i]->get_empty_mutable_column();
+    }
+    RETURN_IF_ERROR(add_grouping_id_column(rows, cur_col, grouping_columns, repeat_id_idx));
     DCHECK_EQ(cur_col, column_size);
+    for (size_t i = child_column_size; i < column_size; ++i) {
+        output_columns.emplace_back(std::move(grouping_columns[i]),
+                                    p._output_slots[i]->get_data_type_ptr(),
+                                    p._output_slots[i]->col_name());
+    }
 
+    output_block->swap(vectorized::Block(std::move(output_columns)));
     return Status::OK();
 }
 
@@ -224,6 +224,7 @@ Status RepeatOperatorX::pull(doris::RuntimeState* state, vectorized::Block* outp
 
             if (_repeat_id_idx >= _repeat_id_list.size()) {
                 _intermediate_block->clear();
+                local_state._null_columns.clear();
                 _child_block.clear_column_data(_child->row_desc().num_materialized_slots());
                 _repeat_id_idx = 0;
             }
@@ -54,6 +54,8 @@ private:
     bool _child_eos = false;
     int _repeat_id_idx;
     std::unique_ptr<vectorized::Block> _intermediate_block;
+    // The null columns of the repeat slots for the current intermediate block.
+    vectorized::Columns _null_columns;
     vectorized::VExprContextSPtrs _expr_ctxs;
 
     RuntimeProfile::Counter* _evaluate_input_timer = nullptr;
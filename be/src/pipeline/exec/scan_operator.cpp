@@ -1053,6 +1053,8 @@ Status ScanLocalState<Derived>::_init_profile() {
     _newly_create_free_blocks_num =
             ADD_COUNTER(_scanner_profile, "NewlyCreateFreeBlocksNum", TUnit::UNIT);
     _scale_up_scanners_counter = ADD_COUNTER(_scanner_profile, "NumScaleUpScanners", TUnit::UNIT);
+    _scale_down_scanners_counter =
+            ADD_COUNTER(_scanner_profile, "NumScaleDownScanners", TUnit::UNIT);
     // time of transfer thread to wait for block from scan thread
     _scanner_sched_counter = ADD_COUNTER(_scanner_profile, "ScannerSchedCount", TUnit::UNIT);
 
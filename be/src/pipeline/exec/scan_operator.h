@@ -28,7 +28,9 @@
 #include "pipeline/common/runtime_filter_consumer.h"
 #include "pipeline/dependency.h"
 #include "runtime/descriptors.h"
+#include "runtime/thread_context.h"
 #include "runtime/types.h"
+#include "util/cpu_sampler.h"
 #include "vec/exec/scan/vscan_node.h"
 #include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vin_predicate.h"
@@ -116,6 +118,7 @@ protected:
     RuntimeProfile::Counter* _filter_timer = nullptr;
     RuntimeProfile::Counter* _memory_usage_counter = nullptr;
     RuntimeProfile::Counter* _scale_up_scanners_counter = nullptr;
+    RuntimeProfile::Counter* _scale_down_scanners_counter = nullptr;
     // rows read from the scanner (including those discarded by (pre)filters)
     RuntimeProfile::Counter* _rows_read_counter = nullptr;
 
@@ -358,10 +361,16 @@ public:
     Status get_block(RuntimeState* state, vectorized::Block* block, bool* eos) override;
     Status get_block_after_projects(RuntimeState* state, vectorized::Block* block,
                                     bool* eos) override {
-        Status status = get_block(state, block, eos);
+        auto* local_state = state->get_local_state(operator_id());
+        Status status;
+        {
+            SCOPED_ATTRIBUTE_OPERATOR_MEMORY(local_state->attributed_mem_counter());
+            SCOPED_ATTRIBUTE_OPERATOR_CPU(operator_id());
+            status = get_block(state, block, eos);
+        }
+        local_state->update_attributed_mem_counters();
         if (status.ok()) {
             if (auto rows = block->rows()) {
-                auto* local_state = state->get_local_state(operator_id());
                 COUNTER_UPDATE(local_state->_rows_returned_counter, rows);
                 COUNTER_UPDATE(local_state->_blocks_returned_counter, 1);
             }
@@ -180,6 +180,10 @@ void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
     auto& hash_table_variants = local_state._shared_state->hash_table_variants;
 
+    if constexpr (is_intersect) {
+        local_state._shared_state->alive_rows.intersect_and_clear(
+                local_state._shared_state->visited_rows);
+    }
     if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
         _refresh_hash_table(local_state);
         if constexpr (is_intersect) {
@@ -216,45 +220,28 @@ void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
                     auto& iter = arg.iterator;
                     auto iter_end = arg.hash_table->end();
 
+                    // The matched rows are tracked in bitmaps, so the table only has to be
+                    // rebuilt to save memory and probe time once most of its keys are gone.
                     constexpr double need_shrink_ratio = 0.25;
-                    bool is_need_shrink =
-                            is_intersect
-                                    ? (valid_element_in_hash_tbl <
-                                       arg.hash_table
-                                               ->size()) // When intersect, shrink as long as the element decreases
-                                    : ((double)valid_element_in_hash_tbl <
-                                       (double)arg.hash_table->size() *
-                                               need_shrink_ratio); // When except, element decreases need to within the 'need_shrink_ratio' before shrinking
+                    bool is_need_shrink = (double)valid_element_in_hash_tbl <
+                                          (double)arg.hash_table->size() * need_shrink_ratio;
 
                     if (is_need_shrink) {
                         auto tmp_hash_table =
                                 std::make_shared<typename HashTableCtxType::HashMapType>();
                         tmp_hash_table->reserve(
                                 local_state._shared_state->valid_element_in_hash_tbl);
+                        const auto& shared_state = *local_state._shared_state;
                         while (iter != iter_end) {
-                            auto& mapped = iter->get_second();
-                            auto* it = &mapped;
-
-                            if constexpr (is_intersect) {
-                                if (it->visited) {
-                                    it->visited = false;
-                                    tmp_hash_table->insert(iter->get_first(), iter->get_second());
-                                }
-                            } else {
-                                if (!it->visited) {
-                                    tmp_hash_table->insert(iter->get_first(), iter->get_second());
-                                }
+                            uint32_t row = iter->get_second().row_num;
+                            bool keep = is_intersect ? shared_state.alive_rows.test(row)
+                                                     : !shared_state.visited_rows.test(row);
+                            if (keep) {
+                                tmp_hash_table->insert(iter->get_first(), iter->get_second());
                             }
                             ++iter;
                         }
                         arg.hash_table = std::move(tmp_hash_table);
-                    } else if (is_intersect) {
-                        while (iter != iter_end) {
-                            auto& mapped = iter->get_second();
-                            auto* it = &mapped;
-                            it->visited = false;
-                            ++iter;
-                        }
                     }
 
                     arg.reset();
@@ -50,6 +50,8 @@ public:
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
     int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
+    SetRowBitmap* visited_rows() { return &_shared_state->visited_rows; }
+    SetRowBitmap* alive_rows() { return &_shared_state->alive_rows; }
 
 private:
     friend class SetProbeSinkOperatorX<is_intersect>;
@@ -57,7 +57,11 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
         local_state._mutable_block.clear();
 
         if (eos) {
+            // a build block of constants is built as one row
+            size_t build_rows = std::max<size_t>(build_block.rows(), 1);
+            local_state._shared_state->visited_rows.reset(build_rows, false);
             if constexpr (is_intersect) {
+                local_state._shared_state->alive_rows.reset(build_rows, true);
                 valid_element_in_hash_tbl = 0;
             } else {
                 std::visit(
@@ -128,13 +128,14 @@ Status SetSourceOperatorX<is_intersect>::_get_data_in_hashtable(
     auto block_size = 0;
 
     auto add_result = [&local_state, &block_size, this](auto value) {
-        auto* it = &value;
         if constexpr (is_intersect) {
-            if (it->visited) { //intersected: have done probe, so visited values it's the result
+            //intersected: rows matched by every probe child are the result
+            if (local_state._shared_state->alive_rows.test(value.row_num)) {
                 _add_result_columns(local_state, value, block_size);
             }
         } else {
-            if (!it->visited) { //except: haven't visited values it's the needed result
+            //except: rows matched by no probe child are the result
+            if (!local_state._shared_state->visited_rows.test(value.row_num)) {
                 _add_result_columns(local_state, value, block_size);
             }
         }
@@ -147,8 +148,8 @@ Status SetSourceOperatorX<is_intersect>::_get_data_in_hashtable(
 
     *eos = iter == hash_table_ctx.hash_table->end();
     if (*eos && hash_table_ctx.hash_table->has_null_key_data()) {
-        auto value = hash_table_ctx.hash_table->template get_null_key_data<RowRefWithFlag>();
-        if constexpr (std::is_same_v<RowRefWithFlag, std::decay_t<decltype(value)>>) {
+        auto value = hash_table_ctx.hash_table->template get_null_key_data<SetRowRef>();
+        if constexpr (std::is_same_v<SetRowRef, std::decay_t<decltype(value)>>) {
             add_result(value);
         }
     }
@@ -168,7 +169,7 @@ Status SetSourceOperatorX<is_intersect>::_get_data_in_hashtable(
 
 template <bool is_intersect>
 void SetSourceOperatorX<is_intersect>::_add_result_columns(
-        SetSourceLocalState<is_intersect>& local_state, RowRefWithFlag& value, int& block_size) {
+        SetSourceLocalState<is_intersect>& local_state, SetRowRef& value, int& block_size) {
     auto& build_col_idx = local_state._shared_state->build_col_idx;
     auto& build_block = local_state._shared_state->build_block;
 
@@ -87,7 +87,7 @@ private:
                                   HashTableContext& hash_table_ctx, vectorized::Block* output_block,
                                   const int batch_size, bool* eos);
 
-    void _add_result_columns(SetSourceLocalState<is_intersect>& local_state, RowRefWithFlag& value,
+    void _add_result_columns(SetSourceLocalState<is_intersect>& local_state, SetRowRef& value,
                              int& block_size);
     const size_t _child_quantity;
 };
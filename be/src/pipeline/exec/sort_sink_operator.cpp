@@ -125,11 +125,24 @@ Status SortSinkOperatorX::open(RuntimeState* state) {
 Status SortSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_block, bool eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
-    COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
+    if (!local_state.resuming_block()) {
+        COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
+    }
     if (in_block->rows() > 0) {
         {
             SCOPED_TIMER(local_state._append_blocks_timer);
-            RETURN_IF_ERROR(local_state._shared_state->sorter->append_block(in_block));
+            // appending a large block may trigger sorting the whole buffered data, so it is
+            // done slice by slice to be able to yield
+            bool finished = false;
+            RETURN_IF_ERROR(local_state.process_block_yieldable(
+                    state, in_block,
+                    [&](vectorized::Block* block) {
+                        return local_state._shared_state->sorter->append_block(block);
+                    },
+                    &finished));
+            if (!finished) {
+                return Status::OK();
+            }
         }
         int64_t data_size = local_state._shared_state->sorter->data_size();
         COUNTER_SET(local_state._sort_blocks_memory_usage, data_size);
@@ -140,6 +140,10 @@ size_t SpillSortSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
     return _sort_sink_operator->get_revocable_mem_size(local_state._runtime_state.get());
 }
 
+size_t SpillSortSinkOperatorX::get_reserve_mem_size(RuntimeState* state) const {
+    return get_local_state(state)._reserve_mem_size;
+}
+
 Status SpillSortSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_block,
                                     bool eos) {
     auto& local_state = get_local_state(state);
@@ -153,7 +157,12 @@ Status SpillSortSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Bloc
     local_state._eos = eos;
     DBUG_EXECUTE_IF("fault_inject::spill_sort_sink::sink",
                     { return Status::InternalError("fault_inject spill_sort_sink sink failed"); });
+    const size_t mem_before =
+            _sort_sink_operator->get_revocable_mem_size(local_state._runtime_state.get());
     RETURN_IF_ERROR(_sort_sink_operator->sink(local_state._runtime_state.get(), in_block, false));
+    const size_t mem_after =
+            _sort_sink_operator->get_revocable_mem_size(local_state._runtime_state.get());
+    local_state._reserve_mem_size = mem_after > mem_before ? mem_after - mem_before : 0;
 
     int64_t data_size = local_state._shared_state->in_mem_shared_state->sorter->data_size();
     COUNTER_SET(local_state._sort_blocks_memory_usage, data_size);
@@ -24,6 +24,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -109,6 +110,8 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(profile(), "InsertKeysToColumnTime");
+    _pass_through_rows_counter = ADD_COUNTER(profile(), "PassThroughRows", TUnit::UNIT);
+    _agg_mode_switch_counter = ADD_COUNTER(profile(), "AggModeSwitchCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -595,6 +598,57 @@ size_t StreamingAggLocalState::_memory_usage() const {
     return usage;
 }
 
+double StreamingAggLocalState::_min_reduction_of_hash_table() {
+    return std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> double {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                        return 0.0;
+                    },
+                    [&](auto& agg_method) -> double {
+                        const auto ht_mem = agg_method.hash_table->get_buffer_size_in_bytes();
+                        int cache_level = 0;
+                        while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+                               ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+                            ++cache_level;
+                        }
+                        return STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+                    }},
+            _agg_data->method_variant);
+}
+
+void StreamingAggLocalState::_update_streaming_agg_mode(
+        const vectorized::ColumnRawPtrs& key_columns, size_t rows) {
+    _key_hashes.assign(rows, 0);
+    for (const auto* column : key_columns) {
+        column->update_hashes_with_value(_key_hashes.data());
+    }
+    for (auto hash : _key_hashes) {
+        _key_sketch.update(hash);
+    }
+    if (_input_num_rows < _next_mode_check_rows) {
+        return;
+    }
+    _next_mode_check_rows =
+            _input_num_rows + config::streaming_agg_cardinality_estimate_interval_rows;
+
+    // Unlike the reduction observed in the hash table, the estimated one also covers the rows
+    // passed through, so it tells whether aggregating again would pay off.
+    const auto ndv = std::max<int64_t>(_key_sketch.estimate_cardinality(), 1);
+    const double reduction = static_cast<double>(_input_num_rows) / static_cast<double>(ndv);
+    auto mode = StreamingAggMode::PASS_THROUGH;
+    if (reduction > _min_reduction_of_hash_table()) {
+        mode = StreamingAggMode::PRE_AGG;
+    } else if (reduction > config::streaming_agg_partial_pass_through_min_reduction) {
+        mode = StreamingAggMode::PARTIAL_PASS_THROUGH;
+    }
+    if (mode != _streaming_agg_mode) {
+        COUNTER_UPDATE(_agg_mode_switch_counter, 1);
+        _streaming_agg_mode = mode;
+    }
+    _should_expand_hash_table = mode == StreamingAggMode::PRE_AGG;
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -604,6 +658,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
 
     size_t key_size = _probe_expr_ctxs.size();
     vectorized::ColumnRawPtrs key_columns(key_size);
+    std::vector<int> key_column_ids(key_size);
     {
         SCOPED_TIMER(_expr_timer);
         for (size_t i = 0; i < key_size; ++i) {
@@ -613,106 +668,149 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block->get_by_position(result_column_id)
                             .column->convert_to_full_column_if_const();
             key_columns[i] = in_block->get_by_position(result_column_id).column.get();
+            key_column_ids[i] = result_column_id;
         }
     }
 
     size_t rows = in_block->rows();
     _places.resize(rows);
 
+    const bool estimate_cardinality = config::enable_streaming_agg_cardinality_estimate;
+    if (estimate_cardinality) {
+        _update_streaming_agg_mode(key_columns, rows);
+    }
+
     // Stop expanding hash tables if we're not reducing the input sufficiently. As our
     // hash tables expand out of each level of cache hierarchy, every hash table lookup
     // will take longer. We also may not be able to expand hash tables because of memory
     // pressure. In either case we should always use the remaining space in the hash table
     // to avoid wasting memory.
     // But for fixed hash map, it never need to expand
-    bool ret_flag = false;
     const auto spill_streaming_agg_mem_limit =
             _parent->cast<StreamingAggOperatorX>()._spill_streaming_agg_mem_limit;
     const bool used_too_much_memory =
             spill_streaming_agg_mem_limit > 0 && _memory_usage() > spill_streaming_agg_mem_limit;
-    RETURN_IF_ERROR(std::visit(
-            vectorized::Overload {
-                    [&](std::monostate& arg) -> Status {
-                        return Status::InternalError("Uninited hash table");
-                    },
-                    [&](auto& agg_method) -> Status {
-                        auto& hash_tbl = *agg_method.hash_table;
-                        /// If too much memory is used during the pre-aggregation stage,
-                        /// it is better to output the data directly without performing further aggregation.
-                        // do not try to do agg, just init and serialize directly return the out_block
-                        if (used_too_much_memory || (hash_tbl.add_elem_size_overflow(rows) &&
-                                                     !_should_expand_preagg_hash_tables())) {
-                            SCOPED_TIMER(_streaming_agg_timer);
-                            ret_flag = true;
-
-                            // will serialize value data to string column.
-                            // non-nullable column(id in `_make_nullable_keys`)
-                            // will be converted to nullable.
-                            bool mem_reuse =
-                                    p._make_nullable_keys.empty() && out_block->mem_reuse();
-
-                            std::vector<vectorized::DataTypePtr> data_types;
-                            vectorized::MutableColumns value_columns;
-                            for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
-                                auto data_type =
-                                        _aggregate_evaluators[i]->function()->get_serialized_type();
-                                if (mem_reuse) {
-                                    value_columns.emplace_back(
-                                            std::move(*out_block->get_by_position(i + key_size)
-                                                               .column)
-                                                    .mutate());
-                                } else {
-                                    // slot type of value it should always be string type
-                                    value_columns.emplace_back(_aggregate_evaluators[i]
-                                                                       ->function()
-                                                                       ->create_serialize_column());
-                                }
-                                data_types.emplace_back(data_type);
-                            }
+    /// If too much memory is used during the pre-aggregation stage,
+    /// it is better to output the data directly without performing further aggregation.
+    bool pass_through = used_too_much_memory;
+    if (!pass_through && estimate_cardinality) {
+        pass_through = _streaming_agg_mode == StreamingAggMode::PASS_THROUGH;
+    } else if (!pass_through) {
+        pass_through = std::visit(
+                vectorized::Overload {[&](std::monostate& arg) -> bool {
+                                          throw doris::Exception(ErrorCode::INTERNAL_ERROR,
+                                                                 "uninited hash table");
+                                          return false;
+                                      },
+                                      [&](auto& agg_method) -> bool {
+                                          return agg_method.hash_table->add_elem_size_overflow(
+                                                         rows) &&
+                                                 !_should_expand_preagg_hash_tables();
+                                      }},
+                _agg_data->method_variant);
+    }
 
-                            for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
-                                SCOPED_TIMER(_insert_values_to_column_timer);
-                                RETURN_IF_ERROR(
-                                        _aggregate_evaluators[i]->streaming_agg_serialize_to_column(
-                                                in_block, value_columns[i], rows,
-                                                _agg_arena_pool.get()));
-                            }
+    if (pass_through) {
+        // do not try to do agg, just init and serialize directly return the out_block
+        return _pass_through_with_serialized_key(in_block, key_columns, rows, out_block);
+    }
+    if (estimate_cardinality && _streaming_agg_mode == StreamingAggMode::PARTIAL_PASS_THROUGH) {
+        return _partial_pass_through_with_serialized_key(in_block, key_column_ids, key_columns,
+                                                         rows, out_block);
+    }
 
-                            if (!mem_reuse) {
-                                vectorized::ColumnsWithTypeAndName columns_with_schema;
-                                for (int i = 0; i < key_size; ++i) {
-                                    columns_with_schema.emplace_back(
-                                            key_columns[i]->clone_resized(rows),
-                                            _probe_expr_ctxs[i]->root()->data_type(),
-                                            _probe_expr_ctxs[i]->root()->expr_name());
-                                }
-                                for (int i = 0; i < value_columns.size(); ++i) {
-                                    columns_with_schema.emplace_back(std::move(value_columns[i]),
-                                                                     data_types[i], "");
-                                }
-                                out_block->swap(vectorized::Block(columns_with_schema));
-                            } else {
-                                for (int i = 0; i < key_size; ++i) {
-                                    std::move(*out_block->get_by_position(i).column)
-                                            .mutate()
-                                            ->insert_range_from(*key_columns[i], 0, rows);
-                                }
-                            }
-                        }
-                        return Status::OK();
-                    }},
-            _agg_data->method_variant));
+    _emplace_into_hash_table(_places.data(), key_columns, rows);
 
-    if (!ret_flag) {
-        _emplace_into_hash_table(_places.data(), key_columns, rows);
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
+                in_block, p._offsets_of_aggregate_states[i], _places.data(),
+                _agg_arena_pool.get(), _should_expand_hash_table));
+    }
 
-        for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
-            RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add(
-                    in_block, p._offsets_of_aggregate_states[i], _places.data(),
-                    _agg_arena_pool.get(), _should_expand_hash_table));
+    return Status::OK();
+}
+
+Status StreamingAggLocalState::_partial_pass_through_with_serialized_key(
+        vectorized::Block* in_block, const std::vector<int>& key_column_ids,
+        vectorized::ColumnRawPtrs& key_columns, size_t rows, vectorized::Block* out_block) {
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    _find_in_hash_table(_places.data(), key_columns, rows);
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->execute_batch_add_selected(
+                in_block, p._offsets_of_aggregate_states[i], _places.data(),
+                _agg_arena_pool.get()));
+    }
+
+    vectorized::IColumn::Filter miss_filter(rows);
+    size_t miss_rows = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        miss_filter[i] = _places[i] == nullptr;
+        miss_rows += miss_filter[i];
+    }
+    if (miss_rows == 0) {
+        return Status::OK();
+    }
+    if (miss_rows < rows) {
+        vectorized::Block::filter_block_internal(in_block, miss_filter);
+        for (size_t i = 0; i < key_columns.size(); ++i) {
+            key_columns[i] = in_block->get_by_position(key_column_ids[i]).column.get();
+        }
+    }
+    return _pass_through_with_serialized_key(in_block, key_columns, miss_rows, out_block);
+}
+
+Status StreamingAggLocalState::_pass_through_with_serialized_key(
+        vectorized::Block* in_block, const vectorized::ColumnRawPtrs& key_columns, size_t rows,
+        vectorized::Block* out_block) {
+    SCOPED_TIMER(_streaming_agg_timer);
+    COUNTER_UPDATE(_pass_through_rows_counter, rows);
+    auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
+    const size_t key_size = key_columns.size();
+
+    // will serialize value data to string column.
+    // non-nullable column(id in `_make_nullable_keys`)
+    // will be converted to nullable.
+    bool mem_reuse = p._make_nullable_keys.empty() && out_block->mem_reuse();
+
+    std::vector<vectorized::DataTypePtr> data_types;
+    vectorized::MutableColumns value_columns;
+    for (int i = 0; i < _aggregate_evaluators.size(); ++i) {
+        auto data_type = _aggregate_evaluators[i]->function()->get_serialized_type();
+        if (mem_reuse) {
+            value_columns.emplace_back(
+                    std::move(*out_block->get_by_position(i + key_size).column).mutate());
+        } else {
+            // slot type of value it should always be string type
+            value_columns.emplace_back(
+                    _aggregate_evaluators[i]->function()->create_serialize_column());
         }
+        data_types.emplace_back(data_type);
     }
 
+    for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
+        SCOPED_TIMER(_insert_values_to_column_timer);
+        RETURN_IF_ERROR(_aggregate_evaluators[i]->streaming_agg_serialize_to_column(
+                in_block, value_columns[i], rows, _agg_arena_pool.get()));
+    }
+
+    if (!mem_reuse) {
+        vectorized::ColumnsWithTypeAndName columns_with_schema;
+        for (int i = 0; i < key_size; ++i) {
+            columns_with_schema.emplace_back(key_columns[i]->clone_resized(rows),
+                                             _probe_expr_ctxs[i]->root()->data_type(),
+                                             _probe_expr_ctxs[i]->root()->expr_name());
+        }
+        for (int i = 0; i < value_columns.size(); ++i) {
+            columns_with_schema.emplace_back(std::move(value_columns[i]), data_types[i], "");
+        }
+        out_block->swap(vectorized::Block(columns_with_schema));
+    } else {
+        for (int i = 0; i < key_size; ++i) {
+            std::move(*out_block->get_by_position(i).column)
+                    .mutate()
+                    ->insert_range_from(*key_columns[i], 0, rows);
+        }
+    }
     return Status::OK();
 }
 
@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "common/status.h"
+#include "olap/hll.h"
 #include "pipeline/exec/operator.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
@@ -53,10 +54,29 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    // How the rows of a block are handled when the key cardinality is estimated.
+    enum class StreamingAggMode {
+        // emplace every row into the hash table
+        PRE_AGG,
+        // aggregate the rows whose keys are already in the hash table, pass the others through
+        PARTIAL_PASS_THROUGH,
+        // serialize every row to the output without touching the hash table
+        PASS_THROUGH,
+    };
+
     size_t _memory_usage() const;
     Status _pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                         doris::vectorized::Block* out_block);
+    Status _pass_through_with_serialized_key(vectorized::Block* in_block,
+                                             const vectorized::ColumnRawPtrs& key_columns,
+                                             size_t rows, vectorized::Block* out_block);
+    Status _partial_pass_through_with_serialized_key(vectorized::Block* in_block,
+                                                     const std::vector<int>& key_column_ids,
+                                                     vectorized::ColumnRawPtrs& key_columns,
+                                                     size_t rows, vectorized::Block* out_block);
     bool _should_expand_preagg_hash_tables();
+    double _min_reduction_of_hash_table();
+    void _update_streaming_agg_mode(const vectorized::ColumnRawPtrs& key_columns, size_t rows);
     void _make_nullable_output_key(vectorized::Block* block);
     Status _execute_without_key(vectorized::Block* block);
     Status _merge_without_key(vectorized::Block* block);
@@ -99,6 +119,8 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _pass_through_rows_counter = nullptr;
+    RuntimeProfile::Counter* _agg_mode_switch_counter = nullptr;
 
     bool _should_expand_hash_table = true;
     int64_t _cur_num_rows_returned = 0;
@@ -113,6 +135,13 @@ private:
     bool _reach_limit = false;
     size_t _input_num_rows = 0;
 
+    // Sketch of the keys of all input rows, including the passed through ones, so the
+    // aggregation can be re-enabled when the reduction improves later.
+    HyperLogLog _key_sketch;
+    std::vector<uint64_t> _key_hashes;
+    size_t _next_mode_check_rows = 0;
+    StreamingAggMode _streaming_agg_mode = StreamingAggMode::PRE_AGG;
+
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
 
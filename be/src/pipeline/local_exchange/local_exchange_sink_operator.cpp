@@ -32,6 +32,10 @@ std::vector<Dependency*> LocalExchangeSinkLocalState::dependencies() const {
     if (dep != nullptr) {
         deps.push_back(dep);
     }
+    auto* exchanger_dep = _shared_state->exchanger->sink_dependency();
+    if (exchanger_dep != nullptr) {
+        deps.push_back(exchanger_dep);
+    }
     return deps;
 }
 
@@ -110,6 +114,9 @@ Status LocalExchangeSinkLocalState::open(RuntimeState* state) {
         auto& p = _parent->cast<LocalExchangeSinkOperatorX>();
         RETURN_IF_ERROR(p._partitioner->clone(state, _partitioner));
     }
+    if (dynamic_cast<HotKeySplitShuffleExchanger*>(_exchanger) != nullptr) {
+        _hot_key_rows_counter = ADD_COUNTER(profile(), "HotKeyRows", TUnit::UNIT);
+    }
 
     return Status::OK();
 }
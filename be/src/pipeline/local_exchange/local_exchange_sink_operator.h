@@ -56,6 +56,7 @@ private:
     friend class PassToOneExchanger;
     friend class LocalMergeSortExchanger;
     friend class AdaptivePassthroughExchanger;
+    friend class HotKeySplitShuffleExchanger;
     template <typename BlockType>
     friend class Exchanger;
 
@@ -64,6 +65,8 @@ private:
     // Used by shuffle exchanger
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
+    // Used by hot key split shuffle exchanger
+    RuntimeProfile::Counter* _hot_key_rows_counter = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
 
     // Used by random passthrough exchanger
@@ -35,6 +35,11 @@ Status LocalExchangeSourceLocalState::init(RuntimeState* state, LocalStateInfo&
         _exchanger->get_type() == ExchangeType::BUCKET_HASH_SHUFFLE) {
         _copy_data_timer = ADD_TIMER(profile(), "CopyDataTime");
     }
+    if (_exchanger->get_type() == ExchangeType::HASH_SHUFFLE ||
+        _exchanger->get_type() == ExchangeType::BUCKET_HASH_SHUFFLE ||
+        _exchanger->get_type() == ExchangeType::BROADCAST) {
+        _zero_copy_blocks_counter = ADD_COUNTER(profile(), "ZeroCopyBlocks", TUnit::UNIT);
+    }
 
     if (_exchanger->get_type() == ExchangeType::LOCAL_MERGE_SORT && _channel_id == 0) {
         _local_merge_deps = _shared_state->get_dep_by_channel_id(_channel_id);
@@ -117,7 +122,8 @@ Status LocalExchangeSourceOperatorX::get_block(RuntimeState* state, vectorized::
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
     RETURN_IF_ERROR(local_state._exchanger->get_block(
-            state, block, eos, {nullptr, nullptr, local_state._copy_data_timer},
+            state, block, eos,
+            {nullptr, nullptr, local_state._copy_data_timer, local_state._zero_copy_blocks_counter},
             {local_state._channel_id, &local_state}));
     local_state.reached_limit(block, eos);
     return Status::OK();
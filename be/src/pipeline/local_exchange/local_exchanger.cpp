@@ -17,7 +17,10 @@
 
 #include "pipeline/local_exchange/local_exchanger.h"
 
+#include <numeric>
+
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/sort_sink_operator.h"
 #include "pipeline/exec/sort_source_operator.h"
@@ -148,6 +151,24 @@ bool Exchanger<BlockType>::_dequeue_data(BlockType& block, bool* eos, vectorized
     return false;
 }
 
+// Hands the data block of `wrapper` over to `block` without copying, if the consumer needs all
+// rows of it in order and holds the last reference, so no other consumer can read it any more.
+static bool take_whole_block(const BlockWrapperSPtr& wrapper, size_t offset_start, size_t length,
+                             vectorized::Block* block, const SourceInfo& source_info) {
+    if (offset_start != 0 || length != wrapper->data_block.rows() || wrapper->ref_value() != 1) {
+        return false;
+    }
+    if (source_info.local_state == nullptr) {
+        block->swap(wrapper->data_block);
+        wrapper->unref();
+        return true;
+    }
+    const auto allocated_bytes = wrapper->data_block.allocated_bytes();
+    block->swap(wrapper->data_block);
+    wrapper->unref(source_info.local_state->_shared_state, allocated_bytes, source_info.channel_id);
+    return true;
+}
+
 Status ShuffleExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                               Profile&& profile, SinkInfo&& sink_info) {
     if (in_block->empty()) {
@@ -203,6 +224,13 @@ Status ShuffleExchanger::get_block(RuntimeState* state, vectorized::Block* block
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
         SCOPED_TIMER(profile.copy_data_timer);
+        // All rows of the block belong to this channel (e.g. skewed keys or passthrough mode of
+        // `SkewAdaptiveShuffleExchanger`), the row indexes are in order so take it directly.
+        if (take_whole_block(partitioned_block.first, partitioned_block.second.offset_start,
+                             partitioned_block.second.length, block, source_info)) {
+            COUNTER_UPDATE(profile.zero_copy_blocks_counter, 1);
+            return Status::OK();
+        }
         mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                 block, partitioned_block.first->data_block);
         RETURN_IF_ERROR(get_data());
@@ -220,11 +248,13 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     auto row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
     auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
     {
-        partition_rows_histogram.assign(_num_partitions + 1, 0);
+        // Rows with channel id `_num_partitions` are sent to all partitions (hot keys on the probe
+        // side of `HotKeySplitShuffleExchanger`).
+        partition_rows_histogram.assign(_num_partitions + 2, 0);
         for (int32_t i = 0; i < rows; ++i) {
             partition_rows_histogram[channel_ids[i]]++;
         }
-        for (int32_t i = 1; i <= _num_partitions; ++i) {
+        for (int32_t i = 1; i <= _num_partitions + 1; ++i) {
             partition_rows_histogram[i] += partition_rows_histogram[i - 1];
         }
         for (int32_t i = rows - 1; i >= 0; --i) {
@@ -258,7 +288,10 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
          */
         const auto& map = local_state->_parent->cast<LocalExchangeSinkOperatorX>()
                                   ._shuffle_idx_to_instance_idx;
-        new_block_wrapper->ref(cast_set<int>(map.size()));
+        const uint32_t broadcast_start = partition_rows_histogram[_num_partitions];
+        const uint32_t broadcast_size =
+                partition_rows_histogram[_num_partitions + 1] - broadcast_start;
+        new_block_wrapper->ref(cast_set<int>(map.size()) * (broadcast_size > 0 ? 2 : 1));
         for (const auto& it : map) {
             DCHECK(it.second >= 0 && it.second < _num_partitions)
                     << it.first << " : " << it.second << " " << _num_partitions;
@@ -270,6 +303,11 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
             } else {
                 new_block_wrapper->unref(local_state->_shared_state, channel_id);
             }
+            if (broadcast_size > 0) {
+                _enqueue_data_and_set_ready(
+                        it.second, local_state,
+                        {new_block_wrapper, {row_idx, broadcast_start, broadcast_size}});
+            }
         }
     } else {
         DCHECK(!bucket_seq_to_instance_idx.empty());
@@ -289,17 +327,195 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     return Status::OK();
 }
 
+Status SkewAdaptiveShuffleExchanger::sink(RuntimeState* state, vectorized::Block* in_block,
+                                          bool eos, Profile&& profile, SinkInfo&& sink_info) {
+    if (in_block->empty()) {
+        return Status::OK();
+    }
+    if (_is_pass_through) {
+        SCOPED_TIMER(profile.distribute_timer);
+        return _passthrough_sink(in_block, std::move(sink_info));
+    }
+    int channel_id = *sink_info.channel_id;
+    RETURN_IF_ERROR(ShuffleExchanger::sink(state, in_block, eos, std::move(profile),
+                                           std::move(sink_info)));
+    _sample_partition_rows(channel_id);
+    return Status::OK();
+}
+
+void SkewAdaptiveShuffleExchanger::_sample_partition_rows(int channel_id) {
+    const auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
+    if (partition_rows_histogram.size() != _num_partitions + 2) {
+        return;
+    }
+    // After `_split_rows`, `partition_rows_histogram[i]` is the start row of partition i.
+    for (int i = 0; i < _num_partitions; i++) {
+        _partition_rows[i] += partition_rows_histogram[i + 1] - partition_rows_histogram[i];
+    }
+    if (++_sampled_blocks != config::local_exchange_skew_sample_blocks) {
+        return;
+    }
+    int64_t total_rows = 0;
+    int64_t max_rows = 0;
+    for (const auto& rows : _partition_rows) {
+        total_rows += rows;
+        max_rows = std::max(max_rows, rows.load());
+    }
+    if (total_rows > 0 && _num_partitions > 1 &&
+        double(max_rows) * _num_partitions >
+                config::local_exchange_skew_ratio_threshold * double(total_rows)) {
+        _is_pass_through = true;
+    }
+}
+
+Status SkewAdaptiveShuffleExchanger::_passthrough_sink(vectorized::Block* block,
+                                                       SinkInfo&& sink_info) {
+    auto* local_state = sink_info.local_state;
+    const auto rows = cast_set<uint32_t>(block->rows());
+    auto row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
+    std::iota(row_idx->begin(), row_idx->end(), 0);
+
+    vectorized::Block data_block;
+    std::shared_ptr<BlockWrapper> new_block_wrapper;
+    if (_free_blocks.try_dequeue(data_block)) {
+        new_block_wrapper = BlockWrapper::create_shared(std::move(data_block));
+    } else {
+        new_block_wrapper = BlockWrapper::create_shared(block->clone_empty());
+    }
+    new_block_wrapper->data_block.swap(*block);
+
+    auto& next_source = _next_source[*sink_info.channel_id];
+    auto source_id = cast_set<int>(next_source++ % _num_sources);
+    new_block_wrapper->ref(1);
+    if (local_state == nullptr) {
+        _enqueue_data_and_set_ready(source_id, {new_block_wrapper, {row_idx, 0, rows}});
+        return Status::OK();
+    }
+    local_state->_shared_state->add_total_mem_usage(new_block_wrapper->data_block.allocated_bytes(),
+                                                    *sink_info.channel_id);
+    _enqueue_data_and_set_ready(source_id, local_state, {new_block_wrapper, {row_idx, 0, rows}});
+    return Status::OK();
+}
+
+void JoinHotKeyState::sample(const uint32_t* __restrict hash_values, size_t rows,
+                             int num_partitions) {
+    // Count rows of each key in this block first to hold the lock shortly.
+    phmap::flat_hash_map<uint32_t, uint64_t> key_rows;
+    for (size_t i = 0; i < rows; i++) {
+        key_rows[hash_values[i]]++;
+    }
+    std::unique_lock l(_lock);
+    if (decided()) {
+        return;
+    }
+    for (const auto& [hash_value, count] : key_rows) {
+        _top_keys.insert(hash_value, count);
+    }
+    _sampled_rows += rows;
+    if (++_sampled_blocks >= config::hash_join_hot_key_sample_blocks) {
+        l.unlock();
+        decide(num_partitions);
+    }
+}
+
+void JoinHotKeyState::decide(int num_partitions) {
+    {
+        std::unique_lock l(_lock);
+        if (decided()) {
+            return;
+        }
+        if (num_partitions > 1 && _sampled_rows > 0) {
+            const double threshold = config::hash_join_hot_key_ratio_threshold *
+                                     double(_sampled_rows) / num_partitions;
+            for (const auto& counter : _top_keys.top_k(HOT_KEY_CANDIDATES)) {
+                // `count - error` is the lower bound of rows of this key.
+                if (double(counter.count - counter.error) <= threshold) {
+                    break;
+                }
+                _hot_keys.insert(counter.key);
+            }
+        }
+        _top_keys.clear();
+        _decided.store(true, std::memory_order_release);
+    }
+    probe_dependency->set_ready();
+}
+
+Status HotKeySplitShuffleExchanger::sink(RuntimeState* state, vectorized::Block* in_block,
+                                         bool eos, Profile&& profile, SinkInfo&& sink_info) {
+    const int channel_id = *sink_info.channel_id;
+    if (!in_block->empty()) {
+        auto* partitioner = static_cast<vectorized::Crc32HashPartitioner<
+                vectorized::ShuffleChannelIds>*>(sink_info.partitioner);
+        {
+            SCOPED_TIMER(profile.compute_hash_value_timer);
+            partitioner->set_keep_hash_values(true);
+            RETURN_IF_ERROR(partitioner->do_partitioning(state, in_block));
+        }
+        SCOPED_TIMER(profile.distribute_timer);
+        const auto rows = in_block->rows();
+        const auto* hash_values = partitioner->hash_values().data();
+        const auto* channel_ids = partitioner->get_channel_ids().get<uint32_t>();
+        if (_is_build_side && !_hot_key_state->decided()) {
+            _hot_key_state->sample(hash_values, rows, _num_partitions);
+        } else if (_hot_key_state->decided() && _hot_key_state->has_hot_keys()) {
+            auto& channel_ids_with_hot_keys = _channel_ids[channel_id];
+            channel_ids_with_hot_keys.assign(channel_ids, channel_ids + rows);
+            if (auto hot_key_rows = _split_hot_keys(hash_values, rows, channel_id);
+                hot_key_rows > 0) {
+                if (sink_info.local_state != nullptr) {
+                    COUNTER_UPDATE(sink_info.local_state->_hot_key_rows_counter,
+                                   cast_set<int64_t>(hot_key_rows));
+                }
+                channel_ids = channel_ids_with_hot_keys.data();
+            }
+        }
+        RETURN_IF_ERROR(
+                _split_rows(state, channel_ids, in_block, channel_id, sink_info.local_state));
+    }
+    if (eos && _is_build_side && ++_eos_sink_operators == _num_senders) {
+        _hot_key_state->decide(_num_partitions);
+    }
+    return Status::OK();
+}
+
+size_t HotKeySplitShuffleExchanger::_split_hot_keys(const uint32_t* __restrict hash_values,
+                                                    size_t rows, int channel_id) {
+    auto* __restrict channel_ids = _channel_ids[channel_id].data();
+    auto& next_partition = _next_partition[channel_id];
+    size_t hot_key_rows = 0;
+    for (size_t i = 0; i < rows; i++) {
+        if (!_hot_key_state->is_hot(hash_values[i])) {
+            continue;
+        }
+        hot_key_rows++;
+        // Build rows of a hot key are spread over all partitions, and probe rows of it are sent
+        // to all partitions.
+        channel_ids[i] = _is_build_side ? next_partition++ % _num_partitions
+                                        : cast_set<uint32_t>(_num_partitions);
+    }
+    return hot_key_rows;
+}
+
+void HotKeySplitShuffleExchanger::close(SourceInfo&& source_info) {
+    // Do not block the probe side forever if the build side is finished early (e.g. cancelled).
+    if (_is_build_side) {
+        _hot_key_state->decide(_num_partitions);
+    }
+    ShuffleExchanger::close(std::move(source_info));
+}
+
 Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                                      vectorized::Block* block, int channel_id) {
     const auto rows = cast_set<int32_t>(block->rows());
     auto row_idx = std::make_shared<vectorized::PODArray<uint32_t>>(rows);
     auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
     {
-        partition_rows_histogram.assign(_num_partitions + 1, 0);
+        partition_rows_histogram.assign(_num_partitions + 2, 0);
         for (int32_t i = 0; i < rows; ++i) {
             partition_rows_histogram[channel_ids[i]]++;
         }
-        for (int32_t i = 1; i <= _num_partitions; ++i) {
+        for (int32_t i = 1; i <= _num_partitions + 1; ++i) {
             partition_rows_histogram[i] += partition_rows_histogram[i - 1];
         }
         for (int32_t i = rows - 1; i >= 0; --i) {
@@ -320,7 +536,9 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     if (new_block_wrapper->data_block.empty()) {
         return Status::OK();
     }
-    new_block_wrapper->ref(cast_set<int>(_num_partitions));
+    const uint32_t broadcast_start = partition_rows_histogram[_num_partitions];
+    const uint32_t broadcast_size = partition_rows_histogram[_num_partitions + 1] - broadcast_start;
+    new_block_wrapper->ref(cast_set<int>(_num_partitions) * (broadcast_size > 0 ? 2 : 1));
     for (int i = 0; i < _num_partitions; i++) {
         uint32_t start = partition_rows_histogram[i];
         uint32_t size = partition_rows_histogram[i + 1] - start;
@@ -329,6 +547,10 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
         } else {
             new_block_wrapper->unref();
         }
+        if (broadcast_size > 0) {
+            _enqueue_data_and_set_ready(
+                    i, {new_block_wrapper, {row_idx, broadcast_start, broadcast_size}});
+        }
     }
 
     return Status::OK();
@@ -540,6 +762,12 @@ Status BroadcastExchanger::get_block(RuntimeState* state, vectorized::Block* blo
     if (_dequeue_data(source_info.local_state, partitioned_block, eos, block,
                       source_info.channel_id)) {
         SCOPED_TIMER(profile.copy_data_timer);
+        // the last channel reading a broadcast block takes it without copying
+        if (take_whole_block(partitioned_block.first, partitioned_block.second.offset_start,
+                             partitioned_block.second.length, block, source_info)) {
+            COUNTER_UPDATE(profile.zero_copy_blocks_counter, 1);
+            return Status::OK();
+        }
         vectorized::MutableBlock mutable_block =
                 vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
                         block, partitioned_block.first->data_block);
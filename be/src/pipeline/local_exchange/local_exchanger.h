@@ -17,8 +17,11 @@
 
 #pragma once
 
+#include <parallel_hashmap/phmap.h>
+
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "vec/common/space_saving.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -35,6 +38,7 @@ struct Profile {
     RuntimeProfile::Counter* compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* distribute_timer = nullptr;
     RuntimeProfile::Counter* copy_data_timer = nullptr;
+    RuntimeProfile::Counter* zero_copy_blocks_counter = nullptr;
 };
 
 struct SinkInfo {
@@ -88,6 +92,8 @@ public:
     // Called if all local exchanger source operators are closed. We free the memory in
     // `_free_blocks` here.
     virtual void finalize();
+    // Sink operators are blocked by this dependency before sinking data into this exchanger.
+    virtual Dependency* sink_dependency() const { return nullptr; }
 
     virtual std::string data_queue_debug_string(int i) = 0;
 
@@ -268,6 +274,127 @@ protected:
     std::vector<std::vector<uint32_t>> _partition_rows_histogram;
 };
 
+// Used instead of `ShuffleExchanger` if the downstream operator only prefers hash distribution
+// (see `OperatorBase::tolerate_non_hash_distribution`). Rows of each partition are counted in the
+// first `local_exchange_skew_sample_blocks` blocks, and if the largest partition has more than
+// `local_exchange_skew_ratio_threshold` times the average rows, it switches to distributing whole
+// blocks round-robin, so that a few hot keys do not keep a single instance busy.
+class SkewAdaptiveShuffleExchanger final : public ShuffleExchanger {
+public:
+    ENABLE_FACTORY_CREATOR(SkewAdaptiveShuffleExchanger);
+    SkewAdaptiveShuffleExchanger(int running_sink_operators, int num_sources, int num_partitions,
+                                 int free_block_limit)
+            : ShuffleExchanger(running_sink_operators, num_sources, num_partitions,
+                               free_block_limit),
+              _partition_rows(num_partitions),
+              _next_source(running_sink_operators) {
+        for (int i = 0; i < running_sink_operators; i++) {
+            _next_source[i] = i;
+        }
+    }
+    ~SkewAdaptiveShuffleExchanger() override = default;
+    Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
+                SinkInfo&& sink_info) override;
+
+    bool is_pass_through() const { return _is_pass_through; }
+
+private:
+    void _sample_partition_rows(int channel_id);
+    Status _passthrough_sink(vectorized::Block* block, SinkInfo&& sink_info);
+
+    std::atomic_bool _is_pass_through = false;
+    std::atomic_int32_t _sampled_blocks = 0;
+    std::vector<std::atomic_int64_t> _partition_rows;
+    // next source to receive a block from each sink in passthrough mode
+    std::vector<uint32_t> _next_source;
+};
+
+/**
+ * `JoinHotKeyState` is shared by the two `HotKeySplitShuffleExchanger`s before the build side and
+ * the probe side of one shuffled hash join.
+ *
+ * The build side counts key hashes of the first `hash_join_hot_key_sample_blocks` blocks by
+ * `SpaceSaving`, and a key hash with more rows than `hash_join_hot_key_ratio_threshold` times the
+ * average rows of a partition is a hot key. After that, build rows of hot keys are distributed
+ * round-robin and probe rows of hot keys are sent to all instances, so each build row still meets
+ * all probe rows with the same key exactly once. The probe side is blocked until hot keys are
+ * decided.
+ */
+struct JoinHotKeyState {
+    ENABLE_FACTORY_CREATOR(JoinHotKeyState);
+    JoinHotKeyState(int node_id)
+            : probe_dependency(Dependency::create_shared(node_id, node_id, "JoinHotKeyDependency",
+                                                         false)) {}
+
+    // Called once all local exchanges of the fragment are planned. Hot keys are never split if
+    // either side of the join is not shuffled by local exchange.
+    void finish_planning() {
+        if (!has_build_side || !has_probe_side) {
+            decide(0);
+        }
+    }
+    void sample(const uint32_t* __restrict hash_values, size_t rows, int num_partitions);
+    void decide(int num_partitions);
+    bool decided() const { return _decided.load(std::memory_order_acquire); }
+    // Only valid if `decided()` returns true.
+    bool is_hot(uint32_t hash_value) const { return _hot_keys.contains(hash_value); }
+    bool has_hot_keys() const { return !_hot_keys.empty(); }
+
+    bool has_build_side = false;
+    bool has_probe_side = false;
+    std::shared_ptr<Dependency> probe_dependency;
+
+private:
+    // Candidates of hot keys tracked by `SpaceSaving`.
+    static constexpr size_t HOT_KEY_CANDIDATES = 256;
+
+    std::mutex _lock;
+    vectorized::SpaceSaving<uint32_t> _top_keys {HOT_KEY_CANDIDATES};
+    size_t _sampled_rows = 0;
+    int _sampled_blocks = 0;
+    std::atomic_bool _decided = false;
+    phmap::flat_hash_set<uint32_t> _hot_keys;
+};
+
+// Used instead of `ShuffleExchanger` before both sides of a shuffled hash join which supports
+// splitting hot keys (see `OperatorBase::can_split_hot_keys`), so the instance owning a hot key
+// does not build (and probably spill) a huge hash table alone.
+class HotKeySplitShuffleExchanger final : public ShuffleExchanger {
+public:
+    ENABLE_FACTORY_CREATOR(HotKeySplitShuffleExchanger);
+    HotKeySplitShuffleExchanger(std::shared_ptr<JoinHotKeyState> hot_key_state, bool is_build_side,
+                                int running_sink_operators, int num_sources, int num_partitions,
+                                int free_block_limit)
+            : ShuffleExchanger(running_sink_operators, num_sources, num_partitions,
+                               free_block_limit),
+              _hot_key_state(std::move(hot_key_state)),
+              _is_build_side(is_build_side),
+              _channel_ids(running_sink_operators),
+              _next_partition(running_sink_operators) {
+        for (int i = 0; i < running_sink_operators; i++) {
+            _next_partition[i] = i;
+        }
+    }
+    ~HotKeySplitShuffleExchanger() override = default;
+    Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
+                SinkInfo&& sink_info) override;
+    void close(SourceInfo&& source_info) override;
+    Dependency* sink_dependency() const override {
+        return _is_build_side ? nullptr : _hot_key_state->probe_dependency.get();
+    }
+
+private:
+    // Rewrite channel ids of hot key rows, returns the number of them.
+    size_t _split_hot_keys(const uint32_t* __restrict hash_values, size_t rows, int channel_id);
+
+    std::shared_ptr<JoinHotKeyState> _hot_key_state;
+    const bool _is_build_side;
+    std::atomic_int32_t _eos_sink_operators = 0;
+    std::vector<std::vector<uint32_t>> _channel_ids;
+    // next partition to receive a hot key row of build side from each sink
+    std::vector<uint32_t> _next_partition;
+};
+
 class BucketShuffleExchanger final : public ShuffleExchanger {
     ENABLE_FACTORY_CREATOR(BucketShuffleExchanger);
     BucketShuffleExchanger(int running_sink_operators, int num_sources, int num_partitions,
@@ -736,6 +736,15 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
     const bool followed_by_shuffled_operator =
             operators.size() > idx ? operators[idx]->followed_by_shuffled_operator()
                                    : cur_pipe->sink()->followed_by_shuffled_operator();
+    const bool tolerate_non_hash_distribution =
+            operators.size() > idx ? operators[idx]->tolerate_non_hash_distribution()
+                                   : cur_pipe->sink()->tolerate_non_hash_distribution();
+    const bool is_join_probe_side = operators.size() > idx;
+    const bool can_split_hot_keys = is_join_probe_side
+                                            ? operators[idx]->can_split_hot_keys()
+                                            : cur_pipe->sink()->can_split_hot_keys();
+    const int join_node_id =
+            is_join_probe_side ? operators[idx]->node_id() : cur_pipe->sink()->node_id();
     const bool use_global_hash_shuffle =
             bucket_seq_to_instance_idx.empty() &&
             shuffle_idx_to_instance_idx.find(-1) == shuffle_idx_to_instance_idx.end() &&
@@ -758,6 +767,35 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
                     : LocalExchangeSharedState::create_shared(_num_instances);
     switch (data_distribution.distribution_type) {
     case ExchangeType::HASH_SHUFFLE:
+        if (config::enable_hash_join_hot_key_split && !use_global_hash_shuffle &&
+            can_split_hot_keys) {
+            auto& hot_key_state = _join_hot_key_states[join_node_id];
+            if (hot_key_state == nullptr) {
+                hot_key_state = JoinHotKeyState::create_shared(join_node_id);
+            }
+            (is_join_probe_side ? hot_key_state->has_probe_side : hot_key_state->has_build_side) =
+                    true;
+            shared_state->exchanger = HotKeySplitShuffleExchanger::create_unique(
+                    hot_key_state, !is_join_probe_side,
+                    std::max(cur_pipe->num_tasks(), _num_instances), _num_instances,
+                    _num_instances,
+                    _runtime_state->query_options().__isset.local_exchange_free_blocks_limit
+                            ? cast_set<int>(_runtime_state->query_options()
+                                                    .local_exchange_free_blocks_limit)
+                            : 0);
+            break;
+        }
+        if (config::enable_local_exchange_skew_adaptive && !use_global_hash_shuffle &&
+            tolerate_non_hash_distribution) {
+            shared_state->exchanger = SkewAdaptiveShuffleExchanger::create_unique(
+                    std::max(cur_pipe->num_tasks(), _num_instances), _num_instances,
+                    _num_instances,
+                    _runtime_state->query_options().__isset.local_exchange_free_blocks_limit
+                            ? cast_set<int>(_runtime_state->query_options()
+                                                    .local_exchange_free_blocks_limit)
+                            : 0);
+            break;
+        }
         shared_state->exchanger = ShuffleExchanger::create_unique(
                 std::max(cur_pipe->num_tasks(), _num_instances), _num_instances,
                 use_global_hash_shuffle ? _total_instances : _num_instances,
@@ -967,6 +1005,9 @@ Status PipelineFragmentContext::_plan_local_exchange(
                                              bucket_seq_to_instance_idx,
                                              shuffle_idx_to_instance_idx));
     }
+    for (auto& it : _join_hot_key_states) {
+        it.second->finish_planning();
+    }
     return Status::OK();
 }
 
@@ -1818,6 +1859,16 @@ std::string PipelineFragmentContext::debug_string() {
     return fmt::to_string(debug_string_buffer);
 }
 
+std::string PipelineFragmentContext::memory_debug_string() {
+    fmt::memory_buffer debug_string_buffer;
+    for (const auto& instance_tasks : _tasks) {
+        for (const auto& task : instance_tasks) {
+            fmt::format_to(debug_string_buffer, "{}", task->memory_debug_string());
+        }
+    }
+    return fmt::to_string(debug_string_buffer);
+}
+
 std::vector<std::shared_ptr<TRuntimeProfileTree>>
 PipelineFragmentContext::collect_realtime_profile() const {
     std::vector<std::shared_ptr<TRuntimeProfileTree>> res;
@@ -50,6 +50,7 @@ class TPipelineFragmentParams;
 namespace pipeline {
 
 class Dependency;
+struct JoinHotKeyState;
 
 class PipelineFragmentContext : public TaskExecutionContext {
 public:
@@ -108,6 +109,7 @@ public:
     void refresh_next_report_time();
 
     std::string debug_string();
+    std::string memory_debug_string();
 
     [[nodiscard]] int next_operator_id() { return _operator_id--; }
 
@@ -273,6 +275,9 @@ private:
     int _sink_operator_id = 0;
     std::map<int, std::pair<std::shared_ptr<LocalExchangeSharedState>, std::shared_ptr<Dependency>>>
             _op_id_to_le_state;
+    // Hot key states shared by local exchanges of both sides of shuffled hash joins, keyed by
+    // join node id.
+    std::map<int, std::shared_ptr<JoinHotKeyState>> _join_hot_key_states;
 
     std::map<PipelineId, Pipeline*> _pip_id_to_pipeline;
     std::vector<std::unique_ptr<RuntimeFilterMgr>> _runtime_filter_mgr_map;
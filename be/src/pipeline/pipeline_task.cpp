@@ -17,6 +17,7 @@
 
 #include "pipeline_task.h"
 
+#include <bvar/reducer.h>
 #include <fmt/format.h>
 #include <gen_cpp/Metrics_types.h>
 #include <glog/logging.h>
@@ -36,6 +37,7 @@
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
 #include "util/container_util.hpp"
+#include "util/cpu_sampler.h"
 #include "util/defer_op.h"
 #include "util/mem_info.h"
 #include "util/runtime_profile.h"
@@ -46,6 +48,14 @@ class RuntimeState;
 
 namespace doris::pipeline {
 
+// the times pipeline tasks got blocked, by the kind of dependency which blocks them
+bvar::Adder<int64_t> g_pipeline_task_blocked_by_execution("pipeline_task_blocked_by", "execution");
+bvar::Adder<int64_t> g_pipeline_task_blocked_by_runtime_filter("pipeline_task_blocked_by",
+                                                               "runtime_filter");
+bvar::Adder<int64_t> g_pipeline_task_blocked_by_source("pipeline_task_blocked_by", "source");
+bvar::Adder<int64_t> g_pipeline_task_blocked_by_sink("pipeline_task_blocked_by", "sink");
+bvar::Adder<int64_t> g_pipeline_task_blocked_by_finish("pipeline_task_blocked_by", "finish");
+
 PipelineTask::PipelineTask(
         PipelinePtr& pipeline, uint32_t task_id, RuntimeState* state,
         PipelineFragmentContext* fragment_context, RuntimeProfile* parent_profile,
@@ -182,6 +192,8 @@ void PipelineTask::_init_profile() {
 
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
+    _memory_reserve_failed_times =
+            ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
 }
 
@@ -220,6 +232,7 @@ bool PipelineTask::_wait_to_start() {
     _blocked_dep = _execution_dep->is_blocked_by(this);
     if (_blocked_dep != nullptr) {
         static_cast<Dependency*>(_blocked_dep)->start_watcher();
+        g_pipeline_task_blocked_by_execution << 1;
         return true;
     }
 
@@ -227,6 +240,19 @@ bool PipelineTask::_wait_to_start() {
         _blocked_dep = op_dep->is_blocked_by(this);
         if (_blocked_dep != nullptr) {
             _blocked_dep->start_watcher();
+            g_pipeline_task_blocked_by_runtime_filter << 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PipelineTask::is_pending_finish() {
+    for (auto* fin_dep : _finish_dependencies) {
+        _blocked_dep = fin_dep->is_blocked_by(this);
+        if (_blocked_dep != nullptr) {
+            _blocked_dep->start_watcher();
+            g_pipeline_task_blocked_by_finish << 1;
             return true;
         }
     }
@@ -248,6 +274,7 @@ bool PipelineTask::_is_blocked() {
                 _blocked_dep = dep->is_blocked_by(this);
                 if (_blocked_dep != nullptr) {
                     _blocked_dep->start_watcher();
+                    g_pipeline_task_blocked_by_source << 1;
                     return true;
                 }
             }
@@ -267,6 +294,7 @@ bool PipelineTask::_is_blocked() {
         _blocked_dep = op_dep->is_blocked_by(this);
         if (_blocked_dep != nullptr) {
             _blocked_dep->start_watcher();
+            g_pipeline_task_blocked_by_sink << 1;
             return true;
         }
     }
@@ -282,8 +310,12 @@ Status PipelineTask::execute(bool* eos) {
     SCOPED_TIMER(_task_profile->total_time_counter());
     SCOPED_TIMER(_exec_timer);
     SCOPED_ATTACH_TASK(_state);
+    SCOPED_ATTRIBUTE_QUERY_CPU(query_context()->query_id());
+    DEFER_RELEASE_RESERVED();
 
     int64_t time_spent = 0;
+    _time_slice_watcher.start();
+    _time_slice_watcher.reset();
     DBUG_EXECUTE_IF("fault_inject::PipelineXTask::execute", {
         Status status = Status::Error<INTERNAL_ERROR>("fault_inject pipeline_task execute failed");
         return status;
@@ -291,6 +323,7 @@ Status PipelineTask::execute(bool* eos) {
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
     Defer defer {[&]() {
+        time_spent = _time_slice_watcher.elapsed_time();
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
@@ -338,50 +371,75 @@ Status PipelineTask::execute(bool* eos) {
             break;
         }
 
-        if (time_spent > THREAD_TIME_SLICE) {
+        if (should_yield()) {
             COUNTER_UPDATE(_yield_counts, 1);
             break;
         }
-        _block->clear_column_data(_root->row_desc().num_materialized_slots());
         auto* block = _block.get();
 
-        auto sink_revocable_mem_size = _sink->revocable_mem_size(_state);
-        if (should_revoke_memory(_state, sink_revocable_mem_size)) {
-            RETURN_IF_ERROR(_sink->revoke_memory(_state));
-            continue;
-        }
-        DBUG_EXECUTE_IF("fault_inject::PipelineXTask::executing", {
-            Status status =
-                    Status::Error<INTERNAL_ERROR>("fault_inject pipeline_task executing failed");
-            return status;
-        });
-        // `_sink->is_finished(_state)` means sink operator should be finished
-        if (_sink->is_finished(_state)) {
-            set_wake_up_and_dep_ready();
-        }
+        if (_sink_yielded) {
+            // resume the sink which yielded in the middle of `_block` last time
+            *eos = _sink_eos;
+        } else {
+            _block->clear_column_data(_root->row_desc().num_materialized_slots());
+
+            auto sink_revocable_mem_size = _sink->revocable_mem_size(_state);
+            if (should_revoke_memory(_state, sink_revocable_mem_size) ||
+                !_try_to_reserve_memory(_sink->get_reserve_mem_size(_state),
+                                        sink_revocable_mem_size)) {
+                RETURN_IF_ERROR(_sink->revoke_memory(_state));
+                continue;
+            }
+            DBUG_EXECUTE_IF("fault_inject::PipelineXTask::executing", {
+                Status status = Status::Error<INTERNAL_ERROR>(
+                        "fault_inject pipeline_task executing failed");
+                return status;
+            });
+            // `_sink->is_finished(_state)` means sink operator should be finished
+            if (_sink->is_finished(_state)) {
+                set_wake_up_and_dep_ready();
+            }
 
-        // `_dry_run` means sink operator need no more data
-        *eos = wake_up_early() || _dry_run;
-        if (!*eos) {
-            SCOPED_TIMER(_get_block_timer);
-            _get_block_counter->update(1);
-            RETURN_IF_ERROR(_root->get_block_after_projects(_state, block, eos));
-        }
+            // `_dry_run` means sink operator need no more data
+            *eos = wake_up_early() || _dry_run;
+            if (!*eos) {
+                SCOPED_TIMER(_get_block_timer);
+                _get_block_counter->update(1);
+                RETURN_IF_ERROR(_root->get_block_after_projects(_state, block, eos));
+            }
 
-        if (*eos) {
-            RETURN_IF_ERROR(close(Status::OK(), false));
+            if (*eos) {
+                RETURN_IF_ERROR(close(Status::OK(), false));
+            }
         }
 
         if (_block->rows() != 0 || *eos) {
             SCOPED_TIMER(_sink_timer);
-            Status status = _sink->sink(_state, block, *eos);
+            _sink_yielded = false;
+            auto* sink_local_state = _state->get_sink_local_state();
+            Status status;
+            {
+                SCOPED_ATTRIBUTE_OPERATOR_MEMORY(sink_local_state->attributed_mem_counter());
+                SCOPED_ATTRIBUTE_OPERATOR_CPU(_sink->operator_id());
+                status = _sink->sink(_state, block, *eos);
+            }
+            sink_local_state->update_attributed_mem_counters();
+            thread_context()->release_reserved_memory();
 
             if (status.is<ErrorCode::END_OF_FILE>()) {
+                _sink_yielded = false;
                 set_wake_up_and_dep_ready();
             } else if (!status) {
                 return status;
             }
 
+            if (_sink_yielded) {
+                _sink_eos = *eos;
+                *eos = false;
+                COUNTER_UPDATE(_yield_counts, 1);
+                break;
+            }
+
             if (*eos) { // just return, the scheduler will do finish work
                 _task_profile->add_info_string("TaskState", "Finished");
                 _eos = true;
@@ -451,6 +509,22 @@ bool PipelineTask::should_revoke_memory(RuntimeState* state, int64_t revocable_m
     }
 }
 
+bool PipelineTask::_try_to_reserve_memory(size_t reserve_size, size_t revocable_mem_size) {
+    if (reserve_size == 0) {
+        return true;
+    }
+    auto st = thread_context()->try_reserve_memory(reserve_size);
+    if (st.ok()) {
+        return true;
+    }
+    COUNTER_UPDATE(_memory_reserve_failed_times, 1);
+    VLOG_DEBUG << "query " << print_id(_state->query_id()) << " task " << _index
+               << " reserve memory failed, revocable_mem_bytes: "
+               << PrettyPrinter::print_bytes(revocable_mem_size) << ", " << st.msg();
+    // Spill before allocating. If too little is revocable, go on and leave it to memory limits.
+    return revocable_mem_size < static_cast<size_t>(_state->min_revocable_mem());
+}
+
 void PipelineTask::finalize() {
     std::unique_lock<std::mutex> lc(_dependency_lock);
     _finalized = true;
@@ -490,6 +564,26 @@ Status PipelineTask::close(Status exec_status, bool close_sink) {
     return s;
 }
 
+std::string PipelineTask::memory_debug_string() {
+    std::unique_lock<std::mutex> lc(_dependency_lock);
+    fmt::memory_buffer debug_string_buffer;
+    fmt::format_to(debug_string_buffer, "PipelineTask[id = {}, instance = {}]", _index,
+                   print_id(_state->fragment_instance_id()));
+    if (!_opened || _finalized) {
+        fmt::format_to(debug_string_buffer, " not running\n");
+        return fmt::to_string(debug_string_buffer);
+    }
+    for (auto& op : _operators) {
+        fmt::format_to(debug_string_buffer, "\n  {}(id={}): {}", op->get_name(), op->operator_id(),
+                       _state->get_local_state(op->operator_id())
+                               ->attributed_mem_counter()
+                               ->debug_string());
+    }
+    fmt::format_to(debug_string_buffer, "\n  {}: {}\n", _sink->get_name(),
+                   _state->get_sink_local_state()->attributed_mem_counter()->debug_string());
+    return fmt::to_string(debug_string_buffer);
+}
+
 std::string PipelineTask::debug_string() {
     std::unique_lock<std::mutex> lc(_dependency_lock);
     fmt::memory_buffer debug_string_buffer;
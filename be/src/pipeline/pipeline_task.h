@@ -81,17 +81,10 @@ public:
     void finalize();
 
     std::string debug_string();
+    // Memory attributed to each operator of the task, see SCOPED_ATTRIBUTE_OPERATOR_MEMORY.
+    std::string memory_debug_string();
 
-    bool is_pending_finish() {
-        for (auto* fin_dep : _finish_dependencies) {
-            _blocked_dep = fin_dep->is_blocked_by(this);
-            if (_blocked_dep != nullptr) {
-                _blocked_dep->start_watcher();
-                return true;
-            }
-        }
-        return false;
-    }
+    bool is_pending_finish();
 
     std::shared_ptr<BasicSharedState> get_source_shared_state() {
         return _op_shared_states.contains(_source->operator_id())
@@ -163,6 +156,14 @@ public:
 
     static constexpr auto THREAD_TIME_SLICE = 100'000'000ULL;
 
+    // Yield point for operators doing heavy work in one call. Returns true if the task has
+    // used up its time slice, then the operator should save its progress and yield.
+    bool should_yield() const { return _time_slice_watcher.elapsed_time() > THREAD_TIME_SLICE; }
+
+    // Called by the sink which yields in the middle of a block, the task will be rescheduled
+    // and call `sink` again with the same block instead of pulling a new one.
+    void yield_sink() { _sink_yielded = true; }
+
     // 1 used for update priority queue
     // note(wb) an ugly implementation, need refactor later
     // 1.1 pipeline task
@@ -183,11 +184,17 @@ public:
 
     void put_in_runnable_queue() {
         _schedule_time++;
+        _wait_worker_ns_before_queued = _wait_worker_watcher.elapsed_time();
         _wait_worker_watcher.start();
     }
 
     void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
 
+    // Time the task waited in the runnable queue before it was taken the last time.
+    uint64_t last_wait_worker_ns() const {
+        return _wait_worker_watcher.elapsed_time() - _wait_worker_ns_before_queued;
+    }
+
     bool is_running() { return _running.load(); }
     void set_running(bool running) { _running = running; }
 
@@ -241,6 +248,9 @@ private:
     Status _extract_dependencies();
     void _init_profile();
     void _fresh_profile_counter();
+    // Reserve the memory the sink expects to allocate for the next block. Return false if the
+    // reservation is denied and the sink should revoke memory first.
+    bool _try_to_reserve_memory(size_t reserve_size, size_t revocable_mem_size);
     Status _open();
 
     uint32_t _index;
@@ -276,12 +286,19 @@ private:
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _schedule_counts = nullptr;
     MonotonicStopWatch _wait_worker_watcher;
+    uint64_t _wait_worker_ns_before_queued = 0;
     RuntimeProfile::Counter* _wait_worker_timer = nullptr;
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
+    RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
 
     MonotonicStopWatch _pipeline_task_watcher;
+    // time spent in the current `execute` call
+    MonotonicStopWatch _time_slice_watcher;
+    // the sink yielded in the middle of `_block`, which must be sinked again with `_sink_eos`
+    bool _sink_yielded = false;
+    bool _sink_eos = false;
 
     Operators _operators; // left is _source, right is _root
     OperatorXBase* _source;
@@ -17,8 +17,39 @@
 
 #include "query_cache.h"
 
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+#include "olap/base_tablet.h"
+#include "olap/rowset/rowset.h"
+
 namespace doris {
 
+namespace {
+
+bool has_no_new_data(int64_t tablet_id, int64_t from_version, int64_t to_version) {
+    auto tablet = ExecEnv::get_tablet(tablet_id);
+    if (!tablet.has_value()) {
+        return false;
+    }
+    std::vector<RowsetSharedPtr> rowsets;
+    {
+        std::shared_lock rlock(tablet.value()->get_header_lock());
+        // fails if compaction already merged the new versions with the cached ones
+        if (!tablet.value()
+                     ->capture_consistent_rowsets_unlocked({from_version, to_version}, &rowsets)
+                     .ok()) {
+            return false;
+        }
+    }
+    return std::all_of(rowsets.begin(), rowsets.end(), [](const RowsetSharedPtr& rowset) {
+        return rowset->num_rows() == 0 && !rowset->rowset_meta()->has_delete_predicate();
+    });
+}
+
+} // namespace
+
 std::vector<int>* QueryCacheHandle::get_cache_slot_orders() {
     DCHECK(_handle);
     auto result_ptr = reinterpret_cast<LRUHandle*>(_handle)->value;
@@ -66,4 +97,20 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+bool QueryCache::lookup(const CacheKey& key, int64_t version, int64_t tablet_id,
+                        QueryCacheHandle* handle) {
+    SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
+    auto* lru_handle = LRUCachePolicy::lookup(key);
+    if (lru_handle) {
+        QueryCacheHandle tmp_handle(this, lru_handle);
+        int64_t cache_version = tmp_handle.get_cache_version();
+        if (cache_version == version ||
+            (cache_version < version && has_no_new_data(tablet_id, cache_version + 1, version))) {
+            *handle = std::move(tmp_handle);
+            return true;
+        }
+    }
+    return false;
+}
+
 } // namespace doris
@@ -146,6 +146,12 @@ public:
 
     bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
 
+    // Same as lookup(), but also returns an entry cached at an older version of the tablet if
+    // every rowset added since then is empty and has no delete predicate, e.g. the versions
+    // published to all tablets of a partition by loads that wrote no row into this one.
+    bool lookup(const CacheKey& key, int64_t version, int64_t tablet_id,
+                QueryCacheHandle* handle);
+
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
 };
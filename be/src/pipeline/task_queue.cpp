@@ -18,13 +18,17 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/time.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -130,10 +134,172 @@ Status PriorityTaskQueue::push(PipelineTask* task) {
     return Status::OK();
 }
 
+////////////////////  LockFreePriorityTaskQueue ////////////////////
+
+PipelineTask* LockFreeSubTaskQueue::try_take(bool is_steal) {
+    PipelineTask* task = nullptr;
+    if (!_queue.try_dequeue(task)) {
+        return nullptr;
+    }
+    _size--;
+    return task;
+}
+
+LockFreePriorityTaskQueue::LockFreePriorityTaskQueue() : _closed(false) {
+    double factor = 1;
+    for (int i = SUB_QUEUE_LEVEL - 1; i >= 0; i--) {
+        _sub_queues[i].set_level_factor(factor);
+        factor *= LEVEL_QUEUE_TIME_FACTOR;
+    }
+}
+
+void LockFreePriorityTaskQueue::close() {
+    std::unique_lock<std::mutex> lock(_wait_mutex);
+    _closed = true;
+    _wait_task.notify_all();
+}
+
+int LockFreePriorityTaskQueue::_compute_level(uint64_t runtime) {
+    for (int i = 0; i < SUB_QUEUE_LEVEL - 1; ++i) {
+        if (runtime <= _queue_level_limit[i]) {
+            return i;
+        }
+    }
+    return SUB_QUEUE_LEVEL - 1;
+}
+
+PipelineTask* LockFreePriorityTaskQueue::try_take(bool is_steal) {
+    if (_total_task_size.load() <= 0 || _closed) {
+        return nullptr;
+    }
+    // Other workers may take from the chosen level concurrently, so retry with the next
+    // smallest vruntime level until all levels are observed empty.
+    bool tried[SUB_QUEUE_LEVEL] = {false};
+    for (int round = 0; round < SUB_QUEUE_LEVEL; ++round) {
+        double min_vruntime = 0;
+        int level = -1;
+        for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+            if (tried[i] || _sub_queues[i].empty()) {
+                continue;
+            }
+            double cur_queue_vruntime = _sub_queues[i].get_vruntime();
+            if (level == -1 || cur_queue_vruntime < min_vruntime) {
+                level = i;
+                min_vruntime = cur_queue_vruntime;
+            }
+        }
+        if (level == -1) {
+            return nullptr;
+        }
+        tried[level] = true;
+        auto task = _sub_queues[level].try_take(is_steal);
+        if (task) {
+            _queue_level_min_vruntime = uint64_t(min_vruntime);
+            task->update_queue_level(level);
+            _total_task_size--;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTask* LockFreePriorityTaskQueue::take(uint32_t timeout_ms) {
+    auto task = try_take(false);
+    if (task) {
+        return task;
+    }
+    std::unique_lock<std::mutex> lock(_wait_mutex);
+    // Register as a waiter before checking again, so that a concurrent push either is seen
+    // by the check or sees the waiter and notifies it.
+    _waiters++;
+    task = try_take(false);
+    if (!task && !_closed) {
+        if (timeout_ms > 0) {
+            _wait_task.wait_for(lock, std::chrono::milliseconds(timeout_ms));
+        } else {
+            _wait_task.wait(lock);
+        }
+        task = try_take(false);
+    }
+    _waiters--;
+    return task;
+}
+
+Status LockFreePriorityTaskQueue::push(PipelineTask* task) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    auto level = _compute_level(task->get_runtime_ns());
+
+    // update empty queue's  runtime, to avoid too high priority
+    uint64_t min_vruntime = _queue_level_min_vruntime;
+    if (_sub_queues[level].empty() &&
+        double(min_vruntime) > _sub_queues[level].get_vruntime()) {
+        _sub_queues[level].adjust_runtime(min_vruntime);
+    }
+
+    _sub_queues[level].push_back(task);
+    _total_task_size++;
+    if (_waiters.load() > 0) {
+        std::unique_lock<std::mutex> lock(_wait_mutex);
+        _wait_task.notify_one();
+    }
+    return Status::OK();
+}
+
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
-MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+static int numa_node_num_of(const std::vector<int>& core_to_numa_node) {
+    if (core_to_numa_node.empty()) {
+        return 1;
+    }
+    return *std::max_element(core_to_numa_node.begin(), core_to_numa_node.end()) + 1;
+}
+
+MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size, std::vector<int> core_to_numa_node,
+                                       bool lock_free)
+        : _lock_free(lock_free),
+          _prio_task_queues(lock_free ? 0 : core_size),
+          _lock_free_task_queues(lock_free ? core_size : 0),
+          _closed(false),
+          _core_size(core_size),
+          _numa_node_num(numa_node_num_of(core_to_numa_node)),
+          _core_to_numa_node(std::move(core_to_numa_node)),
+          _local_node_steal_counts(_numa_node_num),
+          _remote_node_steal_counts(_numa_node_num),
+          _steal_counts(core_size) {
+    DCHECK(_core_to_numa_node.empty() || _core_to_numa_node.size() == core_size);
+    _local_victims.resize(core_size);
+    _remote_victims.resize(core_size);
+    _idle_since_ms.resize(core_size, 0);
+    // keep the same steal order as the numa unaware mode: core_id + 1, core_id + 2, ...
+    for (int core_id = 0; core_id < core_size; ++core_id) {
+        for (int i = 1; i < core_size; ++i) {
+            int victim = (core_id + i) % core_size;
+            if (numa_node_of_core(victim) == numa_node_of_core(core_id)) {
+                _local_victims[core_id].push_back(victim);
+            } else {
+                _remote_victims[core_id].push_back(victim);
+            }
+        }
+    }
+}
+
+std::vector<int> MultiCoreTaskQueue::numa_topology(int core_size) {
+    std::vector<int> core_to_numa_node;
+    int max_num_cores = CpuInfo::get_max_num_cores();
+    if (CpuInfo::get_max_num_numa_nodes() <= 1 || max_num_cores <= 0) {
+        return core_to_numa_node;
+    }
+    core_to_numa_node.reserve(core_size);
+    for (int i = 0; i < core_size; ++i) {
+        core_to_numa_node.push_back(CpuInfo::get_numa_node_of_core(i % max_num_cores));
+    }
+    if (numa_node_num_of(core_to_numa_node) <= 1) {
+        core_to_numa_node.clear();
+    }
+    return core_to_numa_node;
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -143,15 +309,26 @@ void MultiCoreTaskQueue::close() {
     // close all priority task queue
     std::ranges::for_each(_prio_task_queues,
                           [](auto& prio_task_queue) { prio_task_queue.close(); });
+    std::ranges::for_each(_lock_free_task_queues,
+                          [](auto& lock_free_task_queue) { lock_free_task_queue.close(); });
+}
+
+uint32_t MultiCoreTaskQueue::_wait_timeout_ms() const {
+    if (!numa_aware()) {
+        return WAIT_CORE_TASK_TIMEOUT_MS;
+    }
+    // wake up in time to try stealing from remote nodes once the idle threshold is reached
+    auto idle_threshold_ms = config::pipeline_task_numa_remote_steal_idle_ms;
+    return static_cast<uint32_t>(std::clamp(idle_threshold_ms, 1, WAIT_CORE_TASK_TIMEOUT_MS));
 }
 
 PipelineTask* MultiCoreTaskQueue::take(int core_id) {
     PipelineTask* task = nullptr;
     while (!_closed) {
-        DCHECK(_prio_task_queues.size() > core_id)
-                << " list size: " << _prio_task_queues.size() << " core_id: " << core_id
-                << " _core_size: " << _core_size << " _next_core: " << _next_core.load();
-        task = _prio_task_queues[core_id].try_take(false);
+        DCHECK(_core_size > core_id)
+                << " core_id: " << core_id << " _core_size: " << _core_size
+                << " _next_core: " << _next_core.load();
+        task = _try_take_from(core_id, false);
         if (task) {
             break;
         }
@@ -159,34 +336,62 @@ PipelineTask* MultiCoreTaskQueue::take(int core_id) {
         if (task) {
             break;
         }
-        task = _prio_task_queues[core_id].take(WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
+        auto timeout_ms = _wait_timeout_ms();
+        task = _lock_free ? _lock_free_task_queues[core_id].take(timeout_ms)
+                          : _prio_task_queues[core_id].take(timeout_ms);
         if (task) {
             break;
         }
     }
     if (task) {
+        _idle_since_ms[core_id] = 0;
         task->pop_out_runnable_queue();
     }
     return task;
 }
 
-PipelineTask* MultiCoreTaskQueue::_steal_take(int core_id) {
-    DCHECK(core_id < _core_size);
-    int next_id = core_id;
-    for (int i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
-        }
-        DCHECK(next_id < _core_size);
-        auto task = _prio_task_queues[next_id].try_take(true);
+PipelineTask* MultiCoreTaskQueue::_steal_take_from(int core_id, const std::vector<int>& victims) {
+    for (int victim : victims) {
+        DCHECK(victim < _core_size && victim != core_id);
+        auto task = _try_take_from(victim, true);
         if (task) {
+            _steal_counts[core_id].fetch_add(1, std::memory_order_relaxed);
             return task;
         }
     }
     return nullptr;
 }
 
+PipelineTask* MultiCoreTaskQueue::_steal_take(int core_id) {
+    DCHECK(core_id < _core_size);
+    if (!numa_aware()) {
+        return _steal_take_from(core_id, _local_victims[core_id]);
+    }
+
+    int node = _core_to_numa_node[core_id];
+    if (auto* task = _steal_take_from(core_id, _local_victims[core_id])) {
+        _local_node_steal_counts[node]++;
+        return task;
+    }
+    if (_remote_victims[core_id].empty()) {
+        return nullptr;
+    }
+
+    // the whole local node is idle, cross the node only after being idle long enough
+    int64_t now_ms = MonotonicMillis();
+    if (_idle_since_ms[core_id] == 0) {
+        _idle_since_ms[core_id] = now_ms;
+    }
+    if (now_ms - _idle_since_ms[core_id] < config::pipeline_task_numa_remote_steal_idle_ms) {
+        return nullptr;
+    }
+    if (auto* task = _steal_take_from(core_id, _remote_victims[core_id])) {
+        _remote_node_steal_counts[node]++;
+        return task;
+    }
+    return nullptr;
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTask* task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
@@ -198,7 +403,8 @@ Status MultiCoreTaskQueue::push_back(PipelineTask* task) {
 Status MultiCoreTaskQueue::push_back(PipelineTask* task, int core_id) {
     DCHECK(core_id < _core_size);
     task->put_in_runnable_queue();
-    return _prio_task_queues[core_id].push(task);
+    return _lock_free ? _lock_free_task_queues[core_id].push(task)
+                      : _prio_task_queues[core_id].push(task);
 }
 
 void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
@@ -206,7 +412,13 @@ void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spen
     // should not do update_statistics
     if (auto core_id = task->get_core_id(); core_id >= 0) {
         task->inc_runtime_ns(time_spent);
-        _prio_task_queues[core_id].inc_sub_queue_runtime(task->get_queue_level(), time_spent);
+        if (_lock_free) {
+            _lock_free_task_queues[core_id].inc_sub_queue_runtime(task->get_queue_level(),
+                                                                  time_spent);
+        } else {
+            _prio_task_queues[core_id].inc_sub_queue_runtime(task->get_queue_level(),
+                                                             time_spent);
+        }
     }
 }
 
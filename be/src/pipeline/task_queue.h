@@ -16,6 +16,7 @@
 // under the License.
 #pragma once
 
+#include <concurrentqueue.h>
 #include <glog/logging.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -27,6 +28,7 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
@@ -102,10 +104,87 @@ private:
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+class LockFreeSubTaskQueue {
+    friend class LockFreePriorityTaskQueue;
+
+public:
+    void push_back(PipelineTask* task) {
+        _queue.enqueue(task);
+        _size++;
+    }
+
+    PipelineTask* try_take(bool is_steal);
+
+    void set_level_factor(double level_factor) { _level_factor = level_factor; }
+
+    double get_vruntime() { return double(_runtime) / _level_factor; }
+
+    void inc_runtime(uint64_t delta_time) { _runtime += delta_time; }
+
+    void adjust_runtime(uint64_t vruntime) {
+        this->_runtime = uint64_t(double(vruntime) * _level_factor);
+    }
+
+    // may be stale when other threads push or take concurrently
+    bool empty() { return _size.load() <= 0; }
+
+private:
+    moodycamel::ConcurrentQueue<PipelineTask*> _queue;
+    std::atomic<int64_t> _size = 0;
+    double _level_factor = 1;
+
+    std::atomic<uint64_t> _runtime = 0;
+};
+
+// The same multilevel feedback queue as PriorityTaskQueue, but push and take do not need
+// any lock. The mutex and condition variable are only used to park and wake up idle workers,
+// so a push does not touch them unless some worker is sleeping on this queue.
+class LockFreePriorityTaskQueue {
+public:
+    LockFreePriorityTaskQueue();
+
+    void close();
+
+    PipelineTask* try_take(bool is_steal);
+
+    PipelineTask* take(uint32_t timeout_ms = 0);
+
+    Status push(PipelineTask* task);
+
+    void inc_sub_queue_runtime(int level, uint64_t runtime) {
+        _sub_queues[level].inc_runtime(runtime);
+    }
+
+private:
+    static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
+    static constexpr size_t SUB_QUEUE_LEVEL = 6;
+    LockFreeSubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
+    // 1s, 3s, 10s, 60s, 300s
+    uint64_t _queue_level_limit[SUB_QUEUE_LEVEL - 1] = {1000000000, 3000000000, 10000000000,
+                                                        60000000000, 300000000000};
+    std::mutex _wait_mutex;
+    std::condition_variable _wait_task;
+    // number of workers parked on _wait_task
+    std::atomic<int> _waiters = 0;
+    std::atomic<int64_t> _total_task_size = 0;
+    std::atomic<bool> _closed;
+
+    // used to adjust vruntime of a queue when it's not empty
+    std::atomic<uint64_t> _queue_level_min_vruntime = 0;
+
+    int _compute_level(uint64_t real_runtime);
+};
+
+// When NUMA aware, every core (worker) belongs to a NUMA node. An idle worker steals tasks
+// from cores of its own node first, and only steals from remote nodes after it has been
+// idle for `pipeline_task_numa_remote_steal_idle_ms`, to avoid dragging the working set of
+// a task (e.g. hash tables) across the interconnect.
 class MultiCoreTaskQueue {
 public:
-    explicit MultiCoreTaskQueue(int core_size);
+    // core_to_numa_node[i] is the NUMA node of core i, empty means NUMA unaware.
+    // If lock_free is true, LockFreePriorityTaskQueue is used as the queue of every core.
+    explicit MultiCoreTaskQueue(int core_size, std::vector<int> core_to_numa_node = {},
+                                bool lock_free = false);
 
 #ifndef BE_TEST
     ~MultiCoreTaskQueue();
@@ -126,15 +205,69 @@ public:
 
     int cores() const { return _core_size; }
 
+    bool lock_free() const { return _lock_free; }
+
+    bool numa_aware() const { return _numa_node_num > 1; }
+
+    int numa_node_num() const { return _numa_node_num; }
+
+    int numa_node_of_core(int core_id) const {
+        return numa_aware() ? _core_to_numa_node[core_id] : 0;
+    }
+
+    // Tasks stolen by workers of `node` from cores of the same node.
+    uint64_t local_node_steal_count(int node) const { return _local_node_steal_counts[node]; }
+
+    // Tasks stolen by workers of `node` from cores of other nodes.
+    uint64_t remote_node_steal_count(int node) const { return _remote_node_steal_counts[node]; }
+
+    // Tasks stolen from the queue of another core, by all workers.
+    uint64_t steal_count() const {
+        uint64_t count = 0;
+        for (const auto& core_count : _steal_counts) {
+            count += core_count.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    // Build the core -> NUMA node mapping of `core_size` workers from CpuInfo. Workers are
+    // assigned to physical cores round-robin, the result is empty if the host has only one node.
+    static std::vector<int> numa_topology(int core_size);
+
 private:
     PipelineTask* _steal_take(int core_id);
 
+    PipelineTask* _steal_take_from(int core_id, const std::vector<int>& victims);
+
+    uint32_t _wait_timeout_ms() const;
+
+    PipelineTask* _try_take_from(int core_id, bool is_steal) {
+        return _lock_free ? _lock_free_task_queues[core_id].try_take(is_steal)
+                          : _prio_task_queues[core_id].try_take(is_steal);
+    }
+
+    const bool _lock_free;
+    // only one of them is used, depends on _lock_free
     std::vector<PriorityTaskQueue> _prio_task_queues;
+    std::vector<LockFreePriorityTaskQueue> _lock_free_task_queues;
     std::atomic<uint32_t> _next_core = 0;
     std::atomic<bool> _closed;
 
     int _core_size;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
+
+    int _numa_node_num = 1;
+    std::vector<int> _core_to_numa_node;
+    // for each core, the other cores in the same node / in the other nodes, in steal order
+    std::vector<std::vector<int>> _local_victims;
+    std::vector<std::vector<int>> _remote_victims;
+    // for each core, the time it began to fail stealing from local node, 0 means not idle.
+    // only accessed by the worker of the core.
+    std::vector<int64_t> _idle_since_ms;
+    std::vector<std::atomic<uint64_t>> _local_node_steal_counts;
+    std::vector<std::atomic<uint64_t>> _remote_node_steal_counts;
+    // for each core, the tasks its worker stole. only written by the worker of the core.
+    std::vector<std::atomic<uint64_t>> _steal_counts;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
@@ -36,6 +36,11 @@
 #include "pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
+#include "util/cpu_info.h"
+#include "util/cpu_sampler.h"
+#include "util/defer_op.h"
+#include "util/doris_metrics.h"
+#include "util/metrics.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -44,6 +49,9 @@
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(pipeline_task_local_node_steal_count, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(pipeline_task_remote_node_steal_count, MetricUnit::NOUNIT);
+
 TaskScheduler::~TaskScheduler() {
     stop();
     LOG(INFO) << "Task scheduler " << _name << " shutdown";
@@ -57,14 +65,74 @@ Status TaskScheduler::start() {
                             .set_max_queue_size(0)
                             .set_cgroup_cpu_ctl(_cgroup_cpu_ctl)
                             .build(&_fix_thread_pool));
-    LOG_INFO("TaskScheduler set cores").tag("size", cores);
+    LOG_INFO("TaskScheduler set cores")
+            .tag("size", cores)
+            .tag("numa_nodes", _task_queue.numa_node_num());
     _markers.resize(cores, true);
+    _register_numa_metrics();
+    auto metric_prefix = fmt::format("pipeline_task_scheduler_{}", _name);
+    _queue_wait_latency =
+            std::make_unique<bvar::LatencyRecorder>(metric_prefix, "queue_wait_us");
+    _run_slice_latency = std::make_unique<bvar::LatencyRecorder>(metric_prefix, "run_slice_us");
+    _steal_count = std::make_unique<bvar::PassiveStatus<int64_t>>(
+            metric_prefix, "steal_count",
+            [](void* arg) {
+                return static_cast<int64_t>(
+                        static_cast<MultiCoreTaskQueue*>(arg)->steal_count());
+            },
+            &_task_queue);
     for (int i = 0; i < cores; ++i) {
         RETURN_IF_ERROR(_fix_thread_pool->submit_func([this, i] { _do_work(i); }));
     }
     return Status::OK();
 }
 
+void TaskScheduler::_bind_to_numa_node(int index) {
+    if (!_task_queue.numa_aware()) {
+        return;
+    }
+    int node = _task_queue.numa_node_of_core(index);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : CpuInfo::get_cores_of_numa_node(node)) {
+        CPU_SET(core, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "Task scheduler " << _name << " failed to bind worker " << index
+                     << " to numa node " << node << ", errno: " << ret;
+    }
+}
+
+void TaskScheduler::_register_numa_metrics() {
+    if (!_task_queue.numa_aware()) {
+        return;
+    }
+    for (int node = 0; node < _task_queue.numa_node_num(); ++node) {
+        auto entity = DorisMetrics::instance()->metric_registry()->register_entity(
+                fmt::format("pipeline_task_scheduler_{}_numa_node_{}", _name, node),
+                {{"task_scheduler", _name}, {"numa_node", std::to_string(node)}});
+        IntCounter* pipeline_task_local_node_steal_count = nullptr;
+        IntCounter* pipeline_task_remote_node_steal_count = nullptr;
+        INT_COUNTER_METRIC_REGISTER(entity, pipeline_task_local_node_steal_count);
+        INT_COUNTER_METRIC_REGISTER(entity, pipeline_task_remote_node_steal_count);
+        entity->register_hook("update", [this, node, pipeline_task_local_node_steal_count,
+                                         pipeline_task_remote_node_steal_count]() {
+            pipeline_task_local_node_steal_count->set_value(
+                    _task_queue.local_node_steal_count(node));
+            pipeline_task_remote_node_steal_count->set_value(
+                    _task_queue.remote_node_steal_count(node));
+        });
+        _numa_metric_entities.push_back(std::move(entity));
+    }
+}
+
+void TaskScheduler::_deregister_numa_metrics() {
+    for (auto& entity : _numa_metric_entities) {
+        DorisMetrics::instance()->metric_registry()->deregister_entity(entity);
+    }
+    _numa_metric_entities.clear();
+}
+
 Status TaskScheduler::schedule_task(PipelineTask* task) {
     return _task_queue.push_back(task);
 }
@@ -97,6 +165,9 @@ void _close_task(PipelineTask* task, Status exec_status) {
 }
 
 void TaskScheduler::_do_work(int index) {
+    _bind_to_numa_node(index);
+    CpuSampler::instance()->register_thread();
+    Defer unregister_sampler {[]() { CpuSampler::instance()->unregister_thread(); }};
     while (_markers[index]) {
         auto* task = _task_queue.take(index);
         if (!task) {
@@ -109,6 +180,7 @@ void TaskScheduler::_do_work(int index) {
             static_cast<void>(_task_queue.push_back(task, index));
             continue;
         }
+        *_queue_wait_latency << task->last_wait_worker_ns() / 1000;
         task->log_detail_if_need();
         task->set_running(true);
         task->set_task_queue(&_task_queue);
@@ -133,6 +205,8 @@ void TaskScheduler::_do_work(int index) {
         auto status = Status::OK();
         task->set_core_id(index);
 
+        MonotonicStopWatch run_slice_watch;
+        run_slice_watch.start();
         ASSIGN_STATUS_IF_CATCH_EXCEPTION(
                 //TODO: use a better enclose to abstracting these
                 if (ExecEnv::GetInstance()->pipeline_tracer_context()->enabled()) {
@@ -151,6 +225,7 @@ void TaskScheduler::_do_work(int index) {
                              start_time, end_time});
                 } else { status = task->execute(&eos); },
                 status);
+        *_run_slice_latency << run_slice_watch.elapsed_time() / 1000;
 
         if (!status.ok()) {
             // Print detail informations below when you debugging here.
@@ -191,6 +266,7 @@ void TaskScheduler::stop() {
             _fix_thread_pool->shutdown();
             _fix_thread_pool->wait();
         }
+        _deregister_numa_metrics();
         // Should set at the ending of the stop to ensure that the
         // pool is stopped. For example, if there are 2 threads call stop
         // then if one thread set shutdown = false, then another thread will
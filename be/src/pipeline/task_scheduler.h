@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <bvar/latency_recorder.h>
+#include <bvar/passive_status.h>
 #include <stddef.h>
 
 #include <atomic>
@@ -27,6 +29,7 @@
 #include <utility>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "gutil/ref_counted.h"
 #include "pipeline_task.h"
@@ -37,6 +40,7 @@
 namespace doris {
 class ExecEnv;
 class ThreadPool;
+class MetricEntity;
 } // namespace doris
 
 namespace doris::pipeline {
@@ -44,7 +48,11 @@ namespace doris::pipeline {
 class TaskScheduler {
 public:
     TaskScheduler(int core_num, std::string name, std::shared_ptr<CgroupCpuCtl> cgroup_cpu_ctl)
-            : _task_queue(core_num),
+            : _task_queue(core_num,
+                          config::enable_pipeline_task_numa_aware
+                                  ? MultiCoreTaskQueue::numa_topology(core_num)
+                                  : std::vector<int> {},
+                          config::enable_pipeline_lock_free_task_queue),
               _shutdown(false),
               _name(std::move(name)),
               _cgroup_cpu_ctl(cgroup_cpu_ctl) {}
@@ -66,7 +74,21 @@ private:
     bool _shutdown;
     std::string _name;
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
+    // per numa node steal metrics, only registered when the task queue is numa aware
+    std::vector<std::shared_ptr<MetricEntity>> _numa_metric_entities;
+    // scheduling metrics of the scheduler, exposed as bvars prefixed by
+    // pipeline_task_scheduler_{name}: the time tasks wait in the runnable queue,
+    // the duration of their running slices and the tasks stolen by the workers.
+    std::unique_ptr<bvar::LatencyRecorder> _queue_wait_latency;
+    std::unique_ptr<bvar::LatencyRecorder> _run_slice_latency;
+    std::unique_ptr<bvar::PassiveStatus<int64_t>> _steal_count;
 
     void _do_work(int index);
+
+    void _bind_to_numa_node(int index);
+
+    void _register_numa_metrics();
+
+    void _deregister_numa_metrics();
 };
 } // namespace doris::pipeline
\ No newline at end of file
@@ -217,8 +217,13 @@ public:
     ThreadPool* buffered_reader_prefetch_thread_pool() {
         return _buffered_reader_prefetch_thread_pool.get();
     }
+    ThreadPool* segment_page_read_ahead_thread_pool() {
+        return _segment_page_read_ahead_thread_pool.get();
+    }
+    ThreadPool* segment_writer_thread_pool() { return _segment_writer_thread_pool.get(); }
     ThreadPool* send_table_stats_thread_pool() { return _send_table_stats_thread_pool.get(); }
     ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
+    ThreadPool* s3_hedged_read_thread_pool() { return _s3_hedged_read_thread_pool.get(); }
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
     ThreadPool* non_block_close_thread_pool();
     ThreadPool* s3_file_system_thread_pool() { return _s3_file_system_thread_pool.get(); }
@@ -408,10 +413,16 @@ private:
     std::unique_ptr<ThreadPool> _send_batch_thread_pool;
     // Threadpool used to prefetch remote file for buffered reader
     std::unique_ptr<ThreadPool> _buffered_reader_prefetch_thread_pool;
+    // Threadpool used to read ahead and decompress data pages of segment columns
+    std::unique_ptr<ThreadPool> _segment_page_read_ahead_thread_pool;
+    // Threadpool used to encode value columns of a segment concurrently
+    std::unique_ptr<ThreadPool> _segment_writer_thread_pool;
     // Threadpool used to send TableStats to FE
     std::unique_ptr<ThreadPool> _send_table_stats_thread_pool;
     // Threadpool used to upload local file to s3
     std::unique_ptr<ThreadPool> _s3_file_upload_thread_pool;
+    // Threadpool used to send the GETs of hedged s3 reads
+    std::unique_ptr<ThreadPool> _s3_hedged_read_thread_pool;
     // Pool used by join node to build hash table
     // Pool to use a new thread to release object
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
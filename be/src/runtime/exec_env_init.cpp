@@ -218,6 +218,22 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(cast_set<int>(buffered_reader_max_threads))
                               .build(&_buffered_reader_prefetch_thread_pool));
 
+    auto [segment_read_ahead_min_threads, segment_read_ahead_max_threads] =
+            get_num_threads(config::num_segment_page_read_ahead_thread_pool_min_thread,
+                            config::num_segment_page_read_ahead_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("SegmentPageReadAheadThreadPool")
+                              .set_min_threads(cast_set<int>(segment_read_ahead_min_threads))
+                              .set_max_threads(cast_set<int>(segment_read_ahead_max_threads))
+                              .build(&_segment_page_read_ahead_thread_pool));
+
+    auto [segment_writer_min_threads, segment_writer_max_threads] =
+            get_num_threads(config::num_segment_writer_thread_pool_min_thread,
+                            config::num_segment_writer_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("SegmentWriterThreadPool")
+                              .set_min_threads(cast_set<int>(segment_writer_min_threads))
+                              .set_max_threads(cast_set<int>(segment_writer_max_threads))
+                              .build(&_segment_writer_thread_pool));
+
     static_cast<void>(ThreadPoolBuilder("SendTableStatsThreadPool")
                               .set_min_threads(8)
                               .set_max_threads(32)
@@ -231,6 +247,14 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(cast_set<int>(s3_file_upload_max_threads))
                               .build(&_s3_file_upload_thread_pool));
 
+    auto [s3_hedged_read_min_threads, s3_hedged_read_max_threads] =
+            get_num_threads(config::num_s3_hedged_read_thread_pool_min_thread,
+                            config::num_s3_hedged_read_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("S3HedgedReadThreadPool")
+                              .set_min_threads(cast_set<int>(s3_hedged_read_min_threads))
+                              .set_max_threads(cast_set<int>(s3_hedged_read_max_threads))
+                              .build(&_s3_hedged_read_thread_pool));
+
     // min num equal to fragment pool's min num
     // max num is useless because it will start as many as requested in the past
     // queue size is useless because the max thread num is very large
@@ -478,7 +502,8 @@ Status ExecEnv::_init_mem_env() {
         pk_storage_page_cache_limit = storage_cache_limit / 2;
     }
     _storage_page_cache = StoragePageCache::create_global_cache(
-            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards);
+            storage_cache_limit, index_percentage, pk_storage_page_cache_limit, num_shards,
+            config::compressed_data_page_cache_percentage);
     LOG(INFO) << "Storage page cache memory limit: "
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
@@ -532,6 +557,7 @@ Status ExecEnv::_init_mem_env() {
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
     _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache->init();
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -722,7 +748,10 @@ void ExecEnv::destroy() {
         _runtime_query_statistics_mgr->stop_report_thread();
     }
     SAFE_SHUTDOWN(_buffered_reader_prefetch_thread_pool);
+    SAFE_SHUTDOWN(_segment_page_read_ahead_thread_pool);
+    SAFE_SHUTDOWN(_segment_writer_thread_pool);
     SAFE_SHUTDOWN(_s3_file_upload_thread_pool);
+    SAFE_SHUTDOWN(_s3_hedged_read_thread_pool);
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
@@ -774,7 +803,10 @@ void ExecEnv::destroy() {
     _s3_file_system_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
+    _segment_page_read_ahead_thread_pool.reset(nullptr);
+    _segment_writer_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
+    _s3_hedged_read_thread_pool.reset(nullptr);
     _send_batch_thread_pool.reset(nullptr);
     _file_cache_open_fd_cache.reset(nullptr);
     _write_cooldown_meta_executors.reset(nullptr);
@@ -827,6 +827,34 @@ std::string FragmentMgr::dump_pipeline_tasks(TUniqueId& query_id) {
     }
 }
 
+std::string FragmentMgr::dump_query_memory() {
+    std::vector<std::shared_ptr<QueryContext>> q_ctxs;
+    _query_ctx_map.apply([&](phmap::flat_hash_map<TUniqueId, std::weak_ptr<QueryContext>>& map)
+                                 -> Status {
+        for (auto& it : map) {
+            if (auto q_ctx = it.second.lock()) {
+                q_ctxs.push_back(std::move(q_ctx));
+            }
+        }
+        return Status::OK();
+    });
+    fmt::memory_buffer debug_string_buffer;
+    fmt::format_to(debug_string_buffer, "{} queries are running.\n", q_ctxs.size());
+    for (auto& q_ctx : q_ctxs) {
+        fmt::format_to(debug_string_buffer, "{}\n", q_ctx->print_all_pipeline_memory());
+    }
+    return fmt::to_string(debug_string_buffer);
+}
+
+std::string FragmentMgr::dump_query_memory(TUniqueId& query_id) {
+    if (auto q_ctx = get_query_ctx(query_id)) {
+        return q_ctx->print_all_pipeline_memory();
+    } else {
+        return fmt::format("Dump query memory failed: Query context (query id = {}) not found. \n",
+                           print_id(query_id));
+    }
+}
+
 Status FragmentMgr::exec_plan_fragment(const TPipelineFragmentParams& params,
                                        QuerySource query_source, const FinishCallback& cb) {
     VLOG_ROW << "query: " << print_id(params.query_id) << " exec_plan_fragment params is "
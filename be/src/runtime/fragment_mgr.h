@@ -176,6 +176,10 @@ public:
     std::string dump_pipeline_tasks(int64_t duration = 0);
     std::string dump_pipeline_tasks(TUniqueId& query_id);
 
+    // Memory attributed to the pipeline operators of all running queries, or of one query.
+    std::string dump_query_memory();
+    std::string dump_query_memory(TUniqueId& query_id);
+
     void get_runtime_query_info(std::vector<WorkloadQueryInfo>* _query_info_list);
 
     Status get_realtime_exec_status(const TUniqueId& query_id,
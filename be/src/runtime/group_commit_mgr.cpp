@@ -50,6 +50,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
         if (!config::group_commit_wait_replay_wal_finish) {
             _block_queue.emplace_back(block);
             _data_bytes += block->bytes();
+            _last_add_block_time = std::chrono::steady_clock::now();
             int before_block_queues_bytes = _all_block_queues_bytes->load();
             _all_block_queues_bytes->fetch_add(block->bytes(), std::memory_order_relaxed);
             std::stringstream ss;
@@ -122,6 +123,15 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
     if (!_need_commit && duration >= _group_commit_interval_ms) {
         _need_commit = true;
     }
+    // the writers went quiet, make what they wrote visible without waiting for the interval
+    if (!_need_commit && config::group_commit_idle_commit_ms > 0 && _data_bytes > 0 &&
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                              _last_add_block_time)
+                        .count() >= config::group_commit_idle_commit_ms) {
+        VLOG_DEBUG << "group commit meets commit condition for idle time, label=" << label
+                   << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
+        _need_commit = true;
+    }
     auto get_load_ids = [&]() {
         std::stringstream ss;
         ss << "[";
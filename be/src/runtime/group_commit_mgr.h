@@ -67,6 +67,7 @@ public:
               _group_commit_interval_ms(group_commit_interval_ms),
               _start_time(std::chrono::steady_clock::now()),
               _last_print_time(_start_time),
+              _last_add_block_time(_start_time),
               _group_commit_data_bytes(group_commit_data_bytes),
               _all_block_queues_bytes(all_block_queues_bytes) {};
 
@@ -136,6 +137,8 @@ private:
     int64_t _group_commit_interval_ms;
     std::chrono::steady_clock::time_point _start_time;
     std::chrono::steady_clock::time_point _last_print_time;
+    // commit by idle time, see config::group_commit_idle_commit_ms
+    std::chrono::steady_clock::time_point _last_add_block_time;
     // commit by data size
     int64_t _group_commit_data_bytes;
     int64_t _data_bytes = 0;
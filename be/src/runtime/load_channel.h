@@ -71,6 +71,7 @@ public:
 
     RuntimeProfile::Counter* get_mgr_add_batch_timer() { return _mgr_add_batch_timer; }
     RuntimeProfile::Counter* get_handle_mem_limit_timer() { return _handle_mem_limit_timer; }
+    RuntimeProfile::Counter* get_flush_backpressure_timer() { return _flush_backpressure_timer; }
 
 protected:
     Status _get_tablets_channel(std::shared_ptr<BaseTabletsChannel>& channel, bool& is_finished,
@@ -95,6 +96,7 @@ private:
     RuntimeProfile::Counter* _add_batch_times = nullptr;
     RuntimeProfile::Counter* _mgr_add_batch_timer = nullptr;
     RuntimeProfile::Counter* _handle_mem_limit_timer = nullptr;
+    RuntimeProfile::Counter* _flush_backpressure_timer = nullptr;
     RuntimeProfile::Counter* _handle_eos_timer = nullptr;
 
     // lock protect the tablets channel map
@@ -17,6 +17,7 @@
 
 #include "runtime/load_channel_mgr.h"
 
+#include <bvar/bvar.h>
 #include <fmt/format.h>
 #include <gen_cpp/internal_service.pb.h>
 
@@ -27,10 +28,13 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "common/config.h"
 #include "common/logging.h"
+#include "olap/memtable_flush_executor.h"
+#include "olap/storage_engine.h"
 #include "runtime/exec_env.h"
 #include "runtime/load_channel.h"
 #include "util/doris_metrics.h"
@@ -49,6 +53,8 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(load_channel_count, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_5ARG(load_channel_mem_consumption, MetricUnit::BYTES, "",
                                    mem_consumption, Labels({{"type", "load"}}));
 
+bvar::Adder<int64_t> g_load_flush_backpressure_num("load_flush_backpressure_num");
+
 static int64_t calc_channel_timeout_s(int64_t timeout_in_req_s) {
     int64_t load_channel_timeout_s = config::streaming_load_rpc_max_alive_time_sec;
     if (timeout_in_req_s > 0) {
@@ -151,6 +157,18 @@ Status LoadChannelMgr::add_batch(const PTabletWriterAddBlockRequest& request,
         // because this may block for a while, which may lead to rpc timeout.
         SCOPED_TIMER(channel->get_handle_mem_limit_timer());
         ExecEnv::GetInstance()->memtable_memory_limiter()->handle_memtable_flush();
+
+        // Delay the response while the flush pool is backlogged, the sender waits for it
+        // before sending the next block, so the write rate follows the flush throughput.
+        int64_t delay_ms = ExecEnv::GetInstance()
+                                   ->storage_engine()
+                                   .memtable_flush_executor()
+                                   ->flush_backpressure_delay_ms();
+        if (delay_ms > 0) {
+            SCOPED_TIMER(channel->get_flush_backpressure_timer());
+            g_load_flush_backpressure_num << 1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+        }
     }
 
     // 3. add batch to load channel
@@ -17,6 +17,8 @@
 
 #include "runtime/memory/cache_manager.h"
 
+#include <algorithm>
+
 #include "runtime/memory/cache_policy.h"
 #include "util/runtime_profile.h"
 
@@ -63,16 +65,67 @@ int64_t CacheManager::cache_prune_all(CachePolicy::CacheType type, bool force) {
     return cache_policy->profile()->get_counter("FreedMemory")->value();
 }
 
+double CacheManager::cache_capacity_weighted(double adjust_weighted, double hit_ratio,
+                                             double avg_hit_ratio, double last_weighted) {
+    // The bias is scaled by the pressure (1 - adjust_weighted), so without pressure every
+    // cache gets its full capacity and over the soft limit every cache is emptied.
+    double target = adjust_weighted + (hit_ratio - avg_hit_ratio) * (1 - adjust_weighted);
+    target = std::clamp(target, 0.0, 1.0);
+    if (adjust_weighted <= 0 || config::cache_capacity_adjust_max_step <= 0) {
+        return target;
+    }
+    double step = config::cache_capacity_adjust_max_step;
+    return std::clamp(target, last_weighted - step, last_weighted + step);
+}
+
 int64_t CacheManager::for_each_cache_refresh_capacity(double adjust_weighted,
                                                       RuntimeProfile* profile) {
     int64_t freed_size = 0;
     std::lock_guard<std::mutex> l(_caches_lock);
+
+    // Recent hit ratio of each cache, measured on the lookups since the last refresh.
+    std::unordered_map<CachePolicy::CacheType, double> hit_ratios;
+    double total_hit_ratio = 0;
     for (const auto& pair : _caches) {
         auto* cache_policy = pair.second;
         if (!cache_policy->enable_prune()) {
             continue;
         }
-        cache_policy->adjust_capacity_weighted(adjust_weighted);
+        auto& state = _capacity_states[pair.first];
+        uint64_t lookup_count = cache_policy->get_lookup_count();
+        uint64_t hit_count = cache_policy->get_hit_count();
+        uint64_t lookups = lookup_count - std::min(lookup_count, state.last_lookup_count);
+        uint64_t hits = hit_count - std::min(hit_count, state.last_hit_count);
+        state.last_lookup_count = lookup_count;
+        state.last_hit_count = hit_count;
+        if (lookups != 0) {
+            // averaged with the previous ratio, short refresh intervals see few lookups.
+            double hit_ratio = static_cast<double>(std::min(hits, lookups)) /
+                               static_cast<double>(lookups);
+            state.hit_ratio = (state.hit_ratio + hit_ratio) / 2;
+        }
+        hit_ratios[pair.first] = state.hit_ratio;
+        total_hit_ratio += state.hit_ratio;
+    }
+    double avg_hit_ratio =
+            hit_ratios.empty() ? 0 : total_hit_ratio / static_cast<double>(hit_ratios.size());
+
+    for (const auto& pair : _caches) {
+        auto* cache_policy = pair.second;
+        if (!cache_policy->enable_prune()) {
+            continue;
+        }
+        auto& state = _capacity_states[pair.first];
+        double weighted = cache_capacity_weighted(adjust_weighted, hit_ratios[pair.first],
+                                                  avg_hit_ratio, state.weighted);
+        state.converged = weighted == cache_capacity_weighted(adjust_weighted,
+                                                              hit_ratios[pair.first],
+                                                              avg_hit_ratio, weighted);
+        if (weighted == state.weighted) {
+            continue;
+        }
+        state.weighted = weighted;
+        cache_policy->adjust_capacity_weighted(weighted);
         freed_size += cache_policy->profile()->get_counter("FreedMemory")->value();
         if (cache_policy->profile()->get_counter("FreedMemory")->value() != 0 && profile) {
             profile->add_child(cache_policy->profile(), true, nullptr);
@@ -81,4 +134,14 @@ int64_t CacheManager::for_each_cache_refresh_capacity(double adjust_weighted,
     return freed_size;
 }
 
+bool CacheManager::need_refresh_capacity(double adjust_weighted) {
+    if (adjust_weighted < 1) {
+        // under memory pressure, hit ratios keep moving the per cache weights.
+        return true;
+    }
+    std::lock_guard<std::mutex> l(_caches_lock);
+    return std::any_of(_capacity_states.begin(), _capacity_states.end(),
+                       [](const auto& pair) { return !pair.second.converged; });
+}
+
 } // namespace doris
@@ -82,12 +82,34 @@ public:
         return false;
     }
 
+    // adjust_weighted is the average capacity weight derived from process memory headroom.
+    // Each cache gets its own weight around it: caches with a higher hit ratio since the
+    // last refresh keep more capacity, and the weight moves toward the target by at most
+    // config::cache_capacity_adjust_max_step per refresh.
     int64_t for_each_cache_refresh_capacity(double adjust_weighted,
                                             RuntimeProfile* profile = nullptr);
 
+    // Whether another capacity refresh is needed even if adjust_weighted is unchanged.
+    bool need_refresh_capacity(double adjust_weighted);
+
+    // Target weight of one cache, adjust_weighted biased by how far its hit ratio is
+    // from the average hit ratio of all caches, then smoothed from last_weighted.
+    static double cache_capacity_weighted(double adjust_weighted, double hit_ratio,
+                                          double avg_hit_ratio, double last_weighted);
+
 private:
+    struct CacheCapacityState {
+        uint64_t last_lookup_count = 0;
+        uint64_t last_hit_count = 0;
+        double hit_ratio = 0;
+        double weighted = 1.0;
+        // false if weighted has not reached its target because of the step limit.
+        bool converged = true;
+    };
+
     std::mutex _caches_lock;
     std::unordered_map<CachePolicy::CacheType, CachePolicy*> _caches;
+    std::unordered_map<CachePolicy::CacheType, CacheCapacityState> _capacity_states;
     int64_t _last_prune_stale_timestamp = 0;
     int64_t _last_prune_all_timestamp = 0;
 };
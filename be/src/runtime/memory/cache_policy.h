@@ -52,6 +52,7 @@ public:
         FOR_UT_CACHE_NUMBER = 19,
         QUERY_CACHE = 20,
         TABLET_COLUMN_OBJECT_POOL = 21,
+        COMPRESSED_DATA_PAGE_CACHE = 22,
     };
 
     static std::string type_string(CacheType type) {
@@ -98,6 +99,8 @@ public:
             return "QueryCache";
         case CacheType::TABLET_COLUMN_OBJECT_POOL:
             return "TabletColumnObjectPool";
+        case CacheType::COMPRESSED_DATA_PAGE_CACHE:
+            return "CompressedDataPageCache";
         default:
             throw Exception(Status::FatalError("not match type of cache policy :{}",
                                                static_cast<int>(type)));
@@ -126,7 +129,8 @@ public:
             {"CloudTxnDeleteBitmapCache", CacheType::CLOUD_TXN_DELETE_BITMAP_CACHE},
             {"ForUTCacheNumber", CacheType::FOR_UT_CACHE_NUMBER},
             {"QueryCache", CacheType::QUERY_CACHE},
-            {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL}};
+            {"TabletColumnObjectPool", CacheType::TABLET_COLUMN_OBJECT_POOL},
+            {"CompressedDataPageCache", CacheType::COMPRESSED_DATA_PAGE_CACHE}};
 
     static CacheType string_to_type(std::string type) {
         if (StringToType.contains(type)) {
@@ -146,6 +150,8 @@ public:
     virtual void prune_all(bool force) = 0;
     virtual int64_t adjust_capacity_weighted(double adjust_weighted) = 0;
     virtual size_t get_capacity() = 0;
+    virtual uint64_t get_lookup_count() { return 0; }
+    virtual uint64_t get_hit_count() { return 0; }
 
     CacheType type() { return _type; }
     size_t initial_capacity() const { return _initial_capacity; }
@@ -20,7 +20,10 @@
 #include <fmt/format.h>
 
 #include <memory>
+#include <string>
+#include <string_view>
 
+#include "common/config.h"
 #include "olap/lru_cache.h"
 #include "runtime/memory/cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
@@ -40,9 +43,11 @@ public:
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
-            _cache = std::shared_ptr<ShardedLRUCache>(
+            auto cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         element_count_capacity, is_lru_k));
+            cache->set_tinylfu_admission(is_tinylfu_admission(type));
+            _cache = std::move(cache);
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -58,10 +63,12 @@ public:
             : CachePolicy(type, capacity, stale_sweep_time_s, enable_prune),
               _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
-            _cache = std::shared_ptr<ShardedLRUCache>(
+            auto cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         cache_value_time_extractor, cache_value_check_timestamp,
                                         element_count_capacity, is_lru_k));
+            cache->set_tinylfu_admission(is_tinylfu_admission(type));
+            _cache = std::move(cache);
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -82,6 +89,30 @@ public:
         return true;
     }
 
+    // whether the cache is listed in config::lru_cache_tinylfu_admission_cache_names
+    static bool is_tinylfu_admission(CacheType type) {
+        const std::string name = type_string(type);
+        std::string_view names = config::lru_cache_tinylfu_admission_cache_names;
+        while (!names.empty()) {
+            size_t pos = names.find(',');
+            std::string_view item = names.substr(0, pos);
+            while (!item.empty() && item.front() == ' ') {
+                item.remove_prefix(1);
+            }
+            while (!item.empty() && item.back() == ' ') {
+                item.remove_suffix(1);
+            }
+            if (item == name) {
+                return true;
+            }
+            if (pos == std::string_view::npos) {
+                break;
+            }
+            names.remove_prefix(pos + 1);
+        }
+        return false;
+    }
+
     static std::string lru_cache_type_string(LRUCacheType type) {
         switch (type) {
         case LRUCacheType::SIZE:
@@ -141,6 +172,8 @@ public:
     size_t get_element_count() { return _cache->get_element_count(); }
 
     size_t get_capacity() override { return _cache->get_capacity(); }
+    uint64_t get_lookup_count() override { return _cache->get_lookup_count(); }
+    uint64_t get_hit_count() override { return _cache->get_hit_count(); }
 
     uint64_t new_id() { return _cache->new_id(); };
 
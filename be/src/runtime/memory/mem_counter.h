@@ -17,6 +17,8 @@
 // This file is copied from
 #pragma once
 
+#include <fmt/format.h>
+
 #include <atomic>
 #include <cstdint>
 #include <string>
@@ -92,4 +94,40 @@ private:
     std::atomic<int64_t> _peak_value {0};
 };
 
+/*
+ * Memory allocated and freed by the thread while it runs one pipeline operator, see
+ * SCOPED_ATTRIBUTE_OPERATOR_MEMORY. Memory allocated by one operator and freed by another,
+ * such as a block returned to the parent, is released from the freeing operator, so the
+ * current value of an operator may be negative.
+ *
+ * This class is thread-safe.
+*/
+class OperatorMemCounter {
+public:
+    void consume(int64_t size) {
+        if (size > 0) {
+            _alloc_count.fetch_add(1, std::memory_order_relaxed);
+            _alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+        }
+        _mem_counter.add(size);
+    }
+
+    int64_t current_value() const { return _mem_counter.current_value(); }
+    int64_t peak_value() const { return _mem_counter.peak_value(); }
+    int64_t alloc_count() const { return _alloc_count.load(std::memory_order_relaxed); }
+    int64_t alloc_bytes() const { return _alloc_bytes.load(std::memory_order_relaxed); }
+
+    std::string debug_string() const {
+        return fmt::format("Used={}, Peak={}, AllocCount={}, AllocBytes={}",
+                           MemCounter::print_bytes(current_value()),
+                           MemCounter::print_bytes(peak_value()), alloc_count(),
+                           MemCounter::print_bytes(alloc_bytes()));
+    }
+
+private:
+    MemCounter _mem_counter;
+    std::atomic<int64_t> _alloc_count {0};
+    std::atomic<int64_t> _alloc_bytes {0};
+};
+
 } // namespace doris
@@ -24,9 +24,12 @@
 #include "util/mem_info.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "vec/common/arena_chunk_pool.h"
+#include "vec/common/column_buffer_pool.h"
 
 namespace doris {
 
+// step0: free cached arena chunks and column buffers
 // step1: free resource groups memory that enable overcommit
 // step2: free global top overcommit query, if enable query memory overcommit
 // TODO Now, the meaning is different from java minor gc + full gc, more like small gc + large gc.
@@ -45,6 +48,13 @@ bool MemoryReclamation::process_minor_gc(std::string mem_info) {
                 ss.str());
     }};
 
+    // cached arena chunks and column buffers are not used by anyone, free them first
+    freed_mem += vectorized::ArenaChunkPool::instance()->release_all();
+    freed_mem += vectorized::ColumnBufferPool::release_all();
+    if (freed_mem > MemInfo::process_minor_gc_size()) {
+        return true;
+    }
+
     if (config::enable_workload_group_memory_gc) {
         RuntimeProfile* tg_profile = profile->create_child("WorkloadGroup", true, true);
         freed_mem += tg_enable_overcommit_group_gc(MemInfo::process_minor_gc_size() - freed_mem,
@@ -31,6 +31,7 @@
 #include "common/config.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/mem_counter.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
@@ -74,6 +75,10 @@ public:
 
     void set_wg_wptr(const std::weak_ptr<WorkloadGroup>& wg_wptr) { _wg_wptr = wg_wptr; }
 
+    // The operator counter that memory consumed by this thread is attributed to, nullptr if none.
+    OperatorMemCounter* operator_mem_counter() const { return _operator_mem_counter; }
+    void set_operator_mem_counter(OperatorMemCounter* counter) { _operator_mem_counter = counter; }
+
     void reset_wg_wptr() { _wg_wptr.reset(); }
 
     // Note that, If call the memory allocation operation in Memory Hook,
@@ -143,6 +148,7 @@ private:
 
     std::shared_ptr<MemTrackerLimiter> _limiter_tracker;
     std::vector<MemTracker*> _consumer_tracker_stack;
+    OperatorMemCounter* _operator_mem_counter = nullptr;
     std::weak_ptr<WorkloadGroup> _wg_wptr;
 
     // If there is a memory new/delete operation in the consume method, it may enter infinite recursion.
@@ -184,6 +190,9 @@ inline void ThreadMemTrackerMgr::consume(int64_t size, int skip_large_memory_che
     for (auto* tracker : _consumer_tracker_stack) {
         tracker->consume(size);
     }
+    if (_operator_mem_counter != nullptr) {
+        _operator_mem_counter->consume(size);
+    }
 
     if (_reserved_mem != 0) {
         if (_reserved_mem > size) {
@@ -273,6 +273,26 @@ std::string QueryContext::print_all_pipeline_context() {
     return fmt::to_string(debug_string_buffer);
 }
 
+std::string QueryContext::print_all_pipeline_memory() {
+    std::vector<std::weak_ptr<pipeline::PipelineFragmentContext>> ctx_to_print;
+    {
+        std::lock_guard<std::mutex> lock(_pipeline_map_write_lock);
+        for (auto& [f_id, f_context] : _fragment_id_to_pipeline_ctx) {
+            ctx_to_print.push_back(f_context);
+        }
+    }
+    fmt::memory_buffer debug_string_buffer;
+    fmt::format_to(debug_string_buffer, "Query {}: {}\n", print_id(_query_id),
+                   query_mem_tracker->make_profile_str());
+    for (auto& f_context : ctx_to_print) {
+        if (auto pipeline_ctx = f_context.lock()) {
+            fmt::format_to(debug_string_buffer, "Fragment {}:\n{}", pipeline_ctx->get_fragment_id(),
+                           pipeline_ctx->memory_debug_string());
+        }
+    }
+    return fmt::to_string(debug_string_buffer);
+}
+
 void QueryContext::set_pipeline_context(
         const int fragment_id, std::shared_ptr<pipeline::PipelineFragmentContext> pip_ctx) {
     std::lock_guard<std::mutex> lock(_pipeline_map_write_lock);
@@ -348,15 +348,23 @@ Status RuntimeFilterMergeControllerEntity::merge(std::weak_ptr<QueryContext> que
         }
     }
     cnt_val = iter->second.cnt_val;
+    bool is_broadcast_join = cnt_val->runtime_filter_desc.is_broadcast_join;
+    MergeRuntimeFilterParams params(request, attach_data);
+    RuntimeFilterWrapperHolder holder;
+    if (!is_broadcast_join) {
+        // Deserialize out of the lock, so the partial filters of all producers are decoded
+        // by the rpc threads in parallel and only merge_from() is serialized.
+        RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(&params, holder.getHandle()));
+    }
     {
         std::lock_guard<std::mutex> l(*iter->second.mutex);
-        // Skip the other broadcast join runtime filter
-        if (cnt_val->arrive_id.size() == 1 && cnt_val->runtime_filter_desc.is_broadcast_join) {
-            return Status::OK();
+        if (is_broadcast_join) {
+            // Skip the other broadcast join runtime filter
+            if (cnt_val->arrive_id.size() == 1) {
+                return Status::OK();
+            }
+            RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(&params, holder.getHandle()));
         }
-        MergeRuntimeFilterParams params(request, attach_data);
-        RuntimeFilterWrapperHolder holder;
-        RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(&params, holder.getHandle()));
 
         RETURN_IF_ERROR(cnt_val->filter->merge_from(holder.getHandle()->get()));
 
@@ -246,6 +246,7 @@ Status RuntimePredicate::update(const Field& value) {
 
         ((SharedPredicate*)ctx.predicate.get())->set_nested(pred.release());
     }
+    _version.fetch_add(1, std::memory_order_release);
     return Status::OK();
 }
 
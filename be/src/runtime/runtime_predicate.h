@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -85,6 +86,10 @@ public:
         return _has_value;
     }
 
+    // Incremented every time the threshold tightens, readers that cache what the predicate
+    // pruned compare it to know when to prune again.
+    uint64_t version() const { return _version.load(std::memory_order_acquire); }
+
     Field get_value() const {
         std::shared_lock<std::shared_mutex> rlock(_rwlock);
         return _orderby_extrem;
@@ -157,6 +162,7 @@ private:
     bool _detected_source = false;
     bool _detected_target = false;
     bool _has_value = false;
+    std::atomic<uint64_t> _version {0};
 };
 
 } // namespace vectorized
@@ -105,6 +105,11 @@
     auto VARNAME_LINENUM(scoped_tls_cmtbh) = doris::ScopedInitThreadContext()
 #endif
 
+// Attribute the memory consumed by this thread in the scope to a pipeline operator,
+// nest-able, the outer operator is restored when the scope exits.
+#define SCOPED_ATTRIBUTE_OPERATOR_MEMORY(counter) \
+    auto VARNAME_LINENUM(scope_operator_mem) = doris::ScopedOperatorMemCounter(counter)
+
 #define SCOPED_SKIP_MEMORY_CHECK() \
     auto VARNAME_LINENUM(scope_skip_memory_check) = doris::ScopeSkipMemoryCheck()
 
@@ -522,6 +527,32 @@ private:
     std::shared_ptr<MemTracker> _mem_tracker;
 };
 
+class ScopedOperatorMemCounter {
+public:
+    explicit ScopedOperatorMemCounter(OperatorMemCounter* counter) {
+        if (!config::enable_operator_memory_attribution) {
+            return;
+        }
+        ThreadLocalHandle::create_thread_local_if_not_exits();
+        _attached = true;
+        auto* mgr = thread_context()->thread_mem_tracker_mgr.get();
+        _last_counter = mgr->operator_mem_counter();
+        mgr->set_operator_mem_counter(counter);
+    }
+
+    ~ScopedOperatorMemCounter() {
+        if (!_attached) {
+            return;
+        }
+        thread_context()->thread_mem_tracker_mgr->set_operator_mem_counter(_last_counter);
+        ThreadLocalHandle::del_thread_local_if_count_is_zero();
+    }
+
+private:
+    bool _attached = false;
+    OperatorMemCounter* _last_counter = nullptr;
+};
+
 class ScopeSkipMemoryCheck {
 public:
     explicit ScopeSkipMemoryCheck() {
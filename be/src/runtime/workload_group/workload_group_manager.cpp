@@ -17,16 +17,22 @@
 
 #include "workload_group_manager.h"
 
+#include <boost/algorithm/string.hpp>
+
 #include <algorithm>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <unordered_map>
 
+#include "agent/cgroup_cpu_ctl.h"
+#include "common/config.h"
 #include "exec/schema_scanner/schema_scanner_helper.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
 #include "runtime/workload_group/workload_group_metrics.h"
+#include "util/cpu_info.h"
 #include "util/mem_info.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -160,6 +166,153 @@ void WorkloadGroupMgr::delete_workload_group_by_ids(std::set<uint64_t> used_wg_i
               << ", before wg size=" << old_wg_size << ", after wg size=" << new_wg_size;
 }
 
+std::map<std::string, int> WorkloadGroupMgr::parse_dedicated_cores(const std::string& conf) {
+    std::map<std::string, int> requests;
+    std::vector<std::string> items;
+    boost::split(items, conf, boost::is_any_of(","));
+    for (auto& item : items) {
+        boost::algorithm::trim(item);
+        if (item.empty()) {
+            continue;
+        }
+        auto pos = item.rfind(':');
+        std::string name = pos == std::string::npos ? "" : item.substr(0, pos);
+        boost::algorithm::trim(name);
+        int num_cores = 0;
+        try {
+            num_cores = pos == std::string::npos ? 0 : std::stoi(item.substr(pos + 1));
+        } catch (const std::exception&) {
+            num_cores = 0;
+        }
+        if (name.empty() || num_cores <= 0) {
+            LOG(WARNING) << "invalid item in workload_group_dedicated_cores: " << item;
+            continue;
+        }
+        requests[name] = num_cores;
+    }
+    return requests;
+}
+
+DedicatedCoresPlan WorkloadGroupMgr::plan_dedicated_cores(
+        const std::map<std::string, int>& requests,
+        const std::vector<std::vector<int>>& numa_node_cores) {
+    DedicatedCoresPlan plan;
+    std::vector<std::vector<int>> free_cores = numa_node_cores;
+    size_t total_free = 0;
+    for (auto& cores : free_cores) {
+        std::sort(cores.begin(), cores.end());
+        total_free += cores.size();
+    }
+
+    // larger groups first, so they are more likely to fit in one numa node
+    std::vector<std::pair<std::string, int>> sorted_requests(requests.begin(), requests.end());
+    std::stable_sort(sorted_requests.begin(), sorted_requests.end(),
+                     [](const auto& a, const auto& b) { return a.second > b.second; });
+
+    for (const auto& [name, num_cores] : sorted_requests) {
+        // always keep one core for the groups without dedicated cores
+        size_t need = std::min(static_cast<size_t>(num_cores), total_free > 0 ? total_free - 1 : 0);
+        if (need < static_cast<size_t>(num_cores)) {
+            LOG(WARNING) << "not enough cores for workload group " << name << ", request "
+                         << num_cores << ", got " << need;
+        }
+        if (need == 0) {
+            continue;
+        }
+        auto& cores = plan.group_cores[name];
+        while (cores.size() < need) {
+            auto node = std::max_element(
+                    free_cores.begin(), free_cores.end(),
+                    [](const auto& a, const auto& b) { return a.size() < b.size(); });
+            size_t take = std::min(need - cores.size(), node->size());
+            cores.insert(cores.end(), node->begin(), node->begin() + take);
+            node->erase(node->begin(), node->begin() + take);
+        }
+        std::sort(cores.begin(), cores.end());
+        total_free -= need;
+    }
+
+    for (const auto& cores : free_cores) {
+        plan.shared_cores.insert(plan.shared_cores.end(), cores.begin(), cores.end());
+    }
+    std::sort(plan.shared_cores.begin(), plan.shared_cores.end());
+    return plan;
+}
+
+std::string WorkloadGroupMgr::to_cpuset_list(const std::vector<int>& ids) {
+    std::string list;
+    size_t i = 0;
+    while (i < ids.size()) {
+        size_t j = i;
+        while (j + 1 < ids.size() && ids[j + 1] == ids[j] + 1) {
+            j++;
+        }
+        if (!list.empty()) {
+            list += ",";
+        }
+        list += std::to_string(ids[i]);
+        if (j > i) {
+            list += "-" + std::to_string(ids[j]);
+        }
+        i = j + 1;
+    }
+    return list;
+}
+
+void WorkloadGroupMgr::rebalance_dedicated_cores() {
+    std::map<std::string, int> requests =
+            parse_dedicated_cores(config::workload_group_dedicated_cores);
+    if (requests.empty() && !_dedicated_cores_applied) {
+        return;
+    }
+
+    std::vector<WorkloadGroupPtr> workload_groups;
+    {
+        std::shared_lock<std::shared_mutex> r_lock(_group_mutex);
+        for (const auto& [id, wg] : _workload_groups) {
+            workload_groups.push_back(wg);
+        }
+    }
+
+    std::vector<std::vector<int>> numa_node_cores;
+    for (int node = 0; node < CpuInfo::get_max_num_numa_nodes(); node++) {
+        numa_node_cores.push_back(CpuInfo::get_cores_of_numa_node(node));
+    }
+    // only plan for the groups which exist in this BE, the cores of unknown groups are shared
+    std::map<std::string, int> existing_requests;
+    for (const auto& wg : workload_groups) {
+        auto iter = requests.find(wg->name());
+        if (iter != requests.end()) {
+            existing_requests.insert(*iter);
+        }
+    }
+    DedicatedCoresPlan plan = plan_dedicated_cores(existing_requests, numa_node_cores);
+
+    auto to_mems = [](const std::vector<int>& cores) {
+        std::set<int> nodes;
+        for (int core : cores) {
+            nodes.insert(CpuInfo::get_numa_node_of_core(core));
+        }
+        return to_cpuset_list(std::vector<int>(nodes.begin(), nodes.end()));
+    };
+    // without any dedicated group, empty cpuset means inheriting all the cores of parent
+    std::string shared_cpus = requests.empty() ? "" : to_cpuset_list(plan.shared_cores);
+    std::string shared_mems = requests.empty() ? "" : to_mems(plan.shared_cores);
+    for (const auto& wg : workload_groups) {
+        auto cg_cpu_ctl = wg->get_cgroup_cpu_ctl_wptr().lock();
+        if (cg_cpu_ctl == nullptr) {
+            continue;
+        }
+        auto iter = plan.group_cores.find(wg->name());
+        if (iter != plan.group_cores.end()) {
+            cg_cpu_ctl->update_cpuset(to_cpuset_list(iter->second), to_mems(iter->second));
+        } else {
+            cg_cpu_ctl->update_cpuset(shared_cpus, shared_mems);
+        }
+    }
+    _dedicated_cores_applied = !requests.empty();
+}
+
 void WorkloadGroupMgr::do_sweep() {
     std::shared_lock<std::shared_mutex> r_lock(_group_mutex);
     for (auto& [wg_id, wg] : _workload_groups) {
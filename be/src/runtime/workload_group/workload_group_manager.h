@@ -18,8 +18,11 @@
 
 #include <stdint.h>
 
+#include <map>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "workload_group.h"
 
@@ -41,6 +44,14 @@ const static uint64_t INTERNAL_WORKLOAD_GROUP_ID =
         static_cast<uint64_t>(TWorkloadType::type::INTERNAL);
 const static std::string INTERNAL_WORKLOAD_GROUP_NAME = "_internal";
 
+// How the cores are split by `workload_group_dedicated_cores`.
+struct DedicatedCoresPlan {
+    // group name -> the cores only used by this group
+    std::map<std::string, std::vector<int>> group_cores;
+    // the cores shared by all the groups without dedicated cores
+    std::vector<int> shared_cores;
+};
+
 class WorkloadGroupMgr {
 public:
     WorkloadGroupMgr() = default;
@@ -78,11 +89,30 @@ public:
 
     void refresh_workload_group_metrics();
 
+    // Pin the threads of every workload group to its cpuset according to
+    // `workload_group_dedicated_cores`, called after the workload groups are updated.
+    void rebalance_dedicated_cores();
+
+    // "name:num_cores,..." -> {name: num_cores}, invalid items are skipped.
+    static std::map<std::string, int> parse_dedicated_cores(const std::string& conf);
+
+    // Groups are placed in the numa node with the most free cores and only spill to other
+    // nodes when no node is large enough. At least one core is left as shared core.
+    static DedicatedCoresPlan plan_dedicated_cores(
+            const std::map<std::string, int>& requests,
+            const std::vector<std::vector<int>>& numa_node_cores);
+
+    // {0, 1, 2, 5} -> "0-2,5"
+    static std::string to_cpuset_list(const std::vector<int>& ids);
+
 private:
     std::shared_mutex _group_mutex;
     std::unordered_map<uint64_t, WorkloadGroupPtr> _workload_groups;
 
     std::shared_mutex _clear_cgroup_lock;
+
+    // whether some group has been pinned by rebalance_dedicated_cores
+    bool _dedicated_cores_applied = false;
 };
 
 } // namespace doris
@@ -84,6 +84,9 @@ Status BRpcService::start(int port, int num_threads) {
     }
 
     options.has_builtin_services = config::enable_brpc_builtin_services;
+#ifdef BRPC_WITH_RDMA
+    options.use_rdma = config::enable_brpc_rdma;
+#endif
 
     butil::EndPoint point;
     if (butil::str2endpoint(BackendOptions::get_service_bind_address(), port, &point) < 0) {
@@ -183,6 +183,20 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::GET, "/api/query_pipeline_tasks/{query_id}",
                                       query_pipeline_task_action);
 
+    // Dump the memory of pipeline operators of all running queries, or of one query
+    QueryMemoryAction* query_memory_action = _pool.add(new QueryMemoryAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_memory", query_memory_action);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_memory/{query_id}",
+                                      query_memory_action);
+
+    // Dump the sampled CPU of pipeline threads as collapsed stacks, of all queries or of one
+    QueryCpuSamplesAction* query_cpu_samples_action =
+            _pool.add(new QueryCpuSamplesAction(_env));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_cpu_samples",
+                                      query_cpu_samples_action);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_cpu_samples/{query_id}",
+                                      query_cpu_samples_action);
+
     // Dump all be process thread num
     BeProcThreadAction* be_proc_thread_action = _pool.add(new BeProcThreadAction(_env));
     _ev_http_server->register_handler(HttpMethod::GET, "/api/be_process_thread_num",
@@ -26,8 +26,11 @@
 #include <google/protobuf/extension_set.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <climits>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -396,7 +399,15 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Probe keys in ascending order, so that the primary key index iterator of a segment keeps
+    // its decoded data page for the following keys of a batch.
+    std::vector<size_t> key_order(_row_read_ctxs.size());
+    std::iota(key_order.begin(), key_order.end(), 0);
+    std::sort(key_order.begin(), key_order.end(), [&](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    segment_v2::PrimaryKeyIteratorCache pk_iterators;
+    for (size_t i : key_order) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -413,7 +424,7 @@ Status PointQueryExecutor::_lookup_row_key() {
         st = (_tablet->lookup_row_key(_row_read_ctxs[i]._primary_key, nullptr, false,
                                       specified_rowsets, &location, INT32_MAX /*rethink?*/,
                                       segment_caches, rowset_ptr.get(), false, nullptr,
-                                      &_profile_metrics.read_stats));
+                                      &_profile_metrics.read_stats, nullptr, &pk_iterators));
         if (st.is<ErrorCode::KEY_NOT_FOUND>()) {
             continue;
         }
@@ -429,9 +440,54 @@ Status PointQueryExecutor::_lookup_row_key() {
     return Status::OK();
 }
 
+Status PointQueryExecutor::_batch_read_row_store(
+        std::vector<StringRef>* values, std::vector<vectorized::MutableColumnPtr>* columns) {
+    // group the located rows by segment
+    std::map<std::pair<const Rowset*, uint32_t>, std::vector<size_t>> segment_rows;
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        const auto& ctx = _row_read_ctxs[i];
+        if (ctx._cached_row_data.valid() || !ctx._row_location.has_value()) {
+            continue;
+        }
+        segment_rows[{ctx._rowset_ptr->get(), ctx._row_location->segment_id}].push_back(i);
+    }
+    bool use_row_cache = !config::disable_storage_row_cache;
+    for (const auto& [segment, ctx_indexes] : segment_rows) {
+        const auto& first_ctx = _row_read_ctxs[ctx_indexes.front()];
+        std::vector<segment_v2::rowid_t> row_ids;
+        row_ids.reserve(ctx_indexes.size());
+        for (size_t i : ctx_indexes) {
+            row_ids.push_back(
+                    static_cast<segment_v2::rowid_t>(_row_read_ctxs[i]._row_location->row_id));
+        }
+        std::sort(row_ids.begin(), row_ids.end());
+        row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+        vectorized::MutableColumnPtr column;
+        RETURN_IF_ERROR(_tablet->lookup_rows_data(*first_ctx._rowset_ptr, segment.second, row_ids,
+                                                  _profile_metrics.read_stats, column));
+        for (size_t i : ctx_indexes) {
+            auto row_id = static_cast<segment_v2::rowid_t>(_row_read_ctxs[i]._row_location->row_id);
+            size_t pos = std::lower_bound(row_ids.begin(), row_ids.end(), row_id) - row_ids.begin();
+            (*values)[i] = column->get_data_at(pos);
+            if (use_row_cache) {
+                RowCache::instance()->insert({_tablet->tablet_id(), _row_read_ctxs[i]._primary_key},
+                                             Slice {(*values)[i].data, (*values)[i].size});
+            }
+        }
+        columns->push_back(std::move(column));
+    }
+    return Status::OK();
+}
+
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    // Row store values of the keys not in row cache, read in one pass per segment
+    std::vector<StringRef> row_store_values(_row_read_ctxs.size());
+    std::vector<vectorized::MutableColumnPtr> row_store_columns;
+    if (_reusable->rs_column_uid() != -1) {
+        RETURN_IF_ERROR(_batch_read_row_store(&row_store_values, &row_store_columns));
+    }
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -445,14 +501,9 @@ Status PointQueryExecutor::_lookup_row_data() {
         if (!_row_read_ctxs[i]._row_location.has_value()) {
             continue;
         }
-        std::string value;
         // fill block by row store
         if (_reusable->rs_column_uid() != -1) {
-            bool use_row_cache = !config::disable_storage_row_cache;
-            RETURN_IF_ERROR(_tablet->lookup_row_data(
-                    _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                    *(_row_read_ctxs[i]._rowset_ptr), _reusable->tuple_desc(),
-                    _profile_metrics.read_stats, value, use_row_cache));
+            const StringRef& value = row_store_values[i];
             // serilize value to block, currently only jsonb row formt
             vectorized::JsonbSerializeUtil::jsonb_to_block(
                     _reusable->get_data_type_serdes(), value.data(), value.size(),
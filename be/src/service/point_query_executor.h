@@ -311,6 +311,10 @@ private:
     Status _lookup_row_key();
 
     Status _lookup_row_data();
+    // Reads the row store values of the located rows, a segment is read once for all its rows.
+    // `values` point into `columns`.
+    Status _batch_read_row_store(std::vector<StringRef>* values,
+                                 std::vector<vectorized::MutableColumnPtr>* columns);
 
     Status _output_data();
 
@@ -0,0 +1,263 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/strings/split.h"
+#include "io/fs/local_file_system.h"
+#include "io/io_common.h"
+#include "olap/block_column_predicate.h"
+#include "olap/delete_handler.h"
+#include "olap/iterators.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/predicate_creator.h"
+#include "olap/rowset/segment_v2/segment.h"
+#include "olap/schema.h"
+#include "olap/tablet_column_object_pool.h"
+#include "olap/tablet_meta.h"
+#include "olap/tablet_schema.h"
+#include "olap/tablet_schema_cache.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/cache_manager.h"
+#include "runtime/thread_context.h"
+#include "vec/common/arena.h"
+#include "vec/core/block.h"
+
+DEFINE_string(pb_meta_path, "", "pb tablet meta file, provides the schema of the segments");
+DEFINE_string(files, "", "comma separated segment file paths");
+DEFINE_string(columns, "", "comma separated columns to read, all columns if empty");
+DEFINE_string(conditions, "",
+              "semicolon separated predicates in delete condition syntax, e.g. "
+              "\"k1>>10;k2*=a\", see DeleteHandler::parse_condition");
+DEFINE_int32(iterations, 3, "read every segment this many times");
+DEFINE_int32(batch_size, 4064, "rows per block");
+DEFINE_bool(use_page_cache, true, "read through the storage page cache");
+DEFINE_int64(page_cache_mb, 1024, "storage page cache capacity");
+
+using doris::Status;
+using doris::OlapReaderStatistics;
+
+namespace {
+
+std::string get_usage(const std::string& progname) {
+    std::stringstream ss;
+    ss << progname << " reads segment files the way a scan does and reports the throughput.\n";
+    ss << "Usage:\n";
+    ss << "./segment_benchmark_tool --pb_meta_path=path --files=seg0,seg1 "
+          "[--columns=k1,v1] [--conditions=\"k1>>10\"] [--iterations=3] "
+          "[--use_page_cache=false]\n";
+    return ss.str();
+}
+
+void init_env() {
+    doris::ThreadLocalHandle::create_thread_local_if_not_exits();
+    auto* env = doris::ExecEnv::GetInstance();
+    env->init_mem_tracker();
+    doris::thread_context()->thread_mem_tracker_mgr->init();
+    env->set_cache_manager(doris::CacheManager::create_global_instance());
+    env->set_storage_page_cache(
+            doris::StoragePageCache::create_global_cache(FLAGS_page_cache_mb << 20, 10, 0));
+    env->set_tablet_schema_cache(doris::TabletSchemaCache::create_global_schema_cache(
+            doris::config::tablet_schema_cache_capacity));
+    env->set_tablet_column_object_pool(doris::TabletColumnObjectPool::create_global_column_cache(
+            doris::config::tablet_schema_cache_capacity));
+}
+
+Status build_predicates(const doris::TabletSchemaSPtr& schema, doris::vectorized::Arena* arena,
+                        std::vector<std::unique_ptr<doris::ColumnPredicate>>* predicates) {
+    std::vector<std::string> conditions =
+            strings::Split(FLAGS_conditions, ";", strings::SkipEmpty());
+    for (const auto& condition_str : conditions) {
+        doris::TCondition condition;
+        RETURN_IF_ERROR(doris::DeleteHandler::parse_condition(condition_str, &condition));
+        const int32_t index = schema->field_index(condition.column_name);
+        if (index < 0) {
+            return Status::InvalidArgument("unknown column {} in condition {}",
+                                           condition.column_name, condition_str);
+        }
+        predicates->emplace_back(doris::parse_to_predicate(
+                schema->column(index), static_cast<uint32_t>(index), condition, arena));
+    }
+    return Status::OK();
+}
+
+Status read_segment(const std::string& file, const doris::TabletSchemaSPtr& tablet_schema,
+                    const std::vector<uint32_t>& return_columns,
+                    const std::vector<doris::ColumnPredicate*>& predicates,
+                    OlapReaderStatistics* stats, doris::io::FileCacheStatistics* cache_stats,
+                    int64_t* rows) {
+    std::shared_ptr<doris::segment_v2::Segment> segment;
+    RETURN_IF_ERROR(doris::segment_v2::Segment::open(
+            doris::io::global_local_filesystem(), file, 0, 0, doris::RowsetId {}, tablet_schema,
+            doris::io::FileReaderOptions {}, &segment));
+
+    doris::StorageReadOptions opts;
+    opts.stats = stats;
+    opts.tablet_schema = tablet_schema;
+    opts.use_page_cache = FLAGS_use_page_cache;
+    opts.block_row_max = FLAGS_batch_size;
+    opts.io_ctx.reader_type = doris::ReaderType::READER_QUERY;
+    opts.io_ctx.file_cache_stats = cache_stats;
+    opts.column_predicates = predicates;
+    for (auto* pred : predicates) {
+        auto& block_pred = opts.col_id_to_predicates[pred->column_id()];
+        if (block_pred == nullptr) {
+            block_pred = doris::AndBlockColumnPredicate::create_shared();
+        }
+        block_pred->add_column_predicate(doris::SingleColumnBlockPredicate::create_unique(pred));
+    }
+
+    auto schema = std::make_shared<doris::Schema>(tablet_schema->columns(), return_columns);
+    std::unique_ptr<doris::RowwiseIterator> iter;
+    RETURN_IF_ERROR(segment->new_iterator(schema, opts, &iter));
+    auto block = tablet_schema->create_block(return_columns);
+    while (true) {
+        Status st = iter->next_batch(&block);
+        if (st.is<doris::ErrorCode::END_OF_FILE>()) {
+            break;
+        }
+        RETURN_IF_ERROR(st);
+        *rows += static_cast<int64_t>(block.rows());
+        block.clear_column_data();
+    }
+    return Status::OK();
+}
+
+double per_second(int64_t value, double seconds) {
+    return seconds > 0 ? static_cast<double>(value) / seconds : 0;
+}
+
+void print_report(const OlapReaderStatistics& stats,
+                  const doris::io::FileCacheStatistics& cache_stats, int64_t rows,
+                  double seconds) {
+    const auto ms = [](int64_t ns) { return static_cast<double>(ns) / 1e6; };
+    std::cout << "rows: " << rows << ", elapsed: " << seconds << "s\n";
+    std::cout << "rows/s: " << per_second(rows, seconds) << "\n";
+    std::cout << "compressed bytes/s: " << per_second(stats.compressed_bytes_read, seconds)
+              << ", uncompressed bytes/s: " << per_second(stats.uncompressed_bytes_read, seconds)
+              << "\n";
+    std::cout << "raw rows read: " << stats.raw_rows_read
+              << ", rows filtered by zone map: " << stats.rows_stats_filtered
+              << ", by bloom filter: " << stats.rows_bf_filtered
+              << ", by inverted index: " << stats.rows_inverted_index_filtered
+              << ", by vectorized predicates: " << stats.rows_vec_cond_filtered
+              << ", by short circuit predicates: " << stats.rows_short_circuit_cond_filtered
+              << "\n";
+    std::cout << "io: " << ms(stats.io_ns) << "ms, decompress: " << ms(stats.decompress_ns)
+              << "ms, block init: " << ms(stats.block_init_ns)
+              << "ms, generate row ranges: " << ms(stats.generate_row_ranges_ns)
+              << "ms, block load: " << ms(stats.block_load_ns)
+              << "ms, predicate column read: " << ms(stats.predicate_column_read_ns)
+              << "ms, non predicate read: " << ms(stats.non_predicate_read_ns)
+              << "ms, lazy read: " << ms(stats.lazy_read_ns)
+              << "ms, vectorized predicates: " << ms(stats.vec_cond_ns)
+              << "ms, short circuit predicates: " << ms(stats.short_cond_ns)
+              << "ms, output columns: " << ms(stats.output_col_ns) << "ms\n";
+    std::cout << "page cache hit rate: "
+              << (stats.total_pages_num > 0 ? static_cast<double>(stats.cached_pages_num) /
+                                                      static_cast<double>(stats.total_pages_num)
+                                            : 0)
+              << " (" << stats.cached_pages_num << "/" << stats.total_pages_num << " pages)\n";
+    const int64_t cache_bytes =
+            cache_stats.bytes_read_from_local + cache_stats.bytes_read_from_remote;
+    std::cout << "file cache hit rate: "
+              << (cache_bytes > 0 ? static_cast<double>(cache_stats.bytes_read_from_local) /
+                                            static_cast<double>(cache_bytes)
+                                  : 0)
+              << " (local " << cache_stats.bytes_read_from_local << " bytes, remote "
+              << cache_stats.bytes_read_from_remote << " bytes)" << std::endl;
+}
+
+Status run() {
+    doris::TabletMeta tablet_meta;
+    RETURN_IF_ERROR(tablet_meta.create_from_file(FLAGS_pb_meta_path));
+    const auto& tablet_schema = tablet_meta.tablet_schema();
+
+    std::vector<uint32_t> return_columns;
+    std::vector<std::string> columns = strings::Split(FLAGS_columns, ",", strings::SkipEmpty());
+    for (const auto& name : columns) {
+        const int32_t index = tablet_schema->field_index(name);
+        if (index < 0) {
+            return Status::InvalidArgument("unknown column {}", name);
+        }
+        return_columns.push_back(static_cast<uint32_t>(index));
+    }
+    if (return_columns.empty()) {
+        for (uint32_t i = 0; i < tablet_schema->num_columns(); ++i) {
+            return_columns.push_back(i);
+        }
+    }
+
+    doris::vectorized::Arena arena;
+    std::vector<std::unique_ptr<doris::ColumnPredicate>> owned_predicates;
+    RETURN_IF_ERROR(build_predicates(tablet_schema, &arena, &owned_predicates));
+    std::vector<doris::ColumnPredicate*> predicates;
+    // the segment iterator evaluates predicates on the columns it reads
+    for (const auto& pred : owned_predicates) {
+        predicates.push_back(pred.get());
+        if (std::find(return_columns.begin(), return_columns.end(), pred->column_id()) ==
+            return_columns.end()) {
+            return_columns.push_back(pred->column_id());
+        }
+    }
+
+    std::vector<std::string> files = strings::Split(FLAGS_files, ",", strings::SkipEmpty());
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        OlapReaderStatistics stats;
+        doris::io::FileCacheStatistics cache_stats;
+        int64_t rows = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& file : files) {
+            RETURN_IF_ERROR(read_segment(file, tablet_schema, return_columns, predicates, &stats,
+                                         &cache_stats, &rows));
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "== iteration " << i << " ==\n";
+        print_report(stats, cache_stats, rows, elapsed.count());
+    }
+    return Status::OK();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    gflags::SetUsageMessage(get_usage(argv[0]));
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    if (FLAGS_pb_meta_path.empty() || FLAGS_files.empty()) {
+        std::cout << get_usage(argv[0]);
+        return -1;
+    }
+
+    init_env();
+    Status st = run();
+    if (!st.ok()) {
+        std::cout << "benchmark failed: " << st << std::endl;
+        return -1;
+    }
+    return 0;
+}
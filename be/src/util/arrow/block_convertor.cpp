@@ -22,9 +22,12 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
+#include <arrow/util/bit_util.h>
 #include <arrow/util/decimal.h>
 #include <arrow/visit_type_inline.h>
 #include <arrow/visitor.h>
@@ -49,8 +52,10 @@
 #include "util/types.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_decimal.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -66,18 +71,30 @@ class Array;
 
 namespace doris {
 
+// Arrow buffer over the memory of a column, which is kept alive as long as the buffer.
+class ColumnBuffer final : public arrow::Buffer {
+public:
+    ColumnBuffer(vectorized::ColumnPtr column, const uint8_t* data, int64_t size)
+            : arrow::Buffer(data, size), _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
 // Convert Block to an Arrow::Array
 // We should keep this function to keep compatible with arrow's type visitor
 // Now we inherit TypeVisitor to use default Visit implementation
 class FromBlockConverter : public arrow::TypeVisitor {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
-                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj)
+                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj,
+                       bool zero_copy)
             : _block(block),
               _schema(schema),
               _pool(pool),
               _cur_field_idx(-1),
-              _timezone_obj(timezone_obj) {}
+              _timezone_obj(timezone_obj),
+              _zero_copy(zero_copy) {}
 
     ~FromBlockConverter() override = default;
 
@@ -326,6 +343,17 @@ public:
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Build the array of a fixed-width column over the column memory, only the validity
+    // bitmap is allocated. Return false if the column layout does not match `type`.
+    bool _zero_copy_array(const vectorized::ColumnPtr& column,
+                          const std::shared_ptr<arrow::DataType>& type,
+                          std::shared_ptr<arrow::Array>* out);
+
+    template <typename ColumnType>
+    bool _zero_copy_array(const vectorized::ColumnPtr& column,
+                          const std::shared_ptr<arrow::DataType>& type,
+                          std::shared_ptr<arrow::Array>* out);
+
     template <typename T>
     arrow::Status _visit(const T& type) {
         auto& builder = assert_cast<arrow::NumericBuilder<T>&>(*_cur_builder);
@@ -361,10 +389,72 @@ private:
     arrow::ArrayBuilder* _cur_builder = nullptr;
 
     const cctz::time_zone& _timezone_obj;
+    const bool _zero_copy;
 
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
 
+bool FromBlockConverter::_zero_copy_array(const vectorized::ColumnPtr& column,
+                                          const std::shared_ptr<arrow::DataType>& type,
+                                          std::shared_ptr<arrow::Array>* out) {
+    switch (type->id()) {
+    case arrow::Type::INT8:
+        return _zero_copy_array<vectorized::ColumnInt8>(column, type, out);
+    case arrow::Type::INT16:
+        return _zero_copy_array<vectorized::ColumnInt16>(column, type, out);
+    case arrow::Type::INT32:
+        return _zero_copy_array<vectorized::ColumnInt32>(column, type, out);
+    case arrow::Type::INT64:
+        return _zero_copy_array<vectorized::ColumnInt64>(column, type, out);
+    case arrow::Type::FLOAT:
+        return _zero_copy_array<vectorized::ColumnFloat32>(column, type, out);
+    case arrow::Type::DOUBLE:
+        return _zero_copy_array<vectorized::ColumnFloat64>(column, type, out);
+    default:
+        return false;
+    }
+}
+
+template <typename ColumnType>
+bool FromBlockConverter::_zero_copy_array(const vectorized::ColumnPtr& column,
+                                          const std::shared_ptr<arrow::DataType>& type,
+                                          std::shared_ptr<arrow::Array>* out) {
+    const auto* nullable_column =
+            vectorized::check_and_get_column<vectorized::ColumnNullable>(*column);
+    vectorized::ColumnPtr nested_column =
+            nullable_column ? nullable_column->get_nested_column_ptr() : column;
+    const auto* data_column = vectorized::check_and_get_column<ColumnType>(*nested_column);
+    if (data_column == nullptr) {
+        return false;
+    }
+    const auto& data = data_column->get_data();
+    auto rows = static_cast<int64_t>(data.size());
+    auto values = std::make_shared<ColumnBuffer>(
+            nested_column, reinterpret_cast<const uint8_t*>(data.data()),
+            rows * static_cast<int64_t>(sizeof(typename ColumnType::value_type)));
+
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (nullable_column != nullptr && nullable_column->has_null()) {
+        auto bitmap = arrow::AllocateEmptyBitmap(rows, _pool);
+        if (!bitmap.ok()) {
+            return false;
+        }
+        uint8_t* bits = (*bitmap)->mutable_data();
+        const auto& null_map = nullable_column->get_null_map_data();
+        for (int64_t i = 0; i < rows; ++i) {
+            if (null_map[i]) {
+                ++null_count;
+            } else {
+                arrow::bit_util::SetBit(bits, i);
+            }
+        }
+        validity = std::move(*bitmap);
+    }
+    *out = arrow::MakeArray(arrow::ArrayData::Make(type, rows, {validity, values}, null_count));
+    return true;
+}
+
 Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     size_t num_fields = _schema->num_fields();
     if (_block.columns() != num_fields) {
@@ -379,6 +469,10 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         _cur_rows = _block.rows();
         _cur_col = _block.get_by_position(idx).column;
         _cur_type = _block.get_by_position(idx).type;
+        if (_zero_copy && !is_column_const(*_cur_col) &&
+            _zero_copy_array(_cur_col, _schema->field(idx)->type(), &_arrays[idx])) {
+            continue;
+        }
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, _schema->field(idx)->type(), &builder);
         if (!arrow_st.ok()) {
@@ -407,8 +501,8 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj) {
-    FromBlockConverter converter(block, schema, pool, timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy) {
+    FromBlockConverter converter(block, schema, pool, timezone_obj, zero_copy);
     return converter.convert(result);
 }
 
@@ -38,9 +38,12 @@ class Schema;
 
 namespace doris {
 
+// If `zero_copy` is true, the arrays of fixed-width numeric columns share the memory of the
+// columns in `block` instead of copying it, and keep those columns alive. The caller must not
+// mutate the columns of `block` in place while `result` is in use.
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy = false);
 
 } // namespace doris
@@ -34,6 +34,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -665,10 +666,22 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // Group the 32-bit bitmaps of all inputs by their high 32 bits, and union each group
+        // at once with roaring::Roaring::fastunion, which unions lazily and repairs the
+        // cardinalities only once at the end.
+        std::map<uint32_t, std::vector<const roaring::Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [high_bytes, group] : groups) {
+            auto it = ans.roarings.emplace_hint(
+                    ans.roarings.end(), high_bytes,
+                    group.size() == 1 ? *group[0]
+                                      : roaring::Roaring::fastunion(group.size(), group.data()));
+            it->second.setCopyOnWrite(ans.copyOnWrite);
         }
         return ans;
     }
@@ -1279,9 +1292,8 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
-                }
+                bitmaps.push_back(_bitmap.get());
+                *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
                 break;
             case SET: {
                 *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
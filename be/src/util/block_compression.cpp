@@ -1036,6 +1036,11 @@ public:
 
     size_t max_compressed_len(size_t len) override { return ZSTD_compressBound(len); }
 
+    static int compression_level() {
+        return std::clamp<int>(config::ZSTD_compression_level, ZSTD_minCLevel(),
+                               ZSTD_maxCLevel());
+    }
+
     Status compress(const Slice& input, faststring* output) override {
         std::vector<Slice> inputs {input};
         return compress(inputs, input.size, output);
@@ -1073,9 +1078,8 @@ public:
                 compressed_buf.size = max_len;
             }
 
-            // set compression level to default 3
             auto ret = ZSTD_CCtx_setParameter(context->ctx, ZSTD_c_compressionLevel,
-                                              ZSTD_CLEVEL_DEFAULT);
+                                              compression_level());
             if (ZSTD_isError(ret)) {
                 return Status::InvalidArgument("ZSTD_CCtx_setParameter compression level error: {}",
                                                ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
@@ -26,6 +26,7 @@
 namespace doris {
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_endpoint_stub_count, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_stream_endpoint_stub_count, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_endpoint_data_connection_count, MetricUnit::NOUNIT);
 
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(brpc_function_endpoint_stub_count, MetricUnit::NOUNIT);
 
@@ -41,12 +42,15 @@ BrpcClientCache<PBackendService_Stub>::BrpcClientCache(std::string protocol,
                              [this]() { return _stub_map.size(); });
     } else {
         REGISTER_HOOK_METRIC(brpc_endpoint_stub_count, [this]() { return _stub_map.size(); });
+        REGISTER_HOOK_METRIC(brpc_endpoint_data_connection_count,
+                             [this]() { return data_connection_num(); });
     }
 }
 
 template <>
 BrpcClientCache<PBackendService_Stub>::~BrpcClientCache() {
     DEREGISTER_HOOK_METRIC(brpc_endpoint_stub_count);
+    DEREGISTER_HOOK_METRIC(brpc_endpoint_data_connection_count);
 }
 
 template <>
@@ -30,6 +30,8 @@
 #include <parallel_hashmap/phmap.h>
 #include <stddef.h>
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -56,6 +58,15 @@ using StubMap = phmap::parallel_flat_hash_map<
 
 namespace doris {
 
+// Whether the baidu_std brpc channels between backends use RDMA.
+inline bool brpc_use_rdma() {
+#ifdef BRPC_WITH_RDMA
+    return config::enable_brpc_rdma;
+#else
+    return false;
+#endif
+}
+
 template <class T>
 class BrpcClientCache {
 public:
@@ -83,18 +94,10 @@ public:
     }
 
     std::shared_ptr<T> get_client(const std::string& host, int port) {
-        std::string realhost = host;
-        auto dns_cache = ExecEnv::GetInstance()->dns_cache();
-        if (dns_cache == nullptr) {
-            LOG(WARNING) << "DNS cache is not initialized, skipping hostname resolve";
-        } else if (!is_valid_ip(host)) {
-            Status status = dns_cache->get(host, &realhost);
-            if (!status.ok()) {
-                LOG(WARNING) << "failed to get ip from host:" << status.to_string();
-                return nullptr;
-            }
+        std::string host_port;
+        if (!_resolve_host_port(host, port, &host_port)) {
+            return nullptr;
         }
-        std::string host_port = get_host_port(realhost, port);
         std::shared_ptr<T> stub_ptr;
         auto get_value = [&stub_ptr](const auto& v) { stub_ptr = v.second; };
         if (LIKELY(_stub_map.if_contains(host_port, get_value))) {
@@ -111,6 +114,57 @@ public:
         return stub;
     }
 
+    // Client for bulk data rpcs (transmit_block, tablet_writer_add_block). When
+    // brpc_data_connection_num > 1 they are spread round-robin over that many
+    // connections of their own, so a large message neither head-of-line blocks
+    // the control rpcs (cancel, runtime filter, report) on get_client()'s
+    // connection nor the other data rpcs to the same backend.
+    std::shared_ptr<T> get_data_client(const TNetworkAddress& taddr) {
+        if (config::brpc_data_connection_num <= 1) {
+            return get_client(taddr);
+        }
+        return get_data_client(taddr.hostname, taddr.port);
+    }
+
+    std::shared_ptr<T> get_data_client(const std::string& host, int port) {
+        size_t pool_size = std::max(config::brpc_data_connection_num, 1);
+        if (pool_size == 1) {
+            return get_client(host, port);
+        }
+        std::string host_port;
+        if (!_resolve_host_port(host, port, &host_port)) {
+            return nullptr;
+        }
+        std::shared_ptr<StubPool> pool;
+        auto get_value = [&pool](const auto& v) { pool = v.second; };
+        if (LIKELY(_data_pool_map.if_contains(host_port, get_value)) &&
+            pool->stubs.size() == pool_size) {
+            return pool->pick();
+        }
+
+        // (re)build the pool, the connection number is mutable at runtime
+        auto new_pool = std::make_shared<StubPool>();
+        for (size_t i = 0; i < pool_size; ++i) {
+            auto stub = get_new_client_no_cache(host_port, "", "",
+                                                fmt::format("{}data_{}", _connection_group, i));
+            if (stub == nullptr) {
+                return nullptr;
+            }
+            new_pool->stubs.push_back(std::move(stub));
+        }
+        _data_pool_map.try_emplace_l(
+                host_port,
+                [&new_pool, pool_size](auto& v) {
+                    if (v.second->stubs.size() == pool_size) {
+                        new_pool = v.second;
+                    } else {
+                        v.second = new_pool;
+                    }
+                },
+                new_pool);
+        return new_pool->pick();
+    }
+
     std::shared_ptr<T> get_client(const std::string& host_port) {
         int pos = host_port.rfind(':');
         std::string host = host_port.substr(0, pos);
@@ -147,6 +201,10 @@ public:
         options.connect_timeout_ms = 2000;
         options.timeout_ms = 2000;
         options.max_retry = 10;
+#ifdef BRPC_WITH_RDMA
+        // brpc only supports RDMA with the baidu_std protocol
+        options.use_rdma = brpc_use_rdma() && options.protocol == brpc::PROTOCOL_BAIDU_STD;
+#endif
 
         std::unique_ptr<brpc::Channel> channel(new brpc::Channel());
         int ret_code = 0;
@@ -165,9 +223,22 @@ public:
 
     size_t size() { return _stub_map.size(); }
 
-    void clear() { _stub_map.clear(); }
+    // Number of connections opened for data rpcs by get_data_client().
+    size_t data_connection_num() {
+        size_t num = 0;
+        _data_pool_map.for_each([&num](const auto& v) { num += v.second->stubs.size(); });
+        return num;
+    }
+
+    void clear() {
+        _stub_map.clear();
+        _data_pool_map.clear();
+    }
 
-    size_t erase(const std::string& host_port) { return _stub_map.erase(host_port); }
+    size_t erase(const std::string& host_port) {
+        _data_pool_map.erase(host_port);
+        return _stub_map.erase(host_port);
+    }
 
     size_t erase(const std::string& host, int port) {
         std::string host_port = fmt::format("{}:{}", host, port);
@@ -175,7 +246,7 @@ public:
     }
 
     size_t erase(const butil::EndPoint& endpoint) {
-        return _stub_map.erase(butil::endpoint2str(endpoint).c_str());
+        return erase(std::string(butil::endpoint2str(endpoint).c_str()));
     }
 
     bool exist(const std::string& host_port) {
@@ -223,7 +294,33 @@ public:
     }
 
 private:
+    struct StubPool {
+        std::vector<std::shared_ptr<T>> stubs;
+        std::atomic<size_t> next {0};
+
+        std::shared_ptr<T> pick() {
+            return stubs[next.fetch_add(1, std::memory_order_relaxed) % stubs.size()];
+        }
+    };
+
+    bool _resolve_host_port(const std::string& host, int port, std::string* host_port) {
+        std::string realhost = host;
+        auto dns_cache = ExecEnv::GetInstance()->dns_cache();
+        if (dns_cache == nullptr) {
+            LOG(WARNING) << "DNS cache is not initialized, skipping hostname resolve";
+        } else if (!is_valid_ip(host)) {
+            Status status = dns_cache->get(host, &realhost);
+            if (!status.ok()) {
+                LOG(WARNING) << "failed to get ip from host:" << status.to_string();
+                return false;
+            }
+        }
+        *host_port = get_host_port(realhost, port);
+        return true;
+    }
+
     StubMap<T> _stub_map;
+    StubMap<StubPool> _data_pool_map;
     const std::string _protocol;
     const std::string _connection_type;
     const std::string _connection_group;
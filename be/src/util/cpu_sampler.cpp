@@ -0,0 +1,226 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/cpu_sampler.h"
+
+#include <fmt/format.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <map>
+#include <tuple>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/hash_util.hpp"
+#include "util/time.h"
+#include "util/uid_util.h"
+#include "vec/common/demangle.h"
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+#include "common/symbol_index.h"
+#endif
+
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+
+namespace doris {
+
+// Real time signals are queued, and this one is not used by the JVM or by brpc.
+static const int CPU_SAMPLING_SIGNAL = SIGRTMIN + 4;
+
+struct CpuSamplingTimer {
+    bool armed = false;
+    timer_t timer_id {};
+};
+
+static thread_local CpuSamplingTimer cpu_sampling_timer;
+
+static void* interrupted_pc(void* context) {
+    const auto* ucontext = reinterpret_cast<const ucontext_t*>(context);
+#if defined(__x86_64__)
+    return reinterpret_cast<void*>(ucontext->uc_mcontext.gregs[REG_RIP]);
+#elif defined(__aarch64__)
+    return reinterpret_cast<void*>(ucontext->uc_mcontext.pc);
+#else
+    return nullptr;
+#endif
+}
+
+CpuSampler* CpuSampler::instance() {
+    static CpuSampler sampler;
+    return &sampler;
+}
+
+CpuSampler::CpuSampler() : _ring(new Sample[RING_SIZE]) {}
+
+size_t CpuSampler::SampleKeyHash::operator()(const SampleKey& key) const {
+    size_t seed = HashUtil::hash64(&key.query_hi, sizeof(key.query_hi), 0);
+    seed = HashUtil::hash64(&key.query_lo, sizeof(key.query_lo), seed);
+    seed = HashUtil::hash64(&key.operator_id, sizeof(key.operator_id), seed);
+    return HashUtil::hash64(&key.pc, sizeof(key.pc), seed);
+}
+
+void CpuSampler::_handle_signal(int /*sig*/, siginfo_t* /*info*/, void* context) {
+    const int saved_errno = errno;
+    instance()->_record(interrupted_pc(context));
+    errno = saved_errno;
+}
+
+// Runs in the signal handler, only touches the preallocated ring.
+void CpuSampler::_record(void* pc) {
+    const uint64_t pos = _write_pos.fetch_add(1, std::memory_order_relaxed);
+    auto& sample = _ring[pos & (RING_SIZE - 1)];
+    sample.seq.store(0, std::memory_order_relaxed);
+    std::atomic_signal_fence(std::memory_order_release);
+    sample.query_hi.store(cpu_sample_tag.query_hi, std::memory_order_relaxed);
+    sample.query_lo.store(cpu_sample_tag.query_lo, std::memory_order_relaxed);
+    sample.operator_id.store(cpu_sample_tag.operator_id, std::memory_order_relaxed);
+    sample.pc.store(pc, std::memory_order_relaxed);
+    sample.seq.store(pos + 1, std::memory_order_release);
+}
+
+void CpuSampler::register_thread() {
+    if (!config::enable_cpu_sampling || config::cpu_sampling_frequency <= 0 ||
+        cpu_sampling_timer.armed) {
+        return;
+    }
+    std::call_once(_install_handler_once, [] {
+        struct sigaction action {};
+        action.sa_sigaction = _handle_signal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(CPU_SAMPLING_SIGNAL, &action, nullptr) != 0) {
+            LOG(WARNING) << "failed to install the cpu sampling signal handler, errno: " << errno;
+        }
+    });
+
+    struct sigevent event {};
+    event.sigev_notify = SIGEV_THREAD_ID;
+    event.sigev_signo = CPU_SAMPLING_SIGNAL;
+    event.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+    if (timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &cpu_sampling_timer.timer_id) != 0) {
+        LOG(WARNING) << "failed to create the cpu sampling timer, errno: " << errno;
+        return;
+    }
+    const int64_t interval_ns = 1000000000L / config::cpu_sampling_frequency;
+    struct itimerspec spec {};
+    spec.it_interval.tv_sec = interval_ns / 1000000000L;
+    spec.it_interval.tv_nsec = interval_ns % 1000000000L;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(cpu_sampling_timer.timer_id, 0, &spec, nullptr) != 0) {
+        LOG(WARNING) << "failed to arm the cpu sampling timer, errno: " << errno;
+        timer_delete(cpu_sampling_timer.timer_id);
+        return;
+    }
+    cpu_sampling_timer.armed = true;
+}
+
+void CpuSampler::unregister_thread() {
+    if (!cpu_sampling_timer.armed) {
+        return;
+    }
+    timer_delete(cpu_sampling_timer.timer_id);
+    cpu_sampling_timer.armed = false;
+}
+
+void CpuSampler::drain() {
+    std::lock_guard<std::mutex> l(_lock);
+    const int64_t now = MonotonicSeconds();
+    const uint64_t write_pos = _write_pos.load(std::memory_order_acquire);
+    if (write_pos - _read_pos > RING_SIZE) {
+        // the samples not drained in time were overwritten
+        _read_pos = write_pos - RING_SIZE;
+    }
+    SampleCounts counts;
+    for (; _read_pos < write_pos; ++_read_pos) {
+        auto& sample = _ring[_read_pos & (RING_SIZE - 1)];
+        if (sample.seq.load(std::memory_order_acquire) != _read_pos + 1) {
+            // overwritten or still being written
+            continue;
+        }
+        SampleKey key {sample.query_hi.load(std::memory_order_relaxed),
+                       sample.query_lo.load(std::memory_order_relaxed),
+                       sample.operator_id.load(std::memory_order_relaxed),
+                       sample.pc.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sample.seq.load(std::memory_order_relaxed) != _read_pos + 1) {
+            continue;
+        }
+        ++counts[key];
+    }
+    if (!counts.empty()) {
+        _history.push_back({now, std::move(counts)});
+    }
+    while (!_history.empty() &&
+           _history.front().second < now - config::cpu_sampling_retention_seconds) {
+        _history.pop_front();
+    }
+}
+
+static std::string symbol_name(void* pc) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+    if (const auto* symbol = symbol_index->findSymbol(pc)) {
+        return demangle(symbol->name);
+    }
+#endif
+    return fmt::format("{}", pc);
+}
+
+std::string CpuSampler::dump_collapsed_stacks(const TUniqueId* query_id, int64_t seconds) {
+    drain();
+    // query, operator, function -> samples
+    std::map<std::tuple<std::string, int32_t, std::string>, int64_t> stacks;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        const int64_t since = MonotonicSeconds() - seconds;
+        std::unordered_map<void*, std::string> symbols;
+        for (const auto& bucket : _history) {
+            if (bucket.second < since) {
+                continue;
+            }
+            for (const auto& [key, count] : bucket.counts) {
+                if (query_id != nullptr &&
+                    (key.query_hi != query_id->hi || key.query_lo != query_id->lo)) {
+                    continue;
+                }
+                auto it = symbols.find(key.pc);
+                if (it == symbols.end()) {
+                    it = symbols.emplace(key.pc, symbol_name(key.pc)).first;
+                }
+                TUniqueId id;
+                id.__set_hi(key.query_hi);
+                id.__set_lo(key.query_lo);
+                stacks[{key.query_hi == 0 && key.query_lo == 0 ? "no_query" : print_id(id),
+                        key.operator_id, it->second}] += count;
+            }
+        }
+    }
+    fmt::memory_buffer buffer;
+    for (const auto& [stack, count] : stacks) {
+        const auto& [query, operator_id, function] = stack;
+        fmt::format_to(buffer, "{};operator_{};{} {}\n", query, operator_id, function, count);
+    }
+    return fmt::to_string(buffer);
+}
+
+} // namespace doris
@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "gutil/macros.h"
+
+namespace doris {
+
+// What the thread is running, read by the sampling signal handler.
+struct CpuSampleTag {
+    int64_t query_hi = 0;
+    int64_t query_lo = 0;
+    int32_t operator_id = -1;
+};
+
+inline thread_local constinit CpuSampleTag cpu_sample_tag;
+
+// Attribute the CPU samples taken in the scope to a query or to a pipeline operator,
+// nest-able, the outer one is restored when the scope exits.
+#define SCOPED_ATTRIBUTE_QUERY_CPU(query_id) \
+    auto VARNAME_LINENUM(scope_query_cpu) = doris::ScopedCpuSampleQuery(query_id)
+#define SCOPED_ATTRIBUTE_OPERATOR_CPU(operator_id) \
+    auto VARNAME_LINENUM(scope_operator_cpu) = doris::ScopedCpuSampleOperator(operator_id)
+
+class ScopedCpuSampleQuery {
+public:
+    explicit ScopedCpuSampleQuery(const TUniqueId& query_id) : _last(cpu_sample_tag) {
+        cpu_sample_tag.query_hi = query_id.hi;
+        cpu_sample_tag.query_lo = query_id.lo;
+        cpu_sample_tag.operator_id = -1;
+    }
+    ~ScopedCpuSampleQuery() { cpu_sample_tag = _last; }
+
+private:
+    CpuSampleTag _last;
+};
+
+class ScopedCpuSampleOperator {
+public:
+    explicit ScopedCpuSampleOperator(int32_t operator_id) : _last(cpu_sample_tag.operator_id) {
+        cpu_sample_tag.operator_id = operator_id;
+    }
+    ~ScopedCpuSampleOperator() { cpu_sample_tag.operator_id = _last; }
+
+private:
+    int32_t _last;
+};
+
+/*
+ * Low frequency CPU sampler of the pipeline executor threads. Every registered thread arms a
+ * timer on its own CPU clock, so only busy threads are sampled. The signal handler records the
+ * interrupted instruction with the CpuSampleTag of the thread into a lock free ring, which
+ * drain() aggregates per query, operator and function. Only the interrupted function is kept,
+ * unwinding the whole stack is not signal safe in this process.
+ *
+ * This class is thread-safe.
+ */
+class CpuSampler {
+public:
+    static CpuSampler* instance();
+
+    // Start sampling the calling thread, no-op unless enable_cpu_sampling.
+    void register_thread();
+    void unregister_thread();
+
+    // Aggregate the samples recorded since the last call and drop the ones older than
+    // cpu_sampling_retention_seconds.
+    void drain();
+
+    // Samples of the last `seconds` of one query or of all queries, in the collapsed stack
+    // format of flame graphs: "query_id;operator_id;function count" per line.
+    std::string dump_collapsed_stacks(const TUniqueId* query_id, int64_t seconds);
+
+private:
+    CpuSampler();
+
+    struct Sample {
+        // position + 1 in the ring when the fields are complete
+        std::atomic<uint64_t> seq {0};
+        std::atomic<int64_t> query_hi {0};
+        std::atomic<int64_t> query_lo {0};
+        std::atomic<int32_t> operator_id {-1};
+        std::atomic<void*> pc {nullptr};
+    };
+
+    struct SampleKey {
+        int64_t query_hi;
+        int64_t query_lo;
+        int32_t operator_id;
+        void* pc;
+        bool operator==(const SampleKey& rhs) const {
+            return query_hi == rhs.query_hi && query_lo == rhs.query_lo &&
+                   operator_id == rhs.operator_id && pc == rhs.pc;
+        }
+    };
+
+    struct SampleKeyHash {
+        size_t operator()(const SampleKey& key) const;
+    };
+
+    using SampleCounts = std::unordered_map<SampleKey, int64_t, SampleKeyHash>;
+
+    // samples aggregated by the drain() at `second`
+    struct Bucket {
+        int64_t second;
+        SampleCounts counts;
+    };
+
+    static void _handle_signal(int sig, siginfo_t* info, void* context);
+    void _record(void* pc);
+
+    static constexpr size_t RING_SIZE = 1 << 16;
+    std::unique_ptr<Sample[]> _ring;
+    std::atomic<uint64_t> _write_pos {0};
+
+    std::once_flag _install_handler_once;
+    std::mutex _lock;
+    uint64_t _read_pos = 0;
+    std::deque<Bucket> _history;
+};
+
+} // namespace doris
@@ -0,0 +1,331 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/ddsketch.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "util/coding.h"
+
+namespace doris {
+
+namespace {
+
+constexpr uint8_t DDSKETCH_SERDE_VERSION = 1;
+// version + relative accuracy + max num buckets + count + zero count + min + max
+constexpr size_t HEADER_SIZE = 1 + 8 + 4 + 8 + 8 + 8 + 8;
+// offset + num buckets
+constexpr size_t STORE_HEADER_SIZE = 4 + 4;
+
+constexpr double MIN_RELATIVE_ACCURACY = 0.0001;
+constexpr double MAX_RELATIVE_ACCURACY = 0.5;
+
+void encode_double(uint8_t* buf, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    encode_fixed64_le(buf, bits);
+}
+
+double decode_double(const uint8_t* buf) {
+    uint64_t bits = decode_fixed64_le(buf);
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+void DDSketch::Store::add(int32_t index, uint64_t count, uint32_t max_num_buckets) {
+    if (counts.empty()) {
+        offset = index;
+        counts.assign(1, count);
+    } else if (index < offset) {
+        // Grow to the front, the lowest bucket absorbs the values out of the range
+        int32_t new_offset = std::max(index, end() - static_cast<int32_t>(max_num_buckets));
+        counts.insert(counts.begin(), offset - new_offset, 0);
+        offset = new_offset;
+        counts[0] += count;
+    } else if (index >= end()) {
+        int32_t new_offset = index - static_cast<int32_t>(max_num_buckets) + 1;
+        if (new_offset > offset) {
+            collapse_to(new_offset);
+        }
+        counts.resize(index - offset + 1, 0);
+        counts.back() += count;
+    } else {
+        counts[index - offset] += count;
+    }
+}
+
+void DDSketch::Store::merge(const Store& other, uint32_t max_num_buckets) {
+    if (other.counts.empty()) {
+        return;
+    }
+    if (counts.empty()) {
+        *this = other;
+        collapse_lowest(max_num_buckets);
+        return;
+    }
+    int32_t new_end = std::max(end(), other.end());
+    int32_t new_offset = std::max(std::min(offset, other.offset),
+                                  new_end - static_cast<int32_t>(max_num_buckets));
+    if (new_offset > offset) {
+        collapse_to(new_offset);
+    } else if (new_offset < offset) {
+        counts.insert(counts.begin(), offset - new_offset, 0);
+        offset = new_offset;
+    }
+    counts.resize(new_end - offset, 0);
+    for (size_t i = 0; i < other.counts.size(); ++i) {
+        int32_t index = std::max(other.offset + static_cast<int32_t>(i), offset);
+        counts[index - offset] += other.counts[i];
+    }
+}
+
+void DDSketch::Store::collapse_lowest(uint32_t max_num_buckets) {
+    if (counts.size() > max_num_buckets) {
+        collapse_to(end() - static_cast<int32_t>(max_num_buckets));
+    }
+}
+
+void DDSketch::Store::collapse_to(int32_t new_offset) {
+    if (new_offset >= end()) {
+        uint64_t total = std::accumulate(counts.begin(), counts.end(), uint64_t(0));
+        counts.assign(1, total);
+        offset = new_offset;
+        return;
+    }
+    size_t num_collapsed = new_offset - offset;
+    uint64_t collapsed = std::accumulate(counts.begin(), counts.begin() + num_collapsed,
+                                         uint64_t(0));
+    counts.erase(counts.begin(), counts.begin() + num_collapsed);
+    counts[0] += collapsed;
+    offset = new_offset;
+}
+
+DDSketch::DDSketch(double relative_accuracy, uint32_t max_num_buckets) {
+    if (!(relative_accuracy >= MIN_RELATIVE_ACCURACY &&
+          relative_accuracy <= MAX_RELATIVE_ACCURACY)) {
+        relative_accuracy = DEFAULT_RELATIVE_ACCURACY;
+    }
+    _relative_accuracy = relative_accuracy;
+    _max_num_buckets = std::max(max_num_buckets, uint32_t(1));
+    _gamma = (1 + relative_accuracy) / (1 - relative_accuracy);
+    _multiplier = 1 / std::log(_gamma);
+    _min_indexable_value = DBL_MIN * _gamma;
+}
+
+int32_t DDSketch::_index(double abs_value) const {
+    return static_cast<int32_t>(std::ceil(std::log(abs_value) * _multiplier));
+}
+
+double DDSketch::_value(int32_t index) const {
+    // The middle of [gamma^(index - 1), gamma^index] in terms of relative error
+    return 2 * std::pow(_gamma, index) / (1 + _gamma);
+}
+
+void DDSketch::_insert(double value, uint64_t count) {
+    if (value > _min_indexable_value) {
+        _positive.add(_index(value), count, _max_num_buckets);
+    } else if (value < -_min_indexable_value) {
+        _negative.add(_index(-value), count, _max_num_buckets);
+    } else {
+        _zero_count += count;
+    }
+}
+
+void DDSketch::add(double value, uint64_t count) {
+    if (count == 0 || std::isnan(value)) {
+        return;
+    }
+    _insert(value, count);
+    if (_count == 0) {
+        _min = value;
+        _max = value;
+    } else {
+        _min = std::min(_min, value);
+        _max = std::max(_max, value);
+    }
+    _count += count;
+}
+
+void DDSketch::add_batch(const double* values, size_t num_values) {
+    for (size_t i = 0; i < num_values; ++i) {
+        add(values[i]);
+    }
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    if (other.empty()) {
+        return;
+    }
+    if (other._relative_accuracy == _relative_accuracy) {
+        _positive.merge(other._positive, _max_num_buckets);
+        _negative.merge(other._negative, _max_num_buckets);
+        _zero_count += other._zero_count;
+    } else {
+        // Different bucket boundaries, re-add the representative value of each bucket
+        for (size_t i = 0; i < other._positive.counts.size(); ++i) {
+            _insert(other._value(other._positive.offset + static_cast<int32_t>(i)),
+                    other._positive.counts[i]);
+        }
+        for (size_t i = 0; i < other._negative.counts.size(); ++i) {
+            _insert(-other._value(other._negative.offset + static_cast<int32_t>(i)),
+                    other._negative.counts[i]);
+        }
+        _zero_count += other._zero_count;
+    }
+    if (_count == 0) {
+        _min = other._min;
+        _max = other._max;
+    } else {
+        _min = std::min(_min, other._min);
+        _max = std::max(_max, other._max);
+    }
+    _count += other._count;
+}
+
+double DDSketch::_quantile_of_store(const Store& store, uint64_t rank, bool ascending) const {
+    uint64_t cumulative = 0;
+    size_t num_buckets = store.counts.size();
+    for (size_t i = 0; i < num_buckets; ++i) {
+        size_t pos = ascending ? i : num_buckets - 1 - i;
+        cumulative += store.counts[pos];
+        if (cumulative > rank) {
+            return _value(store.offset + static_cast<int32_t>(pos));
+        }
+    }
+    return _value(store.end() - 1);
+}
+
+double DDSketch::quantile(double q) const {
+    if (empty() || std::isnan(q)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (q <= 0) {
+        return _min;
+    }
+    if (q >= 1) {
+        return _max;
+    }
+    auto rank = static_cast<uint64_t>(q * static_cast<double>(_count - 1));
+    uint64_t negative_count = std::accumulate(_negative.counts.begin(), _negative.counts.end(),
+                                              uint64_t(0));
+    double result;
+    if (rank < negative_count) {
+        // The largest negative bucket holds the smallest values
+        result = -_quantile_of_store(_negative, rank, false);
+    } else if (rank < negative_count + _zero_count) {
+        result = 0;
+    } else {
+        result = _quantile_of_store(_positive, rank - negative_count - _zero_count, true);
+    }
+    return std::clamp(result, _min, _max);
+}
+
+void DDSketch::clear() {
+    _positive = Store();
+    _negative = Store();
+    _zero_count = 0;
+    _count = 0;
+    _min = 0;
+    _max = 0;
+}
+
+size_t DDSketch::serialized_size() const {
+    return HEADER_SIZE + 2 * STORE_HEADER_SIZE +
+           (_positive.counts.size() + _negative.counts.size()) * sizeof(uint64_t);
+}
+
+size_t DDSketch::serialize(uint8_t* buf) const {
+    uint8_t* ptr = buf;
+    *ptr++ = DDSKETCH_SERDE_VERSION;
+    encode_double(ptr, _relative_accuracy);
+    ptr += 8;
+    encode_fixed32_le(ptr, _max_num_buckets);
+    ptr += 4;
+    encode_fixed64_le(ptr, _count);
+    ptr += 8;
+    encode_fixed64_le(ptr, _zero_count);
+    ptr += 8;
+    encode_double(ptr, _min);
+    ptr += 8;
+    encode_double(ptr, _max);
+    ptr += 8;
+    for (const Store* store : {&_positive, &_negative}) {
+        encode_fixed32_le(ptr, static_cast<uint32_t>(store->offset));
+        ptr += 4;
+        encode_fixed32_le(ptr, static_cast<uint32_t>(store->counts.size()));
+        ptr += 4;
+        for (uint64_t count : store->counts) {
+            encode_fixed64_le(ptr, count);
+            ptr += 8;
+        }
+    }
+    return ptr - buf;
+}
+
+bool DDSketch::unserialize(const uint8_t* buf, size_t size) {
+    if (size < HEADER_SIZE + 2 * STORE_HEADER_SIZE || buf[0] != DDSKETCH_SERDE_VERSION) {
+        return false;
+    }
+    const uint8_t* ptr = buf + 1;
+    const uint8_t* end = buf + size;
+    double relative_accuracy = decode_double(ptr);
+    ptr += 8;
+    uint32_t max_num_buckets = decode_fixed32_le(ptr);
+    ptr += 4;
+    DDSketch sketch(relative_accuracy, max_num_buckets);
+    if (sketch._relative_accuracy != relative_accuracy || sketch._max_num_buckets == 0) {
+        return false;
+    }
+    sketch._count = decode_fixed64_le(ptr);
+    ptr += 8;
+    sketch._zero_count = decode_fixed64_le(ptr);
+    ptr += 8;
+    sketch._min = decode_double(ptr);
+    ptr += 8;
+    sketch._max = decode_double(ptr);
+    ptr += 8;
+    for (Store* store : {&sketch._positive, &sketch._negative}) {
+        if (end - ptr < static_cast<ptrdiff_t>(STORE_HEADER_SIZE)) {
+            return false;
+        }
+        store->offset = static_cast<int32_t>(decode_fixed32_le(ptr));
+        ptr += 4;
+        uint32_t num_buckets = decode_fixed32_le(ptr);
+        ptr += 4;
+        if (num_buckets > max_num_buckets ||
+            static_cast<size_t>(end - ptr) < num_buckets * sizeof(uint64_t)) {
+            return false;
+        }
+        store->counts.resize(num_buckets);
+        for (uint32_t i = 0; i < num_buckets; ++i) {
+            store->counts[i] = decode_fixed64_le(ptr);
+            ptr += 8;
+        }
+    }
+    *this = std::move(sketch);
+    return true;
+}
+
+} // namespace doris
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace doris {
+
+// DDSketch: a fast and fully-mergeable quantile sketch with relative-error guarantees.
+// See "DDSketch: A Fast and Fully-Mergeable Quantile Sketch with Relative-Error Guarantees"
+// by Charles Masson, Jee E. Rim and Homin K. Lee, https://arxiv.org/abs/1908.10693.
+//
+// A value v is counted in the bucket ceil(log_gamma(|v|)), gamma = (1 + a) / (1 - a), so every
+// quantile is returned with a relative error of at most a, no matter how skewed the data is.
+// Buckets of positive and negative values are kept in two dense arrays of counts. When an array
+// has more than `max_num_buckets` buckets, the lowest ones are collapsed into one, which only
+// affects the accuracy of the values closest to zero.
+class DDSketch {
+public:
+    static constexpr double DEFAULT_RELATIVE_ACCURACY = 0.01;
+    static constexpr uint32_t DEFAULT_MAX_NUM_BUCKETS = 2048;
+
+    explicit DDSketch(double relative_accuracy = DEFAULT_RELATIVE_ACCURACY,
+                      uint32_t max_num_buckets = DEFAULT_MAX_NUM_BUCKETS);
+
+    void add(double value, uint64_t count = 1);
+
+    void add_batch(const double* values, size_t num_values);
+
+    void merge(const DDSketch& other);
+
+    // Return NaN if the sketch is empty
+    double quantile(double q) const;
+
+    uint64_t count() const { return _count; }
+
+    bool empty() const { return _count == 0; }
+
+    double relative_accuracy() const { return _relative_accuracy; }
+
+    void clear();
+
+    size_t serialized_size() const;
+
+    // `buf` must have at least `serialized_size()` bytes, return the bytes written
+    size_t serialize(uint8_t* buf) const;
+
+    // Return false if `buf` is not a valid serialized sketch
+    bool unserialize(const uint8_t* buf, size_t size);
+
+private:
+    // Dense counts of consecutive buckets, `counts[i]` is the count of bucket `offset + i`
+    struct Store {
+        int32_t offset = 0;
+        std::vector<uint64_t> counts;
+
+        int32_t end() const { return offset + static_cast<int32_t>(counts.size()); }
+        void add(int32_t index, uint64_t count, uint32_t max_num_buckets);
+        void merge(const Store& other, uint32_t max_num_buckets);
+        void collapse_lowest(uint32_t max_num_buckets);
+        // Fold the buckets lower than `new_offset` into bucket `new_offset`
+        void collapse_to(int32_t new_offset);
+    };
+
+    // Count `value` in its bucket, without updating the count, min and max
+    void _insert(double value, uint64_t count);
+
+    int32_t _index(double abs_value) const;
+    double _value(int32_t index) const;
+    double _quantile_of_store(const Store& store, uint64_t rank, bool ascending) const;
+
+    double _relative_accuracy;
+    uint32_t _max_num_buckets;
+    double _gamma;
+    double _multiplier; // 1 / log(gamma)
+    // Values whose absolute values are not larger than this are counted as zero
+    double _min_indexable_value;
+
+    Store _positive;
+    Store _negative;
+    uint64_t _zero_count = 0;
+    uint64_t _count = 0;
+    double _min = 0;
+    double _max = 0;
+};
+
+} // namespace doris
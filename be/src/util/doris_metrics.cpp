@@ -187,6 +187,20 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_total, MetricUnit::OPERAT
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_from_cache, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_from_remote, MetricUnit::OPERATIONS);
 
+#define DEFINE_IO_TIER_COUNTER_METRICS(tier)                                                       \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(io_##tier##_reads_total, MetricUnit::OPERATIONS, "",      \
+                                         io_tier_reads_total, Labels({{"tier", #tier}}));          \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(io_##tier##_bytes_total, MetricUnit::BYTES, "",           \
+                                         io_tier_bytes_total, Labels({{"tier", #tier}}));          \
+    DEFINE_COUNTER_METRIC_PROTOTYPE_5ARG(io_##tier##_latency_us_total,                             \
+                                         MetricUnit::MICROSECONDS, "",                             \
+                                         io_tier_latency_us_total, Labels({{"tier", #tier}}));
+
+DEFINE_IO_TIER_COUNTER_METRICS(page_cache);
+DEFINE_IO_TIER_COUNTER_METRICS(file_cache_memory);
+DEFINE_IO_TIER_COUNTER_METRICS(file_cache_disk);
+DEFINE_IO_TIER_COUNTER_METRICS(remote);
+
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(query_ctx_cnt, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(scanner_ctx_cnt, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(scanner_cnt, MetricUnit::NOUNIT);
@@ -311,6 +325,16 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_total);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_from_cache);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_from_remote);
+    // io tiers, by query reads only
+#define REGISTER_IO_TIER_COUNTER_METRICS(tier)                                                     \
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, io_##tier##_reads_total);                   \
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, io_##tier##_bytes_total);                   \
+    INT_COUNTER_METRIC_REGISTER(_server_metric_entity, io_##tier##_latency_us_total);
+    REGISTER_IO_TIER_COUNTER_METRICS(page_cache);
+    REGISTER_IO_TIER_COUNTER_METRICS(file_cache_memory);
+    REGISTER_IO_TIER_COUNTER_METRICS(file_cache_disk);
+    REGISTER_IO_TIER_COUNTER_METRICS(remote);
+#undef REGISTER_IO_TIER_COUNTER_METRICS
 
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, query_ctx_cnt);
     INT_COUNTER_METRIC_REGISTER(_server_metric_entity, scanner_ctx_cnt);
@@ -221,6 +221,20 @@ public:
     IntCounter* num_io_bytes_read_from_cache = nullptr;
     IntCounter* num_io_bytes_read_from_remote = nullptr;
 
+    // the reads of queries served by each tier of the read path, see io::IOTierStatistics
+    IntCounter* io_page_cache_reads_total = nullptr;
+    IntCounter* io_page_cache_bytes_total = nullptr;
+    IntCounter* io_page_cache_latency_us_total = nullptr;
+    IntCounter* io_file_cache_memory_reads_total = nullptr;
+    IntCounter* io_file_cache_memory_bytes_total = nullptr;
+    IntCounter* io_file_cache_memory_latency_us_total = nullptr;
+    IntCounter* io_file_cache_disk_reads_total = nullptr;
+    IntCounter* io_file_cache_disk_bytes_total = nullptr;
+    IntCounter* io_file_cache_disk_latency_us_total = nullptr;
+    IntCounter* io_remote_reads_total = nullptr;
+    IntCounter* io_remote_bytes_total = nullptr;
+    IntCounter* io_remote_latency_us_total = nullptr;
+
     IntCounter* query_ctx_cnt = nullptr;
     IntCounter* scanner_ctx_cnt = nullptr;
     IntCounter* scanner_cnt = nullptr;
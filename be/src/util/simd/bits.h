@@ -106,6 +106,40 @@ inline constexpr auto bits_mask_all() {
 #endif
 }
 
+// Compare the bits_mask_length() bytes at data with byte, the result has the same layout as
+// bytes_mask_to_bits_mask, so it can be consumed by iterate_through_bits_mask.
+inline auto bytes_equal_mask(const uint8_t* data, uint8_t byte) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return get_nibble_mask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+#elif defined(__AVX2__)
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+                              _mm256_set1_epi8(static_cast<char>(byte)))));
+#elif defined(__SSE2__)
+    auto target = _mm_set1_epi8(static_cast<char>(byte));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), target))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), target)))
+            << 16);
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 32; ++i) {
+        mask |= static_cast<uint32_t>(data[i] == byte) << i;
+    }
+    return mask;
+#endif
+}
+
+// Index of the first byte set in a non zero mask returned by bytes_equal_mask
+inline uint32_t first_index_of_bits_mask(decltype(bytes_mask_to_bits_mask(nullptr)) mask) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return __builtin_ctzll(mask) >> 2;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
 template <typename Func>
 void iterate_through_bits_mask(Func func, decltype(bytes_mask_to_bits_mask(nullptr)) mask) {
 #if defined(__ARM_NEON) && defined(__aarch64__)
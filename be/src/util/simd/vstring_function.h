@@ -333,6 +333,37 @@ public:
         }
         return char_len;
     }
+
+    // skip_chars returns the byte offset of the n-th (0-based) char of a UTF-8 string, or len if
+    // the string has no more than n chars. Chars are counted the same way as get_char_len, so
+    // skip_chars(src, len, get_char_len(src, len)) == len. Whole 16-byte blocks are skipped
+    // while they hold no more chars than remain to be skipped.
+    static inline size_t skip_chars(const char* src, size_t len, size_t n) {
+        const char* p = src;
+        const char* end = p + len;
+#if defined(__SSE2__) || defined(__aarch64__)
+        constexpr auto bytes_sse2 = sizeof(__m128i);
+        const auto src_end_sse2 = p + (len & ~(bytes_sse2 - 1));
+        const auto threshold = _mm_set1_epi8(0xBF);
+        for (; p < src_end_sse2; p += bytes_sse2) {
+            size_t block_chars = __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), threshold)));
+            if (block_chars > n) {
+                break;
+            }
+            n -= block_chars;
+        }
+#endif
+        for (; p < end; ++p) {
+            if (static_cast<int8_t>(*p) > static_cast<int8_t>(0xBF)) {
+                if (n == 0) {
+                    return p - src;
+                }
+                --n;
+            }
+        }
+        return len;
+    }
 };
 } // namespace simd
 } // namespace doris
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/timezone_offset_cache.h"
+
+#include <limits>
+
+namespace doris {
+
+void TimezoneOffsetCache::_refresh(int64_t utc_seconds) {
+    const auto tp = _to_time_point(utc_seconds);
+    _offset = _ctz.lookup(tp).offset;
+
+    // A transition happens where the civil time jumps from `from` to `to`; the offset before
+    // it is used for `from` and the offset after it for `to`.
+    cctz::time_zone::civil_transition trans;
+    _end = std::numeric_limits<int64_t>::max();
+    if (_ctz.next_transition(tp, &trans)) {
+        _end = (trans.from - epoch_civil()) - _offset;
+    }
+    _begin = std::numeric_limits<int64_t>::min();
+    if (_ctz.lookup(tp - cctz::seconds(1)).offset != _offset) {
+        // tp itself is a transition
+        _begin = utc_seconds;
+    } else if (_ctz.prev_transition(tp, &trans)) {
+        _begin = (trans.to - epoch_civil()) - _offset;
+    }
+    // transitions of very distant times are unspecified in cctz, so double check the span
+    if (_begin > utc_seconds || _end <= utc_seconds ||
+        (_begin != std::numeric_limits<int64_t>::min() &&
+         _ctz.lookup(_to_time_point(_begin)).offset != _offset) ||
+        (_end != std::numeric_limits<int64_t>::max() &&
+         _ctz.lookup(_to_time_point(_end - 1)).offset != _offset)) [[unlikely]] {
+        _begin = utc_seconds;
+        _end = utc_seconds + 1;
+    }
+}
+
+} // namespace doris
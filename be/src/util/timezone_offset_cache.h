@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace doris {
+
+// TimezoneOffsetCache remembers the span between two transitions of a time zone that the last
+// converted timestamp fell into, together with the UTC offset of that span. Rows of a block
+// are usually close in time, so most conversions become an addition instead of a binary
+// search over the transitions of the zone plus a civil time conversion in cctz.
+// Not thread safe, meant to live on the stack of one vectorized loop.
+class TimezoneOffsetCache {
+public:
+    explicit TimezoneOffsetCache(const cctz::time_zone& ctz) : _ctz(ctz) {}
+
+    const cctz::time_zone& time_zone() const { return _ctz; }
+
+    int64_t utc_offset(int64_t utc_seconds) {
+        if (utc_seconds < _begin || utc_seconds >= _end) [[unlikely]] {
+            _refresh(utc_seconds);
+        }
+        return _offset;
+    }
+
+    // Same as cctz::convert(time_point, ctz).
+    cctz::civil_second to_civil(int64_t utc_seconds) {
+        return epoch_civil() + (utc_seconds + utc_offset(utc_seconds));
+    }
+
+    // Same as cctz::convert(civil_second, ctz). Civil times within a day of a transition may be
+    // skipped or repeated, those are left to cctz.
+    int64_t from_civil(const cctz::civil_second& cs) {
+        int64_t utc_seconds = (cs - epoch_civil()) - _offset;
+        if (utc_seconds >= _begin + MAX_OFFSET_CHANGE && utc_seconds < _end - MAX_OFFSET_CHANGE)
+                [[likely]] {
+            return utc_seconds;
+        }
+        utc_seconds = cctz::convert(cs, _ctz).time_since_epoch().count();
+        utc_offset(utc_seconds);
+        return utc_seconds;
+    }
+
+private:
+    // Offsets of one zone never differ by a day or more.
+    static constexpr int64_t MAX_OFFSET_CHANGE = 24 * 3600;
+
+    static cctz::civil_second epoch_civil() { return cctz::civil_second(1970, 1, 1, 0, 0, 0); }
+
+    static cctz::time_point<cctz::seconds> _to_time_point(int64_t utc_seconds) {
+        return std::chrono::time_point_cast<cctz::seconds>(
+                       std::chrono::system_clock::from_time_t(0)) +
+               cctz::seconds(utc_seconds);
+    }
+
+    void _refresh(int64_t utc_seconds);
+
+    const cctz::time_zone& _ctz;
+    // [_begin, _end) in UTC seconds shares _offset, empty before the first lookup.
+    int64_t _begin = 0;
+    int64_t _end = 0;
+    int64_t _offset = 0;
+};
+
+} // namespace doris
@@ -24,6 +24,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "olap/hll.h"
 #include "util/hash_util.hpp"
@@ -96,21 +97,36 @@ public:
 
     DataTypePtr get_return_type() const override { return std::make_shared<DataTypeInt64>(); }
 
-    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
-             Arena*) const override {
+    static uint64_t hash_at(const IColumn* column, size_t row_num) {
+        const auto* data_column =
+                assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(column);
         if constexpr (IsFixLenColumnType<ColumnDataType>::value) {
-            auto column =
-                    assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0]);
-            auto value = column->get_element(row_num);
-            this->data(place).add(
-                    HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED));
+            auto value = data_column->get_element(row_num);
+            return HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED);
         } else {
-            auto value = assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0])
-                                 ->get_data_at(row_num);
-            uint64_t hash_value =
-                    HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
-            this->data(place).add(hash_value);
+            auto value = data_column->get_data_at(row_num);
+            return HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+        }
+    }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
+             Arena*) const override {
+        this->data(place).add(hash_at(columns[0], row_num));
+    }
+
+    // Hashes the whole batch first, then puts the hash values into the HLL in one pass.
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        std::vector<uint64_t> hash_values;
+        hash_values.reserve(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            uint64_t hash_value = hash_at(columns[0], i);
+            // 0 is ignored, the same as add()
+            if (hash_value != 0) {
+                hash_values.push_back(hash_value);
+            }
         }
+        this->data(place).hll_data.update_batch(hash_values.data(), hash_values.size());
     }
 
     void reset(AggregateDataPtr place) const override { this->data(place).reset(); }
@@ -23,6 +23,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "agent/be_exec_version_manager.h"
@@ -68,6 +69,7 @@ struct AggregateFunctionBitmapUnionOp {
 
     static void add_batch(BitmapValue& res, std::vector<const BitmapValue*>& data, bool& is_first) {
         res.fastunion(data);
+        is_first = false;
     }
 
     static void merge(BitmapValue& res, const BitmapValue& data, bool& is_first) {
@@ -192,6 +194,10 @@ public:
         const size_t num_rows = column.size();
         auto* data = col.get_data().data();
 
+        if constexpr (is_union) {
+            _fastunion(place, data, num_rows);
+            return;
+        }
         for (size_t i = 0; i != num_rows; ++i) {
             this->data(place).merge(data[i]);
         }
@@ -204,6 +210,10 @@ public:
                 << ", begin:" << begin << ", end:" << end << ", column.size():" << column.size();
         auto& col = assert_cast<const ColumnBitmap&>(column);
         auto* data = col.get_data().data();
+        if constexpr (is_union) {
+            _fastunion(place, data + begin, end - begin + 1);
+            return;
+        }
         for (size_t i = begin; i <= end; ++i) {
             this->data(place).merge(data[i]);
         }
@@ -249,6 +259,20 @@ public:
 
 protected:
     using IAggregateFunction::version;
+
+private:
+    static constexpr bool is_union =
+            std::is_same_v<Data, AggregateFunctionBitmapData<AggregateFunctionBitmapUnionOp>>;
+
+    // Union all bitmaps merged into one place at once instead of one by one
+    void _fastunion(AggregateDataPtr __restrict place, const BitmapValue* data,
+                    size_t num_rows) const {
+        std::vector<const BitmapValue*> values(num_rows);
+        for (size_t i = 0; i != num_rows; ++i) {
+            values[i] = data + i;
+        }
+        this->data(place).add_batch(values);
+    }
 };
 
 template <typename Op>
@@ -346,15 +346,9 @@ struct AggregateFunctionArrayAggData {
 
     void deserialize_and_merge(const IColumn& column, size_t row_num) {
         auto& to_arr = assert_cast<const ColumnArray&>(column);
-        auto& to_nested_col = to_arr.get_data();
-        auto col_null = reinterpret_cast<const ColumnNullable*>(&to_nested_col);
-        const auto& vec = assert_cast<const ColVecType&>(col_null->get_nested_column()).get_data();
         auto start = to_arr.get_offsets()[row_num - 1];
-        auto end = start + to_arr.get_offsets()[row_num] - to_arr.get_offsets()[row_num - 1];
-        for (auto i = start; i < end; ++i) {
-            null_map->push_back(col_null->get_null_map_data()[i]);
-            nested_column->get_data().push_back(vec[i]);
-        }
+        column_data->insert_range_from(to_arr.get_data(), start,
+                                       to_arr.get_offsets()[row_num] - start);
     }
 
     void reset() {
@@ -365,28 +359,18 @@ struct AggregateFunctionArrayAggData {
     void insert_result_into(IColumn& to) const {
         auto& to_arr = assert_cast<ColumnArray&>(to);
         auto& to_nested_col = to_arr.get_data();
-        auto col_null = reinterpret_cast<ColumnNullable*>(&to_nested_col);
-        auto& vec = assert_cast<ColVecType&>(col_null->get_nested_column()).get_data();
-        size_t num_rows = null_map->size();
-        auto& nested_column_data = nested_column->get_data();
-        for (size_t i = 0; i < num_rows; ++i) {
-            col_null->get_null_map_data().push_back((*null_map)[i]);
-            vec.push_back(nested_column_data[i]);
-        }
+        to_nested_col.insert_range_from(*column_data, 0, column_data->size());
         to_arr.get_offsets().push_back(to_nested_col.size());
     }
 
+    // The null map and the values are written as whole arrays, the format is the same as writing
+    // them element by element.
     void write(BufferWritable& buf) const {
         const size_t size = null_map->size();
         write_binary(size, buf);
-
-        for (size_t i = 0; i < size; i++) {
-            write_binary(null_map->data()[i], buf);
-        }
-
-        for (size_t i = 0; i < size; i++) {
-            write_binary(nested_column->get_data()[i], buf);
-        }
+        buf.write(reinterpret_cast<const char*>(null_map->data()), size * sizeof(UInt8));
+        buf.write(reinterpret_cast<const char*>(nested_column->get_data().data()),
+                  size * sizeof(ElementType));
     }
 
     void read(BufferReadable& buf) {
@@ -395,28 +379,14 @@ struct AggregateFunctionArrayAggData {
         size_t size = 0;
         read_binary(size, buf);
         null_map->resize(size);
-        nested_column->reserve(size);
-        for (size_t i = 0; i < size; i++) {
-            read_binary(null_map->data()[i], buf);
-        }
-
-        ElementType data_value;
-        for (size_t i = 0; i < size; i++) {
-            read_binary(data_value, buf);
-            nested_column->get_data().push_back(data_value);
-        }
+        buf.read(reinterpret_cast<char*>(null_map->data()), size * sizeof(UInt8));
+        nested_column->get_data().resize(size);
+        buf.read(reinterpret_cast<char*>(nested_column->get_data().data()),
+                 size * sizeof(ElementType));
     }
 
     void merge(const Self& rhs) {
-        const auto size = rhs.null_map->size();
-        null_map->resize(size);
-        nested_column->reserve(size);
-        for (size_t i = 0; i < size; i++) {
-            const auto null_value = rhs.null_map->data()[i];
-            const auto data_value = rhs.nested_column->get_data()[i];
-            null_map->data()[i] = null_value;
-            nested_column->get_data().push_back(data_value);
-        }
+        column_data->insert_range_from(*rhs.column_data, 0, rhs.column_data->size());
     }
 };
 
@@ -447,15 +417,9 @@ struct AggregateFunctionArrayAggData<StringRef> {
 
     void deserialize_and_merge(const IColumn& column, size_t row_num) {
         auto& to_arr = assert_cast<const ColumnArray&>(column);
-        auto& to_nested_col = to_arr.get_data();
-        auto col_null = assert_cast<const ColumnNullable*>(&to_nested_col);
-        const auto& vec = assert_cast<const ColVecType&>(col_null->get_nested_column());
         auto start = to_arr.get_offsets()[row_num - 1];
-        auto end = start + to_arr.get_offsets()[row_num] - to_arr.get_offsets()[row_num - 1];
-        for (auto i = start; i < end; ++i) {
-            null_map->push_back(col_null->get_null_map_data()[i]);
-            nested_column->insert_from(vec, i);
-        }
+        column_data->insert_range_from(to_arr.get_data(), start,
+                                       to_arr.get_offsets()[row_num] - start);
     }
 
     void reset() {
@@ -466,13 +430,7 @@ struct AggregateFunctionArrayAggData<StringRef> {
     void insert_result_into(IColumn& to) const {
         auto& to_arr = assert_cast<ColumnArray&>(to);
         auto& to_nested_col = to_arr.get_data();
-        auto col_null = reinterpret_cast<ColumnNullable*>(&to_nested_col);
-        auto& vec = assert_cast<ColVecType&>(col_null->get_nested_column());
-        size_t num_rows = null_map->size();
-        for (size_t i = 0; i < num_rows; ++i) {
-            col_null->get_null_map_data().push_back((*null_map)[i]);
-            vec.insert_from(*nested_column, i);
-        }
+        to_nested_col.insert_range_from(*column_data, 0, column_data->size());
         to_arr.get_offsets().push_back(to_nested_col.size());
     }
 
@@ -505,15 +463,7 @@ struct AggregateFunctionArrayAggData<StringRef> {
     }
 
     void merge(const Self& rhs) {
-        const auto size = rhs.null_map->size();
-        null_map->resize(size);
-        nested_column->reserve(size);
-        for (size_t i = 0; i < size; i++) {
-            const auto null_value = rhs.null_map->data()[i];
-            auto s = rhs.nested_column->get_data_at(i);
-            null_map->data()[i] = null_value;
-            nested_column->insert_data(s.data, s.size);
-        }
+        column_data->insert_range_from(*rhs.column_data, 0, rhs.column_data->size());
     }
 };
 
@@ -534,12 +484,9 @@ struct AggregateFunctionArrayAggData<void> {
 
     void deserialize_and_merge(const IColumn& column, size_t row_num) {
         auto& to_arr = assert_cast<const ColumnArray&>(column);
-        auto& to_nested_col = to_arr.get_data();
         auto start = to_arr.get_offsets()[row_num - 1];
-        auto end = start + to_arr.get_offsets()[row_num] - to_arr.get_offsets()[row_num - 1];
-        for (auto i = start; i < end; ++i) {
-            column_data->insert_from(to_nested_col, i);
-        }
+        column_data->insert_range_from(to_arr.get_data(), start,
+                                       to_arr.get_offsets()[row_num] - start);
     }
 
     void reset() { column_data->clear(); }
@@ -547,10 +494,7 @@ struct AggregateFunctionArrayAggData<void> {
     void insert_result_into(IColumn& to) const {
         auto& to_arr = assert_cast<ColumnArray&>(to);
         auto& to_nested_col = to_arr.get_data();
-        size_t num_rows = column_data->size();
-        for (size_t i = 0; i < num_rows; ++i) {
-            to_nested_col.insert_from(*column_data, i);
-        }
+        to_nested_col.insert_range_from(*column_data, 0, column_data->size());
         to_arr.get_offsets().push_back(to_nested_col.size());
     }
 
@@ -575,10 +519,7 @@ struct AggregateFunctionArrayAggData<void> {
     }
 
     void merge(const Self& rhs) {
-        const auto size = rhs.column_data->size();
-        for (size_t i = 0; i < size; i++) {
-            column_data->insert_from(*rhs.column_data, i);
-        }
+        column_data->insert_range_from(*rhs.column_data, 0, rhs.column_data->size());
     }
 };
 
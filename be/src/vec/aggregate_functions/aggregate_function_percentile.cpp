@@ -61,6 +61,25 @@ AggregateFunctionPtr create_aggregate_function_percentile_approx_weighted(
     return nullptr;
 }
 
+AggregateFunctionPtr create_aggregate_function_percentile_ddsketch(
+        const std::string& name, const DataTypes& argument_types, const bool result_is_nullable,
+        const AggregateFunctionAttr& attr) {
+    const DataTypePtr& argument_type = remove_nullable(argument_types[0]);
+    WhichDataType which(argument_type);
+    if (which.idx != TypeIndex::Float64) {
+        return nullptr;
+    }
+    if (argument_types.size() == 2) {
+        return creator_without_type::create<AggregateFunctionPercentileDDSketch<false>>(
+                argument_types, result_is_nullable);
+    }
+    if (argument_types.size() == 3) {
+        return creator_without_type::create<AggregateFunctionPercentileDDSketch<true>>(
+                argument_types, result_is_nullable);
+    }
+    return nullptr;
+}
+
 void register_aggregate_function_percentile(AggregateFunctionSimpleFactory& factory) {
     factory.register_function_both("percentile",
                                    creator_with_numeric_type::creator<AggregateFunctionPercentile>);
@@ -84,6 +103,8 @@ void register_aggregate_function_percentile_approx(AggregateFunctionSimpleFactor
                                    create_aggregate_function_percentile_approx);
     factory.register_function_both("percentile_approx_weighted",
                                    create_aggregate_function_percentile_approx_weighted);
+    factory.register_function_both("percentile_ddsketch",
+                                   create_aggregate_function_percentile_ddsketch);
 
     register_percentile_approx_old_function(factory);
 }
@@ -31,6 +31,7 @@
 
 #include "agent/be_exec_version_manager.h"
 #include "util/counts.h"
+#include "util/ddsketch.h"
 #include "util/tdigest.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -316,6 +317,152 @@ public:
     }
 };
 
+struct PercentileDDSketchState {
+    static constexpr double INIT_QUANTILE = -1.0;
+
+    void init(double quantile, double relative_accuracy = DDSketch::DEFAULT_RELATIVE_ACCURACY) {
+        if (!init_flag) {
+            // A relative accuracy out of [0.0001, 0.5] uses the default value of 0.01
+            check_quantile(quantile);
+            sketch = DDSketch(relative_accuracy);
+            target_quantile = quantile;
+            init_flag = true;
+        }
+    }
+
+    void write(BufferWritable& buf) const {
+        write_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+
+        write_binary(target_quantile, buf);
+        std::string result(sketch.serialized_size(), '0');
+        sketch.serialize((uint8_t*)result.data());
+        write_binary(result, buf);
+    }
+
+    void read(BufferReadable& buf) {
+        read_binary(init_flag, buf);
+        if (!init_flag) {
+            return;
+        }
+
+        read_binary(target_quantile, buf);
+        std::string str;
+        read_binary(str, buf);
+        if (!sketch.unserialize((const uint8_t*)str.data(), str.size())) {
+            throw Exception(ErrorCode::INTERNAL_ERROR, "invalid serialized ddsketch, size={}",
+                            str.size());
+        }
+    }
+
+    double get() const {
+        if (init_flag) {
+            return sketch.quantile(target_quantile);
+        } else {
+            return std::nan("");
+        }
+    }
+
+    void merge(const PercentileDDSketchState& rhs) {
+        if (!rhs.init_flag) {
+            return;
+        }
+        if (!init_flag) {
+            sketch = DDSketch(rhs.sketch.relative_accuracy());
+            init_flag = true;
+        }
+        sketch.merge(rhs.sketch);
+        if (target_quantile == PercentileDDSketchState::INIT_QUANTILE) {
+            target_quantile = rhs.target_quantile;
+        }
+    }
+
+    void reset() {
+        target_quantile = INIT_QUANTILE;
+        init_flag = false;
+        sketch.clear();
+    }
+
+    bool init_flag = false;
+    DDSketch sketch;
+    double target_quantile = INIT_QUANTILE;
+};
+
+// percentile_ddsketch(value, quantile[, relative_accuracy])
+template <bool has_relative_accuracy>
+class AggregateFunctionPercentileDDSketch final
+        : public IAggregateFunctionDataHelper<
+                  PercentileDDSketchState,
+                  AggregateFunctionPercentileDDSketch<has_relative_accuracy>> {
+public:
+    using Base = IAggregateFunctionDataHelper<
+            PercentileDDSketchState, AggregateFunctionPercentileDDSketch<has_relative_accuracy>>;
+
+    AggregateFunctionPercentileDDSketch(const DataTypes& argument_types_) : Base(argument_types_) {}
+
+    String get_name() const override { return "percentile_ddsketch"; }
+
+    DataTypePtr get_return_type() const override { return std::make_shared<DataTypeFloat64>(); }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
+             Arena*) const override {
+        const auto& sources =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        init(place, columns);
+        this->data(place).sketch.add(sources.get_element(row_num));
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        const auto& sources =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[0]);
+        init(place, columns);
+        this->data(place).sketch.add_batch(sources.get_data().data(), batch_size);
+    }
+
+    void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
+
+    void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
+               Arena*) const override {
+        this->data(place).merge(this->data(rhs));
+    }
+
+    void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
+        this->data(place).write(buf);
+    }
+
+    void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
+                     Arena*) const override {
+        this->data(place).read(buf);
+    }
+
+    void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
+        auto& col = assert_cast<ColumnFloat64&>(to);
+        double result = this->data(place).get();
+
+        if (std::isnan(result)) {
+            col.insert_default();
+        } else {
+            col.get_data().push_back(result);
+        }
+    }
+
+private:
+    void init(AggregateDataPtr __restrict place, const IColumn** columns) const {
+        const auto& quantile =
+                assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[1]);
+        if constexpr (has_relative_accuracy) {
+            const auto& relative_accuracy =
+                    assert_cast<const ColumnFloat64&, TypeCheckOnRelease::DISABLE>(*columns[2]);
+            this->data(place).init(quantile.get_element(0), relative_accuracy.get_element(0));
+        } else {
+            this->data(place).init(quantile.get_element(0));
+        }
+    }
+};
+
 template <typename T>
 struct PercentileState {
     mutable std::vector<Counts<T>> vec_counts;
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/data_types/data_type_agg_state.h"
@@ -71,10 +73,31 @@ public:
 
     void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
                    const IColumn** columns, Arena* arena, bool agg_many) const override {
-        for (size_t i = 0; i < batch_size; ++i) {
-            //the range is [i, i]
-            _function->deserialize_and_merge_from_column_range(places[i] + place_offset,
-                                                               *columns[0], i, i, arena);
+        // the states of the batch are deserialized together and merged as in the merge phase
+        // of the hash aggregation, instead of one deserialized state per row.
+        std::vector<char> deserialize_buffer(_function->size_of_data() * batch_size);
+        _function->deserialize_and_merge_vec(places, place_offset,
+                                             (AggregateDataPtr)deserialize_buffer.data(),
+                                             columns[0], arena, batch_size);
+    }
+
+    // Used by the readers of aggregate key tables (e.g. compaction) to merge the stored states
+    // of a key range, the range is [batch_begin, batch_end].
+    void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                         const IColumn** columns, Arena* arena, bool has_null) override {
+        _function->deserialize_and_merge_from_column_range(place, *columns[0], batch_begin,
+                                                           batch_end, arena);
+    }
+
+    void add_range_single_place(int64_t partition_start, int64_t partition_end,
+                                int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                const IColumn** columns, Arena* arena) const override {
+        frame_start = std::max<int64_t>(frame_start, partition_start);
+        frame_end = std::min<int64_t>(frame_end, partition_end);
+        if (frame_start < frame_end) {
+            _function->deserialize_and_merge_from_column_range(
+                    place, *columns[0], static_cast<size_t>(frame_start),
+                    static_cast<size_t>(frame_end - 1), arena);
         }
     }
     void reset(AggregateDataPtr place) const override { _function->reset(place); }
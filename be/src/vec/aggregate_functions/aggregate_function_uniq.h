@@ -23,6 +23,7 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <type_traits>
@@ -68,17 +69,138 @@ struct AggregateFunctionUniqExactData {
 
     using Set = flat_hash_set<Key, Hash>;
 
+    // A set with more elements is converted to two level, the elements are split into
+    // NUM_BUCKETS sub sets by the high bits of the hash, so that sets are merged bucket by
+    // bucket on much smaller tables, and each merged bucket stays in cache.
+    static constexpr size_t TWO_LEVEL_THRESHOLD = 100000;
+    static constexpr size_t BITS_FOR_BUCKET = 8;
+    static constexpr size_t NUM_BUCKETS = 1ULL << BITS_FOR_BUCKET;
+    // HashCRC32 only has 32 significant bits
+    static constexpr size_t BUCKET_SHIFT = 32 - BITS_FOR_BUCKET;
+    using TwoLevelSet = std::array<Set, NUM_BUCKETS>;
+
     // TODO: replace SipHash with xxhash to speed up
     static UInt128 ALWAYS_INLINE get_key(const StringRef& value) {
         auto hash_value = XXH_INLINE_XXH128(value.data, value.size, 0);
         return UInt128 {hash_value.high64, hash_value.low64};
     }
 
+    static size_t ALWAYS_INLINE get_bucket(size_t hash_value) {
+        return (hash_value >> BUCKET_SHIFT) & (NUM_BUCKETS - 1);
+    }
+
+    // `set` also provides the hash function of the two level set after conversion
     Set set;
+    std::unique_ptr<TwoLevelSet> two_level_set;
 
     static String get_name() { return "multi_distinct"; }
 
-    void reset() { set.clear(); }
+    bool is_two_level() const { return two_level_set != nullptr; }
+
+    size_t size() const {
+        if (!is_two_level()) {
+            return set.size();
+        }
+        size_t res = 0;
+        for (const auto& bucket : *two_level_set) {
+            res += bucket.size();
+        }
+        return res;
+    }
+
+    void ALWAYS_INLINE insert(const Key& key) {
+        if (is_two_level()) {
+            size_t hash_value = set.hash(key);
+            (*two_level_set)[get_bucket(hash_value)].lazy_emplace_with_hash(
+                    key, hash_value, [&](const auto& ctor) { ctor(key); });
+            return;
+        }
+        set.insert(key);
+        if (UNLIKELY(set.size() > TWO_LEVEL_THRESHOLD)) {
+            convert_to_two_level();
+        }
+    }
+
+    void ALWAYS_INLINE prefetch(const Key& key) {
+        if (is_two_level()) {
+            size_t hash_value = set.hash(key);
+            (*two_level_set)[get_bucket(hash_value)].prefetch_hash(hash_value);
+        } else {
+            set.prefetch(key);
+        }
+    }
+
+    // Prepare for `num_elements` elements in total
+    void reserve(size_t num_elements) {
+        if (!is_two_level()) {
+            if (num_elements <= TWO_LEVEL_THRESHOLD) {
+                set.rehash(num_elements);
+                return;
+            }
+            convert_to_two_level();
+        }
+        for (auto& bucket : *two_level_set) {
+            bucket.reserve(num_elements / NUM_BUCKETS);
+        }
+    }
+
+    void convert_to_two_level() {
+        auto res = std::make_unique<TwoLevelSet>();
+        for (const auto& key : set) {
+            size_t hash_value = set.hash(key);
+            (*res)[get_bucket(hash_value)].lazy_emplace_with_hash(
+                    key, hash_value, [&](const auto& ctor) { ctor(key); });
+        }
+        two_level_set = std::move(res);
+        Set().swap(set);
+    }
+
+    void merge(const AggregateFunctionUniqExactData& rhs) {
+        if (!rhs.is_two_level()) {
+            if (rhs.set.empty()) {
+                return;
+            }
+            reserve(size() + rhs.set.size());
+            for (const auto& key : rhs.set) {
+                insert(key);
+            }
+            return;
+        }
+        if (!is_two_level()) {
+            convert_to_two_level();
+        }
+        // Elements of the same bucket are in the same bucket of both sets
+        for (size_t i = 0; i < NUM_BUCKETS; ++i) {
+            const auto& rhs_bucket = (*rhs.two_level_set)[i];
+            auto& bucket = (*two_level_set)[i];
+            bucket.reserve(bucket.size() + rhs_bucket.size());
+            for (const auto& key : rhs_bucket) {
+                bucket.insert(key);
+            }
+        }
+    }
+
+    // The serialized format is the same for both one level and two level sets, the elements
+    // of a two level set are written bucket by bucket.
+    template <typename Func>
+    void for_each(Func&& func) const {
+        if (!is_two_level()) {
+            for (const auto& key : set) {
+                func(key);
+            }
+            return;
+        }
+        for (const auto& bucket : *two_level_set) {
+            for (const auto& key : bucket) {
+                func(key);
+            }
+        }
+    }
+
+    void reset() {
+        set.clear();
+        two_level_set.reset();
+    }
 };
 
 namespace detail {
@@ -91,14 +213,13 @@ struct OneAdder {
     static void ALWAYS_INLINE add(Data& data, const IColumn& column, size_t row_num) {
         if constexpr (std::is_same_v<T, String>) {
             StringRef value = column.get_data_at(row_num);
-            data.set.insert(Data::get_key(value));
+            data.insert(Data::get_key(value));
         } else if constexpr (IsDecimalNumber<T>) {
-            data.set.insert(
-                    assert_cast<const ColumnDecimal<T>&, TypeCheckOnRelease::DISABLE>(column)
-                            .get_data()[row_num]);
+            data.insert(assert_cast<const ColumnDecimal<T>&, TypeCheckOnRelease::DISABLE>(column)
+                                .get_data()[row_num]);
         } else {
-            data.set.insert(assert_cast<const ColumnVector<T>&, TypeCheckOnRelease::DISABLE>(column)
-                                    .get_data()[row_num]);
+            data.insert(assert_cast<const ColumnVector<T>&, TypeCheckOnRelease::DISABLE>(column)
+                                .get_data()[row_num]);
         }
     }
 };
@@ -146,89 +267,79 @@ public:
         std::vector<KeyType> keys_container;
         const KeyType* keys = get_keys(keys_container, *columns[0], batch_size);
 
-        std::vector<typename Data::Set*> array_of_data_set(batch_size);
+        std::vector<Data*> array_of_data(batch_size);
 
         for (size_t i = 0; i != batch_size; ++i) {
-            array_of_data_set[i] = &(this->data(places[i] + place_offset).set);
+            array_of_data[i] = &(this->data(places[i] + place_offset));
         }
 
         for (size_t i = 0; i != batch_size; ++i) {
             if (i + HASH_MAP_PREFETCH_DIST < batch_size) {
-                array_of_data_set[i + HASH_MAP_PREFETCH_DIST]->prefetch(
+                array_of_data[i + HASH_MAP_PREFETCH_DIST]->prefetch(
                         keys[i + HASH_MAP_PREFETCH_DIST]);
             }
 
-            array_of_data_set[i]->insert(keys[i]);
+            array_of_data[i]->insert(keys[i]);
         }
     }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
                Arena*) const override {
-        auto& rhs_set = this->data(rhs).set;
-        if (rhs_set.size() == 0) return;
-
-        auto& set = this->data(place).set;
-        set.rehash(set.size() + rhs_set.size());
-
-        for (auto elem : rhs_set) {
-            set.insert(elem);
-        }
+        this->data(place).merge(this->data(rhs));
     }
 
     void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
                                 Arena*) const override {
         std::vector<KeyType> keys_container;
         const KeyType* keys = get_keys(keys_container, *columns[0], batch_size);
-        auto& set = this->data(place).set;
+        auto& data = this->data(place);
 
         for (size_t i = 0; i != batch_size; ++i) {
             if (i + HASH_MAP_PREFETCH_DIST < batch_size) {
-                set.prefetch(keys[i + HASH_MAP_PREFETCH_DIST]);
+                data.prefetch(keys[i + HASH_MAP_PREFETCH_DIST]);
             }
-            set.insert(keys[i]);
+            data.insert(keys[i]);
         }
     }
 
     void serialize(ConstAggregateDataPtr __restrict place, BufferWritable& buf) const override {
-        auto& set = this->data(place).set;
-        write_var_uint(set.size(), buf);
-        for (const auto& elem : set) {
-            write_pod_binary(elem, buf);
-        }
+        const auto& data = this->data(place);
+        write_var_uint(data.size(), buf);
+        data.for_each([&](const auto& elem) { write_pod_binary(elem, buf); });
     }
 
     void deserialize_and_merge(AggregateDataPtr __restrict place, AggregateDataPtr __restrict rhs,
                                BufferReadable& buf, Arena*) const override {
-        auto& set = this->data(place).set;
+        auto& data = this->data(place);
         UInt64 size;
         read_var_uint(size, buf);
 
-        set.rehash(size + set.size());
+        data.reserve(size + data.size());
 
         for (size_t i = 0; i < size; ++i) {
             KeyType ref;
             read_pod_binary(ref, buf);
-            set.insert(ref);
+            data.insert(ref);
         }
     }
 
     void deserialize(AggregateDataPtr __restrict place, BufferReadable& buf,
                      Arena*) const override {
-        auto& set = this->data(place).set;
+        auto& data = this->data(place);
         UInt64 size;
         read_var_uint(size, buf);
 
-        set.rehash(size + set.size());
+        data.reserve(size + data.size());
 
         for (size_t i = 0; i < size; ++i) {
             KeyType ref;
             read_pod_binary(ref, buf);
-            set.insert(ref);
+            data.insert(ref);
         }
     }
 
     void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
-        assert_cast<ColumnInt64&>(to).get_data().push_back(this->data(place).set.size());
+        assert_cast<ColumnInt64&>(to).get_data().push_back(this->data(place).size());
     }
 };
 
@@ -17,6 +17,7 @@
 
 #include "vec/common/allocator.h"
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
 
 #include <atomic>
@@ -39,6 +40,28 @@
 #include "util/stack_util.h"
 #include "util/uid_util.h"
 
+bvar::Adder<int64_t> g_huge_page_advised_bytes("allocator_huge_page_advised_bytes");
+bvar::Adder<int64_t> g_huge_page_advise_failed_count("allocator_huge_page_advise_failed_count");
+
+namespace doris {
+void advise_huge_page(void* buf, size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    static constexpr uintptr_t HUGE_PAGE_SIZE = 2UL << 20;
+    const auto addr = reinterpret_cast<uintptr_t>(buf);
+    const auto begin = (addr + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    const auto end = (addr + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (end <= begin) {
+        return;
+    }
+    if (madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0) {
+        g_huge_page_advised_bytes << static_cast<int64_t>(end - begin);
+    } else {
+        g_huge_page_advise_failed_count << 1;
+    }
+#endif
+}
+} // namespace doris
+
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
@@ -57,6 +57,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <type_traits>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #ifdef THREAD_SANITIZER
@@ -64,6 +65,7 @@
 #define DISABLE_MREMAP 1
 #endif
 #include "common/exception.h"
+#include "vec/common/column_buffer_pool.h"
 #include "vec/common/mremap.h"
 
 /// Required for older Darwin builds, that lack definition of MAP_ANONYMOUS
@@ -89,7 +91,18 @@ static constexpr int ALLOCATOR_ALIGNMENT_16 = 16;
 
 namespace doris {
 class MemTrackerLimiter;
+
+// Advise the kernel to back the 2MB aligned part of [buf, buf + size) with transparent huge
+// pages. Fails silently (only counted) if THP is not supported.
+void advise_huge_page(void* buf, size_t size);
+
+inline void maybe_advise_huge_page(void* buf, size_t size) {
+    if (UNLIKELY(config::enable_huge_page_for_large_allocation &&
+                 size >= static_cast<size_t>(config::huge_page_allocation_threshold))) {
+        advise_huge_page(buf, size);
+    }
 }
+} // namespace doris
 
 class DefaultMemoryAllocator {
 public:
@@ -276,10 +289,17 @@ public:
             /// No need for zero-fill, because mmap guarantees it.
         } else {
             if (alignment <= MALLOC_MIN_ALIGNMENT) {
-                if constexpr (clear_memory)
+                if constexpr (clear_memory) {
                     buf = MemoryAllocator::calloc(size, 1);
-                else
-                    buf = MemoryAllocator::malloc(size);
+                } else {
+                    buf = nullptr;
+                    if constexpr (std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>) {
+                        buf = doris::vectorized::ColumnBufferPool::take(size);
+                    }
+                    if (buf == nullptr) {
+                        buf = MemoryAllocator::malloc(size);
+                    }
+                }
 
                 if (nullptr == buf) {
                     release_memory(size);
@@ -310,6 +330,7 @@ public:
         if constexpr (MemoryAllocator::need_record_actual_size()) {
             consume_memory(record_size - size);
         }
+        doris::maybe_advise_huge_page(buf, size);
         return buf;
     }
 
@@ -321,7 +342,13 @@ public:
             }
         } else {
             remove_address_sanitizers(buf, size);
-            MemoryAllocator::free(buf);
+            if constexpr (std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>) {
+                if (!doris::vectorized::ColumnBufferPool::give_back(buf, size)) {
+                    MemoryAllocator::free(buf);
+                }
+            } else {
+                MemoryAllocator::free(buf);
+            }
         }
         release_memory(size);
     }
@@ -354,6 +381,7 @@ public:
             }
             // usually, buf addr = new_buf addr, asan maybe not equal.
             add_address_sanitizers(new_buf, new_size);
+            doris::maybe_advise_huge_page(new_buf, new_size);
 
             buf = new_buf;
             if constexpr (clear_memory)
@@ -372,6 +400,7 @@ public:
             }
 
             /// No need for zero-fill, because mmap guarantees it.
+            doris::maybe_advise_huge_page(buf, new_size);
 
             if constexpr (mmap_populate) {
                 // MAP_POPULATE seems have no effect for mremap as for mmap,
@@ -32,6 +32,7 @@
 #include "gutil/dynamic_annotations.h"
 #include "vec/common/allocator.h"
 #include "vec/common/allocator_fwd.h"
+#include "vec/common/arena_chunk_pool.h"
 #include "vec/common/memcpy_small.h"
 
 namespace doris::vectorized {
@@ -59,7 +60,10 @@ private:
         Chunk* prev = nullptr;
 
         Chunk(size_t size_, Chunk* prev_) {
-            begin = reinterpret_cast<char*>(Allocator<false>::alloc(size_));
+            begin = reinterpret_cast<char*>(ArenaChunkPool::instance()->take(size_));
+            if (begin == nullptr) {
+                begin = reinterpret_cast<char*>(Allocator<false>::alloc(size_));
+            }
             pos = begin;
             end = begin + size_ - pad_right;
             prev = prev_;
@@ -74,7 +78,9 @@ private:
             /// asan, it will correctly poison the memory by itself.
             ASAN_UNPOISON_MEMORY_REGION(begin, size());
 
-            Allocator<false>::free(begin, size());
+            if (!ArenaChunkPool::instance()->give_back(begin, size())) {
+                Allocator<false>::free(begin, size());
+            }
 
             if (prev) delete prev;
         }
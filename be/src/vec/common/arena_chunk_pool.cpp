@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/arena_chunk_pool.h"
+
+#include <bvar/bvar.h>
+
+#include <cstdlib>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+bvar::Adder<int64_t> g_arena_chunk_pool_cached_bytes("arena_chunk_pool_cached_bytes");
+bvar::Adder<int64_t> g_arena_chunk_pool_hit_count("arena_chunk_pool_hit_count");
+
+ArenaChunkPool* ArenaChunkPool::instance() {
+    // never destructed, arenas may release chunks during static destruction
+    static auto* pool = new ArenaChunkPool();
+    return pool;
+}
+
+int ArenaChunkPool::_size_class(size_t size) {
+    if (size < MIN_CHUNK_SIZE || (size & (size - 1)) != 0) {
+        return -1;
+    }
+    auto size_class = __builtin_ctzll(size) - __builtin_ctzll(MIN_CHUNK_SIZE);
+    return size_class < static_cast<int>(NUM_SIZE_CLASSES) ? size_class : -1;
+}
+
+void* ArenaChunkPool::take(size_t size) {
+    auto size_class = _size_class(size);
+    if (size_class < 0) {
+        return nullptr;
+    }
+    auto& cached = _size_classes[size_class];
+    {
+        std::lock_guard l(cached.mutex);
+        if (cached.chunks.empty()) {
+            return nullptr;
+        }
+    }
+    // check the limits before taking the chunk, memory_check may throw
+    _allocator.memory_check(size);
+    void* chunk = nullptr;
+    {
+        std::lock_guard l(cached.mutex);
+        if (cached.chunks.empty()) {
+            return nullptr;
+        }
+        chunk = cached.chunks.back();
+        cached.chunks.pop_back();
+    }
+    _cached_bytes -= static_cast<int64_t>(size);
+    g_arena_chunk_pool_cached_bytes << -static_cast<int64_t>(size);
+    g_arena_chunk_pool_hit_count << 1;
+    _allocator.consume_memory(size);
+    return chunk;
+}
+
+bool ArenaChunkPool::give_back(void* chunk, size_t size) {
+    auto size_class = _size_class(size);
+    if (size_class < 0 ||
+        _cached_bytes.load(std::memory_order_relaxed) + static_cast<int64_t>(size) >
+                config::arena_chunk_pool_max_bytes) {
+        return false;
+    }
+    auto& cached = _size_classes[size_class];
+    {
+        std::lock_guard l(cached.mutex);
+        cached.chunks.push_back(chunk);
+    }
+    _cached_bytes += static_cast<int64_t>(size);
+    g_arena_chunk_pool_cached_bytes << static_cast<int64_t>(size);
+    _allocator.release_memory(size);
+    return true;
+}
+
+int64_t ArenaChunkPool::release_all() {
+    int64_t freed_bytes = 0;
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+        std::vector<void*> chunks;
+        {
+            std::lock_guard l(_size_classes[i].mutex);
+            chunks.swap(_size_classes[i].chunks);
+        }
+        const size_t size = MIN_CHUNK_SIZE << i;
+        for (auto* chunk : chunks) {
+            // cached chunks are not tracked, and Allocator<false> allocates them by malloc
+            std::free(chunk);
+        }
+        freed_bytes += static_cast<int64_t>(chunks.size() * size);
+    }
+    _cached_bytes -= freed_bytes;
+    g_arena_chunk_pool_cached_bytes << -freed_bytes;
+    return freed_bytes;
+}
+
+int64_t ArenaChunkPool::cached_bytes() const {
+    return _cached_bytes.load(std::memory_order_relaxed);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
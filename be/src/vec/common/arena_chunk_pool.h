@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "vec/common/allocator.h"
+#include "vec/common/allocator_fwd.h"
+
+namespace doris::vectorized {
+
+/** Process wide cache of freed Arena chunks, grouped by size.
+  * Arenas grow by doubling page sized chunks, so most chunks fall into a few size classes.
+  * Chunks of destroyed or cleared arenas are kept here and handed to the next arena asking for
+  * the same size, which saves malloc calls and keeps freed chunks from fragmenting the heap.
+  * Cached chunks are not tracked by any memory tracker, they are charged again when reused,
+  * and freed by the memory GC.
+  */
+class ArenaChunkPool {
+public:
+    static ArenaChunkPool* instance();
+
+    /// Get a cached chunk of exactly `size` bytes, or nullptr.
+    void* take(size_t size);
+
+    /// Keep the chunk in the pool, return false if it is not cacheable and the caller frees it.
+    bool give_back(void* chunk, size_t size);
+
+    /// Free all cached chunks, return the freed bytes.
+    int64_t release_all();
+
+    int64_t cached_bytes() const;
+
+private:
+    static constexpr size_t MIN_CHUNK_SIZE = 4096;
+    static constexpr size_t NUM_SIZE_CLASSES = 16; // 4K ~ 128M
+
+    static int _size_class(size_t size);
+
+    struct SizeClass {
+        std::mutex mutex;
+        std::vector<void*> chunks;
+    };
+
+    std::array<SizeClass, NUM_SIZE_CLASSES> _size_classes;
+    std::atomic<int64_t> _cached_bytes = 0;
+    Allocator<false> _allocator;
+};
+
+} // namespace doris::vectorized
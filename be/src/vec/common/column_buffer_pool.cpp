@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <bvar/bvar.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+bvar::Adder<int64_t> g_column_buffer_pool_cached_bytes("column_buffer_pool_cached_bytes");
+bvar::Adder<int64_t> g_column_buffer_pool_hit_count("column_buffer_pool_hit_count");
+
+namespace {
+constexpr size_t NUM_SIZE_CLASSES = 11; // 4K ~ 4M
+constexpr size_t THREAD_CACHE_BUFFERS_PER_CLASS = 16;
+
+size_t size_class(size_t size) {
+    return static_cast<size_t>(__builtin_ctzll(size) -
+                               __builtin_ctzll(ColumnBufferPool::MIN_BUFFER_SIZE));
+}
+
+struct GlobalPool {
+    struct SizeClass {
+        std::mutex mutex;
+        std::vector<void*> buffers;
+    };
+    std::array<SizeClass, NUM_SIZE_CLASSES> size_classes;
+    std::atomic<int64_t> cached_bytes = 0;
+
+    bool push(void* buf, size_t size) {
+        const auto bytes = static_cast<int64_t>(size);
+        if (cached_bytes.load(std::memory_order_relaxed) + bytes >
+            config::column_buffer_pool_max_bytes) {
+            return false;
+        }
+        auto& cached = size_classes[size_class(size)];
+        {
+            std::lock_guard l(cached.mutex);
+            cached.buffers.push_back(buf);
+        }
+        cached_bytes += bytes;
+        return true;
+    }
+
+    void* pop(size_t size) {
+        auto& cached = size_classes[size_class(size)];
+        void* buf = nullptr;
+        {
+            std::lock_guard l(cached.mutex);
+            if (cached.buffers.empty()) {
+                return nullptr;
+            }
+            buf = cached.buffers.back();
+            cached.buffers.pop_back();
+        }
+        cached_bytes -= static_cast<int64_t>(size);
+        return buf;
+    }
+};
+
+GlobalPool* global_pool() {
+    // never destructed, buffers may be freed during static destruction
+    static auto* pool = new GlobalPool();
+    return pool;
+}
+
+// fixed size arrays, so caching a buffer never allocates
+struct ThreadCache {
+    std::array<std::array<void*, THREAD_CACHE_BUFFERS_PER_CLASS>, NUM_SIZE_CLASSES> buffers;
+    std::array<size_t, NUM_SIZE_CLASSES> counts {};
+    int64_t cached_bytes = 0;
+
+    ~ThreadCache();
+};
+
+// set when the thread cache of an exiting thread is destructed, buffers freed later by other
+// thread local objects go to the global pool directly
+thread_local bool t_thread_cache_destroyed = false;
+thread_local ThreadCache t_thread_cache;
+
+ThreadCache::~ThreadCache() {
+    t_thread_cache_destroyed = true;
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+        const size_t size = ColumnBufferPool::MIN_BUFFER_SIZE << i;
+        for (size_t j = 0; j < counts[i]; ++j) {
+            if (!global_pool()->push(buffers[i][j], size)) {
+                g_column_buffer_pool_cached_bytes << -static_cast<int64_t>(size);
+                std::free(buffers[i][j]);
+            }
+        }
+        counts[i] = 0;
+    }
+    cached_bytes = 0;
+}
+} // namespace
+
+void* ColumnBufferPool::take(size_t size) {
+    if (!is_pooled_size(size) || config::column_buffer_pool_max_bytes <= 0) {
+        return nullptr;
+    }
+    void* buf = nullptr;
+    if (!t_thread_cache_destroyed) {
+        auto& cache = t_thread_cache;
+        const auto i = size_class(size);
+        if (cache.counts[i] > 0) {
+            buf = cache.buffers[i][--cache.counts[i]];
+            cache.cached_bytes -= static_cast<int64_t>(size);
+        }
+    }
+    if (buf == nullptr) {
+        buf = global_pool()->pop(size);
+    }
+    if (buf != nullptr) {
+        g_column_buffer_pool_cached_bytes << -static_cast<int64_t>(size);
+        g_column_buffer_pool_hit_count << 1;
+    }
+    return buf;
+}
+
+bool ColumnBufferPool::give_back(void* buf, size_t size) {
+    if (!is_pooled_size(size) || config::column_buffer_pool_max_bytes <= 0) {
+        return false;
+    }
+    bool cached = false;
+    if (!t_thread_cache_destroyed) {
+        auto& cache = t_thread_cache;
+        const auto i = size_class(size);
+        if (cache.counts[i] < THREAD_CACHE_BUFFERS_PER_CLASS &&
+            cache.cached_bytes + static_cast<int64_t>(size) <=
+                    config::column_buffer_thread_cache_bytes) {
+            cache.buffers[i][cache.counts[i]++] = buf;
+            cache.cached_bytes += static_cast<int64_t>(size);
+            cached = true;
+        }
+    }
+    if (!cached) {
+        cached = global_pool()->push(buf, size);
+    }
+    if (cached) {
+        g_column_buffer_pool_cached_bytes << static_cast<int64_t>(size);
+    }
+    return cached;
+}
+
+int64_t ColumnBufferPool::release_all() {
+    auto* pool = global_pool();
+    int64_t freed_bytes = 0;
+    for (size_t i = 0; i < NUM_SIZE_CLASSES; ++i) {
+        std::vector<void*> buffers;
+        {
+            std::lock_guard l(pool->size_classes[i].mutex);
+            buffers.swap(pool->size_classes[i].buffers);
+        }
+        for (auto* buf : buffers) {
+            std::free(buf);
+        }
+        freed_bytes += static_cast<int64_t>(buffers.size() * (MIN_BUFFER_SIZE << i));
+    }
+    pool->cached_bytes -= freed_bytes;
+    g_column_buffer_pool_cached_bytes << -freed_bytes;
+    return freed_bytes;
+}
+
+int64_t ColumnBufferPool::cached_bytes() {
+    return global_pool()->cached_bytes.load(std::memory_order_relaxed);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace doris::vectorized {
+
+/** Cache of freed malloc buffers of power-of-two sizes, e.g. the buffers of PODArray based
+  * columns, which are allocated and freed again for every batch.
+  * Freed buffers go to a small per-thread cache first, so they stay on the NUMA node of the
+  * thread, and overflow into a process wide pool shared by all queries.
+  * Cached buffers are not tracked by any memory tracker, the Allocator charges the tracker of
+  * the borrowing thread when a buffer is taken, and releases it when the buffer is given back.
+  */
+class ColumnBufferPool {
+public:
+    static constexpr size_t MIN_BUFFER_SIZE = 4096;
+    static constexpr size_t MAX_BUFFER_SIZE = 4UL << 20;
+
+    static bool is_pooled_size(size_t size) {
+        return size >= MIN_BUFFER_SIZE && size <= MAX_BUFFER_SIZE && (size & (size - 1)) == 0;
+    }
+
+    /// Get a cached buffer of exactly `size` bytes, or nullptr.
+    static void* take(size_t size);
+
+    /// Keep the buffer, return false if it is not cached and the caller frees it.
+    static bool give_back(void* buf, size_t size);
+
+    /// Free the buffers in the process wide pool, return the freed bytes.
+    static int64_t release_all();
+
+    /// Bytes cached in the process wide pool.
+    static int64_t cached_bytes();
+};
+
+} // namespace doris::vectorized
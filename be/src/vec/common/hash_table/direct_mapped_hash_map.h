@@ -0,0 +1,251 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <algorithm>
+#include <boost/noncopyable.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "vec/common/hash_table/hash.h"
+
+/// Hash map for one byte keys that addresses its cells by the key itself.
+/// Every possible key owns a cell, so lookups never probe and the map never
+/// grows. It keeps the PHHashMap interface so it can be used by the same
+/// hash methods; hash() still returns the real hash because spilling and
+/// partitioning rely on its distribution.
+template <typename Key, typename Mapped, typename HashMethod = DefaultHash<Key>>
+class DirectMappedHashMap : private boost::noncopyable {
+public:
+    static_assert(sizeof(Key) == 1, "DirectMappedHashMap only supports one byte keys");
+    static constexpr size_t NUM_CELLS = 1 << (8 * sizeof(Key));
+
+    using Self = DirectMappedHashMap;
+    using Hash = HashMethod;
+    using cell_type = std::pair<const Key, Mapped>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using Value = Mapped;
+    using value_type = std::pair<const Key, Mapped>;
+
+    using LookupResult = std::pair<const Key, Mapped>*;
+    using ConstLookupResult = const std::pair<const Key, Mapped>*;
+
+    DirectMappedHashMap() {
+        _cells.reserve(NUM_CELLS);
+        for (size_t i = 0; i < NUM_CELLS; ++i) {
+            _cells.emplace_back(static_cast<Key>(i), Mapped());
+        }
+        _occupied.resize(NUM_CELLS, 0);
+    }
+
+    DirectMappedHashMap(size_t /*reserve_for_num_elements*/) : DirectMappedHashMap() {}
+
+    DirectMappedHashMap(DirectMappedHashMap&& other) { *this = std::move(other); }
+
+    DirectMappedHashMap& operator=(DirectMappedHashMap&& rhs) {
+        _cells = std::move(rhs._cells);
+        _occupied = std::move(rhs._occupied);
+        _size = rhs._size;
+        rhs._size = 0;
+        return *this;
+    }
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+
+        Container* container = nullptr;
+        size_t index = 0;
+        friend class DirectMappedHashMap;
+
+        void skip_empty() {
+            while (index < NUM_CELLS && !container->_occupied[index]) {
+                ++index;
+            }
+        }
+
+    public:
+        iterator_base() {}
+        iterator_base(Container* container_, size_t index_) : container(container_), index(index_) {
+            skip_empty();
+        }
+
+        bool operator==(const iterator_base& rhs) const { return index == rhs.index; }
+        bool operator!=(const iterator_base& rhs) const { return index != rhs.index; }
+
+        Derived& operator++() {
+            ++index;
+            skip_empty();
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const { return container->_cells[index].first; }
+
+        const auto& get_second() const { return container->_cells[index].second; }
+
+        auto& get_second() { return container->_cells[index].second; }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return Hash()(get_first()); }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    const_iterator cbegin() const { return const_iterator(this, 0); }
+
+    iterator begin() { return iterator(this, 0); }
+
+    const_iterator end() const { return const_iterator(this, NUM_CELLS); }
+    const_iterator cend() const { return const_iterator(this, NUM_CELLS); }
+    iterator end() { return iterator(this, NUM_CELLS); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key_holder, LookupResult& it, bool& inserted) {
+        const auto index = cell_index(key_holder);
+        it = &_cells[index];
+        inserted = !_occupied[index];
+        if (inserted) {
+            if constexpr (std::is_pointer_v<std::remove_reference_t<mapped_type>>) {
+                it->second = nullptr;
+            } else {
+                it->second = mapped_type();
+            }
+            mark_occupied(index);
+        }
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key_holder, LookupResult& it, Func&& f) {
+        const auto index = cell_index(key_holder);
+        it = &_cells[index];
+        if (!_occupied[index]) {
+            f(constructor(index), key_holder);
+        }
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t /*hash_value*/) {
+        emplace(key, it, inserted);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t /*hash_value*/,
+                                    Func&& f) {
+        const auto index = cell_index(key);
+        it = &_cells[index];
+        if (!_occupied[index]) {
+            f(constructor(index), key, key);
+        }
+    }
+
+    void ALWAYS_INLINE insert(const Key& key, const Mapped& value) {
+        const auto index = cell_index(key);
+        if (!_occupied[index]) {
+            _cells[index].second = value;
+            mark_occupied(index);
+        }
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        const auto index = cell_index(key);
+        return _occupied[index] ? &_cells[index] : nullptr;
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t /*hash_value*/) {
+        return find(key);
+    }
+
+    size_t hash(const Key& x) const { return Hash()(x); }
+
+    /// All cells fit in a few cache lines, there is nothing worth prefetching.
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {}
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& v : *this) func(v.get_second());
+    }
+
+    size_t get_buffer_size_in_bytes() const {
+        return NUM_CELLS * (sizeof(cell_type) + sizeof(uint8_t));
+    }
+
+    bool add_elem_size_overflow(size_t row) const { return false; }
+
+    size_t size() const { return _size; }
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return _size == 0; }
+
+    void clear_and_shrink() {
+        std::fill(_occupied.begin(), _occupied.end(), 0);
+        _size = 0;
+    }
+
+    void reserve(size_t num_elem) {}
+
+private:
+    template <typename KeyHolder>
+    static size_t cell_index(const KeyHolder& key) {
+        return static_cast<std::make_unsigned_t<Key>>(key);
+    }
+
+    void mark_occupied(size_t index) {
+        _occupied[index] = 1;
+        ++_size;
+    }
+
+    auto constructor(size_t index) {
+        return [this, index](const auto& /*key*/, auto&& mapped) {
+            _cells[index].second = std::forward<decltype(mapped)>(mapped);
+            mark_occupied(index);
+        };
+    }
+
+    std::vector<cell_type> _cells;
+    std::vector<uint8_t> _occupied;
+    size_t _size = 0;
+};
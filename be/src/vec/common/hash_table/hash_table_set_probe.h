@@ -26,6 +26,8 @@ struct HashTableProbe {
     template <typename Parent>
     HashTableProbe(Parent* parent, int probe_rows)
             : _valid_element_in_hash_tbl(parent->valid_element_in_hash_tbl()),
+              _visited_rows(parent->visited_rows()),
+              _alive_rows(parent->alive_rows()),
               _probe_rows(probe_rows),
               _probe_raw_ptrs(parent->_probe_columns) {}
 
@@ -38,9 +40,15 @@ struct HashTableProbe {
         for (int probe_index = 0; probe_index < _probe_rows; probe_index++) {
             auto find_result = hash_table_ctx.find(key_getter, probe_index);
             if (find_result.is_found()) { //if found, marked visited
-                auto* it = &find_result.get_mapped();
-                if (!(it->visited)) {
-                    it->visited = true;
+                uint32_t row = find_result.get_mapped().row_num;
+                if constexpr (is_intersected) {
+                    // rows missed by a previous child are out of the intersection already
+                    if (!_alive_rows->test(row)) {
+                        continue;
+                    }
+                }
+                if (!_visited_rows->test(row)) {
+                    _visited_rows->set(row);
                     if constexpr (is_intersected) { //intersected
                         (*_valid_element_in_hash_tbl)++;
                     } else {
@@ -54,6 +62,8 @@ struct HashTableProbe {
 
 private:
     int64_t* _valid_element_in_hash_tbl = nullptr;
+    doris::SetRowBitmap* _visited_rows = nullptr;
+    doris::SetRowBitmap* _alive_rows = nullptr;
     const size_t _probe_rows;
     ColumnRawPtrs& _probe_raw_ptrs;
     std::vector<StringRef> _probe_keys;
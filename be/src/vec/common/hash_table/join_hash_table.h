@@ -19,13 +19,18 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <limits>
+#include <type_traits>
 
 #include "common/exception.h"
 #include "common/status.h"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_table_allocator.h"
+#include "vec/common/string_ref.h"
 
 namespace doris {
 template <typename Key, typename Hash = DefaultHash<Key>>
@@ -44,17 +49,28 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(_sorted_build_keys) + cal_vector_mem(_build_rows) +
+               cal_vector_mem(_build_key_tags);
     }
 
+    // If `radix_build` is true, build rows are sorted by bucket (see `_radix_build`), which costs
+    // a copy of keys and a position-to-row map but makes probing large tables cache friendly.
     template <int JoinOpType>
-    void prepare_build(size_t num_elem, int batch_size, bool has_null_key) {
+    void prepare_build(size_t num_elem, int batch_size, bool has_null_key,
+                       bool radix_build = false) {
         _has_null_key = has_null_key;
+        _is_radix_build = radix_build && num_elem > 1;
 
         // the first row in build side is not really from build side table
         _empty_build_side = num_elem <= 1;
         max_batch_size = batch_size;
         bucket_size = calc_bucket_size(num_elem + 1);
+        // advise huge pages before the buckets are touched by resize
+        first.reserve(bucket_size + 1);
+        next.reserve(num_elem);
+        maybe_advise_huge_page(first.data(), first.capacity() * sizeof(uint32_t));
+        maybe_advise_huge_page(next.data(), next.capacity() * sizeof(uint32_t));
         first.resize(bucket_size + 1);
         next.resize(num_elem);
 
@@ -74,13 +90,25 @@ public:
 
     bool empty_build_side() const { return _empty_build_side; }
 
+    bool is_radix_build() const { return _is_radix_build; }
+
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums, size_t num_elem,
                bool keep_null_key) {
-        build_keys = keys;
-        for (size_t i = 1; i < num_elem; i++) {
-            uint32_t bucket_num = bucket_nums[i];
-            next[i] = first[bucket_num];
-            first[bucket_num] = i;
+        if (_is_radix_build) {
+            _radix_build(keys, bucket_nums, num_elem);
+        } else {
+            build_keys = keys;
+            for (size_t i = 1; i < num_elem; i++) {
+                uint32_t bucket_num = bucket_nums[i];
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
+        }
+        if constexpr (std::is_same_v<Key, StringRef>) {
+            _build_key_tags.resize(num_elem);
+            for (size_t i = 0; i < num_elem; i++) {
+                _build_key_tags[i] = _string_key_tag(build_keys[i]);
+            }
         }
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
@@ -210,12 +238,143 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(std::vector<uint32>& buckets) const {
-        for (unsigned int& bucket : buckets) {
-            bucket = first[bucket];
+        const auto size = buckets.size();
+        for (size_t i = 0; i < size; i++) {
+            if (i + PREFETCH_STEP < size) {
+                __builtin_prefetch(&first[buckets[i + PREFETCH_STEP]]);
+            }
+            buckets[i] = first[buckets[i]];
+            if (_is_radix_build) {
+                // keys of a bucket are contiguous, so the whole chain is fetched at once
+                if constexpr (std::is_same_v<Key, StringRef>) {
+                    __builtin_prefetch(&_build_key_tags[buckets[i]]);
+                } else {
+                    __builtin_prefetch(&build_keys[buckets[i]]);
+                }
+            }
         }
     }
 
 private:
+    static constexpr size_t PREFETCH_STEP = 16;
+    // log2 of the buckets in one radix partition, 64K buckets (256KB of `first`) fit in L2 cache.
+    static constexpr uint32_t RADIX_PARTITION_BUCKET_BITS = 16;
+    static constexpr uint32_t MAX_RADIX_PARTITION_BITS = 10;
+
+    // Reorder build rows by bucket, so the chain of each bucket is a contiguous range of
+    // positions and `next[pos]` is `pos + 1` or 0. Chains hold positions instead of build rows,
+    // which are mapped back by `_build_rows` when matched rows are output.
+    //
+    // Rows are radix partitioned by the high bits of bucket number first, then sorted by bucket
+    // in each partition, so the random accesses of counting sort stay in a cache sized part of
+    // `first`.
+    void _radix_build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
+                      size_t num_elem) {
+        const uint32_t bucket_bits = std::countr_zero(bucket_size);
+        const uint32_t partition_bits =
+                bucket_bits > RADIX_PARTITION_BUCKET_BITS
+                        ? std::min(bucket_bits - RADIX_PARTITION_BUCKET_BITS,
+                                   MAX_RADIX_PARTITION_BITS)
+                        : 0;
+        const uint32_t shift = bucket_bits - partition_bits;
+        const uint32_t num_partitions = 1U << partition_bits;
+        // the null bucket (`bucket_size`) belongs to the last partition
+        auto partition_of = [&](uint32_t bucket_num) {
+            return std::min(bucket_num >> shift, num_partitions - 1);
+        };
+
+        // 1. Partition rows, positions of partition p start from `partition_offsets[p] + 1`.
+        std::vector<uint32_t> partition_offsets(num_partitions + 1, 0);
+        for (size_t i = 1; i < num_elem; i++) {
+            partition_offsets[partition_of(bucket_nums[i]) + 1]++;
+        }
+        for (uint32_t p = 1; p <= num_partitions; p++) {
+            partition_offsets[p] += partition_offsets[p - 1];
+        }
+        std::vector<uint32_t> partitioned_rows(num_elem - 1);
+        {
+            auto cursors = partition_offsets;
+            for (size_t i = 1; i < num_elem; i++) {
+                partitioned_rows[cursors[partition_of(bucket_nums[i])]++] = i;
+            }
+        }
+
+        // 2. Sort rows of each partition by bucket. `first` counts rows of buckets, then holds the
+        // end positions of non-empty buckets and at last their start positions.
+        _sorted_build_keys.resize(num_elem);
+        _build_rows.resize(num_elem);
+        _sorted_build_keys[0] = keys[0];
+        _build_rows[0] = 0;
+        for (uint32_t p = 0; p < num_partitions; p++) {
+            const auto* rows_begin = partitioned_rows.data() + partition_offsets[p];
+            const auto* rows_end = partitioned_rows.data() + partition_offsets[p + 1];
+            for (const auto* row = rows_begin; row != rows_end; row++) {
+                first[bucket_nums[*row]]++;
+            }
+            const uint32_t bucket_begin = p << shift;
+            const uint32_t bucket_end =
+                    p == num_partitions - 1 ? bucket_size + 1 : (p + 1) << shift;
+            uint32_t pos = partition_offsets[p] + 1;
+            for (uint32_t b = bucket_begin; b < bucket_end; b++) {
+                if (first[b] > 0) {
+                    pos += first[b];
+                    first[b] = pos;
+                }
+            }
+            for (const auto* row = rows_begin; row != rows_end; row++) {
+                const auto bucket_num = bucket_nums[*row];
+                const auto row_pos = --first[bucket_num];
+                _build_rows[row_pos] = *row;
+                _sorted_build_keys[row_pos] = keys[*row];
+                next[row_pos] = bucket_num;
+            }
+        }
+
+        // 3. Link positions of the same bucket, `next` holds bucket numbers before this.
+        for (size_t pos = 1; pos < num_elem; pos++) {
+            next[pos] = pos + 1 < num_elem && next[pos + 1] == next[pos] ? pos + 1 : 0;
+        }
+        build_keys = _sorted_build_keys.data();
+    }
+
+    // The tag of a string key packs its size and its first 4 bytes, like the inline prefix of
+    // a German-style string. Keys of at most 4 bytes are equal iff their tags are equal.
+    static uint64_t _string_key_tag(const StringRef& key) {
+        uint32_t prefix = 0;
+        if (key.size > 0) {
+            memcpy(&prefix, key.data, std::min<size_t>(key.size, sizeof(prefix)));
+        }
+        return (static_cast<uint64_t>(key.size) << 32) | prefix;
+    }
+
+    // String keys are compared by tags first, which rejects most keys of a chain without
+    // touching the chars of build keys.
+    bool _key_eq(const Key& probe_key, uint32_t build_idx) const {
+        if constexpr (std::is_same_v<Key, StringRef>) {
+            if (_string_key_tag(probe_key) != _build_key_tags[build_idx]) {
+                return false;
+            }
+            return probe_key.size <= sizeof(uint32_t) || probe_key == build_keys[build_idx];
+        } else {
+            return probe_key == build_keys[build_idx];
+        }
+    }
+
+    // Map positions in `build_idxs` to build rows.
+    void _to_build_rows(uint32_t* __restrict build_idxs, uint32_t count) const {
+        if (!_is_radix_build) {
+            return;
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            build_idxs[i] = _build_rows[build_idxs[i]];
+        }
+    }
+
+    // `visited` is indexed by build rows, while chains hold positions in radix build.
+    uint32_t _build_row(uint32_t build_idx) const {
+        return _is_radix_build ? _build_rows[build_idx] : build_idx;
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -245,8 +404,8 @@ private:
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
-                if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
-                    visited[build_idx] = 1;
+                if (!visited[_build_row(build_idx)] && _key_eq(keys[probe_idx], build_idx)) {
+                    visited[_build_row(build_idx)] = 1;
                 }
                 build_idx = next[build_idx];
             }
@@ -273,7 +432,7 @@ private:
 
             auto build_idx = build_idx_map[probe_idx];
 
-            while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
+            while (build_idx && !_key_eq(keys[probe_idx], build_idx)) {
                 build_idx = next[build_idx];
             }
             bool matched = JoinOpType == TJoinOp::LEFT_SEMI_JOIN ? build_idx != 0 : build_idx == 0;
@@ -294,14 +453,15 @@ private:
             while (build_idx && matched_cnt < batch_size) {
                 if constexpr (JoinOpType == TJoinOp::RIGHT_ANTI_JOIN ||
                               JoinOpType == TJoinOp::RIGHT_SEMI_JOIN) {
-                    if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
+                    if (!visited[_build_row(build_idx)] &&
+                        _key_eq(keys[probe_idx], build_idx)) {
                         probe_idxs[matched_cnt] = probe_idx;
                         build_idxs[matched_cnt] = build_idx;
                         matched_cnt++;
                     }
                 }
 
-                if (keys[probe_idx] == build_keys[build_idx]) {
+                if (_key_eq(keys[probe_idx], build_idx)) {
                     build_idxs[matched_cnt] = build_idx;
                     probe_idxs[matched_cnt] = probe_idx;
                     matched_cnt++;
@@ -341,6 +501,7 @@ private:
         }
 
         probe_idx -= (build_idx != 0);
+        _to_build_rows(build_idxs, matched_cnt);
         return std::tuple {probe_idx, build_idx, matched_cnt};
     }
 
@@ -355,14 +516,14 @@ private:
 
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
-                if (keys[probe_idx] == build_keys[build_idx]) {
+                if (_key_eq(keys[probe_idx], build_idx)) {
                     probe_idxs[matched_cnt] = probe_idx;
                     build_idxs[matched_cnt] = build_idx;
                     matched_cnt++;
                     if constexpr (JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
                                   JoinOpType == TJoinOp::FULL_OUTER_JOIN) {
-                        if (!visited[build_idx]) {
-                            visited[build_idx] = 1;
+                        if (!visited[_build_row(build_idx)]) {
+                            visited[_build_row(build_idx)] = 1;
                         }
                     }
                 }
@@ -395,6 +556,7 @@ private:
         }
 
         probe_idx -= (build_idx != 0);
+        _to_build_rows(build_idxs, matched_cnt);
         return std::tuple {probe_idx, build_idx, matched_cnt};
     }
 
@@ -416,7 +578,7 @@ private:
             }
 
             while (build_idx && matched_cnt < batch_size) {
-                if (picking_null_keys || keys[probe_idx] == build_keys[build_idx]) {
+                if (picking_null_keys || _key_eq(keys[probe_idx], build_idx)) {
                     build_idxs[matched_cnt] = build_idx;
                     probe_idxs[matched_cnt] = probe_idx;
                     null_flags[matched_cnt] = picking_null_keys;
@@ -465,6 +627,7 @@ private:
         }
 
         probe_idx -= (build_idx != 0);
+        _to_build_rows(build_idxs, matched_cnt);
         return std::tuple {probe_idx, build_idx, matched_cnt, picking_null_keys};
     }
 
@@ -477,6 +640,13 @@ private:
     std::vector<uint32_t> first = {0};
     std::vector<uint32_t> next = {0};
 
+    // Only used by radix build, keys and build rows ordered by position.
+    std::vector<Key> _sorted_build_keys;
+    // `_string_key_tag` of `build_keys`, only for string keys
+    std::vector<uint64_t> _build_key_tags;
+    std::vector<uint32_t> _build_rows;
+    bool _is_radix_build = false;
+
     // use in iter hash map
     mutable uint32_t iter_idx = 1;
     vectorized::Arena* pool;
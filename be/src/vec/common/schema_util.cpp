@@ -35,6 +35,7 @@
 #include <memory>
 #include <ostream>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -411,9 +412,20 @@ void inherit_column_attributes(TabletSchemaSPtr& schema) {
     }
 }
 
-Status get_least_common_schema(const std::vector<TabletSchemaSPtr>& schemas,
+Status get_least_common_schema(const std::vector<TabletSchemaSPtr>& input_schemas,
                                const TabletSchemaSPtr& base_schema, TabletSchemaSPtr& output_schema,
                                bool check_schema_size) {
+    // Rowsets written with the same schema share one TabletSchema through TabletSchemaCache, so
+    // merging every distinct schema once makes the cost follow the number of distinct schemas
+    // instead of the number of rowsets of a tablet.
+    std::vector<TabletSchemaSPtr> schemas;
+    schemas.reserve(input_schemas.size());
+    std::unordered_set<const TabletSchema*> visited_schemas;
+    for (const auto& schema : input_schemas) {
+        if (visited_schemas.insert(schema.get()).second) {
+            schemas.push_back(schema);
+        }
+    }
     std::vector<int32_t> variant_column_unique_id;
 
     // Construct a schema excluding the extracted columns and gather unique identifiers for variants.
@@ -602,6 +614,26 @@ Status extract(ColumnPtr source, const PathInData& path, MutableColumnPtr& dst)
     return Status::OK();
 }
 
+bool need_extracted_column_bloom_filter(const TabletColumn& column) {
+    if (!config::enable_variant_subcolumn_bloom_filter || !column.is_extracted_column()) {
+        return false;
+    }
+    switch (column.type()) {
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_CHAR:
+    case FieldType::OLAP_FIELD_TYPE_VARCHAR:
+    case FieldType::OLAP_FIELD_TYPE_STRING:
+        return true;
+    default:
+        // tinyint and floating point values are not supported by bloom filter indexes, the
+        // values of other types are rarely looked up by equality in semi-structured data
+        return false;
+    }
+}
+
 bool has_schema_index_diff(const TabletSchema* new_schema, const TabletSchema* old_schema,
                            int32_t new_col_idx, int32_t old_col_idx) {
     const auto& column_new = new_schema->column(new_col_idx);
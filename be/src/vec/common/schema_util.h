@@ -114,6 +114,10 @@ void inherit_column_attributes(TabletSchemaSPtr& schema);
 void inherit_column_attributes(const TabletColumn& source, TabletColumn& target,
                                TabletSchemaSPtr& target_schema);
 
+// Whether a bloom filter index should be written for an extracted column that does not inherit
+// one from its variant column, see config::enable_variant_subcolumn_bloom_filter.
+bool need_extracted_column_bloom_filter(const TabletColumn& column);
+
 // get sorted subcolumns of variant
 vectorized::ColumnObject::Subcolumns get_sorted_subcolumns(
         const vectorized::ColumnObject::Subcolumns& subcolumns);
@@ -118,7 +118,11 @@ public:
 
     size_t capacity() const { return m_capacity; }
 
-    void clear() { return destroy_elements(); }
+    // The alpha map keeps its size, inserting into a full set after clear() still needs it.
+    void clear() {
+        destroy_elements();
+        alpha_map.resize(next_alpha_size(m_capacity));
+    }
 
     void resize(size_t new_capacity) {
         counter_list.reserve(new_capacity);
@@ -191,7 +195,8 @@ public:
         }
 
         for (auto& counter : boost::adaptors::reverse(rhs.counter_list)) {
-            size_t hash = counter_map.hash(counter->key);
+            // both sets hash with the same function, the hash of rhs is reused.
+            size_t hash = counter->hash;
             if (auto* current = find_counter(counter->key, hash)) {
                 current->count += (counter->count - m2);
                 current->error += (counter->error - m2);
@@ -202,15 +207,17 @@ public:
             }
         }
 
-        std::sort(counter_list.begin(), counter_list.end(),
-                  [](const auto& l, const auto& r) { return *l > *r; });
-
+        auto greater = [](const auto& l, const auto& r) { return *l > *r; };
         if (counter_list.size() > m_capacity) {
+            // select the counters kept before sorting, the dropped ones are never sorted.
+            std::nth_element(counter_list.begin(), counter_list.begin() + m_capacity,
+                             counter_list.end(), greater);
             for (size_t i = m_capacity; i < counter_list.size(); ++i) {
                 arena.free(counter_list[i]->key);
             }
             counter_list.resize(m_capacity);
         }
+        std::sort(counter_list.begin(), counter_list.end(), greater);
 
         for (size_t i = 0; i < counter_list.size(); ++i) {
             counter_list[i]->slot = i;
@@ -257,14 +264,14 @@ public:
         read_alpha_map(rb);
     }
 
-    // Reads the alpha map data from the provided readable buffer.
+    // Reads the alpha map data from the provided readable buffer, it replaces the current alpha
+    // map so that its size stays a power of two.
     void read_alpha_map(BufferReadable& rb) {
         uint64_t alpha_size = 0;
         read_var_uint(alpha_size, rb);
+        alpha_map.resize(alpha_size);
         for (size_t i = 0; i < alpha_size; ++i) {
-            uint64_t alpha = 0;
-            read_var_uint(alpha, rb);
-            alpha_map.push_back(alpha);
+            read_var_uint(alpha_map[i], rb);
         }
     }
 
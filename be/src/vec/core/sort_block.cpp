@@ -20,10 +20,154 @@
 
 #include "vec/core/sort_block.h"
 
+#include <limits>
+
+#include "common/config.h"
+#include "vec/columns/columns_number.h"
 #include "vec/core/column_with_type_and_name.h"
 
 namespace doris::vectorized {
 
+namespace {
+
+// Blocks smaller than it are sorted by the comparators, building the keys does not pay off.
+constexpr size_t NORMALIZED_KEY_SORT_MIN_ROWS = 256;
+
+using NormalizedRow = std::pair<uint64_t, uint32_t>;
+
+// Sorts `rows` by the low `key_bytes` bytes of their normalized key with a stable LSD radix
+// sort, one byte per pass. Passes whose byte is the same for all rows are skipped.
+void radix_sort_by_normalized_key(std::vector<NormalizedRow>& rows, size_t key_bytes) {
+    std::vector<NormalizedRow> buffer(rows.size());
+    for (size_t pass = 0; pass < key_bytes; ++pass) {
+        const size_t shift = pass * 8;
+        size_t counts[256] = {0};
+        for (const auto& row : rows) {
+            counts[(row.first >> shift) & 0xFF]++;
+        }
+        if (counts[(rows[0].first >> shift) & 0xFF] == rows.size()) {
+            continue;
+        }
+        size_t offset = 0;
+        for (size_t& count : counts) {
+            size_t c = count;
+            count = offset;
+            offset += c;
+        }
+        for (const auto& row : rows) {
+            buffer[counts[(row.first >> shift) & 0xFF]++] = row;
+        }
+        rows.swap(buffer);
+    }
+}
+
+// Byte comparable encoding of the value of a fixed width column, in ascending order.
+using NormalizeKeyFunc = uint64_t (*)(const char* data, size_t row);
+
+template <typename T>
+uint64_t normalize_key(const char* data, size_t row) {
+    T value;
+    memcpy(&value, data + row * sizeof(T), sizeof(T));
+    auto key = static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(value));
+    if constexpr (std::is_signed_v<T>) {
+        // flip the sign bit so that negative values sort before positive ones
+        key ^= uint64_t(1) << (sizeof(T) * 8 - 1);
+    }
+    return key;
+}
+
+NormalizeKeyFunc get_normalize_key_func(const IColumn& column) {
+#define NORMALIZE_KEY_OF(ColumnType, NativeType)               \
+    if (check_and_get_column<ColumnType>(column) != nullptr) { \
+        return normalize_key<NativeType>;                      \
+    }
+    NORMALIZE_KEY_OF(ColumnUInt8, uint8_t)
+    NORMALIZE_KEY_OF(ColumnInt8, int8_t)
+    NORMALIZE_KEY_OF(ColumnInt16, int16_t)
+    NORMALIZE_KEY_OF(ColumnInt32, int32_t)
+    NORMALIZE_KEY_OF(ColumnInt64, int64_t)
+    NORMALIZE_KEY_OF(ColumnUInt32, uint32_t)
+    NORMALIZE_KEY_OF(ColumnUInt64, uint64_t)
+    NORMALIZE_KEY_OF(ColumnDecimal32, int32_t)
+    NORMALIZE_KEY_OF(ColumnDecimal64, int64_t)
+#undef NORMALIZE_KEY_OF
+    return nullptr;
+}
+
+// Sorts `perm` by the leading sort columns that fit into a 64 bits normalized key, and marks
+// the rows equal to their previous row on these columns in `flags`. Returns the number of sort
+// columns sorted, 0 if the first one can not be normalized.
+size_t sort_by_normalized_key(const ColumnsWithSortDescriptions& columns,
+                              IColumn::Permutation& perm, EqualFlags& flags) {
+    struct NormalizedKeyColumn {
+        const char* data;
+        const uint8_t* null_map;
+        NormalizeKeyFunc normalize;
+        size_t bits;
+        uint64_t value_mask;
+        bool descending;
+        bool nulls_first;
+    };
+    std::vector<NormalizedKeyColumn> key_columns;
+    size_t total_bits = 0;
+    for (const auto& [column_ptr, desc] : columns) {
+        const IColumn* column = column_ptr;
+        const uint8_t* null_map = nullptr;
+        if (column->is_nullable()) {
+            const auto* nullable = assert_cast<const ColumnNullable*>(column);
+            null_map = nullable->get_null_map_data().data();
+            column = nullable->get_nested_column_ptr().get();
+        }
+        auto normalize = get_normalize_key_func(*column);
+        if (normalize == nullptr) {
+            break;
+        }
+        size_t value_bits = column->size_of_value_if_fixed() * 8;
+        // nullable columns take an extra byte for the null flag
+        size_t bits = value_bits + (null_map != nullptr ? 8 : 0);
+        if (total_bits + bits > 64) {
+            break;
+        }
+        key_columns.push_back({column->get_raw_data().data, null_map, normalize, bits,
+                               value_bits == 64 ? ~uint64_t(0) : (uint64_t(1) << value_bits) - 1,
+                               desc.direction < 0, desc.nulls_direction * desc.direction < 0});
+        total_bits += bits;
+    }
+    if (key_columns.empty()) {
+        return 0;
+    }
+
+    std::vector<NormalizedRow> rows(perm.size());
+    for (size_t row = 0; row < rows.size(); row++) {
+        uint64_t key = 0;
+        for (const auto& column : key_columns) {
+            uint64_t value = 0;
+            bool is_null = column.null_map != nullptr && column.null_map[row];
+            if (!is_null) {
+                value = column.normalize(column.data, row);
+                if (column.descending) {
+                    value = ~value & column.value_mask;
+                }
+            }
+            if (column.null_map != nullptr && is_null != column.nulls_first) {
+                value |= uint64_t(1) << (column.bits - 8);
+            }
+            // shifting by 64 is undefined, the first column may take all the bits
+            key = column.bits == 64 ? value : (key << column.bits) | value;
+        }
+        rows[row] = {key, static_cast<uint32_t>(row)};
+    }
+    radix_sort_by_normalized_key(rows, (total_bits + 7) / 8);
+
+    for (size_t i = 0; i < rows.size(); i++) {
+        perm[i] = rows[i].second;
+        flags[i] = i > 0 && rows[i - 1].first == rows[i].first;
+    }
+    return key_columns.size();
+}
+
+} // namespace
+
 ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block,
                                                               const SortDescription& description) {
     size_t size = description.size();
@@ -82,8 +226,14 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
+            size_t sorted_columns = 0;
+            if (config::enable_sort_by_normalized_key && limit == 0 &&
+                size >= NORMALIZED_KEY_SORT_MIN_ROWS &&
+                size <= std::numeric_limits<uint32_t>::max()) {
+                sorted_columns = sort_by_normalized_key(columns_with_sort_desc, perm, flags);
+            }
             // TODO: ColumnSorter should be constructed only once.
-            for (size_t i = 0; i < columns_with_sort_desc.size(); i++) {
+            for (size_t i = sorted_columns; i < columns_with_sort_desc.size(); i++) {
                 ColumnSorter sorter(columns_with_sort_desc[i], limit);
                 sorter.operator()(flags, perm, range, i == columns_with_sort_desc.size() - 1);
             }
@@ -202,8 +202,10 @@ void DataTypeNumberSerDe<T>::read_column_from_arrow(IColumn& column,
     // now uint8 for bool
     if constexpr (std::is_same_v<T, UInt8>) {
         auto concrete_array = dynamic_cast<const arrow::BooleanArray*>(arrow_array);
-        for (size_t bool_i = 0; bool_i != static_cast<size_t>(concrete_array->length()); ++bool_i) {
-            col_data.emplace_back(concrete_array->Value(bool_i));
+        const size_t old_size = col_data.size();
+        col_data.resize(old_size + row_count);
+        for (int bool_i = 0; bool_i < row_count; ++bool_i) {
+            col_data[old_size + bool_i] = concrete_array->Value(start + bool_i);
         }
         return;
     }
@@ -84,8 +84,33 @@ Status ArrowStreamReader::get_next_block(Block* block, size_t* read_rows, bool*
             std::move(res_reader).ValueUnsafe();
 
     // convert arrow batch to block
-    auto columns = block->mutate_columns();
     int batch_size = out_batches.size();
+    if (batch_size == 0) {
+        *eof = true;
+        return Status::OK();
+    }
+
+    // All batches of one stream share the schema, so resolve the destination columns once.
+    // Reserving the total row count up front lets the serdes append whole arrow buffers without
+    // regrowing the column storage for every batch.
+    const auto& schema = *out_batches[0]->schema();
+    size_t total_rows = 0;
+    for (const auto& batch : out_batches) {
+        total_rows += batch->num_rows();
+    }
+    std::vector<vectorized::ColumnWithTypeAndName*> dst_columns(schema.num_fields());
+    std::vector<DataTypeSerDeSPtr> dst_serdes(schema.num_fields());
+    try {
+        for (int c = 0; c < schema.num_fields(); ++c) {
+            dst_columns[c] = &block->get_by_name(schema.field(c)->name());
+            dst_serdes[c] = dst_columns[c]->type->get_serde();
+            auto& dst = dst_columns[c]->column->assume_mutable_ref();
+            dst.reserve(dst.size() + total_rows);
+        }
+    } catch (Exception& e) {
+        return Status::InternalError("Failed to convert from arrow to block: {}", e.what());
+    }
+
     for (int i = 0; i < batch_size; i++) {
         arrow::RecordBatch& batch = *out_batches[i];
         int num_rows = batch.num_rows();
@@ -93,13 +118,9 @@ Status ArrowStreamReader::get_next_block(Block* block, size_t* read_rows, bool*
         for (int c = 0; c < num_columns; ++c) {
             arrow::Array* column = batch.column(c).get();
 
-            std::string column_name = batch.schema()->field(c)->name();
-
             try {
-                vectorized::ColumnWithTypeAndName& column_with_name =
-                        block->get_by_name(column_name);
-                column_with_name.type->get_serde()->read_column_from_arrow(
-                        column_with_name.column->assume_mutable_ref(), column, 0, num_rows, _ctzz);
+                dst_serdes[c]->read_column_from_arrow(
+                        dst_columns[c]->column->assume_mutable_ref(), column, 0, num_rows, _ctzz);
             } catch (Exception& e) {
                 return Status::InternalError("Failed to convert from arrow to block: {}", e.what());
             }
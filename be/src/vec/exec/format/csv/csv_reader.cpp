@@ -43,6 +43,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/common/typeid_cast.h"
@@ -89,9 +90,22 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
                                                          std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const char sep = _value_sep[0];
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] == _value_sep[0]) {
+    size_t i = 0;
+    // compare bits_mask_length() bytes at a time and only visit the separators found
+    constexpr size_t step = simd::bits_mask_length();
+    for (; i + step <= size; i += step) {
+        simd::iterate_through_bits_mask(
+                [&](size_t pos) {
+                    process_value_func(data, value_start, i + pos - value_start, _trimming_char,
+                                       splitted_values);
+                    value_start = i + pos + 1;
+                },
+                simd::bytes_equal_mask(reinterpret_cast<const uint8_t*>(data + i), sep));
+    }
+    for (; i < size; ++i) {
+        if (data[i] == sep) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
             value_start = i + _value_sep_len;
         }
@@ -177,15 +191,26 @@ void PlainCsvTextFieldSplitter::do_split(const Slice& line, std::vector<Slice>*
 void HiveCsvTextFieldSplitter::do_split(const Slice& line, std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const char sep = _value_sep[0];
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] == _value_sep[0]) {
-            // hive will escape the field separator in string
-            if (_escape_char != 0 && i > 0 && data[i - 1] == _escape_char) {
-                continue;
-            }
-            process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
-            value_start = i + _value_sep_len;
+    auto on_sep = [&](size_t i) {
+        // hive will escape the field separator in string
+        if (_escape_char != 0 && i > 0 && data[i - 1] == _escape_char) {
+            return;
+        }
+        process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
+        value_start = i + _value_sep_len;
+    };
+    size_t i = 0;
+    constexpr size_t step = simd::bits_mask_length();
+    for (; i + step <= size; i += step) {
+        simd::iterate_through_bits_mask(
+                [&](size_t pos) { on_sep(i + pos); },
+                simd::bytes_equal_mask(reinterpret_cast<const uint8_t*>(data + i), sep));
+    }
+    for (; i < size; ++i) {
+        if (data[i] == sep) {
+            on_sep(i);
         }
     }
     process_value_func(data, value_start, size - value_start, _trimming_char, splitted_values);
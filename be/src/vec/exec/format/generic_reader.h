@@ -65,6 +65,13 @@ public:
         return Status::OK();
     }
 
+    /// Conjuncts of the runtime filters arrived after the reader was initialized.
+    /// The reader may use them to skip the data not read yet, the rows are still
+    /// filtered by the scanner, so ignoring them is always correct.
+    virtual Status append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) {
+        return Status::OK();
+    }
+
     virtual Status close() { return Status::OK(); }
 
 protected:
@@ -32,6 +32,8 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cctype>
+#include <charconv>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -59,6 +61,7 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_struct.h"
+#include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/typeid_cast.h"
 #include "vec/core/block.h"
@@ -1642,6 +1645,45 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
     return Status::OK();
 }
 
+template <typename T>
+static bool write_number_from_chars(std::string_view token, IColumn* column) {
+    using NativeType = std::conditional_t<std::is_same_v<T, Int128>, Int64, T>;
+    NativeType value;
+    const char* end = token.data() + token.size();
+    auto [ptr, ec] = std::from_chars(token.data(), end, value);
+    if (ec != std::errc() || ptr != end) {
+        return false;
+    }
+    assert_cast<ColumnVector<T>*>(column)->get_data().push_back(static_cast<T>(value));
+    return true;
+}
+
+bool NewJsonReader::try_write_number_to_column(std::string_view token, PrimitiveType type,
+                                               IColumn* column) {
+    // ondemand raw tokens may carry the white space up to the next structural character
+    while (!token.empty() && std::isspace(static_cast<unsigned char>(token.back()))) {
+        token.remove_suffix(1);
+    }
+    switch (type) {
+    case TYPE_TINYINT:
+        return write_number_from_chars<Int8>(token, column);
+    case TYPE_SMALLINT:
+        return write_number_from_chars<Int16>(token, column);
+    case TYPE_INT:
+        return write_number_from_chars<Int32>(token, column);
+    case TYPE_BIGINT:
+        return write_number_from_chars<Int64>(token, column);
+    case TYPE_LARGEINT:
+        return write_number_from_chars<Int128>(token, column);
+    case TYPE_FLOAT:
+        return write_number_from_chars<Float32>(token, column);
+    case TYPE_DOUBLE:
+        return write_number_from_chars<Float64>(token, column);
+    default:
+        return false;
+    }
+}
+
 Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value& value,
                                                      const TypeDescriptor& type_desc,
                                                      vectorized::IColumn* column_ptr,
@@ -1683,12 +1725,16 @@ Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value&
                                                                        _serde_options));
 
         } else {
-            // Maybe we can `switch (value->GetType()) case: kNumberType`.
             // Note that `if (value->IsInt())`, but column is FloatColumn.
+            const bool is_number = value.type() == simdjson::ondemand::json_type::number;
             std::string_view json_str = simdjson::to_json_string(value);
-            Slice slice {json_str.data(), json_str.size()};
-            RETURN_IF_ERROR(data_serde->deserialize_one_cell_from_json(*data_column_ptr, slice,
-                                                                       _serde_options));
+            // Numbers going to numeric columns skip the serde text parsing.
+            if (!is_number ||
+                !try_write_number_to_column(json_str, type_desc.type, data_column_ptr)) {
+                Slice slice {json_str.data(), json_str.size()};
+                RETURN_IF_ERROR(data_serde->deserialize_one_cell_from_json(
+                        *data_column_ptr, slice, _serde_options));
+            }
         }
     } else if (type_desc.type == TYPE_STRUCT) {
         if (value.type() != simdjson::ondemand::json_type::object) [[unlikely]] {
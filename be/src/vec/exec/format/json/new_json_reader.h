@@ -38,6 +38,7 @@
 #include "exprs/json_functions.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "runtime/define_primitive_type.h"
 #include "util/runtime_profile.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/types.h"
@@ -95,6 +96,12 @@ public:
     Status get_parsed_schema(std::vector<std::string>* col_names,
                              std::vector<TypeDescriptor>* col_types) override;
 
+    // Parse a json number token straight into a not nullable numeric column of `type`.
+    // Returns false, leaving the column untouched, when the type is not handled or the token
+    // does not fit it exactly, so that the caller can fall back to the serde text path.
+    static bool try_write_number_to_column(std::string_view token, PrimitiveType type,
+                                           IColumn* column);
+
 protected:
     void _collect_profile_before_close() override;
 
@@ -200,6 +200,8 @@ void OrcReader::_collect_profile_before_close() {
         COUNTER_UPDATE(_orc_profile.decode_value_time, _statistics.decode_value_time);
         COUNTER_UPDATE(_orc_profile.decode_null_map_time, _statistics.decode_null_map_time);
         COUNTER_UPDATE(_orc_profile.filter_block_time, _statistics.filter_block_time);
+        COUNTER_UPDATE(_orc_profile.runtime_filtered_stripes,
+                       _statistics.runtime_filtered_stripes);
 
         if (_file_input_stream != nullptr) {
             _file_input_stream->collect_profile_before_close();
@@ -239,6 +241,8 @@ void OrcReader::_init_profile() {
                 ADD_COUNTER_WITH_LEVEL(_profile, "SelectedRowGroupCount", TUnit::UNIT, 1);
         _orc_profile.evaluated_row_group_count =
                 ADD_COUNTER_WITH_LEVEL(_profile, "EvaluatedRowGroupCount", TUnit::UNIT, 1);
+        _orc_profile.runtime_filtered_stripes =
+                ADD_COUNTER_WITH_LEVEL(_profile, "RuntimeFilteredStripes", TUnit::UNIT, 1);
     }
 }
 
@@ -931,6 +935,112 @@ bool OrcReader::_init_search_argument(const VExprContextSPtrs& conjuncts) {
     return true;
 }
 
+Status OrcReader::append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) {
+    if (_row_reader == nullptr || _push_down_agg_type == TPushAggOp::type::COUNT) {
+        return Status::OK();
+    }
+    bool can_push_down = false;
+    for (const auto& conjunct : conjuncts) {
+        _late_arrival_conjuncts.emplace_back(conjunct);
+        if (_lazy_read_ctx.can_lazy_read && _is_late_arrival_lazy_predicate(conjunct)) {
+            _late_arrival_filter_conjuncts.emplace_back(conjunct);
+        }
+        if (_enable_filter_by_min_max && _check_expr_can_push_down(conjunct->root())) {
+            can_push_down = true;
+        }
+    }
+    if (!can_push_down) {
+        return Status::OK();
+    }
+
+    // The row reader keeps the search argument it was created with, so the stripes excluded by
+    // the rebuilt one are skipped by seeking over them in get_next_block_impl.
+    VExprContextSPtrs all_conjuncts = _lazy_read_ctx.conjuncts;
+    all_conjuncts.insert(all_conjuncts.end(), _late_arrival_conjuncts.begin(),
+                         _late_arrival_conjuncts.end());
+    try {
+        if (!_init_search_argument(all_conjuncts)) {
+            return Status::OK();
+        }
+        _late_arrival_stripes_needed = _reader->getNeedReadStripes(_row_reader_options);
+        if (_stripe_first_rows.empty()) {
+            const int64_t range_end_offset = _range_start_offset + _range_size;
+            uint64_t first_row = 0;
+            for (uint64_t i = 0; i < _reader->getNumberOfStripes(); ++i) {
+                std::unique_ptr<orc::StripeInformation> strip_info = _reader->getStripe(i);
+                _stripe_first_rows.push_back(first_row);
+                // the same rule as orc::RowReaderOptions::range
+                _stripe_in_range.push_back(strip_info->getOffset() >= _range_start_offset &&
+                                           strip_info->getOffset() < range_end_offset);
+                first_row += strip_info->getNumberOfRows();
+            }
+        }
+    } catch (std::exception& e) {
+        return Status::InternalError("Orc reader apply late arrival conjuncts failed: {}, {}",
+                                     e.what(), _scan_range.path);
+    }
+    return Status::OK();
+}
+
+bool OrcReader::_is_late_arrival_lazy_predicate(const VExprContextSPtr& conjunct) {
+    // The lazy read filter only fills the predicate columns, and the dict filter columns hold
+    // dict codes while it runs.
+    const std::vector<int>& predicate_slot_ids = _lazy_read_ctx.predicate_columns.second;
+    std::function<bool(const VExpr* expr)> visit_slot = [&](const VExpr* expr) {
+        if (expr->is_slot_ref()) {
+            int slot_id = static_cast<const VSlotRef*>(expr)->slot_id();
+            if (std::find(predicate_slot_ids.begin(), predicate_slot_ids.end(), slot_id) ==
+                predicate_slot_ids.end()) {
+                return false;
+            }
+            return _tuple_descriptor == nullptr || _slot_id_to_filter_conjuncts == nullptr ||
+                   !_can_filter_by_dict(slot_id);
+        }
+        return std::ranges::all_of(expr->children(), [&](const auto& child) {
+            return visit_slot(child.get());
+        });
+    };
+    return visit_slot(conjunct->root().get());
+}
+
+Status OrcReader::_skip_late_arrival_filtered_stripes(bool* eof) {
+    size_t stripe_num = _stripe_first_rows.size();
+    size_t stripe = 0;
+    if (_row_reader_started) {
+        // the stripe of the first row in the previous batch
+        uint64_t row = _row_reader->getRowNumber();
+        stripe = std::upper_bound(_stripe_first_rows.begin(), _stripe_first_rows.end(), row) -
+                 _stripe_first_rows.begin() - 1;
+    } else {
+        while (stripe < stripe_num && !_stripe_in_range[stripe]) {
+            ++stripe;
+        }
+    }
+    if (stripe >= stripe_num || _late_arrival_stripes_needed[stripe]) {
+        return Status::OK();
+    }
+
+    size_t next_stripe = stripe + 1;
+    int64_t skipped_stripes = 1;
+    while (next_stripe < stripe_num &&
+           (!_stripe_in_range[next_stripe] || !_late_arrival_stripes_needed[next_stripe])) {
+        skipped_stripes += _stripe_in_range[next_stripe];
+        ++next_stripe;
+    }
+    _statistics.runtime_filtered_stripes += skipped_stripes;
+    if (next_stripe == stripe_num) {
+        *eof = true;
+        return Status::OK();
+    }
+    try {
+        _row_reader->seekToRow(_stripe_first_rows[next_stripe]);
+    } catch (std::exception& e) {
+        return Status::InternalError("Orc row reader seek to stripe {} failed: {}, {}",
+                                     next_stripe, e.what(), _scan_range.path);
+    }
+    return Status::OK();
+}
+
 Status OrcReader::set_fill_columns(
         const std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>&
                 partition_columns,
@@ -1845,6 +1955,15 @@ Status OrcReader::get_next_block_impl(Block* block, size_t* read_rows, bool* eof
         return Status::OK();
     }
 
+    if (!_late_arrival_stripes_needed.empty()) {
+        RETURN_IF_ERROR(_skip_late_arrival_filtered_stripes(eof));
+        if (*eof) {
+            *read_rows = 0;
+            return Status::OK();
+        }
+    }
+    _row_reader_started = true;
+
     if (_lazy_read_ctx.can_lazy_read) {
         std::vector<uint32_t> columns_to_filter;
         int column_to_keep = block->columns();
@@ -2174,6 +2293,8 @@ Status OrcReader::filter(orc::ColumnVectorBatch& data, uint16_t* sel, uint16_t s
     for (auto& conjunct : _non_dict_filter_conjuncts) {
         filter_conjuncts.emplace_back(conjunct);
     }
+    filter_conjuncts.insert(filter_conjuncts.end(), _late_arrival_filter_conjuncts.begin(),
+                            _late_arrival_filter_conjuncts.end());
     std::vector<IColumn::Filter*> filters;
     if (_delete_rows_filter_ptr) {
         filters.push_back(_delete_rows_filter_ptr.get());
@@ -125,6 +125,7 @@ public:
         int64_t decode_value_time = 0;
         int64_t decode_null_map_time = 0;
         int64_t filter_block_time = 0;
+        int64_t runtime_filtered_stripes = 0;
     };
 
     OrcReader(RuntimeProfile* profile, RuntimeState* state, const TFileScanRangeParams& params,
@@ -164,6 +165,8 @@ public:
 
     Status get_next_block_impl(Block* block, size_t* read_rows, bool* eof);
 
+    Status append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) override;
+
     void _fill_batch_vec(std::vector<orc::ColumnVectorBatch*>& result,
                          orc::ColumnVectorBatch* batch, int idx);
 
@@ -185,7 +188,7 @@ public:
         _table_col_to_file_col = table_col_to_file_col;
     }
 
-    void set_position_delete_rowids(vector<int64_t>* delete_rows) {
+    void set_position_delete_rowids(const vector<int64_t>* delete_rows) {
         _position_delete_ordered_rowids = delete_rows;
     }
     void _execute_filter_position_delete_rowids(IColumn::Filter& filter);
@@ -225,6 +228,7 @@ private:
         RuntimeProfile::Counter* filter_block_time = nullptr;
         RuntimeProfile::Counter* selected_row_group_count = nullptr;
         RuntimeProfile::Counter* evaluated_row_group_count = nullptr;
+        RuntimeProfile::Counter* runtime_filtered_stripes = nullptr;
     };
 
     class ORCFilterImpl : public orc::ORCFilter {
@@ -308,6 +312,8 @@ private:
     bool _build_search_argument(const VExprSPtr& expr,
                                 std::unique_ptr<orc::SearchArgumentBuilder>& builder);
     bool _init_search_argument(const VExprContextSPtrs& conjuncts);
+    bool _is_late_arrival_lazy_predicate(const VExprContextSPtr& conjunct);
+    Status _skip_late_arrival_filtered_stripes(bool* eof);
 
     void _init_bloom_filter(
             std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
@@ -632,6 +638,16 @@ private:
     VExprContextSPtrs _dict_filter_conjuncts;
     VExprContextSPtrs _non_dict_filter_conjuncts;
     VExprContextSPtrs _filter_conjuncts;
+    // runtime filters arrived after the row reader was created, the ones that only reference
+    // non dict predicate columns are also evaluated by the lazy read filter
+    VExprContextSPtrs _late_arrival_conjuncts;
+    VExprContextSPtrs _late_arrival_filter_conjuncts;
+    // the stripes still needed by the search argument rebuilt with the late arrival conjuncts,
+    // empty if no late arrival conjunct could be pushed down
+    std::vector<bool> _late_arrival_stripes_needed;
+    std::vector<bool> _stripe_in_range;
+    std::vector<uint64_t> _stripe_first_rows;
+    bool _row_reader_started = false;
     // std::pair<col_name, slot_id>
     std::vector<std::pair<std::string, int>> _dict_filter_cols;
     std::shared_ptr<ObjectPool> _obj_pool;
@@ -646,7 +662,7 @@ private:
     // the two have the same effect.
     std::unordered_map<std::string, std::string> _table_col_to_file_col;
     //support iceberg position delete .
-    std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
+    const std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
     std::unordered_map<const VSlotRef*, orc::PredicateDataType>
             _vslot_ref_to_orc_predicate_data_type;
     std::unordered_map<const VLiteral*, orc::Literal> _vliteral_to_orc_literal;
@@ -81,12 +81,9 @@ Status ByteArrayDictDecoder::read_dict_values_to_column(MutableColumnPtr& doris_
 MutableColumnPtr ByteArrayDictDecoder::convert_dict_column_to_string_column(
         const ColumnInt32* dict_column) {
     auto res = ColumnString::create();
-    std::vector<StringRef> dict_values(dict_column->size());
-    const auto& data = dict_column->get_data();
-    for (size_t i = 0; i < dict_column->size(); ++i) {
-        dict_values[i] = _dict_items[data[i]];
-    }
-    res->insert_many_strings_overflow(dict_values.data(), dict_values.size(), _max_value_length);
+    // Gather the strings by codes directly, without building the intermediate StringRefs.
+    res->insert_many_dict_data(dict_column->get_data().data(), 0, _dict_items.data(),
+                               dict_column->size(), _dict_items.size());
     return res;
 }
 
@@ -123,12 +120,11 @@ Status ByteArrayDictDecoder::_decode_values(MutableColumnPtr& doris_column, Data
     while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
         switch (read_type) {
         case ColumnSelectVector::CONTENT: {
-            std::vector<StringRef> string_values;
-            string_values.reserve(run_length);
+            _string_values.resize(run_length);
             for (size_t i = 0; i < run_length; ++i) {
-                string_values.emplace_back(_dict_items[_indexes[dict_index++]]);
+                _string_values[i] = _dict_items[_indexes[dict_index++]];
             }
-            doris_column->insert_many_strings_overflow(string_values.data(), run_length,
+            doris_column->insert_many_strings_overflow(_string_values.data(), run_length,
                                                        _max_value_length);
             break;
         }
@@ -61,5 +61,7 @@ protected:
     std::vector<StringRef> _dict_items;
     std::vector<uint8_t> _dict_data;
     size_t _max_value_length;
+    // Reused across runs, the filtered batches are split into many small runs
+    std::vector<StringRef> _string_values;
 };
 } // namespace doris::vectorized
@@ -21,6 +21,7 @@
 #include <gen_cpp/parquet_types.h>
 
 #include <cstdint>
+#include <string>
 
 #include "common/logging.h"
 #include "io/fs/file_reader.h"
@@ -36,8 +37,21 @@ constexpr uint8_t PARQUET_VERSION_NUMBER[4] = {'P', 'A', 'R', '1'};
 constexpr uint32_t PARQUET_FOOTER_SIZE = 8;
 constexpr size_t INIT_META_SIZE = 48 * 1024; // 48k
 
+// metadata_size is set to the actual length of the deserialized FileMetaData
+static Status parse_thrift_footer_buffer(const uint8_t* meta_ptr, uint32_t* metadata_size,
+                                         FileMetaData** file_metadata) {
+    tparquet::FileMetaData t_metadata;
+    // deserialize footer
+    RETURN_IF_ERROR(deserialize_thrift_msg(meta_ptr, metadata_size, true, &t_metadata));
+    *file_metadata = new FileMetaData(t_metadata);
+    return (*file_metadata)->init_schema();
+}
+
+// If raw_metadata is not null, the serialized FileMetaData is copied into it, so that the
+// caller can persist it and parse it again by parse_thrift_footer_buffer.
 static Status parse_thrift_footer(io::FileReaderSPtr file, FileMetaData** file_metadata,
-                                  size_t* meta_size, io::IOContext* io_ctx) {
+                                  size_t* meta_size, io::IOContext* io_ctx,
+                                  std::string* raw_metadata = nullptr) {
     size_t file_size = file->size();
     size_t bytes_read = std::min(file_size, INIT_META_SIZE);
     std::vector<uint8_t> footer(bytes_read);
@@ -72,11 +86,10 @@ static Status parse_thrift_footer(io::FileReaderSPtr file, FileMetaData** file_m
         meta_ptr = footer.data() + bytes_read - PARQUET_FOOTER_SIZE - metadata_size;
     }
 
-    tparquet::FileMetaData t_metadata;
-    // deserialize footer
-    RETURN_IF_ERROR(deserialize_thrift_msg(meta_ptr, &metadata_size, true, &t_metadata));
-    *file_metadata = new FileMetaData(t_metadata);
-    RETURN_IF_ERROR((*file_metadata)->init_schema());
+    if (raw_metadata != nullptr) {
+        raw_metadata->assign((const char*)meta_ptr, metadata_size);
+    }
+    RETURN_IF_ERROR(parse_thrift_footer_buffer(meta_ptr, &metadata_size, file_metadata));
     *meta_size = PARQUET_FOOTER_SIZE + metadata_size;
     return Status::OK();
 }
@@ -23,11 +23,14 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <utility>
 
 #include "common/status.h"
+#include "exec/olap_utils.h"
 #include "exec/schema_scanner.h"
+#include "exprs/hybrid_set.h"
 #include "io/file_factory.h"
 #include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
@@ -52,6 +55,7 @@
 #include "vec/exprs/vbloom_predicate.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vin_predicate.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
 
@@ -123,6 +127,8 @@ void ParquetReader::_init_profile() {
 
         _parquet_profile.filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.runtime_filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "RuntimeFilteredGroups", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.to_read_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "ReadGroups", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_group_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -621,17 +627,50 @@ RowGroupReader::PositionDeleteContext ParquetReader::_get_position_delete_ctx(
                                                  row_group_index.first_row, start_index, end_index);
 }
 
+bool ParquetReader::_is_row_group_fully_deleted(
+        const RowGroupReader::RowGroupIndex& row_group_index) {
+    if (_delete_rows == nullptr) {
+        return false;
+    }
+    // The delete rows are sorted and distinct, so the row group is fully deleted
+    // if the number of delete rows in it equals to its number of rows.
+    auto start_pos = std::lower_bound(_delete_rows->begin() + _delete_rows_index,
+                                      _delete_rows->end(), row_group_index.first_row);
+    auto end_pos = std::lower_bound(start_pos, _delete_rows->end(), row_group_index.last_row);
+    return end_pos - start_pos == row_group_index.last_row - row_group_index.first_row;
+}
+
 Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
     }
-    if (_read_row_groups.empty()) {
-        _row_group_eof = true;
-        _current_group_reader.reset(nullptr);
-        return Status::EndOfFile("No next RowGroupReader");
+    RowGroupReader::RowGroupIndex row_group_index(-1, 0, 0);
+    while (true) {
+        if (_read_row_groups.empty()) {
+            _row_group_eof = true;
+            _current_group_reader.reset(nullptr);
+            return Status::EndOfFile("No next RowGroupReader");
+        }
+        row_group_index = _read_row_groups.front();
+        _read_row_groups.pop_front();
+        const tparquet::RowGroup& row_group = _t_metadata->row_groups[row_group_index.row_group_id];
+        bool filter_group = _is_row_group_fully_deleted(row_group_index);
+        if (!filter_group && !_has_late_arrival_range()) {
+            break;
+        }
+        // The value ranges are narrowed by late arrival runtime filters, check the row group again.
+        if (!filter_group) {
+            SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
+            RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, &filter_group));
+            if (!filter_group) {
+                break;
+            }
+            _statistics.runtime_filtered_row_groups++;
+        }
+        _statistics.filtered_row_groups++;
+        _statistics.read_row_groups--;
+        _statistics.filtered_group_rows += row_group.num_rows;
     }
-    RowGroupReader::RowGroupIndex row_group_index = _read_row_groups.front();
-    _read_row_groups.pop_front();
 
     // process page index and generate the ranges to read
     auto& row_group = _t_metadata->row_groups[row_group_index.row_group_id];
@@ -1005,6 +1044,113 @@ Status ParquetReader::_process_bloom_filter(bool* filter_group) {
     return Status::OK();
 }
 
+Status ParquetReader::append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) {
+    if (!_enable_filter_by_min_max || _colname_to_value_range == nullptr ||
+        _colname_to_slot_id == nullptr) {
+        return Status::OK();
+    }
+    for (const auto& conjunct : conjuncts) {
+        // Only the conjuncts of runtime filters have an impl.
+        auto impl = conjunct->root()->get_impl();
+        if (impl == nullptr) {
+            continue;
+        }
+        _late_arrival_conjuncts.emplace_back(conjunct);
+        RETURN_IF_ERROR(_append_runtime_filter_range(impl));
+    }
+    return Status::OK();
+}
+
+Status ParquetReader::_append_runtime_filter_range(const VExprSPtr& expr) {
+    // IN filter: slot in (set), MINMAX filter: slot >= min and slot <= max
+    int slot_child = -1;
+    if (expr->node_type() == TExprNodeType::IN_PRED) {
+        if (expr->get_set_func() != nullptr && expr->children()[0]->is_slot_ref()) {
+            slot_child = 0;
+        }
+    } else if (expr->node_type() == TExprNodeType::BINARY_PRED &&
+               expr->get_num_children() == 2) {
+        for (int i = 0; i < 2; ++i) {
+            if (expr->children()[i]->is_slot_ref() && expr->children()[1 - i]->is_literal()) {
+                slot_child = i;
+                break;
+            }
+        }
+    }
+    if (slot_child < 0) {
+        // BLOOM and BITMAP filters can not be converted to value ranges
+        return Status::OK();
+    }
+
+    int slot_id = static_cast<VSlotRef*>(expr->children()[slot_child].get())->slot_id();
+    std::string col_name;
+    for (const auto& [name, id] : *_colname_to_slot_id) {
+        if (id == slot_id) {
+            col_name = name;
+            break;
+        }
+    }
+    if (auto iter = _table_col_to_file_col.find(col_name); iter != _table_col_to_file_col.end()) {
+        col_name = iter->second;
+    }
+    if (!_has_late_arrival_range()) {
+        _late_arrival_value_range = *_colname_to_value_range;
+        _colname_to_value_range = &_late_arrival_value_range;
+    }
+    auto range_iter = _colname_to_value_range->find(col_name);
+    if (range_iter == _colname_to_value_range->end()) {
+        return Status::OK();
+    }
+    return std::visit(
+            [&](auto& range) { return _intersect_runtime_filter_range(expr, slot_child, range); },
+            range_iter->second);
+}
+
+template <PrimitiveType T>
+Status ParquetReader::_intersect_runtime_filter_range(const VExprSPtr& expr, int slot_child,
+                                                      ColumnValueRange<T>& range) {
+    using CppType = typename PrimitiveTypeTraits<T>::CppType;
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_HLL) {
+        // The values of v1 date types need to be converted, leave them to the row filter.
+        return Status::OK();
+    } else if (expr->node_type() == TExprNodeType::IN_PRED) {
+        auto hybrid_set = expr->get_set_func();
+        if (hybrid_set->contain_null()) {
+            return Status::OK();
+        }
+        auto temp_range = ColumnValueRange<T>::create_empty_column_value_range(
+                range.column_name(), range.is_nullable_col(), range.precision(), range.scale());
+        auto* iter = hybrid_set->begin();
+        while (iter->has_next()) {
+            if (iter->get_value() != nullptr) {
+                RETURN_IF_ERROR(temp_range.add_fixed_value(
+                        *reinterpret_cast<const CppType*>(iter->get_value())));
+            }
+            iter->next();
+        }
+        range.intersection(temp_range);
+    } else {
+        StringRef value = static_cast<VLiteral*>(expr->children()[1 - slot_child].get())
+                                  ->get_column_ptr()
+                                  ->get_data_at(0);
+        if (value.data == nullptr) {
+            return Status::OK();
+        }
+        SQLFilterOp op = to_olap_filter_type(expr->op(), slot_child == 1);
+        if constexpr (is_string_type(T)) {
+            RETURN_IF_ERROR(range.add_range(op, value));
+        } else {
+            if (value.size != sizeof(CppType)) {
+                return Status::OK();
+            }
+            CppType typed_value;
+            memcpy(&typed_value, value.data, sizeof(CppType));
+            RETURN_IF_ERROR(range.add_range(op, typed_value));
+        }
+    }
+    return Status::OK();
+}
+
 int64_t ParquetReader::_get_column_start_offset(const tparquet::ColumnMetaData& column) {
     return has_dict_page(column) ? column.dictionary_page_offset : column.data_page_offset;
 }
@@ -1018,6 +1164,8 @@ void ParquetReader::_collect_profile() {
         _current_group_reader->collect_profile_before_close();
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.runtime_filtered_row_groups,
+                   _statistics.runtime_filtered_row_groups);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
@@ -75,6 +75,7 @@ class ParquetReader : public GenericReader {
 public:
     struct Statistics {
         int32_t filtered_row_groups = 0;
+        int32_t runtime_filtered_row_groups = 0;
         int32_t read_row_groups = 0;
         int64_t filtered_group_rows = 0;
         int64_t filtered_page_rows = 0;
@@ -148,6 +149,10 @@ public:
                     partition_columns,
             const std::unordered_map<std::string, VExprContextSPtr>& missing_columns) override;
 
+    // Narrow the value ranges by the runtime filters arrived after init_reader(),
+    // the row groups and pages which are not read yet will be re-checked by them.
+    Status append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) override;
+
     const FieldDescriptor get_file_metadata_schema();
     void set_table_to_file_col_map(std::unordered_map<std::string, std::string>& map) {
         _table_col_to_file_col = map;
@@ -159,6 +164,7 @@ protected:
 private:
     struct ParquetProfile {
         RuntimeProfile::Counter* filtered_row_groups = nullptr;
+        RuntimeProfile::Counter* runtime_filtered_row_groups = nullptr;
         RuntimeProfile::Counter* to_read_row_groups = nullptr;
         RuntimeProfile::Counter* filtered_group_rows = nullptr;
         RuntimeProfile::Counter* filtered_page_rows = nullptr;
@@ -196,6 +202,7 @@ private:
     void _init_profile();
     void _close_internal();
     Status _next_row_group_reader();
+    bool _is_row_group_fully_deleted(const RowGroupReader::RowGroupIndex& row_group_index);
     RowGroupReader::PositionDeleteContext _get_position_delete_ctx(
             const tparquet::RowGroup& row_group,
             const RowGroupReader::RowGroupIndex& row_group_index);
@@ -216,6 +223,14 @@ private:
     Status _process_dict_filter(bool* filter_group);
     void _init_bloom_filter();
     Status _process_bloom_filter(bool* filter_group);
+    // Late arrival runtime filter
+    Status _append_runtime_filter_range(const VExprSPtr& expr);
+    template <PrimitiveType T>
+    Status _intersect_runtime_filter_range(const VExprSPtr& expr, int slot_child,
+                                           ColumnValueRange<T>& range);
+    bool _has_late_arrival_range() const {
+        return _colname_to_value_range == &_late_arrival_value_range;
+    }
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
@@ -251,6 +266,11 @@ private:
     // table column name to file column name map. For iceberg schema evolution.
     std::unordered_map<std::string, std::string> _table_col_to_file_col;
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // Copy of the scanner's value ranges narrowed by late arrival runtime filters.
+    // _colname_to_value_range points to it once any runtime filter is appended.
+    std::unordered_map<std::string, ColumnValueRangeType> _late_arrival_value_range;
+    // Hold the runtime filters, the fixed values of string ranges refer to their memory.
+    VExprContextSPtrs _late_arrival_conjuncts;
     std::vector<std::string> _read_columns;
     RowRange _whole_range = RowRange(0, 0);
     const std::vector<int64_t>* _delete_rows = nullptr;
@@ -17,6 +17,8 @@
 
 #include "vec/exec/format/table/equality_delete.h"
 
+#include <limits>
+
 namespace doris::vectorized {
 
 std::unique_ptr<EqualityDeleteBase> EqualityDeleteBase::get_delete_impl(Block* delete_block) {
@@ -52,57 +54,67 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
         return Status::InternalError("Not support type change in column '{}'", _delete_column_name);
     }
     size_t rows = data_block->rows();
-    // _filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 0);
-    } else {
-        _filter->resize_fill(rows, 0);
-    }
+    // filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
+    IColumn::Filter filter(rows, 0);
 
-    if (column_and_type->column->is_nullable()) {
-        const NullMap& null_map =
-                reinterpret_cast<const ColumnNullable*>(column_and_type->column.get())
-                        ->get_null_map_data();
-        _hybrid_set->find_batch_nullable(
-                remove_nullable(column_and_type->column)->assume_mutable_ref(), rows, null_map,
-                *_filter.get());
-        if (_hybrid_set->contain_null()) {
-            auto* filter_data = _filter->data();
-            for (size_t i = 0; i < rows; ++i) {
-                filter_data[i] = filter_data[i] || null_map[i];
+    {
+        SCOPED_TIMER(probe_time);
+        if (column_and_type->column->is_nullable()) {
+            const NullMap& null_map =
+                    reinterpret_cast<const ColumnNullable*>(column_and_type->column.get())
+                            ->get_null_map_data();
+            _hybrid_set->find_batch_nullable(
+                    remove_nullable(column_and_type->column)->assume_mutable_ref(), rows,
+                    null_map, filter);
+            if (_hybrid_set->contain_null()) {
+                auto* filter_data = filter.data();
+                for (size_t i = 0; i < rows; ++i) {
+                    filter_data[i] = filter_data[i] || null_map[i];
+                }
             }
+        } else {
+            _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows, filter);
         }
-    } else {
-        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows,
-                                *_filter.get());
     }
-    // should reverse _filter
-    auto* filter_data = _filter->data();
+    // should reverse filter
+    auto* filter_data = filter.data();
     for (size_t i = 0; i < rows; ++i) {
         filter_data[i] = !filter_data[i];
     }
 
-    Block::filter_block_internal(data_block, *_filter.get(), data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
 Status MultiEqualityDelete::_build_set() {
     COUNTER_UPDATE(num_delete_rows, _delete_block->rows());
     size_t rows = _delete_block->rows();
+    if (rows >= std::numeric_limits<uint32_t>::max()) {
+        return Status::InternalError("Too many equality delete rows: {}", rows);
+    }
     _delete_hashes.clear();
     _delete_hashes.resize(rows, 0);
     for (ColumnPtr column : _delete_block->get_columns()) {
         column->update_hashes_with_value(_delete_hashes.data(), nullptr);
     }
+    size_t bucket_size = 1;
+    while (bucket_size < rows) {
+        bucket_size <<= 1;
+    }
+    _bucket_mask = bucket_size - 1;
+    _first.assign(bucket_size, 0);
+    _next.assign(rows + 1, 0);
     for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+        uint64_t bucket = _delete_hashes[i] & _bucket_mask;
+        _next[i + 1] = _first[bucket];
+        _first[bucket] = static_cast<uint32_t>(i + 1);
     }
-    _data_column_index.resize(_delete_block->columns());
     return Status::OK();
 }
 
 Status MultiEqualityDelete::filter_data_block(Block* data_block) {
     SCOPED_TIMER(equality_delete_time);
+    std::vector<size_t> data_column_index(_delete_block->columns());
     size_t column_index = 0;
     for (string column_name : _delete_block->get_names()) {
         auto* column_and_type = data_block->try_get_by_name(column_name);
@@ -113,41 +125,40 @@ Status MultiEqualityDelete::filter_data_block(Block* data_block) {
         if (!_delete_block->get_by_name(column_name).type->equals(*column_and_type->type)) {
             return Status::InternalError("Not support type change in column '{}'", column_name);
         }
-        _data_column_index[column_index++] = data_block->get_position_by_name(column_name);
+        data_column_index[column_index++] = data_block->get_position_by_name(column_name);
     }
     size_t rows = data_block->rows();
-    _data_hashes.clear();
-    _data_hashes.resize(rows, 0);
-    for (size_t index : _data_column_index) {
-        data_block->get_by_position(index).column->update_hashes_with_value(_data_hashes.data(),
+    std::vector<uint64_t> data_hashes(rows, 0);
+    for (size_t index : data_column_index) {
+        data_block->get_by_position(index).column->update_hashes_with_value(data_hashes.data(),
                                                                             nullptr);
     }
 
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 1);
-    } else {
-        _filter->resize_fill(rows, 1);
-    }
-    auto* filter_data = _filter->data();
-    for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
-                filter_data[i] = 0;
-                break;
+    IColumn::Filter filter(rows, 1);
+    auto* filter_data = filter.data();
+    {
+        SCOPED_TIMER(probe_time);
+        for (size_t i = 0; i < rows; ++i) {
+            const uint64_t hash = data_hashes[i];
+            for (uint32_t delete_row = _first[hash & _bucket_mask]; delete_row != 0;
+                 delete_row = _next[delete_row]) {
+                if (_delete_hashes[delete_row - 1] == hash &&
+                    _equal(data_block, data_column_index, i, delete_row - 1)) {
+                    filter_data[i] = 0;
+                    break;
+                }
             }
         }
     }
 
-    Block::filter_block_internal(data_block, *_filter.get(), data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
-bool MultiEqualityDelete::_equal(Block* data_block, size_t data_row_index,
-                                 size_t delete_row_index) {
+bool MultiEqualityDelete::_equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                                 size_t data_row_index, size_t delete_row_index) {
     for (size_t i = 0; i < _delete_block->columns(); ++i) {
-        ColumnPtr data_col = data_block->get_by_position(_data_column_index[i]).column;
+        ColumnPtr data_col = data_block->get_by_position(data_column_index[i]).column;
         ColumnPtr delete_col = _delete_block->get_by_position(i).column;
         if (data_col->compare_at(data_row_index, delete_row_index, delete_col->assume_mutable_ref(),
                                  -1) != 0) {
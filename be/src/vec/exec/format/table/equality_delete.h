@@ -28,12 +28,16 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ *
+ * The delete set is built once and then only read, `filter_data_block` can be called by
+ * the scanners of the data files sharing the same delete files concurrently.
  */
 class EqualityDeleteBase {
 protected:
     RuntimeProfile::Counter* num_delete_rows;
     RuntimeProfile::Counter* build_set_time;
     RuntimeProfile::Counter* equality_delete_time;
+    RuntimeProfile::Counter* probe_time;
 
     Block* _delete_block;
 
@@ -51,6 +55,7 @@ public:
         build_set_time = ADD_CHILD_TIMER_WITH_LEVEL(profile, "BuildHashSetTime", delete_profile, 1);
         equality_delete_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(profile, "EqualityDeleteFilterTime", delete_profile, 1);
+        probe_time = ADD_CHILD_TIMER_WITH_LEVEL(profile, "ProbeTime", delete_profile, 1);
         SCOPED_TIMER(build_set_time);
         return _build_set();
     }
@@ -65,7 +70,6 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
@@ -77,24 +81,23 @@ public:
 
 /**
  * `MultiEqualityDelete` will generate the hash column for delete block and data block.
+ * The delete rows are chained by the buckets of their hash values like the hash table of
+ * join, the real values are only compared when the hash values are the same.
  */
 class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
     // hash column for delete block
     std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
-    // hash code => row index
-    // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
+    // bucket => the first delete row + 1 in the bucket, 0 means empty
+    std::vector<uint32_t> _first;
+    // delete row + 1 => the next delete row + 1 in the same bucket
+    std::vector<uint32_t> _next;
+    uint64_t _bucket_mask = 0;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    bool _equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index);
 
 public:
     MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
@@ -37,6 +37,7 @@
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/bitmap_value.h"
 #include "util/string_util.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -198,9 +199,54 @@ Status IcebergTableReader::init_row_filters(const TFileRangeDesc& range, io::IOC
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    // The splits and data files having the same equality delete files share the delete set,
+    // which is only read and built by the first of them.
+    std::vector<std::string> delete_paths;
+    for (auto& delete_file : delete_files) {
+        delete_paths.emplace_back(delete_file.path);
+    }
+    std::sort(delete_paths.begin(), delete_paths.end());
+    std::string cache_key = "equality_delete";
+    for (auto& path : delete_paths) {
+        cache_key.append("_").append(path);
+    }
+    Status create_status = Status::OK();
+    auto* equality_delete = _kv_cache->get<EqualityDelete>(cache_key, [&]() -> EqualityDelete* {
+        auto delete_set = std::make_unique<EqualityDelete>();
+        create_status = _read_equality_delete_files(delete_files, delete_set.get());
+        if (!create_status) {
+            return nullptr;
+        }
+        return delete_set.release();
+    });
+    RETURN_IF_ERROR(create_status);
+
+    const auto& equality_delete_col_names = equality_delete->col_names;
+    const auto& equality_delete_col_types = equality_delete->col_types;
+    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
+        const std::string& delete_col = equality_delete_col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = DataTypeFactory::instance().create_data_type(
+                    equality_delete_col_types[i], true);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(
+                    ColumnWithTypeAndName(std::move(data_column), data_type, delete_col));
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    _equality_delete_impl = equality_delete->impl.get();
+    return Status::OK();
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDelete* equality_delete) {
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<TypeDescriptor> equality_delete_col_types;
+    std::vector<std::string>& equality_delete_col_names = equality_delete->col_names;
+    std::vector<TypeDescriptor>& equality_delete_col_types = equality_delete->col_types;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -218,8 +264,8 @@ Status IcebergTableReader::_equality_delete_base(
         if (!init_schema) {
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
-                                            equality_delete_col_types);
+            _generate_equality_delete_block(&equality_delete->delete_block,
+                                            equality_delete_col_names, equality_delete_col_types);
             init_schema = true;
         }
         if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
@@ -244,28 +290,13 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&equality_delete->delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = DataTypeFactory::instance().create_data_type(
-                    equality_delete_col_types[i], true);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(
-                    ColumnWithTypeAndName(std::move(data_column), data_type, delete_col));
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    equality_delete->impl = EqualityDeleteBase::get_delete_impl(&equality_delete->delete_block);
+    return equality_delete->impl->init(_profile);
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -300,57 +331,70 @@ Status IcebergTableReader::_shrink_block_if_need(Block* block) {
 
 Status IcebergTableReader::_position_delete_base(
         const std::string data_file_path, const std::vector<TIcebergDeleteFileDesc>& delete_files) {
-    std::vector<DeleteRows*> delete_rows_array;
-    int64_t num_delete_rows = 0;
-    std::vector<DeleteFile*> erase_data;
-    for (auto& delete_file : delete_files) {
-        SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
-        Status create_status = Status::OK();
-        auto* delete_file_cache = _kv_cache->get<DeleteFile>(
-                _delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
-                    auto* position_delete = new DeleteFile;
-                    TFileRangeDesc delete_file_range;
-                    // must use __set() method to make sure __isset is true
-                    delete_file_range.__set_fs_name(_range.fs_name);
-                    delete_file_range.path = delete_file.path;
-                    delete_file_range.start_offset = 0;
-                    delete_file_range.size = -1;
-                    delete_file_range.file_size = -1;
-                    //read position delete file base on delete_file_range , generate DeleteFile , add DeleteFile to kv_cache
-                    create_status = _read_position_delete_file(&delete_file_range, position_delete);
-
-                    if (!create_status) {
-                        return nullptr;
-                    }
-
-                    return position_delete;
-                });
-        if (create_status.is<ErrorCode::END_OF_FILE>()) {
-            continue;
-        } else if (!create_status.ok()) {
-            return create_status;
-        }
-
-        DeleteFile& delete_file_map = *((DeleteFile*)delete_file_cache);
-        auto get_value = [&](const auto& v) {
-            DeleteRows* row_ids = v.second.get();
-            if (row_ids->size() > 0) {
-                delete_rows_array.emplace_back(row_ids);
-                num_delete_rows += row_ids->size();
-                erase_data.emplace_back(delete_file_cache);
+    // The delete rows of a data file are merged once and shared by all the splits of the file.
+    const std::string merged_key = _merged_delete_rows_cache_key(data_file_path);
+    auto* merged_delete_rows =
+            _kv_cache->get<DeleteRows>(merged_key, []() -> DeleteRows* { return nullptr; });
+    if (merged_delete_rows == nullptr) {
+        std::vector<DeleteRows*> delete_rows_array;
+        std::vector<DeleteFile*> erase_data;
+        for (auto& delete_file : delete_files) {
+            SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+            Status create_status = Status::OK();
+            auto* delete_file_cache = _kv_cache->get<DeleteFile>(
+                    _delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
+                        auto* position_delete = new DeleteFile;
+                        TFileRangeDesc delete_file_range;
+                        // must use __set() method to make sure __isset is true
+                        delete_file_range.__set_fs_name(_range.fs_name);
+                        delete_file_range.path = delete_file.path;
+                        delete_file_range.start_offset = 0;
+                        delete_file_range.size = -1;
+                        delete_file_range.file_size = -1;
+                        //read position delete file base on delete_file_range , generate DeleteFile , add DeleteFile to kv_cache
+                        create_status =
+                                _read_position_delete_file(&delete_file_range, position_delete);
+
+                        if (!create_status) {
+                            return nullptr;
+                        }
+
+                        return position_delete;
+                    });
+            if (create_status.is<ErrorCode::END_OF_FILE>()) {
+                continue;
+            } else if (!create_status.ok()) {
+                return create_status;
             }
-        };
-        delete_file_map.if_contains(data_file_path, get_value);
+
+            DeleteFile& delete_file_map = *((DeleteFile*)delete_file_cache);
+            auto get_value = [&](const auto& v) {
+                DeleteRows* row_ids = v.second.get();
+                if (row_ids->size() > 0) {
+                    delete_rows_array.emplace_back(row_ids);
+                    erase_data.emplace_back(delete_file_cache);
+                }
+            };
+            delete_file_map.if_contains(data_file_path, get_value);
+        }
+        auto merged = std::make_unique<DeleteRows>();
+        {
+            SCOPED_TIMER(_iceberg_profile.delete_rows_sort_time);
+            _merge_delete_rows(delete_rows_array, merged.get());
+        }
+        // Publish the merged rows before erasing the per delete file rows, a concurrent split
+        // which misses some erased rows will always get the published ones.
+        merged_delete_rows = _kv_cache->get<DeleteRows>(
+                merged_key, [&]() -> DeleteRows* { return merged.release(); });
+        // the deleted rows are merged out, we can erase them.
+        for (auto& erase_item : erase_data) {
+            erase_item->erase(data_file_path);
+        }
     }
-    if (num_delete_rows > 0) {
-        SCOPED_TIMER(_iceberg_profile.delete_rows_sort_time);
-        _sort_delete_rows(delete_rows_array, num_delete_rows);
+    if (!merged_delete_rows->empty()) {
+        _iceberg_delete_rows = merged_delete_rows;
         this->set_delete_rows();
-        COUNTER_UPDATE(_iceberg_profile.num_delete_rows, num_delete_rows);
-    }
-    // the deleted rows are copy out, we can erase them.
-    for (auto& erase_item : erase_data) {
-        erase_item->erase(data_file_path);
+        COUNTER_UPDATE(_iceberg_profile.num_delete_rows, merged_delete_rows->size());
     }
     return Status::OK();
 }
@@ -397,51 +441,24 @@ IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
     return range;
 }
 
-void IcebergTableReader::_sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                                           int64_t num_delete_rows) {
+void IcebergTableReader::_merge_delete_rows(const std::vector<DeleteRows*>& delete_rows_array,
+                                            DeleteRows* merged_delete_rows) {
     if (delete_rows_array.empty()) {
         return;
     }
     if (delete_rows_array.size() == 1) {
-        _iceberg_delete_rows.resize(num_delete_rows);
-        memcpy(&_iceberg_delete_rows[0], &((*delete_rows_array.front())[0]),
-               sizeof(int64_t) * num_delete_rows);
+        // The positions in a single delete file are already sorted and distinct.
+        *merged_delete_rows = *delete_rows_array.front();
         return;
     }
-    if (delete_rows_array.size() == 2) {
-        _iceberg_delete_rows.resize(num_delete_rows);
-        std::merge(delete_rows_array.front()->begin(), delete_rows_array.front()->end(),
-                   delete_rows_array.back()->begin(), delete_rows_array.back()->end(),
-                   _iceberg_delete_rows.begin());
-        return;
+    // The delete files may overlap, union them in a bitmap to get the sorted distinct positions.
+    detail::Roaring64Map bitmap;
+    for (const auto* rows : delete_rows_array) {
+        bitmap.addMany(rows->size(), reinterpret_cast<const uint64_t*>(rows->data()));
     }
-
-    using vec_pair = std::pair<std::vector<int64_t>::iterator, std::vector<int64_t>::iterator>;
-    _iceberg_delete_rows.resize(num_delete_rows);
-    auto row_id_iter = _iceberg_delete_rows.begin();
-    auto iter_end = _iceberg_delete_rows.end();
-    std::vector<vec_pair> rows_array;
-    for (auto rows : delete_rows_array) {
-        if (rows->size() > 0) {
-            rows_array.push_back({rows->begin(), rows->end()});
-        }
-    }
-    int array_size = rows_array.size();
-    while (row_id_iter != iter_end) {
-        int min_index = 0;
-        int min = *rows_array[0].first;
-        for (int i = 0; i < array_size; ++i) {
-            if (*rows_array[i].first < min) {
-                min_index = i;
-                min = *rows_array[i].first;
-            }
-        }
-        *row_id_iter++ = min;
-        rows_array[min_index].first++;
-        if (UNLIKELY(rows_array[min_index].first == rows_array[min_index].second)) {
-            rows_array.erase(rows_array.begin() + min_index);
-            array_size--;
-        }
+    merged_delete_rows->reserve(bitmap.cardinality());
+    for (auto it = bitmap.begin(); it != bitmap.end(); ++it) {
+        merged_delete_rows->emplace_back(static_cast<int64_t>(*it));
     }
 }
 
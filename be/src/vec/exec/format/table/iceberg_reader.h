@@ -111,8 +111,8 @@ protected:
      * Sorting by file_path allows filter pushdown by file in columnar storage formats.
      * Sorting by position allows filtering rows while scanning, to avoid keeping deletes in memory.
      */
-    void _sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                           int64_t num_delete_rows);
+    void _merge_delete_rows(const std::vector<DeleteRows*>& delete_rows_array,
+                            DeleteRows* merged_delete_rows);
 
     PositionDeleteRange _get_range(const ColumnDictI32& file_path_column);
 
@@ -122,6 +122,9 @@ protected:
 
     void _gen_new_colname_to_value_range();
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
+    static std::string _merged_delete_rows_cache_key(const std::string& data_file_path) {
+        return "merged_delete_" + data_file_path;
+    }
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
@@ -143,7 +146,8 @@ protected:
     // owned by scan node
     ShardedKVCache* _kv_cache;
     IcebergProfile _iceberg_profile;
-    std::vector<int64_t> _iceberg_delete_rows;
+    // sorted distinct positions deleted from the data file, owned by _kv_cache
+    const DeleteRows* _iceberg_delete_rows = nullptr;
     // col names from _file_slot_descs
     std::vector<std::string> _file_col_names;
     // file column name to table column name map. For iceberg schema evolution.
@@ -188,8 +192,16 @@ protected:
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
     // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    struct EqualityDelete {
+        std::vector<std::string> col_names;
+        std::vector<TypeDescriptor> col_types;
+        Block delete_block;
+        std::unique_ptr<EqualityDeleteBase> impl;
+    };
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       EqualityDelete* equality_delete);
+    // owned by _kv_cache
+    EqualityDeleteBase* _equality_delete_impl = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
@@ -217,7 +229,7 @@ public:
 
     void set_delete_rows() override {
         auto* parquet_reader = (ParquetReader*)(_file_format_reader.get());
-        parquet_reader->set_delete_rows(&_iceberg_delete_rows);
+        parquet_reader->set_delete_rows(_iceberg_delete_rows);
     }
 
     Status _gen_col_name_maps(const FieldDescriptor& field_desc);
@@ -245,7 +257,7 @@ public:
 
     void set_delete_rows() override {
         auto* orc_reader = (OrcReader*)_file_format_reader.get();
-        orc_reader->set_position_delete_rowids(&_iceberg_delete_rows);
+        orc_reader->set_position_delete_rowids(_iceberg_delete_rows);
     }
 
     Status init_reader(
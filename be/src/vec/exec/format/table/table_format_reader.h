@@ -64,6 +64,10 @@ public:
 
     bool fill_all_columns() const override { return _file_format_reader->fill_all_columns(); }
 
+    Status append_late_arrival_conjuncts(const VExprContextSPtrs& conjuncts) override {
+        return _file_format_reader->append_late_arrival_conjuncts(conjuncts);
+    }
+
     virtual Status init_row_filters(const TFileRangeDesc& range, io::IOContext* io_ctx) = 0;
 
 protected:
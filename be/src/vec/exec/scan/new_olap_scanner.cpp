@@ -604,6 +604,7 @@ void NewOlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_stats_rp_filtered_counter, stats.rows_stats_rp_filtered);
     COUNTER_UPDATE(local_state->_dict_filtered_counter, stats.rows_dict_filtered);
     COUNTER_UPDATE(local_state->_bf_filtered_counter, stats.rows_bf_filtered);
+    COUNTER_UPDATE(local_state->_bf_filtered_pages_counter, stats.pages_bf_filtered);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_del_filtered);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_del_by_bitmap);
     COUNTER_UPDATE(local_state->_del_filtered_counter, stats.rows_vec_del_cond_filtered);
@@ -611,6 +612,9 @@ void NewOlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_key_range_filtered_counter, stats.rows_key_range_filtered);
     COUNTER_UPDATE(local_state->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(local_state->_cached_pages_num_counter, stats.cached_pages_num);
+    COUNTER_UPDATE(local_state->_compressed_cached_pages_num_counter,
+                   stats.compressed_cached_pages_num);
+    COUNTER_UPDATE(local_state->_read_ahead_pages_num_counter, stats.read_ahead_pages_num);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_counter, stats.rows_bitmap_index_filtered);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_timer, stats.bitmap_index_filter_timer);
     COUNTER_UPDATE(local_state->_inverted_index_filter_counter, stats.rows_inverted_index_filtered);
@@ -638,6 +642,10 @@ void NewOlapScanner::_collect_profile_before_close() {
         io::FileCacheProfileReporter cache_profile(local_state->_segment_profile.get());
         cache_profile.update(&stats.file_cache_stats);
     }
+    io::report_io_tier(local_state->_segment_profile.get(), "PageCache", stats.page_cache_io,
+                       DorisMetrics::instance()->io_page_cache_reads_total,
+                       DorisMetrics::instance()->io_page_cache_bytes_total,
+                       DorisMetrics::instance()->io_page_cache_latency_us_total);
     COUNTER_UPDATE(local_state->_output_index_result_column_timer,
                    stats.output_index_result_column_timer);
     COUNTER_UPDATE(local_state->_filtered_segment_counter, stats.filtered_segment_number);
@@ -692,6 +700,7 @@ void NewOlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(local_state->_read_compressed_counter->value());
     tablet->query_scan_rows->increment(local_state->_scan_rows->value());
     tablet->query_scan_count->increment(1);
+    tablet->update_query_read_heat(stats.total_segment_number);
     if (_query_statistics) {
         _query_statistics->add_scan_bytes_from_local_storage(
                 stats.file_cache_stats.bytes_read_from_local);
@@ -33,6 +33,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/scanner_scheduler.h"
@@ -77,16 +78,28 @@ ScannerContext::ScannerContext(
     _query_thread_context = {_query_id, _state->query_mem_tracker(),
                              _state->get_query_ctx()->workload_group()};
     _dependency = dependency;
+    _deadline_ms = MonotonicMillis() + static_cast<int64_t>(_state->execution_timeout()) * 1000;
 
     DorisMetrics::instance()->scanner_ctx_cnt->increment(1);
 }
 
+int ScannerContext::scan_priority_level() const {
+    static constexpr int MAX_LEVEL = 3;
+    int64_t scan_time_ms = _scan_time_ns / 1000000;
+    int level = 0;
+    for (int64_t bound = 10; level < MAX_LEVEL && scan_time_ms >= bound; bound *= 10) {
+        ++level;
+    }
+    return level;
+}
+
 // After init function call, should not access _parent
 Status ScannerContext::init() {
     _scanner_profile = _local_state->_scanner_profile;
     _scanner_sched_counter = _local_state->_scanner_sched_counter;
     _newly_create_free_blocks_num = _local_state->_newly_create_free_blocks_num;
     _scale_up_scanners_counter = _local_state->_scale_up_scanners_counter;
+    _scale_down_scanners_counter = _local_state->_scale_down_scanners_counter;
     _scanner_memory_used_counter = _local_state->_memory_used_counter;
 
 #ifndef BE_TEST
@@ -355,7 +368,7 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
                         }
                     }
                 }
-            } else {
+            } else if (!_try_to_scale_down(scan_task)) {
                 // resubmit current running scanner to read the next block
                 Status submit_status = submit_scan_task(scan_task);
                 if (!submit_status.ok()) {
@@ -435,6 +448,18 @@ Status ScannerContext::_try_to_scale_up() {
     return Status::OK();
 }
 
+bool ScannerContext::_try_to_scale_down(const std::shared_ptr<ScanTask>& scan_task) {
+    if (_num_running_scanners <= 1 || _block_memory_usage <= _max_bytes_in_queue) {
+        return false;
+    }
+    _scanners.enqueue(scan_task->scanner);
+    _num_running_scanners--;
+    _scale_down_scanners_counter->update(1);
+    // the next scale up starts from the reduced parallelism, do not judge it by the last one
+    _last_wait_duration_ratio = 0;
+    return true;
+}
+
 Status ScannerContext::validate_block_schema(Block* block) {
     size_t index = 0;
     for (auto& slot : _output_tuple_desc->slots()) {
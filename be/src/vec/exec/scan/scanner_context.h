@@ -157,6 +157,16 @@ public:
 
     int batch_size() const { return _batch_size; }
 
+    // The priority level of the scan tasks of this context in the scan thread pool, lower runs
+    // first. It grows with the time the scanners of the context have run: 0 for less than 10ms,
+    // 1 for 100ms, 2 for 1s and 3 for more, so small scans go ahead of large ones.
+    int scan_priority_level() const;
+
+    // The time, in MonotonicMillis, the query times out.
+    int64_t deadline_ms() const { return _deadline_ms; }
+
+    void update_scan_time(int64_t scan_time_ns) { _scan_time_ns += scan_time_ns; }
+
     // the unique id of this context
     std::string ctx_id;
     TUniqueId _query_id;
@@ -172,6 +182,11 @@ protected:
     /// 4. At most scale up `MAX_SCALE_UP_RATIO` times to `_max_thread_num`
     void _set_scanner_done();
     Status _try_to_scale_up();
+    /// The consumer is slower than the scanners if the blocks waiting in the queue exceed
+    /// `_max_bytes_in_queue`. A running scanner whose task is drained is then parked back to
+    /// `_scanners` instead of being resubmitted, as long as another scanner keeps running.
+    /// It is resumed when a running scanner finishes or by `_try_to_scale_up`.
+    bool _try_to_scale_down(const std::shared_ptr<ScanTask>& scan_task);
 
     RuntimeState* _state = nullptr;
     pipeline::ScanLocalStateBase* _local_state = nullptr;
@@ -210,6 +225,7 @@ protected:
     RuntimeProfile::Counter* _scanner_memory_used_counter = nullptr;
     RuntimeProfile::Counter* _newly_create_free_blocks_num = nullptr;
     RuntimeProfile::Counter* _scale_up_scanners_counter = nullptr;
+    RuntimeProfile::Counter* _scale_down_scanners_counter = nullptr;
     QueryThreadContext _query_thread_context;
     std::shared_ptr<pipeline::Dependency> _dependency = nullptr;
     bool _ignore_data_distribution = false;
@@ -220,6 +236,9 @@ protected:
     size_t _estimated_block_size = 0;
     std::atomic<int64_t> _block_memory_usage = 0;
     int64_t _last_scale_up_time = 0;
+    // the time the scanners of this context have run, see scan_priority_level()
+    std::atomic<int64_t> _scan_time_ns = 0;
+    int64_t _deadline_ms = 0;
     int64_t _last_fetch_time = 0;
     int64_t _total_wait_block_time = 0;
     double _last_wait_duration_ratio = 0;
@@ -46,6 +46,7 @@
 #include "util/runtime_profile.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
+#include "util/time.h"
 #include "util/work_thread_pool.hpp"
 #include "vec/core/block.h"
 #include "vec/exec/scan/new_olap_scanner.h" // IWYU pragma: keep
@@ -161,6 +162,8 @@ Status ScannerScheduler::submit(std::shared_ptr<ScannerContext> ctx,
                 }
             };
             SimplifiedScanTask simple_scan_task = {work_func, ctx};
+            simple_scan_task.priority_level = ctx->scan_priority_level();
+            simple_scan_task.deadline_ms = ctx->deadline_ms();
             return scan_sched->submit_scan_task(simple_scan_task);
         };
 
@@ -315,6 +318,7 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
     }
 
     scanner->update_scan_cpu_timer();
+    ctx->update_scan_time(max_run_time_watch.elapsed_time());
     if (eos) {
         scanner->mark_to_need_to_close();
     }
@@ -322,6 +326,45 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
     ctx->push_back_scan_task(scan_task);
 }
 
+Status SimplifiedScanScheduler::_submit_by_priority(SimplifiedScanTask scan_task) {
+    // every task in _pending_tasks has a runner in the thread pool, which runs the first one of
+    // _pending_tasks when it is picked by a worker, rather than the task it is submitted with.
+    std::lock_guard l(_pending_lock);
+    PendingTaskKey key {.priority_level = scan_task.priority_level,
+                        .deadline_ms = scan_task.deadline_ms,
+                        .seq = _next_pending_seq++};
+    _pending_tasks.emplace(key, PendingTask {std::move(scan_task), MonotonicMillis()});
+    _pending_task_keys.emplace(key.seq, key);
+    Status st = _scan_thread_pool->submit_func([this] { _run_pending_task(); });
+    if (!st.ok()) {
+        _pending_tasks.erase(key);
+        _pending_task_keys.erase(key.seq);
+    }
+    return st;
+}
+
+void SimplifiedScanScheduler::_run_pending_task() {
+    SimplifiedScanTask scan_task;
+    {
+        std::lock_guard l(_pending_lock);
+        DCHECK(!_pending_tasks.empty());
+        if (_pending_tasks.empty()) [[unlikely]] {
+            return;
+        }
+        auto it = _pending_tasks.begin();
+        // the oldest task runs first once it waits too long, large scans are not starved
+        auto oldest = _pending_tasks.find(_pending_task_keys.begin()->second);
+        if (MonotonicMillis() - oldest->second.submit_time_ms >=
+            config::scan_task_priority_max_wait_ms) {
+            it = oldest;
+        }
+        _pending_task_keys.erase(it->first.seq);
+        scan_task = std::move(it->second.task);
+        _pending_tasks.erase(it);
+    }
+    scan_task.scan_func();
+}
+
 int ScannerScheduler::get_remote_scan_thread_num() {
     int remote_max_thread_num = config::doris_max_remote_scanner_thread_pool_thread_num != -1
                                         ? config::doris_max_remote_scanner_thread_pool_thread_num
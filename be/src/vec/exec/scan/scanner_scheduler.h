@@ -19,8 +19,12 @@
 
 #include <atomic>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "util/doris_metrics.h"
 #include "util/threadpool.h"
@@ -110,6 +114,9 @@ struct SimplifiedScanTask {
 
     std::function<void()> scan_func;
     std::shared_ptr<vectorized::ScannerContext> scanner_context = nullptr;
+    // the order in the pool with enable_scan_task_priority_scheduling, see ScannerContext
+    int priority_level = 0;
+    int64_t deadline_ms = 0;
 };
 
 class SimplifiedScanScheduler {
@@ -144,6 +151,9 @@ public:
 
     Status submit_scan_task(SimplifiedScanTask scan_task) {
         if (!_is_stop) {
+            if (config::enable_scan_task_priority_scheduling) {
+                return _submit_by_priority(std::move(scan_task));
+            }
             return _scan_thread_pool->submit_func([scan_task] { scan_task.scan_func(); });
         } else {
             return Status::InternalError<false>("scanner pool {} is shutdown.", _sched_name);
@@ -210,7 +220,31 @@ public:
     std::vector<int> thread_debug_info() { return _scan_thread_pool->debug_info(); }
 
 private:
+    struct PendingTaskKey {
+        int priority_level;
+        int64_t deadline_ms;
+        uint64_t seq;
+        bool operator<(const PendingTaskKey& rhs) const {
+            return std::tie(priority_level, deadline_ms, seq) <
+                   std::tie(rhs.priority_level, rhs.deadline_ms, rhs.seq);
+        }
+    };
+
+    struct PendingTask {
+        SimplifiedScanTask task;
+        int64_t submit_time_ms;
+    };
+
+    Status _submit_by_priority(SimplifiedScanTask scan_task);
+
+    void _run_pending_task();
+
     std::unique_ptr<ThreadPool> _scan_thread_pool;
+    std::mutex _pending_lock;
+    // the tasks waiting for a worker by priority, and their keys by submission order
+    std::map<PendingTaskKey, PendingTask> _pending_tasks;
+    std::map<uint64_t, PendingTaskKey> _pending_task_keys;
+    uint64_t _next_pending_seq = 0;
     std::atomic<bool> _is_stop;
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
     std::string _sched_name;
@@ -17,6 +17,8 @@
 
 #include "vec/exec/scan/split_source_connector.h"
 
+#include <algorithm>
+
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 
@@ -24,6 +26,67 @@ namespace doris::vectorized {
 
 using apache::thrift::transport::TTransportException;
 
+void LocalSplitSourceConnector::_split_large_ranges(
+        const std::vector<TScanRangeParams>& scan_ranges,
+        std::vector<TScanRangeParams>& split_ranges) {
+    const int64_t split_bytes = config::file_scan_range_split_bytes;
+    if (split_bytes <= 0 || scan_ranges.size() >= _max_scanners) {
+        split_ranges = scan_ranges;
+        return;
+    }
+    auto is_splittable = [&](const TFileScanRange& file_scan_range, const TFileRangeDesc& range) {
+        TFileFormatType::type format_type;
+        if (range.__isset.format_type) {
+            format_type = range.format_type;
+        } else if (file_scan_range.__isset.params) {
+            format_type = file_scan_range.params.format_type;
+        } else {
+            return false;
+        }
+        if (format_type != TFileFormatType::FORMAT_PARQUET &&
+            format_type != TFileFormatType::FORMAT_ORC) {
+            return false;
+        }
+        // Position deletes of the other table formats are bound to the whole data file
+        if (range.__isset.table_format_params &&
+            range.table_format_params.table_format_type != "hive") {
+            return false;
+        }
+        return range.size >= 2 * split_bytes;
+    };
+
+    for (const auto& scan_range : scan_ranges) {
+        const auto& file_scan_range = scan_range.scan_range.ext_scan_range.file_scan_range;
+        TScanRangeParams remaining = scan_range;
+        auto& remaining_ranges = remaining.scan_range.ext_scan_range.file_scan_range.ranges;
+        remaining_ranges.clear();
+        for (const auto& range : file_scan_range.ranges) {
+            if (!is_splittable(file_scan_range, range)) {
+                remaining_ranges.emplace_back(range);
+                continue;
+            }
+            int64_t piece_size = std::max(split_bytes, (range.size + _max_scanners - 1) /
+                                                               static_cast<int64_t>(_max_scanners));
+            for (int64_t offset = 0; offset < range.size; offset += piece_size) {
+                TScanRangeParams piece = scan_range;
+                auto& piece_ranges = piece.scan_range.ext_scan_range.file_scan_range.ranges;
+                piece_ranges.clear();
+                TFileRangeDesc piece_range = range;
+                piece_range.__set_start_offset(range.start_offset + offset);
+                piece_range.__set_size(std::min(piece_size, range.size - offset));
+                piece_ranges.emplace_back(std::move(piece_range));
+                split_ranges.emplace_back(std::move(piece));
+            }
+        }
+        if (!remaining_ranges.empty()) {
+            split_ranges.emplace_back(std::move(remaining));
+        }
+    }
+    if (split_ranges.size() != scan_ranges.size()) {
+        LOG(INFO) << "Split " << scan_ranges.size() << " scan ranges to " << split_ranges.size();
+    }
+}
+
 Status LocalSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* range) {
     std::lock_guard<std::mutex> l(_range_lock);
     *has_next = false;
@@ -101,10 +101,18 @@ private:
     int _scan_index = 0;
     int _range_index = 0;
 
+    // When there are fewer ranges than scanners, split the huge parquet/orc ranges into byte
+    // ranges. The readers only read the row groups(stripes) whose middle falls in their range,
+    // and the footer is shared by FileMetaCache, so a huge file is read by several scanners.
+    void _split_large_ranges(const std::vector<TScanRangeParams>& scan_ranges,
+                             std::vector<TScanRangeParams>& split_ranges);
+
 public:
     LocalSplitSourceConnector(const std::vector<TScanRangeParams>& scan_ranges, int max_scanners) {
         _max_scanners = max_scanners;
-        _merge_ranges<TScanRangeParams>(_scan_ranges, scan_ranges);
+        std::vector<TScanRangeParams> split_ranges;
+        _split_large_ranges(scan_ranges, split_ranges);
+        _merge_ranges<TScanRangeParams>(_scan_ranges, split_ranges);
     }
 
     Status get_next(bool* has_next, TFileRangeDesc* range) override;
@@ -215,12 +215,27 @@ Status VFileScanner::_process_late_arrival_conjuncts() {
         RETURN_IF_ERROR(_process_conjuncts_for_dict_filter());
         _discard_conjuncts();
     }
+    _reader_conjunct_num = _push_down_conjuncts.size();
     if (_applied_rf_num == _total_rf_num) {
         _local_state->scanner_profile()->add_info_string("ApplyAllRuntimeFilters", "True");
     }
     return Status::OK();
 }
 
+Status VFileScanner::_push_late_arrival_conjuncts_to_reader() {
+    // The runtime filters are appended to the tail of _conjuncts when they arrive.
+    if (_conjuncts.size() <= _reader_conjunct_num) {
+        return Status::OK();
+    }
+    VExprContextSPtrs late_arrival_conjuncts(_conjuncts.size() - _reader_conjunct_num);
+    for (size_t i = 0; i != late_arrival_conjuncts.size(); ++i) {
+        RETURN_IF_ERROR(
+                _conjuncts[_reader_conjunct_num + i]->clone(_state, late_arrival_conjuncts[i]));
+    }
+    _reader_conjunct_num = _conjuncts.size();
+    return _cur_reader->append_late_arrival_conjuncts(late_arrival_conjuncts);
+}
+
 void VFileScanner::_get_slot_ids(VExpr* expr, std::vector<int>* slot_ids) {
     for (auto& child_expr : expr->children()) {
         if (child_expr->is_slot_ref()) {
@@ -299,6 +314,7 @@ Status VFileScanner::_get_block_wrapped(RuntimeState* state, Block* block, bool*
         // For query job, simply set _src_block_ptr to block.
         size_t read_rows = 0;
         RETURN_IF_ERROR(_init_src_block(block));
+        RETURN_IF_ERROR(_push_late_arrival_conjuncts_to_reader());
         {
             SCOPED_TIMER(_get_block_timer);
 
@@ -730,6 +746,34 @@ void VFileScanner::_truncate_char_or_varchar_column(Block* block, int idx, int l
     Block::erase_useless_column(block, num_columns_without_result);
 }
 
+Status VFileScanner::_try_read_hudi_base_file_natively(TFileRangeDesc& range) {
+    if (!config::enable_native_hudi_base_file_reader || !range.__isset.table_format_params ||
+        range.table_format_params.table_format_type != "hudi") {
+        return Status::OK();
+    }
+    TFileFormatType::type format_type =
+            range.__isset.format_type ? range.format_type : _params->format_type;
+    const auto& hudi_params = range.table_format_params.hudi_params;
+    if (format_type != TFileFormatType::FORMAT_JNI || !hudi_params.delta_logs.empty() ||
+        hudi_params.data_file_path.empty() || hudi_params.data_file_length <= 0) {
+        return Status::OK();
+    }
+    // Without delta logs, the records of the split are exactly the records of its base file.
+    const std::string& path = hudi_params.data_file_path;
+    if (path.ends_with(".parquet")) {
+        range.__set_format_type(TFileFormatType::FORMAT_PARQUET);
+    } else if (path.ends_with(".orc")) {
+        range.__set_format_type(TFileFormatType::FORMAT_ORC);
+    } else {
+        return Status::OK();
+    }
+    range.path = path;
+    range.__set_start_offset(0);
+    range.__set_size(hudi_params.data_file_length);
+    range.__set_file_size(hudi_params.data_file_length);
+    return Status::OK();
+}
+
 Status VFileScanner::_get_next_reader() {
     while (true) {
         if (_cur_reader) {
@@ -749,6 +793,7 @@ Status VFileScanner::_get_next_reader() {
             return Status::OK();
         }
 
+        RETURN_IF_ERROR(_try_read_hudi_base_file_natively(_current_range));
         const TFileRangeDesc& range = _current_range;
         _current_range_path = range.path;
 
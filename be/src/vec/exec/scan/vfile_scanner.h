@@ -163,6 +163,9 @@ protected:
     Block _src_block;
 
     VExprContextSPtrs _push_down_conjuncts;
+    // Number of the conjuncts the current reader has been told about,
+    // the ones after it are runtime filters arrived during reading the file.
+    size_t _reader_conjunct_num = 0;
 
     std::unique_ptr<io::FileCacheStatistics> _file_cache_statistics;
     std::unique_ptr<io::IOContext> _io_ctx;
@@ -216,6 +219,8 @@ private:
     Status _generate_fill_columns();
     Status _process_conjuncts_for_dict_filter();
     Status _process_late_arrival_conjuncts();
+    Status _push_late_arrival_conjuncts_to_reader();
+    Status _try_read_hudi_base_file_natively(TFileRangeDesc& range);
     void _get_slot_ids(VExpr* expr, std::vector<int>* slot_ids);
 
     void _reset_counter() {
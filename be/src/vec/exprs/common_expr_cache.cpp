@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/common_expr_cache.h"
+
+#include <string>
+#include <unordered_set>
+
+#include "vec/core/block.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+// Bounds the pairwise equals() calls when grouping very large expression lists.
+constexpr size_t MAX_CANDIDATES = 1024;
+
+bool is_non_deterministic(const std::string& function_name) {
+    static const std::unordered_set<std::string> names = {"rand", "random", "uuid",
+                                                          "uuid_numeric", "random_bytes"};
+    return names.contains(function_name);
+}
+
+void collect_candidates(const VExprSPtr& expr, std::vector<VExpr*>* candidates) {
+    if (candidates->size() >= MAX_CANDIDATES) {
+        return;
+    }
+    if (is_non_deterministic(expr->fn().name.function_name)) {
+        // a subtree below a non deterministic function is still shared
+        for (const auto& child : expr->children()) {
+            collect_candidates(child, candidates);
+        }
+        return;
+    }
+    // constants are evaluated once in open and slot refs are free already
+    if (dynamic_cast<const VectorizedFnCall*>(expr.get()) != nullptr && !expr->is_constant()) {
+        candidates->push_back(expr.get());
+    }
+    for (const auto& child : expr->children()) {
+        collect_candidates(child, candidates);
+    }
+}
+
+} // namespace
+
+std::shared_ptr<CommonExprCache> CommonExprCache::create(const VExprContextSPtrs& ctxs) {
+    std::vector<VExpr*> candidates;
+    for (const auto& ctx : ctxs) {
+        if (ctx->root() != nullptr) {
+            collect_candidates(ctx->root(), &candidates);
+        }
+    }
+
+    // every group is represented by its first member
+    std::vector<VExpr*> representatives;
+    std::vector<std::vector<const VExpr*>> members;
+    for (auto* candidate : candidates) {
+        size_t group = 0;
+        for (; group < representatives.size(); ++group) {
+            if (representatives[group]->equals(*candidate)) {
+                break;
+            }
+        }
+        if (group == representatives.size()) {
+            representatives.push_back(candidate);
+            members.emplace_back();
+        }
+        members[group].push_back(candidate);
+    }
+
+    auto cache = std::make_shared<CommonExprCache>();
+    for (const auto& group_members : members) {
+        if (group_members.size() < 2) {
+            continue;
+        }
+        for (const auto* member : group_members) {
+            cache->_groups.emplace(member, cache->_results.size());
+        }
+        cache->_results.emplace_back();
+    }
+    return cache->_results.empty() ? nullptr : cache;
+}
+
+void CommonExprCache::reset() {
+    for (auto& result : _results) {
+        result = Result {};
+    }
+}
+
+bool CommonExprCache::get(const VExpr* expr, const Block& block, int* column_id) {
+    auto it = _groups.find(expr);
+    if (it == _groups.end()) {
+        return false;
+    }
+    const auto& result = _results[it->second];
+    if (result.block != &block || result.rows != block.rows() ||
+        result.column_id >= static_cast<int>(block.columns()) || result.column_id < 0 ||
+        block.get_by_position(result.column_id).column.get() != result.column) {
+        return false;
+    }
+    *column_id = result.column_id;
+    ++_reused_count;
+    return true;
+}
+
+void CommonExprCache::put(const VExpr* expr, const Block& block, int column_id) {
+    auto it = _groups.find(expr);
+    if (it == _groups.end()) {
+        return;
+    }
+    _results[it->second] = {.block = &block,
+                            .column = block.get_by_position(column_id).column.get(),
+                            .rows = block.rows(),
+                            .column_id = column_id};
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
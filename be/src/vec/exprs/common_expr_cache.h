@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+class IColumn;
+
+// Common subexpression elimination for the expr contexts of one list, e.g. the projections or
+// the conjuncts of an operator. Function call subtrees that are equal by VExpr::equals are put
+// into one group; within one block the first evaluation of a group records its result column
+// and the others reuse it instead of evaluating their subtree again.
+//
+// The cache holds per block state, so every local state builds its own one. Callers reset() it
+// whenever the block changes shape, a stale entry is also detected by checking the block, its
+// rows and the column pointer before it is reused.
+class CommonExprCache {
+public:
+    // Returns nullptr if no function call subtree appears more than once in `ctxs`.
+    static std::shared_ptr<CommonExprCache> create(const VExprContextSPtrs& ctxs);
+
+    void reset();
+
+    // Sets `*column_id` and returns true if an expr of the same group as `expr` has already been
+    // evaluated on `block`.
+    bool get(const VExpr* expr, const Block& block, int* column_id);
+    void put(const VExpr* expr, const Block& block, int column_id);
+
+    size_t num_groups() const { return _results.size(); }
+    int64_t reused_count() const { return _reused_count; }
+
+private:
+    struct Result {
+        const Block* block = nullptr;
+        const IColumn* column = nullptr;
+        size_t rows = 0;
+        int column_id = -1;
+    };
+
+    std::unordered_map<const VExpr*, size_t> _groups;
+    std::vector<Result> _results;
+    int64_t _reused_count = 0;
+};
+
+using CommonExprCacheSPtr = std::shared_ptr<CommonExprCache>;
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
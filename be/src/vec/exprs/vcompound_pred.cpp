@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcompound_pred.h"
+
+#include "common/config.h"
+#include "runtime/primitive_type.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/functions/multi_pattern_like.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+bool VCompoundPred::_collect_pattern_leaves(const VExprSPtr& expr, std::vector<VExprSPtr>* leaves,
+                                            std::vector<VCompoundPred*>* nested_ors) {
+    if (auto* compound = dynamic_cast<VCompoundPred*>(expr.get())) {
+        if (compound->_op != TExprOpcode::COMPOUND_OR) {
+            return false;
+        }
+        nested_ors->push_back(compound);
+        for (const auto& child : compound->children()) {
+            if (!_collect_pattern_leaves(child, leaves, nested_ors)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    const auto& name = expr->fn().name.function_name;
+    if ((name != "like" && name != "regexp" && name != "rlike") || expr->get_num_children() != 2) {
+        return false;
+    }
+    const auto& pattern = expr->get_child(1);
+    if (!pattern->is_literal() || pattern->is_nullable() ||
+        !is_string_type(pattern->result_type()) || expr->get_child(0)->is_constant()) {
+        return false;
+    }
+    leaves->push_back(expr);
+    return true;
+}
+
+Status VCompoundPred::open(RuntimeState* state, VExprContext* context,
+                           FunctionContext::FunctionStateScope scope) {
+    // Decided before the children are opened, so that the ORs below a merged one skip it.
+    std::vector<VExprSPtr> leaves;
+    std::vector<VCompoundPred*> nested_ors;
+    bool merge = scope == FunctionContext::FRAGMENT_LOCAL && _op == TExprOpcode::COMPOUND_OR &&
+                 !_skip_pattern_merge && config::enable_multi_pattern_like;
+    if (merge) {
+        for (const auto& child : _children) {
+            merge = merge && _collect_pattern_leaves(child, &leaves, &nested_ors);
+        }
+        merge = merge &&
+                static_cast<int64_t>(leaves.size()) >= config::multi_pattern_like_min_patterns &&
+                std::ranges::all_of(leaves, [&](const VExprSPtr& leaf) {
+                    return leaves[0]->get_child(0)->equals(*leaf->get_child(0));
+                });
+    }
+    if (merge) {
+        for (auto* nested_or : nested_ors) {
+            nested_or->_skip_pattern_merge = true;
+        }
+    }
+    RETURN_IF_ERROR(VectorizedFnCall::open(state, context, scope));
+    if (!merge) {
+        return Status::OK();
+    }
+
+    std::vector<MultiPatternLikeMatcher::Pattern> patterns;
+    patterns.reserve(leaves.size());
+    for (const auto& leaf : leaves) {
+        const auto* literal = static_cast<const VLiteral*>(leaf->get_child(1).get());
+        patterns.push_back({.pattern = literal->get_column_ptr()->get_data_at(0).to_string(),
+                            .is_like = leaf->fn().name.function_name == "like"});
+    }
+    Status st = MultiPatternLikeMatcher::create(patterns, &_multi_pattern);
+    if (!st.ok()) {
+        // the patterns are still evaluated one by one
+        LOG(INFO) << "can not merge " << patterns.size() << " patterns of " << _expr_name
+                  << ", reason: " << st.to_string();
+        _multi_pattern.reset();
+        return Status::OK();
+    }
+    _multi_pattern_input = leaves[0]->get_child(0);
+    return Status::OK();
+}
+
+Status VCompoundPred::_execute_multi_pattern(VExprContext* context, Block* block,
+                                             int* result_column_id, bool* executed) {
+    *executed = false;
+    int input_id = -1;
+    RETURN_IF_ERROR(_multi_pattern_input->execute(context, block, &input_id));
+    ColumnPtr input = block->get_by_position(input_id).column->convert_to_full_column_if_const();
+
+    const IColumn* data_column = input.get();
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable_column = check_and_get_column<ColumnNullable>(data_column)) {
+        null_map = &nullable_column->get_null_map_data();
+        data_column = nullable_column->get_nested_column_ptr().get();
+    }
+    const auto* strings = check_and_get_column<ColumnString>(data_column);
+    if (strings == nullptr || (null_map != nullptr && !_data_type->is_nullable())) {
+        return Status::OK();
+    }
+
+    const size_t rows = block->rows();
+    auto matched = ColumnUInt8::create(rows, 0);
+    RETURN_IF_ERROR(_multi_pattern->match(*strings, matched->get_data()));
+    ColumnPtr result = std::move(matched);
+    if (_data_type->is_nullable()) {
+        // LIKE of a NULL is NULL, and so is the OR of them
+        auto result_null_map = ColumnUInt8::create(rows, 0);
+        if (null_map != nullptr) {
+            result_null_map->get_data().assign(*null_map);
+        }
+        result = ColumnNullable::create(result, std::move(result_null_map));
+    }
+    block->insert({result, _data_type, _expr_name});
+    *result_column_id = static_cast<int>(block->columns() - 1);
+    *executed = true;
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
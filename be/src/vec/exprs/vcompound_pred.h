@@ -20,6 +20,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "gutil/integral_types.h"
@@ -34,6 +36,8 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+class MultiPatternLikeMatcher;
+
 inline std::string compound_operator_to_string(TExprOpcode::type op) {
     if (op == TExprOpcode::COMPOUND_AND) {
         return "and";
@@ -57,6 +61,9 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
@@ -156,6 +163,13 @@ public:
         if (fast_execute(context, block, result_column_id)) {
             return Status::OK();
         }
+        if (_multi_pattern != nullptr) {
+            bool executed = false;
+            RETURN_IF_ERROR(_execute_multi_pattern(context, block, result_column_id, &executed));
+            if (executed) {
+                return Status::OK();
+            }
+        }
         if (get_num_children() == 1 || _has_const_child()) {
             return VectorizedFnCall::execute(context, block, result_column_id);
         }
@@ -384,6 +398,13 @@ private:
         return (l_null & r_null) | (r_null & (r_null ^ a)) | (l_null & (l_null ^ b));
     }
 
+    // Collects the LIKE / REGEXP leaves of a tree of ORs, returns false if any leaf is something
+    // else or has a non constant pattern.
+    static bool _collect_pattern_leaves(const VExprSPtr& expr, std::vector<VExprSPtr>* leaves,
+                                        std::vector<VCompoundPred*>* nested_ors);
+    Status _execute_multi_pattern(VExprContext* context, Block* block, int* result_column_id,
+                                  bool* executed);
+
     bool _has_const_child() const {
         return std::ranges::any_of(_children,
                                    [](const VExprSPtr& arg) -> bool { return arg->is_constant(); });
@@ -410,6 +431,13 @@ private:
     }
 
     TExprOpcode::type _op;
+
+    // Set when this OR and the ORs below it only test one input against constant LIKE / REGEXP
+    // patterns, which are then matched together in one pass over `_multi_pattern_input`.
+    std::shared_ptr<MultiPatternLikeMatcher> _multi_pattern;
+    VExprSPtr _multi_pattern_input;
+    // an OR above this one already merged the patterns of this subtree
+    bool _skip_pattern_merge = false;
 };
 
 #include "common/compile_check_end.h"
@@ -152,6 +152,10 @@ Status VectorizedFnCall::_do_execute(doris::vectorized::VExprContext* context,
     if (fast_execute(context, block, result_column_id)) {
         return Status::OK();
     }
+    auto* common_expr_cache = context->common_expr_cache();
+    if (common_expr_cache != nullptr && common_expr_cache->get(this, *block, result_column_id)) {
+        return Status::OK();
+    }
     DBUG_EXECUTE_IF("VectorizedFnCall.must_in_slow_path", {
         if (get_child(0)->is_slot_ref()) {
             auto debug_col_name = DebugPoints::instance()->get_debug_param_or_default<std::string>(
@@ -187,6 +191,9 @@ Status VectorizedFnCall::_do_execute(doris::vectorized::VExprContext* context,
     RETURN_IF_ERROR(_function->execute(context->fn_context(_fn_context_index), *block, args,
                                        num_columns_without_result, block->rows(), false));
     *result_column_id = num_columns_without_result;
+    if (common_expr_cache != nullptr) {
+        common_expr_cache->put(this, *block, *result_column_id);
+    }
     return Status::OK();
 }
 
@@ -17,17 +17,21 @@
 
 #include "vec/exprs/vexpr_context.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <numeric>
 #include <ostream>
 #include <string>
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/exception.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "udf/udf.h"
 #include "util/simd/bits.h"
+#include "util/stopwatch.hpp"
 #include "vec/columns/column_const.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -58,7 +62,16 @@ VExprContext::~VExprContext() {
 Status VExprContext::execute(vectorized::Block* block, int* result_column_id) {
     Status st;
     RETURN_IF_CATCH_EXCEPTION({
-        st = _root->execute(this, block, result_column_id);
+        bool fused = false;
+        // inverted index results are attached to the expr nodes, let the tree pick them up
+        if (_fused_program != nullptr && _inverted_index_context == nullptr) {
+            bool fallback = false;
+            st = _fused_program->execute(block, _root->expr_name(), result_column_id, &fallback);
+            fused = !fallback;
+        }
+        if (!fused) {
+            st = _root->execute(this, block, result_column_id);
+        }
         _last_result_column_id = *result_column_id;
     });
     return st;
@@ -68,6 +81,9 @@ Status VExprContext::prepare(RuntimeState* state, const RowDescriptor& row_desc)
     _prepared = true;
     Status st;
     RETURN_IF_CATCH_EXCEPTION({ st = _root->prepare(state, row_desc, this); });
+    if (st.ok() && config::enable_fused_expr_evaluation) {
+        _fused_program = FusedExprCompiler::compile(_root);
+    }
     return st;
 }
 
@@ -109,6 +125,7 @@ Status VExprContext::clone(RuntimeState* state, VExprContextSPtr& new_ctx) {
     new_ctx->_is_clone = true;
     new_ctx->_prepared = true;
     new_ctx->_opened = true;
+    new_ctx->_fused_program = _fused_program;
 
     return _root->open(state, new_ctx.get(), FunctionContext::THREAD_LOCAL);
 }
@@ -126,6 +143,20 @@ int VExprContext::register_function_context(RuntimeState* state, const TypeDescr
     return static_cast<int>(_fn_contexts.size()) - 1;
 }
 
+CommonExprCacheSPtr VExprContext::setup_common_expr_cache(const VExprContextSPtrs& ctxs) {
+    auto cache = CommonExprCache::create(ctxs);
+    for (const auto& ctx : ctxs) {
+        ctx->_common_expr_cache = cache;
+    }
+    return cache;
+}
+
+void VExprContext::reset_common_expr_cache(const VExprContextSPtrs& ctxs) {
+    if (!ctxs.empty() && ctxs.front()->_common_expr_cache != nullptr) {
+        ctxs.front()->_common_expr_cache->reset();
+    }
+}
+
 Status VExprContext::evaluate_inverted_index(uint32_t segment_num_rows) {
     Status st;
     RETURN_IF_CATCH_EXCEPTION({ st = _root->evaluate_inverted_index(this, segment_num_rows); });
@@ -164,7 +195,51 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     return execute_conjuncts(ctxs, filters, false, block, result_filter, can_filter_all);
 }
 
-// TODO: Performance Optimization
+namespace {
+
+// Conjuncts with fewer evaluated rows keep their planned position until they have statistics.
+constexpr int64_t CONJUNCT_STATS_MIN_ROWS = 4096;
+// Compacting a block is only worth it when there are enough rows to skip.
+constexpr size_t CONJUNCT_COMPACTION_MIN_ROWS = 1024;
+
+// Cheap and selective conjuncts come first: the cost of evaluating one row divided by the
+// fraction of rows the conjunct filters out.
+double conjunct_rank(const VExprContext::ConjunctStats& stats) {
+    if (stats.evaluated_rows < CONJUNCT_STATS_MIN_ROWS || stats.input_rows == 0) {
+        return 0;
+    }
+    const double cost = static_cast<double>(stats.exec_time_ns) /
+                        static_cast<double>(stats.evaluated_rows);
+    const double pass_ratio =
+            static_cast<double>(stats.output_rows) / static_cast<double>(stats.input_rows);
+    return cost / std::max(1 - pass_ratio, 0.001);
+}
+
+} // namespace
+
+std::vector<size_t> VExprContext::_conjunct_order(const VExprContextSPtrs& ctxs) {
+    std::vector<size_t> order(ctxs.size());
+    std::iota(order.begin(), order.end(), 0);
+    if (!config::enable_adaptive_conjunct_order || ctxs.size() < 2) {
+        return order;
+    }
+    std::vector<double> ranks(ctxs.size());
+    for (size_t i = 0; i < ctxs.size(); ++i) {
+        ranks[i] = conjunct_rank(ctxs[i]->_conjunct_stats);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t lhs, size_t rhs) { return ranks[lhs] < ranks[rhs]; });
+    return order;
+}
+
+bool VExprContext::_can_compact_for(const VExprContextSPtrs& ctxs,
+                                    const std::vector<size_t>& order, size_t first) {
+    // inverted index results are sized for the whole block
+    return std::none_of(order.begin() + first, order.end(), [&](size_t i) {
+        return ctxs[i]->_inverted_index_context != nullptr;
+    });
+}
+
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                                        const std::vector<IColumn::Filter*>* filters,
                                        bool accept_null, Block* block,
@@ -172,18 +247,43 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
     size_t rows = block->rows();
     DCHECK_EQ(result_filter->size(), rows);
     *can_filter_all = false;
-    auto* __restrict result_filter_data = result_filter->data();
-    for (const auto& ctx : ctxs) {
+    reset_common_expr_cache(ctxs);
+
+    // When few rows remain selected, the rest of the conjuncts run on `compacted_block` that
+    // only holds the selected rows, so expensive functions skip the filtered ones.
+    // `selection` maps the rows of the compacted block back to `block`.
+    Block* eval_block = block;
+    IColumn::Filter* eval_filter = result_filter;
+    Block compacted_block;
+    IColumn::Filter compacted_filter;
+    std::vector<uint32_t> selection;
+    const size_t num_columns = block->columns();
+    const double compaction_selectivity = config::conjunct_compaction_selectivity;
+    const bool track_selected_rows =
+            compaction_selectivity > 0 || config::enable_adaptive_conjunct_order;
+    size_t selected_rows =
+            track_selected_rows
+                    ? rows - simd::count_zero_num((int8*)result_filter->data(), rows)
+                    : rows;
+
+    const auto order = _conjunct_order(ctxs);
+    for (size_t k = 0; k < order.size(); ++k) {
+        const auto& ctx = ctxs[order[k]];
+        const size_t eval_rows = eval_block->rows();
+        auto* __restrict result_filter_data = eval_filter->data();
+        bool filtered_all = false;
         // Statistics are only required when an rf wrapper exists in the expr.
         bool is_rf_wrapper = ctx->root()->is_rf_wrapper();
         int result_column_id = -1;
-        RETURN_IF_ERROR(ctx->execute(block, &result_column_id));
-        ColumnPtr& filter_column = block->get_by_position(result_column_id).column;
+        MonotonicStopWatch watch;
+        watch.start();
+        RETURN_IF_ERROR(ctx->execute(eval_block, &result_column_id));
+        const int64_t exec_time_ns = watch.elapsed_time();
+        ColumnPtr& filter_column = eval_block->get_by_position(result_column_id).column;
         if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*filter_column)) {
             size_t column_size = nullable_column->size();
             if (column_size == 0) {
-                *can_filter_all = true;
-                return Status::OK();
+                filtered_all = true;
             } else {
                 const ColumnPtr& nested_column = nullable_column->get_nested_column_ptr();
                 const IColumn::Filter& filter =
@@ -192,39 +292,39 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                 const auto* __restrict null_map_data = nullable_column->get_null_map_data().data();
 
                 size_t input_rows =
-                        rows -
-                        (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, rows) : 0);
+                        eval_rows - (is_rf_wrapper ? simd::count_zero_num(
+                                                             (int8*)result_filter_data, eval_rows)
+                                                   : 0);
 
                 if (accept_null) {
-                    for (size_t i = 0; i < rows; ++i) {
+                    for (size_t i = 0; i < eval_rows; ++i) {
                         result_filter_data[i] &= (null_map_data[i]) || filter_data[i];
                     }
                 } else {
-                    for (size_t i = 0; i < rows; ++i) {
+                    for (size_t i = 0; i < eval_rows; ++i) {
                         result_filter_data[i] &= (!null_map_data[i]) & filter_data[i];
                     }
                 }
 
                 size_t output_rows =
-                        rows -
-                        (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, rows) : 0);
+                        eval_rows - (is_rf_wrapper ? simd::count_zero_num(
+                                                             (int8*)result_filter_data, eval_rows)
+                                                   : 0);
 
                 if (is_rf_wrapper) {
                     ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
                 }
 
                 if ((is_rf_wrapper && output_rows == 0) ||
-                    (!is_rf_wrapper && memchr(result_filter_data, 0x1, rows) == nullptr)) {
-                    *can_filter_all = true;
-                    return Status::OK();
+                    (!is_rf_wrapper && memchr(result_filter_data, 0x1, eval_rows) == nullptr)) {
+                    filtered_all = true;
                 }
             }
         } else if (const auto* const_column = check_and_get_column<ColumnConst>(*filter_column)) {
             // filter all
             if (!const_column->get_bool(0)) {
-                *can_filter_all = true;
-                memset(result_filter_data, 0, result_filter->size());
-                return Status::OK();
+                filtered_all = true;
+                memset(result_filter->data(), 0, result_filter->size());
             }
         } else {
             const IColumn::Filter& filter =
@@ -232,29 +332,85 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
             const auto* __restrict filter_data = filter.data();
 
             size_t input_rows =
-                    rows -
-                    (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, rows) : 0);
+                    eval_rows -
+                    (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, eval_rows)
+                                   : 0);
 
-            for (size_t i = 0; i < rows; ++i) {
+            for (size_t i = 0; i < eval_rows; ++i) {
                 result_filter_data[i] &= filter_data[i];
             }
 
             size_t output_rows =
-                    rows -
-                    (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, rows) : 0);
+                    eval_rows -
+                    (is_rf_wrapper ? simd::count_zero_num((int8*)result_filter_data, eval_rows)
+                                   : 0);
 
             if (is_rf_wrapper) {
                 ctx->root()->do_judge_selectivity(input_rows - output_rows, input_rows);
             }
 
             if ((is_rf_wrapper && output_rows == 0) ||
-                (!is_rf_wrapper && memchr(result_filter_data, 0x1, rows) == nullptr)) {
-                *can_filter_all = true;
-                return Status::OK();
+                (!is_rf_wrapper && memchr(result_filter_data, 0x1, eval_rows) == nullptr)) {
+                filtered_all = true;
+            }
+        }
+
+        if (track_selected_rows) {
+            const size_t new_selected_rows =
+                    filtered_all ? 0
+                                 : eval_rows - simd::count_zero_num((int8*)result_filter_data,
+                                                                    eval_rows);
+            auto& stats = ctx->_conjunct_stats;
+            stats.input_rows += selected_rows;
+            stats.output_rows += new_selected_rows;
+            stats.evaluated_rows += eval_rows;
+            stats.exec_time_ns += exec_time_ns;
+            selected_rows = new_selected_rows;
+        }
+        if (filtered_all) {
+            *can_filter_all = true;
+            if (eval_block != block) {
+                // the selected rows are still set in the full size filter
+                memset(result_filter->data(), 0, rows);
+            }
+            return Status::OK();
+        }
+
+        if (compaction_selectivity > 0 && k + 1 < order.size() &&
+            eval_rows >= CONJUNCT_COMPACTION_MIN_ROWS &&
+            static_cast<double>(selected_rows) <=
+                    compaction_selectivity * static_cast<double>(eval_rows) &&
+            _can_compact_for(ctxs, order, k + 1)) {
+            std::vector<uint32_t> next_selection;
+            next_selection.reserve(selected_rows);
+            for (uint32_t i = 0; i < eval_rows; ++i) {
+                if (result_filter_data[i]) {
+                    next_selection.push_back(eval_block == block ? i : selection[i]);
+                }
+            }
+            Block next_block;
+            for (size_t i = 0; i < num_columns; ++i) {
+                const auto& entry = eval_block->get_by_position(i);
+                next_block.insert({entry.column->filter(*eval_filter, selected_rows), entry.type,
+                                   entry.name});
             }
+            compacted_block.swap(next_block);
+            compacted_filter.assign(selected_rows, static_cast<UInt8>(1));
+            selection.swap(next_selection);
+            eval_block = &compacted_block;
+            eval_filter = &compacted_filter;
+        }
+    }
+    if (eval_block != block) {
+        auto* __restrict result_filter_data = result_filter->data();
+        const auto* __restrict compacted_filter_data = compacted_filter.data();
+        memset(result_filter_data, 0, rows);
+        for (size_t i = 0; i < selection.size(); ++i) {
+            result_filter_data[selection[i]] = compacted_filter_data[i];
         }
     }
     if (filters != nullptr) {
+        auto* __restrict result_filter_data = result_filter->data();
         for (auto* filter : *filters) {
             auto* __restrict filter_data = filter->data();
             const size_t size = filter->size();
@@ -283,6 +439,7 @@ Status VExprContext::execute_conjuncts(const VExprContextSPtrs& conjuncts, Block
 
     auto* final_null_map = null_map.get_data().data();
     auto* final_filter_ptr = filter.data();
+    reset_common_expr_cache(conjuncts);
 
     for (const auto& conjunct : conjuncts) {
         int result_column_id = -1;
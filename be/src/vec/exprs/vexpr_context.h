@@ -29,7 +29,9 @@
 #include "runtime/types.h"
 #include "udf/udf.h"
 #include "vec/core/block.h"
+#include "vec/exprs/common_expr_cache.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/exprs/vfused_expr.h"
 
 namespace doris {
 class RowDescriptor;
@@ -158,7 +160,10 @@ public:
     [[nodiscard]] Status execute(Block* block, int* result_column_id);
 
     VExprSPtr root() { return _root; }
-    void set_root(const VExprSPtr& expr) { _root = expr; }
+    void set_root(const VExprSPtr& expr) {
+        _root = expr;
+        _fused_program.reset();
+    }
     void set_inverted_index_context(std::shared_ptr<InvertedIndexContext> inverted_index_context) {
         _inverted_index_context = std::move(inverted_index_context);
     }
@@ -238,6 +243,27 @@ public:
 
     bool force_materialize_slot() const { return _force_materialize_slot; }
 
+    CommonExprCache* common_expr_cache() const { return _common_expr_cache.get(); }
+
+    // Runtime statistics of this context when it is evaluated by execute_conjuncts(), used to
+    // evaluate cheap and selective conjuncts first.
+    struct ConjunctStats {
+        // rows selected before and after this conjunct was applied
+        int64_t input_rows = 0;
+        int64_t output_rows = 0;
+        // rows of the blocks this conjunct was executed on, which may have been compacted
+        int64_t evaluated_rows = 0;
+        int64_t exec_time_ns = 0;
+    };
+    const ConjunctStats& conjunct_stats() const { return _conjunct_stats; }
+
+    // Shares the results of equal function call subtrees between `ctxs` within one block.
+    // Returns the installed cache, nullptr if there is nothing to share.
+    static CommonExprCacheSPtr setup_common_expr_cache(const VExprContextSPtrs& ctxs);
+
+    // Must be called before `ctxs` are evaluated on a new block.
+    static void reset_common_expr_cache(const VExprContextSPtrs& ctxs);
+
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
     VExprContext& operator=(const VExprContext& other) {
@@ -256,6 +282,7 @@ public:
 
         _last_result_column_id = other._last_result_column_id;
         _depth_num = other._depth_num;
+        _fused_program = other._fused_program;
         return *this;
     }
 
@@ -268,6 +295,7 @@ public:
         _fn_contexts = std::move(other._fn_contexts);
         _last_result_column_id = other._last_result_column_id;
         _depth_num = other._depth_num;
+        _fused_program = std::move(other._fused_program);
         return *this;
     }
 
@@ -275,6 +303,10 @@ private:
     // Close method is called in vexpr context dector, not need call expicility
     void close();
 
+    static std::vector<size_t> _conjunct_order(const VExprContextSPtrs& ctxs);
+    static bool _can_compact_for(const VExprContextSPtrs& ctxs, const std::vector<size_t>& order,
+                                 size_t first);
+
     friend class VExpr;
 
     /// The expr tree this context is for.
@@ -301,5 +333,14 @@ private:
     bool _force_materialize_slot = false;
 
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
+
+    // Set in prepare() when the whole tree can be evaluated as one fused program, shared
+    // with the clones of this context.
+    FusedExprProgramSPtr _fused_program;
+
+    // Not shared with clones, it holds the results of the block being evaluated.
+    CommonExprCacheSPtr _common_expr_cache;
+
+    ConjunctStats _conjunct_stats;
 };
 } // namespace doris::vectorized
@@ -0,0 +1,638 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_expr.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "common/config.h"
+#include "runtime/primitive_type.h"
+#include "util/stopwatch.hpp"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+#include "vec/common/pod_array.h"
+#include "vec/core/accurate_comparison.h"
+#include "vec/core/block.h"
+#include "vec/core/field.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+bvar::Adder<int64_t> g_fused_expr_compile_count("fused_expr_compile_count");
+bvar::Adder<int64_t> g_fused_expr_compile_time_ns("fused_expr_compile_time_ns");
+bvar::Adder<int64_t> g_fused_expr_cache_hit_count("fused_expr_cache_hit_count");
+bvar::Adder<int64_t> g_fused_expr_rows("fused_expr_rows");
+bvar::Adder<int64_t> g_fused_expr_saved_columns("fused_expr_saved_columns");
+bvar::Adder<int64_t> g_fused_expr_fallback_count("fused_expr_fallback_count");
+
+std::mutex FusedExprCompiler::_cache_lock;
+std::unordered_map<std::string, FusedExprProgramSPtr> FusedExprCompiler::_cache;
+
+namespace {
+
+bool is_integer(PrimitiveType type) {
+    return type == TYPE_TINYINT || type == TYPE_SMALLINT || type == TYPE_INT ||
+           type == TYPE_BIGINT;
+}
+
+int integer_width(PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+        return 1;
+    case TYPE_SMALLINT:
+        return 2;
+    case TYPE_INT:
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+bool is_compare(FusedExprProgram::OpCode op) {
+    return op >= FusedExprProgram::OpCode::EQ;
+}
+
+template <typename T>
+const void* slot_data(const IColumn* column) {
+    const auto* vector_column = check_and_get_column<ColumnVector<T>>(column);
+    return vector_column == nullptr ? nullptr : vector_column->get_data().data();
+}
+
+const void* slot_data(const IColumn* column, PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+        return slot_data<Int8>(column);
+    case TYPE_SMALLINT:
+        return slot_data<Int16>(column);
+    case TYPE_INT:
+        return slot_data<Int32>(column);
+    case TYPE_BIGINT:
+        return slot_data<Int64>(column);
+    case TYPE_FLOAT:
+        return slot_data<Float32>(column);
+    case TYPE_DOUBLE:
+        return slot_data<Float64>(column);
+    default:
+        return nullptr;
+    }
+}
+
+template <typename T, typename R>
+void widen(const void* data, size_t start, size_t count, R* __restrict dst) {
+    const T* __restrict src = reinterpret_cast<const T*>(data) + start;
+    for (size_t i = 0; i < count; ++i) {
+        dst[i] = static_cast<R>(src[i]);
+    }
+}
+
+template <typename R>
+void load(const void* data, PrimitiveType type, size_t start, size_t count, R* dst) {
+    switch (type) {
+    case TYPE_TINYINT:
+        widen<Int8>(data, start, count, dst);
+        break;
+    case TYPE_SMALLINT:
+        widen<Int16>(data, start, count, dst);
+        break;
+    case TYPE_INT:
+        widen<Int32>(data, start, count, dst);
+        break;
+    case TYPE_BIGINT:
+        widen<Int64>(data, start, count, dst);
+        break;
+    case TYPE_FLOAT:
+        widen<Float32>(data, start, count, dst);
+        break;
+    default:
+        widen<Float64>(data, start, count, dst);
+        break;
+    }
+}
+
+// Integer arithmetic wraps on overflow like the hardware instruction the vectorized
+// functions compile to, the unsigned detour only keeps it well defined in C++.
+template <typename T>
+void arithmetic(FusedExprProgram::OpCode op, const T* __restrict a, const T* __restrict b,
+                T* __restrict c, size_t count) {
+    using U = std::conditional_t<std::is_integral_v<T>, std::make_unsigned_t<T>, T>;
+    switch (op) {
+    case FusedExprProgram::OpCode::ADD:
+        for (size_t i = 0; i < count; ++i) {
+            c[i] = static_cast<T>(static_cast<U>(a[i]) + static_cast<U>(b[i]));
+        }
+        break;
+    case FusedExprProgram::OpCode::SUB:
+        for (size_t i = 0; i < count; ++i) {
+            c[i] = static_cast<T>(static_cast<U>(a[i]) - static_cast<U>(b[i]));
+        }
+        break;
+    default:
+        for (size_t i = 0; i < count; ++i) {
+            c[i] = static_cast<T>(static_cast<U>(a[i]) * static_cast<U>(b[i]));
+        }
+        break;
+    }
+}
+
+template <template <typename, typename> class Op, typename T>
+void compare(const T* __restrict a, const T* __restrict b, UInt8* __restrict c, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        c[i] = Op<T, T>::apply(a[i], b[i]);
+    }
+}
+
+template <typename T>
+void compare(FusedExprProgram::OpCode op, const T* a, const T* b, UInt8* c, size_t count) {
+    switch (op) {
+    case FusedExprProgram::OpCode::EQ:
+        compare<EqualsOp>(a, b, c, count);
+        break;
+    case FusedExprProgram::OpCode::NE:
+        compare<NotEqualsOp>(a, b, c, count);
+        break;
+    case FusedExprProgram::OpCode::LT:
+        compare<LessOp>(a, b, c, count);
+        break;
+    case FusedExprProgram::OpCode::LE:
+        compare<LessOrEqualsOp>(a, b, c, count);
+        break;
+    case FusedExprProgram::OpCode::GT:
+        compare<GreaterOp>(a, b, c, count);
+        break;
+    default:
+        compare<GreaterOrEqualsOp>(a, b, c, count);
+        break;
+    }
+}
+
+template <typename T, typename R>
+MutableColumnPtr store(const PaddedPODArray<R>& values) {
+    auto column = ColumnVector<T>::create(values.size());
+    auto& data = column->get_data();
+    for (size_t i = 0; i < values.size(); ++i) {
+        data[i] = static_cast<T>(values[i]);
+    }
+    return column;
+}
+
+} // namespace
+
+int FusedExprProgram::_new_register(ValueType type) {
+    int reg = static_cast<int>(_register_types.size());
+    _register_types.push_back(type);
+    _register_slots.push_back(type == ValueType::INT64 ? _num_int_registers++
+                                                       : _num_float_registers++);
+    return reg;
+}
+
+int FusedExprProgram::load_slot(int column_id, PrimitiveType slot_type) {
+    if (column_id < 0 || (!is_integer(slot_type) && !is_float_or_double(slot_type))) {
+        return -1;
+    }
+    Instruction instruction {.op = OpCode::LOAD_SLOT,
+                             .type = is_integer(slot_type) ? ValueType::INT64 : ValueType::FLOAT64};
+    instruction.dst = _new_register(instruction.type);
+    instruction.column_id = column_id;
+    instruction.slot_type = slot_type;
+    _instructions.push_back(instruction);
+    return instruction.dst;
+}
+
+int FusedExprProgram::load_int(Int64 value) {
+    Instruction instruction {.op = OpCode::LOAD_CONST, .type = ValueType::INT64};
+    instruction.dst = _new_register(instruction.type);
+    instruction.int_value = value;
+    _instructions.push_back(instruction);
+    return instruction.dst;
+}
+
+int FusedExprProgram::load_float(Float64 value) {
+    Instruction instruction {.op = OpCode::LOAD_CONST, .type = ValueType::FLOAT64};
+    instruction.dst = _new_register(instruction.type);
+    instruction.float_value = value;
+    _instructions.push_back(instruction);
+    return instruction.dst;
+}
+
+int FusedExprProgram::int_to_float(int src) {
+    if (src < 0 || src >= static_cast<int>(_register_types.size()) ||
+        _register_types[src] != ValueType::INT64) {
+        return -1;
+    }
+    Instruction instruction {.op = OpCode::INT_TO_FLOAT, .type = ValueType::INT64};
+    instruction.lhs = src;
+    instruction.dst = _new_register(ValueType::FLOAT64);
+    _instructions.push_back(instruction);
+    return instruction.dst;
+}
+
+int FusedExprProgram::binary(OpCode op, int lhs, int rhs) {
+    const int num_registers = static_cast<int>(_register_types.size());
+    if (op < OpCode::ADD || lhs < 0 || rhs < 0 || lhs >= num_registers ||
+        rhs >= num_registers || _register_types[lhs] != _register_types[rhs]) {
+        return -1;
+    }
+    Instruction instruction {.op = op, .type = _register_types[lhs]};
+    instruction.lhs = lhs;
+    instruction.rhs = rhs;
+    // comparisons write into the result column, the register is only a placeholder
+    instruction.dst = _new_register(instruction.type);
+    _instructions.push_back(instruction);
+    return instruction.dst;
+}
+
+Status FusedExprProgram::finish(int result, DataTypePtr result_type,
+                               PrimitiveType result_primitive_type) {
+    if (_instructions.empty() || _instructions.back().dst != result) {
+        return Status::InternalError("fused expr result {} is not the last instruction", result);
+    }
+    for (size_t i = 0; i + 1 < _instructions.size(); ++i) {
+        if (is_compare(_instructions[i].op)) {
+            return Status::InternalError("fused expr comparison must be the last instruction");
+        }
+    }
+    _compare_result = is_compare(_instructions.back().op);
+    bool valid_result_type = false;
+    if (_compare_result) {
+        valid_result_type = result_primitive_type == TYPE_BOOLEAN;
+    } else if (_register_types[result] == ValueType::INT64) {
+        valid_result_type = is_integer(result_primitive_type);
+    } else {
+        valid_result_type = result_primitive_type == TYPE_DOUBLE;
+    }
+    if (!valid_result_type) {
+        return Status::InternalError("fused expr can not produce {} results",
+                                     type_to_string(result_primitive_type));
+    }
+    _result = result;
+    _result_type = std::move(result_type);
+    _result_primitive_type = result_primitive_type;
+    return Status::OK();
+}
+
+Status FusedExprProgram::execute(Block* block, const std::string& name, int* result_column_id,
+                                 bool* fallback) const {
+    DCHECK(_result_type != nullptr);
+    *fallback = false;
+    const size_t rows = block->rows();
+    const bool nullable = _result_type->is_nullable();
+
+    std::vector<const void*> slot_inputs(_instructions.size(), nullptr);
+    std::vector<const NullMap*> null_maps;
+    for (size_t i = 0; i < _instructions.size(); ++i) {
+        const auto& instruction = _instructions[i];
+        if (instruction.op != OpCode::LOAD_SLOT) {
+            continue;
+        }
+        if (instruction.column_id >= static_cast<int>(block->columns())) {
+            return Status::InternalError("input block not contain slot column {}, block={}",
+                                         instruction.column_id, block->dump_structure());
+        }
+        const IColumn* column = block->get_by_position(instruction.column_id).column.get();
+        if (const auto* nullable_column = check_and_get_column<ColumnNullable>(column)) {
+            if (!nullable) {
+                g_fused_expr_fallback_count << 1;
+                *fallback = true;
+                return Status::OK();
+            }
+            null_maps.push_back(&nullable_column->get_null_map_data());
+            column = nullable_column->get_nested_column_ptr().get();
+        }
+        slot_inputs[i] = slot_data(column, instruction.slot_type);
+        if (slot_inputs[i] == nullptr) {
+            g_fused_expr_fallback_count << 1;
+            *fallback = true;
+            return Status::OK();
+        }
+    }
+
+    PaddedPODArray<Int64> int_registers(_num_int_registers * CHUNK_SIZE);
+    PaddedPODArray<Float64> float_registers(_num_float_registers * CHUNK_SIZE);
+    auto int_register = [&](int reg) {
+        return int_registers.data() + _register_slots[reg] * CHUNK_SIZE;
+    };
+    auto float_register = [&](int reg) {
+        return float_registers.data() + _register_slots[reg] * CHUNK_SIZE;
+    };
+
+    auto compare_column = ColumnUInt8::create(_compare_result ? rows : 0);
+    PaddedPODArray<Int64> int_result;
+    PaddedPODArray<Float64> float_result;
+    const bool int_result_type = _register_types[_result] == ValueType::INT64;
+    if (!_compare_result) {
+        int_result_type ? int_result.resize(rows) : float_result.resize(rows);
+    }
+
+    for (size_t start = 0; start < rows; start += CHUNK_SIZE) {
+        const size_t count = std::min(CHUNK_SIZE, rows - start);
+        for (size_t i = 0; i < _instructions.size(); ++i) {
+            const auto& instruction = _instructions[i];
+            const bool is_int = instruction.type == ValueType::INT64;
+            switch (instruction.op) {
+            case OpCode::LOAD_SLOT:
+                if (is_int) {
+                    load(slot_inputs[i], instruction.slot_type, start, count,
+                         int_register(instruction.dst));
+                } else {
+                    load(slot_inputs[i], instruction.slot_type, start, count,
+                         float_register(instruction.dst));
+                }
+                break;
+            case OpCode::LOAD_CONST:
+                // constants are broadcast once, the registers are never written by others
+                if (start == 0) {
+                    if (is_int) {
+                        std::fill_n(int_register(instruction.dst), CHUNK_SIZE,
+                                    instruction.int_value);
+                    } else {
+                        std::fill_n(float_register(instruction.dst), CHUNK_SIZE,
+                                    instruction.float_value);
+                    }
+                }
+                break;
+            case OpCode::INT_TO_FLOAT: {
+                const Int64* __restrict src = int_register(instruction.lhs);
+                Float64* __restrict dst = float_register(instruction.dst);
+                for (size_t j = 0; j < count; ++j) {
+                    dst[j] = static_cast<Float64>(src[j]);
+                }
+                break;
+            }
+            case OpCode::ADD:
+            case OpCode::SUB:
+            case OpCode::MUL:
+                if (is_int) {
+                    arithmetic(instruction.op, int_register(instruction.lhs),
+                               int_register(instruction.rhs), int_register(instruction.dst),
+                               count);
+                } else {
+                    arithmetic(instruction.op, float_register(instruction.lhs),
+                               float_register(instruction.rhs), float_register(instruction.dst),
+                               count);
+                }
+                break;
+            default: {
+                UInt8* dst = compare_column->get_data().data() + start;
+                if (is_int) {
+                    compare(instruction.op, int_register(instruction.lhs),
+                            int_register(instruction.rhs), dst, count);
+                } else {
+                    compare(instruction.op, float_register(instruction.lhs),
+                            float_register(instruction.rhs), dst, count);
+                }
+                break;
+            }
+            }
+        }
+        if (_compare_result) {
+            continue;
+        }
+        if (int_result_type) {
+            memcpy(int_result.data() + start, int_register(_result), count * sizeof(Int64));
+        } else {
+            memcpy(float_result.data() + start, float_register(_result), count * sizeof(Float64));
+        }
+    }
+
+    MutableColumnPtr result_column;
+    switch (_result_primitive_type) {
+    case TYPE_BOOLEAN:
+        result_column = std::move(compare_column);
+        break;
+    case TYPE_TINYINT:
+        result_column = store<Int8>(int_result);
+        break;
+    case TYPE_SMALLINT:
+        result_column = store<Int16>(int_result);
+        break;
+    case TYPE_INT:
+        result_column = store<Int32>(int_result);
+        break;
+    case TYPE_BIGINT:
+        result_column = ColumnInt64::create();
+        assert_cast<ColumnInt64&>(*result_column).get_data().swap(int_result);
+        break;
+    default:
+        result_column = ColumnFloat64::create();
+        assert_cast<ColumnFloat64&>(*result_column).get_data().swap(float_result);
+        break;
+    }
+
+    if (nullable) {
+        auto null_map_column = ColumnUInt8::create(rows, 0);
+        auto* __restrict null_map = null_map_column->get_data().data();
+        for (const auto* input_null_map : null_maps) {
+            const auto* __restrict input = input_null_map->data();
+            for (size_t i = 0; i < rows; ++i) {
+                null_map[i] |= input[i];
+            }
+        }
+        result_column =
+                ColumnNullable::create(std::move(result_column), std::move(null_map_column));
+    }
+
+    block->insert({std::move(result_column), _result_type, name});
+    *result_column_id = static_cast<int>(block->columns() - 1);
+    g_fused_expr_rows << rows;
+    g_fused_expr_saved_columns << _num_saved_columns;
+    return Status::OK();
+}
+
+bool FusedExprCompiler::_fingerprint(const VExprSPtr& expr, std::string* fingerprint) {
+    fmt::format_to(std::back_inserter(*fingerprint), "({}:{}:{}", int(expr->node_type()),
+                   expr->data_type()->get_name(), expr->fn().name.function_name);
+    if (expr->is_slot_ref()) {
+        const auto* slot_ref = assert_cast<const VSlotRef*>(expr.get());
+        fmt::format_to(std::back_inserter(*fingerprint), ":#{}", slot_ref->column_id());
+    } else if (expr->is_literal()) {
+        const auto* literal = static_cast<const VLiteral*>(expr.get());
+        if (literal->get_column_ptr() == nullptr || literal->get_column_ptr()->size() != 1) {
+            return false;
+        }
+        fmt::format_to(std::back_inserter(*fingerprint), ":={}", literal->value());
+    }
+    for (const auto& child : expr->children()) {
+        if (!_fingerprint(child, fingerprint)) {
+            return false;
+        }
+    }
+    fingerprint->push_back(')');
+    return true;
+}
+
+bool FusedExprCompiler::_compile_node(const VExprSPtr& expr, bool is_root,
+                                      FusedExprProgram* program, CompiledNode* node,
+                                      size_t* num_internal_nodes) {
+    const PrimitiveType type = expr->result_type();
+    node->nullable = expr->is_nullable();
+    node->type = is_integer(type) ? FusedExprProgram::ValueType::INT64
+                                  : FusedExprProgram::ValueType::FLOAT64;
+
+    if (expr->is_slot_ref()) {
+        node->reg = program->load_slot(assert_cast<const VSlotRef*>(expr.get())->column_id(), type);
+        return node->reg >= 0;
+    }
+
+    if (expr->is_literal()) {
+        if (node->nullable || (!is_integer(type) && !is_float_or_double(type))) {
+            return false;
+        }
+        Field field;
+        static_cast<const VLiteral*>(expr.get())->get_column_ptr()->get(0, field);
+        if (field.is_null()) {
+            return false;
+        }
+        node->reg = is_integer(type) ? program->load_int(field.get<Int64>())
+                                     : program->load_float(field.get<Float64>());
+        return node->reg >= 0;
+    }
+
+    if (expr->node_type() == TExprNodeType::CAST_EXPR) {
+        if (expr->get_num_children() != 1) {
+            return false;
+        }
+        const PrimitiveType child_type = expr->get_child(0)->result_type();
+        CompiledNode child;
+        if (!_compile_node(expr->get_child(0), false, program, &child, num_internal_nodes) ||
+            child.nullable != node->nullable) {
+            return false;
+        }
+        if (is_integer(type) && is_integer(child_type) &&
+            integer_width(type) >= integer_width(child_type)) {
+            node->reg = child.reg;
+        } else if (type == TYPE_DOUBLE && is_integer(child_type)) {
+            node->reg = program->int_to_float(child.reg);
+        } else if (type == TYPE_DOUBLE && is_float_or_double(child_type)) {
+            node->reg = child.reg;
+        } else {
+            return false;
+        }
+        ++*num_internal_nodes;
+        return node->reg >= 0;
+    }
+
+    if (expr->node_type() != TExprNodeType::ARITHMETIC_EXPR &&
+        expr->node_type() != TExprNodeType::BINARY_PRED &&
+        expr->node_type() != TExprNodeType::FUNCTION_CALL) {
+        return false;
+    }
+    if (expr->get_num_children() != 2) {
+        return false;
+    }
+
+    using OpCode = FusedExprProgram::OpCode;
+    static const std::unordered_map<std::string, OpCode> ops = {
+            {"add", OpCode::ADD}, {"subtract", OpCode::SUB}, {"multiply", OpCode::MUL},
+            {"eq", OpCode::EQ},   {"ne", OpCode::NE},        {"lt", OpCode::LT},
+            {"le", OpCode::LE},   {"gt", OpCode::GT},        {"ge", OpCode::GE}};
+    auto it = ops.find(expr->fn().name.function_name);
+    if (it == ops.end()) {
+        return false;
+    }
+    const OpCode op = it->second;
+    if (is_compare(op)) {
+        // only as root, the UInt8 result has no register class of its own
+        if (!is_root || type != TYPE_BOOLEAN) {
+            return false;
+        }
+    } else if (!is_integer(type) && type != TYPE_DOUBLE) {
+        // FLOAT arithmetic would round differently when computed as DOUBLE
+        return false;
+    }
+
+    CompiledNode lhs;
+    CompiledNode rhs;
+    if (!_compile_node(expr->get_child(0), false, program, &lhs, num_internal_nodes) ||
+        !_compile_node(expr->get_child(1), false, program, &rhs, num_internal_nodes)) {
+        return false;
+    }
+    if (lhs.type != rhs.type || node->nullable != (lhs.nullable || rhs.nullable)) {
+        return false;
+    }
+    if (!is_compare(op) && lhs.type != node->type) {
+        return false;
+    }
+    node->is_compare = is_compare(op);
+    node->reg = program->binary(op, lhs.reg, rhs.reg);
+    ++*num_internal_nodes;
+    return node->reg >= 0;
+}
+
+FusedExprProgramSPtr FusedExprCompiler::compile(const VExprSPtr& root) {
+    if (root == nullptr || root->is_constant()) {
+        return nullptr;
+    }
+    std::string fingerprint;
+    if (!_fingerprint(root, &fingerprint)) {
+        return nullptr;
+    }
+    {
+        std::lock_guard<std::mutex> l(_cache_lock);
+        auto it = _cache.find(fingerprint);
+        if (it != _cache.end()) {
+            g_fused_expr_cache_hit_count << 1;
+            return it->second;
+        }
+    }
+
+    MonotonicStopWatch watch;
+    watch.start();
+    auto program = std::make_shared<FusedExprProgram>();
+    CompiledNode node;
+    size_t num_internal_nodes = 0;
+    // the root is materialized anyway, fusing only pays off when there is a node below it
+    bool compiled = _compile_node(root, true, program.get(), &node, &num_internal_nodes) &&
+                    num_internal_nodes > 1 &&
+                    program->finish(node.reg, root->data_type(), root->result_type()).ok();
+    if (compiled) {
+        program->set_num_saved_columns(num_internal_nodes - 1);
+    }
+    g_fused_expr_compile_count << 1;
+    g_fused_expr_compile_time_ns << watch.elapsed_time();
+
+    FusedExprProgramSPtr result = compiled ? std::move(program) : nullptr;
+    std::lock_guard<std::mutex> l(_cache_lock);
+    // unsupported trees are cached too so that they are not walked again for every instance
+    if (_cache.size() < config::fused_expr_program_cache_capacity) {
+        _cache.emplace(std::move(fingerprint), result);
+    }
+    return result;
+}
+
+void FusedExprCompiler::clear_cache() {
+    std::lock_guard<std::mutex> l(_cache_lock);
+    _cache.clear();
+}
+
+size_t FusedExprCompiler::cache_size() {
+    std::lock_guard<std::mutex> l(_cache_lock);
+    return _cache.size();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
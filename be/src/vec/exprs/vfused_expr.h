@@ -0,0 +1,145 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "runtime/define_primitive_type.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+
+// FusedExprProgram is the flattened form of a fixed-width scalar expression tree: slot refs,
+// numeric literals, widening casts, `+ - *` and binary comparisons. Integer values are computed
+// as Int64 and floating values as Float64. Executing the program walks the block in chunks of
+// CHUNK_SIZE rows and runs every instruction on per-chunk scratch registers, so only the final
+// result is materialized as a column instead of one column per node of the tree.
+class FusedExprProgram {
+public:
+    enum class ValueType : uint8_t { INT64, FLOAT64 };
+    enum class OpCode : uint8_t {
+        LOAD_SLOT,
+        LOAD_CONST,
+        INT_TO_FLOAT,
+        ADD,
+        SUB,
+        MUL,
+        EQ,
+        NE,
+        LT,
+        LE,
+        GT,
+        GE
+    };
+
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    // Builder interface used by the compiler, each appends one instruction and returns the
+    // register holding its result. Returns -1 if the operands are not valid for the op.
+    int load_slot(int column_id, PrimitiveType slot_type);
+    int load_int(Int64 value);
+    int load_float(Float64 value);
+    int int_to_float(int src);
+    int binary(OpCode op, int lhs, int rhs);
+    // `result` must be the register of the last instruction. Comparisons are only allowed as
+    // the last instruction, they write directly into the UInt8 result column.
+    Status finish(int result, DataTypePtr result_type, PrimitiveType result_primitive_type);
+
+    // Evaluates the program over `block` and appends the result column. Sets `*fallback` and
+    // leaves the block untouched when an input column does not have the layout the program was
+    // compiled for, e.g. a const column or a different nested type.
+    Status execute(Block* block, const std::string& name, int* result_column_id,
+                   bool* fallback) const;
+
+    size_t num_instructions() const { return _instructions.size(); }
+    // Number of columns the expression tree would have materialized for non-root nodes.
+    size_t num_saved_columns() const { return _num_saved_columns; }
+    void set_num_saved_columns(size_t num) { _num_saved_columns = num; }
+
+private:
+    struct Instruction {
+        OpCode op;
+        ValueType type; // type of the operands
+        int dst = -1;
+        int lhs = -1;
+        int rhs = -1;
+        int column_id = -1;
+        PrimitiveType slot_type = INVALID_TYPE;
+        Int64 int_value = 0;
+        Float64 float_value = 0;
+    };
+
+    int _new_register(ValueType type);
+
+    std::vector<Instruction> _instructions;
+    std::vector<ValueType> _register_types;
+    // Index of each register in the scratch buffer of its type.
+    std::vector<int> _register_slots;
+    int _num_int_registers = 0;
+    int _num_float_registers = 0;
+    int _result = -1;
+    bool _compare_result = false;
+    DataTypePtr _result_type;
+    PrimitiveType _result_primitive_type = INVALID_TYPE;
+    size_t _num_saved_columns = 0;
+};
+
+using FusedExprProgramSPtr = std::shared_ptr<const FusedExprProgram>;
+
+// Compiles expression trees into FusedExprProgram. Programs are cached process wide by the
+// fingerprint of the tree, which covers node types, function names, slot columns and literal
+// values, so the same predicate in every instance of a fragment is compiled once.
+class FusedExprCompiler {
+public:
+    // Returns nullptr if `root` is not fully made of supported nodes or if fusing it would not
+    // save any intermediate column.
+    static FusedExprProgramSPtr compile(const VExprSPtr& root);
+
+    static void clear_cache();
+    static size_t cache_size();
+
+private:
+    struct CompiledNode {
+        int reg = -1;
+        FusedExprProgram::ValueType type = FusedExprProgram::ValueType::INT64;
+        bool nullable = false;
+        bool is_compare = false;
+    };
+
+    static bool _fingerprint(const VExprSPtr& expr, std::string* fingerprint);
+    static bool _compile_node(const VExprSPtr& expr, bool is_root, FusedExprProgram* program,
+                              CompiledNode* node, size_t* num_internal_nodes);
+
+    static std::mutex _cache_lock;
+    static std::unordered_map<std::string, FusedExprProgramSPtr> _cache;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
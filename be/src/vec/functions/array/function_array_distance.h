@@ -17,8 +17,10 @@
 
 #pragma once
 
+#include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
@@ -104,9 +106,10 @@ public:
                                                     arg2.type->get_name()));
         }
 
-        auto col1 = arg1.column->convert_to_full_column_if_const();
-        auto col2 = arg2.column->convert_to_full_column_if_const();
-        if (col1->size() != col2->size()) {
+        // the query vector is usually a constant, read its only row instead of expanding it
+        auto [col1, is_const1] = unpack_if_const(arg1.column);
+        auto [col2, is_const2] = unpack_if_const(arg2.column);
+        if (!is_const1 && !is_const2 && col1->size() != col2->size()) {
             return Status::RuntimeError(
                     fmt::format("function {} have different input array sizes: {} and {}",
                                 get_name(), col1->size(), col2->size()));
@@ -128,43 +131,48 @@ public:
 
         const auto& offsets1 = *arr1.offsets_ptr;
         const auto& offsets2 = *arr2.offsets_ptr;
-        const auto& nested_col1 = assert_cast<const ColumnFloat64*>(arr1.nested_col.get());
-        const auto& nested_col2 = assert_cast<const ColumnFloat64*>(arr2.nested_col.get());
-        for (ssize_t row = 0; row < offsets1.size(); ++row) {
-            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row]) {
+        const auto* data1 =
+                assert_cast<const ColumnFloat64*>(arr1.nested_col.get())->get_data().data();
+        const auto* data2 =
+                assert_cast<const ColumnFloat64*>(arr2.nested_col.get())->get_data().data();
+        for (ssize_t row = 0; row < input_rows_count; ++row) {
+            const ssize_t row1 = index_check_const(row, is_const1);
+            const ssize_t row2 = index_check_const(row, is_const2);
+            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row1]) {
                 dst_null_data[row] = true;
                 continue;
             }
-            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row]) {
+            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row2]) {
                 dst_null_data[row] = true;
                 continue;
             }
 
-            dst_null_data[row] = false;
-            if (offsets1[row] != offsets2[row]) [[unlikely]] {
+            const size_t begin1 = offsets1[row1 - 1];
+            const size_t begin2 = offsets2[row2 - 1];
+            const size_t size1 = offsets1[row1] - begin1;
+            const size_t size2 = offsets2[row2] - begin2;
+            if (size1 != size2) [[unlikely]] {
                 return Status::InvalidArgument(
                         "function {} have different input element sizes of array: {} and {}",
-                        get_name(), offsets1[row] - offsets1[row - 1],
-                        offsets2[row] - offsets2[row - 1]);
+                        get_name(), size1, size2);
+            }
+            if ((arr1.nested_nullmap_data &&
+                 simd::contain_byte(arr1.nested_nullmap_data + begin1, size1, 1)) ||
+                (arr2.nested_nullmap_data &&
+                 simd::contain_byte(arr2.nested_nullmap_data + begin2, size2, 1))) {
+                dst_null_data[row] = true;
+                continue;
             }
 
+            // nulls are checked per array above, keep the loop over the elements branch free
             typename DistanceImpl::State st;
-            for (ssize_t pos = offsets1[row - 1]; pos < offsets1[row]; ++pos) {
-                if (arr1.nested_nullmap_data && arr1.nested_nullmap_data[pos]) {
-                    dst_null_data[row] = true;
-                    break;
-                }
-                if (arr2.nested_nullmap_data && arr2.nested_nullmap_data[pos]) {
-                    dst_null_data[row] = true;
-                    break;
-                }
-                DistanceImpl::accumulate(st, nested_col1->get_element(pos),
-                                         nested_col2->get_element(pos));
-            }
-            if (!dst_null_data[row]) {
-                dst_data[row] = DistanceImpl::finalize(st);
-                dst_null_data[row] = std::isnan(dst_data[row]);
+            const double* __restrict x = data1 + begin1;
+            const double* __restrict y = data2 + begin2;
+            for (size_t i = 0; i < size1; ++i) {
+                DistanceImpl::accumulate(st, x[i], y[i]);
             }
+            dst_data[row] = DistanceImpl::finalize(st);
+            dst_null_data[row] = std::isnan(dst_data[row]);
         }
 
         block.replace_by_position(
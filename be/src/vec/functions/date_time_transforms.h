@@ -24,6 +24,7 @@
 #include "runtime/runtime_state.h"
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
+#include "util/timezone_offset_cache.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
@@ -210,7 +211,7 @@ struct DateFormatImpl {
 
     template <typename Impl>
     static inline bool execute(const FromType& t, StringRef format, ColumnString::Chars& res_data,
-                               size_t& offset, const cctz::time_zone& time_zone) {
+                               size_t& offset, TimezoneOffsetCache& time_zone) {
         if constexpr (std::is_same_v<Impl, time_format_type::NoneImpl>) {
             // Handle non-special formats.
             const auto& dt = (DateType&)t;
@@ -256,7 +257,7 @@ struct FromUnixTimeImpl {
 
     template <typename Impl>
     static inline bool execute(const FromType& val, StringRef format, ColumnString::Chars& res_data,
-                               size_t& offset, const cctz::time_zone& time_zone) {
+                               size_t& offset, TimezoneOffsetCache& time_zone) {
         if constexpr (std::is_same_v<Impl, time_format_type::NoneImpl>) {
             DateType dt;
             if (val < 0 || val > TIMESTAMP_VALID_MAX) {
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <limits>
 #include <type_traits>
 
 #include "common/exception.h"
@@ -248,6 +249,63 @@ private:
         return (x > 0) ? 1 : ((x < 0) ? -1 : 0);
     }
 
+    // The per-row overflow checks can be skipped for a whole block when the largest operand
+    // magnitudes on both sides cannot produce an out of range result.
+    static constexpr bool can_check_overflow_by_block = check_overflow && OpTraits::can_overflow &&
+                                                        !IsDecimalV2<A> && !IsDecimalV2<B>;
+
+    template <typename T>
+    static NativeResultType max_magnitude(const T* __restrict x, size_t size) {
+        NativeResultType res = 0;
+        for (size_t i = 0; i < size; ++i) {
+            NativeResultType v = x[i];
+            v = v < 0 ? NativeResultType(-v) : v;
+            res = v > res ? v : res;
+        }
+        return res;
+    }
+
+    static bool block_cannot_overflow(NativeResultType max_a, NativeResultType max_b,
+                                      const ResultType& max_result_number,
+                                      const ResultType& scale_diff_multiplier) {
+        const NativeResultType max_result = max_result_number.value;
+        if constexpr (OpTraits::is_plus_minus) {
+            return max_a <= max_result && max_b <= max_result - max_a;
+        } else {
+            if (max_a == 0 || max_b == 0) {
+                return true;
+            }
+            if (max_b > std::numeric_limits<NativeResultType>::max() / max_a) {
+                return false;
+            }
+            NativeResultType product = max_a * max_b;
+            if (scale_diff_multiplier.value > 1) {
+                NativeResultType half = scale_diff_multiplier.value / 2;
+                if (product > std::numeric_limits<NativeResultType>::max() - half) {
+                    return false;
+                }
+                // rounding is monotonic, so the largest product gives the largest result
+                product = (product + half) / scale_diff_multiplier.value;
+            }
+            return product <= max_result;
+        }
+    }
+
+    /// same result as apply<need_adjust_scale>() for operands known not to overflow
+    template <bool need_adjust_scale>
+    static ALWAYS_INLINE NativeResultType apply_without_overflow(
+            NativeResultType a, NativeResultType b, const ResultType& scale_diff_multiplier) {
+        NativeResultType res = Op::template apply<NativeResultType>(a, b);
+        if constexpr (OpTraits::is_multiply && need_adjust_scale) {
+            if (res >= 0) {
+                res = (res + scale_diff_multiplier.value / 2) / scale_diff_multiplier.value;
+            } else {
+                res = (res - scale_diff_multiplier.value / 2) / scale_diff_multiplier.value;
+            }
+        }
+        return res;
+    }
+
     static void vector_vector(const typename Traits::ArrayA::value_type* __restrict a,
                               const typename Traits::ArrayB::value_type* __restrict b,
                               typename ArrayC::value_type* c, const LeftDataType& type_left,
@@ -260,6 +318,21 @@ private:
             Op::template vector_vector<check_overflow>(a, b, c, size);
         } else {
             bool need_adjust_scale = scale_diff_multiplier.value > 1;
+            if constexpr (can_check_overflow_by_block) {
+                if (block_cannot_overflow(max_magnitude(a, size), max_magnitude(b, size),
+                                          max_result_number, scale_diff_multiplier)) {
+                    std::visit(
+                            [&](auto need_adjust_scale) {
+                                for (size_t i = 0; i < size; i++) {
+                                    c[i] = typename ArrayC::value_type(
+                                            apply_without_overflow<need_adjust_scale>(
+                                                    a[i], b[i], scale_diff_multiplier));
+                                }
+                            },
+                            make_bool_variant(need_adjust_scale));
+                    return;
+                }
+            }
             std::visit(
                     [&](auto need_adjust_scale) {
                         for (size_t i = 0; i < size; i++) {
@@ -323,6 +396,21 @@ private:
         static_assert(!OpTraits::is_division);
 
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
+        if constexpr (can_check_overflow_by_block) {
+            if (block_cannot_overflow(max_magnitude(a, size), max_magnitude(&b, 1),
+                                      max_result_number, scale_diff_multiplier)) {
+                std::visit(
+                        [&](auto need_adjust_scale) {
+                            for (size_t i = 0; i < size; ++i) {
+                                c[i] = typename ArrayC::value_type(
+                                        apply_without_overflow<need_adjust_scale>(
+                                                a[i], b, scale_diff_multiplier));
+                            }
+                        },
+                        make_bool_variant(need_adjust_scale));
+                return;
+            }
+        }
         std::visit(
                 [&](auto need_adjust_scale) {
                     for (size_t i = 0; i < size; ++i) {
@@ -356,6 +444,21 @@ private:
                                 size_t size, const ResultType& max_result_number,
                                 const ResultType& scale_diff_multiplier) {
         bool need_adjust_scale = scale_diff_multiplier.value > 1;
+        if constexpr (can_check_overflow_by_block) {
+            if (block_cannot_overflow(max_magnitude(&a, 1), max_magnitude(b, size),
+                                      max_result_number, scale_diff_multiplier)) {
+                std::visit(
+                        [&](auto need_adjust_scale) {
+                            for (size_t i = 0; i < size; ++i) {
+                                c[i] = typename ArrayC::value_type(
+                                        apply_without_overflow<need_adjust_scale>(
+                                                a, b[i], scale_diff_multiplier));
+                            }
+                        },
+                        make_bool_variant(need_adjust_scale));
+                return;
+            }
+        }
         std::visit(
                 [&](auto need_adjust_scale) {
                     for (size_t i = 0; i < size; ++i) {
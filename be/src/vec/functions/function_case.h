@@ -225,7 +225,22 @@ public:
                 }
             } else {
                 if constexpr (when_null) {
-                    // TODO: need simd
+                    const auto& nullable_when =
+                            assert_cast<const ColumnNullable&>(*when_column_ptr);
+                    const auto* nested_when = check_and_get_column<ColumnUInt8>(
+                            nullable_when.get_nested_column_ptr().get());
+                    if (nested_when != nullptr) {
+                        const auto* __restrict cond_raw_data = nested_when->get_data().data();
+                        const auto* __restrict null_raw_data =
+                                nullable_when.get_null_map_data().data();
+                        // simd automatically
+                        for (int row_idx = 0; row_idx < rows_count; row_idx++) {
+                            then_idx_ptr[row_idx] |= (!then_idx_ptr[row_idx]) *
+                                                     (cond_raw_data[row_idx] != 0) *
+                                                     (!null_raw_data[row_idx]) * i;
+                        }
+                        continue;
+                    }
                     for (int row_idx = 0; row_idx < rows_count; row_idx++) {
                         if (!then_idx_ptr[row_idx] && when_column_ptr->get_bool(row_idx)) {
                             then_idx_ptr[row_idx] = i;
@@ -317,10 +332,7 @@ public:
     void update_result_auto_simd(MutableColumnPtr& result_column_ptr,
                                  const uint8* __restrict then_idx,
                                  CaseWhenColumnHolder& column_holder) const {
-        for (auto& then_ptr : column_holder.then_ptrs) {
-            then_ptr->reset(then_ptr.value()->convert_to_full_column_if_const().get());
-        }
-
+        using ValueType = typename ColumnType::value_type;
         size_t rows_count = column_holder.rows_count;
         result_column_ptr->resize(rows_count);
         auto* __restrict result_raw_data =
@@ -328,21 +340,55 @@ public:
                         ->get_data()
                         .data();
 
-        // set default value
-        for (int i = 0; i < rows_count; i++) {
-            result_raw_data[i] = {};
+        // Constant branch results are kept as values instead of being expanded to full
+        // columns. Index 0 is `else`, or the default value without an else branch.
+        std::vector<ValueType> const_values(column_holder.pair_count, ValueType {});
+        std::vector<const ValueType*> column_values(column_holder.pair_count, nullptr);
+        bool all_const = true;
+        for (size_t i = (has_else ? 0 : 1); i < column_holder.pair_count; i++) {
+            const auto& then_column = column_holder.then_ptrs[i].value();
+            if (is_column_const(*then_column)) {
+                const_values[i] =
+                        assert_cast<const ColumnType&, TypeCheckOnRelease::DISABLE>(
+                                assert_cast<const ColumnConst&>(*then_column).get_data_column())
+                                .get_data()[0];
+            } else {
+                column_values[i] =
+                        assert_cast<const ColumnType*, TypeCheckOnRelease::DISABLE>(
+                                then_column.get())
+                                ->get_data()
+                                .data();
+                all_const = false;
+            }
         }
 
-        // some types had simd automatically, but some not.
-        for (uint8_t i = (has_else ? 0 : 1); i < column_holder.pair_count; i++) {
-            auto* __restrict column_raw_data =
-                    assert_cast<ColumnType*>(
-                            column_holder.then_ptrs[i].value()->assume_mutable().get())
-                            ->get_data()
-                            .data();
-
+        if (all_const) {
+            // e.g. bucketing expressions, every row is a lookup by its branch index
+            const ValueType* __restrict lut = const_values.data();
             for (int row_idx = 0; row_idx < rows_count; row_idx++) {
-                result_raw_data[row_idx] += (then_idx[row_idx] == i) * column_raw_data[row_idx];
+                result_raw_data[row_idx] = lut[then_idx[row_idx]];
+            }
+            return;
+        }
+
+        for (int row_idx = 0; row_idx < rows_count; row_idx++) {
+            result_raw_data[row_idx] = const_values[0];
+        }
+        // branch-free blend per branch, simd automatically for fixed width types
+        for (size_t i = (has_else ? 0 : 1); i < column_holder.pair_count; i++) {
+            if (column_values[i] != nullptr) {
+                const ValueType* __restrict column_raw_data = column_values[i];
+                for (int row_idx = 0; row_idx < rows_count; row_idx++) {
+                    result_raw_data[row_idx] =
+                            then_idx[row_idx] == i ? column_raw_data[row_idx]
+                                                   : result_raw_data[row_idx];
+                }
+            } else if (i != 0) {
+                const ValueType value = const_values[i];
+                for (int row_idx = 0; row_idx < rows_count; row_idx++) {
+                    result_raw_data[row_idx] =
+                            then_idx[row_idx] == i ? value : result_raw_data[row_idx];
+                }
             }
         }
     }
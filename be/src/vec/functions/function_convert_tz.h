@@ -30,6 +30,7 @@
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
 #include "util/datetype_cast.hpp"
+#include "util/timezone_offset_cache.h"
 #include "util/timezone_utils.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
@@ -214,8 +215,8 @@ private:
                                             const ColumnType* date_column,
                                             ReturnColumnType* result_column,
                                             NullMap& result_null_map, size_t input_rows_count) {
-        cctz::time_zone& from_tz = convert_tz_state->from_tz;
-        cctz::time_zone& to_tz = convert_tz_state->to_tz;
+        TimezoneOffsetCache from_tz(convert_tz_state->from_tz);
+        TimezoneOffsetCache to_tz(convert_tz_state->to_tz);
         auto push_null = [&](size_t row) {
             result_null_map[row] = true;
             result_column->insert_default();
@@ -35,6 +35,7 @@
 #include "udf/udf.h"
 #include "util/binary_cast.hpp"
 #include "util/datetype_cast.hpp"
+#include "util/timezone_offset_cache.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
@@ -886,7 +887,7 @@ struct TimestampToDateTime : IFunction {
 
         NullMap& null_map = null_vector->get_data();
         auto& res_data = res_col->get_data();
-        const cctz::time_zone& time_zone = context->state()->timezone_obj();
+        TimezoneOffsetCache time_zone(context->state()->timezone_obj());
 
         for (int i = 0; i < input_rows_count; ++i) {
             Int64 value = column_data.get_element(i);
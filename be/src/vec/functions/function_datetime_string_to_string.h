@@ -25,6 +25,7 @@
 
 #include "common/cast_set.h"
 #include "common/status.h"
+#include "util/timezone_offset_cache.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
@@ -188,9 +189,10 @@ public:
                 [&](auto type) {
                     using Impl = decltype(type);
                     size_t offset = 0;
+                    TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
                     for (int i = 0; i < len; ++i) {
-                        null_map[i] = Transform::template execute<Impl>(
-                                ts[i], format, res_data, offset, context->state()->timezone_obj());
+                        null_map[i] = Transform::template execute<Impl>(ts[i], format, res_data,
+                                                                        offset, tz_cache);
                         res_offsets[i] = cast_set<uint32_t>(offset);
                     }
                     res_data.resize(offset);
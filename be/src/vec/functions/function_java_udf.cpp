@@ -100,24 +100,35 @@ Status JavaFunctionCall::execute_impl(FunctionContext* context, Block& block,
     SCOPED_TIMER(context->get_udf_execute_timer());
     std::unique_ptr<long[]> input_table;
     RETURN_IF_ERROR(JniConnector::to_java_table(&block, num_rows, arguments, input_table));
-    auto input_table_schema = JniConnector::parse_table_schema(&block, arguments, true);
+    if (jni_ctx->output_map == nullptr || jni_ctx->schema_arguments != arguments ||
+        jni_ctx->schema_result != result) {
+        jni_ctx->input_table_schema = JniConnector::parse_table_schema(&block, arguments, true);
+        auto output_table_schema = JniConnector::parse_table_schema(&block, {result}, true);
+        std::string output_nullable =
+                block.get_by_position(result).type->is_nullable() ? "true" : "false";
+        std::map<String, String> output_params = {{"is_nullable", output_nullable},
+                                                  {"required_fields", output_table_schema.first},
+                                                  {"columns_types", output_table_schema.second}};
+        jobject output_map = JniUtil::convert_to_java_map(env, output_params);
+        if (jni_ctx->output_map != nullptr) {
+            env->DeleteGlobalRef(jni_ctx->output_map);
+            jni_ctx->output_map = nullptr;
+        }
+        Status st = JniUtil::LocalToGlobalRef(env, output_map, &jni_ctx->output_map);
+        env->DeleteLocalRef(output_map);
+        RETURN_IF_ERROR(st);
+        jni_ctx->schema_arguments = arguments;
+        jni_ctx->schema_result = result;
+    }
     std::map<String, String> input_params = {
             {"meta_address", std::to_string((long)input_table.get())},
-            {"required_fields", input_table_schema.first},
-            {"columns_types", input_table_schema.second}};
+            {"required_fields", jni_ctx->input_table_schema.first},
+            {"columns_types", jni_ctx->input_table_schema.second}};
     jobject input_map = JniUtil::convert_to_java_map(env, input_params);
-    auto output_table_schema = JniConnector::parse_table_schema(&block, {result}, true);
-    std::string output_nullable =
-            block.get_by_position(result).type->is_nullable() ? "true" : "false";
-    std::map<String, String> output_params = {{"is_nullable", output_nullable},
-                                              {"required_fields", output_table_schema.first},
-                                              {"columns_types", output_table_schema.second}};
-    jobject output_map = JniUtil::convert_to_java_map(env, output_params);
     long output_address = env->CallLongMethod(jni_ctx->executor, jni_ctx->executor_evaluate_id,
-                                              input_map, output_map);
-    RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
+                                              input_map, jni_ctx->output_map);
     env->DeleteLocalRef(input_map);
-    env->DeleteLocalRef(output_map);
+    RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
 
     return JniConnector::fill_block(&block, {result}, output_address);
 }
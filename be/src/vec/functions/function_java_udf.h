@@ -125,6 +125,12 @@ private:
         jobject executor = nullptr;
         bool is_closed = false;
         bool open_successes = false;
+        // The schema of the input and output tables only depends on the argument and result
+        // positions, so it is built once instead of for every batch. output_map is a global ref.
+        ColumnNumbers schema_arguments;
+        uint32_t schema_result = 0;
+        std::pair<std::string, std::string> input_table_schema;
+        jobject output_map = nullptr;
 
         JniContext() = default;
 
@@ -144,6 +150,10 @@ private:
                 return status;
             }
             env->CallNonvirtualVoidMethodA(executor, executor_cl, executor_close_id, nullptr);
+            if (output_map != nullptr) {
+                env->DeleteGlobalRef(output_map);
+                output_map = nullptr;
+            }
             env->DeleteGlobalRef(executor);
             env->DeleteGlobalRef(executor_cl);
             RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <cstring>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -27,6 +28,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
@@ -341,6 +343,35 @@ using FunctionJsonbParseNotnullErrorValue =
 using FunctionJsonbParseNotnullErrorInvalid =
         FunctionJsonbParseBase<NullalbeMode::NOT_NULL, JsonbParseErrorMode::RETURN_INVALID>;
 
+// Json paths of the constant path arguments, parsed once when the function is opened.
+struct JsonbExtractPathState {
+    // JsonbPath legs point into the path text, so the state keeps its own copy.
+    std::vector<std::string> path_strs;
+    std::vector<JsonbPath> paths;
+    std::vector<bool> parsed;
+
+    JsonbPath* get(size_t i) { return i < parsed.size() && parsed[i] ? &paths[i] : nullptr; }
+};
+
+// A parsed non-constant path that is reused while the following rows carry the same path
+// text, which is the common case for path columns.
+struct JsonbRowPathCache {
+    JsonbPath path;
+    StringRef path_str;
+    bool valid = false;
+
+    // Returns false if the path text of this row is not a valid json path.
+    bool seek(const char* data, size_t size) {
+        if (valid && path_str.size == size && memcmp(path_str.data, data, size) == 0) {
+            return true;
+        }
+        path.clean();
+        valid = path.seek(data, size);
+        path_str = StringRef(data, size);
+        return valid;
+    }
+};
+
 // func(jsonb, [varchar, varchar, ...]) -> nullable(type)
 template <typename Impl>
 class FunctionJsonbExtract : public IFunction {
@@ -362,9 +393,37 @@ public:
         }
     }
 
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override {
+        if (scope != FunctionContext::FRAGMENT_LOCAL) {
+            return Status::OK();
+        }
+        auto state = std::make_shared<JsonbExtractPathState>();
+        size_t num_paths = context->get_num_args() > 0 ? context->get_num_args() - 1 : 0;
+        state->path_strs.resize(num_paths);
+        state->paths.resize(num_paths);
+        state->parsed.resize(num_paths, false);
+        for (int i = 0; i < static_cast<int>(num_paths); ++i) {
+            if (!context->is_col_constant(i + 1)) {
+                continue;
+            }
+            const auto& path_col = context->get_constant_col(i + 1)->column_ptr;
+            if (path_col->is_null_at(0)) {
+                continue;
+            }
+            state->path_strs[i] = path_col->get_data_at(0).to_string();
+            // An invalid constant path is reported by execute_impl as before.
+            state->parsed[i] = state->paths[i].seek(state->path_strs[i].data(),
+                                                    state->path_strs[i].size());
+        }
+        context->set_function_state(FunctionContext::FRAGMENT_LOCAL, state);
+        return Status::OK();
+    }
+
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         uint32_t result, size_t input_rows_count) const override {
         DCHECK_GE(arguments.size(), 2);
+        auto* path_state = reinterpret_cast<JsonbExtractPathState*>(
+                context->get_function_state(FunctionContext::FRAGMENT_LOCAL));
 
         ColumnPtr jsonb_data_column;
         bool jsonb_data_const = false;
@@ -397,9 +456,10 @@ public:
                       std::is_same_v<typename Impl::ReturnType, DataTypeJsonb>) {
             auto& res_data = res->get_chars();
             auto& res_offsets = res->get_offsets();
-            Status st = Impl::vector_vector_v2(
-                    context, ldata, loffsets, jsonb_data_const, jsonb_path_columns, path_const,
-                    res_data, res_offsets, null_map->get_data(), is_invalid_json_path);
+            Status st = Impl::vector_vector_v2(context, ldata, loffsets, jsonb_data_const,
+                                               jsonb_path_columns, path_const, path_state,
+                                               res_data, res_offsets, null_map->get_data(),
+                                               is_invalid_json_path);
             if (!st.ok()) {
                 return st;
             }
@@ -413,7 +473,8 @@ public:
                                     res->get_data(), null_map->get_data(), is_invalid_json_path);
             } else if (path_const[0]) {
                 Impl::vector_scalar(context, ldata, loffsets, jsonb_path_columns[0]->get_data_at(0),
-                                    res->get_data(), null_map->get_data(), is_invalid_json_path);
+                                    path_state ? path_state->get(0) : nullptr, res->get_data(),
+                                    null_map->get_data(), is_invalid_json_path);
             } else {
                 Impl::vector_vector(context, ldata, loffsets, rdata, roffsets, res->get_data(),
                                     null_map->get_data(), is_invalid_json_path);
@@ -830,8 +891,9 @@ public:
             FunctionContext* context, const ColumnString::Chars& ldata,
             const ColumnString::Offsets& loffsets, const bool& json_data_const,
             const std::vector<const ColumnString*>& rdata_columns, // here we can support more paths
-            const std::vector<bool>& path_const, ColumnString::Chars& res_data,
-            ColumnString::Offsets& res_offsets, NullMap& null_map, bool& is_invalid_json_path) {
+            const std::vector<bool>& path_const, JsonbExtractPathState* path_state,
+            ColumnString::Chars& res_data, ColumnString::Offsets& res_offsets, NullMap& null_map,
+            bool& is_invalid_json_path) {
         size_t input_rows_count = json_data_const ? rdata_columns.size() : loffsets.size();
         res_offsets.resize(input_rows_count);
 
@@ -839,8 +901,10 @@ public:
         std::unique_ptr<JsonbToJson> formater;
 
         // reuseable json path list, espacially for const path
-        std::vector<JsonbPath> json_path_list;
+        std::vector<JsonbRowPathCache> json_path_list;
         json_path_list.resize(rdata_columns.size());
+        // the path used for each path argument, either parsed at open or kept in json_path_list
+        std::vector<JsonbPath*> paths(rdata_columns.size());
 
         // lambda function to parse json path for row i and path pi
         auto parse_json_path = [&](size_t i, size_t pi) -> Status {
@@ -851,23 +915,24 @@ public:
             size_t r_size = roffsets[index_check_const(i, path_const[pi])] - r_off;
             const char* r_raw = reinterpret_cast<const char*>(&rdata[r_off]);
 
-            JsonbPath path;
-            if (!path.seek(r_raw, r_size)) {
+            if (!json_path_list[pi].seek(r_raw, r_size)) {
                 return Status::InvalidArgument(
                         "Json path error: {} for value: {}",
                         JsonbErrMsg::getErrMsg(JsonbErrType::E_INVALID_JSON_PATH),
                         std::string_view(reinterpret_cast<const char*>(rdata.data()),
                                          rdata.size()));
             }
-
-            json_path_list[pi] = std::move(path);
+            paths[pi] = &json_path_list[pi].path;
 
             return Status::OK();
         };
 
         for (size_t pi = 0; pi < rdata_columns.size(); pi++) {
             if (path_const[pi]) {
-                RETURN_IF_ERROR(parse_json_path(0, pi));
+                paths[pi] = path_state ? path_state->get(pi) : nullptr;
+                if (!paths[pi]) {
+                    RETURN_IF_ERROR(parse_json_path(0, pi));
+                }
             }
         }
 
@@ -884,7 +949,7 @@ public:
                     RETURN_IF_ERROR(parse_json_path(i, 0));
                 }
                 inner_loop_impl(i, res_data, res_offsets, null_map, writer, formater, l_raw, l_size,
-                                json_path_list[0]);
+                                *paths[0]);
             } else { // will make array string to user
                 writer->reset();
                 writer->writeStartArray();
@@ -903,7 +968,7 @@ public:
                     }
 
                     // value is NOT necessary to be deleted since JsonbValue will not allocate memory
-                    JsonbValue* value = doc->getValue()->findValue(json_path_list[pi], nullptr);
+                    JsonbValue* value = doc->getValue()->findValue(*paths[pi], nullptr);
 
                     if (UNLIKELY(!value)) {
                         writer->writeNull();
@@ -935,6 +1000,7 @@ public:
         }
 
         std::unique_ptr<JsonbToJson> formater;
+        JsonbRowPathCache path_cache;
 
         for (size_t i = 0; i < input_rows_count; ++i) {
             int l_size = loffsets[i] - loffsets[i - 1];
@@ -943,15 +1009,14 @@ public:
             int r_size = roffsets[i] - roffsets[i - 1];
             const char* r_raw = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
 
-            JsonbPath path;
-            if (!path.seek(r_raw, r_size)) {
+            if (!path_cache.seek(r_raw, r_size)) {
                 is_invalid_json_path = true;
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
                 return;
             }
 
             inner_loop_impl(i, res_data, res_offsets, null_map, writer, formater, l_raw, l_size,
-                            path);
+                            path_cache.path);
         } //for
     }     //function
     static void vector_scalar(FunctionContext* context, const ColumnString::Chars& ldata,
@@ -996,20 +1061,20 @@ public:
         }
 
         std::unique_ptr<JsonbToJson> formater;
+        JsonbRowPathCache path_cache;
 
         for (size_t i = 0; i < input_rows_count; ++i) {
             int r_size = roffsets[i] - roffsets[i - 1];
             const char* r_raw = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
 
-            JsonbPath path;
-            if (!path.seek(r_raw, r_size)) {
+            if (!path_cache.seek(r_raw, r_size)) {
                 is_invalid_json_path = true;
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
                 return;
             }
 
             inner_loop_impl(i, res_data, res_offsets, null_map, writer, formater, ldata.data,
-                            ldata.size, path);
+                            ldata.size, path_cache.path);
         } //for
     }     //function
 };
@@ -1118,6 +1183,7 @@ public:
                               NullMap& null_map, bool& is_invalid_json_path) {
         size_t size = loffsets.size();
         res.resize(size);
+        JsonbRowPathCache path_cache;
 
         for (size_t i = 0; i < loffsets.size(); i++) {
             if constexpr (only_check_exists) {
@@ -1130,14 +1196,13 @@ public:
             const char* r_raw_str = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
             int r_str_size = roffsets[i] - roffsets[i - 1];
 
-            JsonbPath path;
-            if (!path.seek(r_raw_str, r_str_size)) {
+            if (!path_cache.seek(r_raw_str, r_str_size)) {
                 is_invalid_json_path = true;
                 res[i] = 0;
                 return;
             }
 
-            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, path);
+            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, path_cache.path);
         } //for
     }     //function
     static void scalar_vector(FunctionContext* context, const StringRef& ldata,
@@ -1146,6 +1211,7 @@ public:
                               NullMap& null_map, bool& is_invalid_json_path) {
         size_t size = roffsets.size();
         res.resize(size);
+        JsonbRowPathCache path_cache;
 
         for (size_t i = 0; i < size; i++) {
             if constexpr (only_check_exists) {
@@ -1155,26 +1221,29 @@ public:
             const char* r_raw_str = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
             int r_str_size = roffsets[i] - roffsets[i - 1];
 
-            JsonbPath path;
-            if (!path.seek(r_raw_str, r_str_size)) {
+            if (!path_cache.seek(r_raw_str, r_str_size)) {
                 is_invalid_json_path = true;
                 res[i] = 0;
                 return;
             }
 
-            inner_loop_impl(i, res, null_map, ldata.data, ldata.size, path);
+            inner_loop_impl(i, res, null_map, ldata.data, ldata.size, path_cache.path);
         } //for
     }     //function
     static void vector_scalar(FunctionContext* context, const ColumnString::Chars& ldata,
                               const ColumnString::Offsets& loffsets, const StringRef& rdata,
-                              Container& res, NullMap& null_map, bool& is_invalid_json_path) {
+                              JsonbPath* const_path, Container& res, NullMap& null_map,
+                              bool& is_invalid_json_path) {
         size_t size = loffsets.size();
         res.resize(size);
 
-        JsonbPath path;
-        if (!path.seek(rdata.data, rdata.size)) {
-            is_invalid_json_path = true;
-            return;
+        JsonbPath parsed_path;
+        if (!const_path) {
+            if (!parsed_path.seek(rdata.data, rdata.size)) {
+                is_invalid_json_path = true;
+                return;
+            }
+            const_path = &parsed_path;
         }
 
         for (size_t i = 0; i < loffsets.size(); i++) {
@@ -1184,8 +1253,10 @@ public:
 
             const char* l_raw_str = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
             int l_str_size = loffsets[i] - loffsets[i - 1];
+            // the document header of the next row is read right after this one
+            __builtin_prefetch(&ldata[loffsets[i]]);
 
-            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, path);
+            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, *const_path);
         } //for
     }     //function
 };
@@ -144,6 +144,13 @@ struct StringUtf8LengthImpl {
                          PaddedPODArray<Int32>& res) {
         auto size = offsets.size();
         res.resize(size);
+        // An all-ASCII column needs no per-row counting: every byte is one char.
+        if (simd::VStringFunctions::is_ascii({data.data(), data.size()})) {
+            for (int i = 0; i < size; ++i) {
+                res[i] = offsets[i] - offsets[i - 1];
+            }
+            return Status::OK();
+        }
         for (int i = 0; i < size; ++i) {
             const char* raw_str = reinterpret_cast<const char*>(&data[offsets[i - 1]]);
             int str_size = offsets[i] - offsets[i - 1];
@@ -67,15 +67,6 @@
 #include "vec/data_types/data_type.h"
 #include "vec/utils/template_helpers.hpp"
 
-#ifndef USE_LIBCPP
-#include <memory_resource>
-#define PMR std::pmr
-#else
-#include <boost/container/pmr/monotonic_buffer_resource.hpp>
-#include <boost/container/pmr/vector.hpp>
-#define PMR boost::container::pmr
-#endif
-
 #include <fmt/format.h>
 
 #include <cstdint>
@@ -215,10 +206,6 @@ private:
         res_offsets.resize(size);
         res_chars.reserve(chars.size());
 
-        std::array<std::byte, 128 * 1024> buf;
-        PMR::monotonic_buffer_resource pool {buf.data(), buf.size()};
-        PMR::vector<size_t> index {&pool};
-
         if constexpr (is_const) {
             if (start[0] == 0 || len[0] <= 0) {
                 for (size_t i = 0; i < size; ++i) {
@@ -242,32 +229,20 @@ private:
                 continue;
             }
 
-            size_t byte_pos = 0;
-            index.clear();
-            for (size_t j = 0, char_size = 0; j < str_size; j += char_size) {
-                char_size = get_utf8_byte_length(str_data[j]);
-                index.push_back(j);
-                // index_size represents the number of characters from the beginning of the character to the current position.
-                // So index.size() > start_value + len_value breaks because you don't need to get the characters after start + len characters.
-                if (start_value > 0 && index.size() > start_value + len_value) {
-                    break;
-                }
-            }
-
             int fixed_pos = start_value;
-            if (fixed_pos < -(int)index.size()) {
+            if (fixed_pos < -char_len) {
                 StringOP::push_empty_string(i, res_chars, res_offsets);
                 continue;
             }
             if (fixed_pos < 0) {
-                fixed_pos = index.size() + fixed_pos + 1;
+                fixed_pos = char_len + fixed_pos + 1;
             }
 
-            byte_pos = index[fixed_pos - 1];
-            size_t fixed_len = str_size - byte_pos;
-            if (fixed_pos + len_value <= index.size()) {
-                fixed_len = index[fixed_pos + len_value - 1] - byte_pos;
-            }
+            // Locate the first and the last byte with block-wise char skipping instead of
+            // recording the byte offset of every char.
+            size_t byte_pos = simd::VStringFunctions::skip_chars(str_data, str_size, fixed_pos - 1);
+            size_t fixed_len = simd::VStringFunctions::skip_chars(
+                    str_data + byte_pos, str_size - byte_pos, len_value);
 
             if (byte_pos <= str_size && fixed_len > 0) {
                 StringOP::push_value_string_reserved_and_allow_overflow(
@@ -3382,8 +3357,7 @@ private:
         // Hive returns 0 for *start_pos <= 0,
         // but throws an exception for *start_pos > str->len.
         // Since returning 0 seems to be Hive's error condition, return 0.
-        std::vector<size_t> index;
-        size_t char_len = simd::VStringFunctions::get_char_len(str.data, str.size, index);
+        size_t char_len = simd::VStringFunctions::get_char_len(str.data, str.size);
         if (start_pos <= 0 || start_pos > str.size || start_pos > char_len) {
             return 0;
         }
@@ -3391,7 +3365,8 @@ private:
             search_ptr.reset(new StringSearch(&substr));
         }
         // Input start_pos starts from 1.
-        StringRef adjusted_str(str.data + index[start_pos - 1], str.size - index[start_pos - 1]);
+        size_t start_byte = simd::VStringFunctions::skip_chars(str.data, str.size, start_pos - 1);
+        StringRef adjusted_str(str.data + start_byte, str.size - start_byte);
         int32_t match_pos = search_ptr->search(&adjusted_str);
         if (match_pos >= 0) {
             // Hive returns the position in the original string starting from 1.
@@ -41,6 +41,7 @@
 #include "util/datetype_cast.hpp"
 #include "util/time.h"
 #include "util/time_lut.h"
+#include "util/timezone_offset_cache.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
@@ -613,6 +614,8 @@ struct UnixTimeStampDateImpl {
         const ColumnPtr& col = block.get_by_position(arguments[0]).column;
         DCHECK(!col->is_nullable());
 
+        TimezoneOffsetCache tz_cache(context->state()->timezone_obj());
+
         if constexpr (std::is_same_v<DateType, DataTypeDate> ||
                       std::is_same_v<DateType, DataTypeDateTime>) {
             const auto* col_source = assert_cast<const ColumnDate*>(col.get());
@@ -624,7 +627,7 @@ struct UnixTimeStampDateImpl {
                 StringRef source = col_source->get_data_at(i);
                 const auto& ts_value = reinterpret_cast<const VecDateTimeValue&>(*source.data);
                 int64_t timestamp {};
-                ts_value.unix_timestamp(&timestamp, context->state()->timezone_obj());
+                ts_value.unix_timestamp(&timestamp, tz_cache);
                 col_result_data[i] = UnixTimeStampImpl::trim_timestamp(timestamp);
             }
             block.replace_by_position(result, std::move(col_result));
@@ -639,8 +642,7 @@ struct UnixTimeStampDateImpl {
                 const auto& ts_value =
                         reinterpret_cast<const DateV2Value<DateV2ValueType>&>(*source.data);
                 int64_t timestamp {};
-                const auto valid =
-                        ts_value.unix_timestamp(&timestamp, context->state()->timezone_obj());
+                const auto valid = ts_value.unix_timestamp(&timestamp, tz_cache);
                 DCHECK(valid);
                 col_result_data[i] = UnixTimeStampImpl::trim_timestamp(timestamp);
             }
@@ -657,8 +659,7 @@ struct UnixTimeStampDateImpl {
                 const auto& ts_value =
                         reinterpret_cast<const DateV2Value<DateTimeV2ValueType>&>(*source.data);
                 std::pair<int64_t, int64_t> timestamp {};
-                const auto valid =
-                        ts_value.unix_timestamp(&timestamp, context->state()->timezone_obj());
+                const auto valid = ts_value.unix_timestamp(&timestamp, tz_cache);
                 DCHECK(valid);
 
                 auto& [sec, ms] = timestamp;
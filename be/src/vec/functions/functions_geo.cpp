@@ -679,26 +679,41 @@ struct StContains {
         }
     }
 
-    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
-                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        int i;
-        auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::shared_ptr<GeoShape>> shapes = {nullptr, nullptr};
+    // The constant shape is decoded only once, so a polygon of a geofencing query also builds
+    // its S2 index once, instead of once per row.
+    template <bool const_is_lhs>
+    static void const_shape_contains(const ColumnPtr& const_column,
+                                     const ColumnPtr& vector_column, ColumnUInt8::MutablePtr& res,
+                                     NullMap& null_map, const size_t size) {
+        auto const_value = const_column->get_data_at(0);
+        auto const_geo = GeoShape::from_encoded(const_value.data, const_value.size);
+        if (const_geo == nullptr) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            res->insert_many_defaults(size);
+            return;
+        }
         for (int row = 0; row < size; ++row) {
-            auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, i, res, null_map, row);
+            auto value = vector_column->get_data_at(row);
+            auto shape = GeoShape::from_encoded(value.data, value.size);
+            if (shape == nullptr) {
+                null_map[row] = 1;
+                res->insert_default();
+                continue;
+            }
+            auto contains_value = const_is_lhs ? const_geo->contains(shape.get())
+                                               : shape->contains(const_geo.get());
+            res->insert_value(contains_value);
         }
     }
 
+    static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
+                             ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
+        const_shape_contains<true>(left_column, right_column, res, null_map, size);
+    }
+
     static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
-        int i;
-        auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::shared_ptr<GeoShape>> shapes = {nullptr, nullptr};
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, i, res, null_map, row);
-        }
+        const_shape_contains<false>(right_column, left_column, res, null_map, size);
     }
 
     static void vector_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
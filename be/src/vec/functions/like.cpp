@@ -763,6 +763,11 @@ void FunctionLike::convert_like_pattern(LikeSearchState* state, const std::strin
     }
 }
 
+void FunctionLike::like_pattern_to_regex(const std::string& pattern, std::string* re_pattern) {
+    LikeSearchState state;
+    convert_like_pattern(&state, pattern, re_pattern);
+}
+
 void FunctionLike::remove_escape_character(std::string* search_string) {
     std::string tmp_search_string;
     tmp_search_string.swap(*search_string);
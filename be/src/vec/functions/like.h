@@ -260,6 +260,10 @@ public:
                                              std::shared_ptr<LikeState>& state,
                                              bool try_hyperscan = true);
 
+    // Translates a LIKE pattern with the default escape character into the regex used on the
+    // hyperscan path.
+    static void like_pattern_to_regex(const std::string& pattern, std::string* re_pattern);
+
     friend struct LikeSearchState;
     friend struct VectorAllpassSearchState;
     friend struct VectorEqualSearchState;
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/multi_pattern_like.h"
+
+#include <hs/hs_runtime.h>
+
+#include "common/exception.h"
+#include "vec/functions/like.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+int on_match(unsigned int /* id */, unsigned long long /* from */, // NOLINT
+             unsigned long long /* to */, unsigned int /* flags */, void* context) {
+    *reinterpret_cast<UInt8*>(context) = 1;
+    // one matching pattern decides the row
+    return 1;
+}
+
+} // namespace
+
+Status MultiPatternLikeMatcher::create(const std::vector<Pattern>& patterns,
+                                       std::shared_ptr<MultiPatternLikeMatcher>* matcher) {
+    std::vector<std::string> regexes;
+    regexes.reserve(patterns.size());
+    for (const auto& pattern : patterns) {
+        if (pattern.is_like) {
+            regexes.emplace_back();
+            FunctionLike::like_pattern_to_regex(pattern.pattern, &regexes.back());
+        } else {
+            regexes.push_back(pattern.pattern);
+        }
+    }
+    std::vector<StringRef> refs(regexes.begin(), regexes.end());
+
+    auto result = std::make_shared<MultiPatternLikeMatcher>();
+    try {
+        result->_deferred_regexps = multiregexps::getOrSet<false, false>(refs, std::nullopt);
+        result->_regexps = result->_deferred_regexps->get();
+    } catch (const Exception& e) {
+        return e.to_status();
+    }
+    result->_num_patterns = patterns.size();
+    *matcher = std::move(result);
+    return Status::OK();
+}
+
+Status MultiPatternLikeMatcher::match(const ColumnString& strings,
+                                      ColumnUInt8::Container& res) const {
+    DCHECK_EQ(res.size(), strings.size());
+    hs_scratch_t* scratch = nullptr;
+    if (hs_clone_scratch(_regexps->getScratch(), &scratch) != HS_SUCCESS) {
+        return Status::InternalError("could not clone scratch space for hyperscan");
+    }
+    multiregexps::ScratchPtr smart_scratch(scratch);
+
+    const auto& chars = strings.get_chars();
+    const auto& offsets = strings.get_offsets();
+    for (size_t i = 0; i < strings.size(); ++i) {
+        const size_t begin = offsets[i - 1];
+        hs_error_t err = hs_scan(_regexps->getDB(), reinterpret_cast<const char*>(&chars[begin]),
+                                 static_cast<unsigned>(offsets[i] - begin), 0, scratch, on_match,
+                                 &res[i]);
+        if (err != HS_SUCCESS && err != HS_SCAN_TERMINATED) {
+            return Status::InternalError("failed to scan with hyperscan, error {}", err);
+        }
+    }
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
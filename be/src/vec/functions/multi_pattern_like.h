@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/functions/regexps.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// Evaluates `s LIKE p1 OR s LIKE p2 OR s REGEXP p3 ...` in one pass. The patterns are compiled
+// into one hyperscan database, so every string is scanned once instead of once per pattern.
+// LIKE patterns are translated the same way FunctionLike does for its hyperscan path.
+class MultiPatternLikeMatcher {
+public:
+    struct Pattern {
+        std::string pattern;
+        bool is_like = true;
+    };
+
+    // Fails if the patterns can not be compiled together, e.g. a REGEXP construct hyperscan
+    // does not support; callers then evaluate the predicates one by one.
+    static Status create(const std::vector<Pattern>& patterns,
+                         std::shared_ptr<MultiPatternLikeMatcher>* matcher);
+
+    // Sets `res[i]` to 1 if the i-th string of `strings` matches any pattern. `res` must be
+    // sized to the column and zero filled.
+    Status match(const ColumnString& strings, ColumnUInt8::Container& res) const;
+
+    size_t num_patterns() const { return _num_patterns; }
+
+private:
+    // the database is shared by all threads, the scratch is cloned for every match() call
+    multiregexps::Regexps* _regexps = nullptr;
+    multiregexps::DeferredConstructedRegexpsPtr _deferred_regexps;
+    size_t _num_patterns = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
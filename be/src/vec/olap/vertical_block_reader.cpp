@@ -109,6 +109,27 @@ Status VerticalBlockReader::_get_segment_iterators(const ReaderParams& read_para
     return Status::OK();
 }
 
+bool VerticalBlockReader::_rowsets_mono_asc_disjoint(const ReaderParams& read_params) const {
+    std::string cur_rs_last_key;
+    for (const auto& rs_split : read_params.rs_splits) {
+        const auto& rowset = rs_split.rs_reader->rowset();
+        if (rowset->num_rows() == 0) {
+            continue;
+        }
+        if (rowset->is_segments_overlapping()) {
+            return false;
+        }
+        std::string rs_first_key;
+        if (!rowset->first_key(&rs_first_key) || rs_first_key <= cur_rs_last_key) {
+            return false;
+        }
+        if (!rowset->last_key(&cur_rs_last_key)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 Status VerticalBlockReader::_init_collect_iter(const ReaderParams& read_params,
                                                CompactionSampleInfo* sample_info) {
     std::vector<bool> iterator_init_flag;
@@ -143,7 +164,14 @@ Status VerticalBlockReader::_init_collect_iter(const ReaderParams& read_params,
             read_params.tablet->tablet_schema()->cluster_key_uids().empty()) {
             seq_col_idx = read_params.tablet->tablet_schema()->sequence_col_idx();
         }
-        if (read_params.tablet->tablet_schema()->num_key_columns() == 0) {
+        // Duplicate key rows never merge, so when the input rowsets are already globally
+        // ordered the heap only costs key comparisons: read the segments one after another.
+        bool passthrough = config::enable_vertical_compaction_disjoint_passthrough &&
+                           read_params.segment_iters_ptr == nullptr &&
+                           read_params.tablet->keys_type() == KeysType::DUP_KEYS &&
+                           read_params.key_group_cluster_key_idxes.empty() &&
+                           _rowsets_mono_asc_disjoint(read_params);
+        if (read_params.tablet->tablet_schema()->num_key_columns() == 0 || passthrough) {
             _vcollect_iter = new_vertical_fifo_merge_iterator(
                     std::move(*segment_iters_ptr), iterator_init_flag, rowset_ids,
                     ori_return_col_size, read_params.tablet->keys_type(), seq_col_idx,
@@ -82,6 +82,10 @@ private:
 
     Status _init_collect_iter(const ReaderParams& read_params, CompactionSampleInfo* sample_info);
 
+    // Return true if every input rowset is non-overlapping and each one starts after the last
+    // key of the previous one, i.e. concatenating segments in order already yields sorted keys.
+    bool _rowsets_mono_asc_disjoint(const ReaderParams& read_params) const;
+
     Status _get_segment_iterators(const ReaderParams& read_params,
                                   std::vector<RowwiseIteratorUPtr>* segment_iters,
                                   std::vector<bool>* iterator_init_flag,
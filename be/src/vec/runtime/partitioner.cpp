@@ -48,6 +48,9 @@ Status Crc32HashPartitioner<ChannelIds>::do_partitioning(RuntimeState* state, Bl
             _do_hash(col, hashes, j);
         }
 
+        if (_keep_hash_values) {
+            _origin_hash_vals.assign(hashes, hashes + rows);
+        }
         for (size_t i = 0; i < rows; i++) {
             hashes[i] = ChannelIds()(hashes[i], _partition_count);
         }
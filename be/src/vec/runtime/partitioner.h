@@ -83,6 +83,11 @@ public:
 
     Status clone(RuntimeState* state, std::unique_ptr<PartitionerBase>& partitioner) override;
 
+    // Keep the hash values of rows before they are mapped to channel ids, so rows of the same key
+    // can be recognized (e.g. hot join keys in local exchange).
+    void set_keep_hash_values(bool keep_hash_values) { _keep_hash_values = keep_hash_values; }
+    const std::vector<uint32_t>& hash_values() const { return _origin_hash_vals; }
+
 protected:
     Status _get_partition_column_result(Block* block, std::vector<int>& result) const {
         int counter = 0;
@@ -96,6 +101,8 @@ protected:
 
     VExprContextSPtrs _partition_expr_ctxs;
     mutable std::vector<uint32_t> _hash_vals;
+    bool _keep_hash_values = false;
+    mutable std::vector<uint32_t> _origin_hash_vals;
 };
 
 struct ShuffleChannelIds {
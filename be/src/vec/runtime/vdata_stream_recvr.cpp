@@ -26,6 +26,7 @@
 #include <functional>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/exec/exchange_source_operator.h"
@@ -33,6 +34,7 @@
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/core/materialize_block.h"
@@ -113,24 +115,46 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
         }
     }
 
+    // The bytes of the consumed block are the credits given back to the senders. Besides the
+    // head one, wake up as many delayed senders as the queue has room for, so a large consumed
+    // block does not leave senders of small blocks waiting until their rpcs time out.
     if (!_pending_closures.empty()) {
-        auto closure_pair = _pending_closures.front();
-        closure_pair.first->Run();
-        int64_t elapse_time = closure_pair.second.elapsed_time();
-        if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
-            _recvr->_max_wait_to_process_time->set(elapse_time);
+        _release_pending_closure_without_lock();
+        while (!_pending_closures.empty() && !_recvr->exceeds_limit(0)) {
+            _release_pending_closure_without_lock();
         }
-        _pending_closures.pop_front();
-
-        closure_pair.second.stop();
-        _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
     }
+    _release_expired_closures_without_lock();
     DCHECK(block->empty());
     block->swap(*next_block);
     *eos = false;
     return Status::OK();
 }
 
+void VDataStreamRecvr::SenderQueue::_release_pending_closure_without_lock() {
+    auto closure_pair = _pending_closures.front();
+    closure_pair.first->Run();
+    int64_t elapse_time = closure_pair.second.elapsed_time();
+    if (_recvr->_max_wait_to_process_time->value() < elapse_time) {
+        _recvr->_max_wait_to_process_time->set(elapse_time);
+    }
+    _pending_closures.pop_front();
+
+    closure_pair.second.stop();
+    _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
+}
+
+void VDataStreamRecvr::SenderQueue::_release_expired_closures_without_lock() {
+    if (config::exchange_max_response_delay_ms <= 0) {
+        return;
+    }
+    const auto max_delay_ns = config::exchange_max_response_delay_ms * NANOS_PER_MILLIS;
+    while (!_pending_closures.empty() &&
+           _pending_closures.front().second.elapsed_time() >= max_delay_ns) {
+        _release_pending_closure_without_lock();
+    }
+}
+
 void VDataStreamRecvr::SenderQueue::try_set_dep_ready_without_lock() {
     if (!_source_dependency) {
         return;
@@ -191,6 +215,8 @@ Status VDataStreamRecvr::SenderQueue::add_block(std::unique_ptr<PBlock> pblock,
     _record_debug_info();
     try_set_dep_ready_without_lock();
 
+    // a sender waiting too long for the response may time out while the receiver is skewed
+    _release_expired_closures_without_lock();
     // if done is nullptr, this function can't delay this response
     if (done != nullptr && _recvr->exceeds_limit(block_byte_size)) {
         MonotonicStopWatch monotonicStopWatch;
@@ -206,6 +206,11 @@ public:
 protected:
     friend class pipeline::ExchangeLocalState;
     void try_set_dep_ready_without_lock();
+    // Respond to the front delayed transmit_block rpc, which grants its sender the credit to
+    // send the next block.
+    void _release_pending_closure_without_lock();
+    // Respond to the delayed rpcs which waited longer than exchange_max_response_delay_ms.
+    void _release_expired_closures_without_lock();
 
     // To record information about several variables in the event of a DCHECK failure.
     //  DCHECK(_is_cancelled || !_block_queue.empty() || _num_remaining_senders == 0)
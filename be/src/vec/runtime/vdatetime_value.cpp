@@ -38,6 +38,7 @@
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
+#include "util/timezone_offset_cache.h"
 #include "util/timezone_utils.h"
 #include "vec/common/int_exp.h"
 
@@ -1763,6 +1764,12 @@ bool VecDateTimeValue::unix_timestamp(int64_t* timestamp, const cctz::time_zone&
     return true;
 }
 
+bool VecDateTimeValue::unix_timestamp(int64_t* timestamp, TimezoneOffsetCache& tz_cache) const {
+    *timestamp =
+            tz_cache.from_civil(cctz::civil_second(_year, _month, _day, _hour, _minute, _second));
+    return true;
+}
+
 bool VecDateTimeValue::from_unixtime(int64_t timestamp, const std::string& timezone) {
     cctz::time_zone ctz;
     if (!TimezoneUtils::find_cctz_time_zone(timezone, ctz)) {
@@ -1792,6 +1799,19 @@ void VecDateTimeValue::from_unixtime(int64_t timestamp, const cctz::time_zone& c
     _second = tp.second();
 }
 
+void VecDateTimeValue::from_unixtime(int64_t timestamp, TimezoneOffsetCache& tz_cache) {
+    const auto tp = tz_cache.to_civil(timestamp);
+
+    _neg = 0;
+    _type = TIME_DATETIME;
+    _year = tp.year();
+    _month = tp.month();
+    _day = tp.day();
+    _hour = tp.hour();
+    _minute = tp.minute();
+    _second = tp.second();
+}
+
 const char* VecDateTimeValue::month_name() const {
     if (_month < 1 || _month > 12) {
         return nullptr;
@@ -3233,6 +3253,33 @@ bool DateV2Value<T>::unix_timestamp(int64_t* timestamp, const cctz::time_zone& c
     }
 }
 
+template <typename T>
+bool DateV2Value<T>::unix_timestamp(int64_t* timestamp, TimezoneOffsetCache& tz_cache) const {
+    if constexpr (is_datetime) {
+        *timestamp = tz_cache.from_civil(cctz::civil_second(
+                date_v2_value_.year_, date_v2_value_.month_, date_v2_value_.day_,
+                date_v2_value_.hour_, date_v2_value_.minute_, date_v2_value_.second_));
+    } else {
+        *timestamp = tz_cache.from_civil(cctz::civil_second(
+                date_v2_value_.year_, date_v2_value_.month_, date_v2_value_.day_, 0, 0, 0));
+    }
+    return true;
+}
+
+template <typename T>
+bool DateV2Value<T>::unix_timestamp(std::pair<int64_t, int64_t>* timestamp,
+                                    TimezoneOffsetCache& tz_cache) const {
+    DCHECK(is_datetime) << "Function unix_timestamp with double_t timestamp only support "
+                           "datetimev2 value type.";
+    if constexpr (is_datetime) {
+        timestamp->first = tz_cache.from_civil(cctz::civil_second(
+                date_v2_value_.year_, date_v2_value_.month_, date_v2_value_.day_,
+                date_v2_value_.hour_, date_v2_value_.minute_, date_v2_value_.second_));
+        timestamp->second = date_v2_value_.microsecond_;
+    }
+    return true;
+}
+
 template <typename T>
 bool DateV2Value<T>::unix_timestamp(std::pair<int64_t, int64_t>* timestamp,
                                     const std::string& timezone) const {
@@ -3309,6 +3356,20 @@ void DateV2Value<T>::from_unixtime(std::pair<int64_t, int64_t> timestamp,
                        timestamp.second);
 }
 
+template <typename T>
+void DateV2Value<T>::from_unixtime(int64_t timestamp, TimezoneOffsetCache& tz_cache) {
+    const auto tp = tz_cache.to_civil(timestamp);
+    unchecked_set_time(tp.year(), tp.month(), tp.day(), tp.hour(), tp.minute(), tp.second(), 0);
+}
+
+template <typename T>
+void DateV2Value<T>::from_unixtime(std::pair<int64_t, int64_t> timestamp,
+                                   TimezoneOffsetCache& tz_cache) {
+    const auto tp = tz_cache.to_civil(timestamp.first);
+    unchecked_set_time(tp.year(), tp.month(), tp.day(), tp.hour(), tp.minute(), tp.second(),
+                       timestamp.second);
+}
+
 template <typename T>
 bool DateV2Value<T>::from_unixtime(int64_t timestamp, int32_t nano_seconds,
                                    const std::string& timezone, const int scale) {
@@ -49,6 +49,8 @@ class DataTypeDateTimeV2;
 
 namespace doris {
 
+class TimezoneOffsetCache;
+
 enum TimeUnit {
     MICROSECOND,
     MILLISECOND,
@@ -520,12 +522,15 @@ public:
     //it returns seconds of the value of date literal since '1970-01-01 00:00:00' UTC
     bool unix_timestamp(int64_t* timestamp, const std::string& timezone) const;
     bool unix_timestamp(int64_t* timestamp, const cctz::time_zone& ctz) const;
+    // same as above, for loops converting many values of one timezone
+    bool unix_timestamp(int64_t* timestamp, TimezoneOffsetCache& tz_cache) const;
 
     //construct datetime_value from timestamp and timezone
     //timestamp is an internal timestamp value representing seconds since '1970-01-01 00:00:00' UTC. negative avaliable.
     //we don't do any check in it because it's hot path. any usage want ensure the time legality should check itself.
     bool from_unixtime(int64_t, const std::string& timezone);
     void from_unixtime(int64_t, const cctz::time_zone& ctz);
+    void from_unixtime(int64_t, TimezoneOffsetCache& tz_cache);
 
     bool operator==(const VecDateTimeValue& other) const {
         // NOTE: This is not same with MySQL.
@@ -1016,6 +1021,10 @@ public:
     //the first arg is result of fixed point
     bool unix_timestamp(std::pair<int64_t, int64_t>* timestamp, const std::string& timezone) const;
     bool unix_timestamp(std::pair<int64_t, int64_t>* timestamp, const cctz::time_zone& ctz) const;
+    // same as above, for loops converting many values of one timezone
+    bool unix_timestamp(int64_t* timestamp, TimezoneOffsetCache& tz_cache) const;
+    bool unix_timestamp(std::pair<int64_t, int64_t>* timestamp,
+                        TimezoneOffsetCache& tz_cache) const;
 
     //construct datetime_value from timestamp and timezone
     //timestamp is an internal timestamp value representing seconds since '1970-01-01 00:00:00' UTC. negative avaliable.
@@ -1026,6 +1035,8 @@ public:
     void from_unixtime(std::pair<int64_t, int64_t>, const cctz::time_zone& ctz);
     bool from_unixtime(int64_t, int32_t, const std::string& timezone, int scale);
     void from_unixtime(int64_t, int32_t, const cctz::time_zone& ctz, int scale);
+    void from_unixtime(int64_t, TimezoneOffsetCache& tz_cache);
+    void from_unixtime(std::pair<int64_t, int64_t>, TimezoneOffsetCache& tz_cache);
 
     bool operator==(const DateV2Value<T>& other) const {
         // NOTE: This is not same with MySQL.
@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vsorted_run_merger.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,33 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+void MergeSortLoserTree::init(std::vector<MergeSortCursor> cursors,
+                              const std::vector<bool>& active) {
+    DCHECK_EQ(cursors.size(), active.size());
+    _leaves = std::move(cursors);
+    _active = active;
+    _num_active = static_cast<size_t>(std::count(_active.begin(), _active.end(), true));
+    _winner = 0;
+    size_t k = _leaves.size();
+    if (k <= 1) {
+        return;
+    }
+    // play the initial tournament bottom-up, winners[k + j] is leaf j
+    std::vector<size_t> winners(2 * k);
+    _losers.assign(k, 0);
+    for (size_t j = 0; j < k; ++j) {
+        winners[k + j] = j;
+    }
+    for (size_t node = k - 1; node > 0; --node) {
+        size_t lhs = winners[2 * node];
+        size_t rhs = winners[2 * node + 1];
+        bool lhs_wins = _beats(lhs, rhs);
+        winners[node] = lhs_wins ? lhs : rhs;
+        _losers[node] = lhs_wins ? rhs : lhs;
+    }
+    _winner = winners[1];
+}
+
 VSortedRunMerger::VSortedRunMerger(const VExprContextSPtrs& ordering_expr,
                                    const std::vector<bool>& is_asc_order,
                                    const std::vector<bool>& nulls_first, const size_t batch_size,
@@ -76,11 +104,15 @@ Status VSortedRunMerger::prepare(const std::vector<BlockSupplier>& input_runs) {
         return Status::Cancelled(e.what());
     }
 
-    for (auto& _cursor : _cursors) {
-        if (!_cursor->_is_eof) {
-            _priority_queue.push(MergeSortCursor(_cursor));
-        }
+    std::vector<MergeSortCursor> leaves;
+    std::vector<bool> active;
+    leaves.reserve(_cursors.size());
+    active.reserve(_cursors.size());
+    for (auto& cursor : _cursors) {
+        leaves.emplace_back(cursor);
+        active.push_back(!cursor->_is_eof);
     }
+    _loser_tree.init(std::move(leaves), active);
 
     return Status::OK();
 }
@@ -91,12 +123,13 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     // copy the data of block.
     // return the data in receive data directly
 
-    if (_pending_cursor != nullptr) {
-        MergeSortCursor cursor(_pending_cursor);
-        if (has_next_block(cursor)) {
-            _priority_queue.push(cursor);
+    if (_top_pending) {
+        if (has_next_block(_loser_tree.top())) {
+            _loser_tree.update_top();
+        } else {
+            _loser_tree.remove_top();
         }
-        _pending_cursor = nullptr;
+        _top_pending = false;
     }
 
     Defer set_limit([&]() {
@@ -107,16 +140,15 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         }
     });
 
-    if (_priority_queue.empty()) {
+    if (_loser_tree.empty()) {
         *eos = true;
         return Status::OK();
-    } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    } else if (_loser_tree.size() == 1) {
+        auto& current = _loser_tree.top();
         while (_offset != 0 && current->block_ptr() != nullptr) {
             if (_offset >= current->rows - current->pos) {
                 _offset -= (current->rows - current->pos);
-                _pending_cursor = current.impl;
-                _priority_queue.pop();
+                set_top_pending();
                 return Status::OK();
             } else {
                 current->pos += _offset;
@@ -127,8 +159,7 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
         if (current->is_first()) {
             if (current->block_ptr() != nullptr) {
                 current->block_ptr()->swap(*output_block);
-                _pending_cursor = current.impl;
-                _priority_queue.pop();
+                set_top_pending();
                 return Status::OK();
             } else {
                 *eos = true;
@@ -141,17 +172,16 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                             current->pos, current->rows - current->pos);
                 }
                 current->block_ptr()->swap(*output_block);
-                _pending_cursor = current.impl;
-                _priority_queue.pop();
+                set_top_pending();
                 return Status::OK();
             } else {
                 *eos = true;
             }
         }
     } else {
-        size_t num_columns = _priority_queue.top().impl->block->columns();
+        size_t num_columns = _loser_tree.top().impl->block->columns();
         MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(
-                output_block, *_priority_queue.top().impl->block);
+                output_block, *_loser_tree.top().impl->block);
         MutableColumns& merged_columns = m_block.mutable_columns();
 
         if (num_columns != merged_columns.size()) {
@@ -179,9 +209,8 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 
         /// Take rows from queue in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
+        while (merged_rows != _batch_size && !_loser_tree.empty()) {
+            auto& current = _loser_tree.top();
 
             if (_offset > 0) {
                 _offset--;
@@ -211,11 +240,11 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 bool VSortedRunMerger::next_heap(MergeSortCursor& current) {
     if (!current->is_last()) {
         current->next();
-        _priority_queue.push(current);
+        _loser_tree.update_top();
         return true;
     }
 
-    _pending_cursor = current.impl;
+    set_top_pending();
     return false;
 }
 
@@ -20,7 +20,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
@@ -33,10 +33,63 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// Tournament tree of losers over the merged cursors. Each internal node keeps the
+// loser of the match played there and the overall winner is kept aside, so replacing
+// the winner's row only replays the matches on its leaf-to-root path: log2(k)
+// comparisons per row instead of the ~2*log2(k) of a binary heap pop and push.
+// Only the winner may change, which matches how the cursors are consumed.
+class MergeSortLoserTree {
+public:
+    void init(std::vector<MergeSortCursor> cursors, const std::vector<bool>& active);
+
+    bool empty() const { return _num_active == 0; }
+    size_t size() const { return _num_active; }
+
+    // Valid only if not empty.
+    MergeSortCursor& top() { return _leaves[_winner]; }
+
+    // The row of top() changed, e.g. it advanced or got a new block.
+    void update_top() { _replay(); }
+
+    // top() has no more rows.
+    void remove_top() {
+        _active[_winner] = false;
+        --_num_active;
+        _replay();
+    }
+
+private:
+    // Whether leaf `lhs` goes before leaf `rhs`, inactive leaves lose every match.
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_active[lhs] || !_active[rhs]) {
+            return _active[lhs];
+        }
+        int8_t res = _leaves[lhs].greater_at(_leaves[rhs], _leaves[lhs]->pos, _leaves[rhs]->pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    void _replay() {
+        size_t winner = _winner;
+        for (size_t node = (winner + _leaves.size()) / 2; node > 0; node /= 2) {
+            if (_beats(_losers[node], winner)) {
+                std::swap(_losers[node], winner);
+            }
+        }
+        _winner = winner;
+    }
+
+    std::vector<MergeSortCursor> _leaves;
+    std::vector<bool> _active;
+    // Internal node i (1 <= i < k) has children 2i and 2i+1, leaf j sits at k+j.
+    std::vector<size_t> _losers;
+    size_t _winner = 0;
+    size_t _num_active = 0;
+};
+
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that keeps the run with the next rows
+// in sorted order as the winner.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -54,8 +107,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -74,11 +126,11 @@ protected:
     size_t _offset = 0;
 
     std::vector<std::shared_ptr<BlockSupplierSortCursorImpl>> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    MergeSortLoserTree _loser_tree;
 
-    /// In pipeline engine, if a cursor needs to read one more block from supplier,
-    /// we make it as a pending cursor until the supplier is readable.
-    std::shared_ptr<MergeSortCursorImpl> _pending_cursor = nullptr;
+    /// In pipeline engine, if the top cursor needs to read one more block from supplier,
+    /// we keep it pending at the top of the tree until the supplier is readable.
+    bool _top_pending = false;
 
     // Times calls to get_next().
     RuntimeProfile::Counter* _get_next_timer = nullptr;
@@ -96,6 +148,7 @@ private:
     /// In pipeline engine, return false if need to read one more block from sender.
     bool next_heap(MergeSortCursor& current);
     bool has_next_block(MergeSortCursor& current);
+    void set_top_pending() { _top_pending = true; }
 };
 
 } // namespace doris::vectorized
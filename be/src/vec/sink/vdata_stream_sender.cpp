@@ -24,6 +24,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/data.pb.h>
 #include <gen_cpp/internal_service.pb.h>
+#include <gen_cpp/segment_v2.pb.h>
 #include <glog/logging.h>
 #include <stddef.h>
 
@@ -44,6 +45,7 @@
 #include "runtime/thread_context.h"
 #include "runtime/types.h"
 #include "util/proto_util.h"
+#include "util/time.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/sip_hash.h"
@@ -72,11 +74,12 @@ Status Channel::init(RuntimeState* state) {
 
     auto network_address = _brpc_dest_addr;
     if (_brpc_dest_addr.hostname == BackendOptions::get_localhost()) {
-        _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_client(
+        _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_data_client(
                 "127.0.0.1", _brpc_dest_addr.port);
         network_address.hostname = "127.0.0.1";
     } else {
-        _brpc_stub = state->exec_env()->brpc_internal_client_cache()->get_client(_brpc_dest_addr);
+        _brpc_stub =
+                state->exec_env()->brpc_internal_client_cache()->get_data_client(_brpc_dest_addr);
     }
 
     if (!_brpc_stub) {
@@ -262,6 +265,9 @@ Status BlockSerializer::next_serialized_block(Block* block, PBlock* dest, size_t
     if (_mutable_block == nullptr) {
         _mutable_block = MutableBlock::create_unique(block->clone_empty());
     }
+    if (_mutable_block->rows() == 0) {
+        _first_pending_row_ms = MonotonicMillis();
+    }
 
     {
         SCOPED_TIMER(_parent->merge_block_timer());
@@ -275,7 +281,7 @@ Status BlockSerializer::next_serialized_block(Block* block, PBlock* dest, size_t
         }
     }
 
-    if (_mutable_block->rows() >= _batch_size || eos) {
+    if (eos || _is_ready_to_send()) {
         if (!_is_local) {
             RETURN_IF_ERROR(serialize_block(dest, num_receivers));
         }
@@ -286,6 +292,18 @@ Status BlockSerializer::next_serialized_block(Block* block, PBlock* dest, size_t
     return Status::OK();
 }
 
+bool BlockSerializer::_is_ready_to_send() const {
+    if (_mutable_block->rows() < _batch_size) {
+        return false;
+    }
+    const auto coalesce_bytes = config::exchange_coalesce_block_bytes;
+    if (_is_local || coalesce_bytes <= 0) {
+        return true;
+    }
+    return static_cast<int64_t>(_mutable_block->bytes()) >= coalesce_bytes ||
+           MonotonicMillis() - _first_pending_row_ms >= config::exchange_coalesce_max_wait_ms;
+}
+
 Status BlockSerializer::serialize_block(PBlock* dest, size_t num_receivers) {
     if (_mutable_block && _mutable_block->rows() > 0) {
         auto block = _mutable_block->to_block();
@@ -297,13 +315,45 @@ Status BlockSerializer::serialize_block(PBlock* dest, size_t num_receivers) {
     return Status::OK();
 }
 
+segment_v2::CompressionTypePB BlockSerializer::_next_compression_type() {
+    auto compression_type = _parent->compression_type();
+    if (compression_type == segment_v2::NO_COMPRESSION || !_skip_compression) {
+        return compression_type;
+    }
+    if (++_blocks_since_compression < config::exchange_compression_probe_interval) {
+        COUNTER_UPDATE(_parent->_compress_skipped_blocks_counter, 1);
+        return segment_v2::NO_COMPRESSION;
+    }
+    // probe whether the data is compressible again
+    _blocks_since_compression = 0;
+    return compression_type;
+}
+
+void BlockSerializer::_update_compression_ratio(const PBlock& block, bool compressed) {
+    if (!compressed) {
+        return;
+    }
+    if (!block.compressed()) {
+        // Block::serialize sends the raw values if compression did not shrink them at all
+        _skip_compression = config::exchange_compression_probe_interval > 0;
+        return;
+    }
+    auto ratio = static_cast<double>(block.column_values().size()) /
+                 static_cast<double>(block.uncompressed_size());
+    _skip_compression = config::exchange_compression_probe_interval > 0 &&
+                        ratio > config::exchange_max_compression_ratio;
+}
+
 Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t num_receivers) {
     SCOPED_TIMER(_parent->_serialize_batch_timer);
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    auto compression_type = _next_compression_type();
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
+                                   &compressed_bytes, compression_type,
                                    _parent->transfer_large_data_by_brpc()));
+    _update_compression_ratio(*dest, compression_type != segment_v2::NO_COMPRESSION &&
+                                             uncompressed_bytes > 0);
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -93,11 +93,21 @@ public:
     bool is_local() const { return _is_local; }
 
 private:
+    bool _is_ready_to_send() const;
+    segment_v2::CompressionTypePB _next_compression_type();
+    void _update_compression_ratio(const PBlock& block, bool compressed);
+
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
 
     bool _is_local;
     const int _batch_size;
+    // when the first row of the pending block was added, for exchange_coalesce_max_wait_ms
+    int64_t _first_pending_row_ms = 0;
+
+    // set when the last compressed block did not shrink enough, e.g. dictionary codes
+    bool _skip_compression = false;
+    int _blocks_since_compression = 0;
 };
 
 class Channel {
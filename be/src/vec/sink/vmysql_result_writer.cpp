@@ -17,6 +17,7 @@
 
 #include "vec/sink/vmysql_result_writer.h"
 
+#include <fmt/compile.h>
 #include <fmt/core.h>
 #include <gen_cpp/Data_types.h>
 #include <gen_cpp/Metrics_types.h>
@@ -25,6 +26,7 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -74,6 +76,73 @@ namespace doris {
 #include "common/compile_check_begin.h"
 namespace vectorized {
 
+namespace {
+
+// The mysql text protocol fields of one column, field i is chars[offsets[i - 1], offsets[i]).
+struct MysqlTextFields {
+    std::string chars;
+    std::vector<size_t> offsets;
+
+    void append(const char* data, size_t size) {
+        chars.append(data, size);
+        offsets.push_back(chars.size());
+    }
+
+    size_t begin_at(size_t row) const { return row == 0 ? 0 : offsets[row - 1]; }
+    size_t size_at(size_t row) const { return offsets[row] - begin_at(row); }
+};
+
+// Same bytes as MysqlRowBuffer<false>::push_int() and push_null(), without a virtual serde
+// call per value.
+template <typename ColumnType, typename T>
+bool format_int_fields(const IColumn& column, const NullMap* null_map, size_t num_rows,
+                       MysqlTextFields* fields) {
+    const auto* data_column = check_and_get_column<ColumnType>(column);
+    if (data_column == nullptr) {
+        return false;
+    }
+    const auto& data = data_column->get_data();
+    // 1 for length, 1 for sign, other for digits
+    char buf[2 + std::numeric_limits<T>::digits10 + 1];
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            buf[0] = static_cast<char>(251);
+            fields->append(buf, 1);
+            continue;
+        }
+        char* end = fmt::format_to(buf + 1, FMT_COMPILE("{}"), static_cast<T>(data[i]));
+        buf[0] = static_cast<char>(end - buf - 1);
+        fields->append(buf, end - buf);
+    }
+    return true;
+}
+
+bool format_int_fields(const IColumn& column, PrimitiveType type, size_t num_rows,
+                       MysqlTextFields* fields) {
+    const IColumn* nested_column = &column;
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable_column = check_and_get_column<ColumnNullable>(column)) {
+        nested_column = &nullable_column->get_nested_column();
+        null_map = nullable_column->has_null() ? &nullable_column->get_null_map_data() : nullptr;
+    }
+    switch (type) {
+    case TYPE_BOOLEAN:
+        return format_int_fields<ColumnUInt8, int8_t>(*nested_column, null_map, num_rows, fields);
+    case TYPE_TINYINT:
+        return format_int_fields<ColumnInt8, int8_t>(*nested_column, null_map, num_rows, fields);
+    case TYPE_SMALLINT:
+        return format_int_fields<ColumnInt16, int16_t>(*nested_column, null_map, num_rows, fields);
+    case TYPE_INT:
+        return format_int_fields<ColumnInt32, int32_t>(*nested_column, null_map, num_rows, fields);
+    case TYPE_BIGINT:
+        return format_int_fields<ColumnInt64, int64_t>(*nested_column, null_map, num_rows, fields);
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 template <bool is_binary_format>
 VMysqlResultWriter<is_binary_format>::VMysqlResultWriter(BufferControlBlock* sinker,
                                                          const VExprContextSPtrs& output_vexpr_ctxs,
@@ -202,18 +271,58 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+        if constexpr (!is_binary_format) {
+            // A text protocol row is just the concatenation of its fields, so format column
+            // by column, integers without the serde, and then assemble every row in one
+            // allocation.
+            std::vector<MysqlTextFields> fields(num_cols);
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
+                const auto& argument = arguments[col_idx];
+                auto& column_fields = fields[col_idx];
+                column_fields.offsets.reserve(num_rows);
+                if (!argument.is_const &&
+                    format_int_fields(*argument.column,
+                                      _output_vexpr_ctxs[col_idx]->root()->type().type, num_rows,
+                                      &column_fields)) {
+                    continue;
+                }
+                for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                    RETURN_IF_ERROR(argument.serde->write_column_to_mysql(
+                            *argument.column, row_buffer, row_idx, argument.is_const, _options));
+                    column_fields.append(row_buffer.buf(), row_buffer.length());
+                    row_buffer.reset();
+                }
             }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
+            // copy the fields to Thrift
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                size_t row_size = 0;
+                for (const auto& column_fields : fields) {
+                    row_size += column_fields.size_at(row_idx);
+                }
+                auto& row = result->result_batch.rows[row_idx];
+                row.resize(row_size);
+                char* pos = row.data();
+                for (const auto& column_fields : fields) {
+                    size_t size = column_fields.size_at(row_idx);
+                    memcpy(pos, column_fields.chars.data() + column_fields.begin_at(row_idx),
+                           size);
+                    pos += size;
+                }
+                bytes_sent += row_size;
+            }
+        } else {
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                }
+
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                bytes_sent += row_buffer.length();
+                row_buffer.reset();
                 row_buffer.start_binary_row(_output_vexpr_ctxs.size());
             }
         }
@@ -334,8 +334,8 @@ Status VNodeChannel::init(RuntimeState* state) {
     _row_desc = std::make_unique<RowDescriptor>(_tuple_desc, false);
     _batch_size = state->batch_size();
 
-    _stub = state->exec_env()->brpc_internal_client_cache()->get_client(_node_info.host,
-                                                                        _node_info.brpc_port);
+    _stub = state->exec_env()->brpc_internal_client_cache()->get_data_client(
+            _node_info.host, _node_info.brpc_port);
     if (_stub == nullptr) {
         _cancelled = true;
         _is_closed = true;
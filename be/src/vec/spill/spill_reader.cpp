@@ -20,6 +20,7 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
@@ -41,7 +42,7 @@ Status SpillReader::open() {
 
     SCOPED_TIMER(read_timer_);
 
-    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(file_path_, &file_reader_));
+    RETURN_IF_ERROR(fs_->open_file(file_path_, &file_reader_));
 
     size_t file_size = file_reader_->size();
     DCHECK(file_size >= 16); // max_sub_block_size, block count
@@ -59,7 +60,12 @@ Status SpillReader::open() {
     RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t) * 2, result, &bytes_read));
     DCHECK(bytes_read == 8); // max_sub_block_size, block count
 
-    size_t buff_size = std::max(block_count_ * sizeof(size_t), max_sub_block_size_);
+    // blocks are read back in order, so read ahead several consecutive blocks at a time
+    size_t data_size = file_size - (block_count_ + 2) * sizeof(size_t);
+    size_t read_ahead_size =
+            std::min(data_size, cast_set<size_t>(std::max(config::spill_read_ahead_bytes, 0L)));
+    size_t buff_size = std::max({block_count_ * sizeof(size_t), max_sub_block_size_,
+                                 read_ahead_size});
     try {
         read_buff_.reset(new char[buff_size]);
     } catch (const std::bad_alloc&) {
@@ -67,6 +73,7 @@ Status SpillReader::open() {
                   << ", block count: " << block_count_ << ", buff size: " << buff_size;
         return Status::InternalError("bad alloc");
     }
+    read_buff_size_ = buff_size;
 
     // read block start offsets
     size_t read_offset = file_size - (block_count_ + 2) * sizeof(size_t);
@@ -80,7 +87,8 @@ Status SpillReader::open() {
     for (size_t i = 0; i < block_count_; ++i) {
         block_start_offsets_[i] = *(size_t*)(result.data + i * sizeof(size_t));
     }
-    block_start_offsets_[block_count_] = file_size - (block_count_ + 2) * sizeof(size_t);
+    block_start_offsets_[block_count_] = data_size;
+    buff_begin_offset_ = buff_end_offset_ = 0;
 
     return Status::OK();
 }
@@ -102,26 +110,18 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    Slice result(read_buff_.get(), bytes_to_read);
-    size_t bytes_read = 0;
-    {
-        SCOPED_TIMER(read_timer_);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+    size_t block_begin = block_start_offsets_[read_block_index_];
+    if (block_begin < buff_begin_offset_ || block_begin + bytes_to_read > buff_end_offset_) {
+        RETURN_IF_ERROR(_read_ahead(read_block_index_));
     }
-    DCHECK(bytes_read == bytes_to_read);
-    COUNTER_UPDATE(read_bytes_, bytes_read);
 
-    if (bytes_read > 0) {
-        {
-            SCOPED_TIMER(deserialize_timer_);
-            if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
-                return Status::InternalError("Failed to read spilled block");
-            }
-            RETURN_IF_ERROR(block->deserialize(pb_block_));
+    Slice result(read_buff_.get() + (block_begin - buff_begin_offset_), bytes_to_read);
+    {
+        SCOPED_TIMER(deserialize_timer_);
+        if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
+            return Status::InternalError("Failed to read spilled block");
         }
-    } else {
-        block->clear_column_data();
+        RETURN_IF_ERROR(block->deserialize(pb_block_));
     }
 
     ++read_block_index_;
@@ -129,6 +129,32 @@ Status SpillReader::read(Block* block, bool* eos) {
     return Status::OK();
 }
 
+Status SpillReader::_read_ahead(size_t block_index) {
+    size_t begin = block_start_offsets_[block_index];
+    size_t end_index = block_index + 1;
+    while (end_index < block_count_ &&
+           block_start_offsets_[end_index + 1] - begin <= read_buff_size_) {
+        ++end_index;
+    }
+    size_t end = block_start_offsets_[end_index];
+
+    Slice result(read_buff_.get(), end - begin);
+    size_t bytes_read = 0;
+    {
+        SCOPED_TIMER(read_timer_);
+        RETURN_IF_ERROR(file_reader_->read_at(begin, result, &bytes_read));
+    }
+    if (bytes_read != result.size) {
+        buff_begin_offset_ = buff_end_offset_ = 0;
+        return Status::InternalError("Failed to read spilled block, expect {} bytes, read {}",
+                                     result.size, bytes_read);
+    }
+    COUNTER_UPDATE(read_bytes_, bytes_read);
+    buff_begin_offset_ = begin;
+    buff_end_offset_ = end;
+    return Status::OK();
+}
+
 Status SpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
@@ -25,6 +25,7 @@
 
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
+#include "io/fs/file_system.h"
 #include "util/runtime_profile.h"
 
 namespace doris::vectorized {
@@ -32,8 +33,8 @@ namespace doris::vectorized {
 class Block;
 class SpillReader {
 public:
-    SpillReader(int64_t stream_id, std::string file_path)
-            : stream_id_(stream_id), file_path_(std::move(file_path)) {}
+    SpillReader(int64_t stream_id, std::string file_path, io::FileSystemSPtr fs)
+            : stream_id_(stream_id), file_path_(std::move(file_path)), fs_(std::move(fs)) {}
 
     ~SpillReader() { (void)close(); }
 
@@ -60,14 +61,21 @@ public:
     }
 
 private:
+    Status _read_ahead(size_t block_index);
+
     int64_t stream_id_;
     std::string file_path_;
+    io::FileSystemSPtr fs_;
     io::FileReaderSPtr file_reader_;
 
     size_t block_count_ = 0;
     size_t read_block_index_ = 0;
     size_t max_sub_block_size_ = 0;
     std::unique_ptr<char[]> read_buff_;
+    size_t read_buff_size_ = 0;
+    // file range [buff_begin_offset_, buff_end_offset_) currently held in read_buff_
+    size_t buff_begin_offset_ = 0;
+    size_t buff_end_offset_ = 0;
     std::vector<size_t> block_start_offsets_;
 
     PBlock pb_block_;
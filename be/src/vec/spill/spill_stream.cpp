@@ -52,6 +52,10 @@ SpillStream::~SpillStream() {
 }
 
 void SpillStream::gc() {
+    if (data_dir_->is_remote()) {
+        _gc_remote();
+        return;
+    }
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -79,10 +83,36 @@ void SpillStream::gc() {
     total_written_bytes_ = 0;
 }
 
+void SpillStream::_gc_remote() {
+    if (!remote_deleted_) {
+        remote_deleted_ = true;
+        auto fs = data_dir_->fs();
+        auto spill_dir = spill_dir_;
+        auto* spill_io_pool =
+                ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+        auto status = spill_io_pool->submit_func(
+                [fs = std::move(fs), spill_dir = std::move(spill_dir)]() {
+                    auto st = fs->delete_directory(spill_dir);
+                    if (!st.ok()) {
+                        LOG_EVERY_T(WARNING, 1) << fmt::format(
+                                "failed to delete remote spill data, dir {}, error: {}", spill_dir,
+                                st.to_string());
+                    }
+                });
+        if (!status.ok()) {
+            LOG_EVERY_T(WARNING, 1) << fmt::format(
+                    "failed to submit deleting remote spill data, dir {}, error: {}", spill_dir_,
+                    status.to_string());
+        }
+    }
+    data_dir_->update_spill_data_usage(-total_written_bytes_);
+    total_written_bytes_ = 0;
+}
+
 Status SpillStream::prepare() {
     writer_ = std::make_unique<SpillWriter>(stream_id_, batch_rows_, data_dir_, spill_dir_);
 
-    reader_ = std::make_unique<SpillReader>(stream_id_, writer_->get_file_path());
+    reader_ = std::make_unique<SpillReader>(stream_id_, writer_->get_file_path(), data_dir_->fs());
     return Status::OK();
 }
 
@@ -89,6 +89,9 @@ private:
 
     Status prepare();
 
+    // remote spill data can not be moved to the gc dir, delete it in the spill io thread pool
+    void _gc_remote();
+
     RuntimeState* state_ = nullptr;
     int64_t stream_id_;
     SpillDataDir* data_dir_ = nullptr;
@@ -98,6 +101,7 @@ private:
     int64_t total_written_bytes_ = 0;
 
     std::atomic_bool _is_reading = false;
+    bool remote_deleted_ = false;
 
     SpillWriterUPtr writer_;
     SpillReaderUPtr reader_;
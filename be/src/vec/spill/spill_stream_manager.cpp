@@ -27,10 +27,14 @@
 #include <random>
 #include <string>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
+#include "runtime/cluster_info.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "util/doris_metrics.h"
 #include "util/parse_util.h"
@@ -95,6 +99,10 @@ void SpillStreamManager::_spill_gc_thread_callback() {
         for (auto& [path, dir] : _spill_store_map) {
             static_cast<void>(dir->update_capacity());
         }
+        std::lock_guard l(_remote_store_mutex);
+        if (_remote_spill_store) {
+            static_cast<void>(_remote_spill_store->update_capacity());
+        }
     }
 }
 
@@ -159,6 +167,11 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     if (data_dirs.empty()) {
         data_dirs = _get_stores_for_spill(TStorageMedium::type::HDD);
     }
+    if (data_dirs.empty()) {
+        if (auto* remote_store = _get_remote_store_for_spill(); remote_store != nullptr) {
+            data_dirs.push_back(remote_store);
+        }
+    }
     if (data_dirs.empty()) {
         return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
                 "no available disk can be used for spill.");
@@ -171,7 +184,7 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
         std::string spill_root_dir = dir->get_spill_data_path();
         spill_dir = fmt::format("{}/{}/{}-{}-{}-{}", spill_root_dir, query_id, operator_name,
                                 node_id, state->task_id(), id);
-        auto st = io::global_local_filesystem()->create_directory(spill_dir);
+        auto st = dir->fs()->create_directory(spill_dir);
         if (!st.ok()) {
             continue;
         }
@@ -188,6 +201,27 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     return Status::OK();
 }
 
+SpillDataDir* SpillStreamManager::_get_remote_store_for_spill() {
+    if (!config::enable_spill_to_remote_storage || !config::is_cloud_mode()) {
+        return nullptr;
+    }
+    std::lock_guard l(_remote_store_mutex);
+    if (!_remote_spill_store) {
+        auto fs = ExecEnv::GetInstance()->storage_engine().to_cloud().latest_fs();
+        if (!fs) {
+            return nullptr;
+        }
+        auto path = fmt::format("{}/{}", SPILL_DIR_PREFIX,
+                                ExecEnv::GetInstance()->cluster_info()->backend_id);
+        _remote_spill_store = std::make_unique<SpillDataDir>(std::move(path), std::move(fs));
+        LOG(INFO) << "use remote spill storage: " << _remote_spill_store->debug_string();
+    }
+    if (_remote_spill_store->reach_capacity_limit(0)) {
+        return nullptr;
+    }
+    return _remote_spill_store.get();
+}
+
 void SpillStreamManager::delete_spill_stream(SpillStreamSPtr stream) {
     stream->gc();
 }
@@ -275,6 +309,17 @@ void SpillStreamManager::async_cleanup_query(TUniqueId query_id) {
                 }
             }
         }
+
+        SpillDataDir* remote_store = nullptr;
+        {
+            std::lock_guard l(_remote_store_mutex);
+            remote_store = _remote_spill_store.get();
+        }
+        if (remote_store) {
+            // remote spill data can not be renamed cheaply, delete it directly
+            static_cast<void>(remote_store->fs()->delete_directory(
+                    remote_store->get_spill_data_path(print_id(query_id))));
+        }
     });
 }
 
@@ -300,6 +345,21 @@ SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_gc_data);
 }
 
+SpillDataDir::SpillDataDir(std::string path, io::FileSystemSPtr remote_fs)
+        : SpillDataDir(std::move(path), 0, TStorageMedium::HDD) {
+    _remote_fs = std::move(remote_fs);
+    _spill_data_limit_bytes = config::spill_remote_storage_limit;
+    spill_disk_limit->set_value(_spill_data_limit_bytes);
+}
+
+const io::FileSystemSPtr& SpillDataDir::fs() const {
+    if (_remote_fs) {
+        return _remote_fs;
+    }
+    static io::FileSystemSPtr local_fs = io::global_local_filesystem();
+    return local_fs;
+}
+
 bool is_directory_empty(const std::filesystem::path& dir) {
     try {
         return std::filesystem::is_directory(dir) &&
@@ -347,6 +407,11 @@ std::string SpillDataDir::get_spill_data_gc_path(const std::string& sub_dir_name
 
 Status SpillDataDir::update_capacity() {
     std::lock_guard<std::mutex> l(_mutex);
+    if (is_remote()) {
+        _spill_data_limit_bytes = config::spill_remote_storage_limit;
+        spill_disk_limit->set_value(_spill_data_limit_bytes);
+        return Status::OK();
+    }
     RETURN_IF_ERROR(io::global_local_filesystem()->get_space_info(_path, &_disk_capacity_bytes,
                                                                   &_available_bytes));
     spill_disk_capacity->set_value(_disk_capacity_bytes);
@@ -381,6 +446,9 @@ Status SpillDataDir::update_capacity() {
 }
 
 bool SpillDataDir::_reach_disk_capacity_limit(int64_t incoming_data_size) {
+    if (is_remote()) {
+        return false;
+    }
     double used_pct = _get_disk_usage(incoming_data_size);
     int64_t left_bytes = _available_bytes - incoming_data_size;
     if (used_pct >= config::storage_flood_stage_usage_percent / 100.0 &&
@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "io/fs/file_system.h"
 #include "olap/options.h"
 #include "util/metrics.h"
 #include "util/threadpool.h"
@@ -38,6 +39,8 @@ class SpillDataDir {
 public:
     SpillDataDir(std::string path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium = TStorageMedium::HDD);
+    // spill data dir in the remote storage, `path` is relative to the root of `remote_fs`
+    SpillDataDir(std::string path, io::FileSystemSPtr remote_fs);
 
     Status init();
 
@@ -49,6 +52,10 @@ public:
 
     TStorageMedium::type storage_medium() const { return _storage_medium; }
 
+    bool is_remote() const { return _remote_fs != nullptr; }
+
+    const io::FileSystemSPtr& fs() const;
+
     // check if the capacity reach the limit after adding the incoming data
     // return true if limit reached, otherwise, return false.
     bool reach_capacity_limit(int64_t incoming_data_size);
@@ -94,6 +101,7 @@ private:
     size_t _available_bytes = 0;
     int64_t _spill_data_bytes = 0;
     TStorageMedium::type _storage_medium;
+    io::FileSystemSPtr _remote_fs;
 
     std::shared_ptr<MetricEntity> spill_data_dir_metric_entity;
     IntGauge* spill_disk_capacity = nullptr;
@@ -137,9 +145,15 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    SpillDataDir* _get_remote_store_for_spill();
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
 
+    // used when local spill storage is exhausted, created on first use since the storage vault
+    // may not be ready when the manager is initialized
+    std::mutex _remote_store_mutex;
+    std::unique_ptr<SpillDataDir> _remote_spill_store;
+
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
     scoped_refptr<Thread> _spill_gc_thread;
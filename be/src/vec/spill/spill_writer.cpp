@@ -18,21 +18,36 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/string_util.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+namespace {
+segment_v2::CompressionTypePB spill_compression_type() {
+    std::string type = config::spill_compression_type;
+    if (iequal(type, "zstd")) {
+        return segment_v2::CompressionTypePB::ZSTD;
+    } else if (iequal(type, "none")) {
+        return segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    // LZ4 decompresses several times faster than ZSTD, spilled data is read back once
+    return segment_v2::CompressionTypePB::LZ4;
+}
+} // namespace
+
 Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    return data_dir_->fs()->create_file(file_path_, &file_writer_);
 }
 
 Status SpillWriter::close() {
@@ -103,10 +118,9 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
         {
             PBlock pblock;
             SCOPED_TIMER(serialize_timer_);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
+            status = block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                     &uncompressed_bytes, &compressed_bytes,
+                                     spill_compression_type());
             RETURN_IF_ERROR(status);
             if (!pblock.SerializeToString(&buff)) {
                 return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
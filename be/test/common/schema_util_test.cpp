@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include "common/config.h"
+
 namespace doris {
 
 class SchemaUtilTest : public testing::Test {};
@@ -106,4 +108,62 @@ TEST_F(SchemaUtilTest, inherit_column_attributes) {
     }
 }
 
+TEST_F(SchemaUtilTest, get_least_common_schema_with_shared_schemas) {
+    auto make_schema = [](FieldType type, std::string_view path) {
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(KeysType::DUP_KEYS);
+        construct_column(schema_pb.add_column(), schema_pb.add_index(), 10000, "v1_index", 1,
+                         "VARIANT", "v1", IndexType::INVERTED);
+        TabletSchemaSPtr schema = std::make_shared<TabletSchema>();
+        schema->init_from_pb(schema_pb);
+        std::vector<TabletColumn> subcolumns;
+        construct_subcolumn(schema, type, 1, path, &subcolumns);
+        return schema;
+    };
+    TabletSchemaSPtr schema1 = make_schema(FieldType::OLAP_FIELD_TYPE_INT, "v1.a");
+    TabletSchemaSPtr schema2 = make_schema(FieldType::OLAP_FIELD_TYPE_BIGINT, "v1.a");
+    TabletSchemaSPtr schema3 = make_schema(FieldType::OLAP_FIELD_TYPE_STRING, "v1.b");
+
+    TabletSchemaSPtr merged;
+    ASSERT_TRUE(vectorized::schema_util::get_least_common_schema({schema1, schema2, schema3},
+                                                                 nullptr, merged)
+                        .ok());
+    TabletSchemaSPtr merged_shared;
+    ASSERT_TRUE(vectorized::schema_util::get_least_common_schema(
+                        {schema1, schema1, schema2, schema3, schema2, schema3}, nullptr,
+                        merged_shared)
+                        .ok());
+    ASSERT_EQ(merged->num_columns(), 3);
+    ASSERT_EQ(merged_shared->num_columns(), merged->num_columns());
+    for (size_t i = 0; i < merged->num_columns(); ++i) {
+        EXPECT_EQ(merged_shared->column(i).name(), merged->column(i).name());
+        EXPECT_EQ(merged_shared->column(i).type(), merged->column(i).type());
+    }
+}
+
+TEST_F(SchemaUtilTest, need_extracted_column_bloom_filter) {
+    TabletSchemaSPtr tablet_schema = std::make_shared<TabletSchema>();
+    std::vector<TabletColumn> subcolumns;
+    construct_subcolumn(tablet_schema, FieldType::OLAP_FIELD_TYPE_STRING, 1, "v1.b", &subcolumns);
+    construct_subcolumn(tablet_schema, FieldType::OLAP_FIELD_TYPE_BIGINT, 1, "v1.c", &subcolumns);
+    construct_subcolumn(tablet_schema, FieldType::OLAP_FIELD_TYPE_TINYINT, 1, "v1.d", &subcolumns);
+    construct_subcolumn(tablet_schema, FieldType::OLAP_FIELD_TYPE_DOUBLE, 1, "v1.e", &subcolumns);
+    TabletColumn int_column;
+    int_column.set_type(FieldType::OLAP_FIELD_TYPE_INT);
+    int_column.set_unique_id(2);
+
+    bool origin = config::enable_variant_subcolumn_bloom_filter;
+    config::enable_variant_subcolumn_bloom_filter = false;
+    for (const auto& col : subcolumns) {
+        EXPECT_FALSE(vectorized::schema_util::need_extracted_column_bloom_filter(col));
+    }
+    config::enable_variant_subcolumn_bloom_filter = true;
+    EXPECT_TRUE(vectorized::schema_util::need_extracted_column_bloom_filter(subcolumns[0]));
+    EXPECT_TRUE(vectorized::schema_util::need_extracted_column_bloom_filter(subcolumns[1]));
+    EXPECT_FALSE(vectorized::schema_util::need_extracted_column_bloom_filter(subcolumns[2]));
+    EXPECT_FALSE(vectorized::schema_util::need_extracted_column_bloom_filter(subcolumns[3]));
+    EXPECT_FALSE(vectorized::schema_util::need_extracted_column_bloom_filter(int_column));
+    config::enable_variant_subcolumn_bloom_filter = origin;
+}
+
 } // namespace doris
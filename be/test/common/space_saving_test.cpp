@@ -27,6 +27,8 @@
 #include <vector>
 
 #include "common/logging.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/string_buffer.hpp"
 #include "vec/common/string_ref.h"
 
 namespace doris::vectorized {
@@ -297,4 +299,57 @@ TEST_F(SpaceSavingTest, test_space_saving_string_keys) {
     }
 }
 
+// Test that a cleared or deserialized set can still replace counters once it is full
+TEST_F(SpaceSavingTest, test_space_saving_full_after_clear_and_read) {
+    SpaceSaving<int32_t> space_saving(4);
+    for (int32_t i = 0; i < 100; ++i) {
+        space_saving.insert(i % 8, i % 8 + 1);
+    }
+    space_saving.clear();
+    EXPECT_EQ(space_saving.size(), 0);
+    for (int32_t i = 0; i < 100; ++i) {
+        space_saving.insert(i % 8, i % 8 + 1);
+    }
+    EXPECT_EQ(space_saving.size(), 4);
+
+    ColumnString buffer;
+    BufferWritable wb(buffer);
+    space_saving.write(wb);
+    wb.commit();
+
+    SpaceSaving<int32_t> read_space_saving(4);
+    BufferReadable rb(buffer.get_data_at(0));
+    read_space_saving.read(rb);
+    for (int32_t i = 0; i < 100; ++i) {
+        read_space_saving.insert(i % 8, i % 8 + 1);
+    }
+    auto counts = read_space_saving.top_k(4);
+    EXPECT_EQ(counts.size(), 4);
+    for (size_t i = 0; i + 1 < counts.size(); ++i) {
+        EXPECT_GE(counts[i].count, counts[i + 1].count);
+    }
+}
+
+// Test that merging full sets keeps the heaviest counters in order
+TEST_F(SpaceSavingTest, test_space_saving_merge_full_sets) {
+    SpaceSaving<int32_t> space_saving1(8);
+    SpaceSaving<int32_t> space_saving2(8);
+    for (int32_t i = 0; i < 16; ++i) {
+        space_saving1.insert(i, 1000 + i);
+        space_saving2.insert(i, 1000 + i);
+    }
+
+    space_saving1.merge(space_saving2);
+    auto counts = space_saving1.top_k(8);
+    EXPECT_EQ(counts.size(), 8);
+    for (size_t i = 0; i + 1 < counts.size(); ++i) {
+        EXPECT_GE(counts[i].count, counts[i + 1].count);
+    }
+    // both sets keep keys 8..15 with counts 1008..1015.
+    for (int32_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(counts[i].key, 15 - i);
+        EXPECT_EQ(counts[i].count, 2000 + 2 * (15 - i));
+    }
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
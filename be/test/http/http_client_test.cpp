@@ -26,7 +26,10 @@
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "http/ev_http_server.h"
 #include "http/http_channel.h"
@@ -142,6 +145,7 @@ public:
         s_server->register_handler(POST, "/simple_post", &s_simple_post_handler);
         s_server->register_handler(GET, "/not_found", &s_not_found_handler);
         s_server->register_handler(HEAD, "/download_file", &s_download_file_handler);
+        s_server->register_handler(GET, "/download_file", &s_download_file_handler);
         s_server->register_handler(HEAD, "/api/_tablet/_batch_download",
                                    &s_batch_download_file_handler);
         s_server->register_handler(GET, "/api/_tablet/_batch_download",
@@ -329,6 +333,38 @@ TEST_F(HttpClientTest, download_file_md5) {
     close(fd);
 }
 
+TEST_F(HttpClientTest, download_resumable) {
+    std::string local_file = ".http_client_resume_test.dat";
+    std::string content;
+    {
+        std::ifstream exe("/proc/self/exe", std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(exe), std::istreambuf_iterator<char>());
+    }
+    ASSERT_GT(content.size(), 1024);
+    // leave a partial file as a failed attempt would
+    {
+        std::ofstream partial(local_file, std::ios::binary | std::ios::trunc);
+        partial.write(content.data(), 1024);
+    }
+
+    HttpClient client;
+    auto st = client.init(hostname + "/download_file");
+    EXPECT_TRUE(st.ok());
+    client.set_basic_auth("test1", "");
+    st = client.download_resumable(local_file);
+    EXPECT_TRUE(st.ok()) << st;
+    EXPECT_EQ(206, client.get_http_status());
+
+    std::string downloaded;
+    {
+        std::ifstream file(local_file, std::ios::binary);
+        downloaded.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    EXPECT_EQ(content.size(), downloaded.size());
+    EXPECT_TRUE(content == downloaded);
+    unlink(local_file.c_str());
+}
+
 TEST_F(HttpClientTest, escape_url) {
     HttpClient client;
     client._curl = curl_easy_init();
@@ -667,4 +703,27 @@ TEST_F(HttpClientTest, batch_download) {
     EXPECT_TRUE(st.ok());
 }
 
+TEST_F(HttpClientTest, reuse_port_workers) {
+    auto origin_reuse_port = config::enable_webserver_reuse_port;
+    config::enable_webserver_reuse_port = true;
+    EvHttpServer server(0, 4);
+    server.register_handler(GET, "/simple_get", &s_simple_get_handler);
+    server.start();
+    int port = server.get_real_port();
+    EXPECT_NE(0, port);
+
+    for (int i = 0; i < 16; ++i) {
+        HttpClient client;
+        auto st = client.init("http://127.0.0.1:" + std::to_string(port) + "/simple_get");
+        EXPECT_TRUE(st.ok());
+        client.set_basic_auth("test1", "");
+        std::string response;
+        st = client.execute(&response);
+        EXPECT_TRUE(st.ok()) << st;
+        EXPECT_STREQ("test1", response.c_str());
+    }
+    server.stop();
+    config::enable_webserver_reuse_port = origin_reuse_port;
+}
+
 } // namespace doris
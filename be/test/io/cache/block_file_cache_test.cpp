@@ -53,6 +53,8 @@
 #include "io/cache/cached_remote_file_reader.h"
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
+#include "io/cache/file_cache_hot_tier.h"
+#include "io/cache/file_cache_peers.h"
 #include "io/cache/fs_file_cache_storage.h"
 #include "io/fs/path.h"
 #include "olap/options.h"
@@ -3238,6 +3240,64 @@ TEST_F(BlockFileCacheTest, test_factory_2) {
     FileCacheFactory::instance()->_capacity = 0;
 }
 
+TEST_F(BlockFileCacheTest, test_factory_shards) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    config::file_cache_shards_per_path = 2;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.index_queue_size = 30;
+    settings.index_queue_elements = 5;
+    settings.disposable_queue_size = 30;
+    settings.disposable_queue_elements = 5;
+    settings.capacity = 90;
+    settings.max_file_block_size = 30;
+    settings.max_query_cache_size = 30;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    EXPECT_EQ(FileCacheFactory::instance()->get_cache_instance_size(), 2);
+    EXPECT_EQ(FileCacheFactory::instance()->get_capacity(), 90);
+    auto paths = FileCacheFactory::instance()->get_base_paths();
+    ASSERT_EQ(paths.size(), 1);
+    EXPECT_EQ(paths[0], cache_base_path);
+    EXPECT_TRUE(fs::exists(fs::path(cache_base_path) / "shard_0"));
+    EXPECT_TRUE(fs::exists(fs::path(cache_base_path) / "shard_1"));
+
+    // the key lands in the same shard through the hash and through its path
+    for (const auto* name : {"key1", "key2", "key3", "key4"}) {
+        auto key = io::BlockFileCache::hash(name);
+        auto* cache = FileCacheFactory::instance()->get_by_path(key);
+        EXPECT_EQ(FileCacheFactory::instance()->get_by_path(cache_base_path, key), cache);
+        EXPECT_EQ(cache->capacity(), 45);
+    }
+    EXPECT_NE(FileCacheFactory::instance()->get_by_path(cache_base_path), nullptr);
+
+    for (auto& cache : FileCacheFactory::instance()->_caches) {
+        int i = 0;
+        while (i++ < 1000) {
+            if (cache->get_async_open_success()) {
+                break;
+            };
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_LT(i, 1000);
+    }
+    FileCacheFactory::instance()->reset_capacity(cache_base_path, 60);
+    for (auto& cache : FileCacheFactory::instance()->_caches) {
+        EXPECT_EQ(cache->capacity(), 30);
+    }
+
+    config::file_cache_shards_per_path = 1;
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_path_to_shards.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 TEST_F(BlockFileCacheTest, test_factory_3) {
     if (fs::exists(cache_base_path)) {
         fs::remove_all(cache_base_path);
@@ -3799,6 +3859,77 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader) {
     FileCacheFactory::instance()->_capacity = 0;
 }
 
+TEST_F(BlockFileCacheTest, cached_remote_file_reader_coalesce) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    auto old_max_gap = config::file_cache_remote_read_coalesce_max_gap;
+    config::file_cache_remote_read_coalesce_max_gap = 0;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 12582912;
+    settings.query_queue_elements = 12;
+    settings.index_queue_size = 1048576;
+    settings.index_queue_elements = 1;
+    settings.disposable_queue_size = 1048576;
+    settings.disposable_queue_elements = 1;
+    settings.capacity = 14680064;
+    settings.max_file_block_size = 1048576;
+    settings.max_query_cache_size = 0;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    FileReaderSPtr local_reader;
+    ASSERT_TRUE(global_local_filesystem()->open_file(tmp_file, &local_reader));
+    io::FileReaderOptions opts;
+    opts.cache_type = io::cache_type_from_string("file_block_cache");
+    opts.is_doris_table = true;
+    CachedRemoteFileReader reader(local_reader, opts);
+    auto read = [&](size_t offset, size_t size, FileCacheStatistics* stats) {
+        std::string buffer;
+        buffer.resize(size);
+        IOContext io_ctx;
+        io_ctx.file_cache_stats = stats;
+        size_t bytes_read {0};
+        EXPECT_TRUE(reader.read_at(offset, Slice(buffer.data(), buffer.size()), &bytes_read,
+                                   &io_ctx)
+                            .ok());
+        EXPECT_EQ(bytes_read, size);
+        return buffer;
+    };
+    {
+        // cache the block 0 and the block 5
+        FileCacheStatistics stats;
+        read(0, 1_mb, &stats);
+        read(5_mb, 1_mb, &stats);
+        EXPECT_EQ(stats.num_remote_read_requests, 2);
+        EXPECT_EQ(stats.num_coalesced_remote_read_requests, 0);
+    }
+    {
+        // block 1-4 and block 6-10 are fetched by two GETs
+        FileCacheStatistics stats;
+        auto buffer = read(0, 10_mb + 1, &stats);
+        EXPECT_EQ(stats.num_remote_read_requests, 2);
+        EXPECT_EQ(stats.num_coalesced_remote_read_requests, 7);
+        for (int i = 0; i < 10; i++) {
+            std::string data(1_mb, '0' + i);
+            EXPECT_EQ(data, buffer.substr(i * 1024 * 1024, 1_mb));
+        }
+        EXPECT_EQ(std::string(1, '0'), buffer.substr(10_mb, 1));
+    }
+    {
+        FileCacheStatistics stats;
+        read(0, 10_mb + 1, &stats);
+        EXPECT_EQ(stats.num_remote_read_requests, 0);
+    }
+    EXPECT_TRUE(reader.close().ok());
+    config::file_cache_remote_read_coalesce_max_gap = old_max_gap;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
 TEST_F(BlockFileCacheTest, cached_remote_file_reader_tail) {
     if (fs::exists(cache_base_path)) {
         fs::remove_all(cache_base_path);
@@ -4224,6 +4355,22 @@ TEST_F(BlockFileCacheTest, test_hot_data) {
     std::this_thread::sleep_for(std::chrono::seconds(1));
     EXPECT_EQ(cache.get_hot_blocks_meta(key1).size(), 2);
     EXPECT_EQ(cache.get_hot_blocks_meta(key2).size(), 1);
+    {
+        // the block read more often comes first
+        context.cache_type = FileCacheType::INDEX;
+        context.expiration_time = 0;
+        for (int i = 0; i < 2; i++) {
+            auto holder = cache.get_or_set(key1, 15, 5, context);
+            auto blocks = fromHolder(holder);
+            ASSERT_EQ(blocks.size(), 1);
+            assert_range(1, blocks[0], io::FileBlock::Range(15, 19),
+                         io::FileBlock::State::DOWNLOADED);
+        }
+        auto blocks_meta = cache.get_hot_blocks_meta(key1);
+        ASSERT_EQ(blocks_meta.size(), 2);
+        EXPECT_EQ(std::get<0>(blocks_meta[0]), 15);
+        EXPECT_GT(std::get<4>(blocks_meta[0]), std::get<4>(blocks_meta[1]));
+    }
 }
 
 TEST_F(BlockFileCacheTest, test_async_load_with_error_file_1) {
@@ -6814,4 +6961,108 @@ TEST_F(BlockFileCacheTest, evict_privilege_order_for_ttl) {
     }
 }
 
+TEST_F(BlockFileCacheTest, hot_tier) {
+    auto old_promote_hits = config::file_cache_hot_tier_promote_hits;
+    config::file_cache_hot_tier_promote_hits = 2;
+    FileCacheHotTier hot_tier(20);
+    auto make_block = [](char c, size_t size) {
+        std::shared_ptr<char[]> data(new char[size]);
+        memset(data.get(), c, size);
+        return data;
+    };
+    AccessKeyAndOffset key1 {io::BlockFileCache::hash("key1"), 0};
+    AccessKeyAndOffset key2 {io::BlockFileCache::hash("key2"), 0};
+    AccessKeyAndOffset key3 {io::BlockFileCache::hash("key3"), 10};
+    char buf[5];
+    bool promote = false;
+    // promoted on the second read from disk
+    EXPECT_FALSE(hot_tier.read(key1, 0, Slice(buf, 5), &promote));
+    EXPECT_FALSE(promote);
+    EXPECT_FALSE(hot_tier.read(key1, 0, Slice(buf, 5), &promote));
+    EXPECT_TRUE(promote);
+    hot_tier.insert(key1, make_block('a', 10), 10);
+    EXPECT_TRUE(hot_tier.read(key1, 5, Slice(buf, 5), &promote));
+    EXPECT_EQ(std::string(buf, 5), "aaaaa");
+    // out of the range of the block
+    EXPECT_FALSE(hot_tier.read(key1, 6, Slice(buf, 5), &promote));
+
+    hot_tier.insert(key2, make_block('b', 10), 10);
+    EXPECT_EQ(hot_tier.size(), 20);
+    // key1 is the most recently used one, key2 is evicted for key3
+    EXPECT_TRUE(hot_tier.read(key1, 0, Slice(buf, 5), &promote));
+    hot_tier.insert(key3, make_block('c', 10), 10);
+    EXPECT_TRUE(hot_tier.contains(key1));
+    EXPECT_FALSE(hot_tier.contains(key2));
+    EXPECT_TRUE(hot_tier.contains(key3));
+    // larger than the whole tier
+    hot_tier.insert(key2, make_block('b', 30), 30);
+    EXPECT_FALSE(hot_tier.contains(key2));
+
+    hot_tier.remove(key1);
+    EXPECT_FALSE(hot_tier.contains(key1));
+    EXPECT_EQ(hot_tier.size(), 10);
+    hot_tier.clear();
+    EXPECT_EQ(hot_tier.size(), 0);
+    EXPECT_FALSE(hot_tier.read(key3, 0, Slice(buf, 5), &promote));
+    config::file_cache_hot_tier_promote_hits = old_promote_hits;
+}
+
+TEST_F(BlockFileCacheTest, file_cache_peers_owner) {
+    FileCachePeers no_peers("");
+    ASSERT_TRUE(no_peers.empty());
+    ASSERT_TRUE(no_peers.owner(BlockFileCache::hash("file")).empty());
+
+    FileCachePeers three_peers("10.0.0.1:8040, 10.0.0.2:8040,10.0.0.3:8040");
+    FileCachePeers two_peers("10.0.0.1:8040,10.0.0.2:8040");
+    ASSERT_FALSE(three_peers.empty());
+    int moved = 0;
+    for (int i = 0; i < 1000; ++i) {
+        auto hash = BlockFileCache::hash(fmt::format("{}_0.dat", i));
+        const std::string& owner = three_peers.owner(hash);
+        ASSERT_FALSE(owner.empty());
+        ASSERT_EQ(owner, three_peers.owner(hash));
+        // only the files owned by the removed peer move to other peers
+        if (owner == "10.0.0.3:8040") {
+            ASSERT_NE(two_peers.owner(hash), owner);
+            ++moved;
+        } else {
+            ASSERT_EQ(two_peers.owner(hash), owner);
+        }
+    }
+    ASSERT_GT(moved, 0);
+    ASSERT_LT(moved, 1000);
+}
+
+TEST_F(BlockFileCacheTest, io_tier_statistics) {
+    IOTierStatistics stats;
+    stats.add(5000, 10);       // 5us
+    stats.add(50000, 20);      // 50us
+    stats.add(5000000, 30);    // 5ms
+    stats.add(5000000000, 40); // 5s
+    ASSERT_EQ(stats.num_reads, 4);
+    ASSERT_EQ(stats.bytes_read, 100);
+    ASSERT_EQ(stats.latency_buckets[0], 1);
+    ASSERT_EQ(stats.latency_buckets[1], 1);
+    ASSERT_EQ(stats.latency_buckets[2], 0);
+    ASSERT_EQ(stats.latency_buckets[3], 1);
+    ASSERT_EQ(stats.latency_buckets[5], 1);
+
+    IOTierStatistics other;
+    other.add(10000, 1); // 10us is the next bucket
+    stats.merge(other);
+    ASSERT_EQ(stats.num_reads, 5);
+    ASSERT_EQ(stats.latency_buckets[1], 2);
+
+    RuntimeProfile profile("profile");
+    FileCacheStatistics cache_stats;
+    cache_stats.remote_io = stats;
+    FileCacheProfileReporter reporter(&profile);
+    reporter.update(&cache_stats);
+    ASSERT_EQ(profile.get_counter("RemoteReads")->value(), 5);
+    ASSERT_EQ(profile.get_counter("RemoteBytesRead")->value(), 101);
+    ASSERT_EQ(profile.get_counter("RemoteReadsOver100ms")->value(), 1);
+    ASSERT_EQ(profile.get_counter("RemoteReadsUnder1ms"), nullptr);
+    ASSERT_EQ(profile.get_counter("FileCacheDiskReads"), nullptr);
+}
+
 } // namespace doris::io
@@ -296,6 +296,46 @@ TEST_F(BufferedReaderTest, test_miss) {
     EXPECT_EQ(45, bytes_read);
 }
 
+TEST_F(BufferedReaderTest, test_adaptive_prefetch_window) {
+    size_t mb = 1024 * 1024;
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(64 * mb);
+    io::PrefetchBufferedReader reader(nullptr, offset_reader, io::PrefetchRange(0, 64 * mb),
+                                      nullptr, 16 * mb);
+    EXPECT_EQ(reader._window, 4);
+    EXPECT_EQ(reader._pre_buffers.size(), config::remote_storage_read_buffer_max_mb / 4);
+
+    std::vector<char> data(mb);
+    auto check_read = [&](size_t offset) {
+        size_t bytes_read = 0;
+        auto st = reader.read_at(offset, Slice {data.data(), mb}, &bytes_read);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(bytes_read, mb);
+        for (size_t i = 0; i < mb; i += 4096) {
+            ASSERT_EQ(data[i], (char)((offset + i) % UCHAR_MAX));
+        }
+    };
+    // sequential read never shrinks the window
+    for (size_t offset = 0; offset < 32 * mb; offset += mb) {
+        check_read(offset);
+    }
+    EXPECT_GE(reader._window, 4);
+    EXPECT_LE(reader._window, reader._pre_buffers.size());
+
+    // seek backward and forward, the window is halved every time a buffer is read out
+    for (size_t block : {2, 40, 8, 52, 16}) {
+        for (size_t offset = block * mb; offset < (block + 4) * mb; offset += mb) {
+            check_read(offset);
+        }
+    }
+    EXPECT_EQ(reader._window, 1);
+    // buffers out of the window are released
+    size_t allocated = 0;
+    for (auto& buffer : reader._pre_buffers) {
+        allocated += buffer->_buf != nullptr;
+    }
+    EXPECT_LE(allocated, reader._window);
+}
+
 TEST_F(BufferedReaderTest, test_read_amplify) {
     size_t kb = 1024;
     io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(2048 * kb); // 2MB
@@ -0,0 +1,134 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/persistent_meta_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "common/status.h"
+#include "io/fs/local_file_system.h"
+
+namespace doris {
+
+static constexpr std::string_view test_dir = "ut_dir/persistent_meta_cache_test";
+
+class PersistentMetaCacheTest : public testing::Test {
+public:
+    void SetUp() override {
+        Status st = io::global_local_filesystem()->delete_directory(test_dir);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+
+    void TearDown() override {
+        Status st = io::global_local_filesystem()->delete_directory(test_dir);
+        EXPECT_TRUE(st.ok()) << st;
+    }
+};
+
+TEST_F(PersistentMetaCacheTest, insert_and_lookup) {
+    PersistentMetaCache cache(std::string(test_dir), 1024 * 1024);
+    ASSERT_TRUE(cache.init().ok());
+    cache.wait_for_loading();
+
+    std::string value;
+    EXPECT_FALSE(cache.lookup("segment:a", &value));
+    ASSERT_TRUE(cache.insert("segment:a", "footer of a").ok());
+    ASSERT_TRUE(cache.insert("segment:b", std::string(1000, 'b')).ok());
+    ASSERT_TRUE(cache.lookup("segment:a", &value));
+    EXPECT_EQ(value, "footer of a");
+    ASSERT_TRUE(cache.lookup("segment:b", &value));
+    EXPECT_EQ(value, std::string(1000, 'b'));
+    EXPECT_EQ(cache.entry_num(), 2);
+
+    // overwrite
+    ASSERT_TRUE(cache.insert("segment:a", "new footer of a").ok());
+    ASSERT_TRUE(cache.lookup("segment:a", &value));
+    EXPECT_EQ(value, "new footer of a");
+    EXPECT_EQ(cache.entry_num(), 2);
+
+    cache.remove("segment:a");
+    EXPECT_FALSE(cache.lookup("segment:a", &value));
+    EXPECT_EQ(cache.entry_num(), 1);
+
+    // too large to be cached
+    ASSERT_TRUE(cache.insert("segment:c", std::string(200 * 1024, 'c')).ok());
+    EXPECT_FALSE(cache.lookup("segment:c", &value));
+}
+
+TEST_F(PersistentMetaCacheTest, reload_after_restart) {
+    {
+        PersistentMetaCache cache(std::string(test_dir), 1024 * 1024);
+        ASSERT_TRUE(cache.init().ok());
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_TRUE(cache.insert("key" + std::to_string(i), "value" + std::to_string(i)).ok());
+        }
+    }
+    PersistentMetaCache cache(std::string(test_dir), 1024 * 1024);
+    ASSERT_TRUE(cache.init().ok());
+    cache.wait_for_loading();
+    EXPECT_EQ(cache.entry_num(), 10);
+    int64_t size = cache.size();
+    EXPECT_GT(size, 0);
+    for (int i = 0; i < 10; ++i) {
+        std::string value;
+        ASSERT_TRUE(cache.lookup("key" + std::to_string(i), &value));
+        EXPECT_EQ(value, "value" + std::to_string(i));
+    }
+    EXPECT_EQ(cache.size(), size);
+}
+
+TEST_F(PersistentMetaCacheTest, evict_oldest) {
+    PersistentMetaCache cache(std::string(test_dir), 10 * 1024);
+    ASSERT_TRUE(cache.init().ok());
+    cache.wait_for_loading();
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(cache.insert("key" + std::to_string(i), std::string(1000, 'x')).ok());
+    }
+    EXPECT_LE(cache.size(), 10 * 1024);
+    std::string value;
+    EXPECT_FALSE(cache.lookup("key0", &value));
+    EXPECT_TRUE(cache.lookup("key19", &value));
+    size_t num_files = 0;
+    for (auto& entry : std::filesystem::recursive_directory_iterator(test_dir)) {
+        num_files += entry.is_regular_file();
+    }
+    EXPECT_EQ(num_files, cache.entry_num());
+}
+
+TEST_F(PersistentMetaCacheTest, corrupted_entry) {
+    PersistentMetaCache cache(std::string(test_dir), 1024 * 1024);
+    ASSERT_TRUE(cache.init().ok());
+    cache.wait_for_loading();
+    ASSERT_TRUE(cache.insert("key", "value").ok());
+    for (auto& entry : std::filesystem::recursive_directory_iterator(test_dir)) {
+        if (entry.is_regular_file()) {
+            std::fstream file(entry.path(), std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(10);
+            file.put('z');
+        }
+    }
+    std::string value;
+    EXPECT_FALSE(cache.lookup("key", &value));
+    EXPECT_EQ(cache.entry_num(), 0);
+    EXPECT_EQ(cache.size(), 0);
+}
+
+} // namespace doris
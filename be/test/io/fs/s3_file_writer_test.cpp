@@ -836,6 +836,34 @@ TEST_F(S3FileWriterTest, normal) {
     ASSERT_EQ(0, std::memcmp(content.data(), s.get_data(), file_size));
 }
 
+TEST_F(S3FileWriterTest, part_size_grows) {
+    mock_client = std::make_shared<MockS3Client>();
+    doris::io::FileWriterOptions state;
+    io::FileWriterPtr s3_file_writer;
+    auto st = s3_fs->create_file("part_size_grows", &s3_file_writer, &state);
+    ASSERT_TRUE(st.ok()) << st;
+    auto* writer = dynamic_cast<io::S3FileWriter*>(s3_file_writer.get());
+    auto old_grow_parts = config::s3_write_buffer_grow_parts;
+    auto old_max_size = config::s3_write_buffer_max_size;
+    Defer defer {[&]() {
+        config::s3_write_buffer_grow_parts = old_grow_parts;
+        config::s3_write_buffer_max_size = old_max_size;
+    }};
+    config::s3_write_buffer_grow_parts = 2;
+    config::s3_write_buffer_max_size = 4 * config::s3_write_buffer_size;
+    std::vector<size_t> expected_sizes {1, 1, 2, 2, 4, 4, 4};
+    for (size_t i = 0; i < expected_sizes.size(); i++) {
+        writer->_cur_part_num = static_cast<int>(i + 1);
+        EXPECT_EQ(writer->_part_size(),
+                  expected_sizes[i] * static_cast<size_t>(config::s3_write_buffer_size))
+                << i;
+    }
+    config::s3_write_buffer_grow_parts = 0;
+    EXPECT_EQ(writer->_part_size(), static_cast<size_t>(config::s3_write_buffer_size));
+    writer->_cur_part_num = 1;
+    ASSERT_TRUE(s3_file_writer->close().ok());
+}
+
 TEST_F(S3FileWriterTest, smallFile) {
     mock_client = std::make_shared<MockS3Client>();
     doris::io::FileWriterOptions state;
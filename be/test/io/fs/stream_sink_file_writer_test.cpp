@@ -20,6 +20,7 @@
 #include <brpc/channel.h>
 #include <brpc/server.h>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
 #include "util/debug/leakcheck_disabler.h"
@@ -47,6 +48,7 @@ const std::string DATA0 = "segment data";
 const std::string DATA1 = "hello world";
 
 static std::atomic<int64_t> g_num_request;
+static bool g_buffered = false;
 
 class StreamSinkFileWriterTest : public testing::Test {
     class MockStreamStub : public LoadStreamStub {
@@ -66,7 +68,13 @@ class StreamSinkFileWriterTest : public testing::Test {
             EXPECT_EQ(INDEX_ID, index_id);
             EXPECT_EQ(TABLET_ID, tablet_id);
             EXPECT_EQ(SEGMENT_ID, segment_id);
-            if (segment_eos) {
+            if (g_buffered) {
+                // small appends are buffered and carried by the eos request
+                EXPECT_TRUE(segment_eos);
+                EXPECT_EQ(1, data.size());
+                EXPECT_EQ(DATA0 + DATA1, data[0].to_string());
+                EXPECT_EQ(0, offset);
+            } else if (segment_eos) {
                 EXPECT_EQ(0, data.size());
                 EXPECT_EQ(DATA0.length() + DATA1.length(), offset);
             } else {
@@ -93,13 +101,18 @@ protected:
         }
     }
 
-    virtual void TearDown() {}
+    virtual void TearDown() {
+        config::stream_sink_file_writer_buffer_bytes = _buffer_bytes;
+        g_buffered = false;
+    }
 
     PUniqueId _load_id;
     std::vector<std::shared_ptr<LoadStreamStub>> _streams;
+    int64_t _buffer_bytes = config::stream_sink_file_writer_buffer_bytes;
 };
 
 TEST_F(StreamSinkFileWriterTest, Test) {
+    config::stream_sink_file_writer_buffer_bytes = 0;
     g_num_request = 0;
     io::StreamSinkFileWriter writer(_streams);
     writer.init(_load_id, PARTITION_ID, INDEX_ID, TABLET_ID, SEGMENT_ID);
@@ -111,4 +124,21 @@ TEST_F(StreamSinkFileWriterTest, Test) {
     EXPECT_EQ(NUM_STREAM * 2, g_num_request);
 }
 
+TEST_F(StreamSinkFileWriterTest, TestBufferSmallAppends) {
+    config::stream_sink_file_writer_buffer_bytes = 1024;
+    g_buffered = true;
+    g_num_request = 0;
+    io::StreamSinkFileWriter writer(_streams);
+    writer.init(_load_id, PARTITION_ID, INDEX_ID, TABLET_ID, SEGMENT_ID);
+    Slice data0(DATA0);
+    Slice data1(DATA1);
+
+    CHECK_STATUS_OK(writer.appendv(&data0, 1));
+    CHECK_STATUS_OK(writer.appendv(&data1, 1));
+    EXPECT_EQ(0, g_num_request);
+    EXPECT_EQ(DATA0.length() + DATA1.length(), writer.bytes_appended());
+    CHECK_STATUS_OK(writer.close());
+    EXPECT_EQ(NUM_STREAM, g_num_request);
+}
+
 } // namespace doris
@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/cumulative_compaction_leveled_policy.h"
+
+#include <gen_cpp/AgentService_types.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+#include "json2pb/json_to_pb.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/rowset_meta.h"
+#include "olap/storage_engine.h"
+#include "olap/tablet.h"
+#include "olap/tablet_meta.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+static constexpr int64_t MB = 1024 * 1024;
+
+class TestLeveledCumulativeCompactionPolicy : public testing::Test {
+public:
+    TestLeveledCumulativeCompactionPolicy() : _engine(StorageEngine({})) {}
+
+    void SetUp() override {
+        config::compaction_promotion_size_mbytes = 1024;
+        config::compaction_promotion_ratio = 0.05;
+        config::compaction_promotion_min_size_mbytes = 64;
+        config::compaction_leveled_base_size_mbytes = 8;
+        config::compaction_leveled_size_ratio = 4;
+
+        _tablet_meta.reset(new TabletMeta(1, 2, 15673, 15674, 4, 5, TTabletSchema(), 6, {{7, 8}},
+                                          UniqueId(9, 10), TTabletType::TABLET_TYPE_DISK,
+                                          TCompressionType::LZ4F));
+        _tablet_meta->set_compaction_policy(std::string(CUMULATIVE_LEVELED_POLICY));
+
+        _json_rowset_meta = R"({
+            "rowset_id": 540081,
+            "tablet_id": 15673,
+            "txn_id": 4042,
+            "tablet_schema_hash": 567997577,
+            "rowset_type": "BETA_ROWSET",
+            "rowset_state": "VISIBLE",
+            "start_version": 2,
+            "end_version": 2,
+            "num_rows": 3929,
+            "total_disk_size": 41,
+            "data_disk_size": 41,
+            "index_disk_size": 235,
+            "empty": false,
+            "load_id": {
+                "hi": -5350970832824939812,
+                "lo": -6717994719194512122
+            },
+            "creation_time": 1553765670,
+            "num_segments": 1
+        })";
+    }
+
+    void add_rs_meta(int64_t start, int64_t end, int64_t size, const std::string& min_key,
+                     const std::string& max_key) {
+        RowsetMetaPB rowset_meta_pb;
+        json2pb::JsonToProtoMessage(_json_rowset_meta, &rowset_meta_pb);
+        rowset_meta_pb.set_start_version(start);
+        rowset_meta_pb.set_end_version(end);
+        rowset_meta_pb.set_creation_time(10000);
+        auto* key_bounds = rowset_meta_pb.add_segments_key_bounds();
+        key_bounds->set_min_key(min_key);
+        key_bounds->set_max_key(max_key);
+
+        RowsetMetaSharedPtr rs_meta(new RowsetMeta());
+        rs_meta->init_from_pb(rowset_meta_pb);
+        rs_meta->set_total_disk_size(size);
+        rs_meta->set_segments_overlap(NONOVERLAPPING);
+        rs_meta->set_tablet_schema(_tablet_meta->tablet_schema());
+        static_cast<void>(_tablet_meta->add_rs_meta(rs_meta));
+    }
+
+    TabletSharedPtr create_tablet() {
+        TabletSharedPtr tablet(
+                new Tablet(_engine, _tablet_meta, nullptr, CUMULATIVE_LEVELED_POLICY));
+        static_cast<void>(tablet->init());
+        tablet->calculate_cumulative_point();
+        return tablet;
+    }
+
+protected:
+    std::string _json_rowset_meta;
+    TabletMetaSharedPtr _tablet_meta;
+
+private:
+    StorageEngine _engine;
+};
+
+TEST_F(TestLeveledCumulativeCompactionPolicy, no_full_level) {
+    add_rs_meta(0, 1, 1024 * MB, "a", "z");
+    // level 1: 2 rowsets, level 0: 3 rowsets, none reaches the ratio of 4
+    add_rs_meta(2, 3, 10 * MB, "a", "z");
+    add_rs_meta(4, 5, 10 * MB, "a", "z");
+    add_rs_meta(6, 6, MB, "a", "z");
+    add_rs_meta(7, 7, MB, "a", "z");
+    add_rs_meta(8, 8, MB, "a", "z");
+    auto tablet = create_tablet();
+    EXPECT_EQ(2, tablet->cumulative_layer_point());
+    auto& policy = tablet->_cumulative_compaction_policy;
+    EXPECT_EQ(0, policy->calc_cumulative_compaction_score(tablet.get()));
+
+    auto candidate_rowsets = tablet->pick_candidate_rowsets_to_cumulative_compaction();
+    std::vector<RowsetSharedPtr> input_rowsets;
+    Version last_delete_version {-1, -1};
+    size_t compaction_score = 0;
+    tablet->_cumulative_compaction_policy->pick_input_rowsets(
+            tablet.get(), candidate_rowsets, 100, 5, &input_rowsets, &last_delete_version,
+            &compaction_score, false);
+    EXPECT_TRUE(input_rowsets.empty());
+    EXPECT_EQ(0, compaction_score);
+}
+
+TEST_F(TestLeveledCumulativeCompactionPolicy, pick_full_level) {
+    add_rs_meta(0, 1, 1024 * MB, "a", "z");
+    add_rs_meta(2, 3, 10 * MB, "a", "z");
+    add_rs_meta(4, 4, MB, "a", "z");
+    add_rs_meta(5, 5, MB, "a", "z");
+    add_rs_meta(6, 6, MB, "a", "z");
+    add_rs_meta(7, 7, MB, "a", "z");
+    auto tablet = create_tablet();
+    auto& policy = tablet->_cumulative_compaction_policy;
+    EXPECT_EQ(4, policy->calc_cumulative_compaction_score(tablet.get()));
+
+    auto candidate_rowsets = tablet->pick_candidate_rowsets_to_cumulative_compaction();
+    std::vector<RowsetSharedPtr> input_rowsets;
+    Version last_delete_version {-1, -1};
+    size_t compaction_score = 0;
+    tablet->_cumulative_compaction_policy->pick_input_rowsets(
+            tablet.get(), candidate_rowsets, 100, 5, &input_rowsets, &last_delete_version,
+            &compaction_score, false);
+    ASSERT_EQ(4, input_rowsets.size());
+    EXPECT_EQ(4, input_rowsets.front()->start_version());
+    EXPECT_EQ(7, input_rowsets.back()->end_version());
+    EXPECT_EQ(4, compaction_score);
+}
+
+TEST_F(TestLeveledCumulativeCompactionPolicy, prefer_overlapping_keys) {
+    add_rs_meta(0, 1, 1024 * MB, "a", "z");
+    // level 1 is full but the rowsets are disjoint in key range
+    add_rs_meta(2, 3, 10 * MB, "a", "b");
+    add_rs_meta(4, 5, 10 * MB, "c", "d");
+    add_rs_meta(6, 7, 10 * MB, "e", "f");
+    add_rs_meta(8, 9, 10 * MB, "g", "h");
+    // level 0 is full and every rowset overlaps the previous one
+    add_rs_meta(10, 10, MB, "a", "z");
+    add_rs_meta(11, 11, MB, "a", "z");
+    add_rs_meta(12, 12, MB, "a", "z");
+    add_rs_meta(13, 13, MB, "a", "z");
+    auto tablet = create_tablet();
+
+    auto candidate_rowsets = tablet->pick_candidate_rowsets_to_cumulative_compaction();
+    std::vector<RowsetSharedPtr> input_rowsets;
+    Version last_delete_version {-1, -1};
+    size_t compaction_score = 0;
+    tablet->_cumulative_compaction_policy->pick_input_rowsets(
+            tablet.get(), candidate_rowsets, 100, 5, &input_rowsets, &last_delete_version,
+            &compaction_score, false);
+    ASSERT_EQ(4, input_rowsets.size());
+    EXPECT_EQ(10, input_rowsets.front()->start_version());
+    EXPECT_EQ(13, input_rowsets.back()->end_version());
+}
+
+} // namespace doris
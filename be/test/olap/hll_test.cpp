@@ -194,6 +194,31 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    // explicit only, explicit converted to registers in the batch, and registers only
+    for (size_t num : {10, 1000, 100000}) {
+        std::vector<uint64_t> hash_values;
+        for (size_t i = 0; i < num; ++i) {
+            hash_values.push_back(hash(i));
+        }
+        HyperLogLog expected_hll;
+        for (auto hash_value : hash_values) {
+            expected_hll.update(hash_value);
+        }
+        HyperLogLog batch_hll;
+        batch_hll.update_batch(hash_values.data(), hash_values.size() / 2);
+        batch_hll.update_batch(hash_values.data() + hash_values.size() / 2,
+                               hash_values.size() - hash_values.size() / 2);
+        EXPECT_EQ(expected_hll.estimate_cardinality(), batch_hll.estimate_cardinality());
+
+        std::string expected(expected_hll.max_serialized_size(), '\0');
+        expected.resize(expected_hll.serialize((uint8_t*)expected.data()));
+        std::string actual(batch_hll.max_serialized_size(), '\0');
+        actual.resize(batch_hll.serialize((uint8_t*)actual.data()));
+        EXPECT_EQ(expected, actual);
+    }
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
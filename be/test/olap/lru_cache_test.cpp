@@ -399,6 +399,60 @@ TEST_F(CacheTest, UsageLRUK) {
     ASSERT_EQ(896, cache.get_usage());
 }
 
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(10);
+    cache.set_tinylfu_admission(true);
+
+    auto key_of = [](int k) { return std::to_string(k); };
+    auto lookup = [&](int k) {
+        std::string key_str = key_of(k);
+        CacheKey key(key_str);
+        auto* handle = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        cache.release(handle);
+        return handle != nullptr;
+    };
+    auto insert = [&](int k) {
+        std::string key_str = key_of(k);
+        insert_number_LRUCache(cache, CacheKey(key_str), k, 1, CachePriority::NORMAL);
+    };
+
+    // entries are admitted freely before the cache is full
+    for (int k = 0; k < 10; ++k) {
+        insert(k);
+    }
+    ASSERT_EQ(10, cache.get_usage());
+    ASSERT_EQ(0, cache.get_admission_reject_count());
+    // 0-4 are hot
+    for (int round = 0; round < 3; ++round) {
+        for (int k = 0; k < 5; ++k) {
+            ASSERT_TRUE(lookup(k));
+        }
+    }
+
+    // a scan touches each key once, it replaces the cold entries but not the hot ones
+    for (int k = 100; k < 200; ++k) {
+        if (!lookup(k)) {
+            insert(k);
+        }
+    }
+    for (int k = 0; k < 5; ++k) {
+        ASSERT_TRUE(lookup(k));
+    }
+    for (int k = 5; k < 10; ++k) {
+        ASSERT_FALSE(lookup(k));
+    }
+    ASSERT_EQ(10, cache.get_usage());
+    ASSERT_GT(cache.get_admission_reject_count(), 0);
+
+    // a key accessed often enough is eventually admitted
+    int k = 1000;
+    for (int round = 0; round < 10 && !lookup(k); ++round) {
+        insert(k);
+    }
+    ASSERT_TRUE(lookup(k));
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
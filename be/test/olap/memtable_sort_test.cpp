@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <memory>
+#include <random>
+
 #include "olap/memtable.h"
 
 namespace doris {
@@ -80,4 +84,31 @@ TEST_F(MemTableSortTest, Tie) {
     EXPECT_FALSE(it3.next());
 }
 
+TEST_F(MemTableSortTest, RadixSortByNormalizedKey) {
+    std::mt19937_64 rng(42);
+    std::vector<std::unique_ptr<RowInBlock>> row_holder;
+    std::vector<std::pair<uint64_t, RowInBlock*>> rows;
+    for (size_t i = 0; i < 1000; i++) {
+        row_holder.emplace_back(std::make_unique<RowInBlock>(i));
+        // few distinct values in the high byte and many duplicated keys
+        uint64_t key = ((rng() % 4) << 40) | (rng() % 64);
+        rows.emplace_back(key, row_holder.back().get());
+    }
+    auto expected = rows;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    radix_sort_by_normalized_key(rows, 6);
+    ASSERT_EQ(rows.size(), expected.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+        EXPECT_EQ(rows[i].first, expected[i].first);
+        // the sort is stable
+        EXPECT_EQ(rows[i].second, expected[i].second);
+    }
+
+    std::vector<std::pair<uint64_t, RowInBlock*>> single {{7, row_holder[0].get()}};
+    radix_sort_by_normalized_key(single, 8);
+    EXPECT_EQ(single[0].first, uint64_t(7));
+}
+
 } // namespace doris
@@ -286,4 +286,43 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+// Part of the data page budget goes to the compressed tier
+TEST_F(StoragePageCacheTest, compressed_data_page) {
+    StoragePageCache cache(kNumShards * 4096, 0, 0, kNumShards, 50);
+    EXPECT_TRUE(cache.has_compressed_page_cache());
+
+    StoragePageCache::CacheKey key("abc", 0, 0);
+    segment_v2::PageTypePB page_type = segment_v2::DATA_PAGE;
+
+    {
+        PageCacheHandle handle;
+        auto* data = new DataPage(1024, true, page_type);
+        cache.insert_compressed(key, data, &handle);
+        EXPECT_EQ(handle.data().data, data->data());
+    }
+
+    // the tiers are independent
+    {
+        PageCacheHandle handle;
+        EXPECT_TRUE(cache.lookup_compressed(key, &handle));
+        EXPECT_FALSE(cache.lookup(key, &handle, page_type));
+    }
+    {
+        PageCacheHandle handle;
+        auto* data = new DataPage(1024, true, page_type);
+        cache.insert(key, data, &handle, page_type, false);
+        EXPECT_TRUE(cache.lookup(key, &handle, page_type));
+        EXPECT_EQ(data->data(), handle.data().data);
+    }
+
+    {
+        PageCacheHandle handle;
+        StoragePageCache::CacheKey miss_key("abc", 0, 1);
+        EXPECT_FALSE(cache.lookup_compressed(miss_key, &handle));
+    }
+
+    StoragePageCache no_compressed_cache(kNumShards * 2048, 0, 0, kNumShards);
+    EXPECT_FALSE(no_compressed_cache.has_compressed_page_cache());
+}
+
 } // namespace doris
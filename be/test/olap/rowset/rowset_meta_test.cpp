@@ -32,6 +32,7 @@
 #include "gtest/gtest_pred_impl.h"
 #include "olap/olap_common.h"
 #include "olap/olap_meta.h"
+#include "olap/tablet_schema.h"
 
 using ::testing::_;
 using ::testing::Return;
@@ -114,6 +115,34 @@ TEST_F(RowsetMetaTest, TestInitWithInvalidData) {
     EXPECT_FALSE(rowset_meta.init("invalid pb meta data"));
 }
 
+TEST_F(RowsetMetaTest, TestShareTabletSchema) {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(DUP_KEYS);
+    auto* column = schema_pb.add_column();
+    column->set_unique_id(0);
+    column->set_name("k1");
+    column->set_type("INT");
+    column->set_is_key(true);
+
+    RowsetMeta rowset_meta;
+    rowset_meta.set_tablet_schema(schema_pb);
+    ASSERT_NE(nullptr, rowset_meta.tablet_schema());
+
+    RowsetMeta shared_rowset_meta;
+    shared_rowset_meta.share_tablet_schema(rowset_meta);
+    EXPECT_EQ(rowset_meta.tablet_schema().get(), shared_rowset_meta.tablet_schema().get());
+
+    {
+        // The shared rowset meta holds its own reference on the cached schema
+        RowsetMeta tmp_rowset_meta;
+        tmp_rowset_meta.share_tablet_schema(shared_rowset_meta);
+        EXPECT_EQ(rowset_meta.tablet_schema().get(), tmp_rowset_meta.tablet_schema().get());
+    }
+    RowsetMeta rowset_meta_2;
+    rowset_meta_2.set_tablet_schema(schema_pb);
+    EXPECT_EQ(rowset_meta.tablet_schema().get(), rowset_meta_2.tablet_schema().get());
+}
+
 TEST_F(RowsetMetaTest, TestRowsetIdInit) {
     RowsetId id {};
     config::force_regenerate_rowsetid_on_start_error = true;
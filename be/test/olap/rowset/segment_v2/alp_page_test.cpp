@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <FieldType Type, typename ColumnType>
+    size_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(AlpPageBuilder<Type>::create(&builder_ptr, builder_options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t count = src.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &count).ok());
+        EXPECT_EQ(src.size(), count);
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+
+        AlpPageDecoder<Type> decoder(page.slice(), PageDecoderOptions());
+        EXPECT_TRUE(decoder.init().ok());
+        EXPECT_EQ(src.size(), decoder.count());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t n = src.size();
+        EXPECT_TRUE(decoder.next_batch(&n, column).ok());
+        EXPECT_EQ(src.size(), n);
+        const auto& data = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < src.size(); ++i) {
+            // bitwise, so NaN and negative zero count too
+            EXPECT_EQ(0, memcmp(&src[i], &data[i], sizeof(CppType))) << "at " << i;
+        }
+
+        if (src.size() > 10) {
+            EXPECT_TRUE(decoder.seek_to_position_in_page(10).ok());
+            column = ColumnType::create();
+            n = 1;
+            EXPECT_TRUE(decoder.next_batch(&n, column).ok());
+            EXPECT_EQ(1, n);
+            EXPECT_EQ(11, decoder.current_index());
+            const CppType value = assert_cast<const ColumnType&>(*column).get_data()[0];
+            EXPECT_EQ(0, memcmp(&src[10], &value, sizeof(CppType)));
+        }
+        return page.slice().size;
+    }
+};
+
+TEST_F(AlpPageTest, DecimalDoubles) {
+    std::mt19937 rng(0);
+    std::vector<double> src;
+    for (int i = 0; i < 10000; ++i) {
+        // sensor readings with two decimal digits
+        src.push_back(static_cast<double>(2000 + static_cast<int>(rng() % 1000)) / 100);
+    }
+    size_t size = test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(
+            src);
+    EXPECT_LT(size, src.size() * sizeof(double) / 4);
+}
+
+TEST_F(AlpPageTest, DecimalFloats) {
+    std::vector<float> src;
+    for (int i = 0; i < 5000; ++i) {
+        src.push_back(static_cast<float>(i % 500) / 10);
+    }
+    size_t size = test_encode_decode<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>(
+            src);
+    EXPECT_LT(size, src.size() * sizeof(float) / 2);
+}
+
+TEST_F(AlpPageTest, Exceptions) {
+    std::mt19937_64 rng(0);
+    std::vector<double> src;
+    for (int i = 0; i < 3000; ++i) {
+        src.push_back(static_cast<double>(i) / 4);
+    }
+    src[7] = std::numeric_limits<double>::quiet_NaN();
+    src[100] = std::numeric_limits<double>::infinity();
+    src[1500] = -0.0;
+    src[2000] = std::numeric_limits<double>::max();
+    src[2999] = M_PI;
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(src);
+
+    // no decimal structure at all, every value is an exception
+    std::vector<double> random_bits;
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t bits = rng();
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        random_bits.push_back(value);
+    }
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(
+            random_bits);
+}
+
+TEST_F(AlpPageTest, SmallPages) {
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>({});
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>({1.5});
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>(
+            {0.1f, 0.2f, 0.3f});
+}
+
+TEST_F(AlpPageTest, TruncatedPage) {
+    std::vector<double> src(2000, 1.25);
+    src[10] = M_E;
+    PageBuilderOptions builder_options;
+    PageBuilder* builder_ptr = nullptr;
+    EXPECT_TRUE(
+            AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE>::create(&builder_ptr, builder_options)
+                    .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = src.size();
+    EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &count).ok());
+    OwnedSlice page;
+    EXPECT_TRUE(builder->finish(&page).ok());
+
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(truncated, PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -299,4 +299,32 @@ TEST_F(BloomFilterTest, TestInitWithInvalidInputs) {
     uint32_t non_power_of_two_size = 1000; // Not a power of two
     st = bf->init(buffer, non_power_of_two_size, HASH_MURMUR3_X64_64);
     EXPECT_EQ(st.code(), TStatusCode::INVALID_ARGUMENT);
-}
\ No newline at end of file
+}
+// All grams of a pattern are probed in one pass against a page filter
+TEST_F(BloomFilterTest, TestNGramContainsAllGrams) {
+    // 1000 bytes is not a multiple of the probing block, the tail words are probed too
+    size_t bf_size = 1000;
+    std::unique_ptr<BloomFilter> page_bf;
+    EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &page_bf, bf_size).ok());
+    for (const std::string gram : {"abc", "bcd", "cde"}) {
+        page_bf->add_bytes(gram.data(), gram.size());
+    }
+
+    std::unique_ptr<BloomFilter> read_bf;
+    EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &read_bf, bf_size).ok());
+    EXPECT_TRUE(read_bf->init(page_bf->data(), page_bf->size(), CITY_HASH_64).ok());
+
+    std::unique_ptr<BloomFilter> hit_bf;
+    EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &hit_bf, bf_size).ok());
+    for (const std::string gram : {"abc", "bcd"}) {
+        hit_bf->add_bytes(gram.data(), gram.size());
+    }
+    EXPECT_TRUE(read_bf->contains(*hit_bf));
+
+    std::unique_ptr<BloomFilter> miss_bf;
+    EXPECT_TRUE(BloomFilter::create(NGRAM_BLOOM_FILTER, &miss_bf, bf_size).ok());
+    for (const std::string gram : {"abc", "xyz"}) {
+        miss_bf->add_bytes(gram.data(), gram.size());
+    }
+    EXPECT_FALSE(read_bf->contains(*miss_bf));
+}
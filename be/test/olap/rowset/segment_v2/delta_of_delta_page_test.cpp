@@ -0,0 +1,190 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/delta_of_delta_page.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class DeltaOfDeltaPageTest : public testing::Test {
+public:
+    template <FieldType Type, typename ColumnType>
+    size_t test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(DeltaOfDeltaPageBuilder<Type>::create(&builder_ptr, builder_options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t count = src.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &count).ok());
+        EXPECT_EQ(src.size(), count);
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+        if (!src.empty()) {
+            CppType first_value;
+            CppType last_value;
+            EXPECT_TRUE(builder->get_first_value(&first_value).ok());
+            EXPECT_TRUE(builder->get_last_value(&last_value).ok());
+            EXPECT_EQ(src.front(), first_value);
+            EXPECT_EQ(src.back(), last_value);
+        }
+
+        DeltaOfDeltaPageDecoder<Type> decoder(page.slice(), PageDecoderOptions());
+        EXPECT_TRUE(decoder.init().ok());
+        EXPECT_EQ(src.size(), decoder.count());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t n = src.size();
+        EXPECT_TRUE(decoder.next_batch(&n, column).ok());
+        EXPECT_EQ(src.size(), n);
+        const auto& data = assert_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < src.size(); ++i) {
+            EXPECT_EQ(src[i], data[i]) << "at " << i;
+        }
+
+        if (!src.empty()) {
+            std::vector<rowid_t> rowids;
+            for (rowid_t i = 0; i < src.size(); i += 7) {
+                rowids.push_back(i + 100);
+            }
+            column = ColumnType::create();
+            n = rowids.size();
+            EXPECT_TRUE(decoder.read_by_rowids(rowids.data(), 100, &n, column).ok());
+            EXPECT_EQ(rowids.size(), n);
+            const auto& selected = assert_cast<const ColumnType&>(*column).get_data();
+            for (size_t i = 0; i < rowids.size(); ++i) {
+                EXPECT_EQ(src[rowids[i] - 100], selected[i]);
+            }
+        }
+        return page.slice().size;
+    }
+};
+
+TEST_F(DeltaOfDeltaPageTest, RegularTimestamps) {
+    std::vector<int64_t> src;
+    for (int64_t i = 0; i < 10000; ++i) {
+        src.push_back(1700000000000 + i * 1000);
+    }
+    size_t size = test_encode_decode<FieldType::OLAP_FIELD_TYPE_BIGINT, vectorized::ColumnInt64>(
+            src);
+    // constant interval takes no bits besides the block headers
+    EXPECT_LT(size, 1024);
+}
+
+TEST_F(DeltaOfDeltaPageTest, JitteredTimestamps) {
+    std::mt19937 rng(0);
+    std::vector<uint64_t> src;
+    uint64_t value = 1700000000000000;
+    for (int i = 0; i < 10000; ++i) {
+        value += 1000000 + rng() % 64;
+        src.push_back(value);
+    }
+    size_t size =
+            test_encode_decode<FieldType::OLAP_FIELD_TYPE_DATETIMEV2, vectorized::ColumnUInt64>(
+                    src);
+    EXPECT_LT(size, src.size() * sizeof(uint64_t) / 4);
+}
+
+TEST_F(DeltaOfDeltaPageTest, RandomValues) {
+    std::mt19937 rng(0);
+    std::vector<int32_t> src;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(static_cast<int32_t>(rng()));
+    }
+    src.push_back(std::numeric_limits<int32_t>::min());
+    src.push_back(std::numeric_limits<int32_t>::max());
+    src.push_back(std::numeric_limits<int32_t>::min());
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_INT, vectorized::ColumnInt32>(src);
+}
+
+TEST_F(DeltaOfDeltaPageTest, SmallPages) {
+    for (size_t size = 0; size < 5; ++size) {
+        std::vector<uint32_t> src;
+        for (size_t i = 0; i < size; ++i) {
+            src.push_back(static_cast<uint32_t>(20240101 + i * i));
+        }
+        test_encode_decode<FieldType::OLAP_FIELD_TYPE_DATEV2, vectorized::ColumnUInt32>(src);
+    }
+}
+
+TEST_F(DeltaOfDeltaPageTest, SeekAtOrAfterValue) {
+    std::vector<int64_t> src;
+    for (int64_t i = 0; i < 1000; ++i) {
+        src.push_back(i * 10);
+    }
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    EXPECT_TRUE(DeltaOfDeltaPageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT>::create(
+                        &builder_ptr, builder_options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = src.size();
+    EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &count).ok());
+    OwnedSlice page;
+    EXPECT_TRUE(builder->finish(&page).ok());
+
+    DeltaOfDeltaPageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT> decoder(page.slice(),
+                                                                        PageDecoderOptions());
+    EXPECT_TRUE(decoder.init().ok());
+    bool exact_match = false;
+    int64_t value = 500;
+    EXPECT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_TRUE(exact_match);
+    EXPECT_EQ(50, decoder.current_index());
+    value = 505;
+    EXPECT_TRUE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+    EXPECT_FALSE(exact_match);
+    EXPECT_EQ(51, decoder.current_index());
+    value = 100000;
+    EXPECT_FALSE(decoder.seek_at_or_after_value(&value, &exact_match).ok());
+}
+
+TEST_F(DeltaOfDeltaPageTest, TruncatedPage) {
+    std::vector<int64_t> src(1000, 7);
+    src[500] = 1 << 20;
+    PageBuilderOptions builder_options;
+    PageBuilder* builder_ptr = nullptr;
+    EXPECT_TRUE(DeltaOfDeltaPageBuilder<FieldType::OLAP_FIELD_TYPE_BIGINT>::create(
+                        &builder_ptr, builder_options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t count = src.size();
+    EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &count).ok());
+    OwnedSlice page;
+    EXPECT_TRUE(builder->finish(&page).ok());
+
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    DeltaOfDeltaPageDecoder<FieldType::OLAP_FIELD_TYPE_BIGINT> decoder(truncated,
+                                                                        PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "gtest/gtest_pred_impl.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::segment_v2 {
+
+// Produces INT values 0, 1, 2, ... with every third value being null.
+class MockIntColumnIterator : public ColumnIterator {
+public:
+    Status seek_to_first() override {
+        _ordinal = 0;
+        return Status::OK();
+    }
+
+    Status seek_to_ordinal(ordinal_t ord) override {
+        _ordinal = ord;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst, bool* has_null) override {
+        for (size_t i = 0; i < *n; ++i) {
+            _insert(dst, _ordinal++);
+        }
+        *has_null = true;
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, const size_t count,
+                          vectorized::MutableColumnPtr& dst) override {
+        for (size_t i = 0; i < count; ++i) {
+            _insert(dst, rowids[i]);
+        }
+        return Status::OK();
+    }
+
+    ordinal_t get_current_ordinal() const override { return _ordinal; }
+
+private:
+    static void _insert(vectorized::MutableColumnPtr& dst, ordinal_t ord) {
+        auto& nullable = assert_cast<vectorized::ColumnNullable&>(*dst);
+        nullable.get_null_map_data().push_back(ord % 3 == 0);
+        assert_cast<vectorized::ColumnInt32&>(nullable.get_nested_column())
+                .insert_value(static_cast<int32_t>(ord));
+    }
+
+    ordinal_t _ordinal = 0;
+};
+
+TEST(WideningColumnIteratorTest, can_widen) {
+    EXPECT_TRUE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_TINYINT,
+                                                  FieldType::OLAP_FIELD_TYPE_LARGEINT));
+    EXPECT_TRUE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_INT,
+                                                  FieldType::OLAP_FIELD_TYPE_BIGINT));
+    EXPECT_TRUE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_FLOAT,
+                                                  FieldType::OLAP_FIELD_TYPE_DOUBLE));
+    EXPECT_FALSE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_BIGINT,
+                                                   FieldType::OLAP_FIELD_TYPE_INT));
+    EXPECT_FALSE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_INT,
+                                                   FieldType::OLAP_FIELD_TYPE_INT));
+    EXPECT_FALSE(WideningColumnIterator::can_widen(FieldType::OLAP_FIELD_TYPE_INT,
+                                                   FieldType::OLAP_FIELD_TYPE_DOUBLE));
+}
+
+TEST(WideningColumnIteratorTest, read_int_as_bigint) {
+    WideningColumnIterator iter(std::make_unique<MockIntColumnIterator>(),
+                                FieldType::OLAP_FIELD_TYPE_INT, FieldType::OLAP_FIELD_TYPE_BIGINT,
+                                true);
+    EXPECT_TRUE(iter.seek_to_ordinal(2).ok());
+
+    vectorized::MutableColumnPtr dst = vectorized::ColumnNullable::create(
+            vectorized::ColumnInt64::create(), vectorized::ColumnUInt8::create());
+    size_t n = 4;
+    bool has_null = false;
+    EXPECT_TRUE(iter.next_batch(&n, dst, &has_null).ok());
+    rowid_t rowids[] = {7, 9};
+    EXPECT_TRUE(iter.read_by_rowids(rowids, 2, dst).ok());
+    EXPECT_EQ(6, iter.get_current_ordinal());
+
+    const auto& nullable = assert_cast<const vectorized::ColumnNullable&>(*dst);
+    const auto& values =
+            assert_cast<const vectorized::ColumnInt64&>(nullable.get_nested_column()).get_data();
+    ASSERT_EQ(6, dst->size());
+    std::vector<int64_t> expected_values = {2, 3, 4, 5, 7, 9};
+    std::vector<bool> expected_nulls = {false, true, false, false, false, true};
+    for (size_t i = 0; i < expected_values.size(); ++i) {
+        EXPECT_EQ(expected_nulls[i], nullable.is_null_at(i));
+        EXPECT_EQ(expected_values[i], values[i]);
+    }
+
+    // a nullable file column can not be read into a not nullable column
+    vectorized::MutableColumnPtr not_null_dst = vectorized::ColumnInt64::create();
+    n = 1;
+    EXPECT_FALSE(iter.next_batch(&n, not_null_dst, &has_null).ok());
+}
+
+} // namespace doris::segment_v2
@@ -126,6 +126,15 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     dbmp->add({RowsetId {2, 0, 1, 1}, 1, 2}, 1104);
 
     ASSERT_EQ(dbmp->delete_bitmap.size(), 10 * 20 + 2);
+    ASSERT_EQ(dbmp->get_count_with_range({RowsetId {2, 0, 1, 1}, 1, 0},
+                                         {RowsetId {2, 0, 1, 1}, 1, 2}),
+              3);
+    ASSERT_EQ(dbmp->get_count_with_range({RowsetId {2, 0, 1, 1}, 1, 1},
+                                         {RowsetId {2, 0, 1, 1}, 1, 1}),
+              1);
+    ASSERT_EQ(dbmp->get_count_with_range({RowsetId {2, 0, 1, 1}, 2, 1},
+                                         {RowsetId {2, 0, 1, 1}, 2, 100}),
+              0);
 
     {
         auto snap = dbmp->snapshot(1);
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "pipeline/common/agg_utils.h"
+
+namespace doris::pipeline {
+
+TEST(AggregateDataContainerTest, RowLayout) {
+    AggregateDataContainer container(sizeof(uint32_t), 16);
+    std::vector<vectorized::AggregateDataPtr> places;
+    for (uint32_t key = 0; key < 10000; ++key) {
+        places.push_back(container.append_data(key));
+    }
+    EXPECT_EQ(places[1] - places[0], 16);
+
+    uint32_t key = 0;
+    for (auto it = container.begin(); it != container.end(); ++it, ++key) {
+        EXPECT_EQ(it.get_key<uint32_t>(), key);
+        EXPECT_EQ(it.get_aggregate_data(), places[key]);
+    }
+    EXPECT_EQ(key, 10000);
+}
+
+TEST(AggregateDataContainerTest, ColumnarLayout) {
+    static constexpr size_t STRIDE = 8;
+    static constexpr size_t NUM_STATES = 3;
+    const size_t offset = AggregateDataContainer::columnar_state_offset(STRIDE);
+    AggregateDataContainer container(sizeof(uint32_t), STRIDE, NUM_STATES);
+
+    // the states of every function of a group are writable without overlapping other groups
+    std::vector<vectorized::AggregateDataPtr> places;
+    for (uint32_t key = 0; key < 10000; ++key) {
+        auto* place = container.append_data(key);
+        for (size_t i = 0; i < NUM_STATES; ++i) {
+            *reinterpret_cast<uint64_t*>(place + i * offset) = key * NUM_STATES + i;
+        }
+        places.push_back(place);
+    }
+    auto* null_key_place = container.null_key_data();
+    for (size_t i = 0; i < NUM_STATES; ++i) {
+        *reinterpret_cast<uint64_t*>(null_key_place + i * offset) = UINT64_MAX;
+    }
+    // the states of one function are dense
+    EXPECT_EQ(places[1] - places[0], STRIDE);
+    EXPECT_EQ(places[0] - null_key_place, STRIDE);
+
+    // the slot of the null key is not iterated
+    uint32_t key = 0;
+    for (auto it = container.begin(); it != container.end(); ++it, ++key) {
+        EXPECT_EQ(it.get_key<uint32_t>(), key);
+        auto* place = it.get_aggregate_data();
+        EXPECT_EQ(place, places[key]);
+        for (size_t i = 0; i < NUM_STATES; ++i) {
+            EXPECT_EQ(*reinterpret_cast<uint64_t*>(place + i * offset), key * NUM_STATES + i);
+        }
+    }
+    EXPECT_EQ(key, 10000);
+}
+
+} // namespace doris::pipeline
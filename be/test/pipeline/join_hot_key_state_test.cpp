@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "pipeline/local_exchange/local_exchanger.h"
+
+namespace doris::pipeline {
+
+TEST(JoinHotKeyStateTest, NotSplitWithoutBothSides) {
+    auto state = JoinHotKeyState::create_shared(1);
+    state->has_probe_side = true;
+    EXPECT_FALSE(state->decided());
+    EXPECT_FALSE(state->probe_dependency->ready());
+    state->finish_planning();
+    EXPECT_TRUE(state->decided());
+    EXPECT_FALSE(state->has_hot_keys());
+    EXPECT_TRUE(state->probe_dependency->ready());
+}
+
+TEST(JoinHotKeyStateTest, DecideHotKeys) {
+    auto sample_blocks = config::hash_join_hot_key_sample_blocks;
+    config::hash_join_hot_key_sample_blocks = 2;
+    auto state = JoinHotKeyState::create_shared(1);
+    state->has_build_side = true;
+    state->has_probe_side = true;
+    state->finish_planning();
+    EXPECT_FALSE(state->decided());
+
+    // key 7 has half of the rows, which is 2 times of the average of 4 partitions
+    std::vector<uint32_t> hash_values;
+    for (uint32_t i = 0; i < 100; i++) {
+        hash_values.push_back(i % 2 == 0 ? 7 : i);
+    }
+    state->sample(hash_values.data(), hash_values.size(), 4);
+    EXPECT_FALSE(state->decided());
+    state->sample(hash_values.data(), hash_values.size(), 4);
+    EXPECT_TRUE(state->decided());
+    EXPECT_TRUE(state->probe_dependency->ready());
+    EXPECT_TRUE(state->has_hot_keys());
+    EXPECT_TRUE(state->is_hot(7));
+    EXPECT_FALSE(state->is_hot(1));
+
+    // hot keys do not change once decided
+    state->decide(4);
+    EXPECT_TRUE(state->is_hot(7));
+    config::hash_join_hot_key_sample_blocks = sample_blocks;
+}
+
+TEST(JoinHotKeyStateTest, NoHotKeys) {
+    auto state = JoinHotKeyState::create_shared(1);
+    state->has_build_side = true;
+    state->has_probe_side = true;
+    state->finish_planning();
+
+    std::vector<uint32_t> hash_values;
+    for (uint32_t i = 0; i < 100; i++) {
+        hash_values.push_back(i % 10);
+    }
+    state->sample(hash_values.data(), hash_values.size(), 4);
+    // build side finished before enough blocks are sampled
+    state->decide(4);
+    EXPECT_TRUE(state->decided());
+    EXPECT_FALSE(state->has_hot_keys());
+}
+
+} // namespace doris::pipeline
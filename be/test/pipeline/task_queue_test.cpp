@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/task_queue.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::pipeline {
+
+TEST(MultiCoreTaskQueueTest, NumaUnaware) {
+    MultiCoreTaskQueue queue(4);
+    EXPECT_FALSE(queue.numa_aware());
+    EXPECT_EQ(1, queue.numa_node_num());
+    EXPECT_EQ(0, queue.numa_node_of_core(3));
+    EXPECT_EQ((std::vector<int> {2, 3, 0}), queue._local_victims[1]);
+    EXPECT_TRUE(queue._remote_victims[1].empty());
+}
+
+TEST(MultiCoreTaskQueueTest, NumaVictims) {
+    // cores are interleaved between two nodes
+    MultiCoreTaskQueue queue(6, {0, 1, 0, 1, 0, 1});
+    EXPECT_TRUE(queue.numa_aware());
+    EXPECT_EQ(2, queue.numa_node_num());
+    EXPECT_EQ(1, queue.numa_node_of_core(3));
+    EXPECT_EQ((std::vector<int> {2, 4}), queue._local_victims[0]);
+    EXPECT_EQ((std::vector<int> {1, 3, 5}), queue._remote_victims[0]);
+    EXPECT_EQ((std::vector<int> {1, 3}), queue._local_victims[5]);
+    EXPECT_EQ((std::vector<int> {0, 2, 4}), queue._remote_victims[5]);
+    EXPECT_EQ(0, queue.local_node_steal_count(0));
+    EXPECT_EQ(0, queue.remote_node_steal_count(1));
+}
+
+TEST(MultiCoreTaskQueueTest, StealNothingFromEmptyQueues) {
+    MultiCoreTaskQueue queue(4, {0, 0, 1, 1});
+    EXPECT_EQ(nullptr, queue._steal_take(0));
+    EXPECT_EQ(nullptr, queue._steal_take(3));
+    EXPECT_EQ(0, queue.remote_node_steal_count(0));
+    EXPECT_EQ(0, queue.steal_count());
+}
+
+} // namespace doris::pipeline
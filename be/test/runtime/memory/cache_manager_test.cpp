@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/cache_manager.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(CacheManagerTest, CapacityWeightedNoPressure) {
+    // without memory pressure every cache keeps its full capacity, whatever its hit ratio.
+    EXPECT_DOUBLE_EQ(1.0, CacheManager::cache_capacity_weighted(1.0, 0.1, 0.5, 1.0));
+    EXPECT_DOUBLE_EQ(1.0, CacheManager::cache_capacity_weighted(1.0, 0.9, 0.5, 1.0));
+}
+
+TEST(CacheManagerTest, CapacityWeightedBiasByHitRatio) {
+    auto step = config::cache_capacity_adjust_max_step;
+    config::cache_capacity_adjust_max_step = 0;
+    // the cache with a higher hit ratio than the average keeps more capacity.
+    EXPECT_DOUBLE_EQ(0.76, CacheManager::cache_capacity_weighted(0.6, 0.9, 0.5, 1.0));
+    EXPECT_DOUBLE_EQ(0.44, CacheManager::cache_capacity_weighted(0.6, 0.1, 0.5, 1.0));
+    EXPECT_DOUBLE_EQ(0.6, CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, 1.0));
+    // over the soft limit every cache is emptied.
+    EXPECT_DOUBLE_EQ(0.0, CacheManager::cache_capacity_weighted(0.0, 0.9, 0.5, 1.0));
+    config::cache_capacity_adjust_max_step = step;
+}
+
+TEST(CacheManagerTest, CapacityWeightedSmoothed) {
+    auto step = config::cache_capacity_adjust_max_step;
+    config::cache_capacity_adjust_max_step = 0.1;
+    double weighted = 1.0;
+    weighted = CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, weighted);
+    EXPECT_DOUBLE_EQ(0.9, weighted);
+    weighted = CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, weighted);
+    EXPECT_DOUBLE_EQ(0.8, weighted);
+    weighted = CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, weighted);
+    weighted = CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, weighted);
+    weighted = CacheManager::cache_capacity_weighted(0.6, 0.5, 0.5, weighted);
+    EXPECT_DOUBLE_EQ(0.6, weighted);
+    // growing back is smoothed as well.
+    weighted = CacheManager::cache_capacity_weighted(1.0, 0.5, 0.5, weighted);
+    EXPECT_DOUBLE_EQ(0.7, weighted);
+    // over the soft limit the capacity drops at once.
+    EXPECT_DOUBLE_EQ(0.0, CacheManager::cache_capacity_weighted(0.0, 0.5, 0.5, weighted));
+    config::cache_capacity_adjust_max_step = step;
+}
+
+} // namespace doris
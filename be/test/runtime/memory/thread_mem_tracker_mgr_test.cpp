@@ -440,4 +440,38 @@ TEST_F(ThreadMemTrackerMgrTest, NestedSwitchMemTrackerReserveMemory) {
     EXPECT_EQ(doris::GlobalMemoryArbitrator::process_reserved_memory(), 0);
 }
 
+TEST_F(ThreadMemTrackerMgrTest, OperatorMemCounter) {
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    std::shared_ptr<MemTrackerLimiter> t = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-OperatorMemCounter");
+    OperatorMemCounter counter1;
+    OperatorMemCounter counter2;
+    int64_t size1 = 4 * 1024;
+    int64_t size2 = 4 * 1024 * 1024;
+
+    thread_context->attach_task(TUniqueId(), t, workload_group);
+    thread_context->thread_mem_tracker_mgr->set_operator_mem_counter(&counter1);
+    thread_context->consume_memory(size1);
+    thread_context->consume_memory(size2);
+    thread_context->consume_memory(-size1);
+    EXPECT_EQ(counter1.current_value(), size2);
+    EXPECT_EQ(counter1.peak_value(), size1 + size2);
+    EXPECT_EQ(counter1.alloc_count(), 2);
+    EXPECT_EQ(counter1.alloc_bytes(), size1 + size2);
+
+    // memory allocated by counter1 and freed by counter2.
+    thread_context->thread_mem_tracker_mgr->set_operator_mem_counter(&counter2);
+    thread_context->consume_memory(-size2);
+    EXPECT_EQ(counter1.current_value(), size2);
+    EXPECT_EQ(counter2.current_value(), -size2);
+    EXPECT_EQ(counter2.alloc_count(), 0);
+
+    thread_context->thread_mem_tracker_mgr->set_operator_mem_counter(nullptr);
+    thread_context->consume_memory(size1);
+    EXPECT_EQ(counter1.alloc_count(), 2);
+    EXPECT_EQ(counter2.alloc_count(), 0);
+    thread_context->consume_memory(-size1);
+    thread_context->detach_task();
+}
+
 } // end namespace doris
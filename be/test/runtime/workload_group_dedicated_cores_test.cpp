@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "gtest/gtest_pred_impl.h"
+#include "runtime/workload_group/workload_group_manager.h"
+
+namespace doris {
+
+TEST(WorkloadGroupDedicatedCoresTest, parse) {
+    auto requests = WorkloadGroupMgr::parse_dedicated_cores(" wg1:8, wg2 : 4,bad,wg3:0,:2,");
+    EXPECT_EQ(2, requests.size());
+    EXPECT_EQ(8, requests["wg1"]);
+    EXPECT_EQ(4, requests["wg2"]);
+    EXPECT_TRUE(WorkloadGroupMgr::parse_dedicated_cores("").empty());
+}
+
+TEST(WorkloadGroupDedicatedCoresTest, to_cpuset_list) {
+    EXPECT_EQ("", WorkloadGroupMgr::to_cpuset_list({}));
+    EXPECT_EQ("3", WorkloadGroupMgr::to_cpuset_list({3}));
+    EXPECT_EQ("0-2,5,7-8", WorkloadGroupMgr::to_cpuset_list({0, 1, 2, 5, 7, 8}));
+}
+
+TEST(WorkloadGroupDedicatedCoresTest, numa_aligned) {
+    std::vector<std::vector<int>> nodes = {{0, 1, 2, 3}, {4, 5, 6, 7}};
+    auto plan = WorkloadGroupMgr::plan_dedicated_cores({{"a", 3}, {"b", 2}}, nodes);
+    // the larger group is placed first and each group stays in one numa node
+    EXPECT_EQ((std::vector<int> {0, 1, 2}), plan.group_cores["a"]);
+    EXPECT_EQ((std::vector<int> {4, 5}), plan.group_cores["b"]);
+    EXPECT_EQ((std::vector<int> {3, 6, 7}), plan.shared_cores);
+}
+
+TEST(WorkloadGroupDedicatedCoresTest, spill_and_keep_shared_core) {
+    std::vector<std::vector<int>> nodes = {{0, 1, 2, 3}, {4, 5, 6, 7}};
+    auto plan = WorkloadGroupMgr::plan_dedicated_cores({{"a", 6}}, nodes);
+    EXPECT_EQ((std::vector<int> {0, 1, 2, 3, 4, 5}), plan.group_cores["a"]);
+    EXPECT_EQ((std::vector<int> {6, 7}), plan.shared_cores);
+
+    plan = WorkloadGroupMgr::plan_dedicated_cores({{"a", 100}, {"b", 1}}, nodes);
+    EXPECT_EQ(7, plan.group_cores["a"].size());
+    EXPECT_EQ(0, plan.group_cores.count("b"));
+    EXPECT_EQ((std::vector<int> {7}), plan.shared_cores);
+}
+
+} // namespace doris
@@ -24,6 +24,7 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "util/faststring.h"
 
@@ -148,4 +149,15 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(segment_v2::CompressionTypePB::ZSTD);
 }
 
+TEST_F(BlockCompressionTest, zstd_compression_level) {
+    auto origin_level = config::ZSTD_compression_level;
+    // out of range levels are clamped instead of failing the compression
+    for (int level : {1, 19, -1000000, 1000}) {
+        config::ZSTD_compression_level = level;
+        test_single_slice(segment_v2::CompressionTypePB::ZSTD);
+        test_multi_slices(segment_v2::CompressionTypePB::ZSTD);
+    }
+    config::ZSTD_compression_level = origin_level;
+}
+
 } // namespace doris
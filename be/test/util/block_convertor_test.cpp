@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/arrow/block_convertor.h"
+
+#include <arrow/array.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <cctz/time_zone.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "util/arrow/row_batch.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris {
+
+TEST(BlockConvertorTest, ZeroCopyFixedWidthColumns) {
+    auto int_column = vectorized::ColumnInt32::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    auto bigint_column = vectorized::ColumnInt64::create();
+    auto double_column = vectorized::ColumnFloat64::create();
+    for (int i = 0; i < 100; ++i) {
+        int_column->insert_value(i);
+        null_map->insert_value(i % 7 == 0);
+        bigint_column->insert_value(i * 1000L);
+        double_column->insert_value(i * 0.5);
+    }
+    const auto* bigint_data = bigint_column->get_data().data();
+    vectorized::Block block({
+            {vectorized::ColumnNullable::create(std::move(int_column), std::move(null_map)),
+             vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt32>()), "k1"},
+            {std::move(bigint_column), std::make_shared<vectorized::DataTypeInt64>(), "k2"},
+            {std::move(double_column), std::make_shared<vectorized::DataTypeFloat64>(), "k3"},
+    });
+
+    std::shared_ptr<arrow::Schema> schema;
+    ASSERT_TRUE(get_arrow_schema_from_block(block, &schema, "UTC").ok());
+    cctz::time_zone timezone_obj;
+    std::shared_ptr<arrow::RecordBatch> copied;
+    ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &copied,
+                                       timezone_obj)
+                        .ok());
+    std::shared_ptr<arrow::RecordBatch> shared;
+    ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &shared,
+                                       timezone_obj, true)
+                        .ok());
+
+    ASSERT_TRUE(shared->ValidateFull().ok());
+    EXPECT_TRUE(shared->Equals(*copied));
+    EXPECT_EQ(15, shared->column(0)->null_count());
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(bigint_data),
+              shared->column(1)->data()->buffers[1]->data());
+
+    // the batch keeps the column memory alive
+    block.clear();
+    EXPECT_TRUE(shared->Equals(*copied));
+}
+
+} // namespace doris
@@ -47,6 +47,42 @@ TEST_F(BrpcClientCacheTest, normal) {
     EXPECT_EQ(stub1, stub3);
 }
 
+TEST_F(BrpcClientCacheTest, data_client) {
+    int32_t origin_num = config::brpc_data_connection_num;
+    BrpcClientCache<PBackendService_Stub> cache;
+    TNetworkAddress address;
+    address.hostname = "127.0.0.1";
+    address.port = 123;
+    auto control_stub = cache.get_client(address);
+    EXPECT_NE(nullptr, control_stub);
+
+    // a single connection is shared by data and control rpcs
+    config::brpc_data_connection_num = 1;
+    EXPECT_EQ(control_stub, cache.get_data_client(address));
+    EXPECT_EQ(0, cache.data_connection_num());
+
+    // data rpcs round-robin over their own connections
+    config::brpc_data_connection_num = 2;
+    auto data_stub1 = cache.get_data_client(address);
+    auto data_stub2 = cache.get_data_client(address);
+    EXPECT_NE(nullptr, data_stub1);
+    EXPECT_NE(nullptr, data_stub2);
+    EXPECT_NE(control_stub, data_stub1);
+    EXPECT_NE(control_stub, data_stub2);
+    EXPECT_NE(data_stub1, data_stub2);
+    EXPECT_EQ(data_stub1, cache.get_data_client(address));
+    EXPECT_EQ(2, cache.data_connection_num());
+
+    // the pool follows the connection number
+    config::brpc_data_connection_num = 3;
+    cache.get_data_client(address);
+    EXPECT_EQ(3, cache.data_connection_num());
+
+    EXPECT_EQ(1, cache.erase("127.0.0.1", 123));
+    EXPECT_EQ(0, cache.data_connection_num());
+    config::brpc_data_connection_num = origin_num;
+}
+
 TEST_F(BrpcClientCacheTest, invalid) {
     BrpcClientCache<PBackendService_Stub> cache;
     TNetworkAddress address;
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/cpu_sampler.h"
+
+#include <gtest/gtest.h>
+
+namespace doris {
+
+TEST(CpuSamplerTest, ScopedTagRestore) {
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 2;
+    EXPECT_EQ(cpu_sample_tag.operator_id, -1);
+    {
+        SCOPED_ATTRIBUTE_QUERY_CPU(query_id);
+        EXPECT_EQ(cpu_sample_tag.query_hi, 1);
+        EXPECT_EQ(cpu_sample_tag.query_lo, 2);
+        {
+            SCOPED_ATTRIBUTE_OPERATOR_CPU(3);
+            EXPECT_EQ(cpu_sample_tag.operator_id, 3);
+            {
+                SCOPED_ATTRIBUTE_OPERATOR_CPU(4);
+                EXPECT_EQ(cpu_sample_tag.operator_id, 4);
+            }
+            EXPECT_EQ(cpu_sample_tag.operator_id, 3);
+        }
+        EXPECT_EQ(cpu_sample_tag.operator_id, -1);
+    }
+    EXPECT_EQ(cpu_sample_tag.query_hi, 0);
+    EXPECT_EQ(cpu_sample_tag.query_lo, 0);
+}
+
+TEST(CpuSamplerTest, DumpWithoutSamples) {
+    CpuSampler::instance()->drain();
+    EXPECT_TRUE(CpuSampler::instance()->dump_collapsed_stacks(nullptr, 60).empty());
+}
+
+} // namespace doris
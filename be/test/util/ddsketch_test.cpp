@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/ddsketch.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+static double exact_quantile(double q, std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values[static_cast<size_t>(q * static_cast<double>(values.size() - 1))];
+}
+
+static void check_relative_error(const DDSketch& sketch, const std::vector<double>& values) {
+    for (double q : {0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0}) {
+        double expected = exact_quantile(q, values);
+        EXPECT_LE(std::abs(sketch.quantile(q) - expected),
+                  std::abs(expected) * sketch.relative_accuracy() + 1e-9)
+                << "q=" << q;
+    }
+}
+
+TEST(DDSketchTest, empty) {
+    DDSketch sketch;
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+}
+
+TEST(DDSketchTest, skewed_values) {
+    // Latency like data with a long tail
+    std::mt19937 gen(0);
+    std::lognormal_distribution<double> dist(3, 2);
+    std::vector<double> values(100000);
+    for (auto& value : values) {
+        value = dist(gen);
+    }
+    values.push_back(0);
+    values.push_back(-5);
+
+    DDSketch sketch;
+    sketch.add_batch(values.data(), values.size());
+    EXPECT_EQ(values.size(), sketch.count());
+    check_relative_error(sketch, values);
+}
+
+TEST(DDSketchTest, merge) {
+    std::mt19937 gen(0);
+    std::exponential_distribution<double> dist(0.01);
+    std::vector<double> values;
+    DDSketch merged;
+    for (int i = 0; i < 10; i++) {
+        DDSketch sketch;
+        for (int j = 0; j < 1000; j++) {
+            double value = dist(gen);
+            values.push_back(value);
+            sketch.add(value);
+        }
+        merged.merge(sketch);
+    }
+    EXPECT_EQ(values.size(), merged.count());
+    check_relative_error(merged, values);
+
+    // Sketches with different relative accuracies are merged with the accuracy of the target
+    DDSketch coarse(0.05);
+    coarse.merge(merged);
+    EXPECT_EQ(values.size(), coarse.count());
+    check_relative_error(coarse, values);
+}
+
+TEST(DDSketchTest, collapse_lowest_buckets) {
+    DDSketch sketch(0.01, 128);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; i++) {
+        values.push_back(std::pow(1.01, i % 2000));
+    }
+    sketch.add_batch(values.data(), values.size());
+    EXPECT_EQ(values.size(), sketch.count());
+    // Only the lowest values lose accuracy
+    for (double q : {0.9, 0.99, 1.0}) {
+        double expected = exact_quantile(q, values);
+        EXPECT_LE(std::abs(sketch.quantile(q) - expected), expected * 0.01) << "q=" << q;
+    }
+}
+
+TEST(DDSketchTest, serialize) {
+    DDSketch sketch(0.02);
+    for (int i = -100; i < 1000; i++) {
+        sketch.add(i * 1.5);
+    }
+    std::vector<uint8_t> buf(sketch.serialized_size());
+    EXPECT_EQ(buf.size(), sketch.serialize(buf.data()));
+
+    DDSketch other;
+    EXPECT_TRUE(other.unserialize(buf.data(), buf.size()));
+    EXPECT_EQ(sketch.count(), other.count());
+    EXPECT_EQ(sketch.relative_accuracy(), other.relative_accuracy());
+    for (double q : {0.0, 0.05, 0.5, 0.95, 1.0}) {
+        EXPECT_EQ(sketch.quantile(q), other.quantile(q));
+    }
+
+    // Truncated input is rejected
+    EXPECT_FALSE(other.unserialize(buf.data(), buf.size() - 1));
+}
+
+} // namespace doris
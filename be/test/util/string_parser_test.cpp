@@ -226,6 +226,25 @@ TEST(StringToInt, Limit) {
                             StringParser::PARSE_SUCCESS);
 }
 
+TEST(StringToInt, EightDigits) {
+    // long numbers are parsed 8 digits at a time
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-987654321", -987654321, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789012345678", 123456789012345678L,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-100000000000000009", -100000000000000009L,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("00000000000000001", 1, StringParser::PARSE_SUCCESS);
+    test_unsigned_int_value<uint64_t>("999999999999999999", 999999999999999999UL,
+                                      StringParser::PARSE_SUCCESS);
+
+    // a non digit in the middle of a block of 8 chars
+    test_int_value<int64_t>("1234567x901234", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678/01234", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234:6789012345", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("1234 6789012345", 0, StringParser::PARSE_FAILURE);
+}
+
 TEST(StringToUnsignedInt, Basic) {
     test_unsigned_int_value<uint8_t>("123", 123, StringParser::PARSE_SUCCESS);
     test_unsigned_int_value<uint16_t>("123", 123, StringParser::PARSE_SUCCESS);
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/timezone_offset_cache.h"
+
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+static cctz::time_point<cctz::seconds> to_time_point(int64_t seconds) {
+    return std::chrono::time_point_cast<cctz::seconds>(std::chrono::system_clock::from_time_t(0)) +
+           cctz::seconds(seconds);
+}
+
+TEST(TimezoneOffsetCacheTest, SameAsCctzAcrossTransitions) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(cctz::load_time_zone("America/New_York", &ctz));
+    TimezoneOffsetCache cache(ctz);
+
+    // 2023-03-01 to 2023-12-01 UTC covers both DST transitions, step by 17 minutes
+    for (int64_t ts = 1677628800; ts < 1701388800; ts += 17 * 60) {
+        auto expected = cctz::convert(to_time_point(ts), ctz);
+        EXPECT_EQ(cache.to_civil(ts), expected) << ts;
+        EXPECT_EQ(cache.from_civil(expected),
+                  cctz::convert(expected, ctz).time_since_epoch().count())
+                << ts;
+    }
+}
+
+TEST(TimezoneOffsetCacheTest, SkippedAndRepeatedCivilTimes) {
+    cctz::time_zone ctz;
+    ASSERT_TRUE(cctz::load_time_zone("America/New_York", &ctz));
+    TimezoneOffsetCache cache(ctz);
+
+    // warm the cache with a time close to the transitions
+    cache.to_civil(1678600000);
+    for (const auto& cs : {cctz::civil_second(2023, 3, 12, 2, 30, 0),
+                           cctz::civil_second(2023, 11, 5, 1, 30, 0),
+                           cctz::civil_second(2023, 11, 4, 23, 0, 0)}) {
+        EXPECT_EQ(cache.from_civil(cs), cctz::convert(cs, ctz).time_since_epoch().count());
+    }
+}
+
+TEST(TimezoneOffsetCacheTest, FixedOffset) {
+    cctz::time_zone ctz = cctz::fixed_time_zone(cctz::seconds(8 * 3600));
+    TimezoneOffsetCache cache(ctz);
+    EXPECT_EQ(cache.utc_offset(0), 8 * 3600);
+    EXPECT_EQ(cache.to_civil(0), cctz::civil_second(1970, 1, 1, 8, 0, 0));
+    EXPECT_EQ(cache.from_civil(cctz::civil_second(2024, 1, 1, 8, 0, 0)), 1704067200);
+}
+
+} // namespace doris
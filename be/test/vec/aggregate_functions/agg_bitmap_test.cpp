@@ -89,4 +89,44 @@ TEST(AggBitmapTest, bitmap_union_test) {
     }
 }
 
+TEST(AggBitmapTest, bitmap_union_merge_from_column_test) {
+    auto data_type = std::make_shared<DataTypeBitMap>();
+    // Mix of single, set and bitmap values, some of them with the same high 32 bits
+    auto column_bitmap = data_type->create_column();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        BitmapValue bitmap_value;
+        for (uint64_t j = 0; j <= i * 10; j++) {
+            bitmap_value.add((static_cast<uint64_t>(i % 3) << 32) + j);
+        }
+        assert_cast<ColumnBitmap&>(*column_bitmap).insert_value(bitmap_value);
+    }
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_bitmap(factory);
+    DataTypes data_types = {data_type};
+    auto agg_function = factory.get("bitmap_union", data_types, false, -1);
+    agg_function->set_version(3);
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data() * 2]);
+    AggregateDataPtr place = memory.get();
+    AggregateDataPtr expected_place = place + agg_function->size_of_data();
+    agg_function->create(place);
+    agg_function->create(expected_place);
+
+    const IColumn* column[1] = {column_bitmap.get()};
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        agg_function->add(expected_place, column, i, nullptr);
+    }
+    // Merging after a batch union must keep the unioned values
+    agg_function->deserialize_and_merge_from_column_range(place, *column_bitmap, 0, 4, nullptr);
+    agg_function->deserialize_and_merge_from_column(place, *column_bitmap, nullptr);
+
+    ColumnBitmap ans;
+    agg_function->insert_result_into(place, ans);
+    agg_function->insert_result_into(expected_place, ans);
+    EXPECT_EQ(ans.get_element(1).cardinality(), 91 + 71 + 81);
+    EXPECT_EQ(ans.get_element(0).to_string(), ans.get_element(1).to_string());
+    agg_function->destroy(place);
+    agg_function->destroy(expected_place);
+}
+
 } // namespace doris::vectorized
@@ -29,6 +29,7 @@
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/common/arena.h"
 #include "vec/common/string_buffer.hpp"
@@ -37,6 +38,7 @@
 #include "vec/data_types/data_type_date.h"
 #include "vec/data_types/data_type_date_time.h"
 #include "vec/data_types/data_type_decimal.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -173,4 +175,67 @@ TEST_F(VAggCollectTest, test_with_data) {
     test_agg_collect<DataTypeString>("collect_set", 5);
 }
 
+TEST_F(VAggCollectTest, test_array_agg_merge_into_non_empty) {
+    auto test_array_agg = [&](const DataTypePtr& nested_type, auto&& insert_value) {
+        DataTypes data_types = {make_nullable(nested_type)};
+        AggregateFunctionSimpleFactory factory = AggregateFunctionSimpleFactory::instance();
+        auto agg_function = factory.get("array_agg", data_types, false, -1);
+        ASSERT_NE(agg_function, nullptr);
+
+        // rows 0..5, the odd rows are null.
+        auto input_col = data_types[0]->create_column();
+        for (int i = 0; i < 6; ++i) {
+            if (i % 2) {
+                input_col->insert_default();
+            } else {
+                insert_value(*input_col, i);
+            }
+        }
+        const IColumn* column[1] = {input_col.get()};
+
+        std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+        std::unique_ptr<char[]> memory2(new char[agg_function->size_of_data()]);
+        AggregateDataPtr place = memory.get();
+        AggregateDataPtr place2 = memory2.get();
+        agg_function->create(place);
+        agg_function->create(place2);
+        for (int i = 0; i < 3; ++i) {
+            agg_function->add(place, column, i, &_agg_arena_pool);
+        }
+        for (int i = 3; i < 6; ++i) {
+            agg_function->add(place2, column, i, &_agg_arena_pool);
+        }
+
+        ColumnString buf;
+        VectorBufferWriter buf_writer(buf);
+        agg_function->serialize(place2, buf_writer);
+        buf_writer.commit();
+        agg_function->reset(place2);
+        VectorBufferReader buf_reader(buf.get_data_at(0));
+        agg_function->deserialize(place2, buf_reader, &_agg_arena_pool);
+
+        agg_function->merge(place, place2, &_agg_arena_pool);
+        auto column_result = ColumnArray::create(data_types[0]->create_column());
+        agg_function->insert_result_into(place, *column_result);
+        ASSERT_EQ(column_result->get_offsets()[0], 6);
+        const auto& result = column_result->get_data();
+        for (size_t i = 0; i < 6; ++i) {
+            EXPECT_EQ(result.is_null_at(i), i % 2 == 1);
+            EXPECT_EQ(result.compare_at(i, i, *input_col, 1), 0);
+        }
+
+        agg_function->destroy(place);
+        agg_function->destroy(place2);
+    };
+
+    test_array_agg(std::make_shared<DataTypeInt32>(), [](IColumn& column, int i) {
+        auto item = static_cast<int32_t>(i);
+        column.insert_data(reinterpret_cast<const char*>(&item), 0);
+    });
+    test_array_agg(std::make_shared<DataTypeString>(), [](IColumn& column, int i) {
+        auto item = std::string("item") + std::to_string(i);
+        column.insert_data(item.c_str(), item.size());
+    });
+}
+
 } // namespace doris::vectorized
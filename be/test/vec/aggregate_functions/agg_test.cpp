@@ -25,11 +25,15 @@
 #include "gtest/gtest_pred_impl.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/aggregate_functions/aggregate_function_state_union.h"
 #include "vec/aggregate_functions/aggregate_function_topn.h"
+#include "vec/aggregate_functions/aggregate_function_uniq.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
+#include "vec/common/arena.h"
+#include "vec/common/string_buffer.hpp"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_number.h"
@@ -41,6 +45,7 @@ namespace doris::vectorized {
 // declare function
 void register_aggregate_function_sum(AggregateFunctionSimpleFactory& factory);
 void register_aggregate_function_topn(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_uniq(AggregateFunctionSimpleFactory& factory);
 
 TEST(AggTest, basic_test) {
     auto column_vector_int32 = ColumnVector<Int32>::create();
@@ -68,6 +73,56 @@ TEST(AggTest, basic_test) {
     agg_function->destroy(place);
 }
 
+TEST(AggTest, state_union_batch_merge_test) {
+    auto column_vector_int32 = ColumnVector<Int32>::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        column_vector_int32->insert(cast_to_nearest_field_type(i));
+    }
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto agg_function = factory.get("sum", data_types, false, -1);
+    Arena arena;
+    // one stored state for every row, as written by sum_state
+    auto states = agg_function->create_serialize_column();
+    const IColumn* column[1] = {column_vector_int32.get()};
+    agg_function->streaming_agg_serialize_to_column(column, states, agg_test_batch_size, &arena);
+
+    auto union_function = AggregateStateUnion::create(agg_function,
+                                                      {std::make_shared<DataTypeString>()},
+                                                      std::make_shared<DataTypeString>());
+    const size_t size_of_data = union_function->size_of_data();
+    std::unique_ptr<char[]> memory(new char[size_of_data * 4]);
+    AggregateDataPtr range_place = memory.get();
+    AggregateDataPtr window_place = range_place + size_of_data;
+    AggregateDataPtr even_place = window_place + size_of_data;
+    AggregateDataPtr odd_place = even_place + size_of_data;
+    for (auto* place : {range_place, window_place, even_place, odd_place}) {
+        union_function->create(place);
+    }
+
+    const IColumn* state_column[1] = {states.get()};
+    union_function->add_batch_range(0, agg_test_batch_size - 1, range_place, state_column, &arena,
+                                    false);
+    union_function->add_range_single_place(0, agg_test_batch_size, 10, 20, window_place,
+                                           state_column, &arena);
+    std::vector<AggregateDataPtr> places(agg_test_batch_size);
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        places[i] = i % 2 ? odd_place : even_place;
+    }
+    union_function->add_batch(agg_test_batch_size, places.data(), 0, state_column, &arena, true);
+
+    const int64_t total = int64_t(agg_test_batch_size) * (agg_test_batch_size - 1) / 2;
+    const int64_t even = int64_t(agg_test_batch_size - 2) * agg_test_batch_size / 4;
+    EXPECT_EQ(total, *reinterpret_cast<int64_t*>(range_place));
+    EXPECT_EQ(145, *reinterpret_cast<int64_t*>(window_place));
+    EXPECT_EQ(even, *reinterpret_cast<int64_t*>(even_place));
+    EXPECT_EQ(total - even, *reinterpret_cast<int64_t*>(odd_place));
+    for (auto* place : {range_place, window_place, even_place, odd_place}) {
+        union_function->destroy(place);
+    }
+}
+
 TEST(AggTest, topn_test) {
     MutableColumns datas(2);
     datas[0] = ColumnString::create();
@@ -102,4 +157,61 @@ TEST(AggTest, topn_test) {
     EXPECT_EQ(result, expect_result);
     agg_function->destroy(place);
 }
+TEST(AggTest, multi_distinct_count_two_level_test) {
+    using Data = AggregateFunctionUniqExactData<Int32>;
+    const int num_rows = static_cast<int>(Data::TWO_LEVEL_THRESHOLD) * 2;
+    auto column = ColumnInt32::create();
+    for (int i = 0; i < num_rows; i++) {
+        column->insert_value(i);
+    }
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_uniq(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto agg_function = factory.get("multi_distinct_count", data_types, false, -1);
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data() * 3]);
+    AggregateDataPtr small_place = memory.get();
+    AggregateDataPtr large_place = small_place + agg_function->size_of_data();
+    AggregateDataPtr merged_place = large_place + agg_function->size_of_data();
+    agg_function->create(small_place);
+    agg_function->create(large_place);
+    agg_function->create(merged_place);
+
+    // [0, 100) stays one level, [50, num_rows) is converted to two level
+    const IColumn* columns[1] = {column.get()};
+    for (int i = 0; i < 100; i++) {
+        agg_function->add(small_place, columns, i, nullptr);
+    }
+    for (int i = 50; i < num_rows; i++) {
+        agg_function->add(large_place, columns, i, nullptr);
+    }
+    EXPECT_FALSE(reinterpret_cast<Data*>(small_place)->is_two_level());
+    EXPECT_TRUE(reinterpret_cast<Data*>(large_place)->is_two_level());
+
+    // Merge a two level set into a one level set
+    agg_function->merge(merged_place, small_place, nullptr);
+    agg_function->merge(merged_place, large_place, nullptr);
+    EXPECT_TRUE(reinterpret_cast<Data*>(merged_place)->is_two_level());
+
+    // Two level sets keep the format of one level sets
+    auto serialized = ColumnString::create();
+    BufferWritable buf(*serialized);
+    agg_function->serialize(merged_place, buf);
+    buf.commit();
+    agg_function->reset(small_place);
+    StringRef ref(serialized->get_chars().data(), serialized->get_chars().size());
+    BufferReadable read_buf(ref);
+    agg_function->deserialize(small_place, read_buf, nullptr);
+    EXPECT_TRUE(reinterpret_cast<Data*>(small_place)->is_two_level());
+
+    auto result = ColumnInt64::create();
+    agg_function->insert_result_into(merged_place, *result);
+    agg_function->insert_result_into(small_place, *result);
+    EXPECT_EQ(num_rows, result->get_element(0));
+    EXPECT_EQ(num_rows, result->get_element(1));
+
+    agg_function->destroy(small_place);
+    agg_function->destroy(large_place);
+    agg_function->destroy(merged_place);
+}
 } // namespace doris::vectorized
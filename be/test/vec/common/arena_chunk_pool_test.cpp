@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/arena_chunk_pool.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "vec/common/arena.h"
+
+namespace doris::vectorized {
+
+class ArenaChunkPoolTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _max_bytes = config::arena_chunk_pool_max_bytes;
+        ArenaChunkPool::instance()->release_all();
+    }
+    void TearDown() override {
+        config::arena_chunk_pool_max_bytes = _max_bytes;
+        ArenaChunkPool::instance()->release_all();
+    }
+
+    int64_t _max_bytes = 0;
+};
+
+TEST_F(ArenaChunkPoolTest, ReuseFreedChunks) {
+    config::arena_chunk_pool_max_bytes = 64 * 1024 * 1024;
+    auto* pool = ArenaChunkPool::instance();
+    char* first_chunk = nullptr;
+    {
+        Arena arena;
+        first_chunk = arena.alloc(16);
+        memset(first_chunk, 1, 16);
+        // grow into 8K and 16K chunks
+        for (int i = 0; i < 4; ++i) {
+            (void)arena.alloc(4000);
+        }
+    }
+    EXPECT_EQ(pool->cached_bytes(), 4096 + 8192 + 16384);
+
+    {
+        Arena arena;
+        EXPECT_EQ(arena.alloc(16), first_chunk);
+        EXPECT_EQ(pool->cached_bytes(), 8192 + 16384);
+    }
+    EXPECT_EQ(pool->release_all(), 4096 + 8192 + 16384);
+    EXPECT_EQ(pool->cached_bytes(), 0);
+}
+
+TEST_F(ArenaChunkPoolTest, Limit) {
+    config::arena_chunk_pool_max_bytes = 4096;
+    auto* pool = ArenaChunkPool::instance();
+    {
+        Arena arena;
+        for (int i = 0; i < 4; ++i) {
+            (void)arena.alloc(4000);
+        }
+    }
+    // the 16K and 8K chunks do not fit in the pool
+    EXPECT_EQ(pool->cached_bytes(), 4096);
+
+    config::arena_chunk_pool_max_bytes = 0;
+    {
+        Arena arena;
+        (void)arena.alloc(16);
+        (void)arena.alloc(8000);
+    }
+    EXPECT_EQ(pool->cached_bytes(), 0);
+}
+
+TEST_F(ArenaChunkPoolTest, NonPowerOfTwoChunk) {
+    config::arena_chunk_pool_max_bytes = 64 * 1024 * 1024;
+    auto* pool = ArenaChunkPool::instance();
+    { Arena arena(3 * 4096); }
+    EXPECT_EQ(pool->cached_bytes(), 0);
+    {
+        Arena arena(3 * 4096);
+        (void)arena.alloc(16);
+    }
+    EXPECT_EQ(pool->cached_bytes(), 0);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+class ColumnBufferPoolTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _max_bytes = config::column_buffer_pool_max_bytes;
+        _thread_cache_bytes = config::column_buffer_thread_cache_bytes;
+    }
+    void TearDown() override {
+        config::column_buffer_pool_max_bytes = _max_bytes;
+        config::column_buffer_thread_cache_bytes = _thread_cache_bytes;
+        ColumnBufferPool::release_all();
+    }
+
+    int64_t _max_bytes = 0;
+    int64_t _thread_cache_bytes = 0;
+};
+
+TEST_F(ColumnBufferPoolTest, PooledSize) {
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(2048));
+    EXPECT_TRUE(ColumnBufferPool::is_pooled_size(4096));
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(4096 * 3));
+    EXPECT_TRUE(ColumnBufferPool::is_pooled_size(4UL << 20));
+    EXPECT_FALSE(ColumnBufferPool::is_pooled_size(8UL << 20));
+}
+
+TEST_F(ColumnBufferPoolTest, GlobalPool) {
+    config::column_buffer_pool_max_bytes = 1L << 30;
+    config::column_buffer_thread_cache_bytes = 1L << 20;
+    ColumnBufferPool::release_all();
+    // larger than the thread cache, goes to the global pool
+    const size_t size = 4UL << 20;
+
+    void* first = std::malloc(size);
+    void* second = std::malloc(size);
+    ASSERT_TRUE(ColumnBufferPool::give_back(first, size));
+    ASSERT_TRUE(ColumnBufferPool::give_back(second, size));
+    EXPECT_EQ(ColumnBufferPool::cached_bytes(), 2 * size);
+
+    EXPECT_EQ(ColumnBufferPool::take(size), second);
+    EXPECT_EQ(ColumnBufferPool::take(size), first);
+    EXPECT_EQ(ColumnBufferPool::cached_bytes(), 0);
+    EXPECT_EQ(ColumnBufferPool::take(size), nullptr);
+    std::free(first);
+    std::free(second);
+}
+
+TEST_F(ColumnBufferPoolTest, GlobalPoolLimit) {
+    config::column_buffer_pool_max_bytes = 4UL << 20;
+    config::column_buffer_thread_cache_bytes = 0;
+    ColumnBufferPool::release_all();
+    const size_t size = 4UL << 20;
+
+    void* first = std::malloc(size);
+    void* second = std::malloc(size);
+    ASSERT_TRUE(ColumnBufferPool::give_back(first, size));
+    EXPECT_FALSE(ColumnBufferPool::give_back(second, size));
+    EXPECT_EQ(ColumnBufferPool::cached_bytes(), size);
+    std::free(second);
+}
+
+TEST_F(ColumnBufferPoolTest, Disabled) {
+    config::column_buffer_pool_max_bytes = 0;
+    void* buf = std::malloc(4096);
+    EXPECT_FALSE(ColumnBufferPool::give_back(buf, 4096));
+    EXPECT_EQ(ColumnBufferPool::take(4096), nullptr);
+    std::free(buf);
+}
+
+TEST_F(ColumnBufferPoolTest, ReleaseAll) {
+    config::column_buffer_pool_max_bytes = 1L << 30;
+    config::column_buffer_thread_cache_bytes = 0;
+    ColumnBufferPool::release_all();
+    ASSERT_TRUE(ColumnBufferPool::give_back(std::malloc(8192), 8192));
+    ASSERT_TRUE(ColumnBufferPool::give_back(std::malloc(4096), 4096));
+    EXPECT_EQ(ColumnBufferPool::release_all(), 8192 + 4096);
+    EXPECT_EQ(ColumnBufferPool::cached_bytes(), 0);
+}
+
+} // namespace doris::vectorized
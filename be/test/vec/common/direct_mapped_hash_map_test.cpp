@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/direct_mapped_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "vec/core/types.h"
+
+namespace doris::vectorized {
+
+using TestMap = DirectMappedHashMap<UInt8, int64_t, HashCRC32<UInt8>>;
+
+TEST(DirectMappedHashMapTest, lazy_emplace_and_find) {
+    TestMap map;
+    EXPECT_TRUE(map.empty());
+
+    int created = 0;
+    auto creator = [&](const auto& ctor, auto& key, auto& origin) {
+        ++created;
+        ctor(key, static_cast<int64_t>(key) * 10);
+    };
+    for (int round = 0; round < 2; ++round) {
+        for (int k : {3, 255, 0, 3}) {
+            TestMap::LookupResult it;
+            UInt8 key = static_cast<UInt8>(k);
+            map.lazy_emplace(key, it, map.hash(key), creator);
+            EXPECT_EQ(it->first, key);
+            EXPECT_EQ(it->second, k * 10);
+        }
+    }
+    EXPECT_EQ(created, 3);
+    EXPECT_EQ(map.size(), 3);
+
+    EXPECT_EQ(map.find(UInt8(7)), nullptr);
+    ASSERT_NE(map.find(UInt8(255)), nullptr);
+    EXPECT_EQ(map.find(UInt8(255))->second, 2550);
+
+    std::vector<UInt8> keys;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        keys.push_back(it->get_first());
+    }
+    EXPECT_EQ(keys, (std::vector<UInt8> {0, 3, 255}));
+
+    map.clear_and_shrink();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.find(UInt8(3)), nullptr);
+}
+
+TEST(DirectMappedHashMapTest, hash_matches_crc32) {
+    TestMap map;
+    for (int k = 0; k < 256; ++k) {
+        auto key = static_cast<UInt8>(k);
+        EXPECT_EQ(map.hash(key), HashCRC32<UInt8>()(key));
+    }
+}
+
+} // namespace doris::vectorized
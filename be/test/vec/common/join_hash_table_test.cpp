@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/common/string_ref.h"
+
+namespace doris {
+
+using TestJoinHashTable = JoinHashTable<uint32_t, HashCRC32<uint32_t>>;
+static constexpr int BATCH_SIZE = 4064;
+
+class JoinHashTableTest : public testing::Test {
+protected:
+    // `build_keys[0]` is a mocked row as the build side of hash join.
+    template <int JoinOpType, typename Table, typename Key>
+    void build(Table& table, const std::vector<Key>& build_keys, bool radix_build) {
+        table.prepare_build<JoinOpType>(build_keys.size(), BATCH_SIZE, false, radix_build);
+        std::vector<uint32_t> bucket_nums(build_keys.size());
+        for (size_t i = 0; i < build_keys.size(); i++) {
+            bucket_nums[i] = table.hash(build_keys[i]) & (table.get_bucket_size() - 1);
+        }
+        table.build(build_keys.data(), bucket_nums.data(), build_keys.size(), false);
+    }
+
+    // Returns matched (probe row, build row) pairs.
+    template <int JoinOpType, typename Table, typename Key>
+    std::vector<std::pair<uint32_t, uint32_t>> probe(Table& table,
+                                                     const std::vector<Key>& probe_keys) {
+        std::vector<uint32_t> build_idx_map(probe_keys.size());
+        for (size_t i = 0; i < probe_keys.size(); i++) {
+            build_idx_map[i] = table.hash(probe_keys[i]) & (table.get_bucket_size() - 1);
+        }
+        table.pre_build_idxs(build_idx_map);
+
+        std::vector<std::pair<uint32_t, uint32_t>> res;
+        std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+        std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        const int probe_rows = static_cast<int>(probe_keys.size());
+        while (probe_idx < probe_rows || build_idx != 0) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] = table.find_batch<JoinOpType>(
+                    probe_keys.data(), build_idx_map.data(), probe_idx, build_idx, probe_rows,
+                    probe_idxs.data(), probe_visited, build_idxs.data(), nullptr, false, false,
+                    false);
+            for (uint32_t i = 0; i < matched_cnt; i++) {
+                res.emplace_back(probe_idxs[i], build_idxs[i]);
+            }
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+        }
+        std::sort(res.begin(), res.end());
+        return res;
+    }
+};
+
+TEST_F(JoinHashTableTest, RadixBuildSameAsChained) {
+    // enough rows to have more than one radix partition
+    std::vector<uint32_t> build_keys {0};
+    for (uint32_t i = 0; i < 200000; i++) {
+        build_keys.push_back(i % 70000);
+    }
+    std::vector<uint32_t> probe_keys;
+    for (uint32_t i = 0; i < 10000; i++) {
+        probe_keys.push_back(i * 13);
+    }
+
+    TestJoinHashTable chained;
+    build<TJoinOp::INNER_JOIN>(chained, build_keys, false);
+    EXPECT_FALSE(chained.is_radix_build());
+    TestJoinHashTable radix;
+    build<TJoinOp::INNER_JOIN>(radix, build_keys, true);
+    EXPECT_TRUE(radix.is_radix_build());
+
+    auto expected = probe<TJoinOp::INNER_JOIN>(chained, probe_keys);
+    auto actual = probe<TJoinOp::INNER_JOIN>(radix, probe_keys);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(expected, actual);
+    for (const auto& [probe_row, build_row] : actual) {
+        EXPECT_EQ(probe_keys[probe_row], build_keys[build_row]);
+    }
+}
+
+TEST_F(JoinHashTableTest, RadixBuildVisitedByBuildRow) {
+    std::vector<uint32_t> build_keys {0, 5, 3, 5, 8, 1};
+    std::vector<uint32_t> probe_keys {5, 1};
+
+    TestJoinHashTable radix;
+    build<TJoinOp::RIGHT_OUTER_JOIN>(radix, build_keys, true);
+    auto matched = probe<TJoinOp::RIGHT_OUTER_JOIN>(radix, probe_keys);
+    EXPECT_EQ((std::vector<std::pair<uint32_t, uint32_t>> {{0, 1}, {0, 3}, {1, 5}}), matched);
+    EXPECT_EQ((std::vector<uint8_t> {0, 1, 0, 1, 0, 1}), radix.get_visited());
+}
+
+// Puts all strings of the same size into one chain, so string keys are told apart by their
+// tags and chars only.
+struct StringSizeHash {
+    size_t operator()(const StringRef& key) const { return key.size; }
+};
+
+TEST_F(JoinHashTableTest, StringKeysWithSharedPrefix) {
+    std::vector<std::string> build_strs {"",     "",     "a",        "ab",       "abcd",
+                                         "abce", "abcd", "abcdefgh", "abcdefgi", "abcx"};
+    std::vector<std::string> probe_strs {"abcd", "abcdefgi", "abcdefgj", "ab", "b", "", "abcx"};
+    std::vector<StringRef> build_keys(build_strs.begin(), build_strs.end());
+    std::vector<StringRef> probe_keys(probe_strs.begin(), probe_strs.end());
+
+    for (bool radix_build : {false, true}) {
+        JoinHashTable<StringRef, StringSizeHash> table;
+        build<TJoinOp::INNER_JOIN>(table, build_keys, radix_build);
+        auto matched = probe<TJoinOp::INNER_JOIN>(table, probe_keys);
+        EXPECT_EQ((std::vector<std::pair<uint32_t, uint32_t>> {
+                          {0, 4}, {0, 6}, {1, 8}, {3, 3}, {5, 1}, {6, 9}}),
+                  matched);
+    }
+}
+
+} // namespace doris
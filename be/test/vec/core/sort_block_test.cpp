@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "common/config.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+Block create_block(size_t rows) {
+    std::mt19937 rng(42);
+    auto nested_int = ColumnInt32::create();
+    auto null_map = ColumnUInt8::create();
+    auto big_int = ColumnInt64::create();
+    auto str = ColumnString::create();
+    for (size_t i = 0; i < rows; ++i) {
+        bool is_null = rng() % 10 == 0;
+        nested_int->insert_value(is_null ? 0 : static_cast<Int32>(rng() % 16) - 8);
+        null_map->insert_value(is_null);
+        big_int->insert_value(static_cast<Int64>(rng() % 8) - 4);
+        std::string value = std::to_string(rng() % 32);
+        str->insert_data(value.data(), value.size());
+    }
+    Block block;
+    block.insert({ColumnNullable::create(std::move(nested_int), std::move(null_map)),
+                  make_nullable(std::make_shared<DataTypeInt32>()), "a"});
+    block.insert({std::move(big_int), std::make_shared<DataTypeInt64>(), "b"});
+    block.insert({std::move(str), std::make_shared<DataTypeString>(), "c"});
+    return block;
+}
+
+} // namespace
+
+// Sorting by normalized keys must give the same order as the per column comparators.
+TEST(SortBlockTest, NormalizedKeyMatchesComparator) {
+    const bool enabled = config::enable_sort_by_normalized_key;
+    for (int a_direction : {1, -1}) {
+        for (int a_nulls_first : {0, 1}) {
+            SortDescription description;
+            int a_nulls_direction = a_nulls_first ? -a_direction : a_direction;
+            description.emplace_back(0, a_direction, a_nulls_direction);
+            description.emplace_back(1, -1, -1);
+            description.emplace_back(2, 1, 1);
+
+            Block expected = create_block(4096);
+            config::enable_sort_by_normalized_key = false;
+            sort_block(expected, expected, description);
+
+            Block actual = create_block(4096);
+            config::enable_sort_by_normalized_key = true;
+            sort_block(actual, actual, description);
+
+            ASSERT_EQ(expected.rows(), actual.rows());
+            for (size_t col = 0; col < expected.columns(); ++col) {
+                const auto& expected_column = *expected.get_by_position(col).column;
+                const auto& actual_column = *actual.get_by_position(col).column;
+                for (size_t row = 0; row < expected.rows(); ++row) {
+                    ASSERT_EQ(expected_column.compare_at(row, row, actual_column, 1), 0)
+                            << "column " << col << " row " << row;
+                }
+            }
+        }
+    }
+    config::enable_sort_by_normalized_key = enabled;
+}
+
+} // namespace doris::vectorized
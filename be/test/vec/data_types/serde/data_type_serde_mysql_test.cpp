@@ -125,7 +125,11 @@ void serialize_and_deserialize_mysql_test() {
                             vectorized::make_nullable(std::move(column_vector_int32));
                     auto mutable_nullable_vector = std::move(*column_nullable_vector).mutate();
                     for (int i = 0; i < row_num; i++) {
-                        mutable_nullable_vector->insert(int32(i));
+                        if (i % 3 == 0) {
+                            mutable_nullable_vector->insert_default();
+                        } else {
+                            mutable_nullable_vector->insert(int32(i));
+                        }
                     }
                     auto data_type = vectorized::make_nullable(
                             std::make_shared<vectorized::DataTypeInt32>());
@@ -319,6 +323,28 @@ void serialize_and_deserialize_mysql_test() {
 
     Status st = mysql_writer.write(&runtime_stat, block);
     EXPECT_TRUE(st.ok());
+
+    // the column-wise text rows must match the row-wise serde output
+    vectorized::Block output_block;
+    st = VExprContext::get_output_block_after_execute_exprs(_output_vexpr_ctxs, block,
+                                                            &output_block);
+    EXPECT_TRUE(st.ok());
+    ASSERT_EQ(1, mysql_writer.results().size());
+    const auto& rows = mysql_writer.results()[0]->result_batch.rows;
+    ASSERT_EQ(row_num, rows.size());
+    // the writer is not init(), so it uses the default options as well
+    DataTypeSerDe::FormatOptions options;
+    for (int row_idx = 0; row_idx < row_num; ++row_idx) {
+        MysqlRowBuffer<false> row_buffer;
+        for (size_t i = 0; i < output_block.columns(); ++i) {
+            const auto& [column, is_const] =
+                    unpack_if_const(output_block.get_by_position(i).column);
+            st = output_block.get_by_position(i).type->get_serde()->write_column_to_mysql(
+                    *column, row_buffer, row_idx, is_const, options);
+            EXPECT_TRUE(st.ok());
+        }
+        EXPECT_EQ(std::string(row_buffer.buf(), row_buffer.length()), rows[row_idx]);
+    }
 }
 
 TEST(DataTypeSerDeMysqlTest, ScalaSerDeTest) {
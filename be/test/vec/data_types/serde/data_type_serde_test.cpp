@@ -18,6 +18,9 @@
 
 #include "vec/data_types/serde/data_type_serde.h"
 
+#include <arrow/array/builder_binary.h>
+#include <arrow/array/builder_primitive.h>
+#include <cctz/time_zone.h>
 #include <gen_cpp/types.pb.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
@@ -282,4 +285,45 @@ TEST(DataTypeSerDeTest, DataTypeRowStoreSerDeTest) {
     }
 }
 
+TEST(DataTypeSerDeTest, ReadStringColumnFromArrowRange) {
+    arrow::StringBuilder builder;
+    ASSERT_TRUE(builder.Append("a").ok());
+    ASSERT_TRUE(builder.Append("bc").ok());
+    ASSERT_TRUE(builder.AppendNull().ok());
+    ASSERT_TRUE(builder.Append("def").ok());
+    ASSERT_TRUE(builder.Append("g").ok());
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+
+    auto data_type = std::make_shared<DataTypeString>();
+    auto column = ColumnString::create();
+    column->insert_data("x", 1);
+    cctz::time_zone ctz;
+    data_type->get_serde()->read_column_from_arrow(*column, array.get(), 1, 4, ctz);
+    data_type->get_serde()->read_column_from_arrow(*column, array->Slice(4).get(), 0, 1, ctz);
+
+    ASSERT_EQ(column->size(), 5);
+    EXPECT_EQ(column->get_data_at(0).to_string(), "x");
+    EXPECT_EQ(column->get_data_at(1).to_string(), "bc");
+    EXPECT_EQ(column->get_data_at(2).to_string(), "");
+    EXPECT_EQ(column->get_data_at(3).to_string(), "def");
+    EXPECT_EQ(column->get_data_at(4).to_string(), "g");
+}
+
+TEST(DataTypeSerDeTest, ReadBoolColumnFromArrowRange) {
+    arrow::BooleanBuilder builder;
+    ASSERT_TRUE(builder.AppendValues({true, false, true, true}).ok());
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(builder.Finish(&array).ok());
+
+    auto data_type = std::make_shared<DataTypeUInt8>();
+    auto column = ColumnUInt8::create();
+    cctz::time_zone ctz;
+    data_type->get_serde()->read_column_from_arrow(*column, array.get(), 1, 3, ctz);
+
+    ASSERT_EQ(column->size(), 2);
+    EXPECT_EQ(column->get_element(0), 0);
+    EXPECT_EQ(column->get_element(1), 1);
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/json/new_json_reader.h"
+
+#include <gtest/gtest.h>
+
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+TEST(NewJsonReaderTest, WriteNumberToColumn) {
+    auto int_column = ColumnInt32::create();
+    EXPECT_TRUE(NewJsonReader::try_write_number_to_column("-42 ", TYPE_INT, int_column.get()));
+    // out of range and fractional numbers are left to the serde
+    EXPECT_FALSE(
+            NewJsonReader::try_write_number_to_column("4294967296", TYPE_INT, int_column.get()));
+    EXPECT_FALSE(NewJsonReader::try_write_number_to_column("1.5", TYPE_INT, int_column.get()));
+    ASSERT_EQ(int_column->size(), 1);
+    EXPECT_EQ(int_column->get_element(0), -42);
+
+    auto largeint_column = ColumnInt128::create();
+    EXPECT_TRUE(NewJsonReader::try_write_number_to_column("9223372036854775807", TYPE_LARGEINT,
+                                                          largeint_column.get()));
+    EXPECT_FALSE(NewJsonReader::try_write_number_to_column("9223372036854775808", TYPE_LARGEINT,
+                                                           largeint_column.get()));
+    ASSERT_EQ(largeint_column->size(), 1);
+    EXPECT_EQ(largeint_column->get_element(0), Int128(9223372036854775807LL));
+
+    auto double_column = ColumnFloat64::create();
+    EXPECT_TRUE(
+            NewJsonReader::try_write_number_to_column("1.25e2", TYPE_DOUBLE, double_column.get()));
+    ASSERT_EQ(double_column->size(), 1);
+    EXPECT_DOUBLE_EQ(double_column->get_element(0), 125.0);
+
+    auto string_column = ColumnString::create();
+    EXPECT_FALSE(
+            NewJsonReader::try_write_number_to_column("1", TYPE_STRING, string_column.get()));
+    EXPECT_EQ(string_column->size(), 0);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <future>
+#include <mutex>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/exec/scan/scanner_scheduler.h"
+
+namespace doris::vectorized {
+
+static SimplifiedScanTask make_task(std::function<void()> func, int level, int64_t deadline) {
+    SimplifiedScanTask task(std::move(func), nullptr);
+    task.priority_level = level;
+    task.deadline_ms = deadline;
+    return task;
+}
+
+TEST(SimplifiedScanSchedulerTest, PriorityOrder) {
+    config::enable_scan_task_priority_scheduling = true;
+    SimplifiedScanScheduler scheduler("priority_test", nullptr);
+    ASSERT_TRUE(scheduler.start(1, 1, 100).ok());
+
+    // hold the only worker until all the tasks are queued
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    ASSERT_TRUE(scheduler.submit_scan_task(make_task([released] { released.wait(); }, 0, 0)).ok());
+
+    std::mutex lock;
+    std::vector<int> order;
+    std::promise<void> all_done;
+    auto record = [&](int id) {
+        return [&, id] {
+            std::lock_guard l(lock);
+            order.push_back(id);
+            if (order.size() == 4) {
+                all_done.set_value();
+            }
+        };
+    };
+    ASSERT_TRUE(scheduler.submit_scan_task(make_task(record(1), 2, 100)).ok());
+    ASSERT_TRUE(scheduler.submit_scan_task(make_task(record(2), 0, 200)).ok());
+    ASSERT_TRUE(scheduler.submit_scan_task(make_task(record(3), 0, 100)).ok());
+    ASSERT_TRUE(scheduler.submit_scan_task(make_task(record(4), 1, 0)).ok());
+    release.set_value();
+    all_done.get_future().wait();
+    EXPECT_EQ((std::vector<int> {3, 2, 4, 1}), order);
+    scheduler.stop();
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/split_source_connector.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+class SplitSourceConnectorTest : public testing::Test {
+public:
+    SplitSourceConnectorTest() = default;
+    ~SplitSourceConnectorTest() override = default;
+
+protected:
+    static TScanRangeParams _make_scan_range(TFileFormatType::type format_type, int64_t size) {
+        TFileRangeDesc range;
+        range.__set_path("/path/to/file");
+        range.__set_start_offset(0);
+        range.__set_size(size);
+        range.__set_file_size(size);
+        range.__set_format_type(format_type);
+        TScanRangeParams scan_range;
+        scan_range.scan_range.ext_scan_range.file_scan_range.ranges.emplace_back(range);
+        return scan_range;
+    }
+};
+
+TEST_F(SplitSourceConnectorTest, test_split_large_range) {
+    int64_t origin_split_bytes = config::file_scan_range_split_bytes;
+    config::file_scan_range_split_bytes = 100;
+
+    LocalSplitSourceConnector connector({_make_scan_range(TFileFormatType::FORMAT_PARQUET, 1000)},
+                                        4);
+    EXPECT_EQ(4, connector.num_scan_ranges());
+    int64_t next_offset = 0;
+    bool has_next = true;
+    while (true) {
+        TFileRangeDesc range;
+        ASSERT_TRUE(connector.get_next(&has_next, &range).ok());
+        if (!has_next) {
+            break;
+        }
+        EXPECT_EQ(next_offset, range.start_offset);
+        EXPECT_EQ(250, range.size);
+        next_offset += range.size;
+    }
+    EXPECT_EQ(1000, next_offset);
+
+    // too small or not a columnar format
+    LocalSplitSourceConnector small({_make_scan_range(TFileFormatType::FORMAT_ORC, 150)}, 4);
+    EXPECT_EQ(1, small.num_scan_ranges());
+    LocalSplitSourceConnector csv({_make_scan_range(TFileFormatType::FORMAT_CSV_PLAIN, 1000)}, 4);
+    EXPECT_EQ(1, csv.num_scan_ranges());
+
+    config::file_scan_range_split_bytes = 0;
+    LocalSplitSourceConnector disabled(
+            {_make_scan_range(TFileFormatType::FORMAT_PARQUET, 1000)}, 4);
+    EXPECT_EQ(1, disabled.num_scan_ranges());
+
+    config::file_scan_range_split_bytes = origin_split_bytes;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vfused_expr.h"
+
+#include <gtest/gtest.h>
+
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+using OpCode = FusedExprProgram::OpCode;
+
+class FusedExprTest : public testing::Test {
+protected:
+    // rows are chosen to cover a partial trailing chunk
+    static constexpr size_t ROWS = FusedExprProgram::CHUNK_SIZE * 2 + 17;
+
+    Block make_block() {
+        auto a = ColumnInt32::create();
+        auto a_null_map = ColumnUInt8::create();
+        auto b = ColumnInt64::create();
+        auto c = ColumnFloat64::create();
+        for (size_t i = 0; i < ROWS; ++i) {
+            a->insert_value(static_cast<Int32>(i % 100));
+            a_null_map->insert_value(i % 7 == 0);
+            b->insert_value(static_cast<Int64>(i) - 1000);
+            c->insert_value(static_cast<Float64>(i) * 0.5);
+        }
+        Block block;
+        block.insert({ColumnNullable::create(std::move(a), std::move(a_null_map)),
+                      make_nullable(std::make_shared<DataTypeInt32>()), "a"});
+        block.insert({std::move(b), std::make_shared<DataTypeInt64>(), "b"});
+        block.insert({std::move(c), std::make_shared<DataTypeFloat64>(), "c"});
+        return block;
+    }
+};
+
+TEST_F(FusedExprTest, CompareArithmetic) {
+    // (a + b) * 2 > 10
+    FusedExprProgram program;
+    int sum = program.binary(OpCode::ADD, program.load_slot(0, TYPE_INT),
+                             program.load_slot(1, TYPE_BIGINT));
+    int product = program.binary(OpCode::MUL, sum, program.load_int(2));
+    int result = program.binary(OpCode::GT, product, program.load_int(10));
+    ASSERT_GE(result, 0);
+    EXPECT_TRUE(program.finish(result, make_nullable(std::make_shared<DataTypeUInt8>()),
+                               TYPE_BOOLEAN)
+                        .ok());
+
+    Block block = make_block();
+    int result_column_id = -1;
+    bool fallback = true;
+    EXPECT_TRUE(program.execute(&block, "gt", &result_column_id, &fallback).ok());
+    EXPECT_FALSE(fallback);
+    ASSERT_EQ(result_column_id, 3);
+
+    const auto& column =
+            assert_cast<const ColumnNullable&>(*block.get_by_position(result_column_id).column);
+    const auto& values = assert_cast<const ColumnUInt8&>(column.get_nested_column()).get_data();
+    ASSERT_EQ(values.size(), ROWS);
+    for (size_t i = 0; i < ROWS; ++i) {
+        EXPECT_EQ(column.is_null_at(i), i % 7 == 0);
+        if (!column.is_null_at(i)) {
+            Int64 expected = (static_cast<Int64>(i % 100) + static_cast<Int64>(i) - 1000) * 2;
+            EXPECT_EQ(values[i], expected > 10) << i;
+        }
+    }
+}
+
+TEST_F(FusedExprTest, FloatArithmetic) {
+    // c * cast(b as double) - 1.5
+    FusedExprProgram program;
+    int product = program.binary(OpCode::MUL, program.load_slot(2, TYPE_DOUBLE),
+                                 program.int_to_float(program.load_slot(1, TYPE_BIGINT)));
+    int result = program.binary(OpCode::SUB, product, program.load_float(1.5));
+    ASSERT_GE(result, 0);
+    EXPECT_TRUE(program.finish(result, std::make_shared<DataTypeFloat64>(), TYPE_DOUBLE).ok());
+
+    Block block = make_block();
+    int result_column_id = -1;
+    bool fallback = true;
+    EXPECT_TRUE(program.execute(&block, "subtract", &result_column_id, &fallback).ok());
+    EXPECT_FALSE(fallback);
+
+    const auto& values =
+            assert_cast<const ColumnFloat64&>(*block.get_by_position(result_column_id).column)
+                    .get_data();
+    ASSERT_EQ(values.size(), ROWS);
+    for (size_t i = 0; i < ROWS; ++i) {
+        Float64 c = static_cast<Float64>(i) * 0.5;
+        Float64 b = static_cast<Float64>(static_cast<Int64>(i) - 1000);
+        EXPECT_DOUBLE_EQ(values[i], c * b - 1.5);
+    }
+}
+
+TEST_F(FusedExprTest, InvalidProgram) {
+    FusedExprProgram program;
+    int lhs = program.load_slot(1, TYPE_BIGINT);
+    int rhs = program.load_float(1.0);
+    // operands of different register types
+    EXPECT_EQ(program.binary(OpCode::ADD, lhs, rhs), -1);
+    // only fixed-width numeric slots can be loaded
+    EXPECT_EQ(program.load_slot(0, TYPE_STRING), -1);
+
+    int compare = program.binary(OpCode::LT, lhs, program.load_int(3));
+    int sum = program.binary(OpCode::ADD, lhs, lhs);
+    // a comparison that is not the last instruction
+    EXPECT_FALSE(program.finish(sum, std::make_shared<DataTypeInt64>(), TYPE_BIGINT).ok());
+    EXPECT_FALSE(program.finish(compare, std::make_shared<DataTypeUInt8>(), TYPE_BOOLEAN).ok());
+}
+
+TEST_F(FusedExprTest, FallbackOnUnexpectedColumn) {
+    FusedExprProgram program;
+    int sum = program.binary(OpCode::ADD, program.load_slot(0, TYPE_BIGINT),
+                             program.load_int(1));
+    int result = program.binary(OpCode::EQ, sum, program.load_int(2));
+    EXPECT_TRUE(program.finish(result, std::make_shared<DataTypeUInt8>(), TYPE_BOOLEAN).ok());
+
+    Block block;
+    block.insert({ColumnConst::create(ColumnInt64::create(1, 1), 10),
+                  std::make_shared<DataTypeInt64>(), "a"});
+    int result_column_id = -1;
+    bool fallback = false;
+    EXPECT_TRUE(program.execute(&block, "eq", &result_column_id, &fallback).ok());
+    EXPECT_TRUE(fallback);
+    EXPECT_EQ(block.columns(), 1);
+}
+
+} // namespace doris::vectorized
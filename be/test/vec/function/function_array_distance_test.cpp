@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+
+#include "common/status.h"
+#include "function_test_util.h"
+#include "gtest/gtest_pred_impl.h"
+#include "testutil/any_type.h"
+#include "vec/core/field.h"
+#include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+TEST(function_array_distance_test, distance) {
+    InputTypeSet input_types = {TypeIndex::Array, TypeIndex::Float64, TypeIndex::Array,
+                                TypeIndex::Float64};
+    Array vec1 = {Float64(1), Float64(2), Float64(3)};
+    Array vec2 = {Float64(4), Float64(6), Float64(3)};
+    Array vec_with_null = {Float64(4), Null(), Float64(3)};
+
+    DataSet l2_data_set = {{{vec1, vec2}, Float64(5)},
+                           {{vec1, vec1}, Float64(0)},
+                           {{vec1, vec_with_null}, Null()},
+                           {{Null(), vec1}, Null()}};
+    static_cast<void>(
+            check_function<DataTypeFloat64, true>("l2_distance", input_types, l2_data_set));
+
+    DataSet l1_data_set = {{{vec1, vec2}, Float64(7)}, {{vec1, vec_with_null}, Null()}};
+    static_cast<void>(
+            check_function<DataTypeFloat64, true>("l1_distance", input_types, l1_data_set));
+
+    DataSet inner_product_data_set = {{{vec1, vec2}, Float64(25)}, {{vec2, Null()}, Null()}};
+    static_cast<void>(check_function<DataTypeFloat64, true>("inner_product", input_types,
+                                                            inner_product_data_set));
+
+    Array mismatched = {Float64(1), Float64(2)};
+    DataSet mismatched_data_set = {{{vec1, mismatched}, Null()}};
+    static_cast<void>(check_function<DataTypeFloat64, true>("l2_distance", input_types,
+                                                            mismatched_data_set, true));
+}
+
+} // namespace doris::vectorized
@@ -25,6 +25,7 @@
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
+#include "vec/functions/multi_pattern_like.h"
 
 namespace doris::vectorized {
 
@@ -285,4 +286,27 @@ TEST(FunctionLikeTest, regexp_replace_one) {
     }
 }
 
+TEST(FunctionLikeTest, multi_pattern) {
+    std::shared_ptr<MultiPatternLikeMatcher> matcher;
+    ASSERT_TRUE(MultiPatternLikeMatcher::create({{.pattern = "%error%", .is_like = true},
+                                                 {.pattern = "abc_", .is_like = true},
+                                                 {.pattern = "^[0-9]+$", .is_like = false}},
+                                                &matcher)
+                        .ok());
+    EXPECT_EQ(matcher->num_patterns(), 3U);
+
+    auto strings = ColumnString::create();
+    std::vector<std::pair<std::string, uint8_t>> cases = {
+            {"an error occurred", 1}, {"abcd", 1}, {"abcde", 0}, {"12345", 1},
+            {"12a45", 0},             {"", 0},     {"ERROR", 0}, {"x.error", 1}};
+    for (const auto& [value, _] : cases) {
+        strings->insert_data(value.data(), value.size());
+    }
+    ColumnUInt8::Container res(strings->size(), 0);
+    ASSERT_TRUE(matcher->match(*strings, res).ok());
+    for (size_t i = 0; i < cases.size(); ++i) {
+        EXPECT_EQ(res[i], cases[i].second) << cases[i].first;
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/runtime/vsorted_run_merger.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "util/runtime_profile.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_description.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+using Run = std::vector<std::vector<int32_t>>;
+
+static Block create_block(const std::vector<int32_t>& values) {
+    auto column = ColumnInt32::create();
+    for (auto value : values) {
+        column->insert_value(value);
+    }
+    return Block({ColumnWithTypeAndName(std::move(column), std::make_shared<DataTypeInt32>(),
+                                        "k")});
+}
+
+// The supplier returns one block per call and reports eos with an empty block.
+static BlockSupplier create_supplier(Run run) {
+    auto blocks = std::make_shared<Run>(std::move(run));
+    auto next = std::make_shared<size_t>(0);
+    return [blocks, next](Block* block, bool* eos) {
+        if (*next == blocks->size()) {
+            *eos = true;
+            return Status::OK();
+        }
+        *block = create_block((*blocks)[(*next)++]);
+        return Status::OK();
+    };
+}
+
+static std::vector<int32_t> merge_runs(const std::vector<Run>& runs, size_t batch_size,
+                                       int64_t limit, size_t offset) {
+    RuntimeProfile profile("VSortedRunMergerTest");
+    SortDescription desc {SortColumnDescription(0, 1, 1)};
+    VSortedRunMerger merger(desc, batch_size, limit, offset, &profile);
+    std::vector<BlockSupplier> suppliers;
+    for (const auto& run : runs) {
+        suppliers.push_back(create_supplier(run));
+    }
+    EXPECT_TRUE(merger.prepare(suppliers).ok());
+
+    std::vector<int32_t> result;
+    bool eos = false;
+    while (!eos) {
+        Block block;
+        EXPECT_TRUE(merger.get_next(&block, &eos).ok());
+        if (block.rows() == 0) {
+            continue;
+        }
+        const auto& column = assert_cast<const ColumnInt32&>(*block.get_by_position(0).column);
+        for (size_t i = 0; i < block.rows(); ++i) {
+            result.push_back(column.get_element(i));
+        }
+    }
+    return result;
+}
+
+static std::vector<int32_t> expected_rows(const std::vector<Run>& runs, int64_t limit,
+                                          size_t offset) {
+    std::vector<int32_t> rows;
+    for (const auto& run : runs) {
+        for (const auto& block : run) {
+            rows.insert(rows.end(), block.begin(), block.end());
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    rows.erase(rows.begin(), rows.begin() + std::min(offset, rows.size()));
+    if (limit != -1 && rows.size() > static_cast<size_t>(limit)) {
+        rows.resize(limit);
+    }
+    return rows;
+}
+
+TEST(VSortedRunMergerTest, MergeRuns) {
+    std::vector<Run> runs {{{1, 4, 7}, {10, 13}},
+                           {},
+                           {{2, 5}, {8, 11, 14}},
+                           {{3, 3, 6}, {9}, {12, 15}}};
+    EXPECT_EQ(expected_rows(runs, -1, 0), merge_runs(runs, 4, -1, 0));
+    EXPECT_EQ(expected_rows(runs, 5, 3), merge_runs(runs, 4, 5, 3));
+}
+
+TEST(VSortedRunMergerTest, SingleRun) {
+    std::vector<Run> runs {{{1, 2, 3}, {4, 5}, {6}}};
+    EXPECT_EQ(expected_rows(runs, -1, 0), merge_runs(runs, 4, -1, 0));
+    EXPECT_EQ(expected_rows(runs, 2, 4), merge_runs(runs, 4, 2, 4));
+}
+
+TEST(VSortedRunMergerTest, MergeManyRuns) {
+    std::mt19937 rng(42);
+    // an odd number of runs so the loser tree is not a perfect binary tree
+    std::vector<Run> runs(37);
+    for (auto& run : runs) {
+        std::vector<int32_t> values(rng() % 100);
+        for (auto& value : values) {
+            value = static_cast<int32_t>(rng() % 1000);
+        }
+        std::sort(values.begin(), values.end());
+        for (size_t i = 0; i < values.size(); i += 16) {
+            run.emplace_back(values.begin() + i,
+                             values.begin() + std::min(i + 16, values.size()));
+        }
+    }
+    EXPECT_EQ(expected_rows(runs, -1, 0), merge_runs(runs, 64, -1, 0));
+    EXPECT_EQ(expected_rows(runs, 100, 50), merge_runs(runs, 64, 100, 50));
+}
+
+} // namespace doris::vectorized
@@ -160,6 +160,8 @@ extern BvarLatencyRecorderWithTag g_bvar_ms_get_rl_task_commit_attach;
 extern BvarLatencyRecorderWithTag g_bvar_ms_reset_rl_progress;
 extern BvarLatencyRecorderWithTag g_bvar_ms_get_txn_id;
 extern BvarLatencyRecorderWithTag g_bvar_ms_check_kv;
+extern bvar::Adder<int64_t> g_bvar_ms_schema_kv_cache_hit;
+extern bvar::Adder<int64_t> g_bvar_ms_schema_kv_cache_miss;
 
 // recycler's bvars
 extern BvarStatusWithTag<int64_t> g_bvar_recycler_recycle_index_earlest_ts;
@@ -181,6 +183,7 @@ extern bvar::LatencyRecorder g_bvar_txn_kv_range_remove;
 extern bvar::LatencyRecorder g_bvar_txn_kv_get_read_version;
 extern bvar::LatencyRecorder g_bvar_txn_kv_get_committed_version;
 extern bvar::LatencyRecorder g_bvar_txn_kv_batch_get;
+extern bvar::LatencyRecorder g_bvar_txn_kv_get_range_split_points;
 
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_conflict_counter;
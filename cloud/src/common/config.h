@@ -76,6 +76,9 @@ CONF_Bool(enable_checker, "false");
 // The parallelism for parallel recycle operation
 // s3_producer_pool recycle_tablet_pool, delete single object in this pool
 CONF_Int32(recycle_pool_parallelism, "40");
+// Files of one resource deleted by delete_rowset_data are split into tasks of this many paths,
+// which run in s3_producer_pool in parallel, a task sends DeleteObjects requests of 1000 keys.
+CONF_mInt32(recycle_delete_files_batch_size, "5000");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
 // Currently only used for recycler test
@@ -87,6 +90,10 @@ CONF_mInt64(delete_bitmap_storage_optimize_check_version_gap, "1000");
 CONF_mInt32(scan_instances_interval_seconds, "60"); // 1min
 // interval for check object
 CONF_mInt32(check_object_interval_seconds, "43200"); // 12hours
+// The rowset meta keys of an instance are split into chunks of about this many bytes according to
+// the estimates of fdb, and the chunks are checked by `check_object_scan_concurrency` threads.
+CONF_mInt64(check_object_scan_chunk_bytes, "1073741824"); // 1GB
+CONF_mInt32(check_object_scan_concurrency, "4");
 
 CONF_mInt64(check_recycle_task_interval_seconds, "600"); // 10min
 CONF_mInt64(recycler_sleep_before_scheduling_seconds, "60");
@@ -242,6 +249,9 @@ CONF_Bool(enable_cloud_txn_lazy_commit, "true");
 CONF_Int32(txn_lazy_commit_rowsets_thresold, "1000");
 CONF_Int32(txn_lazy_commit_num_threads, "8");
 CONF_Int32(txn_lazy_max_rowsets_per_batch, "1000");
+// max bytes of tmp rowset metas converted in one kv txn, must be less than max_txn_commit_byte
+CONF_mInt64(txn_lazy_max_bytes_per_batch, "4194304");
+CONF_Int32(txn_lazy_commit_partition_num_threads, "16");
 // max TabletIndexPB num for batch get
 CONF_Int32(max_tablet_index_num_per_batch, "1000");
 
@@ -252,4 +262,7 @@ CONF_Bool(enable_check_instance_id, "true");
 
 // Check if ip eq 127.0.0.1, ms/recycler exit
 CONF_Bool(enable_loopback_address_for_ms, "false");
+
+// Max number of parsed schema values cached by a meta service for get_rowset, 0 to disable
+CONF_mInt64(schema_kv_cache_capacity, "1024");
 } // namespace doris::cloud::config
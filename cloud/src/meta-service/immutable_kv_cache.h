@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bvar/bvar.h>
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace doris::cloud {
+
+// An in-process LRU cache of parsed values of keys that are never modified once they are
+// written, e.g. schema keys which are put only if they do not exist. Since such a value can not
+// change, the cache needs no invalidation and can be shared by all requests of a meta service.
+// Mutable keys (rowsets, tablet stats, versions) must NOT be cached here.
+//
+// `capacity` is read on every insert, so it may refer to a mutable config, 0 disables the cache.
+template <typename T>
+class ImmutableKvCache {
+public:
+    ImmutableKvCache(const int64_t& capacity, bvar::Adder<int64_t>* hits,
+                     bvar::Adder<int64_t>* misses)
+            : capacity_(capacity), hits_(hits), misses_(misses) {}
+
+    // Returns the cached value of `key`, nullptr if it is not cached
+    std::shared_ptr<const T> get(const std::string& key) {
+        auto& shard = get_shard(key);
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            *misses_ << 1;
+            return nullptr;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        *hits_ << 1;
+        return it->second->second;
+    }
+
+    void put(const std::string& key, std::shared_ptr<const T> value) {
+        int64_t shard_capacity = (capacity_ + NUM_SHARDS - 1) / NUM_SHARDS;
+        if (shard_capacity <= 0) {
+            return;
+        }
+        auto& shard = get_shard(key);
+        std::lock_guard lock(shard.mutex);
+        if (shard.map.contains(key)) {
+            return;
+        }
+        shard.lru.emplace_front(key, std::move(value));
+        shard.map.emplace(key, shard.lru.begin());
+        while (static_cast<int64_t>(shard.map.size()) > shard_capacity) {
+            shard.map.erase(shard.lru.back().first);
+            shard.lru.pop_back();
+        }
+    }
+
+private:
+    static constexpr int64_t NUM_SHARDS = 16;
+
+    using Entry = std::pair<std::string, std::shared_ptr<const T>>;
+
+    struct Shard {
+        std::mutex mutex;
+        // most recently used first
+        std::list<Entry> lru;
+        std::unordered_map<std::string, typename std::list<Entry>::iterator> map;
+    };
+
+    Shard& get_shard(const std::string& key) {
+        return shards_[std::hash<std::string> {}(key) % NUM_SHARDS];
+    }
+
+    const int64_t& capacity_;
+    bvar::Adder<int64_t>* hits_;
+    bvar::Adder<int64_t>* misses_;
+    Shard shards_[NUM_SHARDS];
+};
+
+} // namespace doris::cloud
@@ -483,6 +483,31 @@ TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res
     return TxnErrorCode::TXN_OK;
 }
 
+TxnErrorCode Transaction::get_range_split_points(std::string_view begin, std::string_view end,
+                                                 int64_t chunk_size,
+                                                 std::vector<std::string>* points) {
+    // Only the committed kvs are counted, the size of each kv is the exact estimate here
+    bool more = false;
+    std::map<std::string, std::string> kv_list;
+    TxnErrorCode err = kv_->get_kv(std::string(begin), std::string(end), read_version_, 0, &more,
+                                   &kv_list);
+    if (err != TxnErrorCode::TXN_OK) {
+        return err;
+    }
+    points->clear();
+    points->emplace_back(begin);
+    int64_t chunk_bytes = 0;
+    for (auto&& [k, v] : kv_list) {
+        if (chunk_bytes >= chunk_size && k != points->back()) {
+            points->push_back(k);
+            chunk_bytes = 0;
+        }
+        chunk_bytes += k.size() + v.size();
+    }
+    points->emplace_back(end);
+    return TxnErrorCode::TXN_OK;
+}
+
 FullRangeGetIterator::FullRangeGetIterator(std::string begin, std::string end,
                                            FullRangeGetIteratorOptions opts)
         : opts_(std::move(opts)), begin_(std::move(begin)), end_(std::move(end)) {}
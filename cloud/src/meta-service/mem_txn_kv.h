@@ -187,6 +187,10 @@ public:
                            const std::vector<std::string>& keys,
                            const BatchGetOptions& opts = BatchGetOptions()) override;
 
+    TxnErrorCode get_range_split_points(std::string_view begin, std::string_view end,
+                                        int64_t chunk_size,
+                                        std::vector<std::string>* points) override;
+
     size_t approximate_bytes() const override { return approximate_bytes_; }
 
     size_t num_del_keys() const override { return num_del_keys_; }
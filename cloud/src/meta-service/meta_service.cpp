@@ -70,7 +70,9 @@ namespace doris::cloud {
 
 MetaServiceImpl::MetaServiceImpl(std::shared_ptr<TxnKv> txn_kv,
                                  std::shared_ptr<ResourceManager> resource_mgr,
-                                 std::shared_ptr<RateLimiter> rate_limiter) {
+                                 std::shared_ptr<RateLimiter> rate_limiter)
+        : schema_cache_(config::schema_kv_cache_capacity, &g_bvar_ms_schema_kv_cache_hit,
+                        &g_bvar_ms_schema_kv_cache_miss) {
     txn_kv_ = txn_kv;
     resource_mgr_ = resource_mgr;
     rate_limiter_ = rate_limiter;
@@ -1461,8 +1463,13 @@ std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt,
 }
 
 static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rowset_meta,
-                                       const std::string& key, MetaServiceCode& code,
-                                       std::string& msg) {
+                                       const std::string& key,
+                                       ImmutableKvCache<doris::TabletSchemaCloudPB>& schema_cache,
+                                       MetaServiceCode& code, std::string& msg) {
+    if (auto cached_schema = schema_cache.get(key); cached_schema != nullptr) {
+        rowset_meta.mutable_tablet_schema()->CopyFrom(*cached_schema);
+        return true;
+    }
     ValueBuf val_buf;
     TxnErrorCode err = cloud::get(txn, key, &val_buf);
     if (err != TxnErrorCode::TXN_OK) {
@@ -1478,6 +1485,7 @@ static bool try_fetch_and_parse_schema(Transaction* txn, RowsetMetaCloudPB& rows
         msg = fmt::format("malformed schema value, key={}", key);
         return false;
     }
+    schema_cache.put(key, std::make_shared<const doris::TabletSchemaCloudPB>(*schema));
     return true;
 }
 
@@ -1649,7 +1657,8 @@ void MetaServiceImpl::get_rowset(::google::protobuf::RpcController* controller,
             } else {
                 auto key = meta_schema_key(
                         {instance_id, idx.index_id(), rowset_meta.schema_version()});
-                if (!try_fetch_and_parse_schema(txn.get(), rowset_meta, key, code, msg)) {
+                if (!try_fetch_and_parse_schema(txn.get(), rowset_meta, key, schema_cache_, code,
+                                                msg)) {
                     return;
                 }
                 version_to_schema.emplace(rowset_meta.schema_version(),
@@ -29,6 +29,7 @@
 
 #include "common/config.h"
 #include "cpp/sync_point.h"
+#include "meta-service/immutable_kv_cache.h"
 #include "meta-service/txn_kv.h"
 #include "meta-service/txn_lazy_committer.h"
 #include "rate-limiter/rate_limiter.h"
@@ -319,6 +320,8 @@ private:
     std::shared_ptr<ResourceManager> resource_mgr_;
     std::shared_ptr<RateLimiter> rate_limiter_;
     std::shared_ptr<TxnLazyCommitter> txn_lazy_committer_;
+    // schema values read by get_rowset, keyed by meta_schema_key
+    ImmutableKvCache<doris::TabletSchemaCloudPB> schema_cache_;
 };
 
 class MetaServiceProxy final : public MetaService {
@@ -667,6 +667,38 @@ TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res
     return TxnErrorCode::TXN_OK;
 }
 
+TxnErrorCode Transaction::get_range_split_points(std::string_view begin, std::string_view end,
+                                                 int64_t chunk_size,
+                                                 std::vector<std::string>* points) {
+    StopWatch sw;
+    auto* fut = fdb_transaction_get_range_split_points(txn_, (uint8_t*)begin.data(), begin.size(),
+                                                       (uint8_t*)end.data(), end.size(),
+                                                       chunk_size);
+    std::unique_ptr<int, std::function<void(int*)>> defer((int*)0x01, [fut, &sw](...) {
+        fdb_future_destroy(fut);
+        g_bvar_txn_kv_get_range_split_points << sw.elapsed_us();
+    });
+    RETURN_IF_ERROR(await_future(fut));
+    auto err = fdb_future_get_error(fut);
+    if (err) {
+        LOG(WARNING) << "get range split points: " << fdb_get_error(err);
+        return cast_as_txn_code(err);
+    }
+    const FDBKey* keys = nullptr;
+    int num_keys = 0;
+    err = fdb_future_get_key_array(fut, &keys, &num_keys);
+    if (err) {
+        LOG(WARNING) << "get range split points: " << fdb_get_error(err);
+        return cast_as_txn_code(err);
+    }
+    points->clear();
+    points->reserve(num_keys);
+    for (int i = 0; i < num_keys; ++i) {
+        points->emplace_back((const char*)keys[i].key, keys[i].key_length);
+    }
+    return TxnErrorCode::TXN_OK;
+}
+
 FullRangeGetIterator::FullRangeGetIterator(std::string begin, std::string end,
                                            FullRangeGetIteratorOptions opts)
         : opts_(std::move(opts)), begin_(std::move(begin)), end_(std::move(end)) {
@@ -228,6 +228,17 @@ public:
                                    const std::vector<std::string>& keys,
                                    const BatchGetOptions& opts = BatchGetOptions()) = 0;
 
+    /**
+     * @brief get keys which split the closed-open range [begin, end) into chunks of about
+     *        `chunk_size` bytes, based on the estimates of the storage.
+     *
+     * @param points output keys, the first one is `begin` and the last one is `end`
+     * @return TXN_OK for success otherwise error
+     */
+    virtual TxnErrorCode get_range_split_points(std::string_view begin, std::string_view end,
+                                                int64_t chunk_size,
+                                                std::vector<std::string>* points) = 0;
+
     /**
      * @brief return the approximate bytes consumed by the underlying transaction buffer.
      **/
@@ -563,6 +574,10 @@ public:
                            const std::vector<std::string>& keys,
                            const BatchGetOptions& opts = BatchGetOptions()) override;
 
+    TxnErrorCode get_range_split_points(std::string_view begin, std::string_view end,
+                                        int64_t chunk_size,
+                                        std::vector<std::string>* points) override;
+
     size_t approximate_bytes() const override { return approximate_bytes_; }
 
     size_t num_del_keys() const override { return num_del_keys_; }
@@ -17,7 +17,9 @@
 
 #include "txn_lazy_committer.h"
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 
 #include "common/logging.h"
 #include "common/util.h"
@@ -297,8 +299,196 @@ TxnLazyCommitTask::TxnLazyCommitTask(const std::string& instance_id, int64_t txn
     DCHECK(txn_id > 0);
 }
 
-void TxnLazyCommitTask::commit() {
+void TxnLazyCommitTask::commit_partition(
+        int64_t db_id, int64_t partition_id,
+        const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+        MetaServiceCode& code, std::string& msg) {
     std::stringstream ss;
+    // tablet_id -> TabletIndexPB
+    std::unordered_map<int64_t, TabletIndexPB> tablet_ids;
+
+    // Cut the rowsets into batches bounded by both count and bytes, so that every kv txn
+    // carries as many conversions as the size limit of a single txn allows.
+    size_t batch_begin = 0;
+    while (batch_begin < tmp_rowset_metas.size()) {
+        size_t batch_end = batch_begin;
+        int64_t batch_bytes = 0;
+        while (batch_end < tmp_rowset_metas.size() &&
+               batch_end - batch_begin < config::txn_lazy_max_rowsets_per_batch &&
+               (batch_end == batch_begin || batch_bytes < config::txn_lazy_max_bytes_per_batch)) {
+            auto& [tmp_rowset_key, tmp_rowset_pb] = tmp_rowset_metas[batch_end++];
+            batch_bytes += tmp_rowset_key.size() + tmp_rowset_pb.ByteSizeLong();
+        }
+        std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
+                sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + batch_begin,
+                                               tmp_rowset_metas.begin() + batch_end);
+        convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code, msg, db_id,
+                            sub_partition_tmp_rowset_metas, tablet_ids);
+        if (code != MetaServiceCode::OK) return;
+        batch_begin = batch_end;
+    }
+
+    std::unique_ptr<Transaction> txn;
+    TxnErrorCode err = txn_kv_->create_txn(&txn);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::CREATE>(err);
+        ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+
+    int64_t table_id = -1;
+    DCHECK(tmp_rowset_metas.size() > 0);
+    if (table_id <= 0) {
+        if (tablet_ids.size() > 0) {
+            // get table_id from memory cache
+            table_id = tablet_ids.begin()->second.table_id();
+        } else {
+            // get table_id from storage
+            int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
+            std::string tablet_idx_key =
+                    meta_tablet_idx_key({instance_id_, first_tablet_id});
+            std::string tablet_idx_val;
+            err = txn->get(tablet_idx_key, &tablet_idx_val, true);
+            if (TxnErrorCode::TXN_OK != err) {
+                code = err == TxnErrorCode::TXN_KEY_NOT_FOUND
+                                ? MetaServiceCode::TXN_ID_NOT_FOUND
+                                : cast_as<ErrCategory::READ>(err);
+                ss << "failed to get tablet idx, txn_id=" << txn_id_
+                   << " key=" << hex(tablet_idx_key) << " err=" << err;
+                msg = ss.str();
+                LOG(WARNING) << msg;
+                return;
+            }
+
+            TabletIndexPB tablet_idx_pb;
+            if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
+                code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+                ss << "failed to parse tablet idx pb txn_id=" << txn_id_
+                   << " key=" << hex(tablet_idx_key);
+                msg = ss.str();
+                return;
+            }
+            table_id = tablet_idx_pb.table_id();
+        }
+    }
+
+    DCHECK(table_id > 0);
+    DCHECK(partition_id > 0);
+
+    std::string ver_val;
+    std::string ver_key =
+            partition_version_key({instance_id_, db_id, table_id, partition_id});
+    err = txn->get(ver_key, &ver_val);
+    if (TxnErrorCode::TXN_OK != err) {
+        code = err == TxnErrorCode::TXN_KEY_NOT_FOUND
+                        ? MetaServiceCode::TXN_ID_NOT_FOUND
+                        : cast_as<ErrCategory::READ>(err);
+        ss << "failed to get partiton version, txn_id=" << txn_id_
+           << " key=" << hex(ver_key) << " err=" << err;
+        msg = ss.str();
+        LOG(WARNING) << msg;
+        return;
+    }
+    VersionPB version_pb;
+    if (!version_pb.ParseFromString(ver_val)) {
+        code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+        ss << "failed to parse version pb txn_id=" << txn_id_
+           << " key=" << hex(ver_key);
+        msg = ss.str();
+        return;
+    }
+
+    if (version_pb.pending_txn_ids_size() > 0 &&
+        version_pb.pending_txn_ids(0) == txn_id_) {
+        DCHECK(version_pb.pending_txn_ids_size() == 1);
+        version_pb.clear_pending_txn_ids();
+        ver_val.clear();
+
+        if (version_pb.has_version()) {
+            version_pb.set_version(version_pb.version() + 1);
+        } else {
+            // first commit txn version is 2
+            version_pb.set_version(2);
+        }
+        if (!version_pb.SerializeToString(&ver_val)) {
+            code = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
+            ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
+            msg = ss.str();
+            return;
+        }
+        txn->put(ver_key, ver_val);
+        LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
+                  << " version_pb=" << version_pb.ShortDebugString();
+
+        for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
+            txn->remove(tmp_rowset_key);
+            LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key)
+                      << " txn_id=" << txn_id_;
+        }
+
+        err = txn->commit();
+        if (err != TxnErrorCode::TXN_OK) {
+            code = cast_as<ErrCategory::COMMIT>(err);
+            ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
+            msg = ss.str();
+            return;
+        }
+    }}
+
+void TxnLazyCommitTask::commit_partitions(
+        int64_t db_id,
+        const std::unordered_map<
+                int64_t, std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                partition_to_tmp_rowset_metas) {
+    struct PartitionResult {
+        MetaServiceCode code = MetaServiceCode::OK;
+        std::string msg;
+    };
+    std::vector<PartitionResult> results(partition_to_tmp_rowset_metas.size());
+    std::atomic<bool> failed = false;
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t pending = 0;
+
+    size_t idx = 0;
+    for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
+        // Partitions touch disjoint keys, so they are converted concurrently and only the
+        // visibility of the whole txn is published after all of them are done.
+        auto job = [&, partition_id = partition_id, rowsets = &tmp_rowset_metas,
+                    result = &results[idx++]]() {
+            if (!failed) {
+                commit_partition(db_id, partition_id, *rowsets, result->code, result->msg);
+                if (result->code != MetaServiceCode::OK) failed = true;
+            }
+            std::unique_lock<std::mutex> lock(mutex);
+            if (--pending == 0) cond.notify_all();
+        };
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++pending;
+        }
+        if (txn_lazy_committer_->partition_pool_->submit(job) != 0) {
+            job(); // run inline if the pool is not running
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait(lock, [&]() { return pending == 0; });
+    }
+
+    for (auto& result : results) {
+        if (result.code != MetaServiceCode::OK) {
+            code_ = result.code;
+            msg_ = std::move(result.msg);
+            return;
+        }
+    }
+}
+
+void TxnLazyCommitTask::commit() {
     int retry_times = 0;
     do {
         LOG(INFO) << "lazy task commit txn_id=" << txn_id_ << " retry_times=" << retry_times;
@@ -332,133 +522,7 @@ void TxnLazyCommitTask::commit() {
                         tmp_rowset_pb;
             }
 
-            // tablet_id -> TabletIndexPB
-            std::unordered_map<int64_t, TabletIndexPB> tablet_ids;
-            for (auto& [partition_id, tmp_rowset_metas] : partition_to_tmp_rowset_metas) {
-                for (size_t i = 0; i < tmp_rowset_metas.size();
-                     i += config::txn_lazy_max_rowsets_per_batch) {
-                    size_t end =
-                            (i + config::txn_lazy_max_rowsets_per_batch) > tmp_rowset_metas.size()
-                                    ? tmp_rowset_metas.size()
-                                    : i + config::txn_lazy_max_rowsets_per_batch;
-                    std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>
-                            sub_partition_tmp_rowset_metas(tmp_rowset_metas.begin() + i,
-                                                           tmp_rowset_metas.begin() + end);
-                    convert_tmp_rowsets(instance_id_, txn_id_, txn_kv_, code_, msg_, db_id,
-                                        sub_partition_tmp_rowset_metas, tablet_ids);
-                    if (code_ != MetaServiceCode::OK) break;
-                }
-                if (code_ != MetaServiceCode::OK) break;
-
-                std::unique_ptr<Transaction> txn;
-                TxnErrorCode err = txn_kv_->create_txn(&txn);
-                if (err != TxnErrorCode::TXN_OK) {
-                    code_ = cast_as<ErrCategory::CREATE>(err);
-                    ss << "failed to create txn, txn_id=" << txn_id_ << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-
-                int64_t table_id = -1;
-                DCHECK(tmp_rowset_metas.size() > 0);
-                if (table_id <= 0) {
-                    if (tablet_ids.size() > 0) {
-                        // get table_id from memory cache
-                        table_id = tablet_ids.begin()->second.table_id();
-                    } else {
-                        // get table_id from storage
-                        int64_t first_tablet_id = tmp_rowset_metas.begin()->second.tablet_id();
-                        std::string tablet_idx_key =
-                                meta_tablet_idx_key({instance_id_, first_tablet_id});
-                        std::string tablet_idx_val;
-                        err = txn->get(tablet_idx_key, &tablet_idx_val, true);
-                        if (TxnErrorCode::TXN_OK != err) {
-                            code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                            ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                            : cast_as<ErrCategory::READ>(err);
-                            ss << "failed to get tablet idx, txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key) << " err=" << err;
-                            msg_ = ss.str();
-                            LOG(WARNING) << msg_;
-                            break;
-                        }
-
-                        TabletIndexPB tablet_idx_pb;
-                        if (!tablet_idx_pb.ParseFromString(tablet_idx_val)) {
-                            code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                            ss << "failed to parse tablet idx pb txn_id=" << txn_id_
-                               << " key=" << hex(tablet_idx_key);
-                            msg_ = ss.str();
-                            break;
-                        }
-                        table_id = tablet_idx_pb.table_id();
-                    }
-                }
-
-                DCHECK(table_id > 0);
-                DCHECK(partition_id > 0);
-
-                std::string ver_val;
-                std::string ver_key =
-                        partition_version_key({instance_id_, db_id, table_id, partition_id});
-                err = txn->get(ver_key, &ver_val);
-                if (TxnErrorCode::TXN_OK != err) {
-                    code_ = err == TxnErrorCode::TXN_KEY_NOT_FOUND
-                                    ? MetaServiceCode::TXN_ID_NOT_FOUND
-                                    : cast_as<ErrCategory::READ>(err);
-                    ss << "failed to get partiton version, txn_id=" << txn_id_
-                       << " key=" << hex(ver_key) << " err=" << err;
-                    msg_ = ss.str();
-                    LOG(WARNING) << msg_;
-                    break;
-                }
-                VersionPB version_pb;
-                if (!version_pb.ParseFromString(ver_val)) {
-                    code_ = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                    ss << "failed to parse version pb txn_id=" << txn_id_
-                       << " key=" << hex(ver_key);
-                    msg_ = ss.str();
-                    break;
-                }
-
-                if (version_pb.pending_txn_ids_size() > 0 &&
-                    version_pb.pending_txn_ids(0) == txn_id_) {
-                    DCHECK(version_pb.pending_txn_ids_size() == 1);
-                    version_pb.clear_pending_txn_ids();
-                    ver_val.clear();
-
-                    if (version_pb.has_version()) {
-                        version_pb.set_version(version_pb.version() + 1);
-                    } else {
-                        // first commit txn version is 2
-                        version_pb.set_version(2);
-                    }
-                    if (!version_pb.SerializeToString(&ver_val)) {
-                        code_ = MetaServiceCode::PROTOBUF_SERIALIZE_ERR;
-                        ss << "failed to serialize version_pb when saving, txn_id=" << txn_id_;
-                        msg_ = ss.str();
-                        break;
-                    }
-                    txn->put(ver_key, ver_val);
-                    LOG(INFO) << "put ver_key=" << hex(ver_key) << " txn_id=" << txn_id_
-                              << " version_pb=" << version_pb.ShortDebugString();
-
-                    for (auto& [tmp_rowset_key, tmp_rowset_pb] : tmp_rowset_metas) {
-                        txn->remove(tmp_rowset_key);
-                        LOG(INFO) << "remove tmp_rowset_key=" << hex(tmp_rowset_key)
-                                  << " txn_id=" << txn_id_;
-                    }
-
-                    err = txn->commit();
-                    if (err != TxnErrorCode::TXN_OK) {
-                        code_ = cast_as<ErrCategory::COMMIT>(err);
-                        ss << "failed to commit kv txn, txn_id=" << txn_id_ << " err=" << err;
-                        msg_ = ss.str();
-                        break;
-                    }
-                }
-            }
+            commit_partitions(db_id, partition_to_tmp_rowset_metas);
             if (code_ != MetaServiceCode::OK) {
                 LOG(WARNING) << "txn_id=" << txn_id_ << " code=" << code_ << " msg=" << msg_;
                 break;
@@ -501,6 +565,9 @@ std::pair<MetaServiceCode, std::string> TxnLazyCommitTask::wait() {
 TxnLazyCommitter::TxnLazyCommitter(std::shared_ptr<TxnKv> txn_kv) : txn_kv_(txn_kv) {
     worker_pool_ = std::make_unique<SimpleThreadPool>(config::txn_lazy_commit_num_threads);
     worker_pool_->start();
+    partition_pool_ =
+            std::make_unique<SimpleThreadPool>(config::txn_lazy_commit_partition_num_threads);
+    partition_pool_->start();
 }
 
 /**
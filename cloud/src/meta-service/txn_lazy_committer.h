@@ -39,6 +39,20 @@ public:
 private:
     friend class TxnLazyCommitter;
 
+    // Convert the tmp rowsets of one partition and bump its version
+    void commit_partition(
+            int64_t db_id, int64_t partition_id,
+            const std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>& tmp_rowset_metas,
+            MetaServiceCode& code, std::string& msg);
+
+    // Run commit_partition for every partition on the partition pool of the committer,
+    // the first failure is saved to code_ and msg_
+    void commit_partitions(
+            int64_t db_id,
+            const std::unordered_map<
+                    int64_t, std::vector<std::pair<std::string, doris::RowsetMetaCloudPB>>>&
+                    partition_to_tmp_rowset_metas);
+
     std::string instance_id_;
     int64_t txn_id_;
     std::shared_ptr<TxnKv> txn_kv_;
@@ -57,9 +71,13 @@ public:
     void remove(int64_t txn_id);
 
 private:
+    friend class TxnLazyCommitTask;
+
     std::shared_ptr<TxnKv> txn_kv_;
 
     std::unique_ptr<SimpleThreadPool> worker_pool_;
+    // Converts the partitions of a txn concurrently, shared by all lazy commit tasks
+    std::unique_ptr<SimpleThreadPool> partition_pool_;
 
     std::mutex mutex_;
     // <txn_id, TxnLazyCommitTask>
@@ -32,13 +32,16 @@
 #include <mutex>
 #include <sstream>
 #include <string_view>
+#include <tuple>
 #include <unordered_set>
+#include <variant>
 #include <vector>
 
 #include "common/bvars.h"
 #include "common/config.h"
 #include "common/encryption_util.h"
 #include "common/logging.h"
+#include "common/simple_thread_pool.h"
 #include "common/util.h"
 #include "cpp/sync_point.h"
 #include "meta-service/keys.h"
@@ -47,6 +50,7 @@
 #include "recycler/hdfs_accessor.h"
 #include "recycler/s3_accessor.h"
 #include "recycler/storage_vault_accessor.h"
+#include "recycler/sync_executor.h"
 #ifdef UNIT_TEST
 #include "../test/mock_accessor.h"
 #endif
@@ -492,15 +496,23 @@ int InstanceChecker::do_check() {
         int64_t tablet_id {0};
         std::unordered_set<std::string> files;
     };
-    TabletFiles tablet_files_cache;
+    // Statistics of checking a sub range of the rowset meta keys
+    struct RangeStats {
+        int check_ret = 0;
+        long num_scanned = 0;
+        long num_scanned_with_segment = 0;
+        long num_rowset_loss = 0;
+        long instance_volume = 0;
+    };
 
-    auto check_rowset_objects = [&, this](const doris::RowsetMetaCloudPB& rs_meta,
-                                          std::string_view key) {
+    auto check_rowset_objects = [this](const doris::RowsetMetaCloudPB& rs_meta,
+                                       std::string_view key, TabletFiles& tablet_files_cache,
+                                       RangeStats& stats) {
         if (rs_meta.num_segments() == 0) {
             return;
         }
 
-        ++num_scanned_with_segment;
+        ++stats.num_scanned_with_segment;
         if (tablet_files_cache.tablet_id != rs_meta.tablet_id()) {
             long tablet_volume = 0;
             // Clear cache
@@ -513,7 +525,7 @@ int InstanceChecker::do_check() {
                         .tag("resource_id", rs_meta.resource_id())
                         .tag("tablet_id", rs_meta.tablet_id())
                         .tag("rowset_id", rs_meta.rowset_id_v2());
-                check_ret = -1;
+                stats.check_ret = -1;
                 return;
             }
 
@@ -521,7 +533,7 @@ int InstanceChecker::do_check() {
             int ret = find_it->second->list_directory(tablet_path_prefix(rs_meta.tablet_id()),
                                                       &list_iter);
             if (ret != 0) { // No need to log, because S3Accessor has logged this error
-                check_ret = -1;
+                stats.check_ret = -1;
                 return;
             }
 
@@ -530,7 +542,7 @@ int InstanceChecker::do_check() {
                 tablet_volume += file->size;
             }
             tablet_files_cache.tablet_id = rs_meta.tablet_id();
-            instance_volume += tablet_volume;
+            stats.instance_volume += tablet_volume;
         }
 
         bool data_loss = false;
@@ -550,46 +562,113 @@ int InstanceChecker::do_check() {
         }
 
         if (data_loss) {
-            ++num_rowset_loss;
+            ++stats.num_rowset_loss;
+        }
+    };
+
+    // Scan the visible rowsets in [begin, end), the next batch of kvs is prefetched while
+    // checking the objects of the current batch.
+    auto check_range = [&, this](std::string begin, std::string end) {
+        RangeStats stats;
+        TabletFiles tablet_files_cache;
+        FullRangeGetIteratorOptions opts(txn_kv_);
+        opts.prefetch = true;
+        opts.snapshot = true;
+        auto it = txn_kv_->full_range_get(std::move(begin), std::move(end), std::move(opts));
+        for (auto kv = it->next(); kv.has_value() && !stopped(); kv = it->next()) {
+            auto [k, v] = *kv;
+            ++stats.num_scanned;
+
+            doris::RowsetMetaCloudPB rs_meta;
+            if (!rs_meta.ParseFromArray(v.data(), v.size())) {
+                ++stats.num_rowset_loss;
+                LOG(WARNING) << "malformed rowset meta. key=" << hex(k) << " val=" << hex(v);
+                continue;
+            }
+            check_rowset_objects(rs_meta, k, tablet_files_cache, stats);
+        }
+        if (!it->is_valid()) {
+            LOG(WARNING) << "internal error, failed to get rowset meta, instance_id="
+                         << instance_id_;
+            stats.check_ret = -1;
         }
+        return stats;
     };
 
-    // scan visible rowsets
     auto start_key = meta_rowset_key({instance_id_, 0, 0});
     auto end_key = meta_rowset_key({instance_id_, INT64_MAX, 0});
+    std::vector<std::string> split_keys = split_rowset_meta_range(start_key, end_key);
+
+    std::vector<RangeStats> range_stats;
+    if (split_keys.size() <= 2 || config::check_object_scan_concurrency <= 1) {
+        range_stats.push_back(check_range(start_key, end_key));
+    } else {
+        auto pool = std::make_shared<SimpleThreadPool>(config::check_object_scan_concurrency);
+        pool->start();
+        SyncExecutor<RangeStats> executor(pool, fmt::format("check objects of {}", instance_id_));
+        for (size_t i = 0; i + 1 < split_keys.size(); ++i) {
+            executor.add([&check_range, &split_keys, i]() {
+                return check_range(split_keys[i], split_keys[i + 1]);
+            });
+        }
+        bool finished = true;
+        range_stats = executor.when_all(&finished);
+        pool->stop();
+        if (!finished) {
+            LOG(WARNING) << "failed to check all rowset meta ranges, instance_id=" << instance_id_;
+            check_ret = -1;
+        }
+    }
 
-    std::unique_ptr<RangeGetIterator> it;
-    do {
+    for (auto& stats : range_stats) {
+        num_scanned += stats.num_scanned;
+        num_scanned_with_segment += stats.num_scanned_with_segment;
+        num_rowset_loss += stats.num_rowset_loss;
+        instance_volume += stats.instance_volume;
+        if (stats.check_ret != 0) {
+            check_ret = stats.check_ret;
+        }
+    }
+
+    return num_rowset_loss > 0 ? 1 : check_ret;
+}
+
+std::vector<std::string> InstanceChecker::split_rowset_meta_range(const std::string& begin,
+                                                                  const std::string& end) {
+    std::vector<std::string> split_keys {begin};
+    if (config::check_object_scan_concurrency > 1 && config::check_object_scan_chunk_bytes > 0) {
         std::unique_ptr<Transaction> txn;
+        std::vector<std::string> points;
         TxnErrorCode err = txn_kv_->create_txn(&txn);
-        if (err != TxnErrorCode::TXN_OK) {
-            LOG(WARNING) << "failed to init txn, err=" << err;
-            return -1;
+        if (err == TxnErrorCode::TXN_OK) {
+            err = txn->get_range_split_points(begin, end, config::check_object_scan_chunk_bytes,
+                                              &points);
         }
-
-        err = txn->get(start_key, end_key, &it);
         if (err != TxnErrorCode::TXN_OK) {
-            LOG(WARNING) << "internal error, failed to get rowset meta, err=" << err;
-            return -1;
+            // Not fatal, fall back to scan the whole range sequentially
+            LOG(WARNING) << "failed to get split points of rowset meta range, instance_id="
+                         << instance_id_ << " err=" << err;
+            points.clear();
         }
-        num_scanned += it->size();
-
-        while (it->has_next() && !stopped()) {
-            auto [k, v] = it->next();
-            if (!it->has_next()) start_key = k;
-
-            doris::RowsetMetaCloudPB rs_meta;
-            if (!rs_meta.ParseFromArray(v.data(), v.size())) {
-                ++num_rowset_loss;
-                LOG(WARNING) << "malformed rowset meta. key=" << hex(k) << " val=" << hex(v);
+        for (auto& point : points) {
+            // Align each split point to the first rowset meta key of its tablet, so that the
+            // objects of a tablet are listed by only one sub range.
+            std::string_view k1 = point;
+            k1.remove_prefix(1);
+            std::vector<std::tuple<std::variant<int64_t, std::string>, int, int>> out;
+            decode_key(&k1, &out);
+            // 0x01 "meta" ${instance_id} "rowset" ${tablet_id} ${version} -> RowsetMetaCloudPB
+            if (out.size() < 4 || !std::holds_alternative<int64_t>(std::get<0>(out[3]))) {
                 continue;
             }
-            check_rowset_objects(rs_meta, k);
+            auto key = meta_rowset_key({instance_id_, std::get<int64_t>(std::get<0>(out[3])), 0});
+            if (key > split_keys.back() && key < end) {
+                split_keys.push_back(std::move(key));
+            }
         }
-        start_key.push_back('\x00'); // Update to next smallest key for iteration
-    } while (it->more() && !stopped());
-
-    return num_rowset_loss > 0 ? 1 : check_ret;
+    }
+    split_keys.push_back(end);
+    return split_keys;
 }
 
 int InstanceChecker::get_bucket_lifecycle(int64_t* lifecycle_days) {
@@ -24,9 +24,11 @@
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "recycler/storage_vault_accessor.h"
 #include "recycler/white_black_list.h"
@@ -117,6 +119,12 @@ private:
     // returns 0 for success otherwise error
     int init_storage_vault_accessors(const InstanceInfoPB& instance);
 
+    // Split [begin, end) of the rowset meta keys into sub ranges of about
+    // `check_object_scan_chunk_bytes` bytes at tablet boundaries, which are checked in parallel.
+    // Return the boundaries of the sub ranges, the first one is `begin` and the last one is `end`.
+    std::vector<std::string> split_rowset_meta_range(const std::string& begin,
+                                                     const std::string& end);
+
     int traverse_mow_tablet(const std::function<int(int64_t)>& check_func);
     int traverse_rowset_delete_bitmaps(
             int64_t tablet_id, std::string rowset_id,
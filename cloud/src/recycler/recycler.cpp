@@ -22,11 +22,13 @@
 #include <gen_cpp/cloud.pb.h>
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <iterator>
 #include <string>
 #include <string_view>
 
@@ -1563,14 +1565,27 @@ int InstanceRecycler::delete_rowset_data(const std::vector<doris::RowsetMetaClou
     SyncExecutor<int> concurrent_delete_executor(_thread_pool_group.s3_producer_pool,
                                                  "delete_rowset_data",
                                                  [](const int& ret) { return ret != 0; });
+    // Split the files of a resource so that a large batch of rowsets is deleted by several
+    // threads instead of one serial sequence of DeleteObjects requests.
+    size_t batch_size = std::max(config::recycle_delete_files_batch_size, 1);
+    std::vector<std::pair<const std::string*, std::vector<std::string>>> file_path_batches;
     for (auto& [resource_id, file_paths] : resource_file_paths) {
-        concurrent_delete_executor.add([&, rid = &resource_id, paths = &file_paths]() -> int {
+        for (size_t i = 0; i < file_paths.size(); i += batch_size) {
+            size_t end = std::min(file_paths.size(), i + batch_size);
+            file_path_batches.emplace_back(
+                    &resource_id, std::vector<std::string>(
+                                          std::make_move_iterator(file_paths.begin() + i),
+                                          std::make_move_iterator(file_paths.begin() + end)));
+        }
+    }
+    for (auto& [rid, paths] : file_path_batches) {
+        concurrent_delete_executor.add([&, rid = rid, paths = &paths]() -> int {
             DCHECK(accessor_map_.count(*rid))
                     << "uninitilized accessor, instance_id=" << instance_id_
-                    << " resource_id=" << resource_id << " path[0]=" << (*paths)[0];
+                    << " resource_id=" << *rid << " path[0]=" << (*paths)[0];
             if (!accessor_map_.contains(*rid)) {
                 LOG_WARNING("delete rowset data accessor_map_ does not contains resouce id")
-                        .tag("resource_id", resource_id)
+                        .tag("resource_id", *rid)
                         .tag("instance_id", instance_id_);
                 return -1;
             }
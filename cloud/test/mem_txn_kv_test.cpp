@@ -938,3 +938,26 @@ TEST(TxnMemKvTest, MaybeUnusedFunctionTest) {
         }
     }
 }
+
+TEST(TxnMemKvTest, GetRangeSplitPointsTest) {
+    using namespace doris::cloud;
+    auto txn_kv = std::make_shared<MemTxnKv>();
+    ASSERT_EQ(txn_kv->init(), 0);
+
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+    for (int i = 0; i < 10; ++i) {
+        // Each kv takes 10 bytes
+        txn->put("key" + std::to_string(i), "val012");
+    }
+    ASSERT_EQ(txn->commit(), TxnErrorCode::TXN_OK);
+
+    std::vector<std::string> points;
+    ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+    ASSERT_EQ(txn->get_range_split_points("key", "key:", 30, &points), TxnErrorCode::TXN_OK);
+    ASSERT_EQ(points, (std::vector<std::string> {"key", "key3", "key6", "key9", "key:"}));
+
+    // A chunk larger than the range returns the range itself
+    ASSERT_EQ(txn->get_range_split_points("key", "key:", 1000, &points), TxnErrorCode::TXN_OK);
+    ASSERT_EQ(points, (std::vector<std::string> {"key", "key:"}));
+}
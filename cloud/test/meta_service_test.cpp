@@ -8273,4 +8273,38 @@ TEST(MetaServiceTest, UpdateTmpRowsetTest) {
     }
 }
 
+TEST(MetaServiceTest, ImmutableKvCacheTest) {
+    int64_t capacity = 16;
+    bvar::Adder<int64_t> hits;
+    bvar::Adder<int64_t> misses;
+    ImmutableKvCache<doris::TabletSchemaCloudPB> cache(capacity, &hits, &misses);
+
+    ASSERT_EQ(cache.get("schema_0"), nullptr);
+    for (int i = 0; i < 1000; ++i) {
+        auto schema = std::make_shared<doris::TabletSchemaCloudPB>();
+        schema->set_schema_version(i);
+        cache.put("schema_" + std::to_string(i), std::move(schema));
+    }
+    // the most recently put value is kept
+    auto schema = cache.get("schema_999");
+    ASSERT_NE(schema, nullptr);
+    ASSERT_EQ(schema->schema_version(), 999);
+    int cached = 0;
+    for (int i = 0; i < 1000; ++i) {
+        if (auto value = cache.get("schema_" + std::to_string(i)); value != nullptr) {
+            ASSERT_EQ(value->schema_version(), i);
+            ++cached;
+        }
+    }
+    ASSERT_GT(cached, 0);
+    ASSERT_LE(cached, capacity);
+    ASSERT_EQ(hits.get_value(), cached + 1);
+    ASSERT_EQ(misses.get_value(), 1 + 1000 - cached);
+
+    // a capacity of 0 disables the cache
+    capacity = 0;
+    cache.put("schema_1000", std::make_shared<doris::TabletSchemaCloudPB>());
+    ASSERT_EQ(cache.get("schema_1000"), nullptr);
+}
+
 } // namespace doris::cloud
@@ -3136,6 +3136,21 @@ TEST(RecyclerTest, delete_rowset_data) {
         std::unique_ptr<ListIterator> list_iter;
         ASSERT_EQ(0, accessor->list_all(&list_iter));
         ASSERT_FALSE(list_iter->has_next());
+
+        // The files of one resource are deleted by several batches in parallel
+        auto origin_batch_size = config::recycle_delete_files_batch_size;
+        config::recycle_delete_files_batch_size = 3;
+        rowset_pbs.clear();
+        for (int i = 0; i < 10; ++i) {
+            auto rowset = create_rowset(resource_id, tablet_id + 1, index_id, 5, schemas[i % 5]);
+            create_recycle_rowset(txn_kv.get(), accessor.get(), rowset, RecycleRowsetPB::COMPACT,
+                                  true);
+            rowset_pbs.emplace_back(std::move(rowset));
+        }
+        ASSERT_EQ(0, recycler.delete_rowset_data(rowset_pbs));
+        config::recycle_delete_files_batch_size = origin_batch_size;
+        ASSERT_EQ(0, accessor->list_all(&list_iter));
+        ASSERT_FALSE(list_iter->has_next());
     }
     {
         InstanceRecycler recycler(txn_kv, instance, thread_group,
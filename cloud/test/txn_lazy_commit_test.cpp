@@ -739,6 +739,91 @@ TEST(TxnLazyCommitTest, CommitTxnEventuallyWithDbIdTest) {
     sp->disable_processing();
 }
 
+TEST(TxnLazyCommitTest, CommitTxnEventuallyMultiPartitionsTest) {
+    auto txn_kv = get_mem_txn_kv();
+    int64_t db_id = 7651485415;
+    int64_t table_id = 31478952182;
+    int64_t index_id = 89894142;
+    int64_t partition_id_base = 1241291;
+    std::atomic<int> convert_batch_count = 0;
+
+    auto sp = SyncPoint::get_instance();
+    sp->set_call_back("convert_tmp_rowsets::before_commit",
+                      [&](auto&& args) { convert_batch_count++; });
+    sp->enable_processing();
+
+    auto meta_service = get_meta_service(txn_kv, true);
+    brpc::Controller cntl;
+    BeginTxnRequest req;
+    req.set_cloud_unique_id("test_cloud_unique_id");
+    TxnInfoPB txn_info_pb;
+    txn_info_pb.set_db_id(db_id);
+    txn_info_pb.set_label("test_label_commit_txn_eventually_multi_partitions");
+    txn_info_pb.add_table_ids(table_id);
+    txn_info_pb.set_timeout_ms(36000);
+    req.mutable_txn_info()->CopyFrom(txn_info_pb);
+    BeginTxnResponse res;
+    meta_service->begin_txn(reinterpret_cast<::google::protobuf::RpcController*>(&cntl), &req, &res,
+                            nullptr);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    int64_t txn_id = res.txn_id();
+
+    // mock 3 partitions with 3 tablets each
+    int64_t tablet_id_base = 3131174;
+    for (int i = 0; i < 9; ++i) {
+        int64_t partition_id = partition_id_base + i / 3;
+        create_tablet_with_db_id(meta_service.get(), db_id, table_id, index_id, partition_id,
+                                 tablet_id_base + i);
+        auto tmp_rowset = create_rowset(txn_id, tablet_id_base + i, partition_id);
+        CreateRowsetResponse res;
+        commit_rowset(meta_service.get(), tmp_rowset, res);
+        ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    }
+
+    // every rowset meta exceeds the byte limit, so each one is converted in its own kv txn
+    auto max_bytes_per_batch = config::txn_lazy_max_bytes_per_batch;
+    config::txn_lazy_max_bytes_per_batch = 1;
+    {
+        brpc::Controller cntl;
+        CommitTxnRequest req;
+        req.set_cloud_unique_id("test_cloud_unique_id");
+        req.set_db_id(db_id);
+        req.set_txn_id(txn_id);
+        req.set_is_2pc(false);
+        req.set_enable_txn_lazy_commit(true);
+        CommitTxnResponse res;
+        meta_service->commit_txn(reinterpret_cast<::google::protobuf::RpcController*>(&cntl), &req,
+                                 &res, nullptr);
+        ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    }
+    config::txn_lazy_max_bytes_per_batch = max_bytes_per_batch;
+    ASSERT_EQ(convert_batch_count, 9);
+
+    {
+        std::unique_ptr<Transaction> txn;
+        ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+        for (int i = 0; i < 9; ++i) {
+            int64_t tablet_id = tablet_id_base + i;
+            check_tmp_rowset_not_exist(txn, tablet_id, txn_id);
+            check_rowset_meta_exist(txn, tablet_id, 2);
+        }
+        for (int i = 0; i < 3; ++i) {
+            std::string ver_key = partition_version_key(
+                    {"test_instance", db_id, table_id, partition_id_base + i});
+            std::string ver_val;
+            ASSERT_EQ(txn->get(ver_key, &ver_val), TxnErrorCode::TXN_OK);
+            VersionPB version_pb;
+            ASSERT_TRUE(version_pb.ParseFromString(ver_val));
+            ASSERT_EQ(version_pb.version(), 2);
+            ASSERT_EQ(version_pb.pending_txn_ids_size(), 0);
+        }
+    }
+
+    sp->clear_all_call_backs();
+    sp->clear_trace();
+    sp->disable_processing();
+}
+
 TEST(TxnLazyCommitTest, CommitTxnImmediatelyTest) {
     auto txn_kv = get_mem_txn_kv();
 